@@ -25,6 +25,7 @@ AudioFrame::AudioFrame() {
 void AudioFrame::Reset() {
   ResetWithoutMuting();
   muted_ = true;
+  cached_abs_peak_ = -1;
 }
 
 void AudioFrame::ResetWithoutMuting() {
@@ -69,6 +70,7 @@ void AudioFrame::UpdateFrame(uint32_t timestamp,
   } else {
     muted_ = true;
   }
+  cached_abs_peak_ = -1;
 }
 
 void AudioFrame::CopyFrom(const AudioFrame& src) {
@@ -93,6 +95,7 @@ void AudioFrame::CopyFrom(const AudioFrame& src) {
     memcpy(data_, src.data(), sizeof(int16_t) * length);
     muted_ = false;
   }
+  cached_abs_peak_ = src.cached_abs_peak_;
 }
 
 void AudioFrame::UpdateProfileTimeStamp() {
@@ -118,11 +121,13 @@ int16_t* AudioFrame::mutable_data() {
     memset(data_, 0, kMaxDataSizeBytes);
     muted_ = false;
   }
+  cached_abs_peak_ = -1;
   return data_;
 }
 
 void AudioFrame::Mute() {
   muted_ = true;
+  cached_abs_peak_ = -1;
 }
 
 bool AudioFrame::muted() const {
@@ -98,6 +98,14 @@ class AudioFrame {
   // Frame is muted by default.
   bool muted() const;
 
+  // Absolute peak sample value of the frame, in [0, 32767], or -1 when
+  // unknown. Producers that already iterate over the samples (e.g. the APM
+  // output copy and the mixer's interleave pass) cache the peak here so that
+  // level metering does not need a separate scan over the data. The cache is
+  // invalidated by mutable_data() since the caller may rewrite the samples.
+  int16_t cached_abs_peak() const { return cached_abs_peak_; }
+  void set_cached_abs_peak(int16_t abs_peak) { cached_abs_peak_ = abs_peak; }
+
   size_t max_16bit_samples() const { return kMaxDataSizeSamples; }
   size_t samples_per_channel() const { return samples_per_channel_; }
   size_t num_channels() const { return num_channels_; }
@@ -147,8 +155,12 @@ class AudioFrame {
   // buffer per translation unit is to wrap a static in an inline function.
   static const int16_t* empty_data();
 
-  int16_t data_[kMaxDataSizeSamples];
+  // Aligned to a SIMD vector (SSE2/NEON width) so that kernels iterating the
+  // samples, e.g. the mixer's accumulate and interleave loops, operate on
+  // aligned data.
+  alignas(16) int16_t data_[kMaxDataSizeSamples];
   bool muted_ = true;
+  int16_t cached_abs_peak_ = -1;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(AudioFrame);
 };
@@ -65,6 +65,32 @@ class FrameDecryptorInterface : public rtc::RefCountInterface {
                          rtc::ArrayView<const uint8_t> encrypted_frame,
                          rtc::ArrayView<uint8_t> frame) = 0;
 
+  // One frame of a DecryptBatch() call. The members have the same meaning as
+  // the corresponding arguments of Decrypt().
+  struct EncryptedFrame {
+    rtc::ArrayView<const uint8_t> additional_data;
+    rtc::ArrayView<const uint8_t> encrypted_frame;
+    rtc::ArrayView<uint8_t> frame;
+  };
+
+  // Attempts to decrypt several frames in one call, e.g. when a stash of
+  // buffered frames becomes decryptable after a key arrives. The default
+  // implementation decrypts the frames one by one with Decrypt();
+  // implementations whose crypto backend can pipeline cipher operations may
+  // override it. Returns one Result per input frame, in the same order.
+  virtual std::vector<Result> DecryptBatch(
+      cricket::MediaType media_type,
+      const std::vector<uint32_t>& csrcs,
+      rtc::ArrayView<EncryptedFrame> frames) {
+    std::vector<Result> results;
+    results.reserve(frames.size());
+    for (EncryptedFrame& frame : frames) {
+      results.push_back(Decrypt(media_type, csrcs, frame.additional_data,
+                                frame.encrypted_frame, frame.frame));
+    }
+    return results;
+  }
+
   // Returns the total required length in bytes for the output of the
   // decryption. This can be larger than the actual number of bytes you need but
   // must never be smaller as it informs the size of the frame buffer.
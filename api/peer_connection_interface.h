@@ -431,6 +431,13 @@ class RTC_EXPORT PeerConnectionInterface : public rtc::RefCountInterface {
     // from considertaion for gathering ICE candidates.
     bool disable_link_local_networks = false;
 
+    // Gather all ICE candidate types in parallel, with no delay between the
+    // port allocation phases and with every configured TURN server contacted
+    // (and its hostname resolved) concurrently. Shortens time-to-first-
+    // candidate, and thereby call setup, at the cost of a burst of socket
+    // and DNS activity when gathering starts.
+    bool parallel_port_allocation = false;
+
     // If set to true, use RTP data channels instead of SCTP.
     // TODO(deadbeef): Remove this. We no longer commit to supporting RTP data
     // channels, though some applications are still working on moving off of
@@ -1328,6 +1335,13 @@ class PeerConnectionFactoryInterface : public rtc::RefCountInterface {
   // Set the options to be used for subsequently created PeerConnections.
   virtual void SetOptions(const Options& options) = 0;
 
+  // Pre-generates |count| DTLS certificates on a background thread and pools
+  // them. CreatePeerConnection() hands a pooled certificate to each connection
+  // whose configuration does not supply one, so the first offer does not have
+  // to wait for key generation. Default implementation does nothing so that
+  // downstream factory implementations need not implement it.
+  virtual void PrewarmCertificates(size_t count) {}
+
   // The preferred way to create a new peer connection. Simply provide the
   // configuration and a PeerConnectionDependencies structure.
   // TODO(benwright): Make pure virtual once downstream mock PC factory classes
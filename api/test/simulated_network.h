@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "rtc_base/critical_section.h"
 #include "rtc_base/random.h"
 #include "rtc_base/thread_annotations.h"
@@ -71,6 +72,19 @@ struct BuiltInNetworkBehaviorConfig {
 class NetworkBehaviorInterface {
  public:
   virtual bool EnqueuePacket(PacketInFlightInfo packet_info) = 0;
+  // Enqueues a burst of packets in one call, letting implementations pay
+  // per-call overhead such as configuration snapshots once per batch instead
+  // of once per packet. The returned vector has one entry per packet, true if
+  // the corresponding packet was enqueued. The default implementation just
+  // forwards to EnqueuePacket().
+  virtual std::vector<bool> EnqueuePacketBatch(
+      rtc::ArrayView<const PacketInFlightInfo> packets) {
+    std::vector<bool> sent;
+    sent.reserve(packets.size());
+    for (const PacketInFlightInfo& packet : packets)
+      sent.push_back(EnqueuePacket(packet));
+    return sent;
+  }
   // Retrieves all packets that should be delivered by the given receive time.
   virtual std::vector<PacketDeliveryInfo> DequeueDeliverablePackets(
       int64_t receive_time_us) = 0;
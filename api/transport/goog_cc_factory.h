@@ -24,6 +24,11 @@ struct GoogCcFactoryConfig {
   NetworkStatePredictorFactoryInterface* network_state_predictor_factory =
       nullptr;
   bool feedback_only = false;
+  // Skips allocation of probing and ALR state in the created controllers.
+  // Intended for calls with trivial bandwidth needs (e.g. audio only), where
+  // the loss and delay based estimators alone are sufficient and the per
+  // controller memory footprint matters.
+  bool lightweight = false;
 };
 
 class GoogCcNetworkControllerFactory
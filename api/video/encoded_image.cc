@@ -13,6 +13,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include "rtc_base/ref_counted_object.h"
 
 namespace webrtc {
@@ -56,6 +58,37 @@ void EncodedImageBuffer::Realloc(size_t size) {
   size_ = size;
 }
 
+EncodedImageBufferSlice::EncodedImageBufferSlice(
+    rtc::scoped_refptr<EncodedImageBufferInterface> buffer,
+    size_t offset,
+    size_t length)
+    : buffer_(std::move(buffer)), offset_(offset), length_(length) {
+  RTC_DCHECK(buffer_);
+  RTC_DCHECK_LE(offset_, buffer_->size());
+  RTC_DCHECK_LE(length_, buffer_->size() - offset_);
+}
+
+EncodedImageBufferSlice::~EncodedImageBufferSlice() = default;
+
+// static
+rtc::scoped_refptr<EncodedImageBufferSlice> EncodedImageBufferSlice::Create(
+    rtc::scoped_refptr<EncodedImageBufferInterface> buffer,
+    size_t offset,
+    size_t length) {
+  return new rtc::RefCountedObject<EncodedImageBufferSlice>(std::move(buffer),
+                                                            offset, length);
+}
+
+const uint8_t* EncodedImageBufferSlice::data() const {
+  return buffer_->data() + offset_;
+}
+uint8_t* EncodedImageBufferSlice::data() {
+  return buffer_->data() + offset_;
+}
+size_t EncodedImageBufferSlice::size() const {
+  return length_;
+}
+
 EncodedImage::EncodedImage() : EncodedImage(nullptr, 0, 0) {}
 
 EncodedImage::EncodedImage(EncodedImage&&) = default;
@@ -79,6 +112,14 @@ void EncodedImage::Retain() {
 void EncodedImage::Allocate(size_t capacity) {
   if (encoded_data_ && encoded_data_->HasOneRef()) {
     encoded_data_->Realloc(capacity);
+  } else if (encoded_data_) {
+    // The buffer is shared with someone else, so it can not be reallocated in
+    // place. Copy the contents into a new buffer instead.
+    rtc::scoped_refptr<EncodedImageBuffer> new_data =
+        EncodedImageBuffer::Create(capacity);
+    memcpy(new_data->data(), encoded_data_->data(),
+           std::min(capacity, encoded_data_->size()));
+    encoded_data_ = new_data;
   } else {
     encoded_data_ = EncodedImageBuffer::Create(capacity);
   }
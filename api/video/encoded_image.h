@@ -28,6 +28,7 @@
 #include "api/video/video_timing.h"
 #include "common_types.h"  // NOLINT(build/include)
 #include "rtc_base/checks.h"
+#include "rtc_base/deprecation.h"
 #include "rtc_base/ref_count.h"
 #include "rtc_base/system/rtc_export.h"
 
@@ -73,6 +74,31 @@ class EncodedImageBuffer : public EncodedImageBufferInterface {
   uint8_t* buffer_;
 };
 
+// A read-only view of a sub-range of another refcounted buffer, which is kept
+// alive for the lifetime of the slice. Lets consumers split an encoded frame,
+// e.g. into H264 NAL units, without copying payload bytes.
+class EncodedImageBufferSlice : public EncodedImageBufferInterface {
+ public:
+  static rtc::scoped_refptr<EncodedImageBufferSlice> Create(
+      rtc::scoped_refptr<EncodedImageBufferInterface> buffer,
+      size_t offset,
+      size_t length);
+
+  const uint8_t* data() const override;
+  uint8_t* data() override;
+  size_t size() const override;
+
+ protected:
+  EncodedImageBufferSlice(rtc::scoped_refptr<EncodedImageBufferInterface> buffer,
+                          size_t offset,
+                          size_t length);
+  ~EncodedImageBufferSlice() override;
+
+  const rtc::scoped_refptr<EncodedImageBufferInterface> buffer_;
+  const size_t offset_;
+  const size_t length_;
+};
+
 // TODO(bug.webrtc.org/9378): This is a legacy api class, which is slowly being
 // cleaned up. Direct use of its members is strongly discouraged.
 class RTC_EXPORT EncodedImage {
@@ -139,7 +165,9 @@ class RTC_EXPORT EncodedImage {
     return buffer_ ? capacity_ : (encoded_data_ ? encoded_data_->size() : 0);
   }
 
-  void set_buffer(uint8_t* buffer, size_t capacity) {
+  // Deprecated; the payload should be owned and shared through
+  // SetEncodedData.
+  RTC_DEPRECATED void set_buffer(uint8_t* buffer, size_t capacity) {
     buffer_ = buffer;
     capacity_ = capacity;
   }
@@ -155,6 +183,22 @@ class RTC_EXPORT EncodedImage {
     buffer_ = nullptr;
   }
 
+  // Returns the refcounted payload, so that consumers can share or slice it
+  // instead of copying. Null for images still using an un-owned buffer.
+  rtc::scoped_refptr<EncodedImageBufferInterface> GetEncodedData() const {
+    RTC_DCHECK(buffer_ == nullptr);
+    return encoded_data_;
+  }
+
+  // Releases the reference to the payload, keeping the metadata (including
+  // size()) intact. Used when an image is passed on to deferred consumers
+  // that only need metadata and must not assume the payload is still alive.
+  void ClearEncodedData() {
+    encoded_data_ = nullptr;
+    buffer_ = nullptr;
+    capacity_ = 0;
+  }
+
   // TODO(nisse): Delete, provide only read-only access to the buffer.
   uint8_t* data() {
     return buffer_ ? buffer_
@@ -172,7 +216,7 @@ class RTC_EXPORT EncodedImage {
 
   // TODO(bugs.webrtc.org/9378): Delete. Used by code that wants to modify a
   // buffer corresponding to a const EncodedImage. Requires an un-owned buffer.
-  uint8_t* buffer() const { return buffer_; }
+  RTC_DEPRECATED uint8_t* buffer() const { return buffer_; }
 
   // Hack to workaround lack of ownership of the encoded data. If we don't
   // already own the underlying data, make an owned copy.
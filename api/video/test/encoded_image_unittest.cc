@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/encoded_image.h"
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+const uint8_t kPayload[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+TEST(EncodedImageBufferSliceTest, ExposesSubRange) {
+  rtc::scoped_refptr<EncodedImageBuffer> buffer =
+      EncodedImageBuffer::Create(kPayload, sizeof(kPayload));
+  rtc::scoped_refptr<EncodedImageBufferSlice> slice =
+      EncodedImageBufferSlice::Create(buffer, 2, 4);
+
+  EXPECT_EQ(slice->size(), 4u);
+  EXPECT_EQ(slice->data(), buffer->data() + 2);
+  EXPECT_EQ(slice->data()[0], 2);
+}
+
+TEST(EncodedImageBufferSliceTest, KeepsUnderlyingBufferAlive) {
+  rtc::scoped_refptr<EncodedImageBufferSlice> slice;
+  {
+    rtc::scoped_refptr<EncodedImageBuffer> buffer =
+        EncodedImageBuffer::Create(kPayload, sizeof(kPayload));
+    slice = EncodedImageBufferSlice::Create(buffer, 4, 4);
+  }
+  EXPECT_EQ(slice->size(), 4u);
+  EXPECT_EQ(slice->data()[3], 7);
+}
+
+TEST(EncodedImageTest, ClearEncodedDataKeepsSize) {
+  EncodedImage image;
+  image.SetEncodedData(EncodedImageBuffer::Create(kPayload, sizeof(kPayload)));
+  ASSERT_EQ(image.size(), sizeof(kPayload));
+
+  image.ClearEncodedData();
+  EXPECT_EQ(image.size(), sizeof(kPayload));
+  EXPECT_EQ(image.data(), nullptr);
+  EXPECT_EQ(image.capacity(), 0u);
+}
+
+TEST(EncodedImageTest, CopySharesEncodedData) {
+  EncodedImage image;
+  image.SetEncodedData(EncodedImageBuffer::Create(kPayload, sizeof(kPayload)));
+
+  EncodedImage copy = image;
+  EXPECT_EQ(copy.data(), image.data());
+  EXPECT_EQ(copy.GetEncodedData(), image.GetEncodedData());
+}
+
+}  // namespace
+}  // namespace webrtc
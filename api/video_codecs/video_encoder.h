@@ -270,6 +270,20 @@ class RTC_EXPORT VideoEncoder {
     bool loss_notification;
   };
 
+  // Optional overrides of the encoder's internal threading configuration.
+  // Fields left unset keep the encoder's resolution-based defaults.
+  struct ThreadingSettings {
+    // Caps the number of threads the encoder may use, regardless of
+    // resolution and number of cores.
+    absl::optional<int> max_threads;
+    // Number of bitstream tile columns, in log2 units (0 = 1 tile column,
+    // 1 = 2 tile columns, ...). The encoder may cap this based on image
+    // size; not all encoders support tiling.
+    absl::optional<int> tile_columns_log2;
+    // Enables or disables row-based multithreading within a tile.
+    absl::optional<bool> row_multithreading;
+  };
+
   struct Settings {
     Settings(const Capabilities& capabilities,
              int number_of_cores,
@@ -281,6 +295,7 @@ class RTC_EXPORT VideoEncoder {
     Capabilities capabilities;
     int number_of_cores;
     size_t max_payload_size;
+    ThreadingSettings threading;
   };
 
   static VideoCodecVP8 GetDefaultVp8Settings();
@@ -0,0 +1,57 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "audio/audio_frame_pool.h"
+
+#include <utility>
+
+namespace webrtc {
+
+constexpr size_t AudioFramePool::kMaxPooledFrames;
+
+AudioFramePool* AudioFramePool::Shared() {
+  static AudioFramePool* const pool = new AudioFramePool();
+  return pool;
+}
+
+AudioFramePool::AudioFramePool() = default;
+
+AudioFramePool::~AudioFramePool() = default;
+
+std::unique_ptr<AudioFrame> AudioFramePool::Acquire() {
+  {
+    rtc::CritScope lock(&lock_);
+    if (!free_frames_.empty()) {
+      std::unique_ptr<AudioFrame> audio_frame = std::move(free_frames_.back());
+      free_frames_.pop_back();
+      return audio_frame;
+    }
+  }
+  return std::unique_ptr<AudioFrame>(new AudioFrame());
+}
+
+void AudioFramePool::Release(std::unique_ptr<AudioFrame> audio_frame) {
+  if (!audio_frame) {
+    return;
+  }
+  // Reset() marks the frame muted, which detaches readers from the sample
+  // buffer without zeroing it.
+  audio_frame->Reset();
+  rtc::CritScope lock(&lock_);
+  if (free_frames_.size() < kMaxPooledFrames) {
+    free_frames_.push_back(std::move(audio_frame));
+  }
+}
+
+size_t AudioFramePool::num_pooled_frames_for_testing() const {
+  rtc::CritScope lock(&lock_);
+  return free_frames_.size();
+}
+}  // namespace webrtc
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef AUDIO_AUDIO_FRAME_POOL_H_
+#define AUDIO_AUDIO_FRAME_POOL_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Process-wide recycler for the AudioFrames that carry captured audio from
+// the ADM thread to the per-stream encoder queues. AudioFrame is large
+// (> 10 kB of sample storage), so allocating one per 10 ms block per stream
+// is measurable; acquiring from and releasing to this pool keeps a bounded
+// free list instead. Frames that are destroyed without being released, e.g.
+// when a stream goes away with frames in flight, are simply not recycled.
+//
+// Acquire() and Release() may be called from any thread.
+class AudioFramePool {
+ public:
+  // Returns the process-wide pool used by the capture path.
+  static AudioFramePool* Shared();
+
+  AudioFramePool();
+  ~AudioFramePool();
+
+  // Returns a frame in the default (reset) state, reusing a pooled one when
+  // available.
+  std::unique_ptr<AudioFrame> Acquire();
+
+  // Parks |audio_frame| for reuse. Drops it if the free list is full.
+  void Release(std::unique_ptr<AudioFrame> audio_frame);
+
+  size_t num_pooled_frames_for_testing() const;
+
+ private:
+  // Bounds the memory kept alive; sized for a handful of sending streams
+  // with a full encoder-queue backlog each.
+  static constexpr size_t kMaxPooledFrames = 32;
+
+  rtc::CriticalSection lock_;
+  std::vector<std::unique_ptr<AudioFrame>> free_frames_ RTC_GUARDED_BY(lock_);
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(AudioFramePool);
+};
+}  // namespace webrtc
+
+#endif  // AUDIO_AUDIO_FRAME_POOL_H_
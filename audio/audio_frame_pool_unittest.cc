@@ -0,0 +1,50 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "audio/audio_frame_pool.h"
+
+#include <utility>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(AudioFramePoolTest, ReusesReleasedFrame) {
+  AudioFramePool pool;
+  std::unique_ptr<AudioFrame> frame = pool.Acquire();
+  AudioFrame* const raw_frame = frame.get();
+  frame->sample_rate_hz_ = 48000;
+  frame->samples_per_channel_ = 480;
+  frame->mutable_data()[0] = 1234;
+
+  pool.Release(std::move(frame));
+  EXPECT_EQ(1u, pool.num_pooled_frames_for_testing());
+
+  std::unique_ptr<AudioFrame> reused = pool.Acquire();
+  EXPECT_EQ(raw_frame, reused.get());
+  EXPECT_EQ(0u, pool.num_pooled_frames_for_testing());
+  // The frame must come back in the default state.
+  EXPECT_TRUE(reused->muted());
+  EXPECT_EQ(0u, reused->samples_per_channel_);
+}
+
+TEST(AudioFramePoolTest, AcquireOnEmptyPoolAllocates) {
+  AudioFramePool pool;
+  EXPECT_EQ(0u, pool.num_pooled_frames_for_testing());
+  std::unique_ptr<AudioFrame> frame = pool.Acquire();
+  EXPECT_NE(nullptr, frame);
+}
+
+TEST(AudioFramePoolTest, IgnoresNullRelease) {
+  AudioFramePool pool;
+  pool.Release(nullptr);
+  EXPECT_EQ(0u, pool.num_pooled_frames_for_testing());
+}
+}  // namespace webrtc
@@ -53,13 +53,18 @@ double AudioLevel::TotalDuration() const {
 }
 
 void AudioLevel::ComputeLevel(const AudioFrame& audioFrame, double duration) {
-  // Check speech level (works for 2 channels as well)
-  int16_t abs_value =
-      audioFrame.muted()
-          ? 0
-          : WebRtcSpl_MaxAbsValueW16(
-                audioFrame.data(),
-                audioFrame.samples_per_channel_ * audioFrame.num_channels_);
+  // Check speech level (works for 2 channels as well). Producers that already
+  // iterate over the samples cache the absolute peak on the frame; only scan
+  // the data when no cached value is available.
+  int16_t abs_value = 0;
+  if (!audioFrame.muted()) {
+    abs_value = audioFrame.cached_abs_peak();
+    if (abs_value < 0) {
+      abs_value = WebRtcSpl_MaxAbsValueW16(
+          audioFrame.data(),
+          audioFrame.samples_per_channel_ * audioFrame.num_channels_);
+    }
+  }
 
   // Protect member access using a lock since this method is called on a
   // dedicated audio thread in the RecordedDataIsAvailable() callback.
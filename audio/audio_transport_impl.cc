@@ -14,6 +14,7 @@
 #include <memory>
 #include <utility>
 
+#include "audio/audio_frame_pool.h"
 #include "audio/remix_resample.h"
 #include "audio/utility/audio_frame_operations.h"
 #include "call/audio_send_stream.h"
@@ -121,7 +122,9 @@ int32_t AudioTransportImpl::RecordedDataIsAvailable(
     swap_stereo_channels = swap_stereo_channels_;
   }
 
-  std::unique_ptr<AudioFrame> audio_frame(new AudioFrame());
+  // Pooled frames are recycled by ChannelSend once the encoder queue is done
+  // with them, so the steady state allocates no frames at all.
+  std::unique_ptr<AudioFrame> audio_frame = AudioFramePool::Shared()->Acquire();
   InitializeCaptureFrame(sample_rate, send_sample_rate_hz, number_of_channels,
                          send_num_channels, audio_frame.get());
   voe::RemixAndResample(static_cast<const int16_t*>(audio_data),
@@ -152,7 +155,8 @@ int32_t AudioTransportImpl::RecordedDataIsAvailable(
     if (!sending_streams_.empty()) {
       auto it = sending_streams_.begin();
       while (++it != sending_streams_.end()) {
-        std::unique_ptr<AudioFrame> audio_frame_copy(new AudioFrame());
+        std::unique_ptr<AudioFrame> audio_frame_copy =
+            AudioFramePool::Shared()->Acquire();
         audio_frame_copy->CopyFrom(*audio_frame);
         (*it)->SendAudioData(std::move(audio_frame_copy));
       }
@@ -22,6 +22,7 @@
 #include "api/call/transport.h"
 #include "api/crypto/frame_encryptor_interface.h"
 #include "api/rtc_event_log/rtc_event_log.h"
+#include "audio/audio_frame_pool.h"
 #include "audio/utility/audio_frame_operations.h"
 #include "call/rtp_transport_controller_send_interface.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_playout.h"
@@ -158,15 +159,19 @@ class ChannelSend : public ChannelSendInterface,
   std::vector<ReportBlock> GetRemoteRTCPReportBlocks() const override;
   CallSendStatistics GetRTCPStatistics() const override;
 
-  // ProcessAndEncodeAudio() posts a task on the shared encoder task queue,
-  // which in turn calls (on the queue) ProcessAndEncodeAudioOnTaskQueue() where
-  // the actual processing of the audio takes place. The processing mainly
-  // consists of encoding and preparing the result for sending by adding it to a
-  // send queue.
+  // ProcessAndEncodeAudio() appends the frame to a pending queue and, unless
+  // a drain task is already in flight, posts one on the shared encoder task
+  // queue. The drain task calls (on the queue)
+  // ProcessAndEncodeAudioOnTaskQueue() for every pending frame, where the
+  // actual processing of the audio takes place. The processing mainly
+  // consists of encoding and preparing the result for sending by adding it to
+  // a send queue.
   // The main reason for using a task queue here is to release the native,
   // OS-specific, audio capture thread as soon as possible to ensure that it
   // can go back to sleep and be prepared to deliver an new captured audio
-  // packet.
+  // packet. Coalescing all pending frames into one drain task keeps the
+  // number of task allocations bounded by the encoder queue backlog instead
+  // of growing with the frame rate.
   void ProcessAndEncodeAudio(std::unique_ptr<AudioFrame> audio_frame) override;
 
   // The existence of this function alongside OnUplinkPacketLossRate is
@@ -219,6 +224,11 @@ class ChannelSend : public ChannelSendInterface,
   void ProcessAndEncodeAudioOnTaskQueue(AudioFrame* audio_input)
       RTC_RUN_ON(encoder_queue_);
 
+  // Called on the encoder task queue. Takes over all frames pending in
+  // |pending_frames_| and runs ProcessAndEncodeAudioOnTaskQueue() on each of
+  // them.
+  void DrainPendingFramesOnTaskQueue() RTC_RUN_ON(encoder_queue_);
+
   void OnReceivedRtt(int64_t rtt_ms);
 
   void OnTargetTransferRate(TargetTransferRate) override;
@@ -273,6 +283,19 @@ class ChannelSend : public ChannelSendInterface,
 
   bool encoder_queue_is_active_ RTC_GUARDED_BY(encoder_queue_) = false;
 
+  // Frames delivered by the capture thread that are waiting for the drain
+  // task to pick them up. |drain_task_posted_| is true while a drain task is
+  // pending or running, so at most one such task is in flight at a time.
+  rtc::CriticalSection pending_frames_lock_;
+  std::vector<std::unique_ptr<AudioFrame>> pending_frames_
+      RTC_GUARDED_BY(pending_frames_lock_);
+  bool drain_task_posted_ RTC_GUARDED_BY(pending_frames_lock_) = false;
+  // Reused batch storage for the drain task; swapping it with
+  // |pending_frames_| keeps the vector capacities alive so that the steady
+  // state runs without heap allocations.
+  std::vector<std::unique_ptr<AudioFrame>> drain_buffer_
+      RTC_GUARDED_BY(encoder_queue_);
+
   MediaTransportConfig media_transport_config_;
   int media_transport_sequence_number_ RTC_GUARDED_BY(encoder_queue_) = 0;
 
@@ -1049,21 +1072,43 @@ CallSendStatistics ChannelSend::GetRTCPStatistics() const {
 void ChannelSend::ProcessAndEncodeAudio(
     std::unique_ptr<AudioFrame> audio_frame) {
   RTC_DCHECK_RUNS_SERIALIZED(&audio_thread_race_checker_);
-  struct ProcessAndEncodeAudio {
-    void operator()() {
-      RTC_DCHECK_RUN_ON(&channel->encoder_queue_);
-      if (!channel->encoder_queue_is_active_) {
-        return;
-      }
-      channel->ProcessAndEncodeAudioOnTaskQueue(audio_frame.get());
-    }
-    std::unique_ptr<AudioFrame> audio_frame;
-    ChannelSend* const channel;
-  };
   // Profile time between when the audio frame is added to the task queue and
   // when the task is actually executed.
   audio_frame->UpdateProfileTimeStamp();
-  encoder_queue_.PostTask(ProcessAndEncodeAudio{std::move(audio_frame), this});
+  bool post_drain_task = false;
+  {
+    rtc::CritScope lock(&pending_frames_lock_);
+    pending_frames_.push_back(std::move(audio_frame));
+    if (!drain_task_posted_) {
+      drain_task_posted_ = true;
+      post_drain_task = true;
+    }
+  }
+  if (post_drain_task) {
+    encoder_queue_.PostTask([this] {
+      RTC_DCHECK_RUN_ON(&encoder_queue_);
+      DrainPendingFramesOnTaskQueue();
+    });
+  }
+}
+
+void ChannelSend::DrainPendingFramesOnTaskQueue() {
+  drain_buffer_.clear();
+  {
+    rtc::CritScope lock(&pending_frames_lock_);
+    drain_buffer_.swap(pending_frames_);
+    drain_task_posted_ = false;
+  }
+  if (encoder_queue_is_active_) {
+    for (std::unique_ptr<AudioFrame>& audio_frame : drain_buffer_) {
+      ProcessAndEncodeAudioOnTaskQueue(audio_frame.get());
+    }
+  }
+  // Hand the frames back to the capture path for reuse.
+  for (std::unique_ptr<AudioFrame>& audio_frame : drain_buffer_) {
+    AudioFramePool::Shared()->Release(std::move(audio_frame));
+  }
+  drain_buffer_.clear();
 }
 
 void ChannelSend::ProcessAndEncodeAudioOnTaskQueue(AudioFrame* audio_input) {
@@ -10,6 +10,8 @@
 
 #include "audio/remix_resample.h"
 
+#include <algorithm>
+
 #include "api/audio/audio_frame.h"
 #include "audio/utility/audio_frame_operations.h"
 #include "common_audio/resampler/include/push_resampler.h"
@@ -36,6 +38,27 @@ void RemixAndResample(const int16_t* src_data,
                       int sample_rate_hz,
                       PushResampler<int16_t>* resampler,
                       AudioFrame* dst_frame) {
+  // When the rates match, the resampler pass is a plain copy, so remix
+  // straight into the destination frame and skip both the intermediate
+  // downmix buffer and the copy. This is the common case when capture device
+  // and codec agree on the rate, typically 48 kHz.
+  if (sample_rate_hz == dst_frame->sample_rate_hz_) {
+    if (num_channels > dst_frame->num_channels_) {
+      AudioFrameOperations::DownmixChannels(
+          src_data, num_channels, samples_per_channel,
+          dst_frame->num_channels_, dst_frame->mutable_data());
+    } else {
+      std::copy(src_data, src_data + samples_per_channel * num_channels,
+                dst_frame->mutable_data());
+    }
+    dst_frame->samples_per_channel_ = samples_per_channel;
+    if (num_channels == 1 && dst_frame->num_channels_ == 2) {
+      dst_frame->num_channels_ = 1;
+      AudioFrameOperations::UpmixChannels(2, dst_frame);
+    }
+    return;
+  }
+
   const int16_t* audio_ptr = src_data;
   size_t audio_ptr_num_channels = num_channels;
   int16_t downmixed_audio[AudioFrame::kMaxDataSizeSamples];
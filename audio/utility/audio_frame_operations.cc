@@ -19,6 +19,14 @@
 #include "common_audio/include/audio_util.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 namespace {
@@ -168,8 +176,31 @@ void AudioFrameOperations::UpmixChannels(size_t target_number_of_channels,
 
   if (!frame->muted()) {
     // Up-mixing done in place. Going backwards through the frame ensure nothing
-    // is irrevocably overwritten.
-    for (int i = frame->samples_per_channel_ - 1; i >= 0; i--) {
+    // is irrevocably overwritten. Writes land at indices no smaller than the
+    // reads, so each block can be read in full before it is overwritten and
+    // the vectorized mono-to-stereo duplication below stays safe.
+    int i = frame->samples_per_channel_ - 1;
+    if (target_number_of_channels == 2) {
+      int16_t* data = frame->mutable_data();
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      for (; i >= 7; i -= 8) {
+        const __m128i x = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i - 7));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + 2 * (i - 7)),
+                         _mm_unpacklo_epi16(x, x));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + 2 * (i - 7) + 8),
+                         _mm_unpackhi_epi16(x, x));
+      }
+#elif defined(WEBRTC_HAS_NEON)
+      for (; i >= 7; i -= 8) {
+        int16x8x2_t duplicated;
+        duplicated.val[0] = vld1q_s16(data + i - 7);
+        duplicated.val[1] = duplicated.val[0];
+        vst2q_s16(data + 2 * (i - 7), duplicated);
+      }
+#endif
+    }
+    for (; i >= 0; i--) {
       for (size_t j = 0; j < target_number_of_channels; ++j) {
         frame->mutable_data()[target_number_of_channels * i + j] =
             frame->data()[i];
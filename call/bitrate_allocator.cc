@@ -65,6 +65,10 @@ BitrateAllocator::BitrateAllocator(Clock* clock, LimitObserver* limit_observer)
       total_requested_padding_bitrate_(0),
       total_requested_min_bitrate_(0),
       total_requested_max_bitrate_(0),
+      cached_sum_min_bitrates_(0),
+      cached_sum_max_bitrates_(0),
+      cached_bitrate_priority_sum_(0),
+      allocation_converged_(false),
       transmission_max_bitrate_multiplier_(
           GetTransmissionMaxBitrateMultiplier()) {
   sequenced_checker_.Detach();
@@ -101,6 +105,12 @@ void BitrateAllocator::OnNetworkChanged(uint32_t target_bitrate_bps,
                                         int64_t rtt,
                                         int64_t bwe_period_ms) {
   RTC_DCHECK_RUN_ON(&sequenced_checker_);
+  const bool network_state_unchanged =
+      target_bitrate_bps == last_target_bps_ &&
+      stable_target_bitrate_bps == last_stable_target_bps_ &&
+      bandwidth_bps == last_bandwidth_bps_ &&
+      fraction_loss == last_fraction_loss_ && rtt == last_rtt_ &&
+      bwe_period_ms == last_bwe_period_ms_;
   last_target_bps_ = target_bitrate_bps;
   last_bandwidth_bps_ = bandwidth_bps;
   last_stable_target_bps_ = stable_target_bitrate_bps;
@@ -117,11 +127,21 @@ void BitrateAllocator::OnNetworkChanged(uint32_t target_bitrate_bps,
     last_bwe_log_time_ = now;
   }
 
+  // The allocation is a deterministic function of the network state and the
+  // per-observer pause/protection state updated below. When the previous
+  // pass left that state unchanged, repeating it for the same network state
+  // would push identical updates to every observer, so skip it. BWE reports
+  // several times per second and often repeats the same clamped estimate,
+  // making this the common steady-state case.
+  if (network_state_unchanged && allocation_converged_)
+    return;
+
   ObserverAllocation allocation = AllocateBitrates(target_bitrate_bps);
   ObserverAllocation bandwidth_allocation = AllocateBitrates(bandwidth_bps);
   ObserverAllocation stable_bitrate_allocation =
       AllocateBitrates(stable_target_bitrate_bps);
 
+  bool observer_state_changed = false;
   for (auto& config : bitrate_observer_configs_) {
     uint32_t allocated_bitrate = allocation[config.observer];
     uint32_t allocated_bandwidth = bandwidth_allocation[config.observer];
@@ -158,10 +178,17 @@ void BitrateAllocator::OnNetworkChanged(uint32_t target_bitrate_bps,
     }
 
     // Only update the media ratio if the observer got an allocation.
-    if (allocated_bitrate > 0)
-      config.media_ratio = MediaRatio(allocated_bitrate, protection_bitrate);
+    if (allocated_bitrate > 0) {
+      double media_ratio = MediaRatio(allocated_bitrate, protection_bitrate);
+      if (media_ratio != config.media_ratio)
+        observer_state_changed = true;
+      config.media_ratio = media_ratio;
+    }
+    if (config.allocated_bitrate_bps != allocated_bitrate)
+      observer_state_changed = true;
     config.allocated_bitrate_bps = allocated_bitrate;
   }
+  allocation_converged_ = !observer_state_changed;
   UpdateAllocationLimits();
 }
 
@@ -185,6 +212,7 @@ void BitrateAllocator::AddObserver(BitrateAllocatorObserver* observer,
                        config.pad_up_bitrate_bps, config.priority_bitrate_bps,
                        config.enforce_min_bitrate, config.bitrate_priority));
   }
+  RebuildAllocationCaches();
 
   if (last_target_bps_ > 0) {
     // Calculate a new allocation and update all observers.
@@ -265,12 +293,35 @@ void BitrateAllocator::UpdateAllocationLimits() {
                                              total_requested_max_bitrate);
 }
 
+void BitrateAllocator::RebuildAllocationCaches() {
+  cached_sum_min_bitrates_ = 0;
+  cached_sum_max_bitrates_ = 0;
+  cached_bitrate_priority_sum_ = 0;
+  observers_by_max_bitrate_.clear();
+  observers_by_max_bitrate_.reserve(bitrate_observer_configs_.size());
+  for (const auto& observer_config : bitrate_observer_configs_) {
+    cached_sum_min_bitrates_ += observer_config.min_bitrate_bps;
+    cached_sum_max_bitrates_ += observer_config.max_bitrate_bps;
+    cached_bitrate_priority_sum_ += observer_config.bitrate_priority;
+    observers_by_max_bitrate_.push_back(&observer_config);
+  }
+  // Stable, so that observers with equal max bitrate keep their insertion
+  // order, like the multimap this replaces.
+  std::stable_sort(observers_by_max_bitrate_.begin(),
+                   observers_by_max_bitrate_.end(),
+                   [](const ObserverConfig* a, const ObserverConfig* b) {
+                     return a->max_bitrate_bps < b->max_bitrate_bps;
+                   });
+  allocation_converged_ = false;
+}
+
 void BitrateAllocator::RemoveObserver(BitrateAllocatorObserver* observer) {
   RTC_DCHECK_RUN_ON(&sequenced_checker_);
 
   auto it = FindObserverConfig(observer);
   if (it != bitrate_observer_configs_.end()) {
     bitrate_observer_configs_.erase(it);
+    RebuildAllocationCaches();
   }
 
   UpdateAllocationLimits();
@@ -323,12 +374,8 @@ BitrateAllocator::ObserverAllocation BitrateAllocator::AllocateBitrates(
   if (bitrate == 0)
     return ZeroRateAllocation();
 
-  uint32_t sum_min_bitrates = 0;
-  uint32_t sum_max_bitrates = 0;
-  for (const auto& observer_config : bitrate_observer_configs_) {
-    sum_min_bitrates += observer_config.min_bitrate_bps;
-    sum_max_bitrates += observer_config.max_bitrate_bps;
-  }
+  const uint32_t sum_min_bitrates = cached_sum_min_bitrates_;
+  const uint32_t sum_max_bitrates = cached_sum_max_bitrates_;
 
   // Not enough for all observers to get an allocation, allocate according to:
   // enforced min bitrate -> allocated bitrate previous round -> restart paused
@@ -494,31 +541,36 @@ void BitrateAllocator::DistributeBitrateEvenly(
     ObserverAllocation* allocation) const {
   RTC_DCHECK_EQ(allocation->size(), bitrate_observer_configs_.size());
 
-  ObserverSortingMap list_max_bitrates;
-  for (const auto& observer_config : bitrate_observer_configs_) {
+  size_t num_remaining = 0;
+  for (const ObserverConfig* observer_config : observers_by_max_bitrate_) {
     if (include_zero_allocations ||
-        allocation->at(observer_config.observer) != 0) {
-      list_max_bitrates.insert(std::pair<uint32_t, const ObserverConfig*>(
-          observer_config.max_bitrate_bps, &observer_config));
+        allocation->at(observer_config->observer) != 0) {
+      ++num_remaining;
     }
   }
-  auto it = list_max_bitrates.begin();
-  while (it != list_max_bitrates.end()) {
+  // Walk the cached list from the smallest max bitrate, so that what doesn't
+  // fit for one observer is carried over to the remaining observers.
+  for (const ObserverConfig* observer_config : observers_by_max_bitrate_) {
+    if (!include_zero_allocations &&
+        allocation->at(observer_config->observer) == 0) {
+      continue;
+    }
     RTC_DCHECK_GT(bitrate, 0);
     uint32_t extra_allocation =
-        bitrate / static_cast<uint32_t>(list_max_bitrates.size());
+        bitrate / static_cast<uint32_t>(num_remaining);
     uint32_t total_allocation =
-        extra_allocation + allocation->at(it->second->observer);
+        extra_allocation + allocation->at(observer_config->observer);
     bitrate -= extra_allocation;
-    if (total_allocation > max_multiplier * it->first) {
+    if (total_allocation > max_multiplier * observer_config->max_bitrate_bps) {
       // There is more than we can fit for this observer, carry over to the
       // remaining observers.
-      bitrate += total_allocation - max_multiplier * it->first;
-      total_allocation = max_multiplier * it->first;
+      bitrate +=
+          total_allocation - max_multiplier * observer_config->max_bitrate_bps;
+      total_allocation = max_multiplier * observer_config->max_bitrate_bps;
     }
     // Finally, update the allocation for this observer.
-    allocation->at(it->second->observer) = total_allocation;
-    it = list_max_bitrates.erase(it);
+    allocation->at(observer_config->observer) = total_allocation;
+    --num_remaining;
   }
 }
 
@@ -572,13 +624,13 @@ void BitrateAllocator::DistributeBitrateRelatively(
     }
   };
 
-  double bitrate_priority_sum = 0;
+  double bitrate_priority_sum = cached_bitrate_priority_sum_;
   std::vector<PriorityRateObserverConfig> priority_rate_observers;
+  priority_rate_observers.reserve(bitrate_observer_configs_.size());
   for (const auto& observer_config : bitrate_observer_configs_) {
     uint32_t capacity_bps = observers_capacities.at(observer_config.observer);
     priority_rate_observers.emplace_back(observer_config.observer, capacity_bps,
                                          observer_config.bitrate_priority);
-    bitrate_priority_sum += observer_config.bitrate_priority;
   }
 
   // Iterate in the order observers can be allocated their full capacity.
@@ -163,6 +163,11 @@ class BitrateAllocator : public BitrateAllocatorInterface {
   // calls LimitObserver::OnAllocationLimitsChanged.
   void UpdateAllocationLimits() RTC_RUN_ON(&sequenced_checker_);
 
+  // Rebuilds the cached bitrate sums and the sorted observer list after the
+  // set of observers or their configs changed, so that the per-estimate
+  // allocation passes don't have to recompute them.
+  void RebuildAllocationCaches() RTC_RUN_ON(&sequenced_checker_);
+
   typedef std::vector<ObserverConfig> ObserverConfigs;
   ObserverConfigs::const_iterator FindObserverConfig(
       const BitrateAllocatorObserver* observer) const
@@ -170,7 +175,6 @@ class BitrateAllocator : public BitrateAllocatorInterface {
   ObserverConfigs::iterator FindObserverConfig(
       const BitrateAllocatorObserver* observer) RTC_RUN_ON(&sequenced_checker_);
 
-  typedef std::multimap<uint32_t, const ObserverConfig*> ObserverSortingMap;
   typedef std::map<BitrateAllocatorObserver*, int> ObserverAllocation;
 
   ObserverAllocation AllocateBitrates(uint32_t bitrate) const
@@ -242,6 +246,19 @@ class BitrateAllocator : public BitrateAllocatorInterface {
   uint32_t total_requested_padding_bitrate_ RTC_GUARDED_BY(&sequenced_checker_);
   uint32_t total_requested_min_bitrate_ RTC_GUARDED_BY(&sequenced_checker_);
   uint32_t total_requested_max_bitrate_ RTC_GUARDED_BY(&sequenced_checker_);
+  // Cached allocation state derived from the static parts of
+  // |bitrate_observer_configs_|, maintained by RebuildAllocationCaches().
+  uint32_t cached_sum_min_bitrates_ RTC_GUARDED_BY(&sequenced_checker_);
+  uint32_t cached_sum_max_bitrates_ RTC_GUARDED_BY(&sequenced_checker_);
+  double cached_bitrate_priority_sum_ RTC_GUARDED_BY(&sequenced_checker_);
+  // Pointers into |bitrate_observer_configs_| sorted by max bitrate, in the
+  // order DistributeBitrateEvenly() fills observers up.
+  std::vector<const ObserverConfig*> observers_by_max_bitrate_
+      RTC_GUARDED_BY(&sequenced_checker_);
+  // True when the last OnNetworkChanged() pass left every observer's
+  // allocated bitrate and media ratio unchanged, meaning a repeat of the
+  // same network state would push identical updates and can be skipped.
+  bool allocation_converged_ RTC_GUARDED_BY(&sequenced_checker_);
   const uint8_t transmission_max_bitrate_multiplier_;
 };
 
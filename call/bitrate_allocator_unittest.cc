@@ -949,4 +949,40 @@ TEST_F(BitrateAllocatorTest, PriorityRateThreeObserversTwoAllocatedToMax) {
   allocator_->RemoveObserver(&observer_high);
 }
 
+TEST_F(BitrateAllocatorTest, SkipsReallocationForRepeatedNetworkState) {
+  class CountingBitrateObserver : public TestBitrateObserver {
+   public:
+    uint32_t OnBitrateUpdated(BitrateAllocationUpdate update) override {
+      ++num_updates_;
+      return TestBitrateObserver::OnBitrateUpdated(update);
+    }
+    int num_updates_ = 0;
+  };
+  CountingBitrateObserver bitrate_observer;
+  EXPECT_CALL(limit_observer_, OnAllocationLimitsChanged(_, _, _))
+      .Times(::testing::AnyNumber());
+  AddObserver(&bitrate_observer, 100000, 400000, 0, true,
+              kDefaultBitratePriority);
+  const int updates_after_add = bitrate_observer.num_updates_;
+
+  // The first pass for a new estimate reallocates, and a second identical
+  // one still runs since the first changed the observer's allocation.
+  allocator_->OnNetworkChanged(200000, 0, 0, kDefaultProbingIntervalMs);
+  allocator_->OnNetworkChanged(200000, 0, 0, kDefaultProbingIntervalMs);
+  const int updates_at_steady_state = bitrate_observer.num_updates_;
+  EXPECT_GT(updates_at_steady_state, updates_after_add);
+
+  // Once the allocation has converged, repeating the same network state
+  // pushes no further updates.
+  allocator_->OnNetworkChanged(200000, 0, 0, kDefaultProbingIntervalMs);
+  EXPECT_EQ(updates_at_steady_state, bitrate_observer.num_updates_);
+
+  // A new estimate reallocates again.
+  allocator_->OnNetworkChanged(250000, 0, 0, kDefaultProbingIntervalMs);
+  EXPECT_GT(bitrate_observer.num_updates_, updates_at_steady_state);
+  EXPECT_EQ(250000u, bitrate_observer.last_bitrate_bps_);
+
+  allocator_->RemoveObserver(&bitrate_observer);
+}
+
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include "call/call.h"
 
+#include <stdio.h>
 #include <string.h>
 
 #include <algorithm>
@@ -31,6 +32,7 @@
 #include "call/receive_time_calculator.h"
 #include "call/rtp_stream_receiver_controller.h"
 #include "call/rtp_transport_controller_send.h"
+#include "call/shared_call_resources.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_receive_stream_config.h"
 #include "logging/rtc_event_log/events/rtc_event_rtcp_packet_incoming.h"
 #include "logging/rtc_event_log/events/rtc_event_rtp_packet_incoming.h"
@@ -51,8 +53,9 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_minmax.h"
 #include "rtc_base/strings/string_builder.h"
-#include "rtc_base/synchronization/rw_lock_wrapper.h"
+#include "rtc_base/synchronization/read_mostly_rw_lock.h"
 #include "rtc_base/synchronization/sequence_checker.h"
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
@@ -102,6 +105,30 @@ bool UseSendSideBwe(const FlexfecReceiveStream::Config& config) {
   return UseSendSideBwe(config.rtp_header_extensions, config.transport_cc);
 }
 
+// Returns the number of decode task queues that video receive streams should
+// share, as configured by the WebRTC-Video-SharedDecodeQueues field trial, or
+// 0 if every stream should keep creating a dedicated decode queue.
+size_t NumSharedDecodeQueues() {
+  std::string group =
+      field_trial::FindFullName("WebRTC-Video-SharedDecodeQueues");
+  int num_queues = 0;
+  if (sscanf(group.c_str(), "Enabled-%d", &num_queues) == 1 && num_queues > 0)
+    return num_queues;
+  return 0;
+}
+
+// Returns the number of delivery shards that the RTP stream receiver
+// controllers should partition their SSRCs over, as configured by the
+// WebRTC-ShardedRtpDelivery field trial, or 0 for the default mode where
+// packets are demuxed and delivered synchronously in DeliverRtp().
+size_t NumRtpDeliveryShards() {
+  std::string group = field_trial::FindFullName("WebRTC-ShardedRtpDelivery");
+  int num_shards = 0;
+  if (sscanf(group.c_str(), "Enabled-%d", &num_shards) == 1 && num_shards > 0)
+    return num_shards;
+  return 0;
+}
+
 const int* FindKeyByValue(const std::map<int, int>& m, int v) {
   for (const auto& kv : m) {
     if (kv.second == v)
@@ -216,6 +243,8 @@ class Call final : public webrtc::Call,
   DeliveryStatus DeliverPacket(MediaType media_type,
                                rtc::CopyOnWriteBuffer packet,
                                int64_t packet_time_us) override;
+  void DeliverPacketBatch(
+      rtc::ArrayView<PacketReceiver::ReceivedPacket> packets) override;
 
   // Implements RecoveredPacketReceiver.
   void OnRecoveredPacket(const uint8_t* packet, size_t length) override;
@@ -245,6 +274,17 @@ class Call final : public webrtc::Call,
   DeliveryStatus DeliverRtp(MediaType media_type,
                             rtc::CopyOnWriteBuffer packet,
                             int64_t packet_time_us);
+  // Sets the arrival time of |packet| from |packet_time_us|, or to
+  // |fallback_arrival_time_ms| when no capture time was provided. The
+  // fallback lets batch delivery read the clock once per burst.
+  void SetRtpArrivalTime(RtpPacketReceived* packet,
+                         int64_t packet_time_us,
+                         int64_t fallback_arrival_time_ms);
+  // Demuxes and delivers an already parsed RTP packet and updates the
+  // receive statistics.
+  DeliveryStatus DeliverParsedRtp(MediaType media_type,
+                                  RtpPacketReceived parsed_packet)
+      RTC_SHARED_LOCKS_REQUIRED(receive_crit_);
   void ConfigureSync(const std::string& sync_group)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(receive_crit_);
 
@@ -266,6 +306,10 @@ class Call final : public webrtc::Call,
 
   Clock* const clock_;
   TaskQueueFactory* const task_queue_factory_;
+  // Set when the WebRTC-Video-SharedDecodeQueues field trial is enabled, in
+  // which case video receive streams get their decode queues from this
+  // fixed-size pool instead of creating one dedicated thread each.
+  std::unique_ptr<PooledTaskQueueFactory> shared_decode_queue_factory_;
 
   const int num_cpu_cores_;
   const std::unique_ptr<ProcessThread> module_process_thread_;
@@ -279,7 +323,7 @@ class Call final : public webrtc::Call,
   NetworkState video_network_state_;
   bool aggregate_network_up_ RTC_GUARDED_BY(configuration_sequence_checker_);
 
-  std::unique_ptr<RWLockWrapper> receive_crit_;
+  ReadMostlyRWLock receive_crit_;
   // Audio, Video, and FlexFEC receive streams are owned by the client that
   // creates them.
   std::set<AudioReceiveStream*> audio_receive_streams_
@@ -292,6 +336,9 @@ class Call final : public webrtc::Call,
 
   // TODO(nisse): Should eventually be injected at creation,
   // with a single object in the bundled case.
+  // When the WebRTC-ShardedRtpDelivery field trial is enabled the
+  // controllers demux and deliver on a set of shared delivery task queues,
+  // partitioned by SSRC, instead of in the thread calling DeliverRtp().
   RtpStreamReceiverController audio_receiver_controller_;
   RtpStreamReceiverController video_receiver_controller_;
 
@@ -324,7 +371,7 @@ class Call final : public webrtc::Call,
   std::map<uint32_t, ReceiveRtpConfig> receive_rtp_config_
       RTC_GUARDED_BY(receive_crit_);
 
-  std::unique_ptr<RWLockWrapper> send_crit_;
+  ReadMostlyRWLock send_crit_;
   // Audio and Video send streams are owned by the client that creates them.
   std::map<uint32_t, AudioSendStream*> audio_send_ssrcs_
       RTC_GUARDED_BY(send_crit_);
@@ -400,11 +447,24 @@ std::string Call::Stats::ToString(int64_t time_ms) const {
   ss << "max_pad_bps: " << max_padding_bitrate_bps << ", ";
   ss << "pacer_delay_ms: " << pacer_delay_ms << ", ";
   ss << "rtt_ms: " << rtt_ms;
+  if (pacer_queue_time_p50_ms >= 0) {
+    ss << ", pacer_queue_time_p50_ms: " << pacer_queue_time_p50_ms << ", ";
+    ss << "pacer_queue_time_p95_ms: " << pacer_queue_time_p95_ms << ", ";
+    ss << "pacer_send_burst_p95_packets: " << pacer_send_burst_p95_packets;
+  }
   ss << '}';
   return ss.str();
 }
 
 Call* Call::Create(const Call::Config& config) {
+  if (config.shared_call_resources) {
+    Call::Config pooled_config = config;
+    pooled_config.task_queue_factory =
+        config.shared_call_resources->task_queue_factory();
+    return Create(pooled_config, Clock::GetRealTimeClock(),
+                  config.shared_call_resources->CreateModuleProcessThread(),
+                  config.shared_call_resources->CreatePacerThread());
+  }
   return Create(config, Clock::GetRealTimeClock(),
                 ProcessThread::Create("ModuleProcessThread"),
                 ProcessThread::Create("PacerThread"));
@@ -451,8 +511,8 @@ Call::Call(Clock* clock,
       audio_network_state_(kNetworkDown),
       video_network_state_(kNetworkDown),
       aggregate_network_up_(false),
-      receive_crit_(RWLockWrapper::CreateRWLock()),
-      send_crit_(RWLockWrapper::CreateRWLock()),
+      audio_receiver_controller_(task_queue_factory, NumRtpDeliveryShards()),
+      video_receiver_controller_(task_queue_factory, NumRtpDeliveryShards()),
       event_log_(config.event_log),
       received_bytes_per_second_counter_(clock_, nullptr, true),
       received_audio_bytes_per_second_counter_(clock_, nullptr, true),
@@ -472,6 +532,13 @@ Call::Call(Clock* clock,
   RTC_DCHECK(config.event_log != nullptr);
   worker_sequence_checker_.Detach();
 
+  const size_t num_shared_decode_queues = NumSharedDecodeQueues();
+  if (num_shared_decode_queues > 0) {
+    shared_decode_queue_factory_ = absl::make_unique<PooledTaskQueueFactory>(
+        *task_queue_factory_, num_shared_decode_queues, "SharedDecodingQueue",
+        TaskQueueFactory::Priority::HIGH);
+  }
+
   call_stats_->RegisterStatsObserver(&receive_side_cc_);
 
   module_process_thread_->RegisterModule(
@@ -635,13 +702,13 @@ webrtc::AudioSendStream* Call::CreateAudioSendStream(
                           transport_send_ptr_, bitrate_allocator_.get(),
                           event_log_, call_stats_.get(), suspended_rtp_state);
   {
-    WriteLockScoped write_lock(*send_crit_);
+    ReadMostlyWriteLockScoped write_lock(send_crit_);
     RTC_DCHECK(audio_send_ssrcs_.find(config.rtp.ssrc) ==
                audio_send_ssrcs_.end());
     audio_send_ssrcs_[config.rtp.ssrc] = send_stream;
   }
   {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
       if (stream->config().rtp.local_ssrc == config.rtp.ssrc) {
         stream->AssociateSendStream(send_stream);
@@ -664,12 +731,12 @@ void Call::DestroyAudioSendStream(webrtc::AudioSendStream* send_stream) {
       static_cast<webrtc::internal::AudioSendStream*>(send_stream);
   suspended_audio_send_ssrcs_[ssrc] = audio_send_stream->GetRtpState();
   {
-    WriteLockScoped write_lock(*send_crit_);
+    ReadMostlyWriteLockScoped write_lock(send_crit_);
     size_t num_deleted = audio_send_ssrcs_.erase(ssrc);
     RTC_DCHECK_EQ(1, num_deleted);
   }
   {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
       if (stream->config().rtp.local_ssrc == ssrc) {
         stream->AssociateSendStream(nullptr);
@@ -691,7 +758,7 @@ webrtc::AudioReceiveStream* Call::CreateAudioReceiveStream(
       clock_, &audio_receiver_controller_, transport_send_ptr_->packet_router(),
       module_process_thread_.get(), config, config_.audio_state, event_log_);
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
     receive_rtp_config_.emplace(config.rtp.remote_ssrc,
                                 ReceiveRtpConfig(config));
     audio_receive_streams_.insert(receive_stream);
@@ -699,7 +766,7 @@ webrtc::AudioReceiveStream* Call::CreateAudioReceiveStream(
     ConfigureSync(config.sync_group);
   }
   {
-    ReadLockScoped read_lock(*send_crit_);
+    ReadMostlyReadLockScoped read_lock(send_crit_);
     auto it = audio_send_ssrcs_.find(config.rtp.local_ssrc);
     if (it != audio_send_ssrcs_.end()) {
       receive_stream->AssociateSendStream(it->second);
@@ -717,7 +784,7 @@ void Call::DestroyAudioReceiveStream(
   webrtc::internal::AudioReceiveStream* audio_receive_stream =
       static_cast<webrtc::internal::AudioReceiveStream*>(receive_stream);
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
     const AudioReceiveStream::Config& config = audio_receive_stream->config();
     uint32_t ssrc = config.rtp.remote_ssrc;
     receive_side_cc_.GetRemoteBitrateEstimator(UseSendSideBwe(config))
@@ -766,7 +833,7 @@ webrtc::VideoSendStream* Call::CreateVideoSendStream(
       suspended_video_payload_states_, std::move(fec_controller));
 
   {
-    WriteLockScoped write_lock(*send_crit_);
+    ReadMostlyWriteLockScoped write_lock(send_crit_);
     for (uint32_t ssrc : ssrcs) {
       RTC_DCHECK(video_send_ssrcs_.find(ssrc) == video_send_ssrcs_.end());
       video_send_ssrcs_[ssrc] = send_stream;
@@ -801,7 +868,7 @@ void Call::DestroyVideoSendStream(webrtc::VideoSendStream* send_stream) {
 
   VideoSendStream* send_stream_impl = nullptr;
   {
-    WriteLockScoped write_lock(*send_crit_);
+    ReadMostlyWriteLockScoped write_lock(send_crit_);
     auto it = video_send_ssrcs_.begin();
     while (it != video_send_ssrcs_.end()) {
       if (it->second == static_cast<VideoSendStream*>(send_stream)) {
@@ -841,13 +908,15 @@ webrtc::VideoReceiveStream* Call::CreateVideoReceiveStream(
   RegisterRateObserver();
 
   VideoReceiveStream* receive_stream = new VideoReceiveStream(
-      task_queue_factory_, &video_receiver_controller_, num_cpu_cores_,
+      shared_decode_queue_factory_ ? shared_decode_queue_factory_.get()
+                                   : task_queue_factory_,
+      &video_receiver_controller_, num_cpu_cores_,
       transport_send_ptr_->packet_router(), std::move(configuration),
       module_process_thread_.get(), call_stats_.get(), clock_);
 
   const webrtc::VideoReceiveStream::Config& config = receive_stream->config();
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
     if (config.rtp.rtx_ssrc) {
       // We record identical config for the rtx stream as for the main
       // stream. Since the transport_send_cc negotiation is per payload
@@ -877,7 +946,7 @@ void Call::DestroyVideoReceiveStream(
       static_cast<VideoReceiveStream*>(receive_stream);
   const VideoReceiveStream::Config& config = receive_stream_impl->config();
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
     // Remove all ssrcs pointing to a receive stream. As RTX retransmits on a
     // separate SSRC there can be either one or two.
     receive_rtp_config_.erase(config.rtp.remote_ssrc);
@@ -904,7 +973,7 @@ FlexfecReceiveStream* Call::CreateFlexfecReceiveStream(
 
   FlexfecReceiveStreamImpl* receive_stream;
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
     // Unlike the video and audio receive streams,
     // FlexfecReceiveStream implements RtpPacketSinkInterface itself,
     // and hence its constructor passes its |this| pointer to
@@ -934,7 +1003,7 @@ void Call::DestroyFlexfecReceiveStream(FlexfecReceiveStream* receive_stream) {
 
   RTC_DCHECK(receive_stream != nullptr);
   {
-    WriteLockScoped write_lock(*receive_crit_);
+    ReadMostlyWriteLockScoped write_lock(receive_crit_);
 
     const FlexfecReceiveStream::Config& config = receive_stream->GetConfig();
     uint32_t ssrc = config.remote_ssrc;
@@ -970,6 +1039,13 @@ Call::Stats Call::GetStats() const {
   stats.pacer_delay_ms =
       aggregate_network_up_ ? transport_send_ptr_->GetPacerQueuingDelayMs() : 0;
 
+  PacerTimingStats pacer_timing = transport_send_ptr_->GetPacerTimingStats();
+  if (pacer_timing.enabled) {
+    stats.pacer_queue_time_p50_ms = pacer_timing.queue_time_p50_ms;
+    stats.pacer_queue_time_p95_ms = pacer_timing.queue_time_p95_ms;
+    stats.pacer_send_burst_p95_packets = pacer_timing.send_burst_p95_packets;
+  }
+
   stats.rtt_ms = call_stats_->LastProcessedRtt();
 
   // Fetch available send/receive bitrates.
@@ -1009,7 +1085,7 @@ void Call::SignalChannelNetworkState(MediaType media, NetworkState state) {
 
   UpdateAggregateNetworkState();
   {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     for (VideoReceiveStream* video_receive_stream : video_receive_streams_) {
       video_receive_stream->SignalNetworkState(video_network_state_);
     }
@@ -1017,7 +1093,7 @@ void Call::SignalChannelNetworkState(MediaType media, NetworkState state) {
 }
 
 void Call::OnAudioTransportOverheadChanged(int transport_overhead_per_packet) {
-  ReadLockScoped read_lock(*send_crit_);
+  ReadMostlyReadLockScoped read_lock(send_crit_);
   for (auto& kv : audio_send_ssrcs_) {
     kv.second->SetTransportOverhead(transport_overhead_per_packet);
   }
@@ -1029,14 +1105,14 @@ void Call::UpdateAggregateNetworkState() {
   bool have_audio = false;
   bool have_video = false;
   {
-    ReadLockScoped read_lock(*send_crit_);
+    ReadMostlyReadLockScoped read_lock(send_crit_);
     if (!audio_send_ssrcs_.empty())
       have_audio = true;
     if (!video_send_ssrcs_.empty())
       have_video = true;
   }
   {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     if (!audio_receive_streams_.empty())
       have_audio = true;
     if (!video_receive_streams_.empty())
@@ -1097,7 +1173,7 @@ void Call::OnTargetTransferRate(TargetTransferRate msg) {
 
   bool sending_video;
   {
-    ReadLockScoped read_lock(*send_crit_);
+    ReadMostlyReadLockScoped read_lock(send_crit_);
     sending_video = !video_send_streams_.empty();
   }
 
@@ -1194,28 +1270,28 @@ PacketReceiver::DeliveryStatus Call::DeliverRtcp(MediaType media_type,
   }
   bool rtcp_delivered = false;
   if (media_type == MediaType::ANY || media_type == MediaType::VIDEO) {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     for (VideoReceiveStream* stream : video_receive_streams_) {
       if (stream->DeliverRtcp(packet, length))
         rtcp_delivered = true;
     }
   }
   if (media_type == MediaType::ANY || media_type == MediaType::AUDIO) {
-    ReadLockScoped read_lock(*receive_crit_);
+    ReadMostlyReadLockScoped read_lock(receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
       stream->DeliverRtcp(packet, length);
       rtcp_delivered = true;
     }
   }
   if (media_type == MediaType::ANY || media_type == MediaType::VIDEO) {
-    ReadLockScoped read_lock(*send_crit_);
+    ReadMostlyReadLockScoped read_lock(send_crit_);
     for (VideoSendStream* stream : video_send_streams_) {
       stream->DeliverRtcp(packet, length);
       rtcp_delivered = true;
     }
   }
   if (media_type == MediaType::ANY || media_type == MediaType::AUDIO) {
-    ReadLockScoped read_lock(*send_crit_);
+    ReadMostlyReadLockScoped read_lock(send_crit_);
     for (auto& kv : audio_send_ssrcs_) {
       kv.second->DeliverRtcp(packet, length);
       rtcp_delivered = true;
@@ -1239,6 +1315,16 @@ PacketReceiver::DeliveryStatus Call::DeliverRtp(MediaType media_type,
   if (!parsed_packet.Parse(std::move(packet)))
     return DELIVERY_PACKET_ERROR;
 
+  SetRtpArrivalTime(&parsed_packet, packet_time_us,
+                    clock_->TimeInMilliseconds());
+
+  ReadMostlyReadLockScoped read_lock(receive_crit_);
+  return DeliverParsedRtp(media_type, std::move(parsed_packet));
+}
+
+void Call::SetRtpArrivalTime(RtpPacketReceived* packet,
+                             int64_t packet_time_us,
+                             int64_t fallback_arrival_time_ms) {
   if (packet_time_us != -1) {
     if (receive_time_calculator_) {
       // Repair packet_time_us for clock resets by comparing a new read of
@@ -1246,11 +1332,15 @@ PacketReceiver::DeliveryStatus Call::DeliverRtp(MediaType media_type,
       packet_time_us = receive_time_calculator_->ReconcileReceiveTimes(
           packet_time_us, rtc::TimeUTCMicros(), clock_->TimeInMicroseconds());
     }
-    parsed_packet.set_arrival_time_ms((packet_time_us + 500) / 1000);
+    packet->set_arrival_time_ms((packet_time_us + 500) / 1000);
   } else {
-    parsed_packet.set_arrival_time_ms(clock_->TimeInMilliseconds());
+    packet->set_arrival_time_ms(fallback_arrival_time_ms);
   }
+}
 
+PacketReceiver::DeliveryStatus Call::DeliverParsedRtp(
+    MediaType media_type,
+    RtpPacketReceived parsed_packet) {
   // We might get RTP keep-alive packets in accordance with RFC6263 section 4.6.
   // These are empty (zero length payload) RTP packets with an unsignaled
   // payload type.
@@ -1259,7 +1349,6 @@ PacketReceiver::DeliveryStatus Call::DeliverRtp(MediaType media_type,
   RTC_DCHECK(media_type == MediaType::AUDIO || media_type == MediaType::VIDEO ||
              is_keep_alive_packet);
 
-  ReadLockScoped read_lock(*receive_crit_);
   auto it = receive_rtp_config_.find(parsed_packet.Ssrc());
   if (it == receive_rtp_config_.end()) {
     RTC_LOG(LS_ERROR) << "receive_rtp_config_ lookup failed for ssrc "
@@ -1322,6 +1411,42 @@ PacketReceiver::DeliveryStatus Call::DeliverPacket(
   return DeliverRtp(media_type, std::move(packet), packet_time_us);
 }
 
+void Call::DeliverPacketBatch(
+    rtc::ArrayView<PacketReceiver::ReceivedPacket> packets) {
+  RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
+  TRACE_EVENT1("webrtc", "Call::DeliverPacketBatch", "num_packets",
+               packets.size());
+
+  // One clock read serves as arrival time for every packet of the burst that
+  // doesn't carry its own capture time.
+  const int64_t fallback_arrival_time_ms = clock_->TimeInMilliseconds();
+
+  // The receive config lock is acquired once per run of consecutive RTP
+  // packets instead of once per packet. It is released before RTCP handling,
+  // which takes its own locks.
+  absl::optional<ReadMostlyReadLockScoped> read_lock;
+  for (PacketReceiver::ReceivedPacket& received : packets) {
+    if (IsRtcp(received.packet.cdata(), received.packet.size())) {
+      read_lock.reset();
+      received.status = DeliverRtcp(received.media_type,
+                                    received.packet.cdata(),
+                                    received.packet.size());
+      continue;
+    }
+    RtpPacketReceived parsed_packet;
+    if (!parsed_packet.Parse(std::move(received.packet))) {
+      received.status = DELIVERY_PACKET_ERROR;
+      continue;
+    }
+    SetRtpArrivalTime(&parsed_packet, received.packet_time_us,
+                      fallback_arrival_time_ms);
+    if (!read_lock)
+      read_lock.emplace(receive_crit_);
+    received.status =
+        DeliverParsedRtp(received.media_type, std::move(parsed_packet));
+  }
+}
+
 void Call::OnRecoveredPacket(const uint8_t* packet, size_t length) {
   RtpPacketReceived parsed_packet;
   if (!parsed_packet.Parse(packet, length))
@@ -1329,7 +1454,7 @@ void Call::OnRecoveredPacket(const uint8_t* packet, size_t length) {
 
   parsed_packet.set_recovered(true);
 
-  ReadLockScoped read_lock(*receive_crit_);
+  ReadMostlyReadLockScoped read_lock(receive_crit_);
   auto it = receive_rtp_config_.find(parsed_packet.Ssrc());
   if (it == receive_rtp_config_.end()) {
     RTC_LOG(LS_ERROR) << "receive_rtp_config_ lookup failed for ssrc "
@@ -1358,7 +1483,8 @@ void Call::NotifyBweOfReceivedPacket(const RtpPacketReceived& packet,
   RTPHeader header;
   packet.GetHeader(&header);
 
-  ReceivedPacket packet_msg;
+  // Qualified since Call also sees PacketReceiver::ReceivedPacket.
+  webrtc::ReceivedPacket packet_msg;
   packet_msg.size = DataSize::bytes(packet.payload_size());
   packet_msg.receive_time = Timestamp::ms(packet.arrival_time_ms());
   if (header.extension.hasAbsoluteSendTime) {
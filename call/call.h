@@ -46,6 +46,12 @@ class Call {
     int recv_bandwidth_bps = 0;       // Estimated available receive bandwidth.
     int64_t pacer_delay_ms = 0;
     int64_t rtt_ms = -1;
+    // Percentiles of pacer queue time and send burst sizes, from the opt-in
+    // pacer timing instrumentation (WebRTC-Pacer-TimingStats field trial).
+    // -1 when the instrumentation is disabled or has no samples yet.
+    int64_t pacer_queue_time_p50_ms = -1;
+    int64_t pacer_queue_time_p95_ms = -1;
+    int64_t pacer_send_burst_p95_packets = -1;
   };
 
   static Call* Create(const Call::Config& config);
@@ -22,6 +22,7 @@ namespace webrtc {
 
 class AudioProcessing;
 class RtcEventLog;
+class SharedCallResources;
 
 struct CallConfig {
   explicit CallConfig(RtcEventLog* event_log);
@@ -56,6 +57,12 @@ struct CallConfig {
 
   // Network controller factory to use for this call.
   NetworkControllerFactoryInterface* network_controller_factory = nullptr;
+
+  // Worker infrastructure possibly shared between multiple calls. When set,
+  // the call's task queues and process threads multiplex onto the bounded
+  // worker pools owned by this object (which then also supplies the task
+  // queue factory) instead of per-call threads. Must outlive the call.
+  SharedCallResources* shared_call_resources = nullptr;
 };
 
 }  // namespace webrtc
@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/memory/memory.h"
 #include "api/audio_codecs/builtin_audio_decoder_factory.h"
@@ -295,4 +296,28 @@ TEST(CallTest, RecreatingAudioStreamWithSameSsrcReusesRtpState) {
   EXPECT_EQ(rtp_state1.media_has_been_sent, rtp_state2.media_has_been_sent);
 }
 
+TEST(CallTest, DeliverPacketBatchReportsPerPacketStatus) {
+  CallHelper call;
+  // A well-formed RTP keep-alive packet for an SSRC no stream listens to,
+  // followed by a packet that doesn't parse as RTP at all.
+  constexpr uint8_t kUnknownSsrcRtpPacket[] = {0x80, 96, 0, 1, 0, 0,
+                                               0,    2,  0, 0, 0, 3};
+  constexpr uint8_t kGarbagePacket[] = {0x00, 0x01, 0x02, 0x03};
+  std::vector<PacketReceiver::ReceivedPacket> batch;
+  batch.emplace_back(
+      MediaType::AUDIO,
+      rtc::CopyOnWriteBuffer(kUnknownSsrcRtpPacket,
+                             sizeof(kUnknownSsrcRtpPacket)),
+      /*packet_time_us=*/-1);
+  batch.emplace_back(MediaType::AUDIO,
+                     rtc::CopyOnWriteBuffer(kGarbagePacket,
+                                            sizeof(kGarbagePacket)),
+                     /*packet_time_us=*/-1);
+
+  call->Receiver()->DeliverPacketBatch(batch);
+
+  EXPECT_EQ(PacketReceiver::DELIVERY_UNKNOWN_SSRC, batch[0].status);
+  EXPECT_EQ(PacketReceiver::DELIVERY_PACKET_ERROR, batch[1].status);
+}
+
 }  // namespace webrtc
@@ -185,6 +185,42 @@ PacketReceiver::DeliveryStatus FakeNetworkPipe::DeliverPacket(
              : PacketReceiver::DELIVERY_PACKET_ERROR;
 }
 
+void FakeNetworkPipe::DeliverPacketBatch(
+    rtc::ArrayView<PacketReceiver::ReceivedPacket> packets) {
+  rtc::CritScope crit(&process_lock_);
+  int64_t time_now_us = clock_->TimeInMicroseconds();
+
+  std::vector<PacketInFlightInfo> packet_infos;
+  packet_infos.reserve(packets.size());
+  std::vector<StoredPacket*> stored_packets;
+  stored_packets.reserve(packets.size());
+  for (PacketReceiver::ReceivedPacket& received : packets) {
+    size_t packet_size = received.packet.size();
+    packets_in_flight_.emplace_back(StoredPacket(NetworkPacket(
+        std::move(received.packet), time_now_us, time_now_us, absl::nullopt,
+        false, received.media_type, received.packet_time_us, nullptr)));
+    stored_packets.push_back(&packets_in_flight_.back());
+    packet_infos.emplace_back(
+        packet_size, time_now_us,
+        reinterpret_cast<uint64_t>(stored_packets.back()));
+  }
+
+  std::vector<bool> sent = network_behavior_->EnqueuePacketBatch(packet_infos);
+  RTC_DCHECK_EQ(sent.size(), packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    if (sent[i]) {
+      packets[i].status = PacketReceiver::DELIVERY_OK;
+    } else {
+      // Unlike in the single packet path the dropped packet is not
+      // necessarily at the back of |packets_in_flight_|; mark it as removed
+      // and let the regular cleanup in Process() reclaim it.
+      stored_packets[i]->removed = true;
+      ++dropped_packets_;
+      packets[i].status = PacketReceiver::DELIVERY_PACKET_ERROR;
+    }
+  }
+}
+
 void FakeNetworkPipe::SetClockOffset(int64_t offset_ms) {
   rtc::CritScope crit(&config_lock_);
   clock_offset_ms_ = offset_ms;
@@ -280,21 +316,17 @@ void FakeNetworkPipe::Process() {
     std::vector<PacketDeliveryInfo> delivery_infos =
         network_behavior_->DequeueDeliverablePackets(time_now_us);
     for (auto& delivery_info : delivery_infos) {
-      // In the common case where no reordering happens, find will return early
-      // as the first packet will be a match.
-      auto packet_it =
-          std::find_if(packets_in_flight_.begin(), packets_in_flight_.end(),
-                       [&delivery_info](StoredPacket& packet_ref) {
-                         return reinterpret_cast<uint64_t>(&packet_ref) ==
-                                delivery_info.packet_id;
-                       });
-      // Check that the packet is in the deque of packets in flight.
-      RTC_CHECK(packet_it != packets_in_flight_.end());
+      // The packet id is the address of the StoredPacket, see EnqueuePacket.
+      // References into |packets_in_flight_| stay valid until the entry is
+      // popped, and entries are only popped after they have been marked as
+      // removed, so the packet can be looked up without scanning the deque.
+      StoredPacket* stored_packet =
+          reinterpret_cast<StoredPacket*>(delivery_info.packet_id);
       // Check that the packet is not already removed.
-      RTC_DCHECK(!packet_it->removed);
+      RTC_DCHECK(!stored_packet->removed);
 
-      NetworkPacket packet = std::move(packet_it->packet);
-      packet_it->removed = true;
+      NetworkPacket packet = std::move(stored_packet->packet);
+      stored_packet->removed = true;
 
       // Cleanup of removed packets at the beginning of the deque.
       while (!packets_in_flight_.empty() &&
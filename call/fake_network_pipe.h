@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/call/transport.h"
 #include "api/test/simulated_network.h"
 #include "call/call.h"
@@ -147,6 +148,11 @@ class FakeNetworkPipe : public SimulatedPacketReceiverInterface {
                                                rtc::CopyOnWriteBuffer packet,
                                                int64_t packet_time_us) override;
 
+  // Enqueues a whole burst of packets with a single lock acquisition and
+  // clock read, and hands the burst to the network behavior in one call.
+  void DeliverPacketBatch(
+      rtc::ArrayView<PacketReceiver::ReceivedPacket> packets) override;
+
   // TODO(bugs.webrtc.org/9584): Needed to inherit the alternative signature for
   // this method.
   using PacketReceiver::DeliverPacket;
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/memory/memory.h"
 #include "call/simulated_network.h"
@@ -425,4 +426,39 @@ TEST_F(FakeNetworkPipeTest, SetReceiver) {
   pipe->Process();
 }
 
+// Test that a batch of packets enqueued in one call is delivered like
+// individually enqueued packets, and that drops are reported per packet.
+TEST_F(FakeNetworkPipeTest, DeliverPacketBatch) {
+  BuiltInNetworkBehaviorConfig config;
+  config.queue_length_packets = 10;
+  config.link_capacity_kbps = 80;
+  MockReceiver receiver;
+  auto simulated_network = absl::make_unique<SimulatedNetwork>(config);
+  std::unique_ptr<FakeNetworkPipe> pipe(new FakeNetworkPipe(
+      &fake_clock_, std::move(simulated_network), &receiver));
+
+  // 15 packets in one batch, but the queue only holds 10.
+  const int kNumPackets = 15;
+  const int kPacketSize = 1000;
+  std::vector<PacketReceiver::ReceivedPacket> batch;
+  for (int i = 0; i < kNumPackets; ++i) {
+    batch.emplace_back(MediaType::ANY,
+                       rtc::CopyOnWriteBuffer(kPacketSize),
+                       /* packet_time_us */ -1);
+  }
+  pipe->DeliverPacketBatch(batch);
+  for (int i = 0; i < kNumPackets; ++i) {
+    EXPECT_EQ(batch[i].status, i < 10 ? PacketReceiver::DELIVERY_OK
+                                      : PacketReceiver::DELIVERY_PACKET_ERROR);
+  }
+
+  // Advance enough time to drain the whole queue and verify that only the
+  // enqueued packets are delivered.
+  const int kPacketTimeMs =
+      PacketTimeMs(config.link_capacity_kbps, kPacketSize);
+  fake_clock_.AdvanceTimeMilliseconds(10 * kPacketTimeMs);
+  EXPECT_CALL(receiver, DeliverPacket(_, _, _)).Times(10);
+  pipe->Process();
+}
+
 }  // namespace webrtc
@@ -13,8 +13,10 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/media_types.h"
 #include "rtc_base/copy_on_write_buffer.h"
 
@@ -28,10 +30,39 @@ class PacketReceiver {
     DELIVERY_PACKET_ERROR,
   };
 
+  // One packet of a batch handed to DeliverPacketBatch(). The receiver
+  // writes the delivery result of the packet back into |status|.
+  struct ReceivedPacket {
+    ReceivedPacket(MediaType media_type,
+                   rtc::CopyOnWriteBuffer packet,
+                   int64_t packet_time_us)
+        : media_type(media_type),
+          packet(std::move(packet)),
+          packet_time_us(packet_time_us) {}
+
+    MediaType media_type;
+    rtc::CopyOnWriteBuffer packet;
+    int64_t packet_time_us;
+    DeliveryStatus status = DELIVERY_PACKET_ERROR;
+  };
+
   virtual DeliveryStatus DeliverPacket(MediaType media_type,
                                        rtc::CopyOnWriteBuffer packet,
                                        int64_t packet_time_us) = 0;
 
+  // Delivers a burst of packets in one call, letting the receiver pay
+  // per-delivery overhead such as clock reads and lock acquisitions once per
+  // batch instead of once per packet. Packets are delivered in order and the
+  // per-packet status is written back into |packets|. The default
+  // implementation just forwards to DeliverPacket().
+  virtual void DeliverPacketBatch(rtc::ArrayView<ReceivedPacket> packets) {
+    for (ReceivedPacket& received : packets) {
+      received.status = DeliverPacket(received.media_type,
+                                      std::move(received.packet),
+                                      received.packet_time_us);
+    }
+  }
+
  protected:
   virtual ~PacketReceiver() {}
 };
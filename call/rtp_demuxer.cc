@@ -91,6 +91,7 @@ bool RtpDemuxer::AddSink(const RtpDemuxerCriteria& criteria,
   }
 
   RefreshKnownMids();
+  last_sink_ = nullptr;
 
   return true;
 }
@@ -168,6 +169,7 @@ bool RtpDemuxer::RemoveSink(const RtpPacketSinkInterface* sink) {
                        RemoveFromMapByValue(&sink_by_mid_and_rsid_, sink) +
                        RemoveFromMapByValue(&sink_by_rsid_, sink);
   RefreshKnownMids();
+  last_sink_ = nullptr;
   return num_removed > 0;
 }
 
@@ -182,9 +184,6 @@ bool RtpDemuxer::OnRtpPacket(const RtpPacketReceived& packet) {
 
 RtpPacketSinkInterface* RtpDemuxer::ResolveSink(
     const RtpPacketReceived& packet) {
-  // See the BUNDLE spec for high level reference to this algorithm:
-  // https://tools.ietf.org/html/draft-ietf-mmusic-sdp-bundle-negotiation-38#section-10.2
-
   // RSID and RRID are routed to the same sinks. If an RSID is specified on a
   // repair packet, it should be ignored and the RRID should be used.
   std::string packet_mid, packet_rsid;
@@ -195,6 +194,40 @@ RtpPacketSinkInterface* RtpDemuxer::ResolveSink(
   }
   uint32_t ssrc = packet.Ssrc();
 
+  // If the packet matches the previous one on every attribute the resolution
+  // chain keys on, and no sinks have come or gone since, the decision is the
+  // same; the full resolution below would also not learn anything new since
+  // any MID/RSID latchings for this exact packet were recorded last time.
+  if (last_sink_ != nullptr && ssrc == last_ssrc_ &&
+      has_mid == last_has_mid_ && has_rsid == last_has_rsid_ &&
+      (!has_mid || packet_mid == last_mid_) &&
+      (!has_rsid || packet_rsid == last_rsid_)) {
+    return last_sink_;
+  }
+
+  RtpPacketSinkInterface* sink =
+      ResolveSinkUncached(packet, has_mid, has_rsid, packet_mid, packet_rsid);
+  if (sink != nullptr) {
+    last_ssrc_ = ssrc;
+    last_has_mid_ = has_mid;
+    last_has_rsid_ = has_rsid;
+    last_mid_ = packet_mid;
+    last_rsid_ = packet_rsid;
+  }
+  last_sink_ = sink;
+  return sink;
+}
+
+RtpPacketSinkInterface* RtpDemuxer::ResolveSinkUncached(
+    const RtpPacketReceived& packet,
+    bool has_mid,
+    bool has_rsid,
+    std::string& packet_mid,
+    std::string& packet_rsid) {
+  // See the BUNDLE spec for high level reference to this algorithm:
+  // https://tools.ietf.org/html/draft-ietf-mmusic-sdp-bundle-negotiation-38#section-10.2
+  uint32_t ssrc = packet.Ssrc();
+
   // The BUNDLE spec says to drop any packets with unknown MIDs, even if the
   // SSRC is known/latched.
   if (has_mid && known_mids_.find(packet_mid) == known_mids_.end()) {
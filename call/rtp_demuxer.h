@@ -14,6 +14,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -143,7 +144,10 @@ class RtpDemuxer {
 
   // Configure whether to look at the MID header extension when demuxing
   // incoming RTP packets. By default this is enabled.
-  void set_use_mid(bool use_mid) { use_mid_ = use_mid; }
+  void set_use_mid(bool use_mid) {
+    use_mid_ = use_mid;
+    last_sink_ = nullptr;
+  }
 
  private:
   // Returns true if adding a sink with the given criteria would cause conflicts
@@ -156,6 +160,14 @@ class RtpDemuxer {
   // If the packet should be dropped, this method returns null.
   RtpPacketSinkInterface* ResolveSink(const RtpPacketReceived& packet);
 
+  // The full resolution chain, used by ResolveSink() when the one-entry cache
+  // does not match the packet.
+  RtpPacketSinkInterface* ResolveSinkUncached(const RtpPacketReceived& packet,
+                                              bool has_mid,
+                                              bool has_rsid,
+                                              std::string& packet_mid,
+                                              std::string& packet_rsid);
+
   // Used by the ResolveSink algorithm.
   RtpPacketSinkInterface* ResolveSinkByMid(const std::string& mid,
                                            uint32_t ssrc);
@@ -179,7 +191,7 @@ class RtpDemuxer {
   // SSRC mapping which receives all MID, payload type, or RSID to SSRC bindings
   // discovered when demuxing packets).
   std::map<std::string, RtpPacketSinkInterface*> sink_by_mid_;
-  std::map<uint32_t, RtpPacketSinkInterface*> sink_by_ssrc_;
+  std::unordered_map<uint32_t, RtpPacketSinkInterface*> sink_by_ssrc_;
   std::multimap<uint8_t, RtpPacketSinkInterface*> sinks_by_pt_;
   std::map<std::pair<std::string, std::string>, RtpPacketSinkInterface*>
       sink_by_mid_and_rsid_;
@@ -194,8 +206,21 @@ class RtpDemuxer {
   // received.
   // This is stored separately from the sink mappings because if a sink is
   // removed we want to still remember these associations.
-  std::map<uint32_t, std::string> mid_by_ssrc_;
-  std::map<uint32_t, std::string> rsid_by_ssrc_;
+  std::unordered_map<uint32_t, std::string> mid_by_ssrc_;
+  std::unordered_map<uint32_t, std::string> rsid_by_ssrc_;
+
+  // One-entry cache of the last successful demux decision. Media packets
+  // mostly arrive in runs from the same SSRC carrying the same MID/RSID
+  // extensions (if any), so in the steady state the decision is a few
+  // comparisons rather than a walk through the resolution chain. |last_sink_|
+  // is null when the cache is empty; it is dropped whenever sinks are added
+  // or removed since that can change how the next packet should be routed.
+  uint32_t last_ssrc_ = 0;
+  bool last_has_mid_ = false;
+  bool last_has_rsid_ = false;
+  std::string last_mid_;
+  std::string last_rsid_;
+  RtpPacketSinkInterface* last_sink_ = nullptr;
 
   // Adds a binding from the SSRC to the given sink. Returns true if there was
   // not already a sink bound to the SSRC or if the sink replaced a different
@@ -10,7 +10,11 @@
 
 #include "call/rtp_stream_receiver_controller.h"
 
+#include <algorithm>
+
 #include "absl/memory/memory.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -35,10 +39,28 @@ RtpStreamReceiverController::Receiver::~Receiver() {
   controller_->RemoveSink(sink_);
 }
 
-RtpStreamReceiverController::RtpStreamReceiverController() {
+RtpStreamReceiverController::Shard::Shard() {
   // At this level the demuxer is only configured to demux by SSRC, so don't
   // worry about MIDs (MIDs are handled by upper layers).
-  demuxer_.set_use_mid(false);
+  demuxer.set_use_mid(false);
+}
+
+RtpStreamReceiverController::RtpStreamReceiverController()
+    : RtpStreamReceiverController(nullptr, 0) {}
+
+RtpStreamReceiverController::RtpStreamReceiverController(
+    TaskQueueFactory* task_queue_factory,
+    size_t num_delivery_shards) {
+  RTC_DCHECK(num_delivery_shards == 0 || task_queue_factory);
+  const size_t num_shards = std::max<size_t>(num_delivery_shards, 1);
+  for (size_t i = 0; i < num_shards; ++i) {
+    shards_.push_back(absl::make_unique<Shard>());
+  }
+  for (size_t i = 0; i < num_delivery_shards; ++i) {
+    delivery_queues_.push_back(
+        absl::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
+            "RtpDelivery", TaskQueueFactory::Priority::HIGH)));
+  }
 }
 
 RtpStreamReceiverController::~RtpStreamReceiverController() = default;
@@ -49,21 +71,52 @@ RtpStreamReceiverController::CreateReceiver(uint32_t ssrc,
   return absl::make_unique<Receiver>(this, ssrc, sink);
 }
 
+RtpStreamReceiverController::Shard& RtpStreamReceiverController::ShardForSsrc(
+    uint32_t ssrc) {
+  return *shards_[ssrc % shards_.size()];
+}
+
 bool RtpStreamReceiverController::OnRtpPacket(const RtpPacketReceived& packet) {
-  rtc::CritScope cs(&lock_);
-  return demuxer_.OnRtpPacket(packet);
+  Shard& shard = ShardForSsrc(packet.Ssrc());
+  if (delivery_queues_.empty()) {
+    rtc::CritScope cs(&shard.lock);
+    return shard.demuxer.OnRtpPacket(packet);
+  }
+  // Sharded mode: demux and deliver on the shard's queue. The payload of
+  // |packet| is reference counted, so the copy into the task is cheap.
+  // TODO(srte): This struct should be replaced by a lambda with move capture
+  // when C++14 lambdas are allowed.
+  struct DeliveryTask {
+    void operator()() {
+      rtc::CritScope cs(&shard->lock);
+      shard->demuxer.OnRtpPacket(packet);
+    }
+    Shard* shard;
+    RtpPacketReceived packet;
+  };
+  delivery_queues_[packet.Ssrc() % delivery_queues_.size()]->PostTask(
+      DeliveryTask{&shard, packet});
+  return true;
 }
 
 bool RtpStreamReceiverController::AddSink(uint32_t ssrc,
                                           RtpPacketSinkInterface* sink) {
-  rtc::CritScope cs(&lock_);
-  return demuxer_.AddSink(ssrc, sink);
+  Shard& shard = ShardForSsrc(ssrc);
+  rtc::CritScope cs(&shard.lock);
+  return shard.demuxer.AddSink(ssrc, sink);
 }
 
 size_t RtpStreamReceiverController::RemoveSink(
     const RtpPacketSinkInterface* sink) {
-  rtc::CritScope cs(&lock_);
-  return demuxer_.RemoveSink(sink);
+  // The sink's SSRC is not known here, so remove from every shard. Taking
+  // each shard's lock also ensures that no delivery to |sink| is in progress
+  // when this returns.
+  size_t num_removed = 0;
+  for (auto& shard : shards_) {
+    rtc::CritScope cs(&shard->lock);
+    num_removed += shard->demuxer.RemoveSink(sink);
+  }
+  return num_removed;
 }
 
 }  // namespace webrtc
@@ -11,10 +11,13 @@
 #define CALL_RTP_STREAM_RECEIVER_CONTROLLER_H_
 
 #include <memory>
+#include <vector>
 
+#include "api/task_queue/task_queue_factory.h"
 #include "call/rtp_demuxer.h"
 #include "call/rtp_stream_receiver_controller_interface.h"
 #include "rtc_base/critical_section.h"
+#include "rtc_base/task_queue.h"
 
 namespace webrtc {
 
@@ -29,7 +32,20 @@ class RtpPacketReceived;
 class RtpStreamReceiverController
     : public RtpStreamReceiverControllerInterface {
  public:
+  // Creates a controller that demuxes and delivers packets synchronously in
+  // the thread calling OnRtpPacket().
   RtpStreamReceiverController();
+
+  // Creates a controller with |num_delivery_shards| > 0 demuxer shards, each
+  // served by its own delivery task queue. SSRCs are partitioned over the
+  // shards and OnRtpPacket() posts the packet to the queue of its SSRC's
+  // shard instead of delivering in the calling thread, so sinks in different
+  // shards demux and deliver in parallel while the queue FIFO preserves
+  // per-SSRC packet order. With |num_delivery_shards| == 0 this is equivalent
+  // to the default constructor.
+  RtpStreamReceiverController(TaskQueueFactory* task_queue_factory,
+                              size_t num_delivery_shards);
+
   ~RtpStreamReceiverController() override;
 
   // Implements RtpStreamReceiverControllerInterface.
@@ -37,11 +53,16 @@ class RtpStreamReceiverController
       uint32_t ssrc,
       RtpPacketSinkInterface* sink) override;
 
-  // Thread-safe wrappers for the corresponding RtpDemuxer methods.
+  // Thread-safe wrappers for the corresponding RtpDemuxer methods. Since
+  // delivery runs under the lock of the sink's shard, a sink receives no
+  // further packets once RemoveSink() has returned, also in the sharded mode.
   bool AddSink(uint32_t ssrc, RtpPacketSinkInterface* sink) override;
   size_t RemoveSink(const RtpPacketSinkInterface* sink) override;
 
   // TODO(nisse): Not yet responsible for parsing.
+  // In the sharded mode a return value of true only means that delivery was
+  // scheduled; packets whose sink is removed before the task has run are
+  // dropped by the demuxer.
   bool OnRtpPacket(const RtpPacketReceived& packet);
 
  private:
@@ -58,13 +79,26 @@ class RtpStreamReceiverController
     RtpPacketSinkInterface* const sink_;
   };
 
+  struct Shard {
+    Shard();
+    rtc::CriticalSection lock;
+    RtpDemuxer demuxer RTC_GUARDED_BY(&lock);
+  };
+
+  Shard& ShardForSsrc(uint32_t ssrc);
+
   // TODO(nisse): Move to a TaskQueue for synchronization. When used
   // by Call, we expect construction and all methods but OnRtpPacket
   // to be called on the same thread, and OnRtpPacket to be called
   // by a single, but possibly distinct, thread. But applications not
   // using Call may have use threads differently.
-  rtc::CriticalSection lock_;
-  RtpDemuxer demuxer_ RTC_GUARDED_BY(&lock_);
+  // Holds a single shard in the synchronous mode.
+  std::vector<std::unique_ptr<Shard>> shards_;
+
+  // One delivery queue per shard; empty in the synchronous mode. Declared
+  // after |shards_| so that pending delivery tasks drain before the demuxers
+  // go away.
+  std::vector<std::unique_ptr<rtc::TaskQueue>> delivery_queues_;
 };
 
 }  // namespace webrtc
@@ -0,0 +1,118 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "call/rtp_stream_receiver_controller.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "call/test/mock_rtp_packet_sink_interface.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/event.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+
+constexpr int kEventTimeoutMs = 5000;
+
+RtpPacketReceived CreatePacketWithSsrcAndSeqNum(uint32_t ssrc,
+                                                uint16_t seq_num) {
+  RtpPacketReceived packet;
+  packet.SetSsrc(ssrc);
+  packet.SetSequenceNumber(seq_num);
+  return packet;
+}
+
+}  // namespace
+
+TEST(RtpStreamReceiverController, SynchronousModeDeliversInCallingThread) {
+  RtpStreamReceiverController controller;
+  MockRtpPacketSink sink;
+  auto receiver = controller.CreateReceiver(/*ssrc=*/1, &sink);
+
+  EXPECT_CALL(sink, OnRtpPacket(_)).Times(1);
+  EXPECT_TRUE(controller.OnRtpPacket(CreatePacketWithSsrcAndSeqNum(1, 0)));
+}
+
+TEST(RtpStreamReceiverController, SynchronousModeReportsUnknownSsrc) {
+  RtpStreamReceiverController controller;
+  MockRtpPacketSink sink;
+  auto receiver = controller.CreateReceiver(/*ssrc=*/1, &sink);
+
+  EXPECT_FALSE(controller.OnRtpPacket(CreatePacketWithSsrcAndSeqNum(2, 0)));
+}
+
+TEST(RtpStreamReceiverController, ShardedModeDeliversAllPackets) {
+  auto task_queue_factory = CreateDefaultTaskQueueFactory();
+  RtpStreamReceiverController controller(task_queue_factory.get(),
+                                         /*num_delivery_shards=*/4);
+
+  // More SSRCs than shards, so several sinks share a delivery queue.
+  constexpr int kNumSsrcs = 16;
+  constexpr int kPacketsPerSsrc = 10;
+  std::vector<std::unique_ptr<MockRtpPacketSink>> sinks;
+  std::vector<std::unique_ptr<RtpStreamReceiverInterface>> receivers;
+  rtc::Event all_delivered;
+  std::atomic<int> num_delivered(0);
+  for (int ssrc = 0; ssrc < kNumSsrcs; ++ssrc) {
+    sinks.push_back(absl::make_unique<MockRtpPacketSink>());
+    // Per-SSRC order must match post order; the shard queue is FIFO.
+    InSequence s;
+    for (int seq_num = 0; seq_num < kPacketsPerSsrc; ++seq_num) {
+      EXPECT_CALL(*sinks.back(),
+                  OnRtpPacket(::testing::Property(
+                      &RtpPacketReceived::SequenceNumber, seq_num)))
+          .WillOnce(Invoke([&](const RtpPacketReceived&) {
+            if (++num_delivered == kNumSsrcs * kPacketsPerSsrc)
+              all_delivered.Set();
+          }));
+    }
+    receivers.push_back(controller.CreateReceiver(ssrc, sinks.back().get()));
+  }
+
+  for (int seq_num = 0; seq_num < kPacketsPerSsrc; ++seq_num) {
+    for (int ssrc = 0; ssrc < kNumSsrcs; ++ssrc) {
+      EXPECT_TRUE(
+          controller.OnRtpPacket(CreatePacketWithSsrcAndSeqNum(ssrc, seq_num)));
+    }
+  }
+
+  EXPECT_TRUE(all_delivered.Wait(kEventTimeoutMs));
+}
+
+TEST(RtpStreamReceiverController, ShardedModeNoDeliveryAfterReceiverRemoved) {
+  auto task_queue_factory = CreateDefaultTaskQueueFactory();
+  RtpStreamReceiverController controller(task_queue_factory.get(),
+                                         /*num_delivery_shards=*/2);
+  MockRtpPacketSink sink;
+  auto receiver = controller.CreateReceiver(/*ssrc=*/1, &sink);
+
+  // Removing the receiver blocks on the shard lock, so when it returns any
+  // in-flight delivery has finished and pending tasks find no sink.
+  EXPECT_CALL(sink, OnRtpPacket(_)).Times(::testing::AtMost(1));
+  controller.OnRtpPacket(CreatePacketWithSsrcAndSeqNum(1, 0));
+  receiver.reset();
+
+  // Any expectation on |sink| is verified when it goes out of scope; no
+  // OnRtpPacket call may arrive after this point.
+  ::testing::Mock::VerifyAndClearExpectations(&sink);
+}
+
+}  // namespace webrtc
@@ -319,6 +319,21 @@ RtcpBandwidthObserver* RtpTransportControllerSend::GetBandwidthObserver() {
 int64_t RtpTransportControllerSend::GetPacerQueuingDelayMs() const {
   return pacer()->OldestPacketWaitTime().ms();
 }
+PacerTimingStats RtpTransportControllerSend::GetPacerTimingStats() const {
+  PacingController::TimingStats snapshot = pacer_.GetTimingStats();
+  PacerTimingStats stats;
+  stats.enabled = snapshot.enabled;
+  if (snapshot.enabled && snapshot.queue_time_ms.Count() > 0) {
+    stats.queue_time_p50_ms = snapshot.queue_time_ms.Quantile(0.5);
+    stats.queue_time_p95_ms = snapshot.queue_time_ms.Quantile(0.95);
+    stats.queue_time_max_ms = snapshot.queue_time_ms.Max();
+  }
+  if (snapshot.enabled && snapshot.send_burst_packets.Count() > 0) {
+    stats.send_burst_p95_packets = snapshot.send_burst_packets.Quantile(0.95);
+    stats.send_burst_max_packets = snapshot.send_burst_packets.Max();
+  }
+  return stats;
+}
 absl::optional<Timestamp> RtpTransportControllerSend::GetFirstPacketTime()
     const {
   return pacer()->FirstSentPacketTime();
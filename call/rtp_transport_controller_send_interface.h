@@ -55,6 +55,18 @@ class SendDelayStats;
 class SendStatisticsProxy;
 class TransportFeedbackObserver;
 
+// Percentile summary of the opt-in pacer timing instrumentation (enabled via
+// the WebRTC-Pacer-TimingStats field trial). All values are -1 while the
+// instrumentation is disabled or before any packet has been paced.
+struct PacerTimingStats {
+  bool enabled = false;
+  int64_t queue_time_p50_ms = -1;
+  int64_t queue_time_p95_ms = -1;
+  int64_t queue_time_max_ms = -1;
+  int64_t send_burst_p95_packets = -1;
+  int64_t send_burst_max_packets = -1;
+};
+
 struct RtpSenderObservers {
   RtcpRttStats* rtcp_rtt_stats;
   RtcpIntraFrameObserver* intra_frame_callback;
@@ -149,6 +161,7 @@ class RtpTransportControllerSendInterface {
   virtual void OnNetworkAvailability(bool network_available) = 0;
   virtual RtcpBandwidthObserver* GetBandwidthObserver() = 0;
   virtual int64_t GetPacerQueuingDelayMs() const = 0;
+  virtual PacerTimingStats GetPacerTimingStats() const = 0;
   virtual absl::optional<Timestamp> GetFirstPacketTime() const = 0;
   virtual void EnablePeriodicAlrProbing(bool enable) = 0;
   virtual void OnSentPacket(const rtc::SentPacket& sent_packet) = 0;
@@ -15,10 +15,11 @@
 #include <string>
 #include <utility>
 
-#include "absl/algorithm/container.h"
 #include "absl/memory/memory.h"
 #include "api/array_view.h"
+#include "api/task_queue/default_task_queue_factory.h"
 #include "api/transport/field_trial_based_config.h"
+#include "api/video/encoded_image.h"
 #include "call/rtp_transport_controller_send_interface.h"
 #include "modules/pacing/packet_router.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp.h"
@@ -227,6 +228,8 @@ RtpVideoSender::RtpVideoSender(
           "WebRTC-SubtractPacketizationOverhead")),
       use_early_loss_detection_(
           !webrtc::field_trial::IsDisabled("WebRTC-UseEarlyLossDetection")),
+      use_parallel_packetization_(
+          webrtc::field_trial::IsEnabled("WebRTC-ParallelPacketization")),
       active_(false),
       module_process_thread_(nullptr),
       suspended_ssrcs_(std::move(suspended_ssrcs)),
@@ -330,6 +333,15 @@ RtpVideoSender::RtpVideoSender(
   fec_controller_->SetProtectionCallback(this);
   // Signal congestion controller this object is ready for OnPacket* callbacks.
   transport_->RegisterPacketFeedbackObserver(this);
+
+  if (use_parallel_packetization_) {
+    packetization_queue_factory_ = CreateDefaultTaskQueueFactory();
+    for (size_t i = 0; i < rtp_streams_.size(); ++i) {
+      packetization_queues_.push_back(absl::make_unique<rtc::TaskQueue>(
+          packetization_queue_factory_->CreateTaskQueue(
+              "RtpPacketizer", TaskQueueFactory::Priority::HIGH)));
+    }
+  }
 }
 
 RtpVideoSender::~RtpVideoSender() {
@@ -431,11 +443,58 @@ EncodedImageCallback::Result RtpVideoSender::OnEncodedImage(
         rtp_streams_[stream_index].rtp_rtcp->ExpectedRetransmissionTimeMs();
   }
 
-  bool send_result = rtp_streams_[stream_index].sender_video->SendVideo(
-      encoded_image._frameType, rtp_config_.payload_type, rtp_timestamp,
-      encoded_image.capture_time_ms_, encoded_image.data(),
-      encoded_image.size(), fragmentation, &rtp_video_header,
-      expected_retransmission_time_ms);
+  bool send_result = true;
+  if (use_parallel_packetization_) {
+    // Packetization of different layers touches disjoint rtp modules, so each
+    // stream runs it on its own queue and the layers of a keyframe no longer
+    // serialize on the encoder callback thread. All order-sensitive state was
+    // computed above; only the packetize-and-enqueue step is dispatched. The
+    // payload is copied since the encoder may reuse its output buffer once
+    // this callback returns.
+    // TODO(srte): This struct should be replaced by a lambda with move capture
+    // when C++14 lambdas are allowed.
+    struct PacketizeAndSendTask {
+      void operator()() {
+        if (!sender->rtp_streams_[stream_index].sender_video->SendVideo(
+                frame_type, payload_type, rtp_timestamp, capture_time_ms,
+                payload->data(), payload->size(),
+                fragmentation ? &*fragmentation : nullptr, &rtp_video_header,
+                expected_retransmission_time_ms)) {
+          RTC_LOG(LS_WARNING) << "Failed to send video frame on ssrc " << ssrc
+                              << ".";
+        }
+      }
+      RtpVideoSender* sender;
+      size_t stream_index;
+      VideoFrameType frame_type;
+      int payload_type;
+      uint32_t rtp_timestamp;
+      int64_t capture_time_ms;
+      uint32_t ssrc;
+      rtc::scoped_refptr<EncodedImageBuffer> payload;
+      absl::optional<RTPFragmentationHeader> fragmentation;
+      RTPVideoHeader rtp_video_header;
+      absl::optional<int64_t> expected_retransmission_time_ms;
+    };
+    absl::optional<RTPFragmentationHeader> fragmentation_copy;
+    if (fragmentation) {
+      fragmentation_copy.emplace();
+      fragmentation_copy->CopyFrom(*fragmentation);
+    }
+    packetization_queues_[stream_index]->PostTask(PacketizeAndSendTask{
+        this, stream_index, encoded_image._frameType, rtp_config_.payload_type,
+        rtp_timestamp, encoded_image.capture_time_ms_,
+        rtp_config_.ssrcs[stream_index],
+        EncodedImageBuffer::Create(encoded_image.data(), encoded_image.size()),
+        std::move(fragmentation_copy), rtp_video_header,
+        expected_retransmission_time_ms});
+  } else {
+    send_result = rtp_streams_[stream_index].sender_video->SendVideo(
+        encoded_image._frameType, rtp_config_.payload_type, rtp_timestamp,
+        encoded_image.capture_time_ms_, encoded_image.data(),
+        encoded_image.size(), fragmentation, &rtp_video_header,
+        expected_retransmission_time_ms);
+  }
   if (frame_count_observer_) {
     FrameCounts& counts = frame_counts_[stream_index];
     if (encoded_image._frameType == VideoFrameType::kVideoFrameKey) {
@@ -573,7 +632,7 @@ void RtpVideoSender::DeliverRtcp(const uint8_t* packet, size_t length) {
 
 void RtpVideoSender::ConfigureSsrcs() {
   // Configure regular SSRCs.
-  RTC_CHECK(ssrc_to_rtp_sender_.empty());
+  RTC_CHECK(ssrc_routes_.empty());
   for (size_t i = 0; i < rtp_config_.ssrcs.size(); ++i) {
     uint32_t ssrc = rtp_config_.ssrcs[i];
     RtpRtcp* const rtp_rtcp = rtp_streams_[i].rtp_rtcp.get();
@@ -585,8 +644,12 @@ void RtpVideoSender::ConfigureSsrcs() {
 
     RTPSender* rtp_sender = rtp_rtcp->RtpSender();
     RTC_DCHECK(rtp_sender != nullptr);
-    ssrc_to_rtp_sender_[ssrc] = rtp_sender;
+    ssrc_routes_.push_back(SsrcRoute{ssrc, i, rtp_sender});
   }
+  std::sort(ssrc_routes_.begin(), ssrc_routes_.end(),
+            [](const SsrcRoute& lhs, const SsrcRoute& rhs) {
+              return lhs.ssrc < rhs.ssrc;
+            });
 
   // Set up RTX if available.
   if (rtp_config_.rtx.ssrcs.empty())
@@ -766,10 +829,10 @@ uint32_t RtpVideoSender::GetProtectionBitrateBps() const {
 std::vector<RtpSequenceNumberMap::Info> RtpVideoSender::GetSentRtpPacketInfos(
     uint32_t ssrc,
     rtc::ArrayView<const uint16_t> sequence_numbers) const {
-  for (const auto& rtp_stream : rtp_streams_) {
-    if (ssrc == rtp_stream.rtp_rtcp->SSRC()) {
-      return rtp_stream.sender_video->GetSentRtpPacketInfos(sequence_numbers);
-    }
+  const SsrcRoute* route = FindRouteBySsrc(ssrc);
+  if (route) {
+    return rtp_streams_[route->stream_index].sender_video->GetSentRtpPacketInfos(
+        sequence_numbers);
   }
   return std::vector<RtpSequenceNumberMap::Info>();
 }
@@ -800,14 +863,24 @@ void RtpVideoSender::SetFecAllowed(bool fec_allowed) {
   fec_allowed_ = fec_allowed;
 }
 
+const RtpVideoSender::SsrcRoute* RtpVideoSender::FindRouteBySsrc(
+    uint32_t ssrc) const {
+  auto it = std::lower_bound(ssrc_routes_.begin(), ssrc_routes_.end(), ssrc,
+                             [](const SsrcRoute& route, uint32_t ssrc) {
+                               return route.ssrc < ssrc;
+                             });
+  if (it == ssrc_routes_.end() || it->ssrc != ssrc)
+    return nullptr;
+  return &*it;
+}
+
 void RtpVideoSender::OnPacketFeedbackVector(
     const std::vector<PacketFeedback>& packet_feedback_vector) {
   if (fec_controller_->UseLossVectorMask()) {
     rtc::CritScope cs(&crit_);
     for (const PacketFeedback& packet : packet_feedback_vector) {
       if (packet.send_time_ms == PacketFeedback::kNoSendTime || !packet.ssrc ||
-          absl::c_find(rtp_config_.ssrcs, *packet.ssrc) ==
-              rtp_config_.ssrcs.end()) {
+          FindRouteBySsrc(*packet.ssrc) == nullptr) {
         // If packet send time is missing, the feedback for this packet has
         // probably already been processed, so ignore it.
         // If packet does not belong to a registered media ssrc, we are also
@@ -819,63 +892,64 @@ void RtpVideoSender::OnPacketFeedbackVector(
     }
   }
 
-  // Map from SSRC to all acked packets for that RTP module.
-  std::map<uint32_t, std::vector<uint16_t>> acked_packets_per_ssrc;
+  // All acked packets, grouped by stream index. Packets not for a media SSRC
+  // are likely RTX or FEC and are ignored, since there's no RTP history to
+  // clean up anyway.
+  std::vector<std::vector<uint16_t>> acked_packets_per_stream(
+      rtp_streams_.size());
   for (const PacketFeedback& packet : packet_feedback_vector) {
     if (packet.ssrc && packet.arrival_time_ms != PacketFeedback::kNotReceived) {
-      acked_packets_per_ssrc[*packet.ssrc].push_back(
-          packet.rtp_sequence_number);
+      const SsrcRoute* route = FindRouteBySsrc(*packet.ssrc);
+      if (route) {
+        acked_packets_per_stream[route->stream_index].push_back(
+            packet.rtp_sequence_number);
+      }
     }
   }
 
   if (use_early_loss_detection_) {
-    // Map from SSRC to vector of RTP sequence numbers that are indicated as
-    // lost by feedback, without being trailed by any received packets.
-    std::map<uint32_t, std::vector<uint16_t>> early_loss_detected_per_ssrc;
+    // For each stream, the RTP sequence numbers that are indicated as lost by
+    // feedback, without being trailed by any received packets.
+    std::vector<std::vector<uint16_t>> early_loss_detected_per_stream(
+        rtp_streams_.size());
 
     for (const PacketFeedback& packet : packet_feedback_vector) {
-      if (packet.send_time_ms == PacketFeedback::kNoSendTime || !packet.ssrc ||
-          absl::c_find(rtp_config_.ssrcs, *packet.ssrc) ==
-              rtp_config_.ssrcs.end()) {
+      if (packet.send_time_ms == PacketFeedback::kNoSendTime || !packet.ssrc) {
         // If packet send time is missing, the feedback for this packet has
         // probably already been processed, so ignore it.
-        // If packet does not belong to a registered media ssrc, we are also
-        // not interested in it.
+        continue;
+      }
+      const SsrcRoute* route = FindRouteBySsrc(*packet.ssrc);
+      if (route == nullptr) {
+        // If packet does not belong to a registered media ssrc, we are not
+        // interested in it.
         continue;
       }
 
       if (packet.arrival_time_ms == PacketFeedback::kNotReceived) {
         // Last known lost packet, might not be detectable as lost by remote
         // jitter buffer.
-        early_loss_detected_per_ssrc[*packet.ssrc].push_back(
+        early_loss_detected_per_stream[route->stream_index].push_back(
             packet.rtp_sequence_number);
       } else {
         // Packet received, so any loss prior to this is already detectable.
-        early_loss_detected_per_ssrc.erase(*packet.ssrc);
+        early_loss_detected_per_stream[route->stream_index].clear();
       }
     }
 
-    for (const auto& kv : early_loss_detected_per_ssrc) {
-      const uint32_t ssrc = kv.first;
-      auto it = ssrc_to_rtp_sender_.find(ssrc);
-      RTC_DCHECK(it != ssrc_to_rtp_sender_.end());
-      RTPSender* rtp_sender = it->second;
-      for (uint16_t sequence_number : kv.second) {
-        rtp_sender->ReSendPacket(sequence_number);
+    for (const SsrcRoute& route : ssrc_routes_) {
+      for (uint16_t sequence_number :
+           early_loss_detected_per_stream[route.stream_index]) {
+        route.rtp_sender->ReSendPacket(sequence_number);
       }
     }
   }
 
-  for (const auto& kv : acked_packets_per_ssrc) {
-    const uint32_t ssrc = kv.first;
-    auto it = ssrc_to_rtp_sender_.find(ssrc);
-    if (it == ssrc_to_rtp_sender_.end()) {
-      // Packets not for a media SSRC, so likely RTX or FEC. If so, ignore
-      // since there's no RTP history to clean up anyway.
-      continue;
-    }
-    rtc::ArrayView<const uint16_t> rtp_sequence_numbers(kv.second);
-    it->second->OnPacketsAcknowledged(rtp_sequence_numbers);
+  for (const SsrcRoute& route : ssrc_routes_) {
+    rtc::ArrayView<const uint16_t> rtp_sequence_numbers(
+        acked_packets_per_stream[route.stream_index]);
+    if (!rtp_sequence_numbers.empty())
+      route.rtp_sender->OnPacketsAcknowledged(rtp_sequence_numbers);
   }
 }
 
@@ -22,6 +22,7 @@
 #include "api/fec_controller.h"
 #include "api/fec_controller_override.h"
 #include "api/rtc_event_log/rtc_event_log.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/video_codecs/video_encoder.h"
 #include "call/rtp_config.h"
 #include "call/rtp_payload_params.h"
@@ -36,6 +37,7 @@
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/critical_section.h"
 #include "rtc_base/rate_limiter.h"
+#include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/thread_checker.h"
 
@@ -156,6 +158,13 @@ class RtpVideoSender : public RtpVideoSenderInterface,
       const std::vector<PacketFeedback>& packet_feedback_vector) override;
 
  private:
+  // One entry of the flat media ssrc routing table, see |ssrc_routes_|.
+  struct SsrcRoute {
+    uint32_t ssrc;
+    size_t stream_index;
+    RTPSender* rtp_sender;
+  };
+
   void UpdateModuleSendingState() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
   void ConfigureProtection();
   void ConfigureSsrcs();
@@ -163,10 +172,14 @@ class RtpVideoSender : public RtpVideoSenderInterface,
   bool FecEnabled() const;
   bool NackEnabled() const;
   uint32_t GetPacketizationOverheadRate() const;
+  // Returns the route for a media |ssrc|, or nullptr if it is not one of our
+  // media ssrcs (e.g. an RTX or FEC ssrc).
+  const SsrcRoute* FindRouteBySsrc(uint32_t ssrc) const;
 
   const bool send_side_bwe_with_overhead_;
   const bool account_for_packetization_overhead_;
   const bool use_early_loss_detection_;
+  const bool use_parallel_packetization_;
 
   // TODO(holmer): Remove crit_ once RtpVideoSender runs on the
   // transport task queue.
@@ -205,10 +218,19 @@ class RtpVideoSender : public RtpVideoSenderInterface,
   std::vector<FrameCounts> frame_counts_ RTC_GUARDED_BY(crit_);
   FrameCountObserver* const frame_count_observer_;
 
-  // Effectively const map from ssrc to RTPSender, for all media ssrcs.
-  // This map is set at construction time and never changed, but it's
-  // non-trivial to make it properly const.
-  std::map<uint32_t, RTPSender*> ssrc_to_rtp_sender_;
+  // Effectively const flat routing table from media ssrc to stream index and
+  // RTPSender, sorted by ssrc for binary search. The table is built in
+  // ConfigureSsrcs() and never changed; the set of ssrcs only changes on
+  // reconfiguration, which recreates this object.
+  std::vector<SsrcRoute> ssrc_routes_;
+
+  // When |use_parallel_packetization_| is set, each simulcast stream
+  // packetizes on its own queue so that the layers of a frame don't serialize
+  // on the encoder callback thread. Per-stream send order is preserved by the
+  // queue FIFO; the queues are declared last so they are drained before the
+  // rtp modules the tasks use are torn down.
+  std::unique_ptr<TaskQueueFactory> packetization_queue_factory_;
+  std::vector<std::unique_ptr<rtc::TaskQueue>> packetization_queues_;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(RtpVideoSender);
 };
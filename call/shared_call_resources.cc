@@ -0,0 +1,57 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "call/shared_call_resources.h"
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+#include "system_wrappers/include/cpu_info.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kMaxDefaultTaskQueueWorkers = 8;
+
+const TaskQueueFactory& BaseTaskQueueFactory(
+    const SharedCallResources::Config& config) {
+  RTC_CHECK(config.base_task_queue_factory);
+  return *config.base_task_queue_factory;
+}
+
+size_t NumTaskQueueWorkers(const SharedCallResources::Config& config) {
+  if (config.num_task_queue_workers > 0)
+    return config.num_task_queue_workers;
+  return std::min(kMaxDefaultTaskQueueWorkers,
+                  std::max<size_t>(1, CpuInfo::DetectNumberOfCores()));
+}
+
+}  // namespace
+
+SharedCallResources::SharedCallResources(const Config& config)
+    : task_queue_factory_(BaseTaskQueueFactory(config),
+                          NumTaskQueueWorkers(config),
+                          "SharedCallWorker",
+                          TaskQueueFactory::Priority::NORMAL) {}
+
+SharedCallResources::~SharedCallResources() = default;
+
+TaskQueueFactory* SharedCallResources::task_queue_factory() {
+  return &task_queue_factory_;
+}
+
+std::unique_ptr<ProcessThread> SharedCallResources::CreateModuleProcessThread() {
+  return ProcessThread::CreateShared("ModuleProcessThread");
+}
+
+std::unique_ptr<ProcessThread> SharedCallResources::CreatePacerThread() {
+  return ProcessThread::CreateShared("PacerThread");
+}
+
+}  // namespace webrtc
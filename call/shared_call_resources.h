@@ -0,0 +1,69 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef CALL_SHARED_CALL_RESOURCES_H_
+#define CALL_SHARED_CALL_RESOURCES_H_
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "api/task_queue/task_queue_factory.h"
+#include "modules/utility/include/process_thread.h"
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+
+namespace webrtc {
+
+// Worker infrastructure that multiple Call instances can share instead of
+// every call spinning up its own module process thread, pacer thread and
+// per-call task queues. Point CallConfig::shared_call_resources at one
+// instance and each call created from that config multiplexes onto the
+// bounded pools below:
+//
+//  - Task queues created by the calls are pinned round-robin onto a fixed
+//    number of pooled workers. Tasks posted to one queue still run in FIFO
+//    order and never overlap, so every call keeps its sequencing guarantees.
+//  - The module process and pacer threads become handles onto the
+//    process-wide scheduler shards (see SharedProcessThread); modules keep
+//    per-thread affinity while the thread count stays flat.
+//
+// The instance must outlive all calls created with it.
+class SharedCallResources {
+ public:
+  struct Config {
+    // Used to create the pooled task queue workers. Required; must outlive
+    // the SharedCallResources instance.
+    TaskQueueFactory* base_task_queue_factory = nullptr;
+
+    // Number of workers that the calls' task queues multiplex onto. Zero
+    // selects a default that scales with the number of CPU cores.
+    size_t num_task_queue_workers = 0;
+  };
+
+  explicit SharedCallResources(const Config& config);
+  ~SharedCallResources();
+
+  // TaskQueueFactory handing out queues that run on the shared worker pool.
+  TaskQueueFactory* task_queue_factory();
+
+  // Create the process thread handles for one call. The handles are backed
+  // by the process-wide scheduler shards and do not add threads.
+  std::unique_ptr<ProcessThread> CreateModuleProcessThread();
+  std::unique_ptr<ProcessThread> CreatePacerThread();
+
+ private:
+  PooledTaskQueueFactory task_queue_factory_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(SharedCallResources);
+};
+
+}  // namespace webrtc
+
+#endif  // CALL_SHARED_CALL_RESOURCES_H_
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "call/shared_call_resources.h"
+
+#include <memory>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "modules/include/module.h"
+#include "rtc_base/event.h"
+#include "rtc_base/location.h"
+#include "rtc_base/task_utils/to_queued_task.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kEventWaitTimeoutMs = 500;
+
+// Signals an event the first time it is processed, and asks to be left alone
+// afterwards.
+class SignalingModule : public Module {
+ public:
+  explicit SignalingModule(rtc::Event* event) : event_(event) {}
+
+  int64_t TimeUntilNextProcess() override { return processed_ ? 1000 : 0; }
+  void Process() override {
+    processed_ = true;
+    event_->Set();
+  }
+
+ private:
+  rtc::Event* const event_;
+  bool processed_ = false;
+};
+
+TEST(SharedCallResourcesTest, TaskQueuesRunPostedTasks) {
+  std::unique_ptr<TaskQueueFactory> base_factory =
+      CreateDefaultTaskQueueFactory();
+  SharedCallResources::Config config;
+  config.base_task_queue_factory = base_factory.get();
+  config.num_task_queue_workers = 1;
+  SharedCallResources resources(config);
+
+  auto task_queue = resources.task_queue_factory()->CreateTaskQueue(
+      "TestQueue", TaskQueueFactory::Priority::NORMAL);
+  rtc::Event event;
+  task_queue->PostTask(ToQueuedTask([&event] { event.Set(); }));
+  EXPECT_TRUE(event.Wait(kEventWaitTimeoutMs));
+}
+
+TEST(SharedCallResourcesTest, ProcessThreadsRunRegisteredModules) {
+  std::unique_ptr<TaskQueueFactory> base_factory =
+      CreateDefaultTaskQueueFactory();
+  SharedCallResources::Config config;
+  config.base_task_queue_factory = base_factory.get();
+  SharedCallResources resources(config);
+
+  std::unique_ptr<ProcessThread> process_thread =
+      resources.CreateModuleProcessThread();
+  rtc::Event event;
+  SignalingModule module(&event);
+  process_thread->RegisterModule(&module, RTC_FROM_HERE);
+  process_thread->Start();
+  EXPECT_TRUE(event.Wait(kEventWaitTimeoutMs));
+  process_thread->Stop();
+  process_thread->DeRegisterModule(&module);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -27,6 +27,42 @@ constexpr TimeDelta kDefaultProcessDelay = TimeDelta::Millis<5>();
 CoDelSimulation::CoDelSimulation() = default;
 CoDelSimulation::~CoDelSimulation() = default;
 
+SimulatedNetwork::CalendarPacketQueue::CalendarPacketQueue() = default;
+SimulatedNetwork::CalendarPacketQueue::~CalendarPacketQueue() = default;
+
+void SimulatedNetwork::CalendarPacketQueue::Insert(PacketInfo packet,
+                                                   int64_t departure_time_us) {
+  std::deque<Entry>& bucket = buckets_[departure_time_us / kBucketWidthUs];
+  // Common case: packets depart in order and land at the back of the bucket.
+  auto insert_at = bucket.end();
+  if (!bucket.empty() && bucket.back().departure_time_us > departure_time_us) {
+    insert_at = std::upper_bound(bucket.begin(), bucket.end(),
+                                 departure_time_us,
+                                 [](int64_t time_us, const Entry& entry) {
+                                   return time_us < entry.departure_time_us;
+                                 });
+  }
+  bucket.insert(insert_at, Entry{departure_time_us, packet});
+  last_departure_time_us_ = departure_time_us;
+  ++size_;
+}
+
+int64_t SimulatedNetwork::CalendarPacketQueue::PeekDepartureTimeUs() const {
+  RTC_DCHECK(!empty());
+  return buckets_.begin()->second.front().departure_time_us;
+}
+
+SimulatedNetwork::PacketInfo SimulatedNetwork::CalendarPacketQueue::PopFront() {
+  RTC_DCHECK(!empty());
+  auto bucket_it = buckets_.begin();
+  PacketInfo packet = bucket_it->second.front().packet;
+  bucket_it->second.pop_front();
+  if (bucket_it->second.empty())
+    buckets_.erase(bucket_it);
+  --size_;
+  return packet;
+}
+
 bool CoDelSimulation::DropDequeuedPacket(Timestamp now,
                                          Timestamp enqueing_time,
                                          DataSize packet_size,
@@ -141,6 +177,43 @@ bool SimulatedNetwork::EnqueuePacket(PacketInFlightInfo packet) {
   return true;
 }
 
+std::vector<bool> SimulatedNetwork::EnqueuePacketBatch(
+    rtc::ArrayView<const PacketInFlightInfo> packets) {
+  RTC_DCHECK_RUNS_SERIALIZED(&process_checker_);
+  std::vector<bool> sent;
+  sent.reserve(packets.size());
+  if (packets.empty())
+    return sent;
+  ConfigState state = GetConfigState();
+
+  absl::optional<int64_t> last_update_time_us;
+  for (PacketInFlightInfo packet : packets) {
+    // Packets in a batch commonly share their send time; only advance the
+    // capacity link when time actually moves.
+    if (packet.send_time_us != last_update_time_us) {
+      UpdateCapacityQueue(state, packet.send_time_us);
+      last_update_time_us = packet.send_time_us;
+    }
+
+    packet.size += state.config.packet_overhead;
+
+    if (state.config.queue_length_packets > 0 &&
+        capacity_link_.size() >= state.config.queue_length_packets) {
+      // Too many packet on the link, drop this one.
+      sent.push_back(false);
+      continue;
+    }
+
+    queue_size_bytes_ += packet.size;
+    capacity_link_.push({packet, packet.send_time_us});
+    if (!next_process_time_us_) {
+      next_process_time_us_ = packet.send_time_us + kDefaultProcessDelay.us();
+    }
+    sent.push_back(true);
+  }
+  return sent;
+}
+
 absl::optional<int64_t> SimulatedNetwork::NextDeliveryTimeUs() const {
   RTC_DCHECK_RUNS_SERIALIZED(&process_checker_);
   return next_process_time_us_;
@@ -148,8 +221,6 @@ absl::optional<int64_t> SimulatedNetwork::NextDeliveryTimeUs() const {
 
 void SimulatedNetwork::UpdateCapacityQueue(ConfigState state,
                                            int64_t time_now_us) {
-  bool needs_sort = false;
-
   // Catch for thread races.
   if (time_now_us < last_capacity_link_visit_us_.value_or(time_now_us))
     return;
@@ -199,7 +270,14 @@ void SimulatedNetwork::UpdateCapacityQueue(ConfigState state,
         capacity_link_.pop();
         queue_size_bytes_ -= dropped.packet.size;
         dropped.arrival_time_us = PacketDeliveryInfo::kNotReceived;
-        delay_link_.emplace_back(dropped);
+        // Dropped packets keep their position in the delay link so that the
+        // drop is reported when the packet would have left the queue.
+        int64_t departure_time_us = time_us;
+        if (!delay_link_.empty()) {
+          departure_time_us = std::max(departure_time_us,
+                                       delay_link_.last_departure_time_us());
+        }
+        delay_link_.Insert(dropped, departure_time_us);
       }
     }
     RTC_DCHECK(time_us >= packet.packet.send_time_us);
@@ -214,7 +292,15 @@ void SimulatedNetwork::UpdateCapacityQueue(ConfigState state,
     if ((bursting_ && random_.Rand<double>() < state.prob_loss_bursting) ||
         (!bursting_ && random_.Rand<double>() < state.prob_start_bursting)) {
       bursting_ = true;
+      // Lost packets keep their position in the delay link so that the loss
+      // is reported when the packet would have been delivered.
+      int64_t departure_time_us = packet.arrival_time_us;
+      if (!delay_link_.empty()) {
+        departure_time_us = std::max(departure_time_us,
+                                     delay_link_.last_departure_time_us());
+      }
       packet.arrival_time_us = PacketDeliveryInfo::kNotReceived;
+      delay_link_.Insert(packet, departure_time_us);
     } else {
       bursting_ = false;
       int64_t arrival_time_jitter_us = std::max(
@@ -225,32 +311,19 @@ void SimulatedNetwork::UpdateCapacityQueue(ConfigState state,
       // If reordering is not allowed then adjust arrival_time_jitter
       // to make sure all packets are sent in order.
       int64_t last_arrival_time_us =
-          delay_link_.empty() ? -1 : delay_link_.back().arrival_time_us;
+          delay_link_.empty() ? -1 : delay_link_.last_departure_time_us();
       if (!state.config.allow_reordering && !delay_link_.empty() &&
           packet.arrival_time_us + arrival_time_jitter_us <
               last_arrival_time_us) {
         arrival_time_jitter_us = last_arrival_time_us - packet.arrival_time_us;
       }
       packet.arrival_time_us += arrival_time_jitter_us;
-      if (packet.arrival_time_us >= last_arrival_time_us) {
-        last_arrival_time_us = packet.arrival_time_us;
-      } else {
-        needs_sort = true;
-      }
+      delay_link_.Insert(packet, packet.arrival_time_us);
     }
-    delay_link_.emplace_back(packet);
   }
   last_capacity_link_visit_us_ = time_now_us;
   // Cannot save unused capacity for later.
   pending_drain_bits_ = std::min(pending_drain_bits_, queue_size_bytes_ * 8);
-
-  if (needs_sort) {
-    // Packet(s) arrived out of order, make sure list is sorted.
-    std::sort(delay_link_.begin(), delay_link_.end(),
-              [](const PacketInfo& p1, const PacketInfo& p2) {
-                return p1.arrival_time_us < p2.arrival_time_us;
-              });
-  }
 }
 
 SimulatedNetwork::ConfigState SimulatedNetwork::GetConfigState() const {
@@ -265,15 +338,14 @@ std::vector<PacketDeliveryInfo> SimulatedNetwork::DequeueDeliverablePackets(
   std::vector<PacketDeliveryInfo> packets_to_deliver;
   // Check the extra delay queue.
   while (!delay_link_.empty() &&
-         receive_time_us >= delay_link_.front().arrival_time_us) {
-    PacketInfo packet_info = delay_link_.front();
+         receive_time_us >= delay_link_.PeekDepartureTimeUs()) {
+    PacketInfo packet_info = delay_link_.PopFront();
     packets_to_deliver.emplace_back(
         PacketDeliveryInfo(packet_info.packet, packet_info.arrival_time_us));
-    delay_link_.pop_front();
   }
 
   if (!delay_link_.empty()) {
-    next_process_time_us_ = delay_link_.front().arrival_time_us;
+    next_process_time_us_ = delay_link_.PeekDepartureTimeUs();
   } else if (!capacity_link_.empty()) {
     next_process_time_us_ = receive_time_us + kDefaultProcessDelay.us();
   } else {
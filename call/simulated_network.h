@@ -13,6 +13,7 @@
 #include <stdint.h>
 
 #include <deque>
+#include <map>
 #include <queue>
 #include <vector>
 
@@ -66,6 +67,11 @@ class SimulatedNetwork : public NetworkBehaviorInterface {
 
   // NetworkBehaviorInterface
   bool EnqueuePacket(PacketInFlightInfo packet) override;
+  // Enqueues a burst of packets with a single configuration snapshot and a
+  // single capacity link update per distinct send time, which makes replaying
+  // high-rate traces considerably cheaper than per-packet EnqueuePacket().
+  std::vector<bool> EnqueuePacketBatch(
+      rtc::ArrayView<const PacketInFlightInfo> packets) override;
   std::vector<PacketDeliveryInfo> DequeueDeliverablePackets(
       int64_t receive_time_us) override;
 
@@ -89,6 +95,44 @@ class SimulatedNetwork : public NetworkBehaviorInterface {
     int64_t pause_transmission_until_us = 0;
   };
 
+  // Time-ordered queue for packets in the delay stage. Implemented as a
+  // calendar queue: packets are mapped to fixed-width time buckets keyed by
+  // their scheduled departure time, and only the (small) bucket a packet
+  // lands in is kept sorted. This keeps inserts cheap even when jitter
+  // reorders packets, where a single sorted container would have to be
+  // resorted on every out-of-order insert.
+  class CalendarPacketQueue {
+   public:
+    CalendarPacketQueue();
+    ~CalendarPacketQueue();
+
+    // Inserts |packet|, ordered by |departure_time_us|. Ties keep insertion
+    // order. The departure time may differ from the arrival time stored in
+    // the packet; lost packets keep their queue position but report
+    // PacketDeliveryInfo::kNotReceived as arrival time.
+    void Insert(PacketInfo packet, int64_t departure_time_us);
+    // Departure time of the earliest packet. Only valid if !empty().
+    int64_t PeekDepartureTimeUs() const;
+    // Removes and returns the earliest packet. Only valid if !empty().
+    PacketInfo PopFront();
+    bool empty() const { return size_ == 0; }
+    // Departure time passed to the most recent Insert(), or -1 if nothing has
+    // been inserted yet. Not reset when the queue drains.
+    int64_t last_departure_time_us() const { return last_departure_time_us_; }
+
+   private:
+    static constexpr int64_t kBucketWidthUs = 1024;
+    struct Entry {
+      int64_t departure_time_us;
+      PacketInfo packet;
+    };
+    // Buckets of kBucketWidthUs each, keyed by departure time divided by the
+    // bucket width. Each bucket is kept sorted by departure time.
+    std::map<int64_t, std::deque<Entry>> buckets_;
+    size_t size_ = 0;
+    int64_t last_departure_time_us_ = -1;
+  };
+
   // Moves packets from capacity- to delay link.
   void UpdateCapacityQueue(ConfigState state, int64_t time_now_us)
       RTC_RUN_ON(&process_checker_);
@@ -103,7 +147,7 @@ class SimulatedNetwork : public NetworkBehaviorInterface {
   std::queue<PacketInfo> capacity_link_ RTC_GUARDED_BY(process_checker_);
   Random random_;
 
-  std::deque<PacketInfo> delay_link_ RTC_GUARDED_BY(process_checker_);
+  CalendarPacketQueue delay_link_ RTC_GUARDED_BY(process_checker_);
 
   ConfigState config_state_ RTC_GUARDED_BY(config_lock_);
 
@@ -145,4 +145,91 @@ TEST(SimulatedNetworkTest, CodelLimitsDelayAndDropsPacketsOnOverload) {
   }
   EXPECT_EQ(send_times_us.size(), 0u);
 }
+
+TEST(SimulatedNetworkTest, BatchEnqueueMatchesSequentialEnqueue) {
+  SimulatedNetwork::Config config;
+  config.link_capacity_kbps = 1000;
+  config.queue_delay_ms = 10;
+  SimulatedNetwork sequential(config, /*random_seed=*/7);
+  SimulatedNetwork batched(config, /*random_seed=*/7);
+
+  // Ten bursts of ten packets, with all packets in a burst sharing their send
+  // time.
+  std::vector<PacketInFlightInfo> packets;
+  for (uint64_t i = 0; i < 100; ++i) {
+    packets.push_back(PacketInFlightInfo(/*size=*/1200,
+                                         /*send_time_us=*/10000 * (i / 10),
+                                         /*packet_id=*/i));
+  }
+  for (const PacketInFlightInfo& packet : packets)
+    EXPECT_TRUE(sequential.EnqueuePacket(packet));
+  std::vector<bool> sent = batched.EnqueuePacketBatch(packets);
+  ASSERT_EQ(sent.size(), packets.size());
+  for (bool packet_sent : sent)
+    EXPECT_TRUE(packet_sent);
+
+  std::vector<PacketDeliveryInfo> sequential_delivered;
+  while (sequential.NextDeliveryTimeUs()) {
+    for (PacketDeliveryInfo packet : sequential.DequeueDeliverablePackets(
+             *sequential.NextDeliveryTimeUs())) {
+      sequential_delivered.push_back(packet);
+    }
+  }
+  std::vector<PacketDeliveryInfo> batched_delivered;
+  while (batched.NextDeliveryTimeUs()) {
+    for (PacketDeliveryInfo packet :
+         batched.DequeueDeliverablePackets(*batched.NextDeliveryTimeUs())) {
+      batched_delivered.push_back(packet);
+    }
+  }
+  ASSERT_EQ(batched_delivered.size(), sequential_delivered.size());
+  for (size_t i = 0; i < sequential_delivered.size(); ++i) {
+    EXPECT_EQ(batched_delivered[i].packet_id,
+              sequential_delivered[i].packet_id);
+    EXPECT_EQ(batched_delivered[i].receive_time_us,
+              sequential_delivered[i].receive_time_us);
+  }
+}
+
+TEST(SimulatedNetworkTest, BatchEnqueueRespectsQueueLength) {
+  SimulatedNetwork::Config config;
+  config.link_capacity_kbps = 80;
+  config.queue_length_packets = 10;
+  SimulatedNetwork network(config);
+
+  std::vector<PacketInFlightInfo> packets;
+  for (uint64_t i = 0; i < 15; ++i) {
+    packets.push_back(
+        PacketInFlightInfo(/*size=*/1000, /*send_time_us=*/0, /*packet_id=*/i));
+  }
+  std::vector<bool> sent = network.EnqueuePacketBatch(packets);
+  ASSERT_EQ(sent.size(), packets.size());
+  for (size_t i = 0; i < sent.size(); ++i)
+    EXPECT_EQ(sent[i], i < 10);
+}
+
+TEST(SimulatedNetworkTest, ReorderedPacketsAreDeliveredInArrivalTimeOrder) {
+  SimulatedNetwork::Config config;
+  config.queue_delay_ms = 100;
+  config.delay_standard_deviation_ms = 20;
+  config.allow_reordering = true;
+  SimulatedNetwork network(config, /*random_seed=*/1);
+
+  for (uint64_t i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(network.EnqueuePacket(
+        PacketInFlightInfo(/*size=*/1000, /*send_time_us=*/1000 * i,
+                           /*packet_id=*/i)));
+  }
+  int64_t last_receive_time_us = 0;
+  size_t delivered = 0;
+  while (network.NextDeliveryTimeUs()) {
+    for (PacketDeliveryInfo packet :
+         network.DequeueDeliverablePackets(*network.NextDeliveryTimeUs())) {
+      EXPECT_GE(packet.receive_time_us, last_receive_time_us);
+      last_receive_time_us = packet.receive_time_us;
+      ++delivered;
+    }
+  }
+  EXPECT_EQ(delivered, 1000u);
+}
 }  // namespace webrtc
@@ -0,0 +1,92 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/async_wav_writer.h"
+
+#include <utility>
+
+#include "common_audio/include/audio_util.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+
+namespace webrtc {
+namespace {
+
+// Maximum number of sample buffers kept for reuse per writer. With 10 ms
+// writes this covers a long I/O stall without growing without bound.
+constexpr size_t kMaxPooledBuffers = 32;
+
+}  // namespace
+
+AsyncWavWriter::AsyncWavWriter(const std::string& filename,
+                               int sample_rate,
+                               size_t num_channels,
+                               rtc::TaskQueue* write_queue)
+    : writer_(filename, sample_rate, num_channels),
+      write_queue_(write_queue),
+      num_samples_(0) {
+  RTC_DCHECK(write_queue_);
+}
+
+AsyncWavWriter::~AsyncWavWriter() {
+  // All pending writes precede this task on the queue; once it runs, the
+  // WavWriter can be safely destroyed (closing the file and writing the
+  // final header).
+  rtc::Event done;
+  write_queue_->PostTask([&done] { done.Set(); });
+  done.Wait(rtc::Event::kForever);
+}
+
+int AsyncWavWriter::sample_rate() const {
+  return writer_.sample_rate();
+}
+
+size_t AsyncWavWriter::num_channels() const {
+  return writer_.num_channels();
+}
+
+size_t AsyncWavWriter::num_samples() const {
+  return num_samples_;
+}
+
+void AsyncWavWriter::WriteSamples(const int16_t* samples, size_t num_samples) {
+  std::vector<int16_t> buffer = TakeBuffer();
+  buffer.assign(samples, samples + num_samples);
+  PostWrite(std::move(buffer));
+}
+
+void AsyncWavWriter::WriteSamples(const float* samples, size_t num_samples) {
+  std::vector<int16_t> buffer = TakeBuffer();
+  buffer.resize(num_samples);
+  FloatS16ToS16(samples, num_samples, buffer.data());
+  PostWrite(std::move(buffer));
+}
+
+std::vector<int16_t> AsyncWavWriter::TakeBuffer() {
+  rtc::CritScope lock(&pool_lock_);
+  if (buffer_pool_.empty())
+    return std::vector<int16_t>();
+  std::vector<int16_t> buffer = std::move(buffer_pool_.back());
+  buffer_pool_.pop_back();
+  return buffer;
+}
+
+void AsyncWavWriter::PostWrite(std::vector<int16_t> buffer) {
+  num_samples_ += buffer.size();
+  RTC_CHECK_GE(num_samples_, buffer.size());  // Detect size_t overflow.
+  write_queue_->PostTask([this, buffer = std::move(buffer)]() mutable {
+    writer_.WriteSamples(buffer.data(), buffer.size());
+    rtc::CritScope lock(&pool_lock_);
+    if (buffer_pool_.size() < kMaxPooledBuffers)
+      buffer_pool_.push_back(std::move(buffer));
+  });
+}
+
+}  // namespace webrtc
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_AUDIO_ASYNC_WAV_WRITER_H_
+#define COMMON_AUDIO_ASYNC_WAV_WRITER_H_
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "common_audio/wav_file.h"
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/task_queue.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Wraps a WavWriter so that the file I/O happens on a caller-supplied task
+// queue instead of on the thread calling WriteSamples(). This keeps the bulk
+// of the write cost off real-time audio threads; many writers may share one
+// queue, so recording a large number of streams needs only a single I/O
+// thread. Sample buffers handed to the queue are recycled, so WriteSamples()
+// does not allocate in steady state.
+//
+// WriteSamples() must be called on one thread at a time, like for WavWriter.
+// The destructor blocks until all queued samples have been written and the
+// file has been closed.
+class AsyncWavWriter final : public WavFile {
+ public:
+  // Opens the file for writing on the construction thread. |write_queue| is
+  // not owned and must outlive this instance.
+  AsyncWavWriter(const std::string& filename,
+                 int sample_rate,
+                 size_t num_channels,
+                 rtc::TaskQueue* write_queue);
+
+  // Waits for all pending writes, then closes the WAV file after writing its
+  // header.
+  ~AsyncWavWriter() override;
+
+  // Queues samples for writing; same sample format as WavWriter.
+  void WriteSamples(const float* samples, size_t num_samples);
+  void WriteSamples(const int16_t* samples, size_t num_samples);
+
+  int sample_rate() const override;
+  size_t num_channels() const override;
+
+  // Total number of samples handed to WriteSamples(), including samples not
+  // yet written to the file.
+  size_t num_samples() const override;
+
+ private:
+  std::vector<int16_t> TakeBuffer();
+  void PostWrite(std::vector<int16_t> buffer);
+
+  WavWriter writer_;  // Used on |write_queue_| only, once constructed.
+  rtc::TaskQueue* const write_queue_;
+  size_t num_samples_;  // Accessed on the WriteSamples() thread only.
+
+  rtc::CriticalSection pool_lock_;
+  std::vector<std::vector<int16_t>> buffer_pool_ RTC_GUARDED_BY(pool_lock_);
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(AsyncWavWriter);
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_AUDIO_ASYNC_WAV_WRITER_H_
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/async_wav_writer.h"
+
+#include <cmath>
+#include <string>
+
+#include "common_audio/wav_file.h"
+#include "rtc_base/task_queue_for_test.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+
+// Write a file through AsyncWavWriter and verify it reads back identically to
+// one written synchronously with WavWriter.
+TEST(AsyncWavWriterTest, MatchesSyncWriter) {
+  const std::string async_file = test::OutputPath() + "async_wavtest1.wav";
+  const std::string sync_file = test::OutputPath() + "async_wavtest2.wav";
+  static const int kSampleRate = 16000;
+  static const size_t kNumChannels = 1;
+  static const size_t kChunkSize = kSampleRate / 100;  // 10 ms.
+  static const size_t kNumChunks = 50;
+
+  float samples[kChunkSize * kNumChunks];
+  for (size_t i = 0; i < kChunkSize * kNumChunks; ++i) {
+    samples[i] = std::sin(2 * 3.14159265 * 440 * i / kSampleRate) * 10000;
+  }
+
+  {
+    TaskQueueForTest write_queue("WavIO");
+    AsyncWavWriter w(async_file, kSampleRate, kNumChannels, &write_queue);
+    EXPECT_EQ(kSampleRate, w.sample_rate());
+    EXPECT_EQ(kNumChannels, w.num_channels());
+    for (size_t i = 0; i < kNumChunks; ++i) {
+      w.WriteSamples(samples + i * kChunkSize, kChunkSize);
+    }
+    EXPECT_EQ(kChunkSize * kNumChunks, w.num_samples());
+    // The destructor blocks until everything has hit the file.
+  }
+  {
+    WavWriter w(sync_file, kSampleRate, kNumChannels);
+    w.WriteSamples(samples, kChunkSize * kNumChunks);
+  }
+
+  EXPECT_EQ(test::GetFileSize(sync_file), test::GetFileSize(async_file));
+  WavReader async_reader(async_file);
+  WavReader sync_reader(sync_file);
+  EXPECT_EQ(kChunkSize * kNumChunks, async_reader.num_samples());
+  int16_t async_samples[kChunkSize * kNumChunks];
+  int16_t sync_samples[kChunkSize * kNumChunks];
+  EXPECT_EQ(kChunkSize * kNumChunks,
+            async_reader.ReadSamples(kChunkSize * kNumChunks, async_samples));
+  EXPECT_EQ(kChunkSize * kNumChunks,
+            sync_reader.ReadSamples(kChunkSize * kNumChunks, sync_samples));
+  EXPECT_EQ(0, memcmp(sync_samples, async_samples, sizeof(sync_samples)));
+}
+
+// Several writers may share one queue; writes from different writers must not
+// interfere with each other.
+TEST(AsyncWavWriterTest, SharedQueue) {
+  const std::string file_a = test::OutputPath() + "async_wavtest3.wav";
+  const std::string file_b = test::OutputPath() + "async_wavtest4.wav";
+  static const size_t kNumSamples = 160;
+  int16_t samples_a[kNumSamples];
+  int16_t samples_b[kNumSamples];
+  for (size_t i = 0; i < kNumSamples; ++i) {
+    samples_a[i] = static_cast<int16_t>(i);
+    samples_b[i] = static_cast<int16_t>(-1 - static_cast<int>(i));
+  }
+
+  {
+    TaskQueueForTest write_queue("WavIO");
+    AsyncWavWriter a(file_a, 16000, 1, &write_queue);
+    AsyncWavWriter b(file_b, 48000, 1, &write_queue);
+    for (size_t i = 0; i < kNumSamples; i += 16) {
+      a.WriteSamples(samples_a + i, 16);
+      b.WriteSamples(samples_b + i, 16);
+    }
+  }
+
+  int16_t read_back[kNumSamples];
+  WavReader reader_a(file_a);
+  EXPECT_EQ(16000, reader_a.sample_rate());
+  EXPECT_EQ(kNumSamples, reader_a.ReadSamples(kNumSamples, read_back));
+  EXPECT_EQ(0, memcmp(samples_a, read_back, sizeof(samples_a)));
+  WavReader reader_b(file_b);
+  EXPECT_EQ(48000, reader_b.sample_rate());
+  EXPECT_EQ(kNumSamples, reader_b.ReadSamples(kNumSamples, read_back));
+  EXPECT_EQ(0, memcmp(samples_b, read_back, sizeof(samples_b)));
+}
+
+}  // namespace webrtc
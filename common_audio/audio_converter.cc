@@ -12,10 +12,8 @@
 
 #include <cstring>
 #include <memory>
-#include <utility>
 #include <vector>
 
-#include "common_audio/channel_buffer.h"
 #include "common_audio/resampler/push_sinc_resampler.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
@@ -116,41 +114,61 @@ class ResampleConverter : public AudioConverter {
   std::vector<std::unique_ptr<PushSincResampler>> resamplers_;
 };
 
-// Apply a vector of converters in serial, in the order given. At least two
-// converters must be provided.
-class CompositionConverter : public AudioConverter {
+// Downmixes and resamples in a single pass, by averaging the channels inside
+// the resampler's input read. Compared to chaining a DownmixConverter and a
+// ResampleConverter this avoids the intermediate mono buffer entirely.
+class DownmixResampleConverter : public AudioConverter {
  public:
-  explicit CompositionConverter(
-      std::vector<std::unique_ptr<AudioConverter>> converters)
-      : converters_(std::move(converters)) {
-    RTC_CHECK_GE(converters_.size(), 2);
-    // We need an intermediate buffer after every converter.
-    for (auto it = converters_.begin(); it != converters_.end() - 1; ++it)
-      buffers_.push_back(
-          std::unique_ptr<ChannelBuffer<float>>(new ChannelBuffer<float>(
-              (*it)->dst_frames(), (*it)->dst_channels())));
+  DownmixResampleConverter(size_t src_channels,
+                           size_t src_frames,
+                           size_t dst_channels,
+                           size_t dst_frames)
+      : AudioConverter(src_channels, src_frames, dst_channels, dst_frames),
+        resampler_(new PushSincResampler(src_frames, dst_frames)) {
+    RTC_CHECK_EQ(dst_channels, 1);
   }
-  ~CompositionConverter() override {}
+  ~DownmixResampleConverter() override {}
 
   void Convert(const float* const* src,
                size_t src_size,
                float* const* dst,
                size_t dst_capacity) override {
-    converters_.front()->Convert(src, src_size, buffers_.front()->channels(),
-                                 buffers_.front()->size());
-    for (size_t i = 2; i < converters_.size(); ++i) {
-      auto& src_buffer = buffers_[i - 2];
-      auto& dst_buffer = buffers_[i - 1];
-      converters_[i]->Convert(src_buffer->channels(), src_buffer->size(),
-                              dst_buffer->channels(), dst_buffer->size());
-    }
-    converters_.back()->Convert(buffers_.back()->channels(),
-                                buffers_.back()->size(), dst, dst_capacity);
+    CheckSizes(src_size, dst_capacity);
+    resampler_->ResampleDownmix(src, src_channels(), src_frames(), dst[0],
+                                dst_frames());
+  }
+
+ private:
+  std::unique_ptr<PushSincResampler> resampler_;
+};
+
+// Resamples the mono source directly into the first destination channel and
+// fans the result out to the remaining channels, avoiding the intermediate
+// buffer a chained ResampleConverter and UpmixConverter would need.
+class ResampleUpmixConverter : public AudioConverter {
+ public:
+  ResampleUpmixConverter(size_t src_channels,
+                         size_t src_frames,
+                         size_t dst_channels,
+                         size_t dst_frames)
+      : AudioConverter(src_channels, src_frames, dst_channels, dst_frames),
+        resampler_(new PushSincResampler(src_frames, dst_frames)) {
+    RTC_CHECK_EQ(src_channels, 1);
+  }
+  ~ResampleUpmixConverter() override {}
+
+  void Convert(const float* const* src,
+               size_t src_size,
+               float* const* dst,
+               size_t dst_capacity) override {
+    CheckSizes(src_size, dst_capacity);
+    resampler_->Resample(src[0], src_frames(), dst[0], dst_frames());
+    for (size_t j = 1; j < dst_channels(); ++j)
+      std::memcpy(dst[j], dst[0], dst_frames() * sizeof(*dst[j]));
   }
 
  private:
-  std::vector<std::unique_ptr<AudioConverter>> converters_;
-  std::vector<std::unique_ptr<ChannelBuffer<float>>> buffers_;
+  std::unique_ptr<PushSincResampler> resampler_;
 };
 
 std::unique_ptr<AudioConverter> AudioConverter::Create(size_t src_channels,
@@ -160,26 +178,16 @@ std::unique_ptr<AudioConverter> AudioConverter::Create(size_t src_channels,
   std::unique_ptr<AudioConverter> sp;
   if (src_channels > dst_channels) {
     if (src_frames != dst_frames) {
-      std::vector<std::unique_ptr<AudioConverter>> converters;
-      converters.push_back(std::unique_ptr<AudioConverter>(new DownmixConverter(
-          src_channels, src_frames, dst_channels, src_frames)));
-      converters.push_back(
-          std::unique_ptr<AudioConverter>(new ResampleConverter(
-              dst_channels, src_frames, dst_channels, dst_frames)));
-      sp.reset(new CompositionConverter(std::move(converters)));
+      sp.reset(new DownmixResampleConverter(src_channels, src_frames,
+                                            dst_channels, dst_frames));
     } else {
       sp.reset(new DownmixConverter(src_channels, src_frames, dst_channels,
                                     dst_frames));
     }
   } else if (src_channels < dst_channels) {
     if (src_frames != dst_frames) {
-      std::vector<std::unique_ptr<AudioConverter>> converters;
-      converters.push_back(
-          std::unique_ptr<AudioConverter>(new ResampleConverter(
-              src_channels, src_frames, src_channels, dst_frames)));
-      converters.push_back(std::unique_ptr<AudioConverter>(new UpmixConverter(
-          src_channels, dst_frames, dst_channels, dst_frames)));
-      sp.reset(new CompositionConverter(std::move(converters)));
+      sp.reset(new ResampleUpmixConverter(src_channels, src_frames,
+                                          dst_channels, dst_frames));
     } else {
       sp.reset(new UpmixConverter(src_channels, src_frames, dst_channels,
                                   dst_frames));
@@ -195,10 +203,6 @@ std::unique_ptr<AudioConverter> AudioConverter::Create(size_t src_channels,
   return sp;
 }
 
-// For CompositionConverter.
-AudioConverter::AudioConverter()
-    : src_channels_(0), src_frames_(0), dst_channels_(0), dst_frames_(0) {}
-
 AudioConverter::AudioConverter(size_t src_channels,
                                size_t src_frames,
                                size_t dst_channels,
@@ -50,7 +50,6 @@ class AudioConverter {
   size_t dst_frames() const { return dst_frames_; }
 
  protected:
-  AudioConverter();
   AudioConverter(size_t src_channels,
                  size_t src_frames,
                  size_t dst_channels,
@@ -10,8 +10,215 @@
 
 #include "common_audio/include/audio_util.h"
 
+#include <string.h>
+
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace webrtc {
 
+namespace {
+
+// Generic scalar implementations, used for channel counts above two and for
+// the samples left over by the vectorized stereo loops.
+template <typename T>
+void DeinterleaveGeneric(const T* interleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         T* const* deinterleaved) {
+  for (size_t i = 0; i < num_channels; ++i) {
+    T* channel = deinterleaved[i];
+    size_t interleaved_idx = i;
+    for (size_t j = 0; j < samples_per_channel; ++j) {
+      channel[j] = interleaved[interleaved_idx];
+      interleaved_idx += num_channels;
+    }
+  }
+}
+
+template <typename T>
+void InterleaveGeneric(const T* const* deinterleaved,
+                       size_t samples_per_channel,
+                       size_t num_channels,
+                       T* interleaved) {
+  for (size_t i = 0; i < num_channels; ++i) {
+    const T* channel = deinterleaved[i];
+    size_t interleaved_idx = i;
+    for (size_t j = 0; j < samples_per_channel; ++j) {
+      interleaved[interleaved_idx] = channel[j];
+      interleaved_idx += num_channels;
+    }
+  }
+}
+
+void DeinterleaveStereo(const int16_t* interleaved,
+                        size_t samples_per_channel,
+                        int16_t* left,
+                        int16_t* right) {
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; j + 8 <= samples_per_channel; j += 8) {
+    const __m128i ab = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(interleaved + 2 * j));
+    const __m128i cd = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(interleaved + 2 * j + 8));
+    // Group the left and right samples within each 64 bit lane and then
+    // gather the lanes: {L0 R0 L1 R1 ...} -> {L0 L1 L2 L3 R0 R1 R2 R3}.
+    const __m128i ab_grouped = _mm_shuffle_epi32(
+        _mm_shufflehi_epi16(_mm_shufflelo_epi16(ab, _MM_SHUFFLE(3, 1, 2, 0)),
+                            _MM_SHUFFLE(3, 1, 2, 0)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i cd_grouped = _mm_shuffle_epi32(
+        _mm_shufflehi_epi16(_mm_shufflelo_epi16(cd, _MM_SHUFFLE(3, 1, 2, 0)),
+                            _MM_SHUFFLE(3, 1, 2, 0)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(left + j),
+                     _mm_unpacklo_epi64(ab_grouped, cd_grouped));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(right + j),
+                     _mm_unpackhi_epi64(ab_grouped, cd_grouped));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; j + 8 <= samples_per_channel; j += 8) {
+    const int16x8x2_t lr = vld2q_s16(interleaved + 2 * j);
+    vst1q_s16(left + j, lr.val[0]);
+    vst1q_s16(right + j, lr.val[1]);
+  }
+#endif
+  for (; j < samples_per_channel; ++j) {
+    left[j] = interleaved[2 * j];
+    right[j] = interleaved[2 * j + 1];
+  }
+}
+
+void DeinterleaveStereo(const float* interleaved,
+                        size_t samples_per_channel,
+                        float* left,
+                        float* right) {
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; j + 4 <= samples_per_channel; j += 4) {
+    const __m128 ab = _mm_loadu_ps(interleaved + 2 * j);
+    const __m128 cd = _mm_loadu_ps(interleaved + 2 * j + 4);
+    _mm_storeu_ps(left + j, _mm_shuffle_ps(ab, cd, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(right + j, _mm_shuffle_ps(ab, cd, _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; j + 4 <= samples_per_channel; j += 4) {
+    const float32x4x2_t lr = vld2q_f32(interleaved + 2 * j);
+    vst1q_f32(left + j, lr.val[0]);
+    vst1q_f32(right + j, lr.val[1]);
+  }
+#endif
+  for (; j < samples_per_channel; ++j) {
+    left[j] = interleaved[2 * j];
+    right[j] = interleaved[2 * j + 1];
+  }
+}
+
+void InterleaveStereo(const int16_t* left,
+                      const int16_t* right,
+                      size_t samples_per_channel,
+                      int16_t* interleaved) {
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; j + 8 <= samples_per_channel; j += 8) {
+    const __m128i l =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + j));
+    const __m128i r =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + j));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(interleaved + 2 * j),
+                     _mm_unpacklo_epi16(l, r));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(interleaved + 2 * j + 8),
+                     _mm_unpackhi_epi16(l, r));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; j + 8 <= samples_per_channel; j += 8) {
+    int16x8x2_t lr;
+    lr.val[0] = vld1q_s16(left + j);
+    lr.val[1] = vld1q_s16(right + j);
+    vst2q_s16(interleaved + 2 * j, lr);
+  }
+#endif
+  for (; j < samples_per_channel; ++j) {
+    interleaved[2 * j] = left[j];
+    interleaved[2 * j + 1] = right[j];
+  }
+}
+
+void InterleaveStereo(const float* left,
+                      const float* right,
+                      size_t samples_per_channel,
+                      float* interleaved) {
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; j + 4 <= samples_per_channel; j += 4) {
+    const __m128 l = _mm_loadu_ps(left + j);
+    const __m128 r = _mm_loadu_ps(right + j);
+    _mm_storeu_ps(interleaved + 2 * j, _mm_unpacklo_ps(l, r));
+    _mm_storeu_ps(interleaved + 2 * j + 4, _mm_unpackhi_ps(l, r));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; j + 4 <= samples_per_channel; j += 4) {
+    float32x4x2_t lr;
+    lr.val[0] = vld1q_f32(left + j);
+    lr.val[1] = vld1q_f32(right + j);
+    vst2q_f32(interleaved + 2 * j, lr);
+  }
+#endif
+  for (; j < samples_per_channel; ++j) {
+    interleaved[2 * j] = left[j];
+    interleaved[2 * j + 1] = right[j];
+  }
+}
+
+template <typename T>
+void DeinterleaveImpl(const T* interleaved,
+                      size_t samples_per_channel,
+                      size_t num_channels,
+                      T* const* deinterleaved) {
+  switch (num_channels) {
+    case 1:
+      memcpy(deinterleaved[0], interleaved,
+             samples_per_channel * sizeof(*interleaved));
+      return;
+    case 2:
+      DeinterleaveStereo(interleaved, samples_per_channel, deinterleaved[0],
+                         deinterleaved[1]);
+      return;
+    default:
+      DeinterleaveGeneric(interleaved, samples_per_channel, num_channels,
+                          deinterleaved);
+  }
+}
+
+template <typename T>
+void InterleaveImpl(const T* const* deinterleaved,
+                    size_t samples_per_channel,
+                    size_t num_channels,
+                    T* interleaved) {
+  switch (num_channels) {
+    case 1:
+      memcpy(interleaved, deinterleaved[0],
+             samples_per_channel * sizeof(*interleaved));
+      return;
+    case 2:
+      InterleaveStereo(deinterleaved[0], deinterleaved[1], samples_per_channel,
+                       interleaved);
+      return;
+    default:
+      InterleaveGeneric(deinterleaved, samples_per_channel, num_channels,
+                        interleaved);
+  }
+}
+
+}  // namespace
+
 void FloatToS16(const float* src, size_t size, int16_t* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = FloatToS16(src[i]);
@@ -42,11 +249,92 @@ void FloatS16ToFloat(const float* src, size_t size, float* dest) {
     dest[i] = FloatS16ToFloat(src[i]);
 }
 
+template <>
+void Deinterleave<int16_t>(const int16_t* interleaved,
+                           size_t samples_per_channel,
+                           size_t num_channels,
+                           int16_t* const* deinterleaved) {
+  DeinterleaveImpl(interleaved, samples_per_channel, num_channels,
+                   deinterleaved);
+}
+
+template <>
+void Deinterleave<float>(const float* interleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         float* const* deinterleaved) {
+  DeinterleaveImpl(interleaved, samples_per_channel, num_channels,
+                   deinterleaved);
+}
+
+template <>
+void Interleave<int16_t>(const int16_t* const* deinterleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         int16_t* interleaved) {
+  InterleaveImpl(deinterleaved, samples_per_channel, num_channels,
+                 interleaved);
+}
+
+template <>
+void Interleave<float>(const float* const* deinterleaved,
+                       size_t samples_per_channel,
+                       size_t num_channels,
+                       float* interleaved) {
+  InterleaveImpl(deinterleaved, samples_per_channel, num_channels,
+                 interleaved);
+}
+
 template <>
 void DownmixInterleavedToMono<int16_t>(const int16_t* interleaved,
                                        size_t num_frames,
                                        int num_channels,
                                        int16_t* deinterleaved) {
+  if (num_channels == 2) {
+    // Stereo fast path: average the channel pairs eight frames at a time.
+    // The scalar code divides the int32 sum by two with truncation toward
+    // zero, which is matched below by adding the sign bit before the
+    // arithmetic shift, so the result is bit-exact.
+    size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    const __m128i ones = _mm_set1_epi16(1);
+    for (; i + 8 <= num_frames; i += 8) {
+      const __m128i ab = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(interleaved + 2 * i));
+      const __m128i cd = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(interleaved + 2 * i + 8));
+      __m128i sum_lo = _mm_madd_epi16(ab, ones);  // Four int32 L + R sums.
+      __m128i sum_hi = _mm_madd_epi16(cd, ones);
+      sum_lo = _mm_srai_epi32(
+          _mm_add_epi32(sum_lo, _mm_srli_epi32(sum_lo, 31)), 1);
+      sum_hi = _mm_srai_epi32(
+          _mm_add_epi32(sum_hi, _mm_srli_epi32(sum_hi, 31)), 1);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(deinterleaved + i),
+                       _mm_packs_epi32(sum_lo, sum_hi));
+    }
+#elif defined(WEBRTC_HAS_NEON)
+    for (; i + 8 <= num_frames; i += 8) {
+      const int16x8x2_t lr = vld2q_s16(interleaved + 2 * i);
+      int32x4_t sum_lo =
+          vaddl_s16(vget_low_s16(lr.val[0]), vget_low_s16(lr.val[1]));
+      int32x4_t sum_hi =
+          vaddl_s16(vget_high_s16(lr.val[0]), vget_high_s16(lr.val[1]));
+      sum_lo = vaddq_s32(sum_lo, vreinterpretq_s32_u32(vshrq_n_u32(
+                                     vreinterpretq_u32_s32(sum_lo), 31)));
+      sum_hi = vaddq_s32(sum_hi, vreinterpretq_s32_u32(vshrq_n_u32(
+                                     vreinterpretq_u32_s32(sum_hi), 31)));
+      vst1q_s16(deinterleaved + i,
+                vcombine_s16(vmovn_s32(vshrq_n_s32(sum_lo, 1)),
+                             vmovn_s32(vshrq_n_s32(sum_hi, 1))));
+    }
+#endif
+    for (; i < num_frames; ++i) {
+      deinterleaved[i] = (static_cast<int32_t>(interleaved[2 * i]) +
+                          interleaved[2 * i + 1]) /
+                         2;
+    }
+    return;
+  }
   DownmixInterleavedToMonoImpl<int16_t, int32_t>(interleaved, num_frames,
                                                  num_channels, deinterleaved);
 }
@@ -155,6 +155,45 @@ TEST(AudioUtilTest, InterleavingMonoIsIdentical) {
   ExpectArraysEq(mono, interleaved, kSamplesPerChannel);
 }
 
+// Uses a frame length that exercises both the vectorized stereo loops and
+// their scalar remainders, and verifies against the generic per-channel
+// copy.
+TEST(AudioUtilTest, InterleavingStereoMatchesGeneric) {
+  constexpr size_t kSamplesPerChannel = 19;
+  constexpr size_t kNumChannels = 2;
+  constexpr size_t kLength = kSamplesPerChannel * kNumChannels;
+  int16_t interleaved_int16[kLength];
+  float interleaved_float[kLength];
+  for (size_t i = 0; i < kLength; ++i) {
+    interleaved_int16[i] = static_cast<int16_t>(13 * i) - 100;
+    interleaved_float[i] = 0.5f * i - 10.f;
+  }
+
+  int16_t left_int16[kSamplesPerChannel], right_int16[kSamplesPerChannel];
+  int16_t* deinterleaved_int16[] = {left_int16, right_int16};
+  Deinterleave(interleaved_int16, kSamplesPerChannel, kNumChannels,
+               deinterleaved_int16);
+  float left_float[kSamplesPerChannel], right_float[kSamplesPerChannel];
+  float* deinterleaved_float[] = {left_float, right_float};
+  Deinterleave(interleaved_float, kSamplesPerChannel, kNumChannels,
+               deinterleaved_float);
+  for (size_t j = 0; j < kSamplesPerChannel; ++j) {
+    EXPECT_EQ(interleaved_int16[2 * j], left_int16[j]);
+    EXPECT_EQ(interleaved_int16[2 * j + 1], right_int16[j]);
+    EXPECT_EQ(interleaved_float[2 * j], left_float[j]);
+    EXPECT_EQ(interleaved_float[2 * j + 1], right_float[j]);
+  }
+
+  int16_t reinterleaved_int16[kLength];
+  Interleave(deinterleaved_int16, kSamplesPerChannel, kNumChannels,
+             reinterleaved_int16);
+  ExpectArraysEq(interleaved_int16, reinterleaved_int16, kLength);
+  float reinterleaved_float[kLength];
+  Interleave(deinterleaved_float, kSamplesPerChannel, kNumChannels,
+             reinterleaved_float);
+  ExpectArraysEq(interleaved_float, reinterleaved_float, kLength);
+}
+
 TEST(AudioUtilTest, DownmixInterleavedToMono) {
   {
     const size_t kNumFrames = 4;
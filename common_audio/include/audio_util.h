@@ -143,6 +143,31 @@ void Interleave(const T* const* deinterleaved,
   }
 }
 
+// Specializations of the two templates above with fast paths for the mono
+// and stereo cases; the stereo paths are vectorized. Defined in
+// audio_util.cc. The results are identical to those of the generic
+// implementations.
+template <>
+void Deinterleave<int16_t>(const int16_t* interleaved,
+                           size_t samples_per_channel,
+                           size_t num_channels,
+                           int16_t* const* deinterleaved);
+template <>
+void Deinterleave<float>(const float* interleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         float* const* deinterleaved);
+template <>
+void Interleave<int16_t>(const int16_t* const* deinterleaved,
+                         size_t samples_per_channel,
+                         size_t num_channels,
+                         int16_t* interleaved);
+template <>
+void Interleave<float>(const float* const* deinterleaved,
+                       size_t samples_per_channel,
+                       size_t num_channels,
+                       float* interleaved);
+
 // Copies audio from a single channel buffer pointed to by |mono| to each
 // channel of |interleaved|. There must be sufficient space allocated in
 // |interleaved| (|samples_per_channel| * |num_channels|).
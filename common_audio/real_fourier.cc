@@ -11,8 +11,10 @@
 #include "common_audio/real_fourier.h"
 
 #include "common_audio/real_fourier_ooura.h"
+#include "common_audio/real_fourier_simd.h"
 #include "common_audio/signal_processing/include/signal_processing_library.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
 
 namespace webrtc {
 
@@ -21,7 +23,11 @@ using std::complex;
 const size_t RealFourier::kFftBufferAlignment = 32;
 
 std::unique_ptr<RealFourier> RealFourier::Create(int fft_order) {
+#if defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
+  return std::unique_ptr<RealFourier>(new RealFourierSimd(fft_order));
+#else
   return std::unique_ptr<RealFourier>(new RealFourierOoura(fft_order));
+#endif
 }
 
 int RealFourier::FftOrder(size_t length) {
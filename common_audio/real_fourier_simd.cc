@@ -0,0 +1,213 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/real_fourier_simd.h"
+
+#include <cmath>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace webrtc {
+
+using std::complex;
+
+namespace {
+
+constexpr float kPi = 3.14159265358979323846f;
+
+std::unique_ptr<size_t[]> MakeBitReversal(size_t length) {
+  std::unique_ptr<size_t[]> table(new size_t[length]);
+  size_t reversed = 0;
+  for (size_t i = 0; i < length; ++i) {
+    table[i] = reversed;
+    // Increment |reversed| as a bit-reversed counter.
+    size_t bit = length >> 1;
+    while (bit != 0 && (reversed & bit) != 0) {
+      reversed ^= bit;
+      bit >>= 1;
+    }
+    reversed |= bit;
+  }
+  return table;
+}
+
+}  // namespace
+
+RealFourierSimd::RealFourierSimd(int fft_order)
+    : order_(fft_order),
+      length_(FftLength(order_)),
+      complex_length_(ComplexLength(order_)),
+      half_length_(length_ / 2),
+      bit_reversal_(MakeBitReversal(half_length_)),
+      stage_twiddle_re_(new float[half_length_ > 1 ? half_length_ - 1 : 1]),
+      stage_twiddle_im_(new float[half_length_ > 1 ? half_length_ - 1 : 1]),
+      real_twiddle_cos_(new float[half_length_]),
+      real_twiddle_sin_(new float[half_length_]),
+      work_re_(new float[half_length_]),
+      work_im_(new float[half_length_]) {
+  RTC_CHECK_GE(fft_order, 1);
+  for (size_t half = 1; half < half_length_; half *= 2) {
+    for (size_t j = 0; j < half; ++j) {
+      const float angle = kPi * j / half;
+      stage_twiddle_re_[half - 1 + j] = std::cos(angle);
+      stage_twiddle_im_[half - 1 + j] = std::sin(angle);
+    }
+  }
+  for (size_t k = 0; k < half_length_; ++k) {
+    const float angle = 2.f * kPi * k / length_;
+    real_twiddle_cos_[k] = std::cos(angle);
+    real_twiddle_sin_[k] = std::sin(angle);
+  }
+}
+
+RealFourierSimd::~RealFourierSimd() = default;
+
+void RealFourierSimd::ComplexFft(float* re, float* im, float fft_sign) const {
+  for (size_t i = 0; i < half_length_; ++i) {
+    const size_t j = bit_reversal_[i];
+    if (j > i) {
+      std::swap(re[i], re[j]);
+      std::swap(im[i], im[j]);
+    }
+  }
+
+  for (size_t half = 1; half < half_length_; half *= 2) {
+    const float* twiddle_re = &stage_twiddle_re_[half - 1];
+    const float* twiddle_im = &stage_twiddle_im_[half - 1];
+    for (size_t i = 0; i < half_length_; i += 2 * half) {
+      size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+      const __m128 sign = _mm_set1_ps(fft_sign);
+      for (; j + 4 <= half; j += 4) {
+        const __m128 wr = _mm_loadu_ps(twiddle_re + j);
+        const __m128 wi = _mm_mul_ps(sign, _mm_loadu_ps(twiddle_im + j));
+        const __m128 xr = _mm_loadu_ps(re + i + half + j);
+        const __m128 xi = _mm_loadu_ps(im + i + half + j);
+        const __m128 tr =
+            _mm_sub_ps(_mm_mul_ps(wr, xr), _mm_mul_ps(wi, xi));
+        const __m128 ti =
+            _mm_add_ps(_mm_mul_ps(wr, xi), _mm_mul_ps(wi, xr));
+        const __m128 yr = _mm_loadu_ps(re + i + j);
+        const __m128 yi = _mm_loadu_ps(im + i + j);
+        _mm_storeu_ps(re + i + half + j, _mm_sub_ps(yr, tr));
+        _mm_storeu_ps(im + i + half + j, _mm_sub_ps(yi, ti));
+        _mm_storeu_ps(re + i + j, _mm_add_ps(yr, tr));
+        _mm_storeu_ps(im + i + j, _mm_add_ps(yi, ti));
+      }
+#elif defined(WEBRTC_HAS_NEON)
+      const float32x4_t sign = vdupq_n_f32(fft_sign);
+      for (; j + 4 <= half; j += 4) {
+        const float32x4_t wr = vld1q_f32(twiddle_re + j);
+        const float32x4_t wi = vmulq_f32(sign, vld1q_f32(twiddle_im + j));
+        const float32x4_t xr = vld1q_f32(re + i + half + j);
+        const float32x4_t xi = vld1q_f32(im + i + half + j);
+        const float32x4_t tr = vsubq_f32(vmulq_f32(wr, xr), vmulq_f32(wi, xi));
+        const float32x4_t ti = vaddq_f32(vmulq_f32(wr, xi), vmulq_f32(wi, xr));
+        const float32x4_t yr = vld1q_f32(re + i + j);
+        const float32x4_t yi = vld1q_f32(im + i + j);
+        vst1q_f32(re + i + half + j, vsubq_f32(yr, tr));
+        vst1q_f32(im + i + half + j, vsubq_f32(yi, ti));
+        vst1q_f32(re + i + j, vaddq_f32(yr, tr));
+        vst1q_f32(im + i + j, vaddq_f32(yi, ti));
+      }
+#endif
+      for (; j < half; ++j) {
+        const float wr = twiddle_re[j];
+        const float wi = fft_sign * twiddle_im[j];
+        const float xr = re[i + half + j];
+        const float xi = im[i + half + j];
+        const float tr = wr * xr - wi * xi;
+        const float ti = wr * xi + wi * xr;
+        re[i + half + j] = re[i + j] - tr;
+        im[i + half + j] = im[i + j] - ti;
+        re[i + j] += tr;
+        im[i + j] += ti;
+      }
+    }
+  }
+}
+
+void RealFourierSimd::Forward(const float* src, complex<float>* dest) const {
+  float* const re = work_re_.get();
+  float* const im = work_im_.get();
+  for (size_t k = 0; k < half_length_; ++k) {
+    re[k] = src[2 * k];
+    im[k] = src[2 * k + 1];
+  }
+  ComplexFft(re, im, -1.f);
+
+  // Combine the half-length transform Z into the real transform X, using
+  // X[k] = Fe[k] + e^(-2*pi*i*k/N) * Fo[k] where Fe and Fo are the
+  // transforms of the even and odd samples:
+  //   Fe[k] = (Z[k] + conj(Z[M-k])) / 2,
+  //   Fo[k] = (Z[k] - conj(Z[M-k])) / (2i).
+  dest[0] = complex<float>(re[0] + im[0], 0.f);
+  dest[complex_length_ - 1] = complex<float>(re[0] - im[0], 0.f);
+  for (size_t k = 1; k < half_length_; ++k) {
+    const float ar = re[k];
+    const float ai = im[k];
+    const float br = re[half_length_ - k];
+    const float bi = im[half_length_ - k];
+    const float even_re = 0.5f * (ar + br);
+    const float even_im = 0.5f * (ai - bi);
+    const float odd_re = 0.5f * (ai + bi);
+    const float odd_im = 0.5f * (br - ar);
+    const float cn = real_twiddle_cos_[k];
+    const float sn = real_twiddle_sin_[k];
+    dest[k] = complex<float>(even_re + cn * odd_re + sn * odd_im,
+                             even_im + cn * odd_im - sn * odd_re);
+  }
+}
+
+void RealFourierSimd::Inverse(const complex<float>* src, float* dest) const {
+  float* const re = work_re_.get();
+  float* const im = work_im_.get();
+  // Invert the combination step of Forward() to recover the half-length
+  // transform Z[k] = Fe[k] + i * Fo[k].
+  re[0] = 0.5f * (src[0].real() + src[complex_length_ - 1].real());
+  im[0] = 0.5f * (src[0].real() - src[complex_length_ - 1].real());
+  for (size_t k = 1; k < half_length_; ++k) {
+    const float ar = src[k].real();
+    const float ai = src[k].imag();
+    const float br = src[half_length_ - k].real();
+    const float bi = src[half_length_ - k].imag();
+    const float even_re = 0.5f * (ar + br);
+    const float even_im = 0.5f * (ai - bi);
+    const float gr = 0.5f * (ar - br);
+    const float gi = 0.5f * (ai + bi);
+    const float cn = real_twiddle_cos_[k];
+    const float sn = real_twiddle_sin_[k];
+    const float odd_re = cn * gr - sn * gi;
+    const float odd_im = cn * gi + sn * gr;
+    re[k] = even_re - odd_im;
+    im[k] = even_im + odd_re;
+  }
+  ComplexFft(re, im, 1.f);
+
+  const float scale = 1.f / half_length_;
+  for (size_t k = 0; k < half_length_; ++k) {
+    dest[2 * k] = scale * re[k];
+    dest[2 * k + 1] = scale * im[k];
+  }
+}
+
+int RealFourierSimd::order() const {
+  return order_;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_AUDIO_REAL_FOURIER_SIMD_H_
+#define COMMON_AUDIO_REAL_FOURIER_SIMD_H_
+
+#include <stddef.h>
+
+#include <complex>
+#include <memory>
+
+#include "common_audio/real_fourier.h"
+
+namespace webrtc {
+
+// Vectorized RealFourier backend. The real transform of length N is computed
+// via a complex transform of length N/2 whose butterfly stages run on SSE2 or
+// NEON where available; all twiddle factors and the bit-reversal permutation
+// are precomputed at construction. Produces the same transform definition as
+// RealFourierOoura (up to floating point rounding).
+class RealFourierSimd : public RealFourier {
+ public:
+  explicit RealFourierSimd(int fft_order);
+  ~RealFourierSimd() override;
+
+  void Forward(const float* src, std::complex<float>* dest) const override;
+  void Inverse(const std::complex<float>* src, float* dest) const override;
+
+  int order() const override;
+
+ private:
+  // In-place complex transform of |half_length_| elements stored as split
+  // real/imaginary arrays. |fft_sign| is -1 for the forward transform and +1
+  // for the inverse; no scaling is applied.
+  void ComplexFft(float* re, float* im, float fft_sign) const;
+
+  const int order_;
+  const size_t length_;
+  const size_t complex_length_;
+  const size_t half_length_;
+  // Bit-reversal permutation for the half-length complex transform.
+  const std::unique_ptr<size_t[]> bit_reversal_;
+  // Per-stage butterfly twiddles, stored contiguously; the stage whose
+  // butterfly half-span is h occupies [h - 1, 2 * h - 1).
+  const std::unique_ptr<float[]> stage_twiddle_re_;
+  const std::unique_ptr<float[]> stage_twiddle_im_;
+  // cos/sin(2 * pi * k / N) used to combine the half-length transform into
+  // the real transform.
+  const std::unique_ptr<float[]> real_twiddle_cos_;
+  const std::unique_ptr<float[]> real_twiddle_sin_;
+  // Split real/imaginary work arrays for the half-length transform.
+  const std::unique_ptr<float[]> work_re_;
+  const std::unique_ptr<float[]> work_im_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_AUDIO_REAL_FOURIER_SIMD_H_
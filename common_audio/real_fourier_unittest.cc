@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include "common_audio/real_fourier_ooura.h"
+#include "common_audio/real_fourier_simd.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -67,7 +68,7 @@ class RealFourierTest : public ::testing::Test {
   const RealFourier::fft_cplx_scoper cplx_buffer_;
 };
 
-using FftTypes = ::testing::Types<RealFourierOoura>;
+using FftTypes = ::testing::Types<RealFourierOoura, RealFourierSimd>;
 TYPED_TEST_SUITE(RealFourierTest, FftTypes);
 
 TYPED_TEST(RealFourierTest, SimpleForwardTransform) {
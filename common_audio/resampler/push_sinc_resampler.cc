@@ -24,6 +24,8 @@ PushSincResampler::PushSincResampler(size_t source_frames,
                                    this)),
       source_ptr_(nullptr),
       source_ptr_int_(nullptr),
+      sources_ptr_(nullptr),
+      downmix_channels_(0),
       destination_frames_(destination_frames),
       first_pass_(true),
       source_available_(0) {}
@@ -77,6 +79,28 @@ size_t PushSincResampler::Resample(const float* source,
   return destination_frames_;
 }
 
+size_t PushSincResampler::ResampleDownmix(const float* const* sources,
+                                          size_t num_channels,
+                                          size_t source_length,
+                                          float* destination,
+                                          size_t destination_capacity) {
+  RTC_CHECK_EQ(source_length, resampler_->request_frames());
+  RTC_CHECK_GE(destination_capacity, destination_frames_);
+  RTC_CHECK_GE(num_channels, 1);
+  // Cache the source pointers; see Resample() above. The downmix happens in
+  // Run(), directly into the resampler's internal buffer.
+  sources_ptr_ = sources;
+  downmix_channels_ = num_channels;
+  source_available_ = source_length;
+
+  if (first_pass_)
+    resampler_->Resample(resampler_->ChunkSize(), destination);
+
+  resampler_->Resample(destination_frames_, destination);
+  sources_ptr_ = nullptr;
+  return destination_frames_;
+}
+
 void PushSincResampler::Run(size_t frames, float* destination) {
   // Ensure we are only asked for the available samples. This would fail if
   // Run() was triggered more than once per Resample() call.
@@ -90,7 +114,14 @@ void PushSincResampler::Run(size_t frames, float* destination) {
     return;
   }
 
-  if (source_ptr_) {
+  if (sources_ptr_) {
+    for (size_t i = 0; i < frames; ++i) {
+      float sum = sources_ptr_[0][i];
+      for (size_t c = 1; c < downmix_channels_; ++c)
+        sum += sources_ptr_[c][i];
+      destination[i] = sum / downmix_channels_;
+    }
+  } else if (source_ptr_) {
     std::memcpy(destination, source_ptr_, frames * sizeof(*destination));
   } else {
     for (size_t i = 0; i < frames; ++i)
@@ -47,6 +47,15 @@ class PushSincResampler : public SincResamplerCallback {
                   float* destination,
                   size_t destination_capacity);
 
+  // As Resample(), but reads its input as the average of the |num_channels|
+  // deinterleaved channels in |sources|. This fuses a downmix into the
+  // resampler's input read, avoiding an intermediate mono buffer.
+  size_t ResampleDownmix(const float* const* sources,
+                         size_t num_channels,
+                         size_t source_frames,
+                         float* destination,
+                         size_t destination_capacity);
+
   // Delay due to the filter kernel. Essentially, the time after which an input
   // sample will appear in the resampled output.
   static float AlgorithmicDelaySeconds(int source_rate_hz) {
@@ -65,6 +74,8 @@ class PushSincResampler : public SincResamplerCallback {
   std::unique_ptr<float[]> float_buffer_;
   const float* source_ptr_;
   const int16_t* source_ptr_int_;
+  const float* const* sources_ptr_;
+  size_t downmix_channels_;
   const size_t destination_frames_;
 
   // True on the first call to Resample(), to prime the SincResampler buffer.
@@ -161,6 +161,31 @@ TEST(SincResamplerTest, Convolve) {
       resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
       resampler.kernel_storage_.get(), kKernelInterpolationFactor);
   EXPECT_NEAR(result2, result, kEpsilon);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // Convolve_AVX2() uses FMA, so its rounding differs slightly from both
+  // Convolve_C() and Convolve_SSE(); use a slightly larger epsilon.
+  if (WebRtc_GetCPUInfo(kAVX2)) {
+    static const double kEpsilonAVX2 = 0.0000001;
+
+    result = resampler.Convolve_C(
+        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    result2 = resampler.Convolve_AVX2(
+        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    EXPECT_NEAR(result2, result, kEpsilonAVX2);
+
+    // Test Convolve() w/ unaligned input pointer.
+    result = resampler.Convolve_C(
+        resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    result2 = resampler.Convolve_AVX2(
+        resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    EXPECT_NEAR(result2, result, kEpsilonAVX2);
+  }
+#endif
 }
 #endif
 
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+/* SSE2 version of WebRtcSpl_CrossCorrelation(). Unlike the NEON version,
+ * every 32 bit product is shifted before accumulation, just as in the C
+ * version, so the result is bit-exact with WebRtcSpl_CrossCorrelationC(). */
+void WebRtcSpl_CrossCorrelationSse2(int32_t* cross_correlation,
+                                    const int16_t* seq1,
+                                    const int16_t* seq2,
+                                    size_t dim_seq,
+                                    size_t dim_cross_correlation,
+                                    int right_shifts,
+                                    int step_seq2) {
+  size_t i, j;
+  const __m128i shift = _mm_cvtsi32_si128(right_shifts);
+
+  for (i = 0; i < dim_cross_correlation; i++) {
+    const int16_t* seq2_ptr = seq2 + step_seq2 * (int)i;
+    __m128i sum = _mm_setzero_si128();
+    int32_t corr;
+
+    for (j = 0; j + 8 <= dim_seq; j += 8) {
+      const __m128i a =
+          _mm_loadu_si128((const __m128i*)(seq1 + j));
+      const __m128i b =
+          _mm_loadu_si128((const __m128i*)(seq2_ptr + j));
+      /* Expand the eight 16x16 bit products to 32 bits. */
+      const __m128i lo = _mm_mullo_epi16(a, b);
+      const __m128i hi = _mm_mulhi_epi16(a, b);
+      const __m128i prod0 = _mm_sra_epi32(_mm_unpacklo_epi16(lo, hi), shift);
+      const __m128i prod1 = _mm_sra_epi32(_mm_unpackhi_epi16(lo, hi), shift);
+      sum = _mm_add_epi32(sum, _mm_add_epi32(prod0, prod1));
+    }
+
+    /* Horizontal sum of the accumulator. */
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    corr = _mm_cvtsi128_si32(sum);
+
+    for (; j < dim_seq; j++) {
+      corr += (seq1[j] * seq2_ptr[j]) >> right_shifts;
+    }
+    cross_correlation[i] = corr;
+  }
+}
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <stddef.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/checks.h"
+
+/* Reverses the order of the eight 16-bit lanes in |x|. */
+static __m128i Reverse16Lanes(__m128i x) {
+  x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+  x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(0, 1, 2, 3));
+  return _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+/* SSE2 version of WebRtcSpl_DownsampleFast(). The filter taps are applied
+ * eight at a time with _mm_madd_epi16(); since both the products and the
+ * pairwise sums wrap in 32 bits exactly like the C accumulation does, the
+ * result is bit-exact with WebRtcSpl_DownsampleFastC(). */
+int WebRtcSpl_DownsampleFastSse2(const int16_t* data_in,
+                                 size_t data_in_length,
+                                 int16_t* data_out,
+                                 size_t data_out_length,
+                                 const int16_t* __restrict coefficients,
+                                 size_t coefficients_length,
+                                 int factor,
+                                 size_t delay) {
+  int16_t* const original_data_out = data_out;
+  size_t i = 0;
+  size_t j = 0;
+  int32_t out_s32 = 0;
+  size_t endpos = delay + factor * (data_out_length - 1) + 1;
+
+  /* Return error if any of the running conditions doesn't meet. */
+  if (data_out_length == 0 || coefficients_length == 0 ||
+      data_in_length < endpos) {
+    return -1;
+  }
+
+  for (i = delay; i < endpos; i += factor) {
+    __m128i acc = _mm_setzero_si128();
+    out_s32 = 2048;  /* Round value, 0.5 in Q12. */
+
+    for (j = 0; j + 8 <= coefficients_length; j += 8) {
+      const __m128i coef =
+          _mm_loadu_si128((const __m128i*)(coefficients + j));
+      /* The data is accessed in reverse order relative to the coefficients;
+       * load data_in[i - j - 7 .. i - j] and flip it. */
+      const __m128i data = Reverse16Lanes(_mm_loadu_si128(
+          (const __m128i*)(data_in + (ptrdiff_t)i - (ptrdiff_t)j - 7)));
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(coef, data));
+    }
+
+    /* Horizontal sum of the accumulator. */
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    out_s32 += _mm_cvtsi128_si32(acc);
+
+    for (; j < coefficients_length; j++) {
+      /* Negative overflow is permitted here, because this is
+       * auto-regressive filters, and the state for each batch run is
+       * stored in the "negative" positions of the output vector. */
+      out_s32 += coefficients[j] * data_in[(ptrdiff_t)i - (ptrdiff_t)j];
+    }
+
+    out_s32 >>= 12;  /* Q0. */
+
+    /* Saturate and store the output. */
+    *data_out++ = WebRtcSpl_SatW32ToW16(out_s32);
+  }
+
+  RTC_DCHECK_EQ(original_data_out + data_out_length, data_out);
+
+  return 0;
+}
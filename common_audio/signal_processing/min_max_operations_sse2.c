@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+#include <stdlib.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/checks.h"
+
+/* Maximum absolute value of word16 vector. SSE2 intrinsics version, bit-exact
+ * with WebRtcSpl_MaxAbsValueW16C(). The saturating negation in
+ * _mm_subs_epi16() turns -32768 into 32767, which matches the guard for
+ * abs(-32768) in the C version. */
+int16_t WebRtcSpl_MaxAbsValueW16Sse2(const int16_t* vector, size_t length) {
+  size_t i = 0;
+  int absolute = 0, maximum = 0;
+  const __m128i zero = _mm_setzero_si128();
+  __m128i max_vec = _mm_setzero_si128();
+
+  RTC_DCHECK_GT(length, 0);
+
+  for (i = 0; i + 8 <= length; i += 8) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(vector + i));
+    const __m128i abs_x = _mm_max_epi16(x, _mm_subs_epi16(zero, x));
+    max_vec = _mm_max_epi16(max_vec, abs_x);
+  }
+
+  /* Horizontal maximum of the eight lanes. */
+  max_vec = _mm_max_epi16(max_vec,
+                          _mm_shuffle_epi32(max_vec, _MM_SHUFFLE(1, 0, 3, 2)));
+  max_vec = _mm_max_epi16(max_vec,
+                          _mm_shuffle_epi32(max_vec, _MM_SHUFFLE(2, 3, 0, 1)));
+  max_vec = _mm_max_epi16(
+      max_vec, _mm_shufflelo_epi16(max_vec, _MM_SHUFFLE(2, 3, 0, 1)));
+  maximum = (int16_t)_mm_cvtsi128_si32(max_vec);
+
+  for (; i < length; i++) {
+    absolute = abs((int)vector[i]);
+
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  /* Guard the case for abs(-32768). */
+  if (maximum > WEBRTC_SPL_WORD16_MAX) {
+    maximum = WEBRTC_SPL_WORD16_MAX;
+  }
+
+  return (int16_t)maximum;
+}
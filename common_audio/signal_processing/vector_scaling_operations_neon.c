@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+/* NEON version of WebRtcSpl_ScaleAndAddVectorsWithRound(). Bit-exact with
+ * the C version. */
+int WebRtcSpl_ScaleAndAddVectorsWithRoundNeon(const int16_t* in_vector1,
+                                              int16_t in_vector1_scale,
+                                              const int16_t* in_vector2,
+                                              int16_t in_vector2_scale,
+                                              int right_shifts,
+                                              int16_t* out_vector,
+                                              size_t length) {
+  size_t i = 0;
+  const int round_value = (1 << right_shifts) >> 1;
+  const int16x4_t gain1 = vdup_n_s16(in_vector1_scale);
+  const int16x4_t gain2 = vdup_n_s16(in_vector2_scale);
+  const int32x4_t round = vdupq_n_s32(round_value);
+  const int32x4_t shift = vdupq_n_s32(-right_shifts);
+
+  if (in_vector1 == NULL || in_vector2 == NULL || out_vector == NULL ||
+      length == 0 || right_shifts < 0) {
+    return -1;
+  }
+
+  for (; i + 8 <= length; i += 8) {
+    const int16x8_t a = vld1q_s16(in_vector1 + i);
+    const int16x8_t b = vld1q_s16(in_vector2 + i);
+    int32x4_t sum0 =
+        vmlal_s16(vmull_s16(vget_low_s16(a), gain1), vget_low_s16(b), gain2);
+    int32x4_t sum1 =
+        vmlal_s16(vmull_s16(vget_high_s16(a), gain1), vget_high_s16(b), gain2);
+    sum0 = vshlq_s32(vaddq_s32(sum0, round), shift);
+    sum1 = vshlq_s32(vaddq_s32(sum1, round), shift);
+    /* vmovn truncates to 16 bits with the same wrap-around behavior as the
+     * cast in the C version. */
+    vst1q_s16(out_vector + i, vcombine_s16(vmovn_s32(sum0), vmovn_s32(sum1)));
+  }
+
+  for (; i < length; i++) {
+    out_vector[i] =
+        (int16_t)((in_vector1[i] * in_vector1_scale +
+                   in_vector2[i] * in_vector2_scale + round_value) >>
+                  right_shifts);
+  }
+
+  return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+/* SSE2 version of WebRtcSpl_ScaleAndAddVectorsWithRound(). Bit-exact with
+ * the C version. */
+int WebRtcSpl_ScaleAndAddVectorsWithRoundSse2(const int16_t* in_vector1,
+                                              int16_t in_vector1_scale,
+                                              const int16_t* in_vector2,
+                                              int16_t in_vector2_scale,
+                                              int right_shifts,
+                                              int16_t* out_vector,
+                                              size_t length) {
+  size_t i = 0;
+  const int round_value = (1 << right_shifts) >> 1;
+  const __m128i gain1 = _mm_set1_epi16(in_vector1_scale);
+  const __m128i gain2 = _mm_set1_epi16(in_vector2_scale);
+  const __m128i round = _mm_set1_epi32(round_value);
+  const __m128i shift = _mm_cvtsi32_si128(right_shifts);
+
+  if (in_vector1 == NULL || in_vector2 == NULL || out_vector == NULL ||
+      length == 0 || right_shifts < 0) {
+    return -1;
+  }
+
+  for (; i + 8 <= length; i += 8) {
+    const __m128i a =
+        _mm_loadu_si128((const __m128i*)(in_vector1 + i));
+    const __m128i b =
+        _mm_loadu_si128((const __m128i*)(in_vector2 + i));
+    /* Expand the 16x16 bit products to 32 bits. */
+    const __m128i a_lo = _mm_mullo_epi16(a, gain1);
+    const __m128i a_hi = _mm_mulhi_epi16(a, gain1);
+    const __m128i b_lo = _mm_mullo_epi16(b, gain2);
+    const __m128i b_hi = _mm_mulhi_epi16(b, gain2);
+    __m128i sum0 = _mm_add_epi32(_mm_unpacklo_epi16(a_lo, a_hi),
+                                 _mm_unpacklo_epi16(b_lo, b_hi));
+    __m128i sum1 = _mm_add_epi32(_mm_unpackhi_epi16(a_lo, a_hi),
+                                 _mm_unpackhi_epi16(b_lo, b_hi));
+    sum0 = _mm_sra_epi32(_mm_add_epi32(sum0, round), shift);
+    sum1 = _mm_sra_epi32(_mm_add_epi32(sum1, round), shift);
+    /* Truncate to 16 bits with the same wrap-around behavior as the cast in
+     * the C version; after the sign extension the pack is lossless. */
+    sum0 = _mm_srai_epi32(_mm_slli_epi32(sum0, 16), 16);
+    sum1 = _mm_srai_epi32(_mm_slli_epi32(sum1, 16), 16);
+    _mm_storeu_si128((__m128i*)(out_vector + i), _mm_packs_epi32(sum0, sum1));
+  }
+
+  for (; i < length; i++) {
+    out_vector[i] =
+        (int16_t)((in_vector1[i] * in_vector1_scale +
+                   in_vector2[i] * in_vector2_scale + round_value) >>
+                  right_shifts);
+  }
+
+  return 0;
+}
@@ -10,6 +10,8 @@
 
 #include "common_audio/vad/vad_core.h"
 
+#include <string.h>
+
 #include "rtc_base/sanitizer.h"
 #include "common_audio/signal_processing/include/signal_processing_library.h"
 #include "common_audio/vad/vad_filterbank.h"
@@ -152,6 +154,8 @@ static int16_t GmmProbability(VadInstT* self, int16_t* features,
   int32_t sum_log_likelihood_ratios = 0;
   int32_t noise_global_mean, speech_global_mean;
   int32_t noise_probability[kNumGaussians], speech_probability[kNumGaussians];
+  int16_t batch_features[kTableSize];
+  int32_t noise_probabilities[kTableSize], speech_probabilities[kTableSize];
   int16_t overhead1, overhead2, individualTest, totalTest;
 
   // Set various thresholds based on frame lengths (80, 160 or 240 samples).
@@ -184,30 +188,38 @@ static int16_t GmmProbability(VadInstT* self, int16_t* features,
     //
     // We combine a global LRT with local tests, for each frequency sub-band,
     // here defined as |channel|.
+
+    // For each channel we model the probability with a GMM consisting of
+    // |kNumGaussians|, with different means and standard deviations depending
+    // on H0 or H1. All Gaussians of both hypotheses are evaluated in one
+    // batch; the model arrays are already laid out per Gaussian, so the
+    // feature vector is simply repeated |kNumGaussians| times.
+    for (k = 0; k < kNumGaussians; k++) {
+      memcpy(&batch_features[k * kNumChannels], features,
+             kNumChannels * sizeof(features[0]));
+    }
+    WebRtcVad_GaussianProbabilityBatch(batch_features, self->noise_means,
+                                       self->noise_stds, kTableSize,
+                                       noise_probabilities, deltaN);
+    WebRtcVad_GaussianProbabilityBatch(batch_features, self->speech_means,
+                                       self->speech_stds, kTableSize,
+                                       speech_probabilities, deltaS);
+
     for (channel = 0; channel < kNumChannels; channel++) {
-      // For each channel we model the probability with a GMM consisting of
-      // |kNumGaussians|, with different means and standard deviations depending
-      // on H0 or H1.
       h0_test = 0;
       h1_test = 0;
       for (k = 0; k < kNumGaussians; k++) {
         gaussian = channel + k * kNumChannels;
         // Probability under H0, that is, probability of frame being noise.
         // Value given in Q27 = Q7 * Q20.
-        tmp1_s32 = WebRtcVad_GaussianProbability(features[channel],
-                                                 self->noise_means[gaussian],
-                                                 self->noise_stds[gaussian],
-                                                 &deltaN[gaussian]);
-        noise_probability[k] = kNoiseDataWeights[gaussian] * tmp1_s32;
+        noise_probability[k] =
+            kNoiseDataWeights[gaussian] * noise_probabilities[gaussian];
         h0_test += noise_probability[k];  // Q27
 
         // Probability under H1, that is, probability of frame being speech.
         // Value given in Q27 = Q7 * Q20.
-        tmp1_s32 = WebRtcVad_GaussianProbability(features[channel],
-                                                 self->speech_means[gaussian],
-                                                 self->speech_stds[gaussian],
-                                                 &deltaS[gaussian]);
-        speech_probability[k] = kSpeechDataWeights[gaussian] * tmp1_s32;
+        speech_probability[k] =
+            kSpeechDataWeights[gaussian] * speech_probabilities[gaussian];
         h1_test += speech_probability[k];  // Q27
       }
 
@@ -11,6 +11,11 @@
 #include "common_audio/vad/vad_gmm.h"
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
 
 static const int32_t kCompVar = 22005;
 static const int16_t kLog2Exp = 5909;  // log2(exp(1)) in Q12.
@@ -80,3 +85,28 @@ int32_t WebRtcVad_GaussianProbability(int16_t input,
   // Q-domain: Q10 * Q10 = Q20.
   return inv_std * exp_value;
 }
+
+void WebRtcVad_GaussianProbabilityBatch(const int16_t* inputs,
+                                        const int16_t* means,
+                                        const int16_t* stds,
+                                        size_t count,
+                                        int32_t* probabilities,
+                                        int16_t* deltas) {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // The CPU does not change under us, so the benign race on first use is
+  // harmless; every thread writes the same value.
+  static int use_avx2 = -1;
+  if (use_avx2 == -1) {
+    use_avx2 = WebRtc_GetCPUInfo(kAVX2);
+  }
+  if (use_avx2) {
+    i = WebRtcVad_GaussianProbabilityAVX2(inputs, means, stds, count,
+                                          probabilities, deltas);
+  }
+#endif
+  for (; i < count; i++) {
+    probabilities[i] =
+        WebRtcVad_GaussianProbability(inputs[i], means[i], stds[i], &deltas[i]);
+  }
+}
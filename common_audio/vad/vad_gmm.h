@@ -13,8 +13,11 @@
 #ifndef COMMON_AUDIO_VAD_VAD_GMM_H_
 #define COMMON_AUDIO_VAD_VAD_GMM_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "rtc_base/system/arch.h"
+
 // Calculates the probability for |input|, given that |input| comes from a
 // normal distribution with mean and standard deviation (|mean|, |std|).
 //
@@ -36,4 +39,27 @@ int32_t WebRtcVad_GaussianProbability(int16_t input,
                                       int16_t std,
                                       int16_t* delta);
 
+// Evaluates |count| Gaussians in one call; element |i| gives the same result
+// as WebRtcVad_GaussianProbability(inputs[i], means[i], stds[i], &deltas[i]).
+// Uses a vectorized kernel where available; results are bit-exact with the
+// scalar function.
+void WebRtcVad_GaussianProbabilityBatch(const int16_t* inputs,
+                                        const int16_t* means,
+                                        const int16_t* stds,
+                                        size_t count,
+                                        int32_t* probabilities,
+                                        int16_t* deltas);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// AVX2 kernel used by WebRtcVad_GaussianProbabilityBatch(). Processes the
+// largest multiple of eight elements and returns the number handled; the
+// caller computes the remaining tail.
+size_t WebRtcVad_GaussianProbabilityAVX2(const int16_t* inputs,
+                                         const int16_t* means,
+                                         const int16_t* stds,
+                                         size_t count,
+                                         int32_t* probabilities,
+                                         int16_t* deltas);
+#endif
+
 #endif  // COMMON_AUDIO_VAD_VAD_GMM_H_
@@ -0,0 +1,106 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "common_audio/vad/vad_gmm.h"
+
+// See vad_gmm.c for the scalar reference implementation and the Q-domain
+// comments; this file evaluates eight Gaussians per iteration with identical
+// fixed-point arithmetic. The int16 wraparounds of the scalar code are
+// reproduced by sign-extending the low 16 bits of the 32-bit lanes.
+
+// Sign-extends the low 16 bits of each 32-bit lane.
+static __m256i SignExtend16(__m256i x) {
+  return _mm256_srai_epi32(_mm256_slli_epi32(x, 16), 16);
+}
+
+size_t WebRtcVad_GaussianProbabilityAVX2(const int16_t* inputs,
+                                         const int16_t* means,
+                                         const int16_t* stds,
+                                         size_t count,
+                                         int32_t* probabilities,
+                                         int16_t* deltas) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i k131072 = _mm256_set1_epi32(131072);
+  const __m256i kCompVar = _mm256_set1_epi32(22005);
+  const __m256i kLog2Exp = _mm256_set1_epi32(5909);
+  size_t i = 0;
+
+  for (; i + 8 <= count; i += 8) {
+    const __m256i std32 =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(stds + i)));
+    const __m256i mean32 =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(means + i)));
+    const __m256i input32 =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(inputs + i)));
+
+    // |inv_std| = (131072 + (std >> 1)) / std, in Q10. The float division is
+    // truncated and then corrected by at most one step, which makes the
+    // quotient exact for all positive |std|.
+    const __m256i num = _mm256_add_epi32(k131072, _mm256_srai_epi32(std32, 1));
+    __m256i q = _mm256_cvttps_epi32(
+        _mm256_div_ps(_mm256_cvtepi32_ps(num), _mm256_cvtepi32_ps(std32)));
+    const __m256i rem = _mm256_sub_epi32(num, _mm256_mullo_epi32(q, std32));
+    q = _mm256_add_epi32(q, _mm256_cmpgt_epi32(zero, rem));  // rem < 0: q - 1.
+    q = _mm256_sub_epi32(
+        q, _mm256_cmpgt_epi32(rem, _mm256_sub_epi32(std32, one)));
+    // Match the division-by-zero guard in WebRtcSpl_DivW32W16().
+    const __m256i std_is_zero = _mm256_cmpeq_epi32(std32, zero);
+    q = _mm256_blendv_epi8(q, _mm256_set1_epi32(0x7FFFFFFF), std_is_zero);
+    const __m256i inv_std = SignExtend16(q);
+
+    // |inv_std2| = 1 / s^2, in Q14.
+    const __m256i tmp = _mm256_srai_epi32(inv_std, 2);
+    const __m256i inv_std2 =
+        SignExtend16(_mm256_srai_epi32(_mm256_mullo_epi32(tmp, tmp), 2));
+
+    // |x| = input in Q7 minus the mean, with int16 wraparound.
+    const __m256i x = SignExtend16(_mm256_sub_epi32(
+        SignExtend16(_mm256_slli_epi32(input32, 3)), mean32));
+
+    // |delta| = (x - m) / s^2, in Q11.
+    const __m256i delta =
+        SignExtend16(_mm256_srai_epi32(_mm256_mullo_epi32(inv_std2, x), 10));
+
+    // Exponent (x - m)^2 / (2 * s^2), in Q10.
+    const __m256i exponent =
+        _mm256_srai_epi32(_mm256_mullo_epi32(delta, x), 9);
+
+    // |exp_value| ~= exp(-exponent) in Q10, zero where the exponent is too
+    // large to give a non-zero probability.
+    const __m256i small_exponent = _mm256_cmpgt_epi32(kCompVar, exponent);
+    const __m256i t = SignExtend16(_mm256_srai_epi32(
+        _mm256_mullo_epi32(kLog2Exp, exponent), 12));
+    __m256i exp_value = _mm256_or_si256(
+        _mm256_set1_epi32(0x0400),
+        _mm256_and_si256(_mm256_sub_epi32(zero, t), _mm256_set1_epi32(0x03FF)));
+    // The scalar code can produce out-of-range (even negative) shift counts
+    // when the intermediate products have wrapped; x86 masks the count with
+    // 31, which is reproduced here to stay bit-exact.
+    const __m256i shift = _mm256_and_si256(
+        _mm256_add_epi32(_mm256_srai_epi32(_mm256_sub_epi32(t, one), 10), one),
+        _mm256_set1_epi32(31));
+    exp_value = _mm256_srlv_epi32(exp_value, shift);
+    exp_value = _mm256_and_si256(exp_value, small_exponent);
+
+    _mm256_storeu_si256((__m256i*)(probabilities + i),
+                        _mm256_mullo_epi32(inv_std, exp_value));
+
+    // Truncating pack of |delta| to int16; the lanes are already in int16
+    // range, so the saturating pack is exact.
+    const __m256i packed = _mm256_permute4x64_epi64(
+        _mm256_packs_epi32(delta, delta), 0xD8);
+    _mm_storeu_si128((__m128i*)(deltas + i), _mm256_castsi256_si128(packed));
+  }
+
+  return i;
+}
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include <limits>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+EncodedImageBufferPool::EncodedImageBufferPool()
+    : EncodedImageBufferPool(std::numeric_limits<size_t>::max()) {}
+EncodedImageBufferPool::EncodedImageBufferPool(size_t max_number_of_buffers)
+    : max_number_of_buffers_(max_number_of_buffers) {}
+EncodedImageBufferPool::~EncodedImageBufferPool() = default;
+
+void EncodedImageBufferPool::Release() {
+  buffers_.clear();
+}
+
+rtc::scoped_refptr<EncodedImageBuffer> EncodedImageBufferPool::CreateBuffer(
+    size_t capacity) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  // Look for a free buffer. If the buffer is in use, the ref count will be
+  // >= 2, one from the list we are looping over and one from the application.
+  // If the ref count is 1, then the list we are looping over holds the only
+  // reference and it's safe to reuse.
+  rtc::scoped_refptr<PooledBuffer> free_buffer;
+  for (const rtc::scoped_refptr<PooledBuffer>& buffer : buffers_) {
+    if (!buffer->HasOneRef())
+      continue;
+    if (buffer->size() >= capacity)
+      return buffer;
+    // Too small; keep the largest free buffer as a candidate for growing.
+    if (!free_buffer || buffer->size() > free_buffer->size())
+      free_buffer = buffer;
+  }
+  if (free_buffer) {
+    free_buffer->Realloc(capacity);
+    return free_buffer;
+  }
+
+  if (buffers_.size() >= max_number_of_buffers_)
+    return nullptr;
+  // Allocate new buffer.
+  rtc::scoped_refptr<PooledBuffer> buffer = new PooledBuffer(capacity);
+  buffers_.push_back(buffer);
+  return buffer;
+}
+
+}  // namespace webrtc
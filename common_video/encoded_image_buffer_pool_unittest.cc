@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include <stdint.h>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(TestEncodedImageBufferPool, SimpleBufferReuse) {
+  EncodedImageBufferPool pool;
+  auto buffer = pool.CreateBuffer(1000);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 1000u);
+  // Extract non-refcounted pointer for testing.
+  const uint8_t* data_ptr = buffer->data();
+  // Release buffer so that it is returned to the pool.
+  buffer = nullptr;
+  // Check that the memory is reused.
+  buffer = pool.CreateBuffer(1000);
+  EXPECT_EQ(data_ptr, buffer->data());
+}
+
+TEST(TestEncodedImageBufferPool, ReusesLargerBufferForSmallerRequest) {
+  EncodedImageBufferPool pool;
+  auto buffer = pool.CreateBuffer(1000);
+  rtc::scoped_refptr<EncodedImageBuffer> same_buffer = buffer;
+  buffer = nullptr;
+  same_buffer = nullptr;
+  // A smaller request should be served by the existing free buffer.
+  buffer = pool.CreateBuffer(100);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 1000u);
+}
+
+TEST(TestEncodedImageBufferPool, GrowsFreeBufferInPlace) {
+  EncodedImageBufferPool pool;
+  auto buffer = pool.CreateBuffer(100);
+  buffer = nullptr;
+  // A larger request reuses the pooled entry and grows it instead of
+  // allocating a second buffer.
+  buffer = pool.CreateBuffer(1000);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 1000u);
+  buffer = nullptr;
+  const uint8_t* data_ptr = pool.CreateBuffer(1000)->data();
+  EXPECT_EQ(data_ptr, pool.CreateBuffer(1000)->data());
+}
+
+TEST(TestEncodedImageBufferPool, BuffersInUseNotReused) {
+  EncodedImageBufferPool pool;
+  auto buffer1 = pool.CreateBuffer(1000);
+  auto buffer2 = pool.CreateBuffer(1000);
+  EXPECT_NE(buffer1->data(), buffer2->data());
+}
+
+TEST(TestEncodedImageBufferPool, MaxNumberOfBuffers) {
+  EncodedImageBufferPool pool(1);
+  auto buffer1 = pool.CreateBuffer(1000);
+  EXPECT_FALSE(pool.CreateBuffer(1000));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+#define COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+
+#include <stddef.h>
+
+#include <list>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace webrtc {
+
+// Simple buffer pool to avoid allocating a fresh EncodedImageBuffer for every
+// encoded frame. The pool keeps the buffers returned from CreateBuffer alive;
+// once all external references to a buffer are dropped, it becomes available
+// for reuse by a subsequent CreateBuffer call. Buffers are grown in place when
+// a larger capacity is requested, so after a few frames the pool converges on
+// the recent frame sizes and stops hitting the heap altogether.
+class EncodedImageBufferPool {
+ public:
+  EncodedImageBufferPool();
+  explicit EncodedImageBufferPool(size_t max_number_of_buffers);
+  ~EncodedImageBufferPool();
+
+  // Returns a buffer with at least |capacity| bytes from the pool. If no
+  // suitable buffer exists and there are less than |max_number_of_buffers|
+  // pending, a buffer is created. Returns null otherwise.
+  rtc::scoped_refptr<EncodedImageBuffer> CreateBuffer(size_t capacity);
+
+  // Clears the pool and frees all pooled buffers that are no longer
+  // referenced.
+  void Release();
+
+ private:
+  // Explicitly use a RefCountedObject to get access to HasOneRef, needed by
+  // the pool to check exclusive access.
+  using PooledBuffer = rtc::RefCountedObject<EncodedImageBuffer>;
+
+  rtc::RaceChecker race_checker_;
+  std::list<rtc::scoped_refptr<PooledBuffer>> buffers_;
+  // Max number of buffers this pool can have pending.
+  const size_t max_number_of_buffers_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
@@ -25,9 +25,14 @@ namespace webrtc {
 
 class IncomingVideoStream : public rtc::VideoSinkInterface<VideoFrame> {
  public:
+  // If |direct_render| is set, OnFrame hands frames to |callback|
+  // synchronously on the decoder thread, bypassing the render queue and its
+  // delivery granularity. Only use this for wait-free sinks; a slow sink
+  // would block the decoder.
   IncomingVideoStream(TaskQueueFactory* task_queue_factory,
                       int32_t delay_ms,
-                      rtc::VideoSinkInterface<VideoFrame>* callback);
+                      rtc::VideoSinkInterface<VideoFrame>* callback,
+                      bool direct_render = false);
   ~IncomingVideoStream() override;
 
  private:
@@ -39,6 +44,7 @@ class IncomingVideoStream : public rtc::VideoSinkInterface<VideoFrame> {
 
   VideoRenderFrames render_buffers_;  // Only touched on the TaskQueue.
   rtc::VideoSinkInterface<VideoFrame>* const callback_;
+  const bool direct_render_;
   rtc::TaskQueue incoming_render_queue_;
 };
 
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_VIDEO_FRAME_BUFFER_POOL_H_
+#define COMMON_VIDEO_INCLUDE_VIDEO_FRAME_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <list>
+#include <map>
+#include <memory>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "rtc_base/memory/aligned_malloc.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace webrtc {
+
+class VideoFrameBufferPool;
+
+// A mutable I420 buffer whose memory is owned by a VideoFrameBufferPool. The
+// allocation is sized to the pool's capacity bucket rather than to the exact
+// resolution, so the same buffer can be handed out again at a different
+// resolution with a similar footprint.
+class PooledI420Buffer : public I420BufferInterface {
+ public:
+  int width() const override;
+  int height() const override;
+  const uint8_t* DataY() const override;
+  const uint8_t* DataU() const override;
+  const uint8_t* DataV() const override;
+  int StrideY() const override;
+  int StrideU() const override;
+  int StrideV() const override;
+
+  uint8_t* MutableDataY();
+  uint8_t* MutableDataU();
+  uint8_t* MutableDataV();
+
+ protected:
+  PooledI420Buffer(int width, int height, size_t capacity);
+  ~PooledI420Buffer() override;
+
+ private:
+  friend class VideoFrameBufferPool;
+  friend class rtc::RefCountedObject<PooledI420Buffer>;
+
+  // Changes the resolution of the buffer in place. May only be called by the
+  // pool, when it holds the only reference.
+  void Reformat(int width, int height);
+
+  int width_;
+  int height_;
+  const size_t capacity_;
+  std::unique_ptr<uint8_t, AlignedFreeDeleter> data_;
+};
+
+// A mutable NV12 buffer (planar Y followed by interleaved UV) whose memory is
+// owned by a VideoFrameBufferPool. NV12 is what most capture pipelines and
+// hardware codecs speak natively. The VideoFrameBuffer API has no NV12 type,
+// so the buffer is reported as Type::kNative and ToI420() converts; producers
+// and sinks that understand NV12 cast to this class and use the plane
+// accessors directly, skipping the conversion.
+class PooledNV12Buffer : public VideoFrameBuffer {
+ public:
+  Type type() const override;
+  int width() const override;
+  int height() const override;
+  rtc::scoped_refptr<I420BufferInterface> ToI420() override;
+
+  const uint8_t* DataY() const;
+  const uint8_t* DataUV() const;
+  int StrideY() const;
+  int StrideUV() const;
+
+  uint8_t* MutableDataY();
+  uint8_t* MutableDataUV();
+
+ protected:
+  PooledNV12Buffer(int width, int height, size_t capacity);
+  ~PooledNV12Buffer() override;
+
+ private:
+  friend class VideoFrameBufferPool;
+  friend class rtc::RefCountedObject<PooledNV12Buffer>;
+
+  // See PooledI420Buffer::Reformat.
+  void Reformat(int width, int height);
+
+  int width_;
+  int height_;
+  const size_t capacity_;
+  std::unique_ptr<uint8_t, AlignedFreeDeleter> data_;
+};
+
+// Generalization of I420BufferPool that also pools NV12 buffers and allows a
+// released buffer to be reused at a different resolution. Buffers are kept in
+// free lists bucketed by allocation capacity (rounded up to the next power of
+// two), so a request only scans the few in-flight buffers of its own
+// footprint instead of the whole pool, and a simulcast resize reuses the
+// existing allocations instead of purging them.
+// The pool manages the memory of the returned buffers; when a buffer loses
+// its last external reference it becomes available for reuse. Buffers stay
+// valid if they outlive the pool.
+class VideoFrameBufferPool {
+ public:
+  VideoFrameBufferPool();
+  explicit VideoFrameBufferPool(bool zero_initialize);
+  VideoFrameBufferPool(bool zero_initialize, size_t max_number_of_buffers);
+  ~VideoFrameBufferPool();
+
+  // Returns a buffer from the pool, with the default strides (StrideY ==
+  // width, chroma strides (width + 1) / 2). If no suitable buffer exists in
+  // the pool and less than |max_number_of_buffers| are pending, a buffer is
+  // created. Returns null otherwise.
+  rtc::scoped_refptr<PooledI420Buffer> CreateI420Buffer(int width, int height);
+  rtc::scoped_refptr<PooledNV12Buffer> CreateNV12Buffer(int width, int height);
+
+  // Clears the pool; buffers still referenced by the application are freed
+  // once those references are dropped.
+  void Release();
+
+ private:
+  // Explicitly use RefCountedObject to get access to HasOneRef, needed by the
+  // pool to check exclusive access.
+  template <typename Buffer>
+  using BucketMap =
+      std::map<size_t, std::list<rtc::scoped_refptr<rtc::RefCountedObject<Buffer>>>>;
+
+  template <typename Buffer>
+  rtc::scoped_refptr<Buffer> CreateBuffer(BucketMap<Buffer>* buckets,
+                                          int width,
+                                          int height,
+                                          size_t capacity);
+
+  rtc::RaceChecker race_checker_;
+  BucketMap<PooledI420Buffer> i420_buffers_;
+  BucketMap<PooledNV12Buffer> nv12_buffers_;
+  // Total number of buffers over all buckets, bounded by
+  // |max_number_of_buffers_|.
+  size_t num_buffers_ = 0;
+  // If true, newly allocated buffers are zero-initialized. Recycled buffers
+  // are not zero'd before reuse; see I420BufferPool for the rationale.
+  const bool zero_initialize_;
+  const size_t max_number_of_buffers_;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_VIDEO_FRAME_BUFFER_POOL_H_
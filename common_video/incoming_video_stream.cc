@@ -23,9 +23,11 @@ namespace webrtc {
 IncomingVideoStream::IncomingVideoStream(
     TaskQueueFactory* task_queue_factory,
     int32_t delay_ms,
-    rtc::VideoSinkInterface<VideoFrame>* callback)
+    rtc::VideoSinkInterface<VideoFrame>* callback,
+    bool direct_render)
     : render_buffers_(delay_ms),
       callback_(callback),
+      direct_render_(direct_render),
       incoming_render_queue_(task_queue_factory->CreateTaskQueue(
           "IncomingVideoStream",
           TaskQueueFactory::Priority::HIGH)) {}
@@ -38,6 +40,13 @@ void IncomingVideoStream::OnFrame(const VideoFrame& video_frame) {
   TRACE_EVENT0("webrtc", "IncomingVideoStream::OnFrame");
   RTC_CHECK_RUNS_SERIALIZED(&decoder_race_checker_);
   RTC_DCHECK(!incoming_render_queue_.IsCurrent());
+  if (direct_render_) {
+    // The sink was declared wait-free at construction, so the frame is handed
+    // over without paying for a task queue hop and the delivery granularity
+    // of the render buffers.
+    callback_->OnFrame(video_frame);
+    return;
+  }
   // TODO(srte): This struct should be replaced by a lambda with move capture
   // when C++14 lambdas are allowed.
   struct NewFrameTask {
@@ -26,6 +26,7 @@
 #include "api/video/i420_buffer.h"
 #include "api/video/video_frame.h"
 #include "api/video/video_frame_buffer.h"
+#include "common_video/include/video_frame_buffer_pool.h"
 
 namespace webrtc {
 
@@ -168,6 +169,42 @@ class NV12ToI420Scaler {
   std::vector<uint8_t> tmp_uv_planes_;
 };
 
+// Helper class for converting an NV12 source into I420 at several output
+// resolutions (e.g. simulcast layers) in one call. The source UV plane is
+// split only once, the largest layer is scaled directly from the source, and
+// each smaller layer is scaled from the previous, larger layer instead of
+// from the full-resolution source. Compared to one NV12->I420 conversion
+// followed by a separate I420Scale per layer this roughly halves the memory
+// traffic. Output buffers are recycled from a VideoFrameBufferPool, so
+// steady-state operation does not allocate.
+class NV12ToI420LayerScaler {
+ public:
+  struct Resolution {
+    int width;
+    int height;
+  };
+
+  NV12ToI420LayerScaler();
+  ~NV12ToI420LayerScaler();
+
+  // Converts the NV12 source into one I420 buffer per entry in
+  // |resolutions|, which must be sorted by decreasing pixel count and must
+  // not exceed the source size. Returns an empty vector if a buffer pool is
+  // exhausted.
+  std::vector<rtc::scoped_refptr<I420BufferInterface>> Convert(
+      const uint8_t* src_y,
+      int src_stride_y,
+      const uint8_t* src_uv,
+      int src_stride_uv,
+      int src_width,
+      int src_height,
+      const std::vector<Resolution>& resolutions);
+
+ private:
+  NV12ToI420Scaler scaler_;
+  VideoFrameBufferPool pool_;
+};
+
 // Convert VideoType to libyuv FourCC type
 int ConvertVideoType(VideoType video_type);
 
@@ -337,4 +337,41 @@ TEST_F(TestLibYuv, NV12Scale4x4to2x2) {
               ::testing::ElementsAre(Average(0, 2, 4, 6), Average(1, 3, 5, 7)));
 }
 
+TEST_F(TestLibYuv, NV12ToI420LayerScaler4x4And2x2) {
+  const uint8_t src_y[] = {0, 1, 2,  3,  4,  5,  6,  7,
+                           8, 9, 10, 11, 12, 13, 14, 15};
+  const uint8_t src_uv[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+  NV12ToI420LayerScaler scaler;
+  std::vector<rtc::scoped_refptr<I420BufferInterface>> layers =
+      scaler.Convert(src_y, 4, src_uv, 4, 4, 4, {{4, 4}, {2, 2}});
+  ASSERT_EQ(2u, layers.size());
+
+  // The full-size layer is a straight NV12->I420 conversion.
+  ASSERT_EQ(4, layers[0]->width());
+  ASSERT_EQ(4, layers[0]->height());
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      EXPECT_EQ(src_y[row * 4 + col],
+                layers[0]->DataY()[row * layers[0]->StrideY() + col]);
+    }
+  }
+  EXPECT_EQ(0, layers[0]->DataU()[0]);
+  EXPECT_EQ(2, layers[0]->DataU()[1]);
+  EXPECT_EQ(1, layers[0]->DataV()[0]);
+  EXPECT_EQ(3, layers[0]->DataV()[1]);
+
+  // The smaller layer is scaled from the full-size layer.
+  ASSERT_EQ(2, layers[1]->width());
+  ASSERT_EQ(2, layers[1]->height());
+  const uint8_t* dst_y = layers[1]->DataY();
+  const int stride_y = layers[1]->StrideY();
+  EXPECT_EQ(Average(0, 1, 4, 5), dst_y[0]);
+  EXPECT_EQ(Average(2, 3, 6, 7), dst_y[1]);
+  EXPECT_EQ(Average(8, 9, 12, 13), dst_y[stride_y]);
+  EXPECT_EQ(Average(10, 11, 14, 15), dst_y[stride_y + 1]);
+  EXPECT_EQ(Average(0, 2, 4, 6), layers[1]->DataU()[0]);
+  EXPECT_EQ(Average(1, 3, 5, 7), layers[1]->DataV()[0]);
+}
+
 }  // namespace webrtc
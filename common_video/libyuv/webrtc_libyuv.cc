@@ -485,4 +485,55 @@ void NV12ToI420Scaler::NV12ToI420Scale(const uint8_t* src_y,
                     dst_height, libyuv::kFilterBox);
 }
 
+NV12ToI420LayerScaler::NV12ToI420LayerScaler() = default;
+NV12ToI420LayerScaler::~NV12ToI420LayerScaler() = default;
+
+std::vector<rtc::scoped_refptr<I420BufferInterface>>
+NV12ToI420LayerScaler::Convert(const uint8_t* src_y,
+                               int src_stride_y,
+                               const uint8_t* src_uv,
+                               int src_stride_uv,
+                               int src_width,
+                               int src_height,
+                               const std::vector<Resolution>& resolutions) {
+  std::vector<rtc::scoped_refptr<I420BufferInterface>> layers;
+  for (size_t i = 0; i < resolutions.size(); ++i) {
+    const int dst_width = resolutions[i].width;
+    const int dst_height = resolutions[i].height;
+    RTC_DCHECK_LE(dst_width, src_width);
+    RTC_DCHECK_LE(dst_height, src_height);
+    if (i > 0) {
+      RTC_DCHECK_LE(dst_width * dst_height,
+                    resolutions[i - 1].width * resolutions[i - 1].height);
+    }
+    rtc::scoped_refptr<PooledI420Buffer> buffer =
+        pool_.CreateI420Buffer(dst_width, dst_height);
+    if (!buffer)
+      return {};
+
+    if (i == 0) {
+      // The largest layer is converted and scaled directly from the NV12
+      // source; the UV plane is split only once.
+      scaler_.NV12ToI420Scale(src_y, src_stride_y, src_uv, src_stride_uv,
+                              src_width, src_height, buffer->MutableDataY(),
+                              buffer->StrideY(), buffer->MutableDataU(),
+                              buffer->StrideU(), buffer->MutableDataV(),
+                              buffer->StrideV(), dst_width, dst_height);
+    } else {
+      // Smaller layers are scaled from the previous layer, which reads far
+      // fewer bytes than scaling each layer from the full-size source.
+      const I420BufferInterface& prev = *layers.back();
+      libyuv::I420Scale(prev.DataY(), prev.StrideY(), prev.DataU(),
+                        prev.StrideU(), prev.DataV(), prev.StrideV(),
+                        prev.width(), prev.height(), buffer->MutableDataY(),
+                        buffer->StrideY(), buffer->MutableDataU(),
+                        buffer->StrideU(), buffer->MutableDataV(),
+                        buffer->StrideV(), dst_width, dst_height,
+                        libyuv::kFilterBox);
+    }
+    layers.push_back(buffer);
+  }
+  return layers;
+}
+
 }  // namespace webrtc
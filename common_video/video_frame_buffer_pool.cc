@@ -0,0 +1,254 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/video_frame_buffer_pool.h"
+
+#include <string.h>
+
+#include <limits>
+
+#include "api/video/i420_buffer.h"
+#include "rtc_base/checks.h"
+#include "third_party/libyuv/include/libyuv/convert.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr size_t kBufferAlignment = 64;
+
+int I420ChromaStride(int width) {
+  return (width + 1) / 2;
+}
+
+int NV12UVStride(int width) {
+  // The interleaved UV plane holds a full row of subsampled U and V values.
+  return width + width % 2;
+}
+
+int HalfHeight(int height) {
+  return (height + 1) / 2;
+}
+
+size_t I420DataSize(int width, int height) {
+  return static_cast<size_t>(width) * height +
+         2 * static_cast<size_t>(I420ChromaStride(width)) * HalfHeight(height);
+}
+
+size_t NV12DataSize(int width, int height) {
+  return static_cast<size_t>(width) * height +
+         static_cast<size_t>(NV12UVStride(width)) * HalfHeight(height);
+}
+
+// Rounds the allocation up to the enclosing power-of-two bucket, so that
+// buffers of nearby resolutions share a free list and a resize can reuse the
+// existing allocations.
+size_t BucketCapacity(size_t size) {
+  size_t capacity = kBufferAlignment;
+  while (capacity < size)
+    capacity *= 2;
+  return capacity;
+}
+
+}  // namespace
+
+PooledI420Buffer::PooledI420Buffer(int width, int height, size_t capacity)
+    : width_(width),
+      height_(height),
+      capacity_(capacity),
+      data_(static_cast<uint8_t*>(
+          AlignedMalloc(capacity, kBufferAlignment))) {
+  RTC_DCHECK_GT(width, 0);
+  RTC_DCHECK_GT(height, 0);
+  RTC_DCHECK_GE(capacity, I420DataSize(width, height));
+}
+
+PooledI420Buffer::~PooledI420Buffer() = default;
+
+int PooledI420Buffer::width() const {
+  return width_;
+}
+
+int PooledI420Buffer::height() const {
+  return height_;
+}
+
+const uint8_t* PooledI420Buffer::DataY() const {
+  return data_.get();
+}
+
+const uint8_t* PooledI420Buffer::DataU() const {
+  return DataY() + StrideY() * height_;
+}
+
+const uint8_t* PooledI420Buffer::DataV() const {
+  return DataU() + StrideU() * HalfHeight(height_);
+}
+
+int PooledI420Buffer::StrideY() const {
+  return width_;
+}
+
+int PooledI420Buffer::StrideU() const {
+  return I420ChromaStride(width_);
+}
+
+int PooledI420Buffer::StrideV() const {
+  return I420ChromaStride(width_);
+}
+
+uint8_t* PooledI420Buffer::MutableDataY() {
+  return const_cast<uint8_t*>(DataY());
+}
+
+uint8_t* PooledI420Buffer::MutableDataU() {
+  return const_cast<uint8_t*>(DataU());
+}
+
+uint8_t* PooledI420Buffer::MutableDataV() {
+  return const_cast<uint8_t*>(DataV());
+}
+
+void PooledI420Buffer::Reformat(int width, int height) {
+  RTC_DCHECK_LE(I420DataSize(width, height), capacity_);
+  width_ = width;
+  height_ = height;
+}
+
+PooledNV12Buffer::PooledNV12Buffer(int width, int height, size_t capacity)
+    : width_(width),
+      height_(height),
+      capacity_(capacity),
+      data_(static_cast<uint8_t*>(
+          AlignedMalloc(capacity, kBufferAlignment))) {
+  RTC_DCHECK_GT(width, 0);
+  RTC_DCHECK_GT(height, 0);
+  RTC_DCHECK_GE(capacity, NV12DataSize(width, height));
+}
+
+PooledNV12Buffer::~PooledNV12Buffer() = default;
+
+VideoFrameBuffer::Type PooledNV12Buffer::type() const {
+  return Type::kNative;
+}
+
+int PooledNV12Buffer::width() const {
+  return width_;
+}
+
+int PooledNV12Buffer::height() const {
+  return height_;
+}
+
+rtc::scoped_refptr<I420BufferInterface> PooledNV12Buffer::ToI420() {
+  rtc::scoped_refptr<I420Buffer> i420_buffer =
+      I420Buffer::Create(width_, height_);
+  libyuv::NV12ToI420(DataY(), StrideY(), DataUV(), StrideUV(),
+                     i420_buffer->MutableDataY(), i420_buffer->StrideY(),
+                     i420_buffer->MutableDataU(), i420_buffer->StrideU(),
+                     i420_buffer->MutableDataV(), i420_buffer->StrideV(),
+                     width_, height_);
+  return i420_buffer;
+}
+
+const uint8_t* PooledNV12Buffer::DataY() const {
+  return data_.get();
+}
+
+const uint8_t* PooledNV12Buffer::DataUV() const {
+  return DataY() + StrideY() * height_;
+}
+
+int PooledNV12Buffer::StrideY() const {
+  return width_;
+}
+
+int PooledNV12Buffer::StrideUV() const {
+  return NV12UVStride(width_);
+}
+
+uint8_t* PooledNV12Buffer::MutableDataY() {
+  return const_cast<uint8_t*>(DataY());
+}
+
+uint8_t* PooledNV12Buffer::MutableDataUV() {
+  return const_cast<uint8_t*>(DataUV());
+}
+
+void PooledNV12Buffer::Reformat(int width, int height) {
+  RTC_DCHECK_LE(NV12DataSize(width, height), capacity_);
+  width_ = width;
+  height_ = height;
+}
+
+VideoFrameBufferPool::VideoFrameBufferPool() : VideoFrameBufferPool(false) {}
+VideoFrameBufferPool::VideoFrameBufferPool(bool zero_initialize)
+    : VideoFrameBufferPool(zero_initialize,
+                           std::numeric_limits<size_t>::max()) {}
+VideoFrameBufferPool::VideoFrameBufferPool(bool zero_initialize,
+                                           size_t max_number_of_buffers)
+    : zero_initialize_(zero_initialize),
+      max_number_of_buffers_(max_number_of_buffers) {}
+VideoFrameBufferPool::~VideoFrameBufferPool() = default;
+
+void VideoFrameBufferPool::Release() {
+  i420_buffers_.clear();
+  nv12_buffers_.clear();
+  num_buffers_ = 0;
+}
+
+rtc::scoped_refptr<PooledI420Buffer> VideoFrameBufferPool::CreateI420Buffer(
+    int width,
+    int height) {
+  return CreateBuffer(&i420_buffers_, width, height,
+                      I420DataSize(width, height));
+}
+
+rtc::scoped_refptr<PooledNV12Buffer> VideoFrameBufferPool::CreateNV12Buffer(
+    int width,
+    int height) {
+  return CreateBuffer(&nv12_buffers_, width, height,
+                      NV12DataSize(width, height));
+}
+
+template <typename Buffer>
+rtc::scoped_refptr<Buffer> VideoFrameBufferPool::CreateBuffer(
+    BucketMap<Buffer>* buckets,
+    int width,
+    int height,
+    size_t size) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const size_t capacity = BucketCapacity(size);
+  auto& bucket = (*buckets)[capacity];
+  // Look for a free buffer in the bucket. If a buffer is in use, the ref
+  // count will be >= 2, one from the list we are looping over and one from
+  // the application. If the ref count is 1, the list holds the only reference
+  // and it's safe to reuse. Unlike the whole-pool scan in I420BufferPool,
+  // this only walks the handful of in-flight buffers of one footprint.
+  for (const auto& buffer : bucket) {
+    if (buffer->HasOneRef()) {
+      buffer->Reformat(width, height);
+      return buffer;
+    }
+  }
+
+  if (num_buffers_ >= max_number_of_buffers_)
+    return nullptr;
+  // Allocate new buffer.
+  rtc::scoped_refptr<rtc::RefCountedObject<Buffer>> buffer =
+      new rtc::RefCountedObject<Buffer>(width, height, capacity);
+  if (zero_initialize_)
+    memset(buffer->data_.get(), 0, capacity);
+  bucket.push_back(buffer);
+  ++num_buffers_;
+  return buffer;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/video_frame_buffer_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(TestVideoFrameBufferPool, SimpleFrameReuse) {
+  VideoFrameBufferPool pool;
+  auto buffer = pool.CreateI420Buffer(16, 16);
+  EXPECT_EQ(16, buffer->width());
+  EXPECT_EQ(16, buffer->height());
+  // Extract non-refcounted pointers for testing.
+  const uint8_t* y_ptr = buffer->DataY();
+  const uint8_t* u_ptr = buffer->DataU();
+  const uint8_t* v_ptr = buffer->DataV();
+  // Release buffer so that it is returned to the pool.
+  buffer = nullptr;
+  // Check that the memory is reused.
+  buffer = pool.CreateI420Buffer(16, 16);
+  EXPECT_EQ(y_ptr, buffer->DataY());
+  EXPECT_EQ(u_ptr, buffer->DataU());
+  EXPECT_EQ(v_ptr, buffer->DataV());
+}
+
+TEST(TestVideoFrameBufferPool, CrossResolutionReuse) {
+  VideoFrameBufferPool pool;
+  auto buffer = pool.CreateI420Buffer(320, 180);
+  const uint8_t* y_ptr = buffer->DataY();
+  buffer = nullptr;
+  // A smaller resolution in the same capacity bucket reuses the allocation
+  // instead of purging it.
+  buffer = pool.CreateI420Buffer(318, 180);
+  EXPECT_EQ(y_ptr, buffer->DataY());
+  EXPECT_EQ(318, buffer->width());
+  EXPECT_EQ(180, buffer->height());
+}
+
+TEST(TestVideoFrameBufferPool, FailToReuseWhileReferenced) {
+  VideoFrameBufferPool pool;
+  auto buffer = pool.CreateI420Buffer(16, 16);
+  // The first buffer is still held, so the pool must hand out new memory.
+  auto buffer2 = pool.CreateI420Buffer(16, 16);
+  EXPECT_NE(buffer->DataY(), buffer2->DataY());
+}
+
+TEST(TestVideoFrameBufferPool, NV12FrameReuse) {
+  VideoFrameBufferPool pool;
+  auto buffer = pool.CreateNV12Buffer(16, 16);
+  EXPECT_EQ(VideoFrameBuffer::Type::kNative, buffer->type());
+  EXPECT_EQ(16, buffer->StrideY());
+  EXPECT_EQ(16, buffer->StrideUV());
+  const uint8_t* y_ptr = buffer->DataY();
+  const uint8_t* uv_ptr = buffer->DataUV();
+  buffer = nullptr;
+  buffer = pool.CreateNV12Buffer(16, 16);
+  EXPECT_EQ(y_ptr, buffer->DataY());
+  EXPECT_EQ(uv_ptr, buffer->DataUV());
+}
+
+TEST(TestVideoFrameBufferPool, NV12ToI420) {
+  VideoFrameBufferPool pool;
+  auto buffer = pool.CreateNV12Buffer(2, 2);
+  memset(buffer->MutableDataY(), 0x64, 2 * buffer->StrideY());
+  memset(buffer->MutableDataUV(), 0x80, buffer->StrideUV());
+  rtc::scoped_refptr<I420BufferInterface> i420_buffer = buffer->ToI420();
+  EXPECT_EQ(2, i420_buffer->width());
+  EXPECT_EQ(2, i420_buffer->height());
+  EXPECT_EQ(0x64, i420_buffer->DataY()[0]);
+  EXPECT_EQ(0x80, i420_buffer->DataU()[0]);
+  EXPECT_EQ(0x80, i420_buffer->DataV()[0]);
+}
+
+TEST(TestVideoFrameBufferPool, FrameValidAfterPoolDestruction) {
+  rtc::scoped_refptr<PooledI420Buffer> buffer;
+  {
+    VideoFrameBufferPool pool;
+    buffer = pool.CreateI420Buffer(16, 16);
+  }
+  EXPECT_EQ(16, buffer->width());
+  EXPECT_EQ(16, buffer->height());
+  // Try to trigger use-after-free errors by writing to y-plane.
+  memset(buffer->MutableDataY(), 0xA5, 16 * buffer->StrideY());
+}
+
+TEST(TestVideoFrameBufferPool, MaxNumberOfBuffers) {
+  VideoFrameBufferPool pool(false, 1);
+  auto buffer = pool.CreateI420Buffer(16, 16);
+  EXPECT_NE(nullptr, buffer.get());
+  // The limit is shared between the formats.
+  EXPECT_EQ(nullptr, pool.CreateI420Buffer(16, 16).get());
+  EXPECT_EQ(nullptr, pool.CreateNV12Buffer(16, 16).get());
+}
+
+}  // namespace webrtc
@@ -122,6 +122,8 @@ bool RtcEventLogImpl::StartLogging(std::unique_ptr<RtcEventLogOutput> output,
     event_output_ = std::move(output);
     num_config_events_written_ = 0;
     WriteToOutput(event_encoder_->EncodeLogStart(timestamp_us, utc_time_us));
+    // Include any events still waiting in the producer-side buffer.
+    DrainPendingEvents();
     LogEventsFromMemoryToOutput();
   };
 
@@ -156,6 +158,7 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
   logging_state_started_ = false;
   task_queue_->PostTask([this, callback] {
     RTC_DCHECK_RUN_ON(task_queue_.get());
+    DrainPendingEvents();
     if (event_output_) {
       RTC_DCHECK(event_output_->IsActive());
       LogEventsFromMemoryToOutput();
@@ -168,16 +171,38 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
 void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
   RTC_CHECK(event);
 
+  {
+    rtc::CritScope cs(&pending_events_lock_);
+    pending_events_.push_back(std::move(event));
+    if (pending_drain_posted_) {
+      // A drain task is already queued and will pick this event up; logging
+      // costs just the push above.
+      return;
+    }
+    pending_drain_posted_ = true;
+  }
+
   // Binding to |this| is safe because |this| outlives the |task_queue_|.
-  auto event_handler = [this](std::unique_ptr<RtcEvent> unencoded_event) {
+  task_queue_->PostTask([this] {
     RTC_DCHECK_RUN_ON(task_queue_.get());
-    LogToMemory(std::move(unencoded_event));
+    DrainPendingEvents();
     if (event_output_)
       ScheduleOutput();
-  };
+  });
+}
 
-  task_queue_->PostTask(absl::make_unique<ResourceOwningTask<RtcEvent>>(
-      std::move(event), event_handler));
+void RtcEventLogImpl::DrainPendingEvents() {
+  {
+    rtc::CritScope cs(&pending_events_lock_);
+    // Clear the flag before swapping so that an event logged while we process
+    // this batch posts a new drain task and cannot get stranded.
+    pending_drain_posted_ = false;
+    drained_events_.swap(pending_events_);
+  }
+  for (auto& event : drained_events_) {
+    LogToMemory(std::move(event));
+  }
+  drained_events_.clear();
 }
 
 void RtcEventLogImpl::ScheduleOutput() {
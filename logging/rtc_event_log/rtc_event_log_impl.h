@@ -16,6 +16,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "api/rtc_event_log/rtc_event.h"
@@ -23,6 +24,7 @@
 #include "api/rtc_event_log_output.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "logging/rtc_event_log/encoder/rtc_event_log_encoder.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
@@ -48,6 +50,9 @@ class RtcEventLogImpl final : public RtcEventLog {
   void Log(std::unique_ptr<RtcEvent> event) override;
 
  private:
+  // Moves all events buffered by Log() into the history. Runs as a single
+  // task per burst of logged events.
+  void DrainPendingEvents() RTC_RUN_ON(task_queue_);
   void LogToMemory(std::unique_ptr<RtcEvent> event) RTC_RUN_ON(task_queue_);
   void LogEventsFromMemoryToOutput() RTC_RUN_ON(task_queue_);
 
@@ -62,6 +67,17 @@ class RtcEventLogImpl final : public RtcEventLog {
 
   void ScheduleOutput() RTC_RUN_ON(task_queue_);
 
+  // Events logged from any thread, awaiting transfer to the history on
+  // |task_queue_|. Only one drain task is in flight at a time, so a burst of
+  // logged events costs one posted task rather than one per event; the two
+  // vectors ping-pong so neither side reallocates in steady state.
+  rtc::CriticalSection pending_events_lock_;
+  std::vector<std::unique_ptr<RtcEvent>> pending_events_
+      RTC_GUARDED_BY(pending_events_lock_);
+  bool pending_drain_posted_ RTC_GUARDED_BY(pending_events_lock_) = false;
+  std::vector<std::unique_ptr<RtcEvent>> drained_events_
+      RTC_GUARDED_BY(*task_queue_);
+
   // History containing all past configuration events.
   std::deque<std::unique_ptr<RtcEvent>> config_history_
       RTC_GUARDED_BY(*task_queue_);
@@ -13,8 +13,16 @@
 #include <stdint.h>
 #include <string.h>
 
+#if defined(WEBRTC_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <istream>  // no-presubmit-check TODO(webrtc:8982)
 #include <limits>
 #include <map>
@@ -269,6 +277,22 @@ absl::optional<uint64_t> ParseVarInt(
   return absl::nullopt;
 }
 
+// Reads a VarInt from |*ptr| without advancing past |end|. |*ptr| is left
+// pointing at the first byte after the VarInt.
+absl::optional<uint64_t> ParseVarIntFromMemory(const char** ptr,
+                                               const char* end) {
+  uint64_t varint = 0;
+  for (size_t bytes_read = 0; bytes_read < 10 && *ptr != end; ++bytes_read) {
+    uint8_t byte = static_cast<uint8_t>(**ptr);
+    ++(*ptr);
+    varint |= static_cast<uint64_t>(byte & 0x7F) << (7 * bytes_read);
+    if ((byte & 0x80) == 0) {
+      return varint;
+    }
+  }
+  return absl::nullopt;
+}
+
 void GetHeaderExtensions(std::vector<RtpExtension>* header_extensions,
                          const RepeatedPtrField<rtclog::RtpHeaderExtension>&
                              proto_header_extensions) {
@@ -1241,6 +1265,117 @@ bool ParsedRtcEventLog::ParseStreamInternal(
   return true;
 }
 
+bool RtcEventLogStreamingParser::VisitFile(
+    const std::string& filename,
+    const LegacyVisitor& legacy_visitor,
+    const NewFormatVisitor& new_format_visitor) {
+#if defined(WEBRTC_POSIX)
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat file_info;
+    if (fstat(fd, &file_info) == 0 && file_info.st_size > 0) {
+      void* mapping = mmap(nullptr, file_info.st_size, PROT_READ, MAP_PRIVATE,
+                           fd, /*offset=*/0);
+      if (mapping != MAP_FAILED) {
+        bool success =
+            VisitBuffer(static_cast<const char*>(mapping), file_info.st_size,
+                        legacy_visitor, new_format_visitor);
+        munmap(mapping, file_info.st_size);
+        close(fd);
+        return success;
+      }
+    }
+    close(fd);
+  }
+  // Fall through to the buffered path if the file could not be mapped.
+#endif
+  std::ifstream file(  // no-presubmit-check TODO(webrtc:8982)
+      filename, std::ios_base::in | std::ios_base::binary);
+  if (!file.good() || !file.is_open()) {
+    RTC_LOG(LS_WARNING) << "Could not open file for reading.";
+    return false;
+  }
+  std::string contents((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+  return VisitBuffer(contents.data(), contents.size(), legacy_visitor,
+                     new_format_visitor);
+}
+
+bool RtcEventLogStreamingParser::VisitBuffer(
+    const char* data,
+    size_t size,
+    const LegacyVisitor& legacy_visitor,
+    const NewFormatVisitor& new_format_visitor) {
+  constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
+  constexpr uint64_t kExpectedV1Tag = (1 << 3) | 2;
+  constexpr uint64_t kWireTypeMask = 0x07;
+
+  const char* ptr = data;
+  const char* const end = data + size;
+  while (ptr != end) {
+    // Each stored message consists of a field tag, a length and the message
+    // payload; both event stream formats expect to parse all three, so
+    // remember where the record starts.
+    const char* const record_begin = ptr;
+    absl::optional<uint64_t> tag = ParseVarIntFromMemory(&ptr, end);
+    if (!tag) {
+      RTC_LOG(LS_WARNING)
+          << "Missing field tag from beginning of protobuf event.";
+      return false;
+    }
+    if ((*tag & kWireTypeMask) != 2) {
+      RTC_LOG(LS_WARNING) << "Expected field tag with wire type 2 (length "
+                             "delimited message). Found wire type "
+                          << (*tag & kWireTypeMask);
+      return false;
+    }
+    absl::optional<uint64_t> message_length = ParseVarIntFromMemory(&ptr, end);
+    if (!message_length) {
+      RTC_LOG(LS_WARNING) << "Missing message length after protobuf field tag.";
+      return false;
+    }
+    if (*message_length > kMaxEventSize) {
+      RTC_LOG(LS_WARNING) << "Protobuf message length is too large.";
+      return false;
+    }
+    if (*message_length > static_cast<uint64_t>(end - ptr)) {
+      RTC_LOG(LS_WARNING) << "Protobuf message length exceeds the remaining "
+                             "size of the log.";
+      return false;
+    }
+    ptr += *message_length;
+    const int record_size = static_cast<int>(ptr - record_begin);
+
+    // Decode directly from the mapped bytes; nothing is copied for messages
+    // the visitors do not ask for.
+    if (*tag == kExpectedV1Tag) {
+      if (legacy_visitor) {
+        rtclog::EventStream event_stream;
+        if (!event_stream.ParseFromArray(record_begin, record_size)) {
+          RTC_LOG(LS_WARNING)
+              << "Failed to parse legacy-format protobuf message.";
+          return false;
+        }
+        if (!legacy_visitor(event_stream)) {
+          return true;
+        }
+      }
+    } else {
+      if (new_format_visitor) {
+        rtclog2::EventStream event_stream;
+        if (!event_stream.ParseFromArray(record_begin, record_size)) {
+          RTC_LOG(LS_WARNING) << "Failed to parse new-format protobuf message.";
+          return false;
+        }
+        if (!new_format_visitor(event_stream)) {
+          return true;
+        }
+      }
+    }
+  }
+  return true;
+}
+
 template <typename T>
 void ParsedRtcEventLog::StoreFirstAndLastTimestamp(const std::vector<T>& v) {
   if (v.empty())
@@ -10,6 +10,7 @@
 #ifndef LOGGING_RTC_EVENT_LOG_RTC_EVENT_LOG_PARSER_H_
 #define LOGGING_RTC_EVENT_LOG_RTC_EVENT_LOG_PARSER_H_
 
+#include <functional>
 #include <iterator>
 #include <map>
 #include <set>
@@ -788,6 +789,37 @@ class ParsedRtcEventLog {
       outgoing_rtp_extensions_maps_;
 };
 
+// Iterates over an event log file one top-level protobuf message at a time,
+// without materializing the per-type event vectors that ParsedRtcEventLog
+// builds. Intended for tools that process logs too large to hold decoded in
+// memory. On POSIX the file is mapped read-only, so only the pages actually
+// visited are paged in; elsewhere the file is read through a buffered stream.
+//
+// Each visitor is handed the decoded messages of its format in file order and
+// may return false to stop the iteration early (VisitFile still returns true
+// in that case). A null visitor skips decoding messages of that format
+// entirely. Time-range filtering is done in the visitor: a message's events
+// carry their own timestamps, and skipping a decoded message is cheap
+// compared to materializing it.
+class RtcEventLogStreamingParser {
+ public:
+  using LegacyVisitor = std::function<bool(const rtclog::EventStream&)>;
+  using NewFormatVisitor = std::function<bool(const rtclog2::EventStream&)>;
+
+  // Visits every message in |filename|. Returns false on read or parse
+  // errors.
+  static bool VisitFile(const std::string& filename,
+                        const LegacyVisitor& legacy_visitor,
+                        const NewFormatVisitor& new_format_visitor);
+
+  // Same, for a log already in memory. |data| must stay valid for the
+  // duration of the call.
+  static bool VisitBuffer(const char* data,
+                          size_t size,
+                          const LegacyVisitor& legacy_visitor,
+                          const NewFormatVisitor& new_format_visitor);
+};
+
 struct MatchedSendArrivalTimes {
   MatchedSendArrivalTimes(int64_t fb, int64_t tx, int64_t rx, int64_t ps)
       : feedback_arrival_time_ms(fb),
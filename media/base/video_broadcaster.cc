@@ -17,10 +17,16 @@
 #include "api/video/video_rotation.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/thread.h"
 
 namespace rtc {
 
-VideoBroadcaster::VideoBroadcaster() = default;
+VideoBroadcaster::VideoBroadcaster()
+    : frame_sinks_(new RefCountedObject<FrameSinks>()),
+      frames_in_flight_(0),
+      delivering_thread_() {}
+
 VideoBroadcaster::~VideoBroadcaster() = default;
 
 void VideoBroadcaster::AddOrUpdateSink(
@@ -34,14 +40,35 @@ void VideoBroadcaster::AddOrUpdateSink(
   }
   VideoSourceBase::AddOrUpdateSink(sink, wants);
   UpdateWants();
+  RebuildFrameSinks();
 }
 
 void VideoBroadcaster::RemoveSink(
     VideoSinkInterface<webrtc::VideoFrame>* sink) {
   RTC_DCHECK(sink != nullptr);
-  rtc::CritScope cs(&sinks_and_wants_lock_);
-  VideoSourceBase::RemoveSink(sink);
-  UpdateWants();
+  bool in_delivery_on_this_thread;
+  {
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    VideoSourceBase::RemoveSink(sink);
+    UpdateWants();
+    RebuildFrameSinks();
+    in_delivery_on_this_thread =
+        frames_in_flight_.load(std::memory_order_relaxed) > 0 &&
+        IsThreadRefEqual(delivering_thread_, CurrentThreadRef());
+  }
+  if (in_delivery_on_this_thread) {
+    // The sink is removing itself from within OnFrame(); it may still see the
+    // tail of the current frame delivery, as it would have with the previous
+    // recursive locking, and waiting here would deadlock.
+    return;
+  }
+  // A delivery that grabbed the previous snapshot may still be running on
+  // another thread. Wait it out, so the sink is guaranteed not to be called
+  // after we return. This blocks for at most one frame fan-out, and only when
+  // a removal races a delivery.
+  while (frames_in_flight_.load(std::memory_order_acquire) > 0) {
+    Thread::SleepMs(1);
+  }
 }
 
 bool VideoBroadcaster::frame_wanted() const {
@@ -55,9 +82,20 @@ VideoSinkWants VideoBroadcaster::wants() const {
 }
 
 void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
-  rtc::CritScope cs(&sinks_and_wants_lock_);
+  scoped_refptr<FrameSinks> sinks;
+  bool full_update_needed;
+  {
+    // Only the snapshot pointer copy and the delivery bookkeeping happen
+    // under the lock; the fan-out below runs without it, so sink changes
+    // never contend with the actual frame delivery.
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    sinks = frame_sinks_;
+    full_update_needed = !previous_frame_sent_to_all_sinks_;
+    frames_in_flight_.fetch_add(1, std::memory_order_relaxed);
+    delivering_thread_ = CurrentThreadRef();
+  }
   bool current_frame_was_discarded = false;
-  for (auto& sink_pair : sink_pairs()) {
+  for (const auto& sink_pair : sinks->sinks) {
     if (sink_pair.wants.rotation_applied &&
         frame.rotation() != webrtc::kVideoRotation_0) {
       // Calls to OnFrame are not synchronized with changes to the sink wants.
@@ -79,7 +117,7 @@ void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
               .set_id(frame.id())
               .build();
       sink_pair.sink->OnFrame(black_frame);
-    } else if (!previous_frame_sent_to_all_sinks_) {
+    } else if (full_update_needed) {
       // Since last frame was not sent to some sinks, full update is needed.
       webrtc::VideoFrame copy = frame;
       copy.set_update_rect(
@@ -89,13 +127,25 @@ void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
       sink_pair.sink->OnFrame(frame);
     }
   }
-  previous_frame_sent_to_all_sinks_ = !current_frame_was_discarded;
+  {
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    previous_frame_sent_to_all_sinks_ = !current_frame_was_discarded;
+    frames_in_flight_.fetch_sub(1, std::memory_order_release);
+  }
 }
 
 void VideoBroadcaster::OnDiscardedFrame() {
-  for (auto& sink_pair : sink_pairs()) {
+  scoped_refptr<FrameSinks> sinks;
+  {
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    sinks = frame_sinks_;
+    frames_in_flight_.fetch_add(1, std::memory_order_relaxed);
+    delivering_thread_ = CurrentThreadRef();
+  }
+  for (const auto& sink_pair : sinks->sinks) {
     sink_pair.sink->OnDiscardedFrame();
   }
+  frames_in_flight_.fetch_sub(1, std::memory_order_release);
 }
 
 void VideoBroadcaster::UpdateWants() {
@@ -132,8 +182,16 @@ void VideoBroadcaster::UpdateWants() {
   current_wants_ = wants;
 }
 
-const rtc::scoped_refptr<webrtc::VideoFrameBuffer>&
+void VideoBroadcaster::RebuildFrameSinks() {
+  scoped_refptr<RefCountedObject<FrameSinks>> sinks(
+      new RefCountedObject<FrameSinks>());
+  sinks->sinks = sink_pairs();
+  frame_sinks_ = std::move(sinks);
+}
+
+rtc::scoped_refptr<webrtc::VideoFrameBuffer>
 VideoBroadcaster::GetBlackFrameBuffer(int width, int height) {
+  rtc::CritScope cs(&sinks_and_wants_lock_);
   if (!black_frame_buffer_ || black_frame_buffer_->width() != width ||
       black_frame_buffer_->height() != height) {
     rtc::scoped_refptr<webrtc::I420Buffer> buffer =
@@ -11,11 +11,16 @@
 #ifndef MEDIA_BASE_VIDEO_BROADCASTER_H_
 #define MEDIA_BASE_VIDEO_BROADCASTER_H_
 
+#include <atomic>
+#include <vector>
+
 #include "api/scoped_refptr.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_source_interface.h"
 #include "media/base/video_source_base.h"
 #include "rtc_base/critical_section.h"
+#include "rtc_base/platform_thread_types.h"
+#include "rtc_base/ref_count.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/thread_checker.h"
 
@@ -51,15 +56,34 @@ class VideoBroadcaster : public VideoSourceBase,
   void OnDiscardedFrame() override;
 
  protected:
+  // Immutable snapshot of the sink list. A new snapshot is published under
+  // |sinks_and_wants_lock_| on every sink change; OnFrame() and
+  // OnDiscardedFrame() grab a reference to the current one and deliver frames
+  // against it without holding the lock.
+  struct FrameSinks : public RefCountInterface {
+    std::vector<SinkPair> sinks;
+  };
+
   void UpdateWants() RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
-  const rtc::scoped_refptr<webrtc::VideoFrameBuffer>& GetBlackFrameBuffer(
-      int width,
-      int height) RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
+  // Publishes a new snapshot of sink_pairs() for frame delivery. Must be
+  // called after every mutation of the sink list.
+  void RebuildFrameSinks() RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> GetBlackFrameBuffer(int width,
+                                                                   int height);
 
   rtc::CriticalSection sinks_and_wants_lock_;
 
   VideoSinkWants current_wants_ RTC_GUARDED_BY(sinks_and_wants_lock_);
-  rtc::scoped_refptr<webrtc::VideoFrameBuffer> black_frame_buffer_;
+  rtc::scoped_refptr<FrameSinks> frame_sinks_
+      RTC_GUARDED_BY(sinks_and_wants_lock_);
+  // Number of frame deliveries currently running against a snapshot, and the
+  // thread running them. RemoveSink() uses these to wait until a removed sink
+  // can no longer be reached - unless it is called from within a delivery on
+  // the same thread, where waiting would deadlock.
+  std::atomic<int> frames_in_flight_;
+  PlatformThreadRef delivering_thread_ RTC_GUARDED_BY(sinks_and_wants_lock_);
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> black_frame_buffer_
+      RTC_GUARDED_BY(sinks_and_wants_lock_);
   bool previous_frame_sent_to_all_sinks_ RTC_GUARDED_BY(sinks_and_wants_lock_) =
       true;
 };
@@ -18,7 +18,9 @@
 #include <string>
 #include <utility>
 
+#include "absl/memory/memory.h"
 #include "api/scoped_refptr.h"
+#include "api/task_queue/default_task_queue_factory.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_frame_buffer.h"
@@ -29,8 +31,10 @@
 #include "modules/video_coding/utility/simulcast_rate_allocator.h"
 #include "rtc_base/atomic_ops.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
 #include "rtc_base/experiments/rate_control_settings.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/strings/string_builder.h"
 #include "system_wrappers/include/field_trial.h"
 #include "third_party/libyuv/include/libyuv/scale.h"
 
@@ -130,7 +134,13 @@ SimulcastEncoderAdapter::SimulcastEncoderAdapter(VideoEncoderFactory* factory,
       encoded_complete_callback_(nullptr),
       experimental_boosted_screenshare_qp_(GetScreenshareBoostedQpValue()),
       boost_base_layer_quality_(RateControlSettings::ParseFromFieldTrials()
-                                    .Vp8BoostBaseLayerQuality()) {
+                                    .Vp8BoostBaseLayerQuality()),
+      parallel_encoding_enabled_(
+          field_trial::IsEnabled("WebRTC-SimulcastParallelEncode")),
+      worker_queue_factory_(parallel_encoding_enabled_
+                                ? CreateDefaultTaskQueueFactory()
+                                : nullptr),
+      buffer_encoded_images_(false) {
   RTC_DCHECK(factory_);
   encoder_info_.implementation_name = "SimulcastEncoderAdapter";
 
@@ -166,6 +176,10 @@ int SimulcastEncoderAdapter::Release() {
     stored_encoders_.push(std::move(encoder));
   }
 
+  // Encode() joins the workers before returning, so at this point no encode
+  // tasks are in flight.
+  encode_workers_.clear();
+
   // It's legal to move the encoder to another queue now.
   encoder_queue_.Detach();
 
@@ -341,6 +355,18 @@ int SimulcastEncoderAdapter::InitEncode(
   // To save memory, don't store encoders that we don't use.
   DestroyStoredEncoders();
 
+  if (parallel_encoding_enabled_ && number_of_streams > 1) {
+    // One worker per downscaled stream; the remaining stream is encoded on
+    // the calling thread.
+    for (int i = 0; i < number_of_streams - 1; ++i) {
+      rtc::StringBuilder name;
+      name << "SimulcastEncoder" << i;
+      encode_workers_.push_back(
+          absl::make_unique<rtc::TaskQueue>(worker_queue_factory_->CreateTaskQueue(
+              name.str(), TaskQueueFactory::Priority::HIGH)));
+    }
+  }
+
   rtc::AtomicOps::ReleaseStore(&inited_, 1);
 
   return WEBRTC_VIDEO_CODEC_OK;
@@ -377,74 +403,153 @@ int SimulcastEncoderAdapter::Encode(
     }
   }
 
-  int src_width = input_image.width();
-  int src_height = input_image.height();
+  std::vector<size_t> active_streams;
+  std::vector<std::vector<VideoFrameType>> stream_frame_types(
+      streaminfos_.size());
   for (size_t stream_idx = 0; stream_idx < streaminfos_.size(); ++stream_idx) {
     // Don't encode frames in resolutions that we don't intend to send.
     if (!streaminfos_[stream_idx].send_stream) {
       continue;
     }
 
-    std::vector<VideoFrameType> stream_frame_types;
     if (send_key_frame) {
-      stream_frame_types.push_back(VideoFrameType::kVideoFrameKey);
+      stream_frame_types[stream_idx].push_back(VideoFrameType::kVideoFrameKey);
       streaminfos_[stream_idx].key_frame_request = false;
     } else {
-      stream_frame_types.push_back(VideoFrameType::kVideoFrameDelta);
+      stream_frame_types[stream_idx].push_back(
+          VideoFrameType::kVideoFrameDelta);
     }
+    active_streams.push_back(stream_idx);
+  }
 
-    int dst_width = streaminfos_[stream_idx].width;
-    int dst_height = streaminfos_[stream_idx].height;
-    // If scaling isn't required, because the input resolution
-    // matches the destination or the input image is empty (e.g.
-    // a keyframe request for encoders with internal camera
-    // sources) or the source image has a native handle, pass the image on
-    // directly. Otherwise, we'll scale it to match what the encoder expects
-    // (below).
-    // For texture frames, the underlying encoder is expected to be able to
-    // correctly sample/scale the source texture.
-    // TODO(perkj): ensure that works going forward, and figure out how this
-    // affects webrtc:5683.
-    if ((dst_width == src_width && dst_height == src_height) ||
-        input_image.video_frame_buffer()->type() ==
-            VideoFrameBuffer::Type::kNative) {
-      int ret = streaminfos_[stream_idx].encoder->Encode(input_image,
-                                                         &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
-      }
-    } else {
-      rtc::scoped_refptr<I420Buffer> dst_buffer =
-          I420Buffer::Create(dst_width, dst_height);
-      rtc::scoped_refptr<I420BufferInterface> src_buffer =
-          input_image.video_frame_buffer()->ToI420();
-      libyuv::I420Scale(src_buffer->DataY(), src_buffer->StrideY(),
-                        src_buffer->DataU(), src_buffer->StrideU(),
-                        src_buffer->DataV(), src_buffer->StrideV(), src_width,
-                        src_height, dst_buffer->MutableDataY(),
-                        dst_buffer->StrideY(), dst_buffer->MutableDataU(),
-                        dst_buffer->StrideU(), dst_buffer->MutableDataV(),
-                        dst_buffer->StrideV(), dst_width, dst_height,
-                        libyuv::kFilterBilinear);
-
-      // UpdateRect is not propagated to lower simulcast layers currently.
-      // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
-      VideoFrame frame(input_image);
-      frame.set_video_frame_buffer(dst_buffer);
-      frame.set_rotation(webrtc::kVideoRotation_0);
-      frame.set_update_rect(
-          VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
-      int ret =
-          streaminfos_[stream_idx].encoder->Encode(frame, &stream_frame_types);
+  if (encode_workers_.empty() || active_streams.size() < 2) {
+    for (size_t stream_idx : active_streams) {
+      int ret = EncodeStream(input_image, stream_idx,
+                             stream_frame_types[stream_idx]);
       if (ret != WEBRTC_VIDEO_CODEC_OK) {
         return ret;
       }
     }
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  // Parallel mode. Encode the most expensive stream on the calling thread
+  // and the downscaled streams on the workers, then join so that no encode
+  // task outlives this call.
+  size_t inline_stream = active_streams[0];
+  for (size_t stream_idx : active_streams) {
+    if (streaminfos_[stream_idx].width * streaminfos_[stream_idx].height >
+        streaminfos_[inline_stream].width *
+            streaminfos_[inline_stream].height) {
+      inline_stream = stream_idx;
+    }
+  }
+
+  {
+    rtc::CritScope cs(&buffered_encoded_images_crit_);
+    buffer_encoded_images_ = true;
+  }
+
+  std::vector<int> results(streaminfos_.size(), WEBRTC_VIDEO_CODEC_OK);
+  std::vector<rtc::Event> events(active_streams.size());
+  size_t next_worker = 0;
+  for (size_t i = 0; i < active_streams.size(); ++i) {
+    const size_t stream_idx = active_streams[i];
+    if (stream_idx == inline_stream) {
+      events[i].Set();
+      continue;
+    }
+    rtc::Event* const event = &events[i];
+    int* const result = &results[stream_idx];
+    const std::vector<VideoFrameType>* const frame_types =
+        &stream_frame_types[stream_idx];
+    encode_workers_[next_worker++ % encode_workers_.size()]->PostTask(
+        [this, &input_image, stream_idx, frame_types, result, event] {
+          *result = EncodeStream(input_image, stream_idx, *frame_types);
+          event->Set();
+        });
+  }
+  results[inline_stream] =
+      EncodeStream(input_image, inline_stream, stream_frame_types[inline_stream]);
+  for (rtc::Event& event : events) {
+    event.Wait(rtc::Event::kForever);
   }
 
+  std::vector<BufferedEncodedImage> buffered;
+  {
+    rtc::CritScope cs(&buffered_encoded_images_crit_);
+    buffer_encoded_images_ = false;
+    buffered.swap(buffered_encoded_images_);
+  }
+  // Forward the buffered output in stream order so that the registered
+  // callback sees the same sequence of calls as with sequential encoding.
+  std::stable_sort(buffered.begin(), buffered.end(),
+                   [](const BufferedEncodedImage& a,
+                      const BufferedEncodedImage& b) {
+                     return a.stream_idx < b.stream_idx;
+                   });
+  for (const BufferedEncodedImage& output : buffered) {
+    ForwardEncodedImage(
+        output.stream_idx, output.encoded_image, &output.codec_specific_info,
+        output.fragmentation ? &*output.fragmentation : nullptr);
+  }
+
+  for (size_t stream_idx : active_streams) {
+    if (results[stream_idx] != WEBRTC_VIDEO_CODEC_OK) {
+      return results[stream_idx];
+    }
+  }
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
+int SimulcastEncoderAdapter::EncodeStream(
+    const VideoFrame& input_image,
+    size_t stream_idx,
+    const std::vector<VideoFrameType>& stream_frame_types) {
+  const int src_width = input_image.width();
+  const int src_height = input_image.height();
+  const int dst_width = streaminfos_[stream_idx].width;
+  const int dst_height = streaminfos_[stream_idx].height;
+  // If scaling isn't required, because the input resolution
+  // matches the destination or the input image is empty (e.g.
+  // a keyframe request for encoders with internal camera
+  // sources) or the source image has a native handle, pass the image on
+  // directly. Otherwise, we'll scale it to match what the encoder expects
+  // (below).
+  // For texture frames, the underlying encoder is expected to be able to
+  // correctly sample/scale the source texture.
+  // TODO(perkj): ensure that works going forward, and figure out how this
+  // affects webrtc:5683.
+  if ((dst_width == src_width && dst_height == src_height) ||
+      input_image.video_frame_buffer()->type() ==
+          VideoFrameBuffer::Type::kNative) {
+    return streaminfos_[stream_idx].encoder->Encode(input_image,
+                                                    &stream_frame_types);
+  }
+
+  rtc::scoped_refptr<I420Buffer> dst_buffer =
+      I420Buffer::Create(dst_width, dst_height);
+  rtc::scoped_refptr<I420BufferInterface> src_buffer =
+      input_image.video_frame_buffer()->ToI420();
+  libyuv::I420Scale(src_buffer->DataY(), src_buffer->StrideY(),
+                    src_buffer->DataU(), src_buffer->StrideU(),
+                    src_buffer->DataV(), src_buffer->StrideV(), src_width,
+                    src_height, dst_buffer->MutableDataY(),
+                    dst_buffer->StrideY(), dst_buffer->MutableDataU(),
+                    dst_buffer->StrideU(), dst_buffer->MutableDataV(),
+                    dst_buffer->StrideV(), dst_width, dst_height,
+                    libyuv::kFilterBilinear);
+
+  // UpdateRect is not propagated to lower simulcast layers currently.
+  // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
+  VideoFrame frame(input_image);
+  frame.set_video_frame_buffer(dst_buffer);
+  frame.set_rotation(webrtc::kVideoRotation_0);
+  frame.set_update_rect(
+      VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
+  return streaminfos_[stream_idx].encoder->Encode(frame, &stream_frame_types);
+}
+
 int SimulcastEncoderAdapter::RegisterEncodeCompleteCallback(
     EncodedImageCallback* callback) {
   RTC_DCHECK_RUN_ON(&encoder_queue_);
@@ -533,8 +638,35 @@ EncodedImageCallback::Result SimulcastEncoderAdapter::OnEncodedImage(
     const EncodedImage& encodedImage,
     const CodecSpecificInfo* codecSpecificInfo,
     const RTPFragmentationHeader* fragmentation) {
-  EncodedImage stream_image(encodedImage);
-  CodecSpecificInfo stream_codec_specific = *codecSpecificInfo;
+  {
+    rtc::CritScope cs(&buffered_encoded_images_crit_);
+    if (buffer_encoded_images_) {
+      // Encode() is running the encoders in parallel; hold the output back
+      // until all of them have finished so it can be forwarded in stream
+      // order from the encoder queue.
+      BufferedEncodedImage buffered;
+      buffered.stream_idx = stream_idx;
+      buffered.encoded_image = encodedImage;
+      buffered.codec_specific_info = *codecSpecificInfo;
+      if (fragmentation) {
+        buffered.fragmentation.emplace();
+        buffered.fragmentation->CopyFrom(*fragmentation);
+      }
+      buffered_encoded_images_.push_back(std::move(buffered));
+      return EncodedImageCallback::Result(EncodedImageCallback::Result::OK);
+    }
+  }
+  return ForwardEncodedImage(stream_idx, encodedImage, codecSpecificInfo,
+                             fragmentation);
+}
+
+EncodedImageCallback::Result SimulcastEncoderAdapter::ForwardEncodedImage(
+    size_t stream_idx,
+    const EncodedImage& encoded_image,
+    const CodecSpecificInfo* codec_specific_info,
+    const RTPFragmentationHeader* fragmentation) {
+  EncodedImage stream_image(encoded_image);
+  CodecSpecificInfo stream_codec_specific = *codec_specific_info;
 
   stream_image.SetSpatialIndex(stream_idx);
 
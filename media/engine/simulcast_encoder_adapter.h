@@ -20,13 +20,17 @@
 
 #include "absl/types/optional.h"
 #include "api/fec_controller_override.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/video_codecs/sdp_video_format.h"
 #include "api/video_codecs/video_encoder.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "rtc_base/atomic_ops.h"
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/system/rtc_export.h"
+#include "rtc_base/task_queue.h"
+#include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
 
@@ -95,6 +99,17 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
     LOWEST,
   };
 
+  // Output captured from one of the contained encoders while Encode() runs
+  // the encoders in parallel. The encoded image references the encoder's
+  // internal output buffer, which stays valid until that encoder is given
+  // another frame; Encode() forwards all buffered output before returning.
+  struct BufferedEncodedImage {
+    size_t stream_idx;
+    EncodedImage encoded_image;
+    CodecSpecificInfo codec_specific_info;
+    absl::optional<RTPFragmentationHeader> fragmentation;
+  };
+
   // Populate the codec settings for each simulcast stream.
   void PopulateStreamCodec(const webrtc::VideoCodec& inst,
                            int stream_index,
@@ -102,6 +117,21 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
                            StreamResolution stream_resolution,
                            webrtc::VideoCodec* stream_codec);
 
+  // Encodes a single simulcast stream, downscaling the input frame to the
+  // stream resolution first when needed. Called on the encoder queue, or on
+  // one of |encode_workers_| when parallel encoding is enabled.
+  int EncodeStream(const VideoFrame& input_image,
+                   size_t stream_idx,
+                   const std::vector<VideoFrameType>& stream_frame_types);
+
+  // Forwards an encoded image from the encoder for |stream_idx| to the
+  // registered callback.
+  EncodedImageCallback::Result ForwardEncodedImage(
+      size_t stream_idx,
+      const EncodedImage& encoded_image,
+      const CodecSpecificInfo* codec_specific_info,
+      const RTPFragmentationHeader* fragmentation);
+
   bool Initialized() const;
 
   void DestroyStoredEncoders();
@@ -124,6 +154,24 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
   const absl::optional<unsigned int> experimental_boosted_screenshare_qp_;
   const bool boost_base_layer_quality_;
 
+  // Set by the WebRTC-SimulcastParallelEncode field trial. When enabled, the
+  // downscaled streams are encoded on |encode_workers_| in parallel with the
+  // top stream and Encode() joins before returning, so the encode time of a
+  // frame approaches that of the most expensive stream instead of the sum of
+  // all streams.
+  const bool parallel_encoding_enabled_;
+  std::unique_ptr<TaskQueueFactory> worker_queue_factory_;
+  std::vector<std::unique_ptr<rtc::TaskQueue>> encode_workers_;
+
+  // While Encode() runs the encoders in parallel, their callbacks are
+  // buffered here and forwarded in stream order once all encoders have
+  // finished, so the registered callback never sees concurrent or reordered
+  // calls.
+  rtc::CriticalSection buffered_encoded_images_crit_;
+  bool buffer_encoded_images_ RTC_GUARDED_BY(buffered_encoded_images_crit_);
+  std::vector<BufferedEncodedImage> buffered_encoded_images_
+      RTC_GUARDED_BY(buffered_encoded_images_crit_);
+
   RTC_DISALLOW_COPY_AND_ASSIGN(SimulcastEncoderAdapter);
 };
 
@@ -10,6 +10,9 @@
 
 #include "media/engine/unhandled_packets_buffer.h"
 
+#include <iterator>
+#include <utility>
+
 #include "absl/algorithm/container.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/strings/string_builder.h"
@@ -22,49 +25,75 @@ UnhandledPacketsBuffer::UnhandledPacketsBuffer() {
 
 UnhandledPacketsBuffer::~UnhandledPacketsBuffer() = default;
 
+size_t UnhandledPacketsBuffer::TakeSlot() {
+  if (!free_slots_.empty()) {
+    size_t pos = free_slots_.back();
+    free_slots_.pop_back();
+    return pos;
+  }
+  if (buffer_.size() < kMaxStashedPackets) {
+    buffer_.emplace_back();
+    return buffer_.size() - 1;
+  }
+  // Buffer is full; evict the oldest stored packet. Within each per-ssrc list
+  // the front is the oldest, so the global oldest is the front with the
+  // smallest sequence number. Few distinct ssrcs are expected, making this
+  // cheaper than keeping a global order structure.
+  auto oldest = packets_by_ssrc_.begin();
+  for (auto it = std::next(oldest); it != packets_by_ssrc_.end(); ++it) {
+    if (buffer_[it->second.front()].seq < buffer_[oldest->second.front()].seq) {
+      oldest = it;
+    }
+  }
+  size_t pos = oldest->second.front();
+  oldest->second.erase(oldest->second.begin());
+  if (oldest->second.empty()) {
+    packets_by_ssrc_.erase(oldest);
+  }
+  return pos;
+}
+
 // Store packet in buffer.
 void UnhandledPacketsBuffer::AddPacket(uint32_t ssrc,
                                        int64_t packet_time_us,
                                        rtc::CopyOnWriteBuffer packet) {
-  if (buffer_.size() < kMaxStashedPackets) {
-    buffer_.push_back({ssrc, packet_time_us, packet});
-  } else {
-    RTC_DCHECK_LT(insert_pos_, kMaxStashedPackets);
-    buffer_[insert_pos_] = {ssrc, packet_time_us, packet};
-  }
-  insert_pos_ = (insert_pos_ + 1) % kMaxStashedPackets;
+  size_t pos = TakeSlot();
+  PacketWithMetadata& entry = buffer_[pos];
+  entry.ssrc = ssrc;
+  entry.packet_time_us = packet_time_us;
+  entry.seq = next_seq_++;
+  entry.packet = std::move(packet);
+  packets_by_ssrc_[ssrc].push_back(pos);
 }
 
 // Backfill |consumer| with all stored packet related |ssrcs|.
 void UnhandledPacketsBuffer::BackfillPackets(
     rtc::ArrayView<const uint32_t> ssrcs,
     std::function<void(uint32_t, int64_t, rtc::CopyOnWriteBuffer)> consumer) {
-  size_t start;
-  if (buffer_.size() < kMaxStashedPackets) {
-    start = 0;
-  } else {
-    start = insert_pos_;
+  // Collect the slots for the requested ssrcs from the index; packets for
+  // other ssrcs are left untouched.
+  std::vector<size_t> matched;
+  for (uint32_t ssrc : ssrcs) {
+    auto it = packets_by_ssrc_.find(ssrc);
+    if (it == packets_by_ssrc_.end()) {
+      continue;
+    }
+    matched.insert(matched.end(), it->second.begin(), it->second.end());
+    packets_by_ssrc_.erase(it);
   }
 
-  size_t count = 0;
-  std::vector<PacketWithMetadata> remaining;
-  remaining.reserve(kMaxStashedPackets);
-  for (size_t i = 0; i < buffer_.size(); ++i) {
-    const size_t pos = (i + start) % kMaxStashedPackets;
+  // Replay in arrival order across all requested ssrcs.
+  absl::c_sort(matched, [this](size_t a, size_t b) {
+    return buffer_[a].seq < buffer_[b].seq;
+  });
 
-    // One or maybe 2 ssrcs is expected => loop array instead of more elaborate
-    // scheme.
-    const uint32_t ssrc = buffer_[pos].ssrc;
-    if (absl::c_linear_search(ssrcs, ssrc)) {
-      ++count;
-      consumer(ssrc, buffer_[pos].packet_time_us, buffer_[pos].packet);
-    } else {
-      remaining.push_back(buffer_[pos]);
-    }
+  for (size_t pos : matched) {
+    PacketWithMetadata& entry = buffer_[pos];
+    consumer(entry.ssrc, entry.packet_time_us, std::move(entry.packet));
+    // Release the payload reference and recycle the slot.
+    entry.packet = rtc::CopyOnWriteBuffer();
+    free_slots_.push_back(pos);
   }
-
-  insert_pos_ = 0;  // insert_pos is only used when buffer is full.
-  buffer_.swap(remaining);
 }
 
 }  // namespace cricket
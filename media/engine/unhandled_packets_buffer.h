@@ -14,6 +14,7 @@
 #include <stdint.h>
 
 #include <functional>
+#include <map>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -41,13 +42,26 @@ class UnhandledPacketsBuffer {
       std::function<void(uint32_t, int64_t, rtc::CopyOnWriteBuffer)> consumer);
 
  private:
-  size_t insert_pos_ = 0;
   struct PacketWithMetadata {
     uint32_t ssrc;
     int64_t packet_time_us;
+    // Position in the global insertion order; used to replay packets for
+    // several ssrcs in arrival order.
+    uint64_t seq;
     rtc::CopyOnWriteBuffer packet;
   };
+  // Returns the slot to store a new packet in, evicting the oldest stored
+  // packet if the buffer is full.
+  size_t TakeSlot();
+
+  uint64_t next_seq_ = 0;
+  // Fixed pool of packet slots; slots freed by BackfillPackets() or eviction
+  // are recycled through |free_slots_| instead of reallocating.
   std::vector<PacketWithMetadata> buffer_;
+  std::vector<size_t> free_slots_;
+  // Slot positions per ssrc, in insertion order, so backfilling a new stream
+  // only touches that stream's packets instead of scanning the whole buffer.
+  std::map<uint32_t, std::vector<size_t>> packets_by_ssrc_;
 };
 
 }  // namespace cricket
@@ -48,6 +48,14 @@ namespace {
 // take off 80 bytes for DTLS/TURN/TCP/IP overhead.
 static constexpr size_t kSctpMtu = 1200;
 
+// Watermarks for the queue of outgoing messages that usrsctp has not yet
+// accepted. SendData() keeps accepting whole messages until the queue reaches
+// the high watermark, and "ready to send" is re-armed once a drain brings the
+// queue below the low watermark; draining to empty before re-arming would
+// leave usrsctp idle between wakeups during bulk transfers.
+static constexpr size_t kQueuedSendHighWatermark = cricket::kSctpSendBufferSize;
+static constexpr size_t kQueuedSendLowWatermark = kQueuedSendHighWatermark / 2;
+
 // Set the initial value of the static SCTP Data Engines reference count.
 int g_usrsctp_usage_count = 0;
 rtc::GlobalLockPod g_usrsctp_lock_;
@@ -548,7 +556,7 @@ bool SctpTransport::SendData(const SendDataParams& params,
                              SendDataResult* result) {
   RTC_DCHECK_RUN_ON(network_thread_);
 
-  if (partial_outgoing_message_.has_value()) {
+  if (queued_send_bytes_ >= kQueuedSendHighWatermark) {
     if (result) {
       *result = SDR_BLOCK;
     }
@@ -556,55 +564,81 @@ bool SctpTransport::SendData(const SendDataParams& params,
     ready_to_send_data_ = false;
     return false;
   }
-  size_t payload_size = payload.size();
   OutgoingMessage message(payload, params);
+  if (!queued_outgoing_messages_.empty()) {
+    // Messages must be handed to usrsctp in order; queue behind the others.
+    // The message is still validated now so errors surface to the caller
+    // instead of when the queue drains.
+    if (ValidateMessage(message) != SDR_SUCCESS) {
+      if (result) {
+        *result = SDR_ERROR;
+      }
+      return false;
+    }
+    if (result) {
+      *result = SDR_SUCCESS;
+    }
+    queued_send_bytes_ += message.size();
+    queued_outgoing_messages_.push_back(std::move(message));
+    return true;
+  }
+  size_t payload_size = payload.size();
   SendDataResult send_message_result = SendMessageInternal(&message);
   if (result) {
     *result = send_message_result;
   }
-  if (payload_size == message.size()) {
-    // Nothing was sent.
+  if (send_message_result == SDR_ERROR) {
     return false;
   }
-  // If any data is sent, we accept the message. In the case that data was
-  // partially accepted by the sctp library, the remaining is buffered. This
-  // ensures the client does not resend the message.
-  RTC_DCHECK_LT(message.size(), payload_size);
+  // The message is accepted whether or not usrsctp took all (or any) of it;
+  // what usrsctp did not take is queued and handed over when the send
+  // threshold callback fires. This ensures the client does not resend the
+  // message.
   if (message.size() > 0) {
-    RTC_DCHECK(!partial_outgoing_message_.has_value());
-    RTC_DLOG(LS_VERBOSE) << "Partially sent message. Buffering the remaining"
-                         << message.size() << "/" << payload_size << " bytes.";
-
-    partial_outgoing_message_.emplace(message);
+    RTC_DLOG(LS_VERBOSE) << "Queueing the remaining " << message.size() << "/"
+                         << payload_size << " bytes.";
+    if (result) {
+      *result = SDR_SUCCESS;
+    }
+    queued_send_bytes_ += message.size();
+    queued_outgoing_messages_.push_back(std::move(message));
   }
   return true;
 }
 
-SendDataResult SctpTransport::SendMessageInternal(OutgoingMessage* message) {
+SendDataResult SctpTransport::ValidateMessage(const OutgoingMessage& message) {
   RTC_DCHECK_RUN_ON(network_thread_);
   if (!sock_) {
-    RTC_LOG(LS_WARNING) << debug_name_ << "->SendMessageInternal(...): "
+    RTC_LOG(LS_WARNING) << debug_name_ << "->ValidateMessage(...): "
                         << "Not sending packet with sid="
-                        << message->send_params().sid
-                        << " len=" << message->size() << " before Start().";
+                        << message.send_params().sid
+                        << " len=" << message.size() << " before Start().";
     return SDR_ERROR;
   }
-  if (message->send_params().type != DMT_CONTROL) {
-    auto it = stream_status_by_sid_.find(message->send_params().sid);
+  if (message.send_params().type != DMT_CONTROL) {
+    auto it = stream_status_by_sid_.find(message.send_params().sid);
     if (it == stream_status_by_sid_.end() || !it->second.is_open()) {
       RTC_LOG(LS_WARNING)
-          << debug_name_ << "->SendMessageInternal(...): "
+          << debug_name_ << "->ValidateMessage(...): "
           << "Not sending data because sid is unknown or closing: "
-          << message->send_params().sid;
+          << message.send_params().sid;
       return SDR_ERROR;
     }
   }
-  if (message->size() > static_cast<size_t>(max_message_size_)) {
-    RTC_LOG(LS_ERROR) << "Attempting to send message of size "
-                      << message->size() << " which is larger than limit "
-                      << max_message_size_;
+  if (message.size() > static_cast<size_t>(max_message_size_)) {
+    RTC_LOG(LS_ERROR) << "Attempting to send message of size " << message.size()
+                      << " which is larger than limit " << max_message_size_;
     return SDR_ERROR;
   }
+  return SDR_SUCCESS;
+}
+
+SendDataResult SctpTransport::SendMessageInternal(OutgoingMessage* message) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  SendDataResult validation_result = ValidateMessage(*message);
+  if (validation_result != SDR_SUCCESS) {
+    return validation_result;
+  }
 
   // Send data using SCTP.
   sctp_sendv_spa spa = CreateSctpSendParams(message->send_params());
@@ -616,7 +650,8 @@ SendDataResult SctpTransport::SendMessageInternal(OutgoingMessage* message) {
       rtc::checked_cast<socklen_t>(sizeof(spa)), SCTP_SENDV_SPA, 0);
   if (send_res < 0) {
     if (errno == SCTP_EWOULDBLOCK) {
-      ready_to_send_data_ = false;
+      // Not a backpressure signal by itself; SendData() keeps accepting into
+      // the message queue until the high watermark is reached.
       RTC_LOG(LS_INFO) << debug_name_
                        << "->SendMessageInternal(...): EWOULDBLOCK returned";
       return SDR_BLOCK;
@@ -916,19 +951,30 @@ void SctpTransport::SetReadyToSendData() {
   }
 }
 
-bool SctpTransport::SendBufferedMessage() {
+bool SctpTransport::SendQueuedMessages() {
   RTC_DCHECK_RUN_ON(network_thread_);
-  RTC_DCHECK(partial_outgoing_message_.has_value());
-  RTC_DLOG(LS_VERBOSE) << "Sending partially buffered message of size "
-                       << partial_outgoing_message_->size() << ".";
-
-  SendMessageInternal(&partial_outgoing_message_.value());
-  if (partial_outgoing_message_->size() > 0) {
-    // Still need to finish sending the message.
-    return false;
+  // Hand over as many queued messages as usrsctp will take in this wakeup,
+  // so a burst of small messages costs one wakeup rather than one each.
+  while (!queued_outgoing_messages_.empty()) {
+    OutgoingMessage& message = queued_outgoing_messages_.front();
+    size_t size_before = message.size();
+    SendDataResult send_result = SendMessageInternal(&message);
+    RTC_DCHECK_LE(message.size(), size_before);
+    queued_send_bytes_ -= size_before - message.size();
+    if (send_result == SDR_ERROR) {
+      // The message may have become invalid while queued, e.g. because its
+      // stream was reset. Drop it and keep draining.
+      queued_send_bytes_ -= message.size();
+      queued_outgoing_messages_.pop_front();
+      continue;
+    }
+    if (message.size() > 0) {
+      // usrsctp's buffer is full again; wait for the next send threshold
+      // callback.
+      return false;
+    }
+    queued_outgoing_messages_.pop_front();
   }
-  RTC_DCHECK_EQ(0u, partial_outgoing_message_->size());
-  partial_outgoing_message_.reset();
   return true;
 }
 
@@ -978,13 +1024,12 @@ void SctpTransport::OnPacketRead(rtc::PacketTransportInternal* transport,
 
 void SctpTransport::OnSendThresholdCallback() {
   RTC_DCHECK_RUN_ON(network_thread_);
-  if (partial_outgoing_message_.has_value()) {
-    if (!SendBufferedMessage()) {
-      // Did not finish sending the buffered message.
-      return;
-    }
+  SendQueuedMessages();
+  // Re-arm "ready to send" once the queue has drained below the low
+  // watermark, even if it is not yet empty.
+  if (queued_send_bytes_ < kQueuedSendLowWatermark) {
+    SetReadyToSendData();
   }
-  SetReadyToSendData();
 }
 
 sockaddr_conn SctpTransport::GetSctpSockAddr(int port) {
@@ -1089,7 +1134,9 @@ void SctpTransport::OnNotificationFromSctp(
       break;
     case SCTP_SENDER_DRY_EVENT:
       RTC_LOG(LS_VERBOSE) << "SCTP_SENDER_DRY_EVENT";
-      SetReadyToSendData();
+      // The sctp lib accepted everything it was given; top it up from the
+      // message queue before telling the client to send more.
+      OnSendThresholdCallback();
       break;
     // TODO(ldixon): Unblock after congestion.
     case SCTP_NOTIFICATIONS_STOPPED_EVENT:
@@ -13,6 +13,7 @@
 
 #include <errno.h>
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <set>
@@ -148,10 +149,15 @@ class SctpTransport : public SctpTransportInternal,
   // Sets the "ready to send" flag and fires signal if needed.
   void SetReadyToSendData();
 
-  // Sends the outgoing buffered message that was only partially accepted by the
-  // sctp lib because it did not have enough space. Returns true if the entire
-  // buffered message was accepted by the sctp lib.
-  bool SendBufferedMessage();
+  // Hands as many queued outgoing messages as possible to the sctp lib,
+  // dropping messages that have become invalid (e.g. their stream was reset
+  // while they were queued). Returns true if the queue was fully drained.
+  bool SendQueuedMessages();
+
+  // Checks that a message may be handed to the sctp lib: the socket exists,
+  // the stream is open and the message is not over-sized. Returns SDR_SUCCESS
+  // or SDR_ERROR.
+  SendDataResult ValidateMessage(const OutgoingMessage& message);
 
   // Tries to send the |payload| on the usrsctp lib. The message will be
   // advanced by the amount that was sent.
@@ -197,11 +203,14 @@ class SctpTransport : public SctpTransportInternal,
   rtc::CopyOnWriteBuffer partial_incoming_message_;
   ReceiveDataParams partial_params_;
   int partial_flags_;
-  // A message that was attempted to be sent, but was only partially accepted by
-  // usrsctp lib with usrsctp_sendv() because it cannot buffer the full message.
-  // This occurs because we explicitly set the EOR bit when sending, so
-  // usrsctp_sendv() is not atomic.
-  absl::optional<OutgoingMessage> partial_outgoing_message_;
+  // Messages (or tails of messages) that usrsctp_sendv() has not yet accepted,
+  // in send order. The front message may have been partially accepted; this
+  // occurs because we explicitly set the EOR bit when sending, so
+  // usrsctp_sendv() is not atomic. The buffers are reference counted, so
+  // queueing does not copy payloads. |queued_send_bytes_| tracks the total
+  // number of unaccepted bytes for the watermark checks in SendData().
+  std::deque<OutgoingMessage> queued_outgoing_messages_;
+  size_t queued_send_bytes_ = 0;
 
   bool was_ever_writable_ = false;
   int local_port_ = kSctpDefaultPort;
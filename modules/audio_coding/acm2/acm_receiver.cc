@@ -34,11 +34,11 @@ namespace webrtc {
 namespace acm2 {
 
 AcmReceiver::AcmReceiver(const AudioCodingModule::Config& config)
-    : last_audio_buffer_(new int16_t[AudioFrame::kMaxDataSizeSamples]),
-      neteq_(NetEq::Create(config.neteq_config,
+    : neteq_(NetEq::Create(config.neteq_config,
                            config.clock,
                            config.decoder_factory)),
       clock_(config.clock),
+      last_audio_buffer_(new int16_t[AudioFrame::kMaxDataSizeSamples]),
       resampled_last_output_frame_(true) {
   RTC_DCHECK(clock_);
   memset(last_audio_buffer_.get(), 0,
@@ -130,8 +130,6 @@ int AcmReceiver::GetAudio(int desired_freq_hz,
                           AudioFrame* audio_frame,
                           bool* muted) {
   RTC_DCHECK(muted);
-  // Accessing members, take the lock.
-  rtc::CritScope lock(&crit_sect_);
 
   if (neteq_->GetAudio(audio_frame, muted) != NetEq::kOK) {
     RTC_LOG(LERROR) << "AcmReceiver::GetAudio - NetEq Failed.";
@@ -188,7 +186,10 @@ int AcmReceiver::GetAudio(int desired_freq_hz,
          sizeof(int16_t) * audio_frame->samples_per_channel_ *
              audio_frame->num_channels_);
 
-  call_stats_.DecodedByNetEq(audio_frame->speech_type_, *muted);
+  {
+    rtc::CritScope lock(&crit_sect_);
+    call_stats_.DecodedByNetEq(audio_frame->speech_type_, *muted);
+  }
   return 0;
 }
 
@@ -64,6 +64,10 @@ class AcmReceiver {
   //
   // Asks NetEq for 10 milliseconds of decoded audio.
   //
+  // This method must always be called on the same thread (the playout
+  // thread). It does not block on InsertPacket(); NetEq provides its own
+  // internal synchronization between the two.
+  //
   // Input:
   //   -desired_freq_hz       : specifies the sampling rate [Hz] of the output
   //                            audio. If set -1 indicates to resampling is
@@ -208,12 +212,14 @@ class AcmReceiver {
   rtc::CriticalSection crit_sect_;
   absl::optional<std::pair<int, SdpAudioFormat>> last_decoder_
       RTC_GUARDED_BY(crit_sect_);
-  ACMResampler resampler_ RTC_GUARDED_BY(crit_sect_);
-  std::unique_ptr<int16_t[]> last_audio_buffer_ RTC_GUARDED_BY(crit_sect_);
   CallStatistics call_stats_ RTC_GUARDED_BY(crit_sect_);
   const std::unique_ptr<NetEq> neteq_;  // NetEq is thread-safe; no lock needed.
   Clock* const clock_;
-  bool resampled_last_output_frame_ RTC_GUARDED_BY(crit_sect_);
+  // The members below are accessed by GetAudio() only. They are confined to
+  // the playout thread and need no locking.
+  ACMResampler resampler_;
+  std::unique_ptr<int16_t[]> last_audio_buffer_;
+  bool resampled_last_output_frame_;
 };
 
 }  // namespace acm2
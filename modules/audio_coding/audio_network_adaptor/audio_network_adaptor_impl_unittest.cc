@@ -27,7 +27,7 @@ namespace webrtc {
 
 using ::testing::_;
 using ::testing::NiceMock;
-using ::testing::Return;
+using ::testing::ReturnRef;
 using ::testing::SetArgPointee;
 
 namespace {
@@ -68,18 +68,21 @@ MATCHER_P(EncoderRuntimeConfigIs, config, "") {
 struct AudioNetworkAdaptorStates {
   std::unique_ptr<AudioNetworkAdaptorImpl> audio_network_adaptor;
   std::vector<std::unique_ptr<MockController>> mock_controllers;
+  // The controller manager returns the vector of controllers by reference, so
+  // give it a stable address that survives moving |this|.
+  std::unique_ptr<std::vector<Controller*>> controller_pointers;
   std::unique_ptr<MockRtcEventLog> event_log;
   MockDebugDumpWriter* mock_debug_dump_writer;
 };
 
 AudioNetworkAdaptorStates CreateAudioNetworkAdaptor() {
   AudioNetworkAdaptorStates states;
-  std::vector<Controller*> controllers;
+  states.controller_pointers.reset(new std::vector<Controller*>());
   for (size_t i = 0; i < kNumControllers; ++i) {
     auto controller =
         std::unique_ptr<MockController>(new NiceMock<MockController>());
     EXPECT_CALL(*controller, Die());
-    controllers.push_back(controller.get());
+    states.controller_pointers->push_back(controller.get());
     states.mock_controllers.push_back(std::move(controller));
   }
 
@@ -88,9 +91,9 @@ AudioNetworkAdaptorStates CreateAudioNetworkAdaptor() {
 
   EXPECT_CALL(*controller_manager, Die());
   EXPECT_CALL(*controller_manager, GetControllers())
-      .WillRepeatedly(Return(controllers));
+      .WillRepeatedly(ReturnRef(*states.controller_pointers));
   EXPECT_CALL(*controller_manager, GetSortedControllers(_))
-      .WillRepeatedly(Return(controllers));
+      .WillRepeatedly(ReturnRef(*states.controller_pointers));
 
   states.event_log.reset(new NiceMock<MockRtcEventLog>());
 
@@ -365,18 +365,23 @@ ControllerManagerImpl::ControllerManagerImpl(
   for (auto& controller : controllers_)
     default_sorted_controllers_.push_back(controller.get());
   sorted_controllers_ = default_sorted_controllers_;
-  for (auto& controller_point : scoring_points) {
-    controller_scoring_points_.insert(std::make_pair(
-        controller_point.first, ScoringPoint(controller_point.second.first,
-                                             controller_point.second.second)));
+  for (auto& controller : default_sorted_controllers_) {
+    auto controller_point = scoring_points.find(controller);
+    if (controller_point == scoring_points.end()) {
+      unscored_controllers_.push_back(controller);
+    } else {
+      scored_controllers_.push_back(ScoredController(
+          controller, ScoringPoint(controller_point->second.first,
+                                   controller_point->second.second)));
+    }
   }
 }
 
 ControllerManagerImpl::~ControllerManagerImpl() = default;
 
-std::vector<Controller*> ControllerManagerImpl::GetSortedControllers(
+const std::vector<Controller*>& ControllerManagerImpl::GetSortedControllers(
     const Controller::NetworkMetrics& metrics) {
-  if (controller_scoring_points_.size() == 0)
+  if (scored_controllers_.empty())
     return default_sorted_controllers_;
 
   if (!metrics.uplink_bandwidth_bps || !metrics.uplink_packet_loss_fraction)
@@ -396,39 +401,41 @@ std::vector<Controller*> ControllerManagerImpl::GetSortedControllers(
     return sorted_controllers_;
 
   // Sort controllers according to the distances of |scoring_point| to the
-  // scoring points of controllers.
+  // scoring points of controllers. The distance of each controller is
+  // computed once up front, so the sort itself only compares plain floats.
   //
   // A controller that does not associate with any scoring point
   // are treated as if
   // 1) they are less important than any controller that has a scoring point,
   // 2) they are equally important to any controller that has no scoring point,
   //    and their relative order will follow |default_sorted_controllers_|.
-  std::vector<Controller*> sorted_controllers(default_sorted_controllers_);
+  for (auto& scored_controller : scored_controllers_) {
+    scored_controller.squared_distance =
+        scored_controller.scoring_point.SquaredDistanceTo(scoring_point);
+  }
   std::stable_sort(
-      sorted_controllers.begin(), sorted_controllers.end(),
-      [this, &scoring_point](const Controller* lhs, const Controller* rhs) {
-        auto lhs_scoring_point = controller_scoring_points_.find(lhs);
-        auto rhs_scoring_point = controller_scoring_points_.find(rhs);
-
-        if (lhs_scoring_point == controller_scoring_points_.end())
-          return false;
-
-        if (rhs_scoring_point == controller_scoring_points_.end())
-          return true;
-
-        return lhs_scoring_point->second.SquaredDistanceTo(scoring_point) <
-               rhs_scoring_point->second.SquaredDistanceTo(scoring_point);
+      scored_controllers_.begin(), scored_controllers_.end(),
+      [](const ScoredController& lhs, const ScoredController& rhs) {
+        return lhs.squared_distance < rhs.squared_distance;
       });
 
+  std::vector<Controller*> sorted_controllers;
+  sorted_controllers.reserve(default_sorted_controllers_.size());
+  for (auto& scored_controller : scored_controllers_)
+    sorted_controllers.push_back(scored_controller.controller);
+  sorted_controllers.insert(sorted_controllers.end(),
+                            unscored_controllers_.begin(),
+                            unscored_controllers_.end());
+
   if (sorted_controllers_ != sorted_controllers) {
-    sorted_controllers_ = sorted_controllers;
+    sorted_controllers_ = std::move(sorted_controllers);
     last_reordering_time_ms_ = now_ms;
     last_scoring_point_ = scoring_point;
   }
   return sorted_controllers_;
 }
 
-std::vector<Controller*> ControllerManagerImpl::GetControllers() const {
+const std::vector<Controller*>& ControllerManagerImpl::GetControllers() const {
   return default_sorted_controllers_;
 }
 
@@ -438,6 +445,13 @@ ControllerManagerImpl::ScoringPoint::ScoringPoint(
     : uplink_bandwidth_bps(uplink_bandwidth_bps),
       uplink_packet_loss_fraction(uplink_packet_loss_fraction) {}
 
+ControllerManagerImpl::ScoredController::ScoredController(
+    Controller* controller,
+    const ScoringPoint& scoring_point)
+    : controller(controller),
+      scoring_point(scoring_point),
+      squared_distance(0.0f) {}
+
 namespace {
 
 constexpr int kMinUplinkBandwidthBps = 0;
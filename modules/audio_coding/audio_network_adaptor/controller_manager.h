@@ -28,10 +28,10 @@ class ControllerManager {
   virtual ~ControllerManager() = default;
 
   // Sort controllers based on their significance.
-  virtual std::vector<Controller*> GetSortedControllers(
+  virtual const std::vector<Controller*>& GetSortedControllers(
       const Controller::NetworkMetrics& metrics) = 0;
 
-  virtual std::vector<Controller*> GetControllers() const = 0;
+  virtual const std::vector<Controller*>& GetControllers() const = 0;
 };
 
 class ControllerManagerImpl final : public ControllerManager {
@@ -81,10 +81,10 @@ class ControllerManagerImpl final : public ControllerManager {
   ~ControllerManagerImpl() override;
 
   // Sort controllers based on their significance.
-  std::vector<Controller*> GetSortedControllers(
+  const std::vector<Controller*>& GetSortedControllers(
       const Controller::NetworkMetrics& metrics) override;
 
-  std::vector<Controller*> GetControllers() const override;
+  const std::vector<Controller*>& GetControllers() const override;
 
  private:
   // Scoring point is a subset of NetworkMetrics that is used for comparing the
@@ -100,6 +100,19 @@ class ControllerManagerImpl final : public ControllerManager {
     float uplink_packet_loss_fraction;
   };
 
+  // A controller that has a scoring point. The scoring points are flattened
+  // out of the configuration at construction, together with a scratch slot
+  // for the distance to the metrics that a reordering is made against, so
+  // that sorting computes each distance once instead of consulting a map per
+  // comparison.
+  struct ScoredController {
+    ScoredController(Controller* controller, const ScoringPoint& scoring_point);
+
+    Controller* controller;
+    ScoringPoint scoring_point;
+    float squared_distance;
+  };
+
   const Config config_;
 
   std::vector<std::unique_ptr<Controller>> controllers_;
@@ -111,9 +124,12 @@ class ControllerManagerImpl final : public ControllerManager {
 
   std::vector<Controller*> sorted_controllers_;
 
-  // |scoring_points_| saves the scoring points of various
-  // controllers.
-  std::map<const Controller*, ScoringPoint> controller_scoring_points_;
+  // Controllers that have scoring points, in their default order.
+  std::vector<ScoredController> scored_controllers_;
+
+  // Controllers that have no scoring points, in their default order. They
+  // rank after all controllers that have scoring points.
+  std::vector<Controller*> unscored_controllers_;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(ControllerManagerImpl);
 };
@@ -22,10 +22,10 @@ class MockControllerManager : public ControllerManager {
  public:
   virtual ~MockControllerManager() { Die(); }
   MOCK_METHOD0(Die, void());
-  MOCK_METHOD1(
-      GetSortedControllers,
-      std::vector<Controller*>(const Controller::NetworkMetrics& metrics));
-  MOCK_CONST_METHOD0(GetControllers, std::vector<Controller*>());
+  MOCK_METHOD1(GetSortedControllers,
+               const std::vector<Controller*>&(
+                   const Controller::NetworkMetrics& metrics));
+  MOCK_CONST_METHOD0(GetControllers, const std::vector<Controller*>&());
 };
 
 }  // namespace webrtc
@@ -66,6 +66,17 @@ constexpr int kOpusSupportedFrameLengths[] = {10, 20, 40, 60};
 // of -1.0 / ln(0.9999) = 10000 ms.
 constexpr float kAlphaForPacketLossFractionSmoother = 0.9999f;
 
+// The adaptive complexity controller smooths the per-10 ms encode time with
+// an exponential filter with a time constant of -10 ms / ln(0.98), i.e.,
+// roughly half a second of audio.
+constexpr float kAlphaForEncodeTimeSmoother = 0.98f;
+// Leave the complexity ceiling unchanged for at least this long after a step,
+// so that the smoothed encode time can settle at the new setting.
+constexpr int kMinComplexityStepIntervalMs = 500;
+// Step the ceiling back up only when the smoothed encode time is well below
+// the budget, to avoid toggling around it.
+constexpr float kComplexityStepUpHeadroom = 0.5f;
+
 // Optimize the loss rate to configure Opus. Basically, optimized loss rate is
 // the input loss rate rounded down to various levels, because a robustly good
 // audio quality is achieved by lowering the packet loss down.
@@ -257,6 +268,40 @@ GetNewPacketLossRateOptimizer() {
   return nullptr;
 }
 
+bool IsValidComplexity(int value) {
+  return value >= 0 && value <= 10;
+}
+
+std::unique_ptr<AudioEncoderOpusImpl::AdaptiveComplexityController>
+GetAdaptiveComplexityController() {
+  constexpr char kAdaptiveComplexityName[] =
+      "WebRTC-Audio-OpusAdaptiveComplexity";
+  if (!webrtc::field_trial::IsEnabled(kAdaptiveComplexityName)) {
+    return nullptr;
+  }
+  const std::string field_trial_string =
+      webrtc::field_trial::FindFullName(kAdaptiveComplexityName);
+  constexpr int kDefaultMinComplexity = 5;
+  constexpr int kDefaultMaxComplexity = 9;
+  constexpr int kDefaultEncodeBudgetUsPer10Ms = 2500;
+  int min_complexity;
+  int max_complexity;
+  int encode_budget_us;
+  if (sscanf(field_trial_string.c_str(), "Enabled-%d-%d-%d", &min_complexity,
+             &max_complexity, &encode_budget_us) == 3 &&
+      IsValidComplexity(min_complexity) && IsValidComplexity(max_complexity) &&
+      min_complexity <= max_complexity && encode_budget_us > 0) {
+    return absl::make_unique<
+        AudioEncoderOpusImpl::AdaptiveComplexityController>(
+        min_complexity, max_complexity, encode_budget_us);
+  }
+  RTC_LOG(LS_WARNING) << "Invalid parameters for " << kAdaptiveComplexityName
+                      << ", using default values.";
+  return absl::make_unique<AudioEncoderOpusImpl::AdaptiveComplexityController>(
+      kDefaultMinComplexity, kDefaultMaxComplexity,
+      kDefaultEncodeBudgetUsPer10Ms);
+}
+
 }  // namespace
 
 AudioEncoderOpusImpl::NewPacketLossRateOptimizer::NewPacketLossRateOptimizer(
@@ -274,6 +319,49 @@ float AudioEncoderOpusImpl::NewPacketLossRateOptimizer::OptimizePacketLossRate(
                   max_packet_loss_rate_);
 }
 
+AudioEncoderOpusImpl::AdaptiveComplexityController::
+    AdaptiveComplexityController(int min_complexity,
+                                 int max_complexity,
+                                 int encode_budget_us_per_10ms)
+    : min_complexity_(min_complexity),
+      max_complexity_(max_complexity),
+      encode_budget_us_per_10ms_(encode_budget_us_per_10ms),
+      complexity_ceiling_(max_complexity),
+      last_step_time_ms_(rtc::TimeMillis()),
+      smoother_(kAlphaForEncodeTimeSmoother) {
+  RTC_DCHECK_LE(min_complexity_, max_complexity_);
+  RTC_DCHECK_GT(encode_budget_us_per_10ms_, 0);
+}
+
+absl::optional<int>
+AudioEncoderOpusImpl::AdaptiveComplexityController::OnEncodeCompleted(
+    int64_t encode_duration_us,
+    size_t num_10ms_frames) {
+  RTC_DCHECK_GT(num_10ms_frames, 0);
+  smoother_.Apply(static_cast<float>(num_10ms_frames),
+                  static_cast<float>(encode_duration_us) / num_10ms_frames);
+  const float average = smoother_.filtered();
+  if (average == rtc::ExpFilter::kValueUndefined) {
+    return absl::nullopt;
+  }
+  const int64_t now_ms = rtc::TimeMillis();
+  if (now_ms - last_step_time_ms_ < kMinComplexityStepIntervalMs) {
+    return absl::nullopt;
+  }
+  if (average > encode_budget_us_per_10ms_ &&
+      complexity_ceiling_ > min_complexity_) {
+    --complexity_ceiling_;
+  } else if (average <
+                 kComplexityStepUpHeadroom * encode_budget_us_per_10ms_ &&
+             complexity_ceiling_ < max_complexity_) {
+    ++complexity_ceiling_;
+  } else {
+    return absl::nullopt;
+  }
+  last_step_time_ms_ = now_ms;
+  return complexity_ceiling_;
+}
+
 void AudioEncoderOpusImpl::AppendSupportedEncoders(
     std::vector<AudioCodecSpec>* specs) {
   const SdpAudioFormat fmt = {"opus",
@@ -435,6 +523,7 @@ AudioEncoderOpusImpl::AudioEncoderOpusImpl(
       packet_loss_rate_(0.0),
       min_packet_loss_rate_(GetMinPacketLossRate()),
       new_packet_loss_optimizer_(GetNewPacketLossRateOptimizer()),
+      complexity_controller_(GetAdaptiveComplexityController()),
       inst_(nullptr),
       packet_loss_fraction_smoother_(new PacketLossFractionSmoother()),
       audio_network_adaptor_creator_(audio_network_adaptor_creator),
@@ -654,33 +743,55 @@ AudioEncoder::EncodedInfo AudioEncoderOpusImpl::EncodeImpl(
   if (input_buffer_.empty())
     first_timestamp_in_buffer_ = rtp_timestamp;
 
-  input_buffer_.insert(input_buffer_.end(), audio.cbegin(), audio.cend());
-  if (input_buffer_.size() <
-      (Num10msFramesPerPacket() * SamplesPer10msFrame())) {
-    return EncodedInfo();
+  const size_t samples_per_packet =
+      Num10msFramesPerPacket() * SamplesPer10msFrame();
+
+  // If the caller-owned buffer holds exactly one packet's worth of audio and
+  // nothing has been accumulated, encode straight from it without going
+  // through |input_buffer_|. The caller's buffer is only guaranteed to be
+  // valid for the duration of this call, so partial packets must still be
+  // copied and aggregated in |input_buffer_|.
+  rtc::ArrayView<const int16_t> frame_to_encode = audio;
+  if (!input_buffer_.empty() || audio.size() != samples_per_packet) {
+    input_buffer_.insert(input_buffer_.end(), audio.cbegin(), audio.cend());
+    if (input_buffer_.size() < samples_per_packet) {
+      return EncodedInfo();
+    }
+    RTC_CHECK_EQ(input_buffer_.size(), samples_per_packet);
+    frame_to_encode = input_buffer_;
   }
-  RTC_CHECK_EQ(input_buffer_.size(),
-               Num10msFramesPerPacket() * SamplesPer10msFrame());
 
   const size_t max_encoded_bytes = SufficientOutputBufferSize();
+  const int64_t start_time_us = complexity_controller_ ? rtc::TimeMicros() : 0;
   EncodedInfo info;
   info.encoded_bytes = encoded->AppendData(
       max_encoded_bytes, [&](rtc::ArrayView<uint8_t> encoded) {
         int status = WebRtcOpus_Encode(
-            inst_, &input_buffer_[0],
-            rtc::CheckedDivExact(input_buffer_.size(), config_.num_channels),
+            inst_, frame_to_encode.data(),
+            rtc::CheckedDivExact(frame_to_encode.size(),
+                                 config_.num_channels),
             rtc::saturated_cast<int16_t>(max_encoded_bytes), encoded.data());
 
         RTC_CHECK_GE(status, 0);  // Fails only if fed invalid data.
 
         return static_cast<size_t>(status);
       });
+  if (complexity_controller_ &&
+      complexity_controller_->OnEncodeCompleted(
+          rtc::TimeMicros() - start_time_us, Num10msFramesPerPacket())) {
+    ApplyComplexity();
+  }
   input_buffer_.clear();
 
   bool dtx_frame = (info.encoded_bytes <= 2);
 
   // Will use new packet size for next encoding.
-  config_.frame_size_ms = next_frame_length_ms_;
+  if (config_.frame_size_ms != next_frame_length_ms_) {
+    config_.frame_size_ms = next_frame_length_ms_;
+    // Make sure the aggregation buffer will not have to reallocate while
+    // packets are being assembled at the new frame length.
+    input_buffer_.reserve(Num10msFramesPerPacket() * SamplesPer10msFrame());
+  }
 
   if (adjust_bandwidth_ && bitrate_changed_) {
     const auto bandwidth = GetNewBandwidth(config_, inst_);
@@ -756,7 +867,7 @@ bool AudioEncoderOpusImpl::RecreateEncoderInstance(
   // Use the default complexity if the start bitrate is within the hysteresis
   // window.
   complexity_ = GetNewComplexity(config).value_or(config.complexity);
-  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+  ApplyComplexity();
   bitrate_changed_ = true;
   if (config.dtx_enabled) {
     RTC_CHECK_EQ(0, WebRtcOpus_EnableDtx(inst_));
@@ -823,8 +934,17 @@ void AudioEncoderOpusImpl::SetTargetBitrate(int bits_per_second) {
   const auto new_complexity = GetNewComplexity(config_);
   if (new_complexity && complexity_ != *new_complexity) {
     complexity_ = *new_complexity;
-    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+    ApplyComplexity();
+  }
+}
+
+void AudioEncoderOpusImpl::ApplyComplexity() {
+  int complexity = complexity_;
+  if (complexity_controller_) {
+    complexity =
+        std::min(complexity, complexity_controller_->complexity_ceiling());
   }
+  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity));
 }
 
 void AudioEncoderOpusImpl::ApplyAudioNetworkAdaptor() {
@@ -24,6 +24,7 @@
 #include "modules/audio_coding/audio_network_adaptor/include/audio_network_adaptor.h"
 #include "modules/audio_coding/codecs/opus/opus_interface.h"
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/numerics/exp_filter.h"
 
 namespace webrtc {
 
@@ -51,6 +52,41 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
     RTC_DISALLOW_COPY_AND_ASSIGN(NewPacketLossRateOptimizer);
   };
 
+  // Adapts the Opus complexity to the observed encode time. The controller
+  // maintains a ceiling on the complexity, which it steps down when the
+  // smoothed encode time per 10 ms of audio exceeds the configured budget,
+  // and back up when the encoder has ample headroom. The ceiling is combined
+  // with the bitrate-based complexity by taking the minimum of the two, so
+  // the two mechanisms stay independent.
+  class AdaptiveComplexityController {
+   public:
+    AdaptiveComplexityController(int min_complexity,
+                                 int max_complexity,
+                                 int encode_budget_us_per_10ms);
+
+    // Adds one observation of the time it took to encode |num_10ms_frames|
+    // frames of audio. Returns a new complexity ceiling if it changed, or
+    // empty if the current one should be kept.
+    absl::optional<int> OnEncodeCompleted(int64_t encode_duration_us,
+                                          size_t num_10ms_frames);
+
+    int complexity_ceiling() const { return complexity_ceiling_; }
+
+    // Getters for testing.
+    int min_complexity() const { return min_complexity_; }
+    int max_complexity() const { return max_complexity_; }
+    int encode_budget_us_per_10ms() const { return encode_budget_us_per_10ms_; }
+
+   private:
+    const int min_complexity_;
+    const int max_complexity_;
+    const int encode_budget_us_per_10ms_;
+    int complexity_ceiling_;
+    int64_t last_step_time_ms_;
+    rtc::ExpFilter smoother_;
+    RTC_DISALLOW_COPY_AND_ASSIGN(AdaptiveComplexityController);
+  };
+
   // Returns empty if the current bitrate falls within the hysteresis window,
   // defined by complexity_threshold_bps +/- complexity_threshold_window_bps.
   // Otherwise, returns the current complexity depending on whether the
@@ -124,6 +160,9 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   NewPacketLossRateOptimizer* new_packet_loss_optimizer() const {
     return new_packet_loss_optimizer_.get();
   }
+  AdaptiveComplexityController* complexity_controller() const {
+    return complexity_controller_.get();
+  }
   AudioEncoderOpusConfig::ApplicationMode application() const {
     return config_.application;
   }
@@ -155,6 +194,10 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   void SetNumChannelsToEncode(size_t num_channels_to_encode);
   void SetProjectedPacketLossRate(float fraction);
 
+  // Applies |complexity_|, clamped to the adaptive complexity ceiling when
+  // the controller is active, to the encoder instance.
+  void ApplyComplexity();
+
   void OnReceivedUplinkBandwidth(
       int target_audio_bitrate_bps,
       absl::optional<int64_t> bwe_period_ms,
@@ -180,6 +223,7 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   float packet_loss_rate_;
   const float min_packet_loss_rate_;
   const std::unique_ptr<NewPacketLossRateOptimizer> new_packet_loss_optimizer_;
+  const std::unique_ptr<AdaptiveComplexityController> complexity_controller_;
   std::vector<int16_t> input_buffer_;
   OpusEncInst* inst_;
   uint32_t first_timestamp_in_buffer_;
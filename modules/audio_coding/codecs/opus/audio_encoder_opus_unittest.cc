@@ -552,6 +552,64 @@ TEST_P(AudioEncoderOpusTest, NewPacketLossRateOptimizer) {
   }
 }
 
+TEST_P(AudioEncoderOpusTest, AdaptiveComplexityControllerFromFieldTrial) {
+  {
+    auto states = CreateCodec(sample_rate_hz_, 1);
+    EXPECT_EQ(nullptr, states->encoder->complexity_controller());
+  }
+  {
+    test::ScopedFieldTrials override_field_trials(
+        "WebRTC-Audio-OpusAdaptiveComplexity/Enabled/");
+    auto states = CreateCodec(sample_rate_hz_, 1);
+    auto* controller = states->encoder->complexity_controller();
+    ASSERT_NE(nullptr, controller);
+    EXPECT_EQ(5, controller->min_complexity());
+    EXPECT_EQ(9, controller->max_complexity());
+    EXPECT_EQ(2500, controller->encode_budget_us_per_10ms());
+  }
+  {
+    test::ScopedFieldTrials override_field_trials(
+        "WebRTC-Audio-OpusAdaptiveComplexity/Enabled-3-10-1500/");
+    auto states = CreateCodec(sample_rate_hz_, 1);
+    auto* controller = states->encoder->complexity_controller();
+    ASSERT_NE(nullptr, controller);
+    EXPECT_EQ(3, controller->min_complexity());
+    EXPECT_EQ(10, controller->max_complexity());
+    EXPECT_EQ(1500, controller->encode_budget_us_per_10ms());
+  }
+}
+
+TEST(AudioEncoderOpusTest, AdaptiveComplexityControllerStepsWithLoad) {
+  rtc::ScopedFakeClock fake_clock;
+  fake_clock.SetTime(Timestamp::us(kInitialTimeUs));
+  constexpr int kBudgetUsPer10Ms = 1000;
+  AudioEncoderOpusImpl::AdaptiveComplexityController controller(
+      5, 9, kBudgetUsPer10Ms);
+  EXPECT_EQ(9, controller.complexity_ceiling());
+
+  // Feed encode times well above the budget. The ceiling must step down one
+  // notch at a time, at most once per adjustment interval.
+  absl::optional<int> new_complexity;
+  for (int i = 0; i < 200 && controller.complexity_ceiling() > 5; ++i) {
+    fake_clock.AdvanceTime(TimeDelta::ms(20));
+    new_complexity = controller.OnEncodeCompleted(2 * 2 * kBudgetUsPer10Ms, 2);
+    if (new_complexity) {
+      EXPECT_EQ(controller.complexity_ceiling(), *new_complexity);
+    }
+  }
+  // The ceiling must never drop below the configured minimum.
+  EXPECT_EQ(5, controller.complexity_ceiling());
+  fake_clock.AdvanceTime(TimeDelta::ms(1000));
+  EXPECT_FALSE(controller.OnEncodeCompleted(2 * 2 * kBudgetUsPer10Ms, 2));
+
+  // With the load gone, the ceiling must recover to the maximum.
+  for (int i = 0; i < 500 && controller.complexity_ceiling() < 9; ++i) {
+    fake_clock.AdvanceTime(TimeDelta::ms(20));
+    controller.OnEncodeCompleted(2 * kBudgetUsPer10Ms / 10, 2);
+  }
+  EXPECT_EQ(9, controller.complexity_ceiling());
+}
+
 // Verifies that the complexity adaptation in the config works as intended.
 TEST(AudioEncoderOpusTest, ConfigComplexityAdaptation) {
   AudioEncoderOpusConfig config;
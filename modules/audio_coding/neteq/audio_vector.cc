@@ -18,16 +18,27 @@
 #include "rtc_base/checks.h"
 
 namespace webrtc {
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+  return result;
+}
+
+}  // namespace
 
 AudioVector::AudioVector() : AudioVector(kDefaultInitialSize) {
   Clear();
 }
 
 AudioVector::AudioVector(size_t initial_size)
-    : array_(new int16_t[initial_size + 1]),
-      capacity_(initial_size + 1),
+    : capacity_(RoundUpToPowerOfTwo(initial_size + 1)),
+      array_(new int16_t[capacity_]),
       begin_index_(0),
-      end_index_(capacity_ - 1) {
+      end_index_(initial_size) {
   memset(array_.get(), 0, capacity_ * sizeof(int16_t));
 }
 
@@ -51,7 +62,7 @@ void AudioVector::CopyTo(size_t length,
   if (length == 0)
     return;
   length = std::min(length, Size() - position);
-  const size_t copy_index = (begin_index_ + position) % capacity_;
+  const size_t copy_index = (begin_index_ + position) & (capacity_ - 1);
   const size_t first_chunk_length = std::min(length, capacity_ - copy_index);
   memcpy(copy_to, &array_[copy_index], first_chunk_length * sizeof(int16_t));
   const size_t remaining_length = length - first_chunk_length;
@@ -92,7 +103,7 @@ void AudioVector::PushFront(const int16_t* prepend_this, size_t length) {
     memcpy(&array_[capacity_ - remaining_length], prepend_this,
            remaining_length * sizeof(int16_t));
   }
-  begin_index_ = (begin_index_ + capacity_ - length) % capacity_;
+  begin_index_ = (begin_index_ + capacity_ - length) & (capacity_ - 1);
 }
 
 void AudioVector::PushBack(const AudioVector& append_this) {
@@ -113,7 +124,7 @@ void AudioVector::PushBack(const AudioVector& append_this,
   Reserve(Size() + length);
 
   const size_t start_index =
-      (append_this.begin_index_ + position) % append_this.capacity_;
+      (append_this.begin_index_ + position) & (append_this.capacity_ - 1);
   const size_t first_chunk_length =
       std::min(length, append_this.capacity_ - start_index);
   PushBack(&append_this.array_[start_index], first_chunk_length);
@@ -135,14 +146,14 @@ void AudioVector::PushBack(const int16_t* append_this, size_t length) {
     memcpy(array_.get(), &append_this[first_chunk_length],
            remaining_length * sizeof(int16_t));
   }
-  end_index_ = (end_index_ + length) % capacity_;
+  end_index_ = (end_index_ + length) & (capacity_ - 1);
 }
 
 void AudioVector::PopFront(size_t length) {
   if (length == 0)
     return;
   length = std::min(length, Size());
-  begin_index_ = (begin_index_ + length) % capacity_;
+  begin_index_ = (begin_index_ + length) & (capacity_ - 1);
 }
 
 void AudioVector::PopBack(size_t length) {
@@ -150,7 +161,7 @@ void AudioVector::PopBack(size_t length) {
     return;
   // Never remove more than what is in the array.
   length = std::min(length, Size());
-  end_index_ = (end_index_ + capacity_ - length) % capacity_;
+  end_index_ = (end_index_ + capacity_ - length) & (capacity_ - 1);
 }
 
 void AudioVector::Extend(size_t extra_length) {
@@ -230,7 +241,7 @@ void AudioVector::OverwriteAt(const int16_t* insert_this,
   size_t new_size = std::max(Size(), position + length);
   Reserve(new_size);
 
-  const size_t overwrite_index = (begin_index_ + position) % capacity_;
+  const size_t overwrite_index = (begin_index_ + position) & (capacity_ - 1);
   const size_t first_chunk_length =
       std::min(length, capacity_ - overwrite_index);
   memcpy(&array_[overwrite_index], insert_this,
@@ -241,7 +252,7 @@ void AudioVector::OverwriteAt(const int16_t* insert_this,
            remaining_length * sizeof(int16_t));
   }
 
-  end_index_ = (begin_index_ + new_size) % capacity_;
+  end_index_ = (begin_index_ + new_size) & (capacity_ - 1);
 }
 
 void AudioVector::CrossFade(const AudioVector& append_this,
@@ -260,8 +271,8 @@ void AudioVector::CrossFade(const AudioVector& append_this,
   int alpha = 16384;
   for (size_t i = 0; i < fade_length; ++i) {
     alpha -= alpha_step;
-    array_[(position + i) % capacity_] =
-        (alpha * array_[(position + i) % capacity_] +
+    array_[(position + i) & (capacity_ - 1)] =
+        (alpha * array_[(position + i) & (capacity_ - 1)] +
          (16384 - alpha) * append_this[i] + 8192) >>
         14;
   }
@@ -274,7 +285,7 @@ void AudioVector::CrossFade(const AudioVector& append_this,
 
 // Returns the number of elements in this AudioVector.
 size_t AudioVector::Size() const {
-  return (end_index_ + capacity_ - begin_index_) % capacity_;
+  return (end_index_ + capacity_ - begin_index_) & (capacity_ - 1);
 }
 
 // Returns true if this AudioVector is empty.
@@ -288,14 +299,16 @@ void AudioVector::Reserve(size_t n) {
   const size_t length = Size();
   // Reserve one more sample to remove the ambiguity between empty vector and
   // full vector. Therefore |begin_index_| == |end_index_| indicates empty
-  // vector, and |begin_index_| == (|end_index_| + 1) % capacity indicates
-  // full vector.
-  std::unique_ptr<int16_t[]> temp_array(new int16_t[n + 1]);
+  // vector, and |begin_index_| == (|end_index_| + 1) & (capacity - 1)
+  // indicates full vector. The capacity is rounded up to a power of two, so
+  // that the ring indices can be wrapped with a bit mask instead of modulo.
+  const size_t new_capacity = RoundUpToPowerOfTwo(n + 1);
+  std::unique_ptr<int16_t[]> temp_array(new int16_t[new_capacity]);
   CopyTo(length, 0, temp_array.get());
   array_.swap(temp_array);
   begin_index_ = 0;
   end_index_ = length;
-  capacity_ = n + 1;
+  capacity_ = new_capacity;
 }
 
 void AudioVector::InsertByPushBack(const int16_t* insert_this,
@@ -350,7 +363,7 @@ void AudioVector::InsertZerosByPushBack(size_t length, size_t position) {
   const size_t remaining_zero_length = length - first_zero_chunk_length;
   if (remaining_zero_length > 0)
     memset(array_.get(), 0, remaining_zero_length * sizeof(int16_t));
-  end_index_ = (end_index_ + length) % capacity_;
+  end_index_ = (end_index_ + length) & (capacity_ - 1);
 
   if (move_chunk_length > 0)
     PushBack(temp_array.get(), move_chunk_length);
@@ -373,7 +386,7 @@ void AudioVector::InsertZerosByPushFront(size_t length, size_t position) {
   if (remaining_zero_length > 0)
     memset(&array_[capacity_ - remaining_zero_length], 0,
            remaining_zero_length * sizeof(int16_t));
-  begin_index_ = (begin_index_ + capacity_ - length) % capacity_;
+  begin_index_ = (begin_index_ + capacity_ - length) & (capacity_ - 1);
 
   if (position > 0)
     PushFront(temp_array.get(), position);
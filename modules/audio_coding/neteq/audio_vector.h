@@ -125,19 +125,15 @@ class AudioVector {
   static const size_t kDefaultInitialSize = 10;
 
   // This method is used by the [] operators to calculate an index within the
-  // capacity of the array, but without using the modulo operation (%).
+  // capacity of the array. Since |capacity| is always a power of two, the
+  // wrap-around is a simple bit mask instead of a modulo operation.
   static inline size_t WrapIndex(size_t index,
                                  size_t begin_index,
                                  size_t capacity) {
+    RTC_DCHECK_EQ(capacity & (capacity - 1), 0);  // Must be a power of two.
     RTC_DCHECK_LT(index, capacity);
     RTC_DCHECK_LT(begin_index, capacity);
-    size_t ix = begin_index + index;
-    RTC_DCHECK_GE(ix, index);  // Check for overflow.
-    if (ix >= capacity) {
-      ix -= capacity;
-    }
-    RTC_DCHECK_LT(ix, capacity);
-    return ix;
+    return (begin_index + index) & (capacity - 1);
   }
 
   void Reserve(size_t n);
@@ -154,9 +150,12 @@ class AudioVector {
 
   void InsertZerosByPushFront(size_t length, size_t position);
 
-  std::unique_ptr<int16_t[]> array_;
+  // Allocated number of samples in the array; always a power of two, so that
+  // ring indices can be wrapped with a bit mask instead of modulo. Declared
+  // before |array_| since the constructor uses it for the allocation.
+  size_t capacity_;
 
-  size_t capacity_;  // Allocated number of samples in the array.
+  std::unique_ptr<int16_t[]> array_;
 
   // The index of the first sample in |array_|, except when
   // |begin_index_ == end_index_|, which indicates an empty buffer.
@@ -16,6 +16,14 @@
 #include <algorithm>  // Access to min, max.
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
@@ -279,7 +287,77 @@ void DspHelper::CrossFade(const int16_t* input1,
                           int16_t* output) {
   int16_t factor = *mix_factor;
   int16_t complement_factor = 16384 - factor;
-  for (size_t i = 0; i < length; i++) {
+  size_t i = 0;
+  // The vectorized loops below keep one ramped factor per lane and perform
+  // the same arithmetic per sample as the scalar loop, so the result is
+  // bit-exact.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  {
+    const __m128i step = _mm_set1_epi16(factor_decrement);
+    const __m128i lane_index = _mm_set_epi16(7, 6, 5, 4, 3, 2, 1, 0);
+    __m128i factors = _mm_sub_epi16(_mm_set1_epi16(factor),
+                                    _mm_mullo_epi16(step, lane_index));
+    const __m128i total = _mm_set1_epi16(16384);
+    const __m128i step_times_8 = _mm_slli_epi16(step, 3);
+    const __m128i round = _mm_set1_epi32(8192);
+    for (; i + 8 <= length; i += 8) {
+      const __m128i complements = _mm_sub_epi16(total, factors);
+      const __m128i in1 =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(input1 + i));
+      const __m128i in2 =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(input2 + i));
+      // Expand the 16x16 bit products to 32 bits.
+      const __m128i lo1 = _mm_mullo_epi16(in1, factors);
+      const __m128i hi1 = _mm_mulhi_epi16(in1, factors);
+      const __m128i lo2 = _mm_mullo_epi16(in2, complements);
+      const __m128i hi2 = _mm_mulhi_epi16(in2, complements);
+      __m128i sum0 = _mm_add_epi32(_mm_unpacklo_epi16(lo1, hi1),
+                                   _mm_unpacklo_epi16(lo2, hi2));
+      __m128i sum1 = _mm_add_epi32(_mm_unpackhi_epi16(lo1, hi1),
+                                   _mm_unpackhi_epi16(lo2, hi2));
+      sum0 = _mm_srai_epi32(_mm_add_epi32(sum0, round), 14);
+      sum1 = _mm_srai_epi32(_mm_add_epi32(sum1, round), 14);
+      // Truncate to 16 bits with the same wrap-around behavior as the cast
+      // in the scalar loop.
+      sum0 = _mm_srai_epi32(_mm_slli_epi32(sum0, 16), 16);
+      sum1 = _mm_srai_epi32(_mm_slli_epi32(sum1, 16), 16);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),
+                       _mm_packs_epi32(sum0, sum1));
+      factors = _mm_sub_epi16(factors, step_times_8);
+    }
+    factor = static_cast<int16_t>(_mm_extract_epi16(factors, 0));
+    complement_factor = 16384 - factor;
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  {
+    const int16_t lane_index_init[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    const int16x8_t lane_index = vld1q_s16(lane_index_init);
+    const int16x8_t step = vdupq_n_s16(factor_decrement);
+    int16x8_t factors =
+        vsubq_s16(vdupq_n_s16(factor), vmulq_s16(step, lane_index));
+    const int16x8_t total = vdupq_n_s16(16384);
+    const int16x8_t step_times_8 = vshlq_n_s16(step, 3);
+    const int32x4_t round = vdupq_n_s32(8192);
+    for (; i + 8 <= length; i += 8) {
+      const int16x8_t complements = vsubq_s16(total, factors);
+      const int16x8_t in1 = vld1q_s16(input1 + i);
+      const int16x8_t in2 = vld1q_s16(input2 + i);
+      int32x4_t sum0 =
+          vmlal_s16(vmull_s16(vget_low_s16(in1), vget_low_s16(factors)),
+                    vget_low_s16(in2), vget_low_s16(complements));
+      int32x4_t sum1 =
+          vmlal_s16(vmull_s16(vget_high_s16(in1), vget_high_s16(factors)),
+                    vget_high_s16(in2), vget_high_s16(complements));
+      sum0 = vshrq_n_s32(vaddq_s32(sum0, round), 14);
+      sum1 = vshrq_n_s32(vaddq_s32(sum1, round), 14);
+      vst1q_s16(output + i, vcombine_s16(vmovn_s32(sum0), vmovn_s32(sum1)));
+      factors = vsubq_s16(factors, step_times_8);
+    }
+    factor = vgetq_lane_s16(factors, 0);
+    complement_factor = 16384 - factor;
+  }
+#endif
+  for (; i < length; i++) {
     output[i] =
         (factor * input1[i] + complement_factor * input2[i] + 8192) >> 14;
     factor -= factor_decrement;
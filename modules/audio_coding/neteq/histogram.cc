@@ -20,10 +20,20 @@
 
 namespace webrtc {
 
+namespace {
+
+// When the lazily maintained global scale factor has decayed below this
+// threshold, it is folded into the buckets to preserve precision. With the
+// default forgetting factor this happens roughly every 2000 updates.
+constexpr double kMinScale = 0.25;
+
+}  // namespace
+
 Histogram::Histogram(size_t num_buckets,
                      int forget_factor,
                      absl::optional<double> start_forget_weight)
-    : buckets_(num_buckets, 0),
+    : buckets_(num_buckets, 0.0),
+      scale_(1.0),
       forget_factor_(0),
       base_forget_factor_(forget_factor),
       add_count_(0),
@@ -33,15 +43,16 @@ Histogram::Histogram(size_t num_buckets,
 
 Histogram::~Histogram() {}
 
-// Each element in the vector is first multiplied by the forgetting factor
-// |forget_factor_|. Then the vector element indicated by |iat_packets| is then
+// Each element in the vector is multiplied by the forgetting factor
+// |forget_factor_|. Then the vector element indicated by |iat_packets| is
 // increased (additive) by 1 - |forget_factor_|. This way, the probability of
 // |value| is slightly increased, while the sum of the histogram remains
 // constant (=1).
-// Due to inaccuracies in the fixed-point arithmetic, the histogram may no
-// longer sum up to 1 (in Q30) after the update. To correct this, a correction
-// term is added or subtracted from the first element (or elements) of the
-// vector.
+// The multiplication of every bucket is done lazily: instead of touching the
+// whole vector, the global |scale_| factor is multiplied by the forgetting
+// factor, and the increment for |value| is divided by |scale_| to compensate.
+// This makes the per-update cost a single bucket increment; the full vector
+// is only walked when |scale_| is folded into the buckets.
 // The forgetting factor |forget_factor_| is also updated. When the DelayManager
 // is reset, the factor is set to 0 to facilitate rapid convergence in the
 // beginning. With each update of the histogram, the factor is increased towards
@@ -49,36 +60,22 @@ Histogram::~Histogram() {}
 void Histogram::Add(int value) {
   RTC_DCHECK(value >= 0);
   RTC_DCHECK(value < static_cast<int>(buckets_.size()));
-  int vector_sum = 0;  // Sum up the vector elements as they are processed.
-  // Multiply each element in |buckets_| with |forget_factor_|.
-  for (int& bucket : buckets_) {
-    bucket = (static_cast<int64_t>(bucket) * forget_factor_) >> 15;
-    vector_sum += bucket;
-  }
-
-  // Increase the probability for the currently observed inter-arrival time
-  // by 1 - |forget_factor_|. The factor is in Q15, |buckets_| in Q30.
-  // Thus, left-shift 15 steps to obtain result in Q30.
-  buckets_[value] += (32768 - forget_factor_) << 15;
-  vector_sum += (32768 - forget_factor_) << 15;  // Add to vector sum.
-
-  // |buckets_| should sum up to 1 (in Q30), but it may not due to
-  // fixed-point rounding errors.
-  vector_sum -= 1 << 30;  // Should be zero. Compensate if not.
-  if (vector_sum != 0) {
-    // Modify a few values early in |buckets_|.
-    int flip_sign = vector_sum > 0 ? -1 : 1;
-    for (int& bucket : buckets_) {
-      // Add/subtract 1/16 of the element, but not more than |vector_sum|.
-      int correction = flip_sign * std::min(std::abs(vector_sum), bucket >> 4);
-      bucket += correction;
-      vector_sum += correction;
-      if (std::abs(vector_sum) == 0) {
-        break;
-      }
+  const double forget_factor = forget_factor_ / 32768.0;
+  if (forget_factor == 0.0) {
+    // All history is forgotten at once; this happens on the first update
+    // after a reset.
+    std::fill(buckets_.begin(), buckets_.end(), 0.0);
+    scale_ = 1.0;
+    buckets_[value] = 1 << 30;
+  } else {
+    scale_ *= forget_factor;
+    if (scale_ < kMinScale) {
+      Normalize();
     }
+    // Increase the probability for the currently observed inter-arrival time
+    // by 1 - |forget_factor|, compensating for the global scale.
+    buckets_[value] += (1.0 - forget_factor) * (1 << 30) / scale_;
   }
-  RTC_DCHECK(vector_sum == 0);  // Verify that the above is correct.
 
   ++add_count_;
 
@@ -113,16 +110,16 @@ int Histogram::Quantile(int probability) {
   // (in Q30) by definition, and since the solution is often a low value for
   // |iat_index|, it is more efficient to start with |sum| = 1 and subtract
   // elements from the start of the histogram.
-  int inverse_probability = (1 << 30) - probability;
+  const double inverse_probability = (1 << 30) - probability;
   size_t index = 0;        // Start from the beginning of |buckets_|.
-  int sum = 1 << 30;       // Assign to 1 in Q30.
-  sum -= buckets_[index];
+  double sum = 1 << 30;    // Assign to 1 in Q30.
+  sum -= scale_ * buckets_[index];
 
   while ((sum > inverse_probability) && (index < buckets_.size() - 1)) {
     // Subtract the probabilities one by one until the sum is no longer greater
     // than |inverse_probability|.
     ++index;
-    sum -= buckets_[index];
+    sum -= scale_ * buckets_[index];
   }
   return static_cast<int>(index);
 }
@@ -134,10 +131,11 @@ void Histogram::Reset() {
   // Set temp_prob to (slightly more than) 1 in Q14. This ensures that the sum
   // of buckets_ is 1.
   uint16_t temp_prob = 0x4002;  // 16384 + 2 = 100000000000010 binary.
-  for (int& bucket : buckets_) {
+  for (double& bucket : buckets_) {
     temp_prob >>= 1;
     bucket = temp_prob << 16;
   }
+  scale_ = 1.0;
   forget_factor_ = 0;  // Adapt the histogram faster for the first few packets.
   add_count_ = 0;
 }
@@ -147,7 +145,34 @@ int Histogram::NumBuckets() const {
 }
 
 void Histogram::Scale(int old_bucket_width, int new_bucket_width) {
-  buckets_ = ScaleBuckets(buckets_, old_bucket_width, new_bucket_width);
+  const std::vector<int> scaled =
+      ScaleBuckets(buckets(), old_bucket_width, new_bucket_width);
+  buckets_.assign(scaled.begin(), scaled.end());
+  scale_ = 1.0;
+}
+
+std::vector<int> Histogram::buckets() const {
+  std::vector<int> buckets(buckets_.size());
+  int64_t sum = 0;
+  for (size_t i = 0; i < buckets_.size(); ++i) {
+    buckets[i] = static_cast<int>(scale_ * buckets_[i]);
+    sum += buckets[i];
+  }
+  // The histogram should sum up to 1 (in Q30). Put any residue from the
+  // truncation above into the largest bucket, where it matters the least.
+  if (sum > 0) {
+    const int64_t residual = (1ll << 30) - sum;
+    auto largest = std::max_element(buckets.begin(), buckets.end());
+    *largest = rtc::saturated_cast<int>(*largest + residual);
+  }
+  return buckets;
+}
+
+void Histogram::Normalize() {
+  for (double& bucket : buckets_) {
+    bucket *= scale_;
+  }
+  scale_ = 1.0;
 }
 
 std::vector<int> Histogram::ScaleBuckets(const std::vector<int>& buckets,
@@ -45,7 +45,7 @@ class Histogram {
   virtual int NumBuckets() const;
 
   // Returns the probability for each bucket in Q30.
-  std::vector<int> buckets() const { return buckets_; }
+  std::vector<int> buckets() const;
 
   // Made public for testing.
   static std::vector<int> ScaleBuckets(const std::vector<int>& buckets,
@@ -60,7 +60,15 @@ class Histogram {
   }
 
  private:
-  std::vector<int> buckets_;
+  // Folds |scale_| into |buckets_| and resets it to 1.
+  void Normalize();
+
+  // The forgetting is applied lazily: the probability of bucket |i| in Q30 is
+  // |buckets_[i]| * |scale_|, so Add() only has to touch one bucket instead
+  // of scaling the whole vector. |scale_| is folded into the buckets when it
+  // has decayed below a threshold.
+  std::vector<double> buckets_;
+  double scale_;
   int forget_factor_;  // Q15
   const int base_forget_factor_;
   int add_count_;
@@ -51,6 +51,7 @@ class Merge;
 class NackTracker;
 class Normal;
 class PacketBuffer;
+class PayloadBufferPool;
 class RedPayloadSplitter;
 class PostDecodeVad;
 class PreemptiveExpand;
@@ -114,6 +115,7 @@ class NetEqImpl : public webrtc::NetEq {
     std::unique_ptr<DelayManager> delay_manager;
     std::unique_ptr<DtmfBuffer> dtmf_buffer;
     std::unique_ptr<DtmfToneGenerator> dtmf_tone_generator;
+    std::unique_ptr<PayloadBufferPool> payload_pool;
     std::unique_ptr<PacketBuffer> packet_buffer;
     std::unique_ptr<RedPayloadSplitter> red_payload_splitter;
     std::unique_ptr<TimestampScaler> timestamp_scaler;
@@ -360,6 +362,10 @@ class NetEqImpl : public webrtc::NetEq {
   const std::unique_ptr<DtmfBuffer> dtmf_buffer_ RTC_GUARDED_BY(crit_sect_);
   const std::unique_ptr<DtmfToneGenerator> dtmf_tone_generator_
       RTC_GUARDED_BY(crit_sect_);
+  // Declared before |packet_buffer_|, which reclaims payload storage into
+  // the pool when it is destroyed.
+  const std::unique_ptr<PayloadBufferPool> payload_pool_
+      RTC_GUARDED_BY(crit_sect_);
   const std::unique_ptr<PacketBuffer> packet_buffer_ RTC_GUARDED_BY(crit_sect_);
   const std::unique_ptr<RedPayloadSplitter> red_payload_splitter_
       RTC_GUARDED_BY(crit_sect_);
@@ -22,6 +22,7 @@
 
 #include "api/audio_codecs/audio_decoder.h"
 #include "modules/audio_coding/neteq/decoder_database.h"
+#include "modules/audio_coding/neteq/payload_buffer_pool.h"
 #include "modules/audio_coding/neteq/statistics_calculator.h"
 #include "modules/audio_coding/neteq/tick_timer.h"
 #include "rtc_base/checks.h"
@@ -64,8 +65,11 @@ void LogPacketDiscarded(int codec_level, StatisticsCalculator* stats) {
 }  // namespace
 
 PacketBuffer::PacketBuffer(size_t max_number_of_packets,
-                           const TickTimer* tick_timer)
-    : max_number_of_packets_(max_number_of_packets), tick_timer_(tick_timer) {}
+                           const TickTimer* tick_timer,
+                           PayloadBufferPool* payload_pool)
+    : max_number_of_packets_(max_number_of_packets),
+      tick_timer_(tick_timer),
+      payload_pool_(payload_pool) {}
 
 // Destructor. All packets in the buffer will be destroyed.
 PacketBuffer::~PacketBuffer() {
@@ -74,6 +78,12 @@ PacketBuffer::~PacketBuffer() {
 
 // Flush the buffer. All packets in the buffer will be destroyed.
 void PacketBuffer::Flush() {
+  if (payload_pool_) {
+    // Bulk-reclaim the payload storage before the packets are destroyed.
+    for (Packet& packet : buffer_) {
+      payload_pool_->Reclaim(&packet.payload);
+    }
+  }
   buffer_.clear();
 }
 
@@ -113,6 +123,9 @@ int PacketBuffer::InsertPacket(Packet&& packet, StatisticsCalculator* stats) {
   // packet to list.
   if (rit != buffer_.rend() && packet.timestamp == rit->timestamp) {
     LogPacketDiscarded(packet.priority.codec_level, stats);
+    if (payload_pool_) {
+      payload_pool_->Reclaim(&packet.payload);
+    }
     return return_val;
   }
 
@@ -122,6 +135,9 @@ int PacketBuffer::InsertPacket(Packet&& packet, StatisticsCalculator* stats) {
   PacketList::iterator it = rit.base();
   if (it != buffer_.end() && packet.timestamp == it->timestamp) {
     LogPacketDiscarded(it->priority.codec_level, stats);
+    if (payload_pool_) {
+      payload_pool_->Reclaim(&it->payload);
+    }
     it = buffer_.erase(it);
   }
   buffer_.insert(it, std::move(packet));  // Insert the packet at that position.
@@ -228,9 +244,12 @@ int PacketBuffer::DiscardNextPacket(StatisticsCalculator* stats) {
     return kBufferEmpty;
   }
   // Assert that the packet sanity checks in InsertPacket method works.
-  const Packet& packet = buffer_.front();
+  Packet& packet = buffer_.front();
   RTC_DCHECK(!packet.empty());
   LogPacketDiscarded(packet.priority.codec_level, stats);
+  if (payload_pool_) {
+    payload_pool_->Reclaim(&packet.payload);
+  }
   buffer_.pop_front();
   return kOK;
 }
@@ -238,12 +257,16 @@ int PacketBuffer::DiscardNextPacket(StatisticsCalculator* stats) {
 void PacketBuffer::DiscardOldPackets(uint32_t timestamp_limit,
                                      uint32_t horizon_samples,
                                      StatisticsCalculator* stats) {
-  buffer_.remove_if([timestamp_limit, horizon_samples, stats](const Packet& p) {
+  buffer_.remove_if([this, timestamp_limit, horizon_samples,
+                     stats](Packet& p) {
     if (timestamp_limit == p.timestamp ||
         !IsObsoleteTimestamp(p.timestamp, timestamp_limit, horizon_samples)) {
       return false;
     }
     LogPacketDiscarded(p.priority.codec_level, stats);
+    if (payload_pool_) {
+      payload_pool_->Reclaim(&p.payload);
+    }
     return true;
   });
 }
@@ -255,11 +278,14 @@ void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit,
 
 void PacketBuffer::DiscardPacketsWithPayloadType(uint8_t payload_type,
                                                  StatisticsCalculator* stats) {
-  buffer_.remove_if([payload_type, stats](const Packet& p) {
+  buffer_.remove_if([this, payload_type, stats](Packet& p) {
     if (p.payload_type != payload_type) {
       return false;
     }
     LogPacketDiscarded(p.priority.codec_level, stats);
+    if (payload_pool_) {
+      payload_pool_->Reclaim(&p.payload);
+    }
     return true;
   });
 }
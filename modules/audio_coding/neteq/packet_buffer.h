@@ -20,6 +20,7 @@
 namespace webrtc {
 
 class DecoderDatabase;
+class PayloadBufferPool;
 class StatisticsCalculator;
 class TickTimer;
 
@@ -36,8 +37,12 @@ class PacketBuffer {
   };
 
   // Constructor creates a buffer which can hold a maximum of
-  // |max_number_of_packets| packets.
-  PacketBuffer(size_t max_number_of_packets, const TickTimer* tick_timer);
+  // |max_number_of_packets| packets. If |payload_pool| is non-null, the heap
+  // storage of packets that are discarded or flushed is returned to the pool
+  // instead of freed.
+  PacketBuffer(size_t max_number_of_packets,
+               const TickTimer* tick_timer,
+               PayloadBufferPool* payload_pool = nullptr);
 
   // Deletes all packets in the buffer before destroying the buffer.
   virtual ~PacketBuffer();
@@ -149,6 +154,7 @@ class PacketBuffer {
   size_t max_number_of_packets_;
   PacketList buffer_;
   const TickTimer* tick_timer_;
+  PayloadBufferPool* const payload_pool_;
   RTC_DISALLOW_COPY_AND_ASSIGN(PacketBuffer);
 };
 
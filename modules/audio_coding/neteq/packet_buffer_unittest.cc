@@ -17,6 +17,7 @@
 #include "modules/audio_coding/neteq/mock/mock_decoder_database.h"
 #include "modules/audio_coding/neteq/mock/mock_statistics_calculator.h"
 #include "modules/audio_coding/neteq/packet.h"
+#include "modules/audio_coding/neteq/payload_buffer_pool.h"
 #include "modules/audio_coding/neteq/tick_timer.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -154,6 +155,28 @@ TEST(PacketBuffer, FlushBuffer) {
   EXPECT_TRUE(buffer.Empty());
 }
 
+// Test that flushing a buffer with a payload pool reclaims the payload
+// storage into the pool.
+TEST(PacketBuffer, FlushReclaimsPayloadsIntoPool) {
+  TickTimer tick_timer;
+  PayloadBufferPool pool(10);
+  PacketBuffer buffer(10, &tick_timer, &pool);  // 10 packets.
+  PacketGenerator gen(0, 0, 0, 10);
+  const int payload_len = 10;
+  StrictMock<MockStatisticsCalculator> mock_stats;
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(
+        PacketBuffer::kOK,
+        buffer.InsertPacket(gen.NextPacket(payload_len, nullptr), &mock_stats));
+  }
+  EXPECT_EQ(0u, pool.num_pooled_buffers());
+
+  buffer.Flush();
+  EXPECT_TRUE(buffer.Empty());
+  EXPECT_EQ(10u, pool.num_pooled_buffers());
+}
+
 // Test to fill the buffer over the limits, and verify that it flushes.
 TEST(PacketBuffer, OverfillBuffer) {
   TickTimer tick_timer;
@@ -0,0 +1,42 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/payload_buffer_pool.h"
+
+#include <utility>
+
+namespace webrtc {
+
+PayloadBufferPool::PayloadBufferPool(size_t max_buffers)
+    : max_buffers_(max_buffers) {}
+
+PayloadBufferPool::~PayloadBufferPool() = default;
+
+rtc::Buffer PayloadBufferPool::Create(rtc::ArrayView<const uint8_t> payload) {
+  if (free_buffers_.empty()) {
+    return rtc::Buffer(payload.data(), payload.size());
+  }
+  rtc::Buffer buffer = std::move(free_buffers_.back());
+  free_buffers_.pop_back();
+  buffer.SetData(payload.data(), payload.size());
+  return buffer;
+}
+
+void PayloadBufferPool::Reclaim(rtc::Buffer* payload) {
+  // A payload whose storage was moved out (e.g., into a parsed frame) has
+  // nothing to reclaim.
+  if (payload->capacity() == 0 || free_buffers_.size() >= max_buffers_) {
+    return;
+  }
+  payload->Clear();
+  free_buffers_.push_back(std::move(*payload));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_PAYLOAD_BUFFER_POOL_H_
+#define MODULES_AUDIO_CODING_NETEQ_PAYLOAD_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Recycles the heap storage of packet payload buffers within one NetEq
+// instance, so that the steady state inserts one packet per 20 ms without
+// hitting the allocator. The pool holds at most |max_buffers| spare buffers;
+// reclaimed buffers beyond that are freed.
+class PayloadBufferPool {
+ public:
+  explicit PayloadBufferPool(size_t max_buffers);
+  ~PayloadBufferPool();
+
+  // Returns a buffer holding a copy of |payload|, reusing pooled heap
+  // storage when available.
+  rtc::Buffer Create(rtc::ArrayView<const uint8_t> payload);
+
+  // Takes back the heap storage of |payload| for later reuse. The buffer is
+  // left empty.
+  void Reclaim(rtc::Buffer* payload);
+
+  size_t num_pooled_buffers() const { return free_buffers_.size(); }
+
+ private:
+  const size_t max_buffers_;
+  std::vector<rtc::Buffer> free_buffers_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(PayloadBufferPool);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_PAYLOAD_BUFFER_POOL_H_
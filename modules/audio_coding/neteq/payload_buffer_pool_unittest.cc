@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/payload_buffer_pool.h"
+
+#include <utility>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+const uint8_t kPayload[] = {1, 2, 3, 4, 5};
+}  // namespace
+
+TEST(PayloadBufferPool, CreateCopiesPayload) {
+  PayloadBufferPool pool(10);
+  rtc::Buffer buffer = pool.Create(kPayload);
+  ASSERT_EQ(sizeof(kPayload), buffer.size());
+  EXPECT_EQ(0, memcmp(buffer.data(), kPayload, sizeof(kPayload)));
+}
+
+TEST(PayloadBufferPool, ReclaimAndReuse) {
+  PayloadBufferPool pool(10);
+  rtc::Buffer buffer = pool.Create(kPayload);
+  const uint8_t* storage = buffer.data();
+  pool.Reclaim(&buffer);
+  EXPECT_EQ(1u, pool.num_pooled_buffers());
+  EXPECT_EQ(0u, buffer.size());
+
+  // The next buffer drawn from the pool must reuse the reclaimed storage.
+  rtc::Buffer reused = pool.Create(kPayload);
+  EXPECT_EQ(0u, pool.num_pooled_buffers());
+  EXPECT_EQ(storage, reused.data());
+  EXPECT_EQ(0, memcmp(reused.data(), kPayload, sizeof(kPayload)));
+}
+
+TEST(PayloadBufferPool, ReclaimIgnoresMovedFromBuffers) {
+  PayloadBufferPool pool(10);
+  rtc::Buffer buffer = pool.Create(kPayload);
+  rtc::Buffer moved_to = std::move(buffer);
+  // |buffer| no longer owns any storage, so there is nothing to reclaim.
+  pool.Reclaim(&buffer);
+  EXPECT_EQ(0u, pool.num_pooled_buffers());
+}
+
+TEST(PayloadBufferPool, RespectsMaxBuffers) {
+  PayloadBufferPool pool(2);
+  rtc::Buffer buffer1 = pool.Create(kPayload);
+  rtc::Buffer buffer2 = pool.Create(kPayload);
+  rtc::Buffer buffer3 = pool.Create(kPayload);
+  pool.Reclaim(&buffer1);
+  pool.Reclaim(&buffer2);
+  pool.Reclaim(&buffer3);  // Exceeds the cap; the storage is freed instead.
+  EXPECT_EQ(2u, pool.num_pooled_buffers());
+}
+
+}  // namespace webrtc
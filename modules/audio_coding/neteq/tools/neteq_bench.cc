@@ -0,0 +1,132 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Benchmark tool that replays an RTP dump through NetEq as fast as possible
+// (the simulation uses a simulated clock, so a trace is processed at whatever
+// rate the host allows) and reports the wall-clock cost of every GetAudio
+// call, broken down per NetEq operation, together with the quality-related
+// lifetime statistics. The results can optionally be written as JSON for CI
+// trending.
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <iostream>
+#include <string>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "modules/audio_coding/neteq/tools/neteq_cost_analyzer.h"
+#include "modules/audio_coding/neteq/tools/neteq_test.h"
+#include "modules/audio_coding/neteq/tools/neteq_test_factory.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/strings/string_builder.h"
+#include "system_wrappers/include/field_trial.h"
+#include "test/field_trial.h"
+
+ABSL_FLAG(std::string,
+          force_fieldtrials,
+          "",
+          "Field trials control experimental feature code which can be forced. "
+          "E.g. running with --force_fieldtrials=WebRTC-FooFeature/Enable/"
+          " will assign the group Enable to field trial WebRTC-FooFeature.");
+ABSL_FLAG(std::string,
+          json_file,
+          "",
+          "Path to an output file where the results are written as JSON");
+
+namespace {
+
+void PrintCostSummary(const char* name,
+                      const webrtc::test::NetEqCostAnalyzer::CostSummary& s) {
+  printf("%-17s %8zu %8.1f %8" PRId64 " %8" PRId64 " %8" PRId64 " %8" PRId64
+         "\n",
+         name, s.count, s.mean_us, s.p50_us, s.p95_us, s.p99_us, s.max_us);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  std::string usage =
+      "Tool for benchmarking NetEq on an RTP dump file.\n"
+      "Example usage:\n"
+      "./neteq_bench input.rtp [output.{pcm, wav}]\n";
+  if (args.size() != 2 &&
+      args.size() != 3) {  // The output audio file is optional.
+    std::cout << usage;
+    exit(0);
+  }
+
+  // Make force_fieldtrials persistent string during entire program live as
+  // absl::GetFlag creates temporary string and c_str() will point to
+  // deallocated string.
+  const std::string force_fieldtrials = absl::GetFlag(FLAGS_force_fieldtrials);
+  webrtc::field_trial::InitFieldTrialsFromString(force_fieldtrials.c_str());
+
+  webrtc::test::NetEqTestFactory factory;
+  webrtc::test::NetEqTestFactory::Config config;
+  config.profile_getaudio_cost = true;
+  if (args.size() == 3) {
+    config.output_audio_filename = std::string(args[2]);
+  }
+
+  std::unique_ptr<webrtc::test::NetEqTest> test =
+      factory.InitializeTestFromFile(/*input_filename=*/args[1], config);
+  RTC_CHECK(test) << "ERROR: Unable to run test";
+  test->Run();
+
+  const webrtc::test::NetEqCostAnalyzer* analyzer = factory.cost_analyzer();
+  RTC_CHECK(analyzer);
+  using Action = webrtc::test::NetEqCostAnalyzer::Action;
+
+  printf("GetAudio cost (microseconds):\n");
+  printf("%-17s %8s %8s %8s %8s %8s %8s\n", "operation", "count", "mean",
+         "p50", "p95", "p99", "max");
+  PrintCostSummary("total", analyzer->GetTotalSummary());
+  for (Action action : {Action::kNormal, Action::kExpand, Action::kAccelerate,
+                        Action::kPreemptiveExpand}) {
+    PrintCostSummary(webrtc::test::NetEqCostAnalyzer::ActionName(action),
+                     analyzer->GetSummary(action));
+  }
+
+  const webrtc::NetEqLifetimeStatistics stats = test->LifetimeStats();
+  printf("\nQuality:\n");
+  printf("total_samples_received: %" PRIu64 "\n", stats.total_samples_received);
+  printf("concealed_samples: %" PRIu64 "\n", stats.concealed_samples);
+  printf("concealment_events: %" PRIu64 "\n", stats.concealment_events);
+  printf("inserted_samples_for_deceleration: %" PRIu64 "\n",
+         stats.inserted_samples_for_deceleration);
+  printf("removed_samples_for_acceleration: %" PRIu64 "\n",
+         stats.removed_samples_for_acceleration);
+  printf("jitter_buffer_delay_ms: %" PRIu64 "\n", stats.jitter_buffer_delay_ms);
+
+  const std::string json_filename = absl::GetFlag(FLAGS_json_file);
+  if (!json_filename.empty()) {
+    rtc::StringBuilder sb;
+    sb << "{\"getaudio_cost\": " << analyzer->ToJsonString()
+       << ", \"quality\": {\"total_samples_received\": "
+       << stats.total_samples_received
+       << ", \"concealed_samples\": " << stats.concealed_samples
+       << ", \"concealment_events\": " << stats.concealment_events
+       << ", \"inserted_samples_for_deceleration\": "
+       << stats.inserted_samples_for_deceleration
+       << ", \"removed_samples_for_acceleration\": "
+       << stats.removed_samples_for_acceleration
+       << ", \"jitter_buffer_delay_ms\": " << stats.jitter_buffer_delay_ms
+       << "}}\n";
+    FILE* json_file = fopen(json_filename.c_str(), "w");
+    RTC_CHECK(json_file) << "Cannot open " << json_filename;
+    const std::string json = sb.Release();
+    fputs(json.c_str(), json_file);
+    fclose(json_file);
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/tools/neteq_cost_analyzer.h"
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace test {
+
+namespace {
+
+// Returns the |percentile|-th percentile (nearest-rank) of |sorted_costs|.
+int64_t Percentile(const std::vector<int64_t>& sorted_costs, int percentile) {
+  RTC_DCHECK(!sorted_costs.empty());
+  const size_t rank = (sorted_costs.size() * percentile + 99) / 100;
+  return sorted_costs[std::max<size_t>(rank, 1) - 1];
+}
+
+NetEqCostAnalyzer::CostSummary Summarize(std::vector<int64_t> costs) {
+  NetEqCostAnalyzer::CostSummary summary;
+  if (costs.empty()) {
+    return summary;
+  }
+  std::sort(costs.begin(), costs.end());
+  summary.count = costs.size();
+  int64_t sum = 0;
+  for (int64_t cost : costs) {
+    sum += cost;
+  }
+  summary.mean_us = static_cast<double>(sum) / costs.size();
+  summary.p50_us = Percentile(costs, 50);
+  summary.p95_us = Percentile(costs, 95);
+  summary.p99_us = Percentile(costs, 99);
+  summary.max_us = costs.back();
+  return summary;
+}
+
+constexpr NetEqCostAnalyzer::Action kAllActions[] = {
+    NetEqCostAnalyzer::Action::kNormal, NetEqCostAnalyzer::Action::kExpand,
+    NetEqCostAnalyzer::Action::kAccelerate,
+    NetEqCostAnalyzer::Action::kPreemptiveExpand};
+
+}  // namespace
+
+NetEqCostAnalyzer::NetEqCostAnalyzer(NetEqGetAudioCallback* other_callback)
+    : other_callback_(other_callback) {}
+
+void NetEqCostAnalyzer::BeforeGetAudio(NetEq* neteq) {
+  if (other_callback_) {
+    other_callback_->BeforeGetAudio(neteq);
+  }
+  last_ops_state_ = neteq->GetOperationsAndState();
+  start_time_us_ = rtc::TimeMicros();
+}
+
+void NetEqCostAnalyzer::AfterGetAudio(int64_t time_now_ms,
+                                      const AudioFrame& audio_frame,
+                                      bool muted,
+                                      NetEq* neteq) {
+  const int64_t cost_us = rtc::TimeMicros() - start_time_us_;
+  const NetEqOperationsAndState ops_state = neteq->GetOperationsAndState();
+  Action action = Action::kNormal;
+  if (audio_frame.speech_type_ == AudioFrame::SpeechType::kPLC ||
+      audio_frame.speech_type_ == AudioFrame::SpeechType::kPLCCNG) {
+    action = Action::kExpand;
+  } else if (ops_state.accelerate_samples > last_ops_state_.accelerate_samples) {
+    action = Action::kAccelerate;
+  } else if (ops_state.preemptive_samples > last_ops_state_.preemptive_samples) {
+    action = Action::kPreemptiveExpand;
+  }
+  cost_us_[action].push_back(cost_us);
+  if (other_callback_) {
+    other_callback_->AfterGetAudio(time_now_ms, audio_frame, muted, neteq);
+  }
+}
+
+NetEqCostAnalyzer::CostSummary NetEqCostAnalyzer::GetSummary(
+    Action action) const {
+  auto it = cost_us_.find(action);
+  if (it == cost_us_.end()) {
+    return CostSummary();
+  }
+  return Summarize(it->second);
+}
+
+NetEqCostAnalyzer::CostSummary NetEqCostAnalyzer::GetTotalSummary() const {
+  std::vector<int64_t> all_costs;
+  for (const auto& action_costs : cost_us_) {
+    all_costs.insert(all_costs.end(), action_costs.second.begin(),
+                     action_costs.second.end());
+  }
+  return Summarize(std::move(all_costs));
+}
+
+std::string NetEqCostAnalyzer::ToJsonString() const {
+  rtc::StringBuilder sb;
+  auto append_summary = [&sb](const char* name, const CostSummary& summary) {
+    sb << "\"" << name << "\": {\"count\": " << summary.count
+       << ", \"mean_us\": " << summary.mean_us
+       << ", \"p50_us\": " << summary.p50_us
+       << ", \"p95_us\": " << summary.p95_us
+       << ", \"p99_us\": " << summary.p99_us
+       << ", \"max_us\": " << summary.max_us << "}";
+  };
+  sb << "{";
+  append_summary("total", GetTotalSummary());
+  for (Action action : kAllActions) {
+    sb << ", ";
+    append_summary(ActionName(action), GetSummary(action));
+  }
+  sb << "}";
+  return sb.Release();
+}
+
+const char* NetEqCostAnalyzer::ActionName(Action action) {
+  switch (action) {
+    case Action::kNormal:
+      return "normal";
+    case Action::kExpand:
+      return "expand";
+    case Action::kAccelerate:
+      return "accelerate";
+    case Action::kPreemptiveExpand:
+      return "preemptive_expand";
+  }
+  RTC_NOTREACHED();
+  return "";
+}
+
+}  // namespace test
+}  // namespace webrtc
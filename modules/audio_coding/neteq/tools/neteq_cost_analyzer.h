@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_COST_ANALYZER_H_
+#define MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_COST_ANALYZER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "modules/audio_coding/neteq/tools/neteq_test.h"
+
+namespace webrtc {
+namespace test {
+
+// Measures the wall-clock cost of each NetEq::GetAudio call during a
+// simulation, attributed to the operation that NetEq performed (normal,
+// expand, accelerate or preemptive expand). The attribution uses the same
+// inference as NetEqTest::RunToNextGetAudio: a PLC output frame counts as
+// expand, otherwise the time-stretch sample counters decide.
+class NetEqCostAnalyzer : public NetEqGetAudioCallback {
+ public:
+  using Action = NetEqSimulator::Action;
+
+  struct CostSummary {
+    size_t count = 0;
+    double mean_us = 0.0;
+    int64_t p50_us = 0;
+    int64_t p95_us = 0;
+    int64_t p99_us = 0;
+    int64_t max_us = 0;
+  };
+
+  // The wrapped |other_callback| is invoked outside of the timed region, so
+  // that the measured cost covers only the GetAudio call itself. Does not
+  // take ownership; null is a valid value.
+  explicit NetEqCostAnalyzer(NetEqGetAudioCallback* other_callback);
+
+  void BeforeGetAudio(NetEq* neteq) override;
+
+  void AfterGetAudio(int64_t time_now_ms,
+                     const AudioFrame& audio_frame,
+                     bool muted,
+                     NetEq* neteq) override;
+
+  // Returns the cost summary for one operation type, or for all GetAudio
+  // calls taken together.
+  CostSummary GetSummary(Action action) const;
+  CostSummary GetTotalSummary() const;
+
+  // Returns all summaries as a JSON object keyed on operation name, suitable
+  // for CI trending.
+  std::string ToJsonString() const;
+
+  static const char* ActionName(Action action);
+
+ private:
+  NetEqGetAudioCallback* const other_callback_;
+  NetEqOperationsAndState last_ops_state_;
+  int64_t start_time_us_ = 0;
+  std::map<Action, std::vector<int64_t>> cost_us_;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_TOOLS_NETEQ_COST_ANALYZER_H_
@@ -32,6 +32,7 @@
 #include "modules/audio_coding/neteq/tools/neteq_event_log_input.h"
 #include "modules/audio_coding/neteq/tools/neteq_packet_source_input.h"
 #include "modules/audio_coding/neteq/tools/neteq_replacement_input.h"
+#include "modules/audio_coding/neteq/tools/neteq_cost_analyzer.h"
 #include "modules/audio_coding/neteq/tools/neteq_stats_getter.h"
 #include "modules/audio_coding/neteq/tools/neteq_stats_plotter.h"
 #include "modules/audio_coding/neteq/tools/neteq_test.h"
@@ -286,6 +287,11 @@ std::unique_ptr<NetEqTest> NetEqTestFactory::InitializeTest(
       new SsrcSwitchDetector(stats_plotter_->stats_getter()->delay_analyzer()));
   callbacks.post_insert_packet = ssrc_switch_detector_.get();
   callbacks.get_audio_callback = stats_plotter_->stats_getter();
+  if (config.profile_getaudio_cost) {
+    cost_analyzer_ =
+        absl::make_unique<NetEqCostAnalyzer>(callbacks.get_audio_callback);
+    callbacks.get_audio_callback = cost_analyzer_.get();
+  }
   callbacks.simulation_ended_callback = stats_plotter_.get();
   NetEq::Config neteq_config;
   neteq_config.sample_rate_hz = *sample_rate_hz;
@@ -21,6 +21,7 @@ namespace webrtc {
 namespace test {
 
 class SsrcSwitchDetector;
+class NetEqCostAnalyzer;
 class NetEqStatsGetter;
 class NetEqStatsPlotter;
 
@@ -131,6 +132,9 @@ class NetEqTestFactory {
     absl::optional<std::string> plot_scripts_basename;
     // Path to the output audio file.
     absl::optional<std::string> output_audio_filename;
+    // Measures the time spent in every GetAudio call, attributed per NetEq
+    // operation. The results are available through cost_analyzer().
+    bool profile_getaudio_cost = false;
   };
 
   std::unique_ptr<NetEqTest> InitializeTestFromFile(
@@ -140,11 +144,16 @@ class NetEqTestFactory {
       const std::string& input_string,
       const Config& config);
 
+  // Returns the cost analyzer, or null unless Config::profile_getaudio_cost
+  // was set when the test was initialized.
+  NetEqCostAnalyzer* cost_analyzer() const { return cost_analyzer_.get(); }
+
  private:
   std::unique_ptr<NetEqTest> InitializeTest(std::unique_ptr<NetEqInput> input,
                                             const Config& config);
   std::unique_ptr<SsrcSwitchDetector> ssrc_switch_detector_;
   std::unique_ptr<NetEqStatsPlotter> stats_plotter_;
+  std::unique_ptr<NetEqCostAnalyzer> cost_analyzer_;
 };
 
 }  // namespace test
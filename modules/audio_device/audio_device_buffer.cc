@@ -41,6 +41,22 @@ static const size_t kMinValidCallTimeTimeInMilliseconds =
 static const double k2Pi = 6.28318530717959;
 #endif
 
+// Nominal time between two successive audio callbacks in each direction.
+static const int64_t kAudioCallbackIntervalInMs = 10;
+// A callback arriving this late or later after the previous one counts as a
+// deadline miss; the device has glitched at least one whole frame.
+static const int64_t kDeadlineMissThresholdInMs = 2 * kAudioCallbackIntervalInMs;
+
+// Raises |level| to |max_abs| if larger, with relaxed atomics; used from the
+// single writer thread of each direction, so the compare-exchange loop is
+// only there to stay correct if that ever changes.
+static void UpdateMaxLevel(int16_t max_abs, std::atomic<int16_t>* level) {
+  int16_t current = level->load(std::memory_order_relaxed);
+  while (max_abs > current && !level->compare_exchange_weak(
+                                  current, max_abs, std::memory_order_relaxed)) {
+  }
+}
+
 AudioDeviceBuffer::AudioDeviceBuffer(TaskQueueFactory* task_queue_factory)
     : task_queue_(task_queue_factory->CreateTaskQueue(
           kTimerQueueName,
@@ -107,6 +123,8 @@ void AudioDeviceBuffer::StartPlayout() {
   const int64_t now_time = rtc::TimeMillis();
   // Clear members that are only touched on the main (creating) thread.
   play_start_time_ = now_time;
+  // Modified on the native audio thread; safe since it has not started yet.
+  last_play_callback_time_ms_ = 0;
   playing_ = true;
 }
 
@@ -126,10 +144,11 @@ void AudioDeviceBuffer::StartRecording() {
   // Clear members that will be touched on the main (creating) thread.
   rec_start_time_ = rtc::TimeMillis();
   recording_ = true;
-  // And finally a member which can be modified on the native audio thread.
+  // And finally members which can be modified on the native audio thread.
   // It is safe to do so since we know by design that the owning ADM has not
   // yet started the native audio recording.
   only_silence_recorded_ = true;
+  last_rec_callback_time_ms_ = 0;
 }
 
 void AudioDeviceBuffer::StopPlayout() {
@@ -229,6 +248,14 @@ void AudioDeviceBuffer::SetVQEData(int play_delay_ms, int rec_delay_ms) {
 
 int32_t AudioDeviceBuffer::SetRecordedBuffer(const void* audio_buffer,
                                              size_t samples_per_channel) {
+  // Check if the native audio thread fell behind its 10 ms cadence.
+  const int64_t now_time = rtc::TimeMillis();
+  if (last_rec_callback_time_ms_ != 0 &&
+      now_time - last_rec_callback_time_ms_ >= kDeadlineMissThresholdInMs) {
+    rec_deadline_misses_.fetch_add(1, std::memory_order_relaxed);
+  }
+  last_rec_callback_time_ms_ = now_time;
+
   // Copy the complete input buffer to the local buffer.
   const size_t old_size = rec_buffer_.size();
   rec_buffer_.SetData(static_cast<const int16_t*>(audio_buffer),
@@ -279,6 +306,14 @@ int32_t AudioDeviceBuffer::DeliverRecordedData() {
 }
 
 int32_t AudioDeviceBuffer::RequestPlayoutData(size_t samples_per_channel) {
+  // Check if the native audio thread fell behind its 10 ms cadence.
+  const int64_t now_time = rtc::TimeMillis();
+  if (last_play_callback_time_ms_ != 0 &&
+      now_time - last_play_callback_time_ms_ >= kDeadlineMissThresholdInMs) {
+    play_deadline_misses_.fetch_add(1, std::memory_order_relaxed);
+  }
+  last_play_callback_time_ms_ = now_time;
+
   // The consumer can change the requested size on the fly and we therefore
   // resize the buffer accordingly. Also takes place at the first call to this
   // method.
@@ -384,13 +419,10 @@ void AudioDeviceBuffer::LogStats(LogState state) {
   int64_t time_since_last = rtc::TimeDiff(now_time, last_timer_task_time_);
   last_timer_task_time_ = now_time;
 
-  Stats stats;
-  {
-    rtc::CritScope cs(&lock_);
-    stats = stats_;
-    stats_.max_rec_level = 0;
-    stats_.max_play_level = 0;
-  }
+  Stats stats = GetStats();
+  // Start a new max-level measurement period.
+  max_rec_level_.store(0, std::memory_order_relaxed);
+  max_play_level_.store(0, std::memory_order_relaxed);
 
   // Cache current sample rate from atomic members.
   const uint32_t rec_sample_rate = rec_sample_rate_;
@@ -417,7 +449,10 @@ void AudioDeviceBuffer::LogStats(LogState state) {
                     << "samples: " << diff_samples << ", "
                     << "rate: " << static_cast<int>(rate + 0.5) << ", "
                     << "rate diff: " << abs_diff_rate_in_percent << "%, "
-                    << "level: " << stats.max_rec_level;
+                    << "level: " << stats.max_rec_level << ", "
+                    << "deadline misses: "
+                    << stats.rec_deadline_misses -
+                           last_stats_.rec_deadline_misses;
     }
 
     diff_samples = stats.play_samples - last_stats_.play_samples;
@@ -435,7 +470,10 @@ void AudioDeviceBuffer::LogStats(LogState state) {
                     << "samples: " << diff_samples << ", "
                     << "rate: " << static_cast<int>(rate + 0.5) << ", "
                     << "rate diff: " << abs_diff_rate_in_percent << "%, "
-                    << "level: " << stats.max_play_level;
+                    << "level: " << stats.max_play_level << ", "
+                    << "deadline misses: "
+                    << stats.play_deadline_misses -
+                           last_stats_.play_deadline_misses;
     }
   }
   last_stats_ = stats;
@@ -452,35 +490,48 @@ void AudioDeviceBuffer::LogStats(LogState state) {
 void AudioDeviceBuffer::ResetRecStats() {
   RTC_DCHECK_RUN_ON(&task_queue_);
   last_stats_.ResetRecStats();
-  rtc::CritScope cs(&lock_);
-  stats_.ResetRecStats();
+  rec_callbacks_.store(0, std::memory_order_relaxed);
+  rec_samples_.store(0, std::memory_order_relaxed);
+  max_rec_level_.store(0, std::memory_order_relaxed);
+  rec_deadline_misses_.store(0, std::memory_order_relaxed);
 }
 
 void AudioDeviceBuffer::ResetPlayStats() {
   RTC_DCHECK_RUN_ON(&task_queue_);
   last_stats_.ResetPlayStats();
-  rtc::CritScope cs(&lock_);
-  stats_.ResetPlayStats();
+  play_callbacks_.store(0, std::memory_order_relaxed);
+  play_samples_.store(0, std::memory_order_relaxed);
+  max_play_level_.store(0, std::memory_order_relaxed);
+  play_deadline_misses_.store(0, std::memory_order_relaxed);
 }
 
 void AudioDeviceBuffer::UpdateRecStats(int16_t max_abs,
                                        size_t samples_per_channel) {
-  rtc::CritScope cs(&lock_);
-  ++stats_.rec_callbacks;
-  stats_.rec_samples += samples_per_channel;
-  if (max_abs > stats_.max_rec_level) {
-    stats_.max_rec_level = max_abs;
-  }
+  rec_callbacks_.fetch_add(1, std::memory_order_relaxed);
+  rec_samples_.fetch_add(samples_per_channel, std::memory_order_relaxed);
+  UpdateMaxLevel(max_abs, &max_rec_level_);
 }
 
 void AudioDeviceBuffer::UpdatePlayStats(int16_t max_abs,
                                         size_t samples_per_channel) {
-  rtc::CritScope cs(&lock_);
-  ++stats_.play_callbacks;
-  stats_.play_samples += samples_per_channel;
-  if (max_abs > stats_.max_play_level) {
-    stats_.max_play_level = max_abs;
-  }
+  play_callbacks_.fetch_add(1, std::memory_order_relaxed);
+  play_samples_.fetch_add(samples_per_channel, std::memory_order_relaxed);
+  UpdateMaxLevel(max_abs, &max_play_level_);
+}
+
+AudioDeviceBuffer::Stats AudioDeviceBuffer::GetStats() const {
+  Stats stats;
+  stats.rec_callbacks = rec_callbacks_.load(std::memory_order_relaxed);
+  stats.play_callbacks = play_callbacks_.load(std::memory_order_relaxed);
+  stats.rec_samples = rec_samples_.load(std::memory_order_relaxed);
+  stats.play_samples = play_samples_.load(std::memory_order_relaxed);
+  stats.max_rec_level = max_rec_level_.load(std::memory_order_relaxed);
+  stats.max_play_level = max_play_level_.load(std::memory_order_relaxed);
+  stats.rec_deadline_misses =
+      rec_deadline_misses_.load(std::memory_order_relaxed);
+  stats.play_deadline_misses =
+      play_deadline_misses_.load(std::memory_order_relaxed);
+  return stats;
 }
 
 }  // namespace webrtc
@@ -19,7 +19,6 @@
 #include "api/task_queue/task_queue_factory.h"
 #include "modules/audio_device/include/audio_device_defines.h"
 #include "rtc_base/buffer.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/thread_checker.h"
@@ -45,12 +44,14 @@ class AudioDeviceBuffer {
       rec_callbacks = 0;
       rec_samples = 0;
       max_rec_level = 0;
+      rec_deadline_misses = 0;
     }
 
     void ResetPlayStats() {
       play_callbacks = 0;
       play_samples = 0;
       max_play_level = 0;
+      play_deadline_misses = 0;
     }
 
     // Total number of recording callbacks where the source provides 10ms audio
@@ -75,6 +76,12 @@ class AudioDeviceBuffer {
     // Contains max level of recorded audio packets over the last 10 seconds
     // where a new measurement is done twice per second.
     int16_t max_play_level = 0;
+
+    // Total number of recording respectively playout callbacks that arrived
+    // at least two frame periods after the previous one, i.e. where the
+    // native audio thread missed its deadline and the audio glitched.
+    uint64_t rec_deadline_misses = 0;
+    uint64_t play_deadline_misses = 0;
   };
 
   explicit AudioDeviceBuffer(TaskQueueFactory* task_queue_factory);
@@ -108,6 +115,12 @@ class AudioDeviceBuffer {
 
   int32_t SetTypingStatus(bool typing_status);
 
+  // Returns a snapshot of the accumulated stats counters. The counters are
+  // relaxed atomics updated lock free by the native audio threads, so the
+  // snapshot is not guaranteed to be consistent across fields; it is meant
+  // for logging and monitoring. May be called from any thread.
+  Stats GetStats() const;
+
  private:
   // Starts/stops periodic logging of audio stats.
   void StartPeriodicLogging();
@@ -142,8 +155,6 @@ class AudioDeviceBuffer {
   // Main thread on which this object is created.
   rtc::ThreadChecker main_thread_checker_;
 
-  rtc::CriticalSection lock_;
-
   // Task queue used to invoke LogStats() periodically. Tasks are executed on a
   // worker thread but it does not necessarily have to be the same thread for
   // each task.
@@ -202,8 +213,25 @@ class AudioDeviceBuffer {
   int64_t play_start_time_ RTC_GUARDED_BY(main_thread_checker_);
   int64_t rec_start_time_ RTC_GUARDED_BY(main_thread_checker_);
 
-  // Contains counters for playout and recording statistics.
-  Stats stats_ RTC_GUARDED_BY(lock_);
+  // Counters for playout and recording statistics. They are updated with
+  // relaxed atomic operations on the native audio threads, once per 10 ms
+  // callback, and read by GetStats(); the audio threads never take a lock.
+  // The max levels are exchanged back to zero when LogStats() samples them.
+  std::atomic<uint64_t> rec_callbacks_{0};
+  std::atomic<uint64_t> play_callbacks_{0};
+  std::atomic<uint64_t> rec_samples_{0};
+  std::atomic<uint64_t> play_samples_{0};
+  std::atomic<int16_t> max_rec_level_{0};
+  std::atomic<int16_t> max_play_level_{0};
+  std::atomic<uint64_t> rec_deadline_misses_{0};
+  std::atomic<uint64_t> play_deadline_misses_{0};
+
+  // Time stamps of the previous recording/playout callbacks, used to detect
+  // deadline misses. Only touched on the respective native audio thread;
+  // cleared in Start{Recording,Playout}() which by design happens before the
+  // native threads run.
+  int64_t last_rec_callback_time_ms_ = 0;
+  int64_t last_play_callback_time_ms_ = 0;
 
   // Stores current stats at each timer task. Used to calculate differences
   // between two successive timer events.
@@ -26,6 +26,15 @@
 namespace webrtc {
 namespace {
 
+// Number of ticks (10 ms each) during which a source that produced unmuted
+// audio keeps bypassing the energy pre-ranking in SelectSourcesToPoll().
+constexpr int64_t kRecentlyUnmutedTicks = 100;  // One second.
+
+// Polling slots per tick reserved for round-robin probing of sources that
+// the pre-ranking would otherwise skip. With budget left over, a source that
+// starts talking is discovered within list size / 2 ticks.
+constexpr size_t kProbeSlotsPerTick = 2;
+
 struct SourceFrame {
   SourceFrame(AudioMixerImpl::SourceStatus* source_status,
               AudioFrame* audio_frame,
@@ -95,12 +104,18 @@ AudioMixerImpl::SourceStatusList::const_iterator FindSourceInList(
 
 AudioMixerImpl::AudioMixerImpl(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-    bool use_limiter)
+    bool use_limiter,
+    size_t max_sources_to_poll)
     : output_rate_calculator_(std::move(output_rate_calculator)),
       output_frequency_(0),
       sample_size_(0),
       audio_source_list_(),
-      frame_combiner_(use_limiter) {}
+      frame_combiner_(use_limiter),
+      max_sources_to_poll_(max_sources_to_poll) {
+  RTC_DCHECK(max_sources_to_poll_ == 0 ||
+             max_sources_to_poll_ >=
+                 static_cast<size_t>(kMaximumAmountOfMixedAudioSources));
+}
 
 AudioMixerImpl::~AudioMixerImpl() {}
 
@@ -112,10 +127,12 @@ rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create() {
 
 rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-    bool use_limiter) {
+    bool use_limiter,
+    size_t max_sources_to_poll) {
   return rtc::scoped_refptr<AudioMixerImpl>(
       new rtc::RefCountedObject<AudioMixerImpl>(
-          std::move(output_rate_calculator), use_limiter));
+          std::move(output_rate_calculator), use_limiter,
+          max_sources_to_poll));
 }
 
 void AudioMixerImpl::Mix(size_t number_of_channels,
@@ -181,8 +198,10 @@ AudioFrameList AudioMixerImpl::GetAudioFromSources() {
   std::vector<SourceFrame> audio_source_mixing_data_list;
   std::vector<SourceFrame> ramp_list;
 
+  ++mix_tick_;
+
   // Get audio from the audio sources and put it in the SourceFrame vector.
-  for (auto& source_and_status : audio_source_list_) {
+  for (SourceStatus* source_and_status : SelectSourcesToPoll()) {
     const auto audio_frame_info =
         source_and_status->audio_source->GetAudioFrameWithInfo(
             OutputFrequency(), &source_and_status->audio_frame);
@@ -192,8 +211,16 @@ AudioFrameList AudioMixerImpl::GetAudioFromSources() {
       continue;
     }
     audio_source_mixing_data_list.emplace_back(
-        source_and_status.get(), &source_and_status->audio_frame,
+        source_and_status, &source_and_status->audio_frame,
         audio_frame_info == Source::AudioFrameInfo::kMuted);
+
+    // Feed the pre-ranking of SelectSourcesToPoll(). The energy is computed
+    // by the SourceFrame constructor anyway, so this costs nothing extra.
+    const SourceFrame& source_frame = audio_source_mixing_data_list.back();
+    source_and_status->cached_energy = source_frame.energy;
+    if (!source_frame.muted) {
+      source_and_status->last_unmuted_tick = mix_tick_;
+    }
   }
 
   // Sort frames by sorting function.
@@ -224,6 +251,78 @@ AudioFrameList AudioMixerImpl::GetAudioFromSources() {
   return result;
 }
 
+std::vector<AudioMixerImpl::SourceStatus*>
+AudioMixerImpl::SelectSourcesToPoll() {
+  std::vector<SourceStatus*> polled;
+  if (max_sources_to_poll_ == 0 ||
+      audio_source_list_.size() <= max_sources_to_poll_) {
+    polled.reserve(audio_source_list_.size());
+    for (auto& source_and_status : audio_source_list_) {
+      polled.push_back(source_and_status.get());
+    }
+    return polled;
+  }
+
+  polled.reserve(max_sources_to_poll_);
+
+  // Recently unmuted sources always get a pull; they are the speakers the
+  // ranking in GetAudioFromSources() chooses between.
+  std::vector<SourceStatus*> candidates;
+  candidates.reserve(audio_source_list_.size());
+  for (auto& source_and_status : audio_source_list_) {
+    SourceStatus* source_status = source_and_status.get();
+    if (source_status->last_unmuted_tick >= 0 &&
+        mix_tick_ - source_status->last_unmuted_tick <= kRecentlyUnmutedTicks) {
+      source_status->last_poll_tick = mix_tick_;
+      polled.push_back(source_status);
+    } else {
+      candidates.push_back(source_status);
+    }
+  }
+
+  if (polled.size() < max_sources_to_poll_) {
+    const size_t budget = max_sources_to_poll_ - polled.size();
+    const size_t probe_slots = std::min(budget, kProbeSlotsPerTick);
+    const size_t num_ranked = std::min(candidates.size(), budget - probe_slots);
+
+    // Fill most of the remaining budget with the highest cached energies.
+    std::partial_sort(candidates.begin(), candidates.begin() + num_ranked,
+                      candidates.end(),
+                      [](const SourceStatus* a, const SourceStatus* b) {
+                        return a->cached_energy > b->cached_energy;
+                      });
+    for (size_t i = 0; i < num_ranked; ++i) {
+      candidates[i]->last_poll_tick = mix_tick_;
+      polled.push_back(candidates[i]);
+    }
+
+    // The rest of the budget probes the list round-robin, so that a source
+    // that starts talking while unpolled is discovered within a bounded
+    // number of ticks.
+    size_t remaining = budget - num_ranked;
+    for (size_t visited = 0;
+         visited < audio_source_list_.size() && remaining > 0; ++visited) {
+      probe_position_ = (probe_position_ + 1) % audio_source_list_.size();
+      SourceStatus* source_status = audio_source_list_[probe_position_].get();
+      if (source_status->last_poll_tick == mix_tick_) {
+        continue;
+      }
+      source_status->last_poll_tick = mix_tick_;
+      polled.push_back(source_status);
+      --remaining;
+    }
+  }
+
+  // Let the stale levels of unpolled sources fade so that they do not keep
+  // outranking the probes.
+  for (auto& source_and_status : audio_source_list_) {
+    if (source_and_status->last_poll_tick != mix_tick_) {
+      source_and_status->cached_energy /= 2;
+    }
+  }
+  return polled;
+}
+
 bool AudioMixerImpl::GetAudioSourceMixabilityStatusForTest(
     AudioMixerImpl::Source* audio_source) const {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
@@ -12,6 +12,7 @@
 #define MODULES_AUDIO_MIXER_AUDIO_MIXER_IMPL_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <vector>
@@ -41,6 +42,14 @@ class AudioMixerImpl : public AudioMixer {
 
     // A frame that will be passed to audio_source->GetAudioFrameWithInfo.
     AudioFrame audio_frame;
+
+    // Bookkeeping for the pre-selection done by SelectSourcesToPoll().
+    // |cached_energy| is the energy of the last polled frame, decayed on
+    // ticks where the source is not polled. The tick counters refer to
+    // AudioMixerImpl::mix_tick_.
+    uint32_t cached_energy = 0;
+    int64_t last_unmuted_tick = -1;
+    int64_t last_poll_tick = -1;
   };
 
   using SourceStatusList = std::vector<std::unique_ptr<SourceStatus>>;
@@ -51,9 +60,18 @@ class AudioMixerImpl : public AudioMixer {
 
   static rtc::scoped_refptr<AudioMixerImpl> Create();
 
+  // |max_sources_to_poll| limits how many sources get a
+  // GetAudioFrameWithInfo() call per 10 ms tick; 0 polls every registered
+  // source. When limited, recently unmuted sources are always polled, the
+  // remaining budget goes to the sources with the highest cached energy, and
+  // a couple of slots rotate over the full list so that sources that start
+  // talking while unpolled are discovered. Sources that are not polled do
+  // not get their playout clock advanced, so this should only be used when
+  // sources tolerate skipped pulls.
   static rtc::scoped_refptr<AudioMixerImpl> Create(
       std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-      bool use_limiter);
+      bool use_limiter,
+      size_t max_sources_to_poll = 0);
 
   ~AudioMixerImpl() override;
 
@@ -72,7 +90,8 @@ class AudioMixerImpl : public AudioMixer {
 
  protected:
   AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-                 bool use_limiter);
+                 bool use_limiter,
+                 size_t max_sources_to_poll);
 
  private:
   // Set mixing frequency through OutputFrequencyCalculator.
@@ -85,6 +104,11 @@ class AudioMixerImpl : public AudioMixer {
   // kMaximumAmountOfMixedAudioSources audio sources.
   AudioFrameList GetAudioFromSources() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
+  // Pick the sources that get a GetAudioFrameWithInfo() call this tick. All
+  // of them unless max_sources_to_poll_ caps the list; see Create().
+  std::vector<SourceStatus*> SelectSourcesToPoll()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+
   // The critical section lock guards audio source insertion and
   // removal, which can be done from any thread. The race checker
   // checks that mixing is done sequentially.
@@ -99,6 +123,13 @@ class AudioMixerImpl : public AudioMixer {
   // List of all audio sources. Note all lists are disjunct
   SourceStatusList audio_source_list_ RTC_GUARDED_BY(crit_);  // May be mixed.
 
+  // See Create(). 0 means every source is polled each tick.
+  const size_t max_sources_to_poll_;
+  // Monotonic 10 ms tick counter, incremented once per GetAudioFromSources().
+  int64_t mix_tick_ RTC_GUARDED_BY(crit_) = 0;
+  // Round-robin position for the probing slots in SelectSourcesToPoll().
+  size_t probe_position_ RTC_GUARDED_BY(crit_) = 0;
+
   // Component that handles actual adding of audio frames.
   FrameCombiner frame_combiner_ RTC_GUARDED_BY(race_checker_);
 
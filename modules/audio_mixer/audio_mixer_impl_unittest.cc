@@ -640,4 +640,69 @@ TEST(AudioMixer, MultipleChannelsAndHighRate) {
 #endif
 }
 
+TEST(AudioMixer, PollsAtMostMaxSourcesPerTick) {
+  constexpr int kAudioSources = 12;
+  constexpr size_t kMaxSourcesToPoll = 6;
+
+  const auto mixer = AudioMixerImpl::Create(
+      absl::make_unique<DefaultOutputRateCalculator>(), true,
+      kMaxSourcesToPoll);
+
+  int pulls_this_tick = 0;
+  MockMixerAudioSource participants[kAudioSources];
+  for (auto& participant : participants) {
+    ResetFrame(participant.fake_frame());
+    EXPECT_CALL(participant, GetAudioFrameWithInfo(kDefaultSampleRateHz, _))
+        .WillRepeatedly(Invoke([&pulls_this_tick](int sample_rate_hz,
+                                                  AudioFrame* audio_frame) {
+          ++pulls_this_tick;
+          return AudioMixer::Source::AudioFrameInfo::kMuted;
+        }));
+    mixer->AddSource(&participant);
+  }
+
+  for (int tick = 0; tick < 10; ++tick) {
+    pulls_this_tick = 0;
+    mixer->Mix(1, &frame_for_mixing);
+    EXPECT_EQ(kMaxSourcesToPoll, static_cast<size_t>(pulls_this_tick));
+  }
+}
+
+TEST(AudioMixer, ProbingFindsNewlyUnmutedSource) {
+  constexpr int kAudioSources = 8;
+  constexpr size_t kMaxSourcesToPoll = 4;
+
+  const auto mixer = AudioMixerImpl::Create(
+      absl::make_unique<DefaultOutputRateCalculator>(), true,
+      kMaxSourcesToPoll);
+
+  MockMixerAudioSource participants[kAudioSources];
+  for (auto& participant : participants) {
+    ResetFrame(participant.fake_frame());
+    participant.set_fake_info(AudioMixer::Source::AudioFrameInfo::kMuted);
+    mixer->AddSource(&participant);
+  }
+
+  // Establish a steady state where everyone is muted and unpolled most
+  // ticks, then unmute the last participant.
+  for (int tick = 0; tick < 10; ++tick) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  MockMixerAudioSource& talker = participants[kAudioSources - 1];
+  talker.set_fake_info(AudioMixer::Source::AudioFrameInfo::kNormal);
+  std::fill(talker.fake_frame()->mutable_data(),
+            talker.fake_frame()->mutable_data() +
+                talker.fake_frame()->samples_per_channel_,
+            1000);
+
+  // The round-robin probe slots must reach the talker within a full rotation
+  // of the source list, after which it is mixed.
+  bool mixed = false;
+  for (int tick = 0; tick < kAudioSources && !mixed; ++tick) {
+    mixer->Mix(1, &frame_for_mixing);
+    mixed = mixer->GetAudioSourceMixabilityStatusForTest(&talker);
+  }
+  EXPECT_TRUE(mixed);
+}
+
 }  // namespace webrtc
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstdlib>
 #include <iterator>
 #include <string>
 
@@ -26,8 +27,16 @@
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/arraysize.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
 #include "system_wrappers/include/metrics.h"
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace webrtc {
 namespace {
 
@@ -72,6 +81,81 @@ void MixFewFramesWithNoLimiter(const std::vector<AudioFrame*>& mix_list,
             mix_list[0]->data() +
                 mix_list[0]->num_channels_ * mix_list[0]->samples_per_channel_,
             audio_frame_for_mixing->mutable_data());
+  audio_frame_for_mixing->set_cached_abs_peak(mix_list[0]->cached_abs_peak());
+}
+
+// Accumulates a mono int16 frame onto a float channel buffer. The int16 to
+// float conversion is exact and every output sample is summed in the same
+// stream order as the generic loop, so the result is unchanged.
+void AccumulateMonoFrame(const int16_t* data, size_t samples, float* mix) {
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128i zero = _mm_setzero_si128();
+  for (; k + 8 <= samples; k += 8) {
+    const __m128i x =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + k));
+    // Sign-extend the eight int16 samples to two int32 vectors.
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(zero, x), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(zero, x), 16);
+    _mm_storeu_ps(mix + k,
+                  _mm_add_ps(_mm_loadu_ps(mix + k), _mm_cvtepi32_ps(lo)));
+    _mm_storeu_ps(mix + k + 4,
+                  _mm_add_ps(_mm_loadu_ps(mix + k + 4), _mm_cvtepi32_ps(hi)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 8 <= samples; k += 8) {
+    const int16x8_t x = vld1q_s16(data + k);
+    vst1q_f32(mix + k,
+              vaddq_f32(vld1q_f32(mix + k),
+                        vcvtq_f32_s32(vmovl_s16(vget_low_s16(x)))));
+    vst1q_f32(mix + k + 4,
+              vaddq_f32(vld1q_f32(mix + k + 4),
+                        vcvtq_f32_s32(vmovl_s16(vget_high_s16(x)))));
+  }
+#endif
+  for (; k < samples; ++k) {
+    mix[k] += data[k];
+  }
+}
+
+// Accumulates an interleaved stereo int16 frame onto two planar float
+// channel buffers; bit-exact with the generic loop for the same reasons as
+// AccumulateMonoFrame().
+void AccumulateStereoFrame(const int16_t* data,
+                           size_t samples,
+                           float* left,
+                           float* right) {
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128i zero = _mm_setzero_si128();
+  for (; k + 4 <= samples; k += 4) {
+    const __m128i lr =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * k));
+    // {L0 R0 L1 R1 L2 R2 L3 R3} -> {L0 L1 L2 L3 R0 R1 R2 R3}.
+    const __m128i grouped = _mm_shuffle_epi32(
+        _mm_shufflehi_epi16(_mm_shufflelo_epi16(lr, _MM_SHUFFLE(3, 1, 2, 0)),
+                            _MM_SHUFFLE(3, 1, 2, 0)),
+        _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128i l = _mm_srai_epi32(_mm_unpacklo_epi16(zero, grouped), 16);
+    const __m128i r = _mm_srai_epi32(_mm_unpackhi_epi16(zero, grouped), 16);
+    _mm_storeu_ps(left + k,
+                  _mm_add_ps(_mm_loadu_ps(left + k), _mm_cvtepi32_ps(l)));
+    _mm_storeu_ps(right + k,
+                  _mm_add_ps(_mm_loadu_ps(right + k), _mm_cvtepi32_ps(r)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 4 <= samples; k += 4) {
+    const int16x4x2_t lr = vld2_s16(data + 2 * k);
+    vst1q_f32(left + k, vaddq_f32(vld1q_f32(left + k),
+                                  vcvtq_f32_s32(vmovl_s16(lr.val[0]))));
+    vst1q_f32(right + k, vaddq_f32(vld1q_f32(right + k),
+                                   vcvtq_f32_s32(vmovl_s16(lr.val[1]))));
+  }
+#endif
+  for (; k < samples; ++k) {
+    left[k] += data[2 * k];
+    right[k] += data[2 * k + 1];
+  }
 }
 
 void MixToFloatFrame(const std::vector<AudioFrame*>& mix_list,
@@ -80,21 +164,32 @@ void MixToFloatFrame(const std::vector<AudioFrame*>& mix_list,
                      MixingBuffer* mixing_buffer) {
   RTC_DCHECK_LE(samples_per_channel, FrameCombiner::kMaximumChannelSize);
   RTC_DCHECK_LE(number_of_channels, FrameCombiner::kMaximumNumberOfChannels);
-  // Clear the mixing buffer.
-  for (auto& one_channel_buffer : *mixing_buffer) {
-    std::fill(one_channel_buffer.begin(), one_channel_buffer.end(), 0.f);
+  const size_t mixed_channels =
+      std::min(number_of_channels, FrameCombiner::kMaximumNumberOfChannels);
+  const size_t mixed_samples =
+      std::min(samples_per_channel, FrameCombiner::kMaximumChannelSize);
+
+  // Clear the part of the mixing buffer that is read back below. The buffer
+  // itself is owned by FrameCombiner and reused across the 10 ms ticks.
+  for (size_t j = 0; j < mixed_channels; ++j) {
+    std::fill((*mixing_buffer)[j].begin(),
+              (*mixing_buffer)[j].begin() + mixed_samples, 0.f);
   }
 
   // Convert to FloatS16 and mix.
   for (size_t i = 0; i < mix_list.size(); ++i) {
     const AudioFrame* const frame = mix_list[i];
-    for (size_t j = 0; j < std::min(number_of_channels,
-                                    FrameCombiner::kMaximumNumberOfChannels);
-         ++j) {
-      for (size_t k = 0; k < std::min(samples_per_channel,
-                                      FrameCombiner::kMaximumChannelSize);
-           ++k) {
-        (*mixing_buffer)[j][k] += frame->data()[number_of_channels * k + j];
+    if (number_of_channels == 1) {
+      AccumulateMonoFrame(frame->data(), mixed_samples,
+                          &(*mixing_buffer)[0][0]);
+    } else if (number_of_channels == 2) {
+      AccumulateStereoFrame(frame->data(), mixed_samples,
+                            &(*mixing_buffer)[0][0], &(*mixing_buffer)[1][0]);
+    } else {
+      for (size_t j = 0; j < mixed_channels; ++j) {
+        for (size_t k = 0; k < mixed_samples; ++k) {
+          (*mixing_buffer)[j][k] += frame->data()[number_of_channels * k + j];
+        }
       }
     }
   }
@@ -108,18 +203,121 @@ void RunLimiter(AudioFrameView<float> mixing_buffer_view, Limiter* limiter) {
   limiter->Process(mixing_buffer_view);
 }
 
-// Both interleaves and rounds.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Rounds four FloatS16 samples to int32 with the same clamp-then-round-half-
+// away-from-zero behavior as the scalar FloatS16ToS16(). Rounding is done by
+// adding a sign-matched 0.5 and truncating, which avoids the round-to-even
+// ties of CVTPS2DQ.
+__m128i FloatS16ToS32x4(__m128 x) {
+  const __m128 sign_mask = _mm_set1_ps(-0.f);
+  x = _mm_max_ps(_mm_min_ps(x, _mm_set1_ps(32767.f)), _mm_set1_ps(-32768.f));
+  const __m128 half =
+      _mm_or_ps(_mm_and_ps(x, sign_mask), _mm_set1_ps(0.5f));
+  return _mm_cvttps_epi32(_mm_add_ps(x, half));
+}
+#elif defined(WEBRTC_HAS_NEON)
+int32x4_t FloatS16ToS32x4(float32x4_t x) {
+  const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+  x = vmaxq_f32(vminq_f32(x, vdupq_n_f32(32767.f)), vdupq_n_f32(-32768.f));
+  const float32x4_t half = vreinterpretq_f32_u32(
+      vorrq_u32(vandq_u32(vreinterpretq_u32_f32(x), sign_mask),
+                vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+  return vcvtq_s32_f32(vaddq_f32(x, half));
+}
+#endif
+
+// Both interleaves and rounds. The absolute peak of the written samples is
+// tracked alongside the conversion so that level metering downstream can
+// reuse it instead of scanning the frame again.
 void InterleaveToAudioFrame(AudioFrameView<const float> mixing_buffer_view,
                             AudioFrame* audio_frame_for_mixing) {
   const size_t number_of_channels = mixing_buffer_view.num_channels();
   const size_t samples_per_channel = mixing_buffer_view.samples_per_channel();
-  // Put data in the result frame.
+  int16_t* const out = audio_frame_for_mixing->mutable_data();
+  int32_t max_abs = 0;
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  __m128i vmin = _mm_setzero_si128();
+  __m128i vmax = _mm_setzero_si128();
+  if (number_of_channels == 1) {
+    const float* mix = mixing_buffer_view.channel(0).data();
+    for (; j + 8 <= samples_per_channel; j += 8) {
+      const __m128i lo = FloatS16ToS32x4(_mm_loadu_ps(mix + j));
+      const __m128i hi = FloatS16ToS32x4(_mm_loadu_ps(mix + j + 4));
+      const __m128i samples = _mm_packs_epi32(lo, hi);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), samples);
+      vmin = _mm_min_epi16(vmin, samples);
+      vmax = _mm_max_epi16(vmax, samples);
+    }
+  } else if (number_of_channels == 2) {
+    const float* left = mixing_buffer_view.channel(0).data();
+    const float* right = mixing_buffer_view.channel(1).data();
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      const __m128i l = FloatS16ToS32x4(_mm_loadu_ps(left + j));
+      const __m128i r = FloatS16ToS32x4(_mm_loadu_ps(right + j));
+      // {L0 L1 L2 L3} x {R0 R1 R2 R3} -> {L0 R0 L1 R1 L2 R2 L3 R3}.
+      const __m128i samples =
+          _mm_packs_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * j), samples);
+      vmin = _mm_min_epi16(vmin, samples);
+      vmax = _mm_max_epi16(vmax, samples);
+    }
+  }
+  {
+    int16_t lanes[8];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), vmax);
+    for (int16_t lane : lanes)
+      max_abs = std::max(max_abs, static_cast<int32_t>(lane));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), vmin);
+    for (int16_t lane : lanes)
+      max_abs = std::max(max_abs, -static_cast<int32_t>(lane));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  int16x8_t vmin = vdupq_n_s16(0);
+  int16x8_t vmax = vdupq_n_s16(0);
+  if (number_of_channels == 1) {
+    const float* mix = mixing_buffer_view.channel(0).data();
+    for (; j + 8 <= samples_per_channel; j += 8) {
+      const int16x4_t lo = vqmovn_s32(FloatS16ToS32x4(vld1q_f32(mix + j)));
+      const int16x4_t hi = vqmovn_s32(FloatS16ToS32x4(vld1q_f32(mix + j + 4)));
+      const int16x8_t samples = vcombine_s16(lo, hi);
+      vst1q_s16(out + j, samples);
+      vmin = vminq_s16(vmin, samples);
+      vmax = vmaxq_s16(vmax, samples);
+    }
+  } else if (number_of_channels == 2) {
+    const float* left = mixing_buffer_view.channel(0).data();
+    const float* right = mixing_buffer_view.channel(1).data();
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      int16x4x2_t lr;
+      lr.val[0] = vqmovn_s32(FloatS16ToS32x4(vld1q_f32(left + j)));
+      lr.val[1] = vqmovn_s32(FloatS16ToS32x4(vld1q_f32(right + j)));
+      vst2_s16(out + 2 * j, lr);
+      const int16x8_t samples = vcombine_s16(lr.val[0], lr.val[1]);
+      vmin = vminq_s16(vmin, samples);
+      vmax = vmaxq_s16(vmax, samples);
+    }
+  }
+  {
+    int16_t lanes[8];
+    vst1q_s16(lanes, vmax);
+    for (int16_t lane : lanes)
+      max_abs = std::max(max_abs, static_cast<int32_t>(lane));
+    vst1q_s16(lanes, vmin);
+    for (int16_t lane : lanes)
+      max_abs = std::max(max_abs, -static_cast<int32_t>(lane));
+  }
+#endif
+  // Remaining samples and channel counts above two.
   for (size_t i = 0; i < number_of_channels; ++i) {
-    for (size_t j = 0; j < samples_per_channel; ++j) {
-      audio_frame_for_mixing->mutable_data()[number_of_channels * j + i] =
-          FloatS16ToS16(mixing_buffer_view.channel(i)[j]);
+    for (size_t k = j; k < samples_per_channel; ++k) {
+      const int16_t sample = FloatS16ToS16(mixing_buffer_view.channel(i)[k]);
+      out[number_of_channels * k + i] = sample;
+      max_abs = std::max(max_abs, std::abs(static_cast<int32_t>(sample)));
     }
   }
+  audio_frame_for_mixing->set_cached_abs_peak(
+      static_cast<int16_t>(std::min<int32_t>(max_abs, 32767)));
 }
 }  // namespace
 
@@ -46,6 +46,9 @@ struct FftData {
     RTC_DCHECK_EQ(kFftLengthBy2Plus1, power_spectrum.size());
     switch (optimization) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+      // The SSE2 implementation is used for AVX2 as well, as the gain from
+      // widening this computation does not merit a separate kernel.
+      case Aec3Optimization::kAvx2:
       case Aec3Optimization::kSse2: {
         constexpr int kNumFourBinBands = kFftLengthBy2 / 4;
         constexpr int kLimit = kNumFourBinBands * 4;
@@ -80,7 +80,6 @@ class RenderDelayBufferImpl final : public RenderDelayBuffer {
   DownsampledRenderBuffer low_rate_;
   Decimator render_decimator_;
   const Aec3Fft fft_;
-  std::vector<float> render_ds_;
   const int buffer_headroom_;
   bool last_call_was_render_ = false;
   int num_api_calls_in_a_row_ = 0;
@@ -135,7 +134,6 @@ RenderDelayBufferImpl::RenderDelayBufferImpl(const EchoCanceller3Config& config,
                                          config.delay.num_filters)),
       render_decimator_(down_sampling_factor_),
       fft_(),
-      render_ds_(sub_block_size_, 0.f),
       buffer_headroom_(config.filter.main.length_blocks) {
   RTC_DCHECK_EQ(blocks_.buffer.size(), ffts_.buffer.size());
   RTC_DCHECK_EQ(spectra_.buffer.size(), ffts_.buffer.size());
@@ -364,7 +362,6 @@ void RenderDelayBufferImpl::InsertBlock(
     int previous_write) {
   auto& b = blocks_;
   auto& lr = low_rate_;
-  auto& ds = render_ds_;
   auto& f = ffts_;
   auto& s = spectra_;
   RTC_DCHECK_EQ(block.size(), b.buffer[b.write].size());
@@ -373,14 +370,20 @@ void RenderDelayBufferImpl::InsertBlock(
     std::copy(block[k].begin(), block[k].end(), b.buffer[b.write][k].begin());
   }
 
-  data_dumper_->DumpWav("aec3_render_decimator_input", block[0][0].size(),
-                        block[0][0].data(), 16000, 1);
-  render_decimator_.Decimate(block[0][0], ds);
+  // The block ring buffer is the only copy of the render data; the decimator
+  // and the FFT read directly from the newly written slot.
+  const std::vector<float>& x0 = b.buffer[b.write][0][0];
+  data_dumper_->DumpWav("aec3_render_decimator_input", x0.size(), x0.data(),
+                        16000, 1);
+  // Decimate directly into the low-rate ring buffer. The buffer stores the
+  // samples in reverse order, so reverse the newly written segment in place
+  // instead of staging the decimator output in a separate vector.
+  rtc::ArrayView<float> ds(lr.buffer.data() + lr.write, sub_block_size_);
+  render_decimator_.Decimate(x0, ds);
   data_dumper_->DumpWav("aec3_render_decimator_output", ds.size(), ds.data(),
                         16000 / down_sampling_factor_, 1);
-  std::copy(ds.rbegin(), ds.rend(), lr.buffer.begin() + lr.write);
-  fft_.PaddedFft(block[0][0], b.buffer[previous_write][0][0],
-                 &f.buffer[f.write]);
+  std::reverse(ds.begin(), ds.end());
+  fft_.PaddedFft(x0, b.buffer[previous_write][0][0], &f.buffer[f.write]);
   // TODO(http://bugs.webrtc.org/10913): Loop over all channels when FftBuffer
   // supports multi-channel.
   f.buffer[f.write].Spectrum(optimization_, s.buffer[s.write][/*channel=*/0]);
@@ -39,10 +39,23 @@ class VectorMath {
   explicit VectorMath(Aec3Optimization optimization)
       : optimization_(optimization) {}
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // AVX2 variants of the operations below, defined in vector_math_avx2.cc
+  // which is compiled with AVX2 support.
+  void SqrtAVX2(rtc::ArrayView<float> x);
+  void MultiplyAVX2(rtc::ArrayView<const float> x,
+                    rtc::ArrayView<const float> y,
+                    rtc::ArrayView<float> z);
+  void AccumulateAVX2(rtc::ArrayView<const float> x, rtc::ArrayView<float> z);
+#endif
+
   // Elementwise square root.
   void Sqrt(rtc::ArrayView<float> x) {
     switch (optimization_) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+      case Aec3Optimization::kAvx2:
+        SqrtAVX2(x);
+        break;
       case Aec3Optimization::kSse2: {
         const int x_size = static_cast<int>(x.size());
         const int vector_limit = x_size >> 2;
@@ -117,6 +130,9 @@ class VectorMath {
     RTC_DCHECK_EQ(z.size(), y.size());
     switch (optimization_) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+      case Aec3Optimization::kAvx2:
+        MultiplyAVX2(x, y, z);
+        break;
       case Aec3Optimization::kSse2: {
         const int x_size = static_cast<int>(x.size());
         const int vector_limit = x_size >> 2;
@@ -163,6 +179,9 @@ class VectorMath {
     RTC_DCHECK_EQ(z.size(), x.size());
     switch (optimization_) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+      case Aec3Optimization::kAvx2:
+        AccumulateAVX2(x, z);
+        break;
       case Aec3Optimization::kSse2: {
         const int x_size = static_cast<int>(x.size());
         const int vector_limit = x_size >> 2;
@@ -41,6 +41,18 @@ class RTC_EXPORT AecDumpFactory {
   static std::unique_ptr<AecDump> Create(FILE* handle,
                                          int64_t max_log_size_bytes,
                                          rtc::TaskQueue* worker_queue);
+
+  // As above, but the returned AecDump writes on an internal dedicated
+  // thread instead of a client-provided task queue. Events are handed over
+  // through a bounded queue and dropped rather than queued without limit if
+  // the writer cannot keep up, which makes these variants suitable for
+  // continuously recording dumps in production.
+  static std::unique_ptr<AecDump> Create(webrtc::FileWrapper file,
+                                         int64_t max_log_size_bytes);
+  static std::unique_ptr<AecDump> Create(std::string file_name,
+                                         int64_t max_log_size_bytes);
+  static std::unique_ptr<AecDump> Create(FILE* handle,
+                                         int64_t max_log_size_bytes);
 };
 
 }  // namespace webrtc
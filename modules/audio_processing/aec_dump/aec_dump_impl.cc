@@ -20,6 +20,13 @@
 namespace webrtc {
 
 namespace {
+
+// Upper bound on the number of events waiting for the internal writer
+// thread. The capture path produces in the order of a couple of hundred
+// events per second, so this comes out at roughly a second of buffering
+// before events are dropped.
+constexpr size_t kWriterThreadQueueCapacity = 200;
+
 void CopyFromConfigToEvent(const webrtc::InternalAPMConfig& config,
                            webrtc::audioproc::Config* pb_cfg) {
   pb_cfg->set_aec_enabled(config.aec_enabled);
@@ -63,7 +70,20 @@ AecDumpImpl::AecDumpImpl(FileWrapper debug_file,
       worker_queue_(worker_queue),
       capture_stream_info_(CreateWriteToFileTask()) {}
 
+AecDumpImpl::AecDumpImpl(FileWrapper debug_file, int64_t max_log_size_bytes)
+    : debug_file_(std::move(debug_file)),
+      num_bytes_left_for_log_(max_log_size_bytes),
+      worker_queue_(nullptr),
+      writer_thread_(
+          absl::make_unique<AecDumpWriterThread>(kWriterThreadQueueCapacity)),
+      capture_stream_info_(CreateWriteToFileTask()) {}
+
 AecDumpImpl::~AecDumpImpl() {
+  if (writer_thread_) {
+    // The writer thread d-tor writes all still-queued events.
+    writer_thread_.reset();
+    return;
+  }
   // Block until all tasks have finished running.
   rtc::Event thread_sync_event;
   worker_queue_->PostTask([&thread_sync_event] { thread_sync_event.Set(); });
@@ -96,7 +116,7 @@ void AecDumpImpl::WriteInitMessage(const ProcessingConfig& api_format,
       api_format.reverse_output_stream().num_channels());
   msg->set_timestamp_ms(time_now_ms);
 
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
 }
 
 void AecDumpImpl::AddCaptureStreamInput(
@@ -124,7 +144,7 @@ void AecDumpImpl::AddAudioProcessingState(const AudioProcessingState& state) {
 void AecDumpImpl::WriteCaptureStreamMessage() {
   auto task = capture_stream_info_.GetTask();
   RTC_DCHECK(task);
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
   capture_stream_info_.SetTask(CreateWriteToFileTask());
 }
 
@@ -138,7 +158,7 @@ void AecDumpImpl::WriteRenderStreamMessage(const AudioFrame& frame) {
       sizeof(int16_t) * frame.samples_per_channel_ * frame.num_channels_;
   msg->set_data(frame.data(), data_size);
 
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
 }
 
 void AecDumpImpl::WriteRenderStreamMessage(
@@ -155,7 +175,7 @@ void AecDumpImpl::WriteRenderStreamMessage(
     msg->add_channel(channel_view.begin(), sizeof(float) * channel_view.size());
   }
 
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
 }
 
 void AecDumpImpl::WriteConfig(const InternalAPMConfig& config) {
@@ -164,7 +184,7 @@ void AecDumpImpl::WriteConfig(const InternalAPMConfig& config) {
   auto* event = task->GetEvent();
   event->set_type(audioproc::Event::CONFIG);
   CopyFromConfigToEvent(config, event->mutable_config());
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
 }
 
 void AecDumpImpl::WriteRuntimeSetting(
@@ -208,14 +228,29 @@ void AecDumpImpl::WriteRuntimeSetting(
       RTC_NOTREACHED();
       break;
   }
-  worker_queue_->PostTask(std::move(task));
+  PostWriteToFileTask(std::move(task));
 }
 
 std::unique_ptr<WriteToFileTask> AecDumpImpl::CreateWriteToFileTask() {
+  if (writer_thread_) {
+    auto task = writer_thread_->TakeRecycledTask();
+    if (task) {
+      task->GetEvent()->Clear();
+      return task;
+    }
+  }
   return absl::make_unique<WriteToFileTask>(&debug_file_,
                                             &num_bytes_left_for_log_);
 }
 
+void AecDumpImpl::PostWriteToFileTask(std::unique_ptr<WriteToFileTask> task) {
+  if (writer_thread_) {
+    writer_thread_->PostTask(std::move(task));
+    return;
+  }
+  worker_queue_->PostTask(std::move(task));
+}
+
 std::unique_ptr<AecDump> AecDumpFactory::Create(webrtc::FileWrapper file,
                                                 int64_t max_log_size_bytes,
                                                 rtc::TaskQueue* worker_queue) {
@@ -240,4 +275,23 @@ std::unique_ptr<AecDump> AecDumpFactory::Create(FILE* handle,
   return Create(FileWrapper(handle), max_log_size_bytes, worker_queue);
 }
 
+std::unique_ptr<AecDump> AecDumpFactory::Create(webrtc::FileWrapper file,
+                                                int64_t max_log_size_bytes) {
+  if (!file.is_open())
+    return nullptr;
+
+  return absl::make_unique<AecDumpImpl>(std::move(file), max_log_size_bytes);
+}
+
+std::unique_ptr<AecDump> AecDumpFactory::Create(std::string file_name,
+                                                int64_t max_log_size_bytes) {
+  return Create(FileWrapper::OpenWriteOnly(file_name.c_str()),
+                max_log_size_bytes);
+}
+
+std::unique_ptr<AecDump> AecDumpFactory::Create(FILE* handle,
+                                                int64_t max_log_size_bytes) {
+  return Create(FileWrapper(handle), max_log_size_bytes);
+}
+
 }  // namespace webrtc
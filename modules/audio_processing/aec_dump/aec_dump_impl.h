@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "api/audio/audio_frame.h"
+#include "modules/audio_processing/aec_dump/aec_dump_writer_thread.h"
 #include "modules/audio_processing/aec_dump/capture_stream_info.h"
 #include "modules/audio_processing/aec_dump/write_to_file_task.h"
 #include "modules/audio_processing/include/aec_dump.h"
@@ -49,6 +50,12 @@ class AecDumpImpl : public AecDump {
               int64_t max_log_size_bytes,
               rtc::TaskQueue* worker_queue);
 
+  // As above, but writes on an internal dedicated thread instead of a
+  // client-provided task queue. The internal queue is bounded and drops
+  // events rather than blocking, which makes this variant safe to keep
+  // enabled in deadline-sensitive capture paths.
+  AecDumpImpl(FileWrapper debug_file, int64_t max_log_size_bytes);
+
   ~AecDumpImpl() override;
 
   void WriteInitMessage(const ProcessingConfig& api_format,
@@ -71,11 +78,13 @@ class AecDumpImpl : public AecDump {
 
  private:
   std::unique_ptr<WriteToFileTask> CreateWriteToFileTask();
+  void PostWriteToFileTask(std::unique_ptr<WriteToFileTask> task);
 
   FileWrapper debug_file_;
   int64_t num_bytes_left_for_log_ = 0;
   rtc::RaceChecker race_checker_;
   rtc::TaskQueue* worker_queue_;
+  std::unique_ptr<AecDumpWriterThread> writer_thread_;
   CaptureStreamInfo capture_stream_info_;
 };
 }  // namespace webrtc
@@ -46,6 +46,33 @@ TEST(AecDumper, APICallsDoNotCrash) {
   ASSERT_EQ(0, remove(filename.c_str()));
 }
 
+TEST(AecDumper, WriteToFileWithInternalWriterThread) {
+  const std::string filename =
+      webrtc::test::TempFilename(webrtc::test::OutputPath(), "aec_dump");
+
+  {
+    // No worker queue: the AecDump writes on its own thread.
+    std::unique_ptr<webrtc::AecDump> aec_dump =
+        webrtc::AecDumpFactory::Create(filename, -1);
+    const webrtc::AudioFrame frame;
+    for (int i = 0; i < 100; ++i) {
+      aec_dump->WriteRenderStreamMessage(frame);
+      aec_dump->AddCaptureStreamInput(frame);
+      aec_dump->AddCaptureStreamOutput(frame);
+      aec_dump->WriteCaptureStreamMessage();
+    }
+  }
+
+  // Verify the file has been written after the AecDump d-tor has
+  // finished.
+  FILE* fid = fopen(filename.c_str(), "r");
+  ASSERT_TRUE(fid != NULL);
+
+  // Clean it up.
+  ASSERT_EQ(0, fclose(fid));
+  ASSERT_EQ(0, remove(filename.c_str()));
+}
+
 TEST(AecDumper, WriteToFile) {
   webrtc::TaskQueueForTest file_writer_queue("file_writer_queue");
 
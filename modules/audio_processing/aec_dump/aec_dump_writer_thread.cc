@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/aec_dump/aec_dump_writer_thread.h"
+
+#include <utility>
+
+#include "rtc_base/atomic_ops.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace webrtc {
+
+AecDumpWriterThread::AecDumpWriterThread(size_t queue_capacity)
+    : queue_(queue_capacity),
+      wake_(/*manual_reset=*/false, /*initially_signaled=*/false),
+      thread_(&AecDumpWriterThread::ThreadRun,
+              this,
+              "AecDumpWriter",
+              rtc::kLowPriority) {
+  RTC_DCHECK_GT(queue_capacity, 0);
+  thread_.Start();
+}
+
+AecDumpWriterThread::~AecDumpWriterThread() {
+  rtc::AtomicOps::ReleaseStore(&exiting_, 1);
+  wake_.Set();
+  thread_.Stop();
+  // No producers are left at this point; write what remains in the queue.
+  std::unique_ptr<WriteToFileTask> task;
+  while (queue_.Remove(&task)) {
+    task->Run();
+  }
+  if (num_dropped_tasks_ > 0) {
+    RTC_LOG(LS_WARNING) << "Aec dump dropped " << num_dropped_tasks_
+                        << " events because the writer could not keep up.";
+  }
+}
+
+void AecDumpWriterThread::PostTask(std::unique_ptr<WriteToFileTask> task) {
+  RTC_DCHECK(task);
+  {
+    rtc::CritScope cs(&producer_lock_);
+    if (!queue_.Insert(&task)) {
+      // The writer is stalled on I/O. The queue is single-consumer, so the
+      // oldest entry cannot be evicted from here; drop the incoming event
+      // instead, which is equivalent under a sustained stall.
+      ++num_dropped_tasks_;
+      return;
+    }
+    // The insert swapped out the task left behind by the writer thread (or
+    // nullptr while the queue is warming up). Keep it so that its event
+    // storage can be reused.
+    if (task) {
+      recycled_task_ = std::move(task);
+    }
+  }
+  wake_.Set();
+}
+
+std::unique_ptr<WriteToFileTask> AecDumpWriterThread::TakeRecycledTask() {
+  rtc::CritScope cs(&producer_lock_);
+  return std::move(recycled_task_);
+}
+
+void AecDumpWriterThread::ThreadRun(void* obj) {
+  static_cast<AecDumpWriterThread*>(obj)->Loop();
+}
+
+void AecDumpWriterThread::Loop() {
+  while (true) {
+    wake_.Wait(rtc::Event::kForever);
+    // Drain the whole queue per wakeup, so that under load several events
+    // are encoded and written back to back. Each removed task leaves the
+    // previously written one in its queue slot, from where the producers
+    // pick it up for reuse.
+    std::unique_ptr<WriteToFileTask> task;
+    while (queue_.Remove(&task)) {
+      task->Run();
+    }
+    if (rtc::AtomicOps::AcquireLoad(&exiting_)) {
+      return;
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_AEC_DUMP_AEC_DUMP_WRITER_THREAD_H_
+#define MODULES_AUDIO_PROCESSING_AEC_DUMP_AEC_DUMP_WRITER_THREAD_H_
+
+#include <memory>
+
+#include "modules/audio_processing/aec_dump/write_to_file_task.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/swap_queue.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Writes queued WriteToFileTasks on a dedicated low-priority thread, so that
+// enabling an aec dump adds no file I/O to the real-time audio threads. Tasks
+// are handed over through a fixed-size SwapQueue and the queue slots are
+// recycled back to the producers, so posting a task does not allocate in
+// steady state. If the queue fills up because the writer is stalled on I/O,
+// further tasks are dropped (and counted) instead of blocking the audio
+// threads or growing the queue.
+class AecDumpWriterThread {
+ public:
+  explicit AecDumpWriterThread(size_t queue_capacity);
+
+  // Writes all tasks still in the queue before returning.
+  ~AecDumpWriterThread();
+
+  // Queues |task| for writing. Safe to call from several threads, but must
+  // not be called during or after destruction.
+  void PostTask(std::unique_ptr<WriteToFileTask> task);
+
+  // Returns a previously written task whose storage can be reused, or
+  // nullptr if none is available.
+  std::unique_ptr<WriteToFileTask> TakeRecycledTask();
+
+ private:
+  static void ThreadRun(void* obj);
+  void Loop();
+
+  rtc::CriticalSection producer_lock_;
+  SwapQueue<std::unique_ptr<WriteToFileTask>> queue_;
+  std::unique_ptr<WriteToFileTask> recycled_task_
+      RTC_GUARDED_BY(producer_lock_);
+  int64_t num_dropped_tasks_ RTC_GUARDED_BY(producer_lock_) = 0;
+  rtc::Event wake_;
+  volatile int exiting_ = 0;
+  rtc::PlatformThread thread_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_AEC_DUMP_AEC_DUMP_WRITER_THREAD_H_
@@ -40,13 +40,14 @@ class WriteToFileTask : public QueuedTask {
 
   audioproc::Event* GetEvent();
 
+  // Called by the task queue, and directly by AecDumpWriterThread.
+  bool Run() override;
+
  private:
   bool IsRoomForNextEvent(size_t event_byte_size) const;
 
   void UpdateBytesLeft(size_t event_byte_size);
 
-  bool Run() override;
-
   webrtc::FileWrapper* const debug_file_;
   audioproc::Event event_;
   int64_t* const num_bytes_left_for_log_;
@@ -19,6 +19,14 @@
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_minmax.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 namespace {
@@ -77,7 +85,29 @@ void ScaleSamples(rtc::ArrayView<const float> per_sample_scaling_factors,
   RTC_DCHECK_EQ(samples_per_channel, per_sample_scaling_factors.size());
   for (size_t i = 0; i < signal.num_channels(); ++i) {
     auto channel = signal.channel(i);
-    for (size_t j = 0; j < samples_per_channel; ++j) {
+    size_t j = 0;
+    // Multiply and clamp; the vector min/max match SafeClamp() since the
+    // products are never NaN, so the output is bit-exact with the scalar
+    // remainder loop.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    const __m128 min_value = _mm_set1_ps(kMinFloatS16Value);
+    const __m128 max_value = _mm_set1_ps(kMaxFloatS16Value);
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      const __m128 x = _mm_mul_ps(_mm_loadu_ps(&channel[j]),
+                                  _mm_loadu_ps(&per_sample_scaling_factors[j]));
+      _mm_storeu_ps(&channel[j],
+                    _mm_max_ps(_mm_min_ps(x, max_value), min_value));
+    }
+#elif defined(WEBRTC_HAS_NEON)
+    const float32x4_t min_value = vdupq_n_f32(kMinFloatS16Value);
+    const float32x4_t max_value = vdupq_n_f32(kMaxFloatS16Value);
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      const float32x4_t x = vmulq_f32(
+          vld1q_f32(&channel[j]), vld1q_f32(&per_sample_scaling_factors[j]));
+      vst1q_f32(&channel[j], vmaxq_f32(vminq_f32(x, max_value), min_value));
+    }
+#endif
+    for (; j < samples_per_channel; ++j) {
       channel[j] = rtc::SafeClamp(channel[j] * per_sample_scaling_factors[j],
                                   kMinFloatS16Value, kMaxFloatS16Value);
     }
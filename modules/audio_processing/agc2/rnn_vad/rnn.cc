@@ -10,11 +10,21 @@
 
 #include "modules/audio_processing/agc2/rnn_vad/rnn.h"
 
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
 #include <algorithm>
 #include <array>
 #include <cmath>
 
 #include "rtc_base/checks.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
 #include "third_party/rnnoise/src/rnn_activations.h"
 #include "third_party/rnnoise/src/rnn_vad_weights.h"
 
@@ -48,17 +58,161 @@ using rnnoise::RectifiedLinearUnit;
 using rnnoise::SigmoidApproximated;
 using rnnoise::TansigApproximated;
 
+namespace {
+
+// Number of gates of a gated recurrent unit (update, reset, output).
+constexpr size_t kNumGruGates = 3;
+
+// Casts the quantized parameters in |params| to float and scales them by the
+// quantization factor.
+std::vector<float> GetScaledParams(rtc::ArrayView<const int8_t> params) {
+  std::vector<float> scaled_params(params.size());
+  std::transform(params.begin(), params.end(), scaled_params.begin(),
+                 [](int8_t x) -> float { return kWeightsScale * x; });
+  return scaled_params;
+}
+
+// Casts and scales |weights| and re-arranges the layout so that the
+// coefficients for each output unit are stored contiguously - i.e., the
+// matrix-vector products below read both operands sequentially.
+std::vector<float> GetPreprocessedFcWeights(
+    rtc::ArrayView<const int8_t> weights,
+    const size_t output_size) {
+  if (output_size == 1) {
+    return GetScaledParams(weights);
+  }
+  // Transpose, scale and cast.
+  const size_t input_size = rtc::CheckedDivExact(weights.size(), output_size);
+  std::vector<float> w(weights.size());
+  for (size_t o = 0; o < output_size; ++o) {
+    for (size_t i = 0; i < input_size; ++i) {
+      w[o * input_size + i] = kWeightsScale * weights[i * output_size + o];
+    }
+  }
+  return w;
+}
+
+// Casts and scales |tensor_src| and re-arranges the layout from
+// |gate-interleaved| (i.e., the i-th input sample maps to the coefficients
+// with indexes {i * 3 * output_size, ..., (i + 1) * 3 * output_size - 1}) to
+// one in which, for each gate, the coefficients for each output unit are
+// stored contiguously.
+std::vector<float> GetPreprocessedGruTensor(
+    rtc::ArrayView<const int8_t> tensor_src,
+    const size_t output_size) {
+  const size_t input_size =
+      rtc::CheckedDivExact(tensor_src.size(), kNumGruGates * output_size);
+  const size_t stride_src = kNumGruGates * output_size;
+  const size_t stride_dst = output_size * input_size;
+  std::vector<float> tensor_dst(tensor_src.size());
+  for (size_t g = 0; g < kNumGruGates; ++g) {
+    for (size_t o = 0; o < output_size; ++o) {
+      for (size_t i = 0; i < input_size; ++i) {
+        tensor_dst[g * stride_dst + o * input_size + i] =
+            kWeightsScale * tensor_src[g * output_size + i * stride_src + o];
+      }
+    }
+  }
+  return tensor_dst;
+}
+
+float DotProduct_NONE(const float* a, const float* b, const size_t size) {
+  float dot_product = 0.f;
+  for (size_t i = 0; i < size; ++i) {
+    dot_product += a[i] * b[i];
+  }
+  return dot_product;
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+
+float DotProduct_SSE2(const float* a, const float* b, const size_t size) {
+  const size_t limit_by_4 = size >> 2;
+  const size_t limit = limit_by_4 * 4;
+  __m128 dot_product_128 = _mm_set1_ps(0);
+  for (size_t i = 0; i < limit; i += 4) {
+    const __m128 a_i = _mm_loadu_ps(a + i);
+    const __m128 b_i = _mm_loadu_ps(b + i);
+    dot_product_128 = _mm_add_ps(dot_product_128, _mm_mul_ps(a_i, b_i));
+  }
+  float* v = reinterpret_cast<float*>(&dot_product_128);
+  float dot_product = v[0] + v[1] + v[2] + v[3];
+  for (size_t i = limit; i < size; ++i) {
+    dot_product += a[i] * b[i];
+  }
+  return dot_product;
+}
+
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+
+float DotProduct_NEON(const float* a, const float* b, const size_t size) {
+  const size_t limit_by_4 = size >> 2;
+  const size_t limit = limit_by_4 * 4;
+  float32x4_t dot_product_128 = vdupq_n_f32(0);
+  for (size_t i = 0; i < limit; i += 4) {
+    const float32x4_t a_i = vld1q_f32(a + i);
+    const float32x4_t b_i = vld1q_f32(b + i);
+    dot_product_128 = vmlaq_f32(dot_product_128, a_i, b_i);
+  }
+  const float32x2_t dot_product_64 = vadd_f32(vget_low_f32(dot_product_128),
+                                              vget_high_f32(dot_product_128));
+  float dot_product = vget_lane_f32(dot_product_64, 0) +
+                      vget_lane_f32(dot_product_64, 1);
+  for (size_t i = limit; i < size; ++i) {
+    dot_product += a[i] * b[i];
+  }
+  return dot_product;
+}
+
+#endif
+
+float DotProduct(const Optimization optimization,
+                 const float* a,
+                 const float* b,
+                 const size_t size) {
+  switch (optimization) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    case Optimization::kSse2:
+      return DotProduct_SSE2(a, b, size);
+#endif
+#if defined(WEBRTC_HAS_NEON)
+    case Optimization::kNeon:
+      return DotProduct_NEON(a, b, size);
+#endif
+    default:
+      return DotProduct_NONE(a, b, size);
+  }
+}
+
+}  // namespace
+
+Optimization DetectOptimization() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (WebRtc_GetCPUInfo(kSSE2) != 0) {
+    return Optimization::kSse2;
+  }
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  return Optimization::kNeon;
+#endif
+  return Optimization::kNone;
+}
+
 FullyConnectedLayer::FullyConnectedLayer(
     const size_t input_size,
     const size_t output_size,
     const rtc::ArrayView<const int8_t> bias,
     const rtc::ArrayView<const int8_t> weights,
-    float (*const activation_function)(float))
+    float (*const activation_function)(float),
+    Optimization optimization)
     : input_size_(input_size),
       output_size_(output_size),
-      bias_(bias),
-      weights_(weights),
-      activation_function_(activation_function) {
+      bias_(GetScaledParams(bias)),
+      weights_(GetPreprocessedFcWeights(weights, output_size)),
+      activation_function_(activation_function),
+      optimization_(optimization) {
   RTC_DCHECK_LE(output_size_, kFullyConnectedLayersMaxUnits)
       << "Static over-allocation of fully-connected layers output vectors is "
          "not sufficient.";
@@ -75,16 +229,12 @@ rtc::ArrayView<const float> FullyConnectedLayer::GetOutput() const {
 }
 
 void FullyConnectedLayer::ComputeOutput(rtc::ArrayView<const float> input) {
-  // TODO(bugs.chromium.org/9076): Optimize using SSE/AVX fused multiply-add
-  // operations.
+  // The weights and the bias terms are scaled at construction time, hence no
+  // scaling is required before the activation function is applied.
   for (size_t o = 0; o < output_size_; ++o) {
-    output_[o] = bias_[o];
-    // TODO(bugs.chromium.org/9076): Benchmark how different layouts for
-    // |weights_| change the performance across different platforms.
-    for (size_t i = 0; i < input_size_; ++i) {
-      output_[o] += input[i] * weights_[i * output_size_ + o];
-    }
-    output_[o] = (*activation_function_)(kWeightsScale * output_[o]);
+    output_[o] = (*activation_function_)(
+        bias_[o] + DotProduct(optimization_, input.data(),
+                              weights_.data() + o * input_size_, input_size_));
   }
 }
 
@@ -94,21 +244,25 @@ GatedRecurrentLayer::GatedRecurrentLayer(
     const rtc::ArrayView<const int8_t> bias,
     const rtc::ArrayView<const int8_t> weights,
     const rtc::ArrayView<const int8_t> recurrent_weights,
-    float (*const activation_function)(float))
+    float (*const activation_function)(float),
+    Optimization optimization)
     : input_size_(input_size),
       output_size_(output_size),
-      bias_(bias),
-      weights_(weights),
-      recurrent_weights_(recurrent_weights),
-      activation_function_(activation_function) {
+      bias_(GetScaledParams(bias)),
+      weights_(GetPreprocessedGruTensor(weights, output_size)),
+      recurrent_weights_(
+          GetPreprocessedGruTensor(recurrent_weights, output_size)),
+      activation_function_(activation_function),
+      optimization_(optimization) {
   RTC_DCHECK_LE(output_size_, kRecurrentLayersMaxUnits)
       << "Static over-allocation of recurrent layers state vectors is not "
       << "sufficient.";
-  RTC_DCHECK_EQ(3 * output_size_, bias_.size())
+  RTC_DCHECK_EQ(kNumGruGates * output_size_, bias_.size())
       << "Mismatching output size and bias terms array size.";
-  RTC_DCHECK_EQ(3 * input_size_ * output_size_, weights_.size())
+  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_, weights_.size())
       << "Mismatching input-output size and weight coefficients array size.";
-  RTC_DCHECK_EQ(3 * input_size_ * output_size_, recurrent_weights_.size())
+  RTC_DCHECK_EQ(kNumGruGates * input_size_ * output_size_,
+                recurrent_weights_.size())
       << "Mismatching input-output size and recurrent weight coefficients array"
       << " size.";
   Reset();
@@ -125,56 +279,56 @@ void GatedRecurrentLayer::Reset() {
 }
 
 void GatedRecurrentLayer::ComputeOutput(rtc::ArrayView<const float> input) {
-  // TODO(bugs.chromium.org/9076): Optimize using SSE/AVX fused multiply-add
-  // operations.
-  // Stride and offset used to read parameter arrays.
-  const size_t stride = 3 * output_size_;
-  size_t offset = 0;
+  // Offsets (in coefficients) at which the update, reset and output gate
+  // parameters respectively start within |weights_|, |recurrent_weights_| and
+  // |bias_| - see GetPreprocessedGruTensor().
+  const size_t input_stride = output_size_ * input_size_;
+  const size_t state_stride = output_size_ * output_size_;
 
   // Compute update gates.
   std::array<float, kRecurrentLayersMaxUnits> update;
   for (size_t o = 0; o < output_size_; ++o) {
-    update[o] = bias_[o];
-    // TODO(bugs.chromium.org/9076): Benchmark how different layouts for
-    // |weights_| and |recurrent_weights_| change the performance across
-    // different platforms.
-    for (size_t i = 0; i < input_size_; ++i) {  // Add input.
-      update[o] += input[i] * weights_[i * stride + o];
-    }
-    for (size_t s = 0; s < output_size_; ++s) {
-      update[o] += state_[s] * recurrent_weights_[s * stride + o];
-    }  // Add state.
-    update[o] = SigmoidApproximated(kWeightsScale * update[o]);
+    update[o] = SigmoidApproximated(
+        bias_[o] +
+        DotProduct(optimization_, input.data(),
+                   weights_.data() + o * input_size_, input_size_) +
+        DotProduct(optimization_, state_.data(),
+                   recurrent_weights_.data() + o * output_size_,
+                   output_size_));
   }
 
   // Compute reset gates.
-  offset += output_size_;
   std::array<float, kRecurrentLayersMaxUnits> reset;
   for (size_t o = 0; o < output_size_; ++o) {
-    reset[o] = bias_[offset + o];
-    for (size_t i = 0; i < input_size_; ++i) {  // Add input.
-      reset[o] += input[i] * weights_[offset + i * stride + o];
-    }
-    for (size_t s = 0; s < output_size_; ++s) {  // Add state.
-      reset[o] += state_[s] * recurrent_weights_[offset + s * stride + o];
-    }
-    reset[o] = SigmoidApproximated(kWeightsScale * reset[o]);
+    reset[o] = SigmoidApproximated(
+        bias_[output_size_ + o] +
+        DotProduct(optimization_, input.data(),
+                   weights_.data() + input_stride + o * input_size_,
+                   input_size_) +
+        DotProduct(optimization_, state_.data(),
+                   recurrent_weights_.data() + state_stride + o * output_size_,
+                   output_size_));
+  }
+
+  // The state contribution to the output gates is weighed by the reset gates;
+  // pre-multiply so that the contribution reduces to a dot product.
+  std::array<float, kRecurrentLayersMaxUnits> reset_state;
+  for (size_t s = 0; s < output_size_; ++s) {
+    reset_state[s] = state_[s] * reset[s];
   }
 
-  // Compute output.
-  offset += output_size_;
+  // Compute output and update the state.
   std::array<float, kRecurrentLayersMaxUnits> output;
   for (size_t o = 0; o < output_size_; ++o) {
-    output[o] = bias_[offset + o];
-    for (size_t i = 0; i < input_size_; ++i) {  // Add input.
-      output[o] += input[i] * weights_[offset + i * stride + o];
-    }
-    for (size_t s = 0; s < output_size_;
-         ++s) {  // Add state through reset gates.
-      output[o] +=
-          state_[s] * recurrent_weights_[offset + s * stride + o] * reset[s];
-    }
-    output[o] = (*activation_function_)(kWeightsScale * output[o]);
+    output[o] = (*activation_function_)(
+        bias_[2 * output_size_ + o] +
+        DotProduct(optimization_, input.data(),
+                   weights_.data() + 2 * input_stride + o * input_size_,
+                   input_size_) +
+        DotProduct(
+            optimization_, reset_state.data(),
+            recurrent_weights_.data() + 2 * state_stride + o * output_size_,
+            output_size_));
     // Update output through the update gates.
     output[o] = update[o] * state_[o] + (1.f - update[o]) * output[o];
   }
@@ -189,18 +343,21 @@ RnnBasedVad::RnnBasedVad()
                    kInputLayerOutputSize,
                    kInputDenseBias,
                    kInputDenseWeights,
-                   TansigApproximated),
+                   TansigApproximated,
+                   DetectOptimization()),
       hidden_layer_(kInputLayerOutputSize,
                     kHiddenLayerOutputSize,
                     kHiddenGruBias,
                     kHiddenGruWeights,
                     kHiddenGruRecurrentWeights,
-                    RectifiedLinearUnit),
+                    RectifiedLinearUnit,
+                    DetectOptimization()),
       output_layer_(kHiddenLayerOutputSize,
                     kOutputLayerOutputSize,
                     kOutputDenseBias,
                     kOutputDenseWeights,
-                    SigmoidApproximated) {
+                    SigmoidApproximated,
+                    DetectOptimization()) {
   // Input-output chaining size checks.
   RTC_DCHECK_EQ(input_layer_.output_size(), hidden_layer_.input_size())
       << "The input and the hidden layers sizes do not match.";
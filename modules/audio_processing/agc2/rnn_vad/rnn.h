@@ -15,6 +15,7 @@
 #include <sys/types.h>
 
 #include <array>
+#include <vector>
 
 #include "api/array_view.h"
 #include "modules/audio_processing/agc2/rnn_vad/common.h"
@@ -22,6 +23,13 @@
 namespace webrtc {
 namespace rnn_vad {
 
+// Available SIMD optimizations for the matrix-vector products used during
+// inference.
+enum class Optimization { kNone, kSse2, kNeon };
+
+// Detects the best optimization available at run-time on the current platform.
+Optimization DetectOptimization();
+
 // Maximum number of units for a fully-connected layer. This value is used to
 // over-allocate space for fully-connected layers output vectors (implemented as
 // std::array). The value should equal the number of units of the largest
@@ -41,7 +49,8 @@ class FullyConnectedLayer {
                       const size_t output_size,
                       const rtc::ArrayView<const int8_t> bias,
                       const rtc::ArrayView<const int8_t> weights,
-                      float (*const activation_function)(float));
+                      float (*const activation_function)(float),
+                      Optimization optimization);
   FullyConnectedLayer(const FullyConnectedLayer&) = delete;
   FullyConnectedLayer& operator=(const FullyConnectedLayer&) = delete;
   ~FullyConnectedLayer();
@@ -54,9 +63,13 @@ class FullyConnectedLayer {
  private:
   const size_t input_size_;
   const size_t output_size_;
-  const rtc::ArrayView<const int8_t> bias_;
-  const rtc::ArrayView<const int8_t> weights_;
+  // Bias terms and weights scaled by the quantization factor and, for the
+  // weights, with transposed layout so that each output unit reads its
+  // coefficients sequentially.
+  const std::vector<float> bias_;
+  const std::vector<float> weights_;
   float (*const activation_function_)(float);
+  const Optimization optimization_;
   // The output vector of a recurrent layer has length equal to |output_size_|.
   // However, for efficiency, over-allocation is used.
   std::array<float, kFullyConnectedLayersMaxUnits> output_;
@@ -70,7 +83,8 @@ class GatedRecurrentLayer {
                       const rtc::ArrayView<const int8_t> bias,
                       const rtc::ArrayView<const int8_t> weights,
                       const rtc::ArrayView<const int8_t> recurrent_weights,
-                      float (*const activation_function)(float));
+                      float (*const activation_function)(float),
+                      Optimization optimization);
   GatedRecurrentLayer(const GatedRecurrentLayer&) = delete;
   GatedRecurrentLayer& operator=(const GatedRecurrentLayer&) = delete;
   ~GatedRecurrentLayer();
@@ -84,10 +98,14 @@ class GatedRecurrentLayer {
  private:
   const size_t input_size_;
   const size_t output_size_;
-  const rtc::ArrayView<const int8_t> bias_;
-  const rtc::ArrayView<const int8_t> weights_;
-  const rtc::ArrayView<const int8_t> recurrent_weights_;
+  // Bias terms and weights scaled by the quantization factor and, for the
+  // weights, with transposed layout so that each gate and output unit reads
+  // its coefficients sequentially.
+  const std::vector<float> bias_;
+  const std::vector<float> weights_;
+  const std::vector<float> recurrent_weights_;
   float (*const activation_function_)(float);
+  const Optimization optimization_;
   // The state vector of a recurrent layer has length equal to |output_size_|.
   // However, to avoid dynamic allocation, over-allocation is used.
   std::array<float, kRecurrentLayersMaxUnits> state_;
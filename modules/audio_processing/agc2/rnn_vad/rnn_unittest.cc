@@ -11,6 +11,7 @@
 #include "modules/audio_processing/agc2/rnn_vad/rnn.h"
 
 #include <array>
+#include <vector>
 
 #include "modules/audio_processing/agc2/rnn_vad/test_utils.h"
 #include "rtc_base/checks.h"
@@ -60,6 +61,17 @@ void TestGatedRecurrentLayer(
   }
 }
 
+// Returns the optimizations to test: the unoptimized code and, when
+// available, the optimization detected on the machine running the test.
+std::vector<Optimization> GetOptimizationsToTest() {
+  std::vector<Optimization> optimizations = {Optimization::kNone};
+  const Optimization detected = DetectOptimization();
+  if (detected != Optimization::kNone) {
+    optimizations.push_back(detected);
+  }
+  return optimizations;
+}
+
 }  // namespace
 
 // Checks that the output of a fully connected layer is within tolerance given
@@ -69,40 +81,45 @@ TEST(RnnVadTest, CheckFullyConnectedLayerOutput) {
   const std::array<int8_t, 24> weights = {
       127,  127,  127, 127,  127,  20,  127,  -126, -126, -54, 14,  125,
       -126, -126, 127, -125, -126, 127, -127, -127, -57,  -30, 127, 80};
-  FullyConnectedLayer fc(24, 1, bias, weights, SigmoidApproximated);
-  // Test on different inputs.
-  {
-    const std::array<float, 24> input_vector = {
-        0.f,           0.f,           0.f,          0.f,          0.f,
-        0.f,           0.215833917f,  0.290601075f, 0.238759011f, 0.244751841f,
-        0.f,           0.0461241305f, 0.106401242f, 0.223070428f, 0.630603909f,
-        0.690453172f,  0.f,           0.387645692f, 0.166913897f, 0.f,
-        0.0327451192f, 0.f,           0.136149868f, 0.446351469f};
-    TestFullyConnectedLayer(&fc, input_vector, 0.436567038f);
-  }
-  {
-    const std::array<float, 24> input_vector = {
-        0.592162728f,  0.529089332f,  1.18205106f,
-        1.21736848f,   0.f,           0.470851123f,
-        0.130675942f,  0.320903003f,  0.305496395f,
-        0.0571633279f, 1.57001138f,   0.0182026215f,
-        0.0977443159f, 0.347477973f,  0.493206412f,
-        0.9688586f,    0.0320267938f, 0.244722098f,
-        0.312745273f,  0.f,           0.00650715502f,
-        0.312553257f,  1.62619662f,   0.782880902f};
-    TestFullyConnectedLayer(&fc, input_vector, 0.874741316f);
-  }
-  {
-    const std::array<float, 24> input_vector = {
-        0.395022154f,  0.333681047f,  0.76302278f,
-        0.965480626f,  0.f,           0.941198349f,
-        0.0892967582f, 0.745046318f,  0.635769248f,
-        0.238564298f,  0.970656633f,  0.014159563f,
-        0.094203949f,  0.446816623f,  0.640755892f,
-        1.20532358f,   0.0254284926f, 0.283327013f,
-        0.726210058f,  0.0550272502f, 0.000344108557f,
-        0.369803518f,  1.56680179f,   0.997883797f};
-    TestFullyConnectedLayer(&fc, input_vector, 0.672785878f);
+  for (Optimization optimization : GetOptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    FullyConnectedLayer fc(24, 1, bias, weights, SigmoidApproximated,
+                           optimization);
+    // Test on different inputs.
+    {
+      const std::array<float, 24> input_vector = {
+          0.f,          0.f,           0.f,           0.f,
+          0.f,          0.f,           0.215833917f,  0.290601075f,
+          0.238759011f, 0.244751841f,  0.f,           0.0461241305f,
+          0.106401242f, 0.223070428f,  0.630603909f,  0.690453172f,
+          0.f,          0.387645692f,  0.166913897f,  0.f,
+          0.0327451192f, 0.f,          0.136149868f,  0.446351469f};
+      TestFullyConnectedLayer(&fc, input_vector, 0.436567038f);
+    }
+    {
+      const std::array<float, 24> input_vector = {
+          0.592162728f,  0.529089332f,  1.18205106f,
+          1.21736848f,   0.f,           0.470851123f,
+          0.130675942f,  0.320903003f,  0.305496395f,
+          0.0571633279f, 1.57001138f,   0.0182026215f,
+          0.0977443159f, 0.347477973f,  0.493206412f,
+          0.9688586f,    0.0320267938f, 0.244722098f,
+          0.312745273f,  0.f,           0.00650715502f,
+          0.312553257f,  1.62619662f,   0.782880902f};
+      TestFullyConnectedLayer(&fc, input_vector, 0.874741316f);
+    }
+    {
+      const std::array<float, 24> input_vector = {
+          0.395022154f,  0.333681047f,  0.76302278f,
+          0.965480626f,  0.f,           0.941198349f,
+          0.0892967582f, 0.745046318f,  0.635769248f,
+          0.238564298f,  0.970656633f,  0.014159563f,
+          0.094203949f,  0.446816623f,  0.640755892f,
+          1.20532358f,   0.0254284926f, 0.283327013f,
+          0.726210058f,  0.0550272502f, 0.000344108557f,
+          0.369803518f,  1.56680179f,   0.997883797f};
+      TestFullyConnectedLayer(&fc, input_vector, 0.672785878f);
+    }
   }
 }
 
@@ -123,21 +140,24 @@ TEST(RnnVadTest, CheckGatedRecurrentLayer) {
       64,  -62, 117, 85,  -51,  -43, 54,  -105, 120, 56,  -128, -107,
       39,  50,  -17, -47, -117, 14,  108, 12,   -7,  -72, 103,  -87,
       -66, 82,  84,  100, -98,  102, -49, 44,   122, 106, -20,  -69};
-  GatedRecurrentLayer gru(5, 4, bias, weights, recurrent_weights,
-                          RectifiedLinearUnit);
-  // Test on different inputs.
-  {
-    const std::array<float, 20> input_sequence = {
-        0.89395463f, 0.93224651f, 0.55788344f, 0.32341808f, 0.93355054f,
-        0.13475326f, 0.97370994f, 0.14253306f, 0.93710381f, 0.76093364f,
-        0.65780413f, 0.41657975f, 0.49403164f, 0.46843281f, 0.75138855f,
-        0.24517593f, 0.47657707f, 0.57064998f, 0.435184f,   0.19319285f};
-    const std::array<float, 16> expected_output_sequence = {
-        0.0239123f,  0.5773077f,  0.f,         0.f,
-        0.01282811f, 0.64330572f, 0.f,         0.04863098f,
-        0.00781069f, 0.75267816f, 0.f,         0.02579715f,
-        0.00471378f, 0.59162533f, 0.11087593f, 0.01334511f};
-    TestGatedRecurrentLayer(&gru, input_sequence, expected_output_sequence);
+  for (Optimization optimization : GetOptimizationsToTest()) {
+    SCOPED_TRACE(static_cast<int>(optimization));
+    GatedRecurrentLayer gru(5, 4, bias, weights, recurrent_weights,
+                            RectifiedLinearUnit, optimization);
+    // Test on different inputs.
+    {
+      const std::array<float, 20> input_sequence = {
+          0.89395463f, 0.93224651f, 0.55788344f, 0.32341808f, 0.93355054f,
+          0.13475326f, 0.97370994f, 0.14253306f, 0.93710381f, 0.76093364f,
+          0.65780413f, 0.41657975f, 0.49403164f, 0.46843281f, 0.75138855f,
+          0.24517593f, 0.47657707f, 0.57064998f, 0.435184f,   0.19319285f};
+      const std::array<float, 16> expected_output_sequence = {
+          0.0239123f,  0.5773077f,  0.f,         0.f,
+          0.01282811f, 0.64330572f, 0.f,         0.04863098f,
+          0.00781069f, 0.75267816f, 0.f,         0.02579715f,
+          0.00471378f, 0.59162533f, 0.11087593f, 0.01334511f};
+      TestGatedRecurrentLayer(&gru, input_sequence, expected_output_sequence);
+    }
   }
 }
 
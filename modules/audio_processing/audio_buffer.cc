@@ -12,13 +12,23 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 
 #include "common_audio/channel_buffer.h"
 #include "common_audio/include/audio_util.h"
 #include "common_audio/resampler/push_sinc_resampler.h"
 #include "modules/audio_processing/splitting_filter.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 namespace {
@@ -37,6 +47,42 @@ size_t NumBandsFromFramesPerChannel(size_t num_frames) {
   return 1;
 }
 
+// Deinterleaves a stereo int16 frame into two float channel buffers,
+// converting the samples in the same pass. Since the int16 range is exactly
+// representable in float the result is identical to a scalar per-channel
+// copy.
+void DeinterleaveStereoToFloat(const int16_t* interleaved,
+                               size_t samples_per_channel,
+                               float* left,
+                               float* right) {
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; j + 4 <= samples_per_channel; j += 4) {
+    const __m128i lr =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(interleaved + 2 * j));
+    // Sign-extend the even (left) and odd (right) 16 bit lanes to 32 bits.
+    const __m128i l32 = _mm_srai_epi32(_mm_slli_epi32(lr, 16), 16);
+    const __m128i r32 = _mm_srai_epi32(lr, 16);
+    _mm_storeu_ps(left + j, _mm_cvtepi32_ps(l32));
+    _mm_storeu_ps(right + j, _mm_cvtepi32_ps(r32));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; j + 8 <= samples_per_channel; j += 8) {
+    const int16x8x2_t lr = vld2q_s16(interleaved + 2 * j);
+    vst1q_f32(left + j, vcvtq_f32_s32(vmovl_s16(vget_low_s16(lr.val[0]))));
+    vst1q_f32(left + j + 4,
+              vcvtq_f32_s32(vmovl_s16(vget_high_s16(lr.val[0]))));
+    vst1q_f32(right + j, vcvtq_f32_s32(vmovl_s16(vget_low_s16(lr.val[1]))));
+    vst1q_f32(right + j + 4,
+              vcvtq_f32_s32(vmovl_s16(vget_high_s16(lr.val[1]))));
+  }
+#endif
+  for (; j < samples_per_channel; ++j) {
+    left[j] = interleaved[2 * j];
+    right[j] = interleaved[2 * j + 1];
+  }
+}
+
 }  // namespace
 
 AudioBuffer::AudioBuffer(size_t input_rate,
@@ -102,6 +148,19 @@ AudioBuffer::AudioBuffer(size_t input_num_frames,
 
 AudioBuffer::~AudioBuffer() {}
 
+bool AudioBuffer::MatchesConfig(size_t input_rate,
+                                size_t input_num_channels,
+                                size_t buffer_rate,
+                                size_t buffer_num_channels,
+                                size_t output_rate,
+                                size_t output_num_channels) const {
+  return input_num_frames_ == static_cast<size_t>(input_rate / 100) &&
+         input_num_channels_ == input_num_channels &&
+         buffer_num_frames_ == static_cast<size_t>(buffer_rate / 100) &&
+         buffer_num_channels_ == buffer_num_channels &&
+         output_num_frames_ == static_cast<size_t>(output_rate / 100);
+}
+
 void AudioBuffer::set_downmixing_to_specific_channel(size_t channel) {
   downmix_by_averaging_ = false;
   RTC_DCHECK_GT(input_num_channels_, channel);
@@ -266,6 +325,9 @@ void AudioBuffer::CopyFrom(const AudioFrame* frame) {
                                        data_->channels()[i],
                                        buffer_num_frames_);
       }
+    } else if (num_channels_ == 2) {
+      DeinterleaveStereoToFloat(interleaved, input_num_frames_,
+                                data_->channels()[0], data_->channels()[1]);
     } else {
       for (size_t i = 0; i < num_channels_; ++i) {
         deinterleave_channel(i, num_channels_, input_num_frames_, interleaved,
@@ -282,6 +344,10 @@ void AudioBuffer::CopyTo(AudioFrame* frame) const {
   const bool resampling_required = buffer_num_frames_ != output_num_frames_;
 
   int16_t* interleaved = frame->mutable_data();
+  // The absolute peak of the written samples is tracked while interleaving so
+  // that level metering downstream can reuse it instead of scanning the frame
+  // again.
+  int32_t max_abs = 0;
   if (num_channels_ == 1) {
     std::array<float, kMaxSamplesPerChannel> float_buffer;
 
@@ -294,23 +360,28 @@ void AudioBuffer::CopyTo(AudioFrame* frame) const {
 
     if (frame->num_channels_ == 1) {
       for (size_t j = 0; j < output_num_frames_; ++j) {
-        interleaved[j] = FloatS16ToS16(deinterleaved[j]);
+        const int16_t sample = FloatS16ToS16(deinterleaved[j]);
+        interleaved[j] = sample;
+        max_abs = std::max(max_abs, std::abs(static_cast<int32_t>(sample)));
       }
     } else {
       for (size_t i = 0, k = 0; i < output_num_frames_; ++i) {
-        float tmp = FloatS16ToS16(deinterleaved[i]);
+        const int16_t sample = FloatS16ToS16(deinterleaved[i]);
+        max_abs = std::max(max_abs, std::abs(static_cast<int32_t>(sample)));
         for (size_t j = 0; j < frame->num_channels_; ++j, ++k) {
-          interleaved[k] = tmp;
+          interleaved[k] = sample;
         }
       }
     }
   } else {
-    auto interleave_channel = [](size_t channel, size_t num_channels,
-                                 size_t samples_per_channel, const float* x,
-                                 int16_t* y) {
+    auto interleave_channel = [&max_abs](size_t channel, size_t num_channels,
+                                         size_t samples_per_channel,
+                                         const float* x, int16_t* y) {
       for (size_t k = 0, j = channel; k < samples_per_channel;
            ++k, j += num_channels) {
-        y[j] = FloatS16ToS16(x[k]);
+        const int16_t sample = FloatS16ToS16(x[k]);
+        y[j] = sample;
+        max_abs = std::max(max_abs, std::abs(static_cast<int32_t>(sample)));
       }
     };
 
@@ -337,6 +408,8 @@ void AudioBuffer::CopyTo(AudioFrame* frame) const {
       }
     }
   }
+  frame->set_cached_abs_peak(
+      static_cast<int16_t>(std::min<int32_t>(max_abs, 32767)));
 }
 
 void AudioBuffer::SplitIntoFrequencyBands() {
@@ -52,6 +52,17 @@ class AudioBuffer {
   AudioBuffer(const AudioBuffer&) = delete;
   AudioBuffer& operator=(const AudioBuffer&) = delete;
 
+  // Returns true if the buffer was constructed for the specified
+  // configuration, in which case it can be reused instead of reallocated. The
+  // output channel count is not stored by the buffer and is therefore
+  // ignored.
+  bool MatchesConfig(size_t input_rate,
+                     size_t input_num_channels,
+                     size_t buffer_rate,
+                     size_t buffer_num_channels,
+                     size_t output_rate,
+                     size_t output_num_channels) const;
+
   // Specify that downmixing should be done by selecting a single channel.
   void set_downmixing_to_specific_channel(size_t channel);
 
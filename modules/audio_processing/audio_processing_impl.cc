@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -25,6 +26,7 @@
 #include "modules/audio_processing/agc/agc_manager_direct.h"
 #include "modules/audio_processing/agc2/gain_applier.h"
 #include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/channel_worker_pool.h"
 #include "modules/audio_processing/common.h"
 #include "modules/audio_processing/echo_cancellation_impl.h"
 #include "modules/audio_processing/echo_control_mobile_impl.h"
@@ -45,6 +47,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/perf_sample.h"
 #include "rtc_base/ref_counted_object.h"
 #include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
@@ -79,6 +82,41 @@ static bool LayoutHasKeyboard(AudioProcessing::ChannelLayout layout) {
   return false;
 }
 
+// Updates one AudioProcessingStats::SubmoduleTiming with the execution time
+// of the scope it guards. Passing nullptr makes the timer a no-op.
+class ScopedSubmoduleTimer {
+ public:
+  explicit ScopedSubmoduleTimer(AudioProcessingStats::SubmoduleTiming* timing)
+      : timing_(timing), start_ns_(timing ? rtc::TimeNanos() : 0) {}
+
+  ~ScopedSubmoduleTimer() {
+    if (!timing_) {
+      return;
+    }
+    // Weight of the most recent frame in the moving average; roughly a
+    // one-second horizon at 100 frames per second.
+    constexpr double kEwmaWeight = 0.01;
+    // A submodule that alone consumes the full frame interval has certainly
+    // made the capture path miss its deadline.
+    constexpr int64_t kFrameDeadlineNs = 10 * rtc::kNumNanosecsPerMillisec;
+    const int64_t duration_ns = rtc::TimeNanos() - start_ns_;
+    const double duration_us = duration_ns * 1e-3;
+    if (timing_->average_execution_time_us) {
+      timing_->average_execution_time_us =
+          (1. - kEwmaWeight) * *timing_->average_execution_time_us +
+          kEwmaWeight * duration_us;
+    } else {
+      timing_->average_execution_time_us = duration_us;
+    }
+    timing_->deadline_miss_count = timing_->deadline_miss_count.value_or(0) +
+                                   (duration_ns > kFrameDeadlineNs ? 1 : 0);
+  }
+
+ private:
+  AudioProcessingStats::SubmoduleTiming* const timing_;
+  const int64_t start_ns_;
+};
+
 bool SampleRateSupportsMultiBand(int sample_rate_hz) {
   return sample_rate_hz == AudioProcessing::kSampleRate32kHz ||
          sample_rate_hz == AudioProcessing::kSampleRate48kHz;
@@ -231,6 +269,13 @@ bool AudioProcessingImpl::ApmSubmoduleStates::CaptureFullBandProcessingActive()
          pre_amplifier_enabled_;
 }
 
+bool AudioProcessingImpl::ApmSubmoduleStates::CaptureProcessingActive() const {
+  return CaptureMultiBandSubModulesActive() ||
+         CaptureFullBandProcessingActive() || CaptureAnalyzerActive() ||
+         residual_echo_detector_enabled_ || level_estimator_enabled_ ||
+         transient_suppressor_enabled_;
+}
+
 bool AudioProcessingImpl::ApmSubmoduleStates::CaptureAnalyzerActive() const {
   return capture_analyzer_enabled_;
 }
@@ -499,13 +544,25 @@ int AudioProcessingImpl::InitializeLocked() {
           ? formats_.render_processing_format.sample_rate_hz()
           : formats_.api_format.reverse_output_stream().sample_rate_hz();
   if (formats_.api_format.reverse_input_stream().num_channels() > 0) {
-    render_.render_audio.reset(new AudioBuffer(
-        formats_.api_format.reverse_input_stream().sample_rate_hz(),
-        formats_.api_format.reverse_input_stream().num_channels(),
-        formats_.render_processing_format.sample_rate_hz(),
-        formats_.render_processing_format.num_channels(),
-        render_audiobuffer_sample_rate_hz,
-        formats_.render_processing_format.num_channels()));
+    // Only reallocate the buffers when the configuration has actually
+    // changed; APM instances are frequently reinitialized with an unchanged
+    // format.
+    if (!render_.render_audio ||
+        !render_.render_audio->MatchesConfig(
+            formats_.api_format.reverse_input_stream().sample_rate_hz(),
+            formats_.api_format.reverse_input_stream().num_channels(),
+            formats_.render_processing_format.sample_rate_hz(),
+            formats_.render_processing_format.num_channels(),
+            render_audiobuffer_sample_rate_hz,
+            formats_.render_processing_format.num_channels())) {
+      render_.render_audio.reset(new AudioBuffer(
+          formats_.api_format.reverse_input_stream().sample_rate_hz(),
+          formats_.api_format.reverse_input_stream().num_channels(),
+          formats_.render_processing_format.sample_rate_hz(),
+          formats_.render_processing_format.num_channels(),
+          render_audiobuffer_sample_rate_hz,
+          formats_.render_processing_format.num_channels()));
+    }
     if (formats_.api_format.reverse_input_stream() !=
         formats_.api_format.reverse_output_stream()) {
       render_.render_converter = AudioConverter::Create(
@@ -521,13 +578,22 @@ int AudioProcessingImpl::InitializeLocked() {
     render_.render_converter.reset(nullptr);
   }
 
-  capture_.capture_audio.reset(new AudioBuffer(
-      formats_.api_format.input_stream().sample_rate_hz(),
-      formats_.api_format.input_stream().num_channels(),
-      capture_nonlocked_.capture_processing_format.sample_rate_hz(),
-      formats_.api_format.output_stream().num_channels(),
-      formats_.api_format.output_stream().sample_rate_hz(),
-      formats_.api_format.output_stream().num_channels()));
+  if (!capture_.capture_audio ||
+      !capture_.capture_audio->MatchesConfig(
+          formats_.api_format.input_stream().sample_rate_hz(),
+          formats_.api_format.input_stream().num_channels(),
+          capture_nonlocked_.capture_processing_format.sample_rate_hz(),
+          formats_.api_format.output_stream().num_channels(),
+          formats_.api_format.output_stream().sample_rate_hz(),
+          formats_.api_format.output_stream().num_channels())) {
+    capture_.capture_audio.reset(new AudioBuffer(
+        formats_.api_format.input_stream().sample_rate_hz(),
+        formats_.api_format.input_stream().num_channels(),
+        capture_nonlocked_.capture_processing_format.sample_rate_hz(),
+        formats_.api_format.output_stream().num_channels(),
+        formats_.api_format.output_stream().sample_rate_hz(),
+        formats_.api_format.output_stream().num_channels()));
+  }
 
   AllocateRenderQueue();
 
@@ -653,6 +719,17 @@ int AudioProcessingImpl::InitializeLocked(const ProcessingConfig& config) {
         capture_nonlocked_.capture_processing_format.sample_rate_hz();
   }
 
+  // Detect whether the capture path is a pure pass-through: when the input,
+  // processing and output formats agree and no capture submodule has any work
+  // to do, ProcessStream() forwards the samples directly instead of funneling
+  // them through the capture AudioBuffer.
+  capture_.passthrough_pipeline_active =
+      !submodule_states_.CaptureProcessingActive() &&
+      formats_.api_format.input_stream() ==
+          formats_.api_format.output_stream() &&
+      formats_.api_format.input_stream().sample_rate_hz() ==
+          capture_nonlocked_.capture_processing_format.sample_rate_hz();
+
   return InitializeLocked();
 }
 
@@ -684,12 +761,29 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
       config_.gain_controller1.analog_level_maximum !=
           config.gain_controller1.analog_level_maximum;
 
+  const bool pipeline_config_changed =
+      config_.pipeline.capture_worker_threads !=
+      config.pipeline.capture_worker_threads;
+
   config_ = config;
 
+  if (!config_.submodule_timings.enabled) {
+    // Drop any previously collected timings so that stale values are not
+    // reported after collection has been turned off.
+    capture_.stats.echo_controller_timing = {};
+    capture_.stats.noise_suppressor_timing = {};
+    capture_.stats.gain_controller2_timing = {};
+    capture_.stats.transient_suppressor_timing = {};
+  }
+
   if (aec_config_changed) {
     InitializeEchoController();
   }
 
+  if (pipeline_config_changed) {
+    InitializeCaptureWorkerPool();
+  }
+
   public_submodules_->noise_suppression->Enable(
       config.noise_suppression.enabled);
   public_submodules_->noise_suppression->set_level(
@@ -908,6 +1002,7 @@ int AudioProcessingImpl::ProcessStream(const float* const* src,
                                        const StreamConfig& output_config,
                                        float* const* dest) {
   TRACE_EVENT0("webrtc", "AudioProcessing::ProcessStream_StreamConfig");
+  RTC_SCOPED_PERF_SAMPLE("AudioProcessingImpl::ProcessStream");
   ProcessingConfig processing_config;
   bool reinitialization_required = false;
   {
@@ -950,6 +1045,25 @@ int AudioProcessingImpl::ProcessStream(const float* const* src,
     RecordUnprocessedCaptureStream(src);
   }
 
+  if (capture_.passthrough_pipeline_active) {
+    // Streamlined pipeline: forward the samples as-is, but keep draining the
+    // runtime setting queue so that settings applied while in pass-through
+    // mode are not lost.
+    HandleCaptureRuntimeSettings();
+    const StreamConfig& stream_config = formats_.api_format.input_stream();
+    for (size_t ch = 0; ch < stream_config.num_channels(); ++ch) {
+      if (dest[ch] != src[ch]) {
+        memcpy(dest[ch], src[ch], stream_config.num_frames() * sizeof(float));
+      }
+    }
+    capture_.stats.voice_detected = absl::nullopt;
+    capture_.stats.output_rms_dbfs = absl::nullopt;
+    if (aec_dump_) {
+      RecordProcessedCaptureStream(dest);
+    }
+    return kNoError;
+  }
+
   capture_.keyboard_info.Extract(src, formats_.api_format.input_stream());
   capture_.capture_audio->CopyFrom(src, formats_.api_format.input_stream());
   RETURN_ON_ERR(ProcessCaptureStreamLocked());
@@ -1180,6 +1294,7 @@ void AudioProcessingImpl::EmptyQueuedRenderAudio() {
 
 int AudioProcessingImpl::ProcessStream(AudioFrame* frame) {
   TRACE_EVENT0("webrtc", "AudioProcessing::ProcessStream_AudioFrame");
+  RTC_SCOPED_PERF_SAMPLE("AudioProcessingImpl::ProcessStream");
   {
     // Acquire the capture lock in order to safely call the function
     // that retrieves the render side data. This function accesses APM
@@ -1245,6 +1360,18 @@ int AudioProcessingImpl::ProcessStream(AudioFrame* frame) {
     RecordUnprocessedCaptureStream(*frame);
   }
 
+  if (capture_.passthrough_pipeline_active) {
+    // Streamlined pipeline: the frame is forwarded unmodified, but the
+    // runtime setting queue is still drained.
+    HandleCaptureRuntimeSettings();
+    capture_.stats.voice_detected = absl::nullopt;
+    capture_.stats.output_rms_dbfs = absl::nullopt;
+    if (aec_dump_) {
+      RecordProcessedCaptureStream(*frame);
+    }
+    return kNoError;
+  }
+
   capture_.vad_activity = frame->vad_activity_;
   capture_.capture_audio->CopyFrom(frame);
   RETURN_ON_ERR(ProcessCaptureStreamLocked());
@@ -1274,6 +1401,12 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
 
   AudioBuffer* capture_buffer = capture_.capture_audio.get();  // For brevity.
 
+  // Returns |timing| when submodule timing collection is enabled and nullptr
+  // (which deactivates the corresponding timer) otherwise.
+  auto timing_stats = [this](AudioProcessingStats::SubmoduleTiming* timing) {
+    return config_.submodule_timings.enabled ? timing : nullptr;
+  };
+
   if (private_submodules_->pre_amplifier) {
     private_submodules_->pre_amplifier->ApplyGain(AudioFrameView<float>(
         capture_buffer->channels(), capture_buffer->num_channels(),
@@ -1368,10 +1501,20 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
           capture_buffer);
     }
 
-    public_submodules_->noise_suppression->ProcessCaptureAudio(capture_buffer);
+    {
+      ScopedSubmoduleTimer timer(
+          timing_stats(&capture_.stats.noise_suppressor_timing));
+      public_submodules_->noise_suppression->ProcessCaptureAudio(
+          capture_buffer);
+    }
 
-    RETURN_ON_ERR(private_submodules_->echo_control_mobile->ProcessCaptureAudio(
-        capture_buffer, stream_delay_ms()));
+    {
+      ScopedSubmoduleTimer timer(
+          timing_stats(&capture_.stats.echo_controller_timing));
+      RETURN_ON_ERR(
+          private_submodules_->echo_control_mobile->ProcessCaptureAudio(
+              capture_buffer, stream_delay_ms()));
+    }
   } else {
     if (private_submodules_->echo_controller) {
       data_dumper_->DumpRaw("stream_delay", stream_delay_ms());
@@ -1381,6 +1524,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
             stream_delay_ms());
       }
 
+      ScopedSubmoduleTimer timer(
+          timing_stats(&capture_.stats.echo_controller_timing));
       private_submodules_->echo_controller->ProcessCapture(
           capture_buffer, capture_.echo_path_gain_change);
     } else if (private_submodules_->echo_cancellation) {
@@ -1390,11 +1535,18 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
         return AudioProcessing::kStreamParameterNotSetError;
       }
 
+      ScopedSubmoduleTimer timer(
+          timing_stats(&capture_.stats.echo_controller_timing));
       RETURN_ON_ERR(private_submodules_->echo_cancellation->ProcessCaptureAudio(
           capture_buffer, stream_delay_ms()));
     }
 
-    public_submodules_->noise_suppression->ProcessCaptureAudio(capture_buffer);
+    {
+      ScopedSubmoduleTimer timer(
+          timing_stats(&capture_.stats.noise_suppressor_timing));
+      public_submodules_->noise_suppression->ProcessCaptureAudio(
+          capture_buffer);
+    }
   }
 
   if (public_submodules_->voice_detection->is_enabled() &&
@@ -1448,6 +1600,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
             ? private_submodules_->agc_manager->voice_probability()
             : 1.f;
 
+    ScopedSubmoduleTimer timer(
+        timing_stats(&capture_.stats.transient_suppressor_timing));
     public_submodules_->transient_suppressor->Suppress(
         capture_buffer->channels()[0], capture_buffer->num_frames(),
         capture_buffer->num_channels(),
@@ -1464,6 +1618,8 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   }
 
   if (config_.gain_controller2.enabled) {
+    ScopedSubmoduleTimer timer(
+        timing_stats(&capture_.stats.gain_controller2_timing));
     private_submodules_->gain_controller2->NotifyAnalogLevel(
         agc1()->stream_analog_level());
     private_submodules_->gain_controller2->Process(capture_buffer);
@@ -1953,6 +2109,21 @@ void AudioProcessingImpl::InitializePreAmplifier() {
   }
 }
 
+void AudioProcessingImpl::InitializeCaptureWorkerPool() {
+  if (config_.pipeline.capture_worker_threads > 1) {
+    // The thread calling ProcessStream() takes part in the work, so one
+    // dedicated worker less is needed.
+    capture_worker_pool_.reset(
+        new ChannelWorkerPool(config_.pipeline.capture_worker_threads - 1));
+  } else {
+    capture_worker_pool_.reset();
+  }
+  public_submodules_->noise_suppression->SetCaptureWorkerPool(
+      capture_worker_pool_.get());
+  public_submodules_->gain_control->SetCaptureWorkerPool(
+      capture_worker_pool_.get());
+}
+
 void AudioProcessingImpl::InitializeResidualEchoDetector() {
   RTC_DCHECK(private_submodules_->echo_detector);
   private_submodules_->echo_detector->Initialize(
@@ -32,6 +32,7 @@ namespace webrtc {
 
 class ApmDataDumper;
 class AudioConverter;
+class ChannelWorkerPool;
 
 class AudioProcessingImpl : public AudioProcessing {
  public:
@@ -189,6 +190,7 @@ class AudioProcessingImpl : public AudioProcessing {
     bool CaptureMultiBandSubModulesActive() const;
     bool CaptureMultiBandProcessingActive() const;
     bool CaptureFullBandProcessingActive() const;
+    bool CaptureProcessingActive() const;
     bool CaptureAnalyzerActive() const;
     bool RenderMultiBandSubModulesActive() const;
     bool RenderFullBandProcessingActive() const;
@@ -244,6 +246,8 @@ class AudioProcessingImpl : public AudioProcessing {
   void InitializeGainController2() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
   void InitializePreAmplifier() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
   void InitializePostProcessor() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  void InitializeCaptureWorkerPool()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
   void InitializeAnalyzer() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
   void InitializePreProcessor() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_render_);
 
@@ -330,6 +334,11 @@ class AudioProcessingImpl : public AudioProcessing {
   std::unique_ptr<ApmPublicSubmodules> public_submodules_;
   std::unique_ptr<ApmPrivateSubmodules> private_submodules_;
 
+  // Worker threads over which independent per-channel capture work is
+  // distributed; null when the capture pipeline is single-threaded.
+  std::unique_ptr<ChannelWorkerPool> capture_worker_pool_
+      RTC_GUARDED_BY(crit_capture_);
+
   // State that is written to while holding both the render and capture locks
   // but can be read without any lock being held.
   // As this is only accessed internally of APM, and all internal methods in APM
@@ -400,6 +409,11 @@ class AudioProcessingImpl : public AudioProcessing {
       const float* keyboard_data = nullptr;
     } keyboard_info;
     AudioFrame::VADActivity vad_activity = AudioFrame::kVadUnknown;
+    // When true, the capture path is a pure pass-through: the input,
+    // processing and output formats agree and no capture submodule has any
+    // work to do, so ProcessStream() forwards the samples without involving
+    // the capture AudioBuffer. Detected on (re)initialization.
+    bool passthrough_pipeline_active = false;
   } capture_ RTC_GUARDED_BY(crit_capture_);
 
   struct ApmCaptureNonLockedState {
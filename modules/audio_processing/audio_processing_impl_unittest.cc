@@ -180,6 +180,29 @@ TEST(AudioProcessingImplTest, AudioParameterChangeTriggersInit) {
   EXPECT_NOERR(mock.ProcessReverseStream(&frame));
 }
 
+TEST(AudioProcessingImplTest, PassthroughPipelineForwardsAudioUnchanged) {
+  // With all submodules disabled and matching formats the capture path takes
+  // the streamlined pass-through pipeline; the audio must be forwarded
+  // unchanged.
+  std::unique_ptr<AudioProcessing> apm(AudioProcessingBuilder().Create());
+  apm->ApplyConfig(webrtc::AudioProcessing::Config());
+
+  AudioFrame frame;
+  constexpr int16_t kAudioLevel = 10000;
+  constexpr size_t kSampleRateHz = 48000;
+  constexpr size_t kNumChannels = 2;
+  InitializeAudioFrame(kSampleRateHz, kNumChannels, &frame);
+
+  for (int i = 0; i < 10; ++i) {
+    FillFixedFrame(kAudioLevel, &frame);
+    apm->ProcessStream(&frame);
+    for (size_t k = 0; k < frame.samples_per_channel_ * frame.num_channels_;
+         ++k) {
+      ASSERT_EQ(frame.data()[k], kAudioLevel);
+    }
+  }
+}
+
 TEST(AudioProcessingImplTest, UpdateCapturePreGainRuntimeSetting) {
   std::unique_ptr<AudioProcessing> apm(AudioProcessingBuilder().Create());
   webrtc::AudioProcessing::Config apm_config;
@@ -2751,6 +2751,53 @@ TEST(ApmStatistics, ReportHasVoice) {
   EXPECT_FALSE(apm->GetStatistics(false).voice_detected);
 }
 
+TEST(ApmStatistics, ReportSubmoduleTimings) {
+  ProcessingConfig processing_config = {
+      {{32000, 1}, {32000, 1}, {32000, 1}, {32000, 1}}};
+  AudioProcessing::Config config;
+  config.noise_suppression.enabled = true;
+
+  // Set up an audioframe.
+  AudioFrame frame;
+  frame.num_channels_ = 1;
+  SetFrameSampleRate(&frame, AudioProcessing::NativeRate::kSampleRate32kHz);
+
+  // Fill the audio frame with a sawtooth pattern.
+  int16_t* ptr = frame.mutable_data();
+  for (size_t i = 0; i < frame.kMaxDataSizeSamples; i++) {
+    ptr[i] = 10000 * ((i % 3) - 1);
+  }
+
+  std::unique_ptr<AudioProcessing> apm(AudioProcessingBuilder().Create());
+  apm->Initialize(processing_config);
+  apm->ApplyConfig(config);
+
+  // If not enabled, no timings should be reported.
+  EXPECT_EQ(apm->ProcessStream(&frame), 0);
+  auto stats = apm->GetStatistics(false);
+  EXPECT_FALSE(stats.noise_suppressor_timing.average_execution_time_us);
+  EXPECT_FALSE(stats.noise_suppressor_timing.deadline_miss_count);
+
+  // If enabled, timings should be reported for the active submodules.
+  config.submodule_timings.enabled = true;
+  apm->ApplyConfig(config);
+  EXPECT_EQ(apm->ProcessStream(&frame), 0);
+  stats = apm->GetStatistics(false);
+  EXPECT_TRUE(stats.noise_suppressor_timing.average_execution_time_us);
+  EXPECT_GE(*stats.noise_suppressor_timing.average_execution_time_us, 0.);
+  EXPECT_TRUE(stats.noise_suppressor_timing.deadline_miss_count);
+  // Inactive submodules are not reported.
+  EXPECT_FALSE(stats.gain_controller2_timing.average_execution_time_us);
+
+  // If re-disabled, the values are again not reported.
+  config.submodule_timings.enabled = false;
+  apm->ApplyConfig(config);
+  EXPECT_EQ(apm->ProcessStream(&frame), 0);
+  stats = apm->GetStatistics(false);
+  EXPECT_FALSE(stats.noise_suppressor_timing.average_execution_time_us);
+  EXPECT_FALSE(stats.noise_suppressor_timing.deadline_miss_count);
+}
+
 TEST(ApmConfiguration, HandlingOfRateAndChannelCombinations) {
   std::array<int, 3> sample_rates_hz = {16000, 32000, 48000};
   std::array<int, 2> render_channel_counts = {1, 7};
@@ -0,0 +1,105 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/channel_worker_pool.h"
+
+#include "absl/memory/memory.h"
+#include "rtc_base/atomic_ops.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/platform_thread.h"
+
+namespace webrtc {
+
+class ChannelWorkerPool::Worker {
+ public:
+  explicit Worker(ChannelWorkerPool* pool)
+      : pool_(pool),
+        thread_(&Worker::ThreadRun, this, "ApmChannelWorker", rtc::kHighPriority) {
+    thread_.Start();
+  }
+
+  ~Worker() {
+    // The pool has set |exiting_| before destroying the workers; waking the
+    // thread makes it observe the flag and return.
+    wake_.Set();
+    thread_.Stop();
+  }
+
+  void Wake() { wake_.Set(); }
+
+ private:
+  static void ThreadRun(void* obj) { static_cast<Worker*>(obj)->Loop(); }
+
+  void Loop() {
+    while (true) {
+      wake_.Wait(rtc::Event::kForever);
+      if (rtc::AtomicOps::AcquireLoad(&pool_->exiting_) != 0) {
+        return;
+      }
+      pool_->RunPendingTasks();
+      pool_->OnWorkerDone();
+    }
+  }
+
+  ChannelWorkerPool* const pool_;
+  rtc::Event wake_;
+  rtc::PlatformThread thread_;
+};
+
+ChannelWorkerPool::ChannelWorkerPool(size_t num_workers) {
+  RTC_DCHECK_GT(num_workers, 0);
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers_.push_back(absl::make_unique<Worker>(this));
+  }
+}
+
+ChannelWorkerPool::~ChannelWorkerPool() {
+  rtc::AtomicOps::ReleaseStore(&exiting_, 1);
+  workers_.clear();
+}
+
+void ChannelWorkerPool::Execute(rtc::FunctionView<void(size_t)> work,
+                                size_t num_tasks) {
+  if (num_tasks == 0) {
+    return;
+  }
+  work_ = work;
+  num_tasks_ = static_cast<int>(num_tasks);
+  rtc::AtomicOps::ReleaseStore(&next_task_, 0);
+  rtc::AtomicOps::ReleaseStore(&pending_workers_,
+                               static_cast<int>(workers_.size()));
+  for (auto& worker : workers_) {
+    worker->Wake();
+  }
+  // The calling thread takes part in the work and then waits for the workers
+  // to run out of tasks; with short per-channel tasks the wait is typically
+  // already signaled by the time it is reached.
+  RunPendingTasks();
+  done_.Wait(rtc::Event::kForever);
+}
+
+void ChannelWorkerPool::RunPendingTasks() {
+  while (true) {
+    const int task = rtc::AtomicOps::Increment(&next_task_) - 1;
+    if (task >= num_tasks_) {
+      return;
+    }
+    work_(static_cast<size_t>(task));
+  }
+}
+
+void ChannelWorkerPool::OnWorkerDone() {
+  if (rtc::AtomicOps::Decrement(&pending_workers_) == 0) {
+    done_.Set();
+  }
+}
+
+}  // namespace webrtc
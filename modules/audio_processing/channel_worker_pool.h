@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_CHANNEL_WORKER_POOL_H_
+#define MODULES_AUDIO_PROCESSING_CHANNEL_WORKER_POOL_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/function_view.h"
+#include "rtc_base/event.h"
+
+namespace webrtc {
+
+// Pool of worker threads over which independent per-channel work in the
+// capture pipeline is distributed. The workers stay alive across calls so
+// that no threads are spawned on the real-time audio path; between calls
+// they block on an event and consume no CPU.
+class ChannelWorkerPool {
+ public:
+  // Creates a pool with |num_workers| dedicated threads. The thread that
+  // calls Execute() takes part in the work as well, so a pool with N workers
+  // processes N + 1 channels concurrently.
+  explicit ChannelWorkerPool(size_t num_workers);
+  ~ChannelWorkerPool();
+
+  // Runs |work| once for every index in [0, num_tasks), distributing the
+  // calls over the worker threads and the calling thread, and blocks until
+  // all calls have returned. |work| must be safe to call concurrently for
+  // distinct indexes. Must not be called concurrently or re-entrantly.
+  void Execute(rtc::FunctionView<void(size_t)> work, size_t num_tasks);
+
+ private:
+  class Worker;
+
+  // Runs tasks until the shared task counter is exhausted.
+  void RunPendingTasks();
+  // Called by each worker when it runs out of tasks; signals |done_| once all
+  // workers have checked in.
+  void OnWorkerDone();
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  rtc::Event done_;
+
+  // State for the call to Execute() in progress. |work_| and |num_tasks_| are
+  // published to the workers via the wake-up events.
+  rtc::FunctionView<void(size_t)> work_;
+  int num_tasks_ = 0;
+  volatile int next_task_ = 0;
+  volatile int pending_workers_ = 0;
+  volatile int exiting_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_CHANNEL_WORKER_POOL_H_
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/channel_worker_pool.h"
+
+#include <vector>
+
+#include "rtc_base/atomic_ops.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+// Checks that every task index is run exactly once, for task counts both
+// below and above the number of threads.
+TEST(ChannelWorkerPool, RunsEveryTaskExactlyOnce) {
+  ChannelWorkerPool pool(3);
+  for (size_t num_tasks : {1u, 2u, 4u, 8u, 17u}) {
+    std::vector<int> counts(num_tasks, 0);
+    pool.Execute(
+        [&](size_t i) {
+          rtc::AtomicOps::Increment(&counts[i]);
+        },
+        num_tasks);
+    for (size_t i = 0; i < num_tasks; ++i) {
+      EXPECT_EQ(1, counts[i]);
+    }
+  }
+}
+
+// Checks that a pool can be reused for many consecutive calls, as done once
+// per frame on the capture path.
+TEST(ChannelWorkerPool, ReusableAcrossCalls) {
+  ChannelWorkerPool pool(2);
+  constexpr size_t kNumChannels = 8;
+  constexpr int kNumFrames = 100;
+  std::vector<int> counts(kNumChannels, 0);
+  for (int frame = 0; frame < kNumFrames; ++frame) {
+    pool.Execute(
+        [&](size_t i) {
+          rtc::AtomicOps::Increment(&counts[i]);
+        },
+        kNumChannels);
+  }
+  for (size_t i = 0; i < kNumChannels; ++i) {
+    EXPECT_EQ(kNumFrames, counts[i]);
+  }
+}
+
+// Checks that executing with zero tasks returns without blocking.
+TEST(ChannelWorkerPool, HandlesZeroTasks) {
+  ChannelWorkerPool pool(2);
+  bool called = false;
+  pool.Execute([&](size_t) { called = true; }, 0);
+  EXPECT_FALSE(called);
+}
+
+}  // namespace webrtc
@@ -15,6 +15,7 @@
 #include "absl/types/optional.h"
 #include "modules/audio_processing/agc/legacy/gain_control.h"
 #include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/channel_worker_pool.h"
 #include "modules/audio_processing/include/audio_processing.h"
 #include "modules/audio_processing/logging/apm_data_dumper.h"
 #include "rtc_base/checks.h"
@@ -78,11 +79,22 @@ class GainControlImpl::GainController {
     return *capture_level_;
   }
 
+  // Per-channel results of the last capture-side call; stored here so that
+  // the channels can be processed concurrently and the results reduced
+  // afterwards.
+  void set_last_error(int error) { last_error_ = error; }
+  int last_error() const { return last_error_; }
+
+  void set_saturation_warning(bool warning) { saturation_warning_ = warning; }
+  bool saturation_warning() const { return saturation_warning_; }
+
  private:
   Handle* state_;
   // TODO(peah): Remove the optional once the initialization is moved into the
   // ctor.
   absl::optional<int> capture_level_;
+  int last_error_ = AudioProcessing::kNoError;
+  bool saturation_warning_ = false;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(GainController);
 };
@@ -143,16 +155,13 @@ void GainControlImpl::PackRenderAudioBuffer(
                         (mixed_low_pass.data() + audio->num_frames_per_band()));
 }
 
-int GainControlImpl::AnalyzeCaptureAudio(AudioBuffer* audio) {
-  if (!enabled_) {
-    return AudioProcessing::kNoError;
-  }
+void GainControlImpl::SetCaptureWorkerPool(ChannelWorkerPool* pool) {
+  worker_pool_ = pool;
+}
 
-  RTC_DCHECK(num_proc_channels_);
-  RTC_DCHECK_GE(AudioBuffer::kMaxSplitFrameLength,
-                audio->num_frames_per_band());
-  RTC_DCHECK_EQ(audio->num_channels(), *num_proc_channels_);
-  RTC_DCHECK_LE(*num_proc_channels_, gain_controllers_.size());
+void GainControlImpl::AnalyzeChannel(AudioBuffer* audio,
+                                     size_t capture_channel) {
+  GainController* gain_controller = gain_controllers_[capture_channel].get();
 
   int16_t split_band_data[AudioBuffer::kMaxNumBands]
                          [AudioBuffer::kMaxSplitFrameLength];
@@ -160,49 +169,96 @@ int GainControlImpl::AnalyzeCaptureAudio(AudioBuffer* audio) {
       split_band_data[0], split_band_data[1], split_band_data[2]};
 
   if (mode_ == kAdaptiveAnalog) {
-    int capture_channel = 0;
-    for (auto& gain_controller : gain_controllers_) {
-      gain_controller->set_capture_level(analog_capture_level_);
+    gain_controller->set_capture_level(analog_capture_level_);
 
-      audio->ExportSplitChannelData(capture_channel, split_bands);
+    audio->ExportSplitChannelData(capture_channel, split_bands);
 
-      int err =
-          WebRtcAgc_AddMic(gain_controller->state(), split_bands,
-                           audio->num_bands(), audio->num_frames_per_band());
+    int err = WebRtcAgc_AddMic(gain_controller->state(), split_bands,
+                               audio->num_bands(),
+                               audio->num_frames_per_band());
 
-      audio->ImportSplitChannelData(capture_channel, split_bands);
+    audio->ImportSplitChannelData(capture_channel, split_bands);
 
-      if (err != AudioProcessing::kNoError) {
-        return AudioProcessing::kUnspecifiedError;
-      }
-      ++capture_channel;
-    }
+    gain_controller->set_last_error(err);
   } else if (mode_ == kAdaptiveDigital) {
-    int capture_channel = 0;
-    for (auto& gain_controller : gain_controllers_) {
-      int32_t capture_level_out = 0;
+    int32_t capture_level_out = 0;
 
-      audio->ExportSplitChannelData(capture_channel, split_bands);
+    audio->ExportSplitChannelData(capture_channel, split_bands);
 
-      int err =
-          WebRtcAgc_VirtualMic(gain_controller->state(), split_bands,
-                               audio->num_bands(), audio->num_frames_per_band(),
-                               analog_capture_level_, &capture_level_out);
+    int err =
+        WebRtcAgc_VirtualMic(gain_controller->state(), split_bands,
+                             audio->num_bands(), audio->num_frames_per_band(),
+                             analog_capture_level_, &capture_level_out);
 
-      audio->ImportSplitChannelData(capture_channel, split_bands);
+    audio->ImportSplitChannelData(capture_channel, split_bands);
 
-      gain_controller->set_capture_level(capture_level_out);
+    gain_controller->set_capture_level(capture_level_out);
+    gain_controller->set_last_error(err);
+  }
+}
 
-      if (err != AudioProcessing::kNoError) {
-        return AudioProcessing::kUnspecifiedError;
-      }
-      ++capture_channel;
+int GainControlImpl::AnalyzeCaptureAudio(AudioBuffer* audio) {
+  if (!enabled_) {
+    return AudioProcessing::kNoError;
+  }
+
+  RTC_DCHECK(num_proc_channels_);
+  RTC_DCHECK_GE(AudioBuffer::kMaxSplitFrameLength,
+                audio->num_frames_per_band());
+  RTC_DCHECK_EQ(audio->num_channels(), *num_proc_channels_);
+  RTC_DCHECK_LE(*num_proc_channels_, gain_controllers_.size());
+
+  if (mode_ != kAdaptiveAnalog && mode_ != kAdaptiveDigital) {
+    return AudioProcessing::kNoError;
+  }
+
+  if (worker_pool_ && gain_controllers_.size() > 1) {
+    worker_pool_->Execute(
+        [this, audio](size_t i) { AnalyzeChannel(audio, i); },
+        gain_controllers_.size());
+  } else {
+    for (size_t i = 0; i < gain_controllers_.size(); ++i) {
+      AnalyzeChannel(audio, i);
+    }
+  }
+
+  for (auto& gain_controller : gain_controllers_) {
+    if (gain_controller->last_error() != AudioProcessing::kNoError) {
+      return AudioProcessing::kUnspecifiedError;
     }
   }
 
   return AudioProcessing::kNoError;
 }
 
+void GainControlImpl::ProcessChannel(AudioBuffer* audio,
+                                     bool stream_has_echo,
+                                     size_t capture_channel) {
+  GainController* gain_controller = gain_controllers_[capture_channel].get();
+  int32_t capture_level_out = 0;
+  uint8_t saturation_warning = 0;
+
+  int16_t split_band_data[AudioBuffer::kMaxNumBands]
+                         [AudioBuffer::kMaxSplitFrameLength];
+  int16_t* split_bands[AudioBuffer::kMaxNumBands] = {
+      split_band_data[0], split_band_data[1], split_band_data[2]};
+  audio->ExportSplitChannelData(capture_channel, split_bands);
+
+  // The call to stream_has_echo() is ok from a deadlock perspective
+  // as the capture lock is allready held.
+  int err = WebRtcAgc_Process(
+      gain_controller->state(), split_bands, audio->num_bands(),
+      audio->num_frames_per_band(), split_bands,
+      gain_controller->get_capture_level(), &capture_level_out, stream_has_echo,
+      &saturation_warning);
+
+  audio->ImportSplitChannelData(capture_channel, split_bands);
+
+  gain_controller->set_capture_level(capture_level_out);
+  gain_controller->set_last_error(err);
+  gain_controller->set_saturation_warning(saturation_warning == 1);
+}
+
 int GainControlImpl::ProcessCaptureAudio(AudioBuffer* audio,
                                          bool stream_has_echo) {
   if (!enabled_) {
@@ -219,37 +275,25 @@ int GainControlImpl::ProcessCaptureAudio(AudioBuffer* audio,
   RTC_DCHECK_EQ(audio->num_channels(), *num_proc_channels_);
 
   stream_is_saturated_ = false;
-  int capture_channel = 0;
-  for (auto& gain_controller : gain_controllers_) {
-    int32_t capture_level_out = 0;
-    uint8_t saturation_warning = 0;
-
-    int16_t split_band_data[AudioBuffer::kMaxNumBands]
-                           [AudioBuffer::kMaxSplitFrameLength];
-    int16_t* split_bands[AudioBuffer::kMaxNumBands] = {
-        split_band_data[0], split_band_data[1], split_band_data[2]};
-    audio->ExportSplitChannelData(capture_channel, split_bands);
-
-    // The call to stream_has_echo() is ok from a deadlock perspective
-    // as the capture lock is allready held.
-    int err = WebRtcAgc_Process(
-        gain_controller->state(), split_bands, audio->num_bands(),
-        audio->num_frames_per_band(), split_bands,
-        gain_controller->get_capture_level(), &capture_level_out,
-        stream_has_echo, &saturation_warning);
-
-    audio->ImportSplitChannelData(capture_channel, split_bands);
+  if (worker_pool_ && gain_controllers_.size() > 1) {
+    worker_pool_->Execute(
+        [this, audio, stream_has_echo](size_t i) {
+          ProcessChannel(audio, stream_has_echo, i);
+        },
+        gain_controllers_.size());
+  } else {
+    for (size_t i = 0; i < gain_controllers_.size(); ++i) {
+      ProcessChannel(audio, stream_has_echo, i);
+    }
+  }
 
-    if (err != AudioProcessing::kNoError) {
+  for (auto& gain_controller : gain_controllers_) {
+    if (gain_controller->last_error() != AudioProcessing::kNoError) {
       return AudioProcessing::kUnspecifiedError;
     }
-
-    gain_controller->set_capture_level(capture_level_out);
-    if (saturation_warning == 1) {
+    if (gain_controller->saturation_warning()) {
       stream_is_saturated_ = true;
     }
-
-    ++capture_channel;
   }
 
   RTC_DCHECK_LT(0ul, *num_proc_channels_);
@@ -26,6 +26,7 @@ namespace webrtc {
 
 class ApmDataDumper;
 class AudioBuffer;
+class ChannelWorkerPool;
 
 class GainControlImpl : public GainControl {
  public:
@@ -41,6 +42,10 @@ class GainControlImpl : public GainControl {
 
   void Initialize(size_t num_proc_channels, int sample_rate_hz);
 
+  // Sets the pool over which the per-channel work is distributed; a null
+  // |pool| restores single-threaded processing.
+  void SetCaptureWorkerPool(ChannelWorkerPool* pool);
+
   static void PackRenderAudioBuffer(AudioBuffer* audio,
                                     std::vector<int16_t>* packed_buffer);
 
@@ -70,6 +75,14 @@ class GainControlImpl : public GainControl {
 
   int Configure();
 
+  // Per-channel bodies of the capture-side loops. Invoked concurrently for
+  // distinct channels when a worker pool is set; the per-channel results are
+  // stored in the corresponding GainController and reduced by the caller.
+  void AnalyzeChannel(AudioBuffer* audio, size_t capture_channel);
+  void ProcessChannel(AudioBuffer* audio,
+                      bool stream_has_echo,
+                      size_t capture_channel);
+
   std::unique_ptr<ApmDataDumper> data_dumper_;
 
   bool enabled_ = false;
@@ -85,6 +98,7 @@ class GainControlImpl : public GainControl {
   bool stream_is_saturated_;
 
   std::vector<std::unique_ptr<GainController>> gain_controllers_;
+  ChannelWorkerPool* worker_pool_ = nullptr;
 
   absl::optional<size_t> num_proc_channels_;
   absl::optional<int> sample_rate_hz_;
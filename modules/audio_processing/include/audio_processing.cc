@@ -60,7 +60,9 @@ std::string AudioProcessing::Config::ToString() const {
   char buf[1024];
   rtc::SimpleStringBuilder builder(buf);
   builder << "AudioProcessing::Config{ "
-          << "pre_amplifier: { enabled: " << pre_amplifier.enabled
+          << "pipeline: { capture_worker_threads: "
+          << pipeline.capture_worker_threads
+          << " }, pre_amplifier: { enabled: " << pre_amplifier.enabled
           << ", fixed_gain_factor: " << pre_amplifier.fixed_gain_factor
           << " }, high_pass_filter: { enabled: " << high_pass_filter.enabled
           << " }, echo_canceller: { enabled: " << echo_canceller.enabled
@@ -93,6 +95,7 @@ std::string AudioProcessing::Config::ToString() const {
           << " } }, residual_echo_detector: { enabled: "
           << residual_echo_detector.enabled
           << " }, level_estimation: { enabled: " << level_estimation.enabled
+          << " }, submodule_timings: { enabled: " << submodule_timings.enabled
           << " } }";
   return builder.str();
 }
@@ -245,6 +245,16 @@ class AudioProcessing : public rtc::RefCountInterface {
   // submodule resets, affecting the audio quality. Use the RuntimeSetting
   // construct for runtime configuration.
   struct Config {
+    // Sets the properties of the audio processing pipeline.
+    struct Pipeline {
+      // Number of threads over which the independent per-channel work in the
+      // capture pipeline is distributed. Only multi-channel capture streams
+      // benefit from values larger than one; the extra threads sleep
+      // otherwise. The per-frame fan-out/join overhead makes this
+      // counter-productive for mono and stereo streams.
+      size_t capture_worker_threads = 1;
+    } pipeline;
+
     // Enabled the pre-amplifier. It amplifies the capture signal
     // before any other processing is done.
     struct PreAmplifier {
@@ -360,6 +370,14 @@ class AudioProcessing : public rtc::RefCountInterface {
       bool enabled = false;
     } level_estimation;
 
+    // Enables collection of per-submodule execution-time statistics on the
+    // capture path, reported through the timing fields in
+    // webrtc::AudioProcessingStats. The cost is two clock reads per timed
+    // submodule and frame.
+    struct SubmoduleTimings {
+      bool enabled = false;
+    } submodule_timings;
+
     // Explicit copy assignment implementation to avoid issues with memory
     // sanitizer complaints in case of self-assignment.
     // TODO(peah): Add buildflag to ensure that this is only included for memory
@@ -66,6 +66,21 @@ struct RTC_EXPORT AudioProcessingStats {
   // milliseconds and the value is the instantaneous value at the time of the
   // call to |GetStatistics()|.
   absl::optional<int32_t> delay_ms;
+
+  // Execution-time statistics for one capture-path submodule. The average is
+  // an exponentially weighted moving average of the per-frame execution time
+  // in microseconds. A deadline miss is a frame in which the submodule alone
+  // took longer than the 10 ms frame interval.
+  // Only reported if submodule timing collection is enabled in
+  // AudioProcessing::Config.
+  struct SubmoduleTiming {
+    absl::optional<double> average_execution_time_us;
+    absl::optional<int64_t> deadline_miss_count;
+  };
+  SubmoduleTiming echo_controller_timing;
+  SubmoduleTiming noise_suppressor_timing;
+  SubmoduleTiming gain_controller2_timing;
+  SubmoduleTiming transient_suppressor_timing;
 };
 
 }  // namespace webrtc
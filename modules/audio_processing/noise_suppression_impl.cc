@@ -11,6 +11,7 @@
 #include "modules/audio_processing/noise_suppression_impl.h"
 
 #include "modules/audio_processing/audio_buffer.h"
+#include "modules/audio_processing/channel_worker_pool.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/constructor_magic.h"
 #if defined(WEBRTC_NS_FLOAT)
@@ -70,6 +71,11 @@ void NoiseSuppressionImpl::Initialize(size_t channels, int sample_rate_hz) {
   set_level(level_);
 }
 
+void NoiseSuppressionImpl::SetCaptureWorkerPool(ChannelWorkerPool* pool) {
+  rtc::CritScope cs(crit_);
+  worker_pool_ = pool;
+}
+
 void NoiseSuppressionImpl::AnalyzeCaptureAudio(AudioBuffer* audio) {
   RTC_DCHECK(audio);
 #if defined(WEBRTC_NS_FLOAT)
@@ -80,13 +86,25 @@ void NoiseSuppressionImpl::AnalyzeCaptureAudio(AudioBuffer* audio) {
 
   RTC_DCHECK_GE(160, audio->num_frames_per_band());
   RTC_DCHECK_EQ(suppressors_.size(), audio->num_channels());
-  for (size_t i = 0; i < suppressors_.size(); i++) {
-    WebRtcNs_Analyze(suppressors_[i]->state(),
-                     audio->split_bands_const(i)[kBand0To8kHz]);
+  if (worker_pool_ && suppressors_.size() > 1) {
+    worker_pool_->Execute(
+        [this, audio](size_t i) { AnalyzeChannel(audio, i); },
+        suppressors_.size());
+  } else {
+    for (size_t i = 0; i < suppressors_.size(); i++) {
+      AnalyzeChannel(audio, i);
+    }
   }
 #endif
 }
 
+void NoiseSuppressionImpl::AnalyzeChannel(AudioBuffer* audio, size_t channel) {
+#if defined(WEBRTC_NS_FLOAT)
+  WebRtcNs_Analyze(suppressors_[channel]->state(),
+                   audio->split_bands_const(channel)[kBand0To8kHz]);
+#endif
+}
+
 void NoiseSuppressionImpl::ProcessCaptureAudio(AudioBuffer* audio) {
   RTC_DCHECK(audio);
   rtc::CritScope cs(crit_);
@@ -96,23 +114,34 @@ void NoiseSuppressionImpl::ProcessCaptureAudio(AudioBuffer* audio) {
 
   RTC_DCHECK_GE(160, audio->num_frames_per_band());
   RTC_DCHECK_EQ(suppressors_.size(), audio->num_channels());
-  for (size_t i = 0; i < suppressors_.size(); i++) {
+  if (worker_pool_ && suppressors_.size() > 1) {
+    worker_pool_->Execute(
+        [this, audio](size_t i) { ProcessChannel(audio, i); },
+        suppressors_.size());
+  } else {
+    for (size_t i = 0; i < suppressors_.size(); i++) {
+      ProcessChannel(audio, i);
+    }
+  }
+}
+
+void NoiseSuppressionImpl::ProcessChannel(AudioBuffer* audio, size_t channel) {
 #if defined(WEBRTC_NS_FLOAT)
-    WebRtcNs_Process(suppressors_[i]->state(), audio->split_bands_const(i),
-                     audio->num_bands(), audio->split_bands(i));
+  WebRtcNs_Process(suppressors_[channel]->state(),
+                   audio->split_bands_const(channel), audio->num_bands(),
+                   audio->split_bands(channel));
 #elif defined(WEBRTC_NS_FIXED)
-    int16_t split_band_data[AudioBuffer::kMaxNumBands]
-                           [AudioBuffer::kMaxSplitFrameLength];
-    int16_t* split_bands[AudioBuffer::kMaxNumBands] = {
-        split_band_data[0], split_band_data[1], split_band_data[2]};
-    audio->ExportSplitChannelData(i, split_bands);
+  int16_t split_band_data[AudioBuffer::kMaxNumBands]
+                         [AudioBuffer::kMaxSplitFrameLength];
+  int16_t* split_bands[AudioBuffer::kMaxNumBands] = {
+      split_band_data[0], split_band_data[1], split_band_data[2]};
+  audio->ExportSplitChannelData(channel, split_bands);
 
-    WebRtcNsx_Process(suppressors_[i]->state(), split_bands, audio->num_bands(),
-                      split_bands);
+  WebRtcNsx_Process(suppressors_[channel]->state(), split_bands,
+                    audio->num_bands(), split_bands);
 
-    audio->ImportSplitChannelData(i, split_bands);
+  audio->ImportSplitChannelData(channel, split_bands);
 #endif
-  }
 }
 
 int NoiseSuppressionImpl::Enable(bool enable) {
@@ -17,10 +17,12 @@
 #include "modules/audio_processing/include/audio_processing.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
 
 class AudioBuffer;
+class ChannelWorkerPool;
 
 class NoiseSuppressionImpl : public NoiseSuppression {
  public:
@@ -29,6 +31,9 @@ class NoiseSuppressionImpl : public NoiseSuppression {
 
   // TODO(peah): Fold into ctor, once public API is removed.
   void Initialize(size_t channels, int sample_rate_hz);
+  // Sets the pool over which the per-channel work is distributed; a null
+  // |pool| restores single-threaded processing.
+  void SetCaptureWorkerPool(ChannelWorkerPool* pool);
   void AnalyzeCaptureAudio(AudioBuffer* audio);
   void ProcessCaptureAudio(AudioBuffer* audio);
 
@@ -43,12 +48,21 @@ class NoiseSuppressionImpl : public NoiseSuppression {
 
  private:
   class Suppressor;
+  // Per-channel processing bodies, invoked concurrently for distinct channels
+  // when a worker pool is set. The thread driving the pool holds |crit_|, so
+  // the thread safety analysis is disabled for the workers.
+  void AnalyzeChannel(AudioBuffer* audio, size_t channel)
+      RTC_NO_THREAD_SAFETY_ANALYSIS;
+  void ProcessChannel(AudioBuffer* audio, size_t channel)
+      RTC_NO_THREAD_SAFETY_ANALYSIS;
+
   rtc::CriticalSection* const crit_;
   bool enabled_ RTC_GUARDED_BY(crit_) = false;
   Level level_ RTC_GUARDED_BY(crit_) = kModerate;
   size_t channels_ RTC_GUARDED_BY(crit_) = 0;
   int sample_rate_hz_ RTC_GUARDED_BY(crit_) = 0;
   std::vector<std::unique_ptr<Suppressor>> suppressors_ RTC_GUARDED_BY(crit_);
+  ChannelWorkerPool* worker_pool_ RTC_GUARDED_BY(crit_) = nullptr;
   RTC_DISALLOW_IMPLICIT_CONSTRUCTORS(NoiseSuppressionImpl);
 };
 }  // namespace webrtc
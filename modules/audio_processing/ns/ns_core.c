@@ -13,12 +13,20 @@
 #include <stdlib.h>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
 #include "common_audio/signal_processing/include/signal_processing_library.h"
 #include "common_audio/third_party/fft4g/fft4g.h"
 #include "modules/audio_processing/ns/noise_suppression.h"
 #include "modules/audio_processing/ns/ns_core.h"
 #include "modules/audio_processing/ns/windows_private.h"
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
 // Set Feature Extraction Parameters.
 static void set_feature_extraction_parameters(NoiseSuppressionC* self) {
   // Bin size of histogram.
@@ -216,11 +224,125 @@ int WebRtcNs_InitCore(NoiseSuppressionC* self, uint32_t fs) {
 }
 
 // Estimate noise.
+// Updates the log quantile and density estimates for one simultaneous
+// estimate, given the log magnitude spectrum |lmagn|. The vectorized code
+// paths perform the same arithmetic operations per bin as the scalar
+// remainder loop, so the result is bit-exact across platforms.
+static void UpdateLogQuantileEstimate(const float* lmagn,
+                                      float* lquantile,
+                                      float* density,
+                                      int counter,
+                                      size_t magn_len) {
+  const float counter_f = (float)counter;
+  const float counter_plus_1 = (float)(counter + 1);
+  float delta;
+  size_t i = 0;
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  {
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 factor = _mm_set1_ps(FACTOR);
+    const __m128 quantile_weight = _mm_set1_ps(QUANTILE);
+    const __m128 one_minus_quantile_weight = _mm_set1_ps(1.f - QUANTILE);
+    const __m128 counter_128 = _mm_set1_ps(counter_f);
+    const __m128 counter_plus_1_128 = _mm_set1_ps(counter_plus_1);
+    const __m128 width = _mm_set1_ps(WIDTH);
+    const __m128 inv_two_width = _mm_set1_ps(1.f / (2.f * WIDTH));
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    for (; i + 4 <= magn_len; i += 4) {
+      const __m128 lm = _mm_loadu_ps(&lmagn[i]);
+      __m128 lq = _mm_loadu_ps(&lquantile[i]);
+      __m128 dens = _mm_loadu_ps(&density[i]);
+      // Compute delta.
+      const __m128 dens_gt_one = _mm_cmpgt_ps(dens, one);
+      const __m128 delta_128 =
+          _mm_or_ps(_mm_and_ps(dens_gt_one, _mm_div_ps(factor, dens)),
+                    _mm_andnot_ps(dens_gt_one, factor));
+      // Update log quantile estimate.
+      const __m128 step_up = _mm_div_ps(
+          _mm_mul_ps(quantile_weight, delta_128), counter_plus_1_128);
+      const __m128 step_down = _mm_div_ps(
+          _mm_mul_ps(one_minus_quantile_weight, delta_128), counter_plus_1_128);
+      const __m128 lm_gt_lq = _mm_cmpgt_ps(lm, lq);
+      lq = _mm_add_ps(lq, _mm_and_ps(lm_gt_lq, step_up));
+      lq = _mm_sub_ps(lq, _mm_andnot_ps(lm_gt_lq, step_down));
+      _mm_storeu_ps(&lquantile[i], lq);
+      // Update density estimate.
+      const __m128 in_width = _mm_cmplt_ps(
+          _mm_and_ps(abs_mask, _mm_sub_ps(lm, lq)), width);
+      const __m128 updated_dens = _mm_div_ps(
+          _mm_add_ps(_mm_mul_ps(counter_128, dens), inv_two_width),
+          counter_plus_1_128);
+      dens = _mm_or_ps(_mm_and_ps(in_width, updated_dens),
+                       _mm_andnot_ps(in_width, dens));
+      _mm_storeu_ps(&density[i], dens);
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  {
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t factor = vdupq_n_f32(FACTOR);
+    const float32x4_t quantile_weight = vdupq_n_f32(QUANTILE);
+    const float32x4_t one_minus_quantile_weight = vdupq_n_f32(1.f - QUANTILE);
+    const float32x4_t counter_vec = vdupq_n_f32(counter_f);
+    const float32x4_t counter_plus_1_vec = vdupq_n_f32(counter_plus_1);
+    const float32x4_t width = vdupq_n_f32(WIDTH);
+    const float32x4_t inv_two_width = vdupq_n_f32(1.f / (2.f * WIDTH));
+    for (; i + 4 <= magn_len; i += 4) {
+      const float32x4_t lm = vld1q_f32(&lmagn[i]);
+      float32x4_t lq = vld1q_f32(&lquantile[i]);
+      float32x4_t dens = vld1q_f32(&density[i]);
+      // Compute delta.
+      const uint32x4_t dens_gt_one = vcgtq_f32(dens, one);
+      const float32x4_t delta_vec =
+          vbslq_f32(dens_gt_one, vdivq_f32(factor, dens), factor);
+      // Update log quantile estimate.
+      const float32x4_t step_up =
+          vdivq_f32(vmulq_f32(quantile_weight, delta_vec), counter_plus_1_vec);
+      const float32x4_t step_down = vdivq_f32(
+          vmulq_f32(one_minus_quantile_weight, delta_vec), counter_plus_1_vec);
+      const uint32x4_t lm_gt_lq = vcgtq_f32(lm, lq);
+      lq = vbslq_f32(lm_gt_lq, vaddq_f32(lq, step_up), vsubq_f32(lq, step_down));
+      vst1q_f32(&lquantile[i], lq);
+      // Update density estimate.
+      const uint32x4_t in_width = vcltq_f32(vabsq_f32(vsubq_f32(lm, lq)), width);
+      const float32x4_t updated_dens = vdivq_f32(
+          vaddq_f32(vmulq_f32(counter_vec, dens), inv_two_width),
+          counter_plus_1_vec);
+      dens = vbslq_f32(in_width, updated_dens, dens);
+      vst1q_f32(&density[i], dens);
+    }
+  }
+#endif
+
+  for (; i < magn_len; i++) {
+    // Compute delta.
+    if (density[i] > 1.0) {
+      delta = FACTOR * 1.f / density[i];
+    } else {
+      delta = FACTOR;
+    }
+
+    // Update log quantile estimate.
+    if (lmagn[i] > lquantile[i]) {
+      lquantile[i] += QUANTILE * delta / counter_plus_1;
+    } else {
+      lquantile[i] -= (1.f - QUANTILE) * delta / counter_plus_1;
+    }
+
+    // Update density estimate.
+    if (fabs(lmagn[i] - lquantile[i]) < WIDTH) {
+      density[i] = (counter_f * density[i] + 1.f / (2.f * WIDTH)) /
+          counter_plus_1;
+    }
+  }  // End loop over magnitude spectrum.
+}
+
 static void NoiseEstimation(NoiseSuppressionC* self,
                             float* magn,
                             float* noise) {
   size_t i, s, offset;
-  float lmagn[HALF_ANAL_BLOCKL], delta;
+  float lmagn[HALF_ANAL_BLOCKL];
 
   if (self->updates < END_STARTUP_LONG) {
     self->updates++;
@@ -235,31 +357,9 @@ static void NoiseEstimation(NoiseSuppressionC* self,
     offset = s * self->magnLen;
 
     // newquantest(...)
-    for (i = 0; i < self->magnLen; i++) {
-      // Compute delta.
-      if (self->density[offset + i] > 1.0) {
-        delta = FACTOR * 1.f / self->density[offset + i];
-      } else {
-        delta = FACTOR;
-      }
-
-      // Update log quantile estimate.
-      if (lmagn[i] > self->lquantile[offset + i]) {
-        self->lquantile[offset + i] +=
-            QUANTILE * delta / (float)(self->counter[s] + 1);
-      } else {
-        self->lquantile[offset + i] -=
-            (1.f - QUANTILE) * delta / (float)(self->counter[s] + 1);
-      }
-
-      // Update density estimate.
-      if (fabs(lmagn[i] - self->lquantile[offset + i]) < WIDTH) {
-        self->density[offset + i] =
-            ((float)self->counter[s] * self->density[offset + i] +
-             1.f / (2.f * WIDTH)) /
-            (float)(self->counter[s] + 1);
-      }
-    }  // End loop over magnitude spectrum.
+    UpdateLogQuantileEstimate(lmagn, self->lquantile + offset,
+                              self->density + offset, self->counter[s],
+                              self->magnLen);
 
     if (self->counter[s] >= END_STARTUP_LONG) {
       self->counter[s] = 0;
@@ -570,9 +670,65 @@ static void ComputeSnr(const NoiseSuppressionC* self,
                        const float* noise,
                        float* snrLocPrior,
                        float* snrLocPost) {
-  size_t i;
+  size_t i = 0;
+
+  // The vectorized code paths perform the same arithmetic operations per bin
+  // as the scalar remainder loop, so the result is bit-exact.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  {
+    const __m128 epsilon = _mm_set1_ps(0.0001f);
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 dd = _mm_set1_ps(DD_PR_SNR);
+    const __m128 one_minus_dd = _mm_set1_ps(1.f - DD_PR_SNR);
+    for (; i + 4 <= self->magnLen; i += 4) {
+      const __m128 magn_128 = _mm_loadu_ps(&magn[i]);
+      const __m128 noise_128 = _mm_loadu_ps(&noise[i]);
+      // Previous estimate: based on previous frame with gain filter.
+      const __m128 previous_estimate = _mm_mul_ps(
+          _mm_div_ps(_mm_loadu_ps(&self->magnPrevAnalyze[i]),
+                     _mm_add_ps(_mm_loadu_ps(&self->noisePrev[i]), epsilon)),
+          _mm_loadu_ps(&self->smooth[i]));
+      // Post SNR: zero unless the magnitude exceeds the noise estimate.
+      const __m128 post = _mm_and_ps(
+          _mm_cmpgt_ps(magn_128, noise_128),
+          _mm_sub_ps(_mm_div_ps(magn_128, _mm_add_ps(noise_128, epsilon)),
+                     one));
+      _mm_storeu_ps(&snrLocPost[i], post);
+      // Directed decision update of snrPrior.
+      _mm_storeu_ps(&snrLocPrior[i],
+                    _mm_add_ps(_mm_mul_ps(dd, previous_estimate),
+                               _mm_mul_ps(one_minus_dd, post)));
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  {
+    const float32x4_t epsilon = vdupq_n_f32(0.0001f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t dd = vdupq_n_f32(DD_PR_SNR);
+    const float32x4_t one_minus_dd = vdupq_n_f32(1.f - DD_PR_SNR);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    for (; i + 4 <= self->magnLen; i += 4) {
+      const float32x4_t magn_vec = vld1q_f32(&magn[i]);
+      const float32x4_t noise_vec = vld1q_f32(&noise[i]);
+      // Previous estimate: based on previous frame with gain filter.
+      const float32x4_t previous_estimate = vmulq_f32(
+          vdivq_f32(vld1q_f32(&self->magnPrevAnalyze[i]),
+                    vaddq_f32(vld1q_f32(&self->noisePrev[i]), epsilon)),
+          vld1q_f32(&self->smooth[i]));
+      // Post SNR: zero unless the magnitude exceeds the noise estimate.
+      const float32x4_t post = vbslq_f32(
+          vcgtq_f32(magn_vec, noise_vec),
+          vsubq_f32(vdivq_f32(magn_vec, vaddq_f32(noise_vec, epsilon)), one),
+          zero);
+      vst1q_f32(&snrLocPost[i], post);
+      // Directed decision update of snrPrior.
+      vst1q_f32(&snrLocPrior[i], vaddq_f32(vmulq_f32(dd, previous_estimate),
+                                           vmulq_f32(one_minus_dd, post)));
+    }
+  }
+#endif
 
-  for (i = 0; i < self->magnLen; i++) {
+  for (; i < self->magnLen; i++) {
     // Previous post SNR.
     // Previous estimate: based on previous frame with gain filter.
     float previousEstimateStsa = self->magnPrevAnalyze[i] /
@@ -988,10 +1144,75 @@ static void Windowing(const float* window,
 static void ComputeDdBasedWienerFilter(const NoiseSuppressionC* self,
                                        const float* magn,
                                        float* theFilter) {
-  size_t i;
+  size_t i = 0;
   float snrPrior, previousEstimateStsa, currentEstimateStsa;
 
-  for (i = 0; i < self->magnLen; i++) {
+  // The vectorized code paths perform the same arithmetic operations per bin
+  // as the scalar remainder loop, so the result is bit-exact.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  {
+    const __m128 epsilon = _mm_set1_ps(0.0001f);
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 dd = _mm_set1_ps(DD_PR_SNR);
+    const __m128 one_minus_dd = _mm_set1_ps(1.f - DD_PR_SNR);
+    const __m128 overdrive = _mm_set1_ps(self->overdrive);
+    for (; i + 4 <= self->magnLen; i += 4) {
+      const __m128 magn_128 = _mm_loadu_ps(&magn[i]);
+      const __m128 noise_128 = _mm_loadu_ps(&self->noise[i]);
+      // Previous estimate: based on previous frame with gain filter.
+      const __m128 previous_estimate = _mm_mul_ps(
+          _mm_div_ps(_mm_loadu_ps(&self->magnPrevProcess[i]),
+                     _mm_add_ps(_mm_loadu_ps(&self->noisePrev[i]), epsilon)),
+          _mm_loadu_ps(&self->smooth[i]));
+      // Current estimate: zero unless the magnitude exceeds the noise
+      // estimate.
+      const __m128 current_estimate = _mm_and_ps(
+          _mm_cmpgt_ps(magn_128, noise_128),
+          _mm_sub_ps(_mm_div_ps(magn_128, _mm_add_ps(noise_128, epsilon)),
+                     one));
+      // Directed decision update of |snrPrior|.
+      const __m128 snr_prior =
+          _mm_add_ps(_mm_mul_ps(dd, previous_estimate),
+                     _mm_mul_ps(one_minus_dd, current_estimate));
+      // Gain filter.
+      _mm_storeu_ps(&theFilter[i],
+                    _mm_div_ps(snr_prior, _mm_add_ps(overdrive, snr_prior)));
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  {
+    const float32x4_t epsilon = vdupq_n_f32(0.0001f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t dd = vdupq_n_f32(DD_PR_SNR);
+    const float32x4_t one_minus_dd = vdupq_n_f32(1.f - DD_PR_SNR);
+    const float32x4_t overdrive = vdupq_n_f32(self->overdrive);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    for (; i + 4 <= self->magnLen; i += 4) {
+      const float32x4_t magn_vec = vld1q_f32(&magn[i]);
+      const float32x4_t noise_vec = vld1q_f32(&self->noise[i]);
+      // Previous estimate: based on previous frame with gain filter.
+      const float32x4_t previous_estimate = vmulq_f32(
+          vdivq_f32(vld1q_f32(&self->magnPrevProcess[i]),
+                    vaddq_f32(vld1q_f32(&self->noisePrev[i]), epsilon)),
+          vld1q_f32(&self->smooth[i]));
+      // Current estimate: zero unless the magnitude exceeds the noise
+      // estimate.
+      const float32x4_t current_estimate = vbslq_f32(
+          vcgtq_f32(magn_vec, noise_vec),
+          vsubq_f32(vdivq_f32(magn_vec, vaddq_f32(noise_vec, epsilon)), one),
+          zero);
+      // Directed decision update of |snrPrior|.
+      const float32x4_t snr_prior =
+          vaddq_f32(vmulq_f32(dd, previous_estimate),
+                    vmulq_f32(one_minus_dd, current_estimate));
+      // Gain filter.
+      vst1q_f32(&theFilter[i],
+                vdivq_f32(snr_prior, vaddq_f32(overdrive, snr_prior)));
+    }
+  }
+#endif
+
+  for (; i < self->magnLen; i++) {
     // Previous estimate: based on previous frame with gain filter.
     previousEstimateStsa = self->magnPrevProcess[i] /
                            (self->noisePrev[i] + 0.0001f) * self->smooth[i];
@@ -16,6 +16,7 @@
 #include <utility>
 
 #include "absl/memory/memory.h"
+#include "api/array_view.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
 
@@ -39,16 +40,23 @@ void AcknowledgedBitrateEstimator::IncomingPacketFeedbackVector(
   RTC_DCHECK(std::is_sorted(packet_feedback_vector.begin(),
                             packet_feedback_vector.end(),
                             PacketResult::ReceiveTimeOrder()));
-  for (const auto& packet : packet_feedback_vector) {
-    if (alr_ended_time_ && packet.sent_packet.send_time > *alr_ended_time_) {
+  rtc::ArrayView<const PacketResult> remaining(packet_feedback_vector);
+  if (alr_ended_time_) {
+    // Split the batch at the first packet sent after ALR ended, so the fast
+    // rate change expectation takes effect from that packet on.
+    size_t split = 0;
+    while (split < remaining.size() &&
+           remaining[split].sent_packet.send_time <= *alr_ended_time_) {
+      ++split;
+    }
+    if (split < remaining.size()) {
+      bitrate_estimator_->UpdateBatch(remaining.subview(0, split), in_alr_);
       bitrate_estimator_->ExpectFastRateChange();
       alr_ended_time_.reset();
+      remaining = remaining.subview(split);
     }
-    DataSize acknowledged_estimate = packet.sent_packet.size;
-    acknowledged_estimate += packet.sent_packet.prior_unacked_data;
-    bitrate_estimator_->Update(packet.receive_time, acknowledged_estimate,
-                               in_alr_);
   }
+  bitrate_estimator_->UpdateBatch(remaining, in_alr_);
 }
 
 absl::optional<DataRate> AcknowledgedBitrateEstimator::bitrate() const {
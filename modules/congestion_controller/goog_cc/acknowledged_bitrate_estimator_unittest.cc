@@ -121,6 +121,28 @@ TEST(TestAcknowledgedBitrateEstimator, ExpectFastRateChangeWhenLeftAlr) {
       packet_feedback_vector);
 }
 
+TEST(TestAcknowledgedBitrateEstimator, BatchedUpdateMatchesPerPacket) {
+  FieldTrialBasedConfig field_trial_config;
+  AcknowledgedBitrateEstimator batched(&field_trial_config);
+  AcknowledgedBitrateEstimator per_packet(&field_trial_config);
+  std::vector<PacketResult> feedback;
+  int64_t now_ms = kFirstArrivalTimeMs;
+  for (int i = 0; i < 200; ++i) {
+    now_ms += 5;
+    PacketResult packet;
+    packet.receive_time = Timestamp::ms(now_ms);
+    packet.sent_packet.send_time = Timestamp::ms(now_ms - 10);
+    packet.sent_packet.sequence_number = i;
+    packet.sent_packet.size = DataSize::bytes(1200);
+    feedback.push_back(packet);
+  }
+  batched.IncomingPacketFeedbackVector(feedback);
+  for (const PacketResult& packet : feedback)
+    per_packet.IncomingPacketFeedbackVector({packet});
+  ASSERT_TRUE(batched.bitrate().has_value());
+  EXPECT_EQ(*batched.bitrate(), *per_packet.bitrate());
+}
+
 TEST(TestAcknowledgedBitrateEstimator, ReturnBitrate) {
   auto states = CreateTestStates();
   absl::optional<DataRate> return_value = DataRate::kbps(42);
@@ -106,6 +106,28 @@ void BitrateEstimator::Update(Timestamp at_time, DataSize amount, bool in_alr) {
                         bitrate_estimate_kbps_ * 1000);
 }
 
+void BitrateEstimator::UpdateBatch(rtc::ArrayView<const PacketResult> packets,
+                                   bool in_alr) {
+  for (const PacketResult& packet : packets) {
+    DataSize acknowledged_estimate = packet.sent_packet.size;
+    acknowledged_estimate += packet.sent_packet.prior_unacked_data;
+    const int64_t now_ms = packet.receive_time.ms();
+    int rate_window_ms = noninitial_window_ms_.Get();
+    if (bitrate_estimate_kbps_ < 0.f)
+      rate_window_ms = initial_window_ms_.Get();
+    // Fast path: time moves forward and the packet does not complete the
+    // current rate window, so only the window bookkeeping is affected.
+    if (prev_time_ms_ >= 0 && now_ms >= prev_time_ms_ &&
+        current_window_ms_ + (now_ms - prev_time_ms_) < rate_window_ms) {
+      current_window_ms_ += now_ms - prev_time_ms_;
+      prev_time_ms_ = now_ms;
+      sum_ += acknowledged_estimate.bytes();
+      continue;
+    }
+    Update(packet.receive_time, acknowledged_estimate, in_alr);
+  }
+}
+
 float BitrateEstimator::UpdateWindow(int64_t now_ms,
                                      int bytes,
                                      int rate_window_ms) {
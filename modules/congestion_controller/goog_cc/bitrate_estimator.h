@@ -14,6 +14,8 @@
 #include <stdint.h>
 
 #include "absl/types/optional.h"
+#include "api/array_view.h"
+#include "api/transport/network_types.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "api/units/data_rate.h"
 #include "api/units/timestamp.h"
@@ -31,6 +33,13 @@ class BitrateEstimator {
   explicit BitrateEstimator(const WebRtcKeyValueConfig* key_value_config);
   virtual ~BitrateEstimator();
   virtual void Update(Timestamp at_time, DataSize amount, bool in_alr);
+  // Equivalent to calling Update() once per packet, in order, with the payload
+  // size plus any prior unacked data as the acknowledged amount, but packets
+  // that fall within the current rate window are folded into plain integer
+  // accumulation so the bayesian update runs at most once per completed window
+  // rather than once per packet. The packets must be sorted by receive time.
+  virtual void UpdateBatch(rtc::ArrayView<const PacketResult> packets,
+                           bool in_alr);
 
   virtual absl::optional<DataRate> bitrate() const;
   absl::optional<DataRate> PeekRate() const;
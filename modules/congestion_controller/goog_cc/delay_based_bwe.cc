@@ -40,6 +40,18 @@ constexpr double kTimestampToMs =
 // after the API has been changed.
 constexpr uint32_t kFixedSsrc = 0;
 
+// Converts a send time to the full 32 bit timestamp domain that InterArrival
+// works with, so wrapping works properly.
+uint32_t ToInterArrivalTimestamp(Timestamp send_time) {
+  uint32_t send_time_24bits =
+      static_cast<uint32_t>(
+          ((static_cast<uint64_t>(send_time.ms()) << kAbsSendTimeFraction) +
+           500) /
+          1000) &
+      0x00FFFFFF;
+  return send_time_24bits << kAbsSendTimeInterArrivalUpshift;
+}
+
 }  // namespace
 
 DelayBasedBwe::Result::Result()
@@ -101,12 +113,44 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
                               BweNames::kBweNamesMax);
     uma_recorded_ = true;
   }
+  // Reset if the stream has timed out. All packets in the vector share the
+  // feedback time, so this cannot trigger mid-batch.
+  if (last_seen_packet_.IsInfinite() ||
+      msg.feedback_time - last_seen_packet_ > kStreamTimeOut) {
+    inter_arrival_.reset(
+        new InterArrival((kTimestampGroupLengthMs << kInterArrivalShift) / 1000,
+                         kTimestampToMs, true));
+    delay_detector_.reset(
+        new TrendlineEstimator(key_value_config_, network_state_predictor_));
+  }
+  last_seen_packet_ = msg.feedback_time;
+
+  // Compute the inter-arrival deltas for the whole vector in one pass, then
+  // feed the resulting flat data to the delay detector.
+  packet_timings_.clear();
+  for (const auto& packet_feedback : packet_feedback_vector) {
+    packet_timings_.push_back(
+        {ToInterArrivalTimestamp(packet_feedback.sent_packet.send_time),
+         packet_feedback.receive_time.ms(),
+         static_cast<size_t>(packet_feedback.sent_packet.size.bytes())});
+  }
+  inter_arrival_->ComputeDeltasBatch(packet_timings_, msg.feedback_time.ms(),
+                                     &packet_deltas_);
+
   bool delayed_feedback = true;
   bool recovered_from_overuse = false;
   BandwidthUsage prev_detector_state = delay_detector_->State();
-  for (const auto& packet_feedback : packet_feedback_vector) {
+  for (size_t i = 0; i < packet_feedback_vector.size(); ++i) {
     delayed_feedback = false;
-    IncomingPacketFeedback(packet_feedback, msg.feedback_time);
+    const PacketResult& packet_feedback = packet_feedback_vector[i];
+    const InterArrival::PacketDeltas& deltas = packet_deltas_[i];
+    double ts_delta_ms =
+        (1000.0 * deltas.timestamp_delta) / (1 << kInterArrivalShift);
+    delay_detector_->Update(deltas.arrival_time_delta_ms, ts_delta_ms,
+                            packet_feedback.sent_packet.send_time.ms(),
+                            packet_feedback.receive_time.ms(),
+                            packet_feedback.sent_packet.size.bytes(),
+                            deltas.computed);
     if (prev_detector_state == BandwidthUsage::kBwUnderusing &&
         delay_detector_->State() == BandwidthUsage::kBwNormal) {
       recovered_from_overuse = true;
@@ -126,44 +170,6 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
                              recovered_from_overuse, in_alr, msg.feedback_time);
 }
 
-void DelayBasedBwe::IncomingPacketFeedback(const PacketResult& packet_feedback,
-                                           Timestamp at_time) {
-  // Reset if the stream has timed out.
-  if (last_seen_packet_.IsInfinite() ||
-      at_time - last_seen_packet_ > kStreamTimeOut) {
-    inter_arrival_.reset(
-        new InterArrival((kTimestampGroupLengthMs << kInterArrivalShift) / 1000,
-                         kTimestampToMs, true));
-    delay_detector_.reset(
-        new TrendlineEstimator(key_value_config_, network_state_predictor_));
-  }
-  last_seen_packet_ = at_time;
-
-  uint32_t send_time_24bits =
-      static_cast<uint32_t>(
-          ((static_cast<uint64_t>(packet_feedback.sent_packet.send_time.ms())
-            << kAbsSendTimeFraction) +
-           500) /
-          1000) &
-      0x00FFFFFF;
-  // Shift up send time to use the full 32 bits that inter_arrival works with,
-  // so wrapping works properly.
-  uint32_t timestamp = send_time_24bits << kAbsSendTimeInterArrivalUpshift;
-
-  uint32_t ts_delta = 0;
-  int64_t t_delta = 0;
-  int size_delta = 0;
-  bool calculated_deltas = inter_arrival_->ComputeDeltas(
-      timestamp, packet_feedback.receive_time.ms(), at_time.ms(),
-      packet_feedback.sent_packet.size.bytes(), &ts_delta, &t_delta,
-      &size_delta);
-  double ts_delta_ms = (1000.0 * ts_delta) / (1 << kInterArrivalShift);
-  delay_detector_->Update(
-      t_delta, ts_delta_ms, packet_feedback.sent_packet.send_time.ms(),
-      packet_feedback.receive_time.ms(),
-      packet_feedback.sent_packet.size.bytes(), calculated_deltas);
-}
-
 DataRate DelayBasedBwe::TriggerOveruse(Timestamp at_time,
                                        absl::optional<DataRate> link_capacity) {
   RateControlInput input(BandwidthUsage::kBwOverusing, link_capacity);
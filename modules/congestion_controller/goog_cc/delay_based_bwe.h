@@ -68,8 +68,6 @@ class DelayBasedBwe {
 
  private:
   friend class GoogCcStatePrinter;
-  void IncomingPacketFeedback(const PacketResult& packet_feedback,
-                              Timestamp at_time);
   Result MaybeUpdateEstimate(
       absl::optional<DataRate> acked_bitrate,
       absl::optional<DataRate> probe_bitrate,
@@ -89,6 +87,10 @@ class DelayBasedBwe {
   NetworkStatePredictor* network_state_predictor_;
   std::unique_ptr<InterArrival> inter_arrival_;
   std::unique_ptr<DelayIncreaseDetectorInterface> delay_detector_;
+  // Scratch buffers reused between feedback vectors to avoid allocations on
+  // the network thread.
+  std::vector<InterArrival::PacketTiming> packet_timings_;
+  std::vector<InterArrival::PacketDeltas> packet_deltas_;
   Timestamp last_seen_packet_;
   bool uma_recorded_;
   AimdRateControl rate_control_;
@@ -65,6 +65,7 @@ GoogCcNetworkController::GoogCcNetworkController(NetworkControllerConfig config,
                                                 : &trial_based_config_),
       event_log_(config.event_log),
       packet_feedback_only_(goog_cc_config.feedback_only),
+      lightweight_(goog_cc_config.lightweight),
       safe_reset_on_route_change_("Enabled"),
       safe_reset_acknowledged_rate_("ack"),
       use_downlink_delay_for_congestion_window_(
@@ -77,7 +78,10 @@ GoogCcNetworkController::GoogCcNetworkController(NetworkControllerConfig config,
       rate_control_settings_(
           RateControlSettings::ParseFromKeyValueConfig(key_value_config_)),
       probe_controller_(
-          new ProbeController(key_value_config_, config.event_log)),
+          lightweight_
+              ? nullptr
+              : absl::make_unique<ProbeController>(key_value_config_,
+                                                   config.event_log)),
       congestion_window_pushback_controller_(
           rate_control_settings_.UseCongestionWindowPushback()
               ? absl::make_unique<CongestionWindowPushbackController>(
@@ -85,9 +89,14 @@ GoogCcNetworkController::GoogCcNetworkController(NetworkControllerConfig config,
               : nullptr),
       bandwidth_estimation_(
           absl::make_unique<SendSideBandwidthEstimation>(event_log_)),
-      alr_detector_(
-          absl::make_unique<AlrDetector>(key_value_config_, config.event_log)),
-      probe_bitrate_estimator_(new ProbeBitrateEstimator(config.event_log)),
+      alr_detector_(lightweight_
+                        ? nullptr
+                        : absl::make_unique<AlrDetector>(key_value_config_,
+                                                         config.event_log)),
+      probe_bitrate_estimator_(
+          lightweight_
+              ? nullptr
+              : absl::make_unique<ProbeBitrateEstimator>(config.event_log)),
       network_estimator_(std::move(goog_cc_config.network_state_estimator)),
       network_state_predictor_(
           std::move(goog_cc_config.network_state_predictor)),
@@ -120,7 +129,9 @@ GoogCcNetworkController::~GoogCcNetworkController() {}
 NetworkControlUpdate GoogCcNetworkController::OnNetworkAvailability(
     NetworkAvailability msg) {
   NetworkControlUpdate update;
-  update.probe_cluster_configs = probe_controller_->OnNetworkAvailability(msg);
+  if (probe_controller_)
+    update.probe_cluster_configs =
+        probe_controller_->OnNetworkAvailability(msg);
   return update;
 }
 
@@ -152,13 +163,15 @@ NetworkControlUpdate GoogCcNetworkController::OnNetworkRouteChange(
 
   acknowledged_bitrate_estimator_.reset(
       new AcknowledgedBitrateEstimator(key_value_config_));
-  probe_bitrate_estimator_.reset(new ProbeBitrateEstimator(event_log_));
+  if (probe_bitrate_estimator_)
+    probe_bitrate_estimator_.reset(new ProbeBitrateEstimator(event_log_));
   if (network_estimator_)
     network_estimator_->OnRouteChange(msg);
   delay_based_bwe_.reset(new DelayBasedBwe(key_value_config_, event_log_,
                                            network_state_predictor_.get()));
   bandwidth_estimation_->OnRouteChange();
-  probe_controller_->Reset(msg.at_time.ms());
+  if (probe_controller_)
+    probe_controller_->Reset(msg.at_time.ms());
   NetworkControlUpdate update;
   update.probe_cluster_configs = ResetConstraints(msg.constraints);
   MaybeTriggerOnNetworkChanged(&update, msg.at_time);
@@ -173,18 +186,20 @@ NetworkControlUpdate GoogCcNetworkController::OnProcessInterval(
         ResetConstraints(initial_config_->constraints);
     update.pacer_config = GetPacingRates(msg.at_time);
 
-    if (initial_config_->stream_based_config.requests_alr_probing) {
+    if (probe_controller_ &&
+        initial_config_->stream_based_config.requests_alr_probing) {
       probe_controller_->EnablePeriodicAlrProbing(
           *initial_config_->stream_based_config.requests_alr_probing);
     }
     absl::optional<DataRate> total_bitrate =
         initial_config_->stream_based_config.max_total_allocated_bitrate;
     if (total_bitrate) {
-      auto probes = probe_controller_->OnMaxTotalAllocatedBitrate(
-          total_bitrate->bps(), msg.at_time.ms());
-      update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
-                                          probes.begin(), probes.end());
-
+      if (probe_controller_) {
+        auto probes = probe_controller_->OnMaxTotalAllocatedBitrate(
+            total_bitrate->bps(), msg.at_time.ms());
+        update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
+                                            probes.begin(), probes.end());
+      }
       max_total_allocated_bitrate_ = *total_bitrate;
     }
     initial_config_.reset();
@@ -194,13 +209,15 @@ NetworkControlUpdate GoogCcNetworkController::OnProcessInterval(
         msg.pacer_queue->bytes());
   }
   bandwidth_estimation_->UpdateEstimate(msg.at_time);
-  absl::optional<int64_t> start_time_ms =
-      alr_detector_->GetApplicationLimitedRegionStartTime();
-  probe_controller_->SetAlrStartTimeMs(start_time_ms);
+  if (probe_controller_) {
+    absl::optional<int64_t> start_time_ms =
+        alr_detector_->GetApplicationLimitedRegionStartTime();
+    probe_controller_->SetAlrStartTimeMs(start_time_ms);
 
-  auto probes = probe_controller_->Process(msg.at_time.ms());
-  update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
-                                      probes.begin(), probes.end());
+    auto probes = probe_controller_->Process(msg.at_time.ms());
+    update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
+                                        probes.begin(), probes.end());
+  }
 
   if (rate_control_settings_.UseCongestionWindow() &&
       use_downlink_delay_for_congestion_window_ &&
@@ -243,10 +260,12 @@ NetworkControlUpdate GoogCcNetworkController::OnRoundTripTimeUpdate(
 
 NetworkControlUpdate GoogCcNetworkController::OnSentPacket(
     SentPacket sent_packet) {
-  alr_detector_->OnBytesSent(sent_packet.size.bytes(),
-                             sent_packet.send_time.ms());
-  acknowledged_bitrate_estimator_->SetAlr(
-      alr_detector_->GetApplicationLimitedRegionStartTime().has_value());
+  if (alr_detector_) {
+    alr_detector_->OnBytesSent(sent_packet.size.bytes(),
+                               sent_packet.send_time.ms());
+    acknowledged_bitrate_estimator_->SetAlr(
+        alr_detector_->GetApplicationLimitedRegionStartTime().has_value());
+  }
 
   if (!first_packet_sent_) {
     first_packet_sent_ = true;
@@ -281,17 +300,20 @@ NetworkControlUpdate GoogCcNetworkController::OnReceivedPacket(
 NetworkControlUpdate GoogCcNetworkController::OnStreamsConfig(
     StreamsConfig msg) {
   NetworkControlUpdate update;
-  if (msg.requests_alr_probing) {
+  if (probe_controller_ && msg.requests_alr_probing) {
     probe_controller_->EnablePeriodicAlrProbing(*msg.requests_alr_probing);
   }
   if (msg.max_total_allocated_bitrate &&
       *msg.max_total_allocated_bitrate != max_total_allocated_bitrate_) {
-    if (rate_control_settings_.TriggerProbeOnMaxAllocatedBitrateChange()) {
-      update.probe_cluster_configs =
-          probe_controller_->OnMaxTotalAllocatedBitrate(
-              msg.max_total_allocated_bitrate->bps(), msg.at_time.ms());
-    } else {
-      probe_controller_->SetMaxBitrate(msg.max_total_allocated_bitrate->bps());
+    if (probe_controller_) {
+      if (rate_control_settings_.TriggerProbeOnMaxAllocatedBitrateChange()) {
+        update.probe_cluster_configs =
+            probe_controller_->OnMaxTotalAllocatedBitrate(
+                msg.max_total_allocated_bitrate->bps(), msg.at_time.ms());
+      } else {
+        probe_controller_->SetMaxBitrate(
+            msg.max_total_allocated_bitrate->bps());
+      }
     }
     max_total_allocated_bitrate_ = *msg.max_total_allocated_bitrate;
   }
@@ -362,6 +384,8 @@ std::vector<ProbeClusterConfig> GoogCcNetworkController::ResetConstraints(
     delay_based_bwe_->SetStartBitrate(*starting_rate_);
   delay_based_bwe_->SetMinBitrate(min_data_rate_);
 
+  if (!probe_controller_)
+    return {};
   return probe_controller_->SetBitrates(
       min_data_rate_.bps(), GetBpsOrDefault(starting_rate_, -1),
       max_data_rate_.bps_or(-1), new_constraints.at_time.ms());
@@ -477,8 +501,9 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
       lost_packets_since_last_loss_update_ = 0;
     }
   }
-  absl::optional<int64_t> alr_start_time =
-      alr_detector_->GetApplicationLimitedRegionStartTime();
+  absl::optional<int64_t> alr_start_time;
+  if (alr_detector_)
+    alr_start_time = alr_detector_->GetApplicationLimitedRegionStartTime();
 
   if (previously_in_alr_ && !alr_start_time.has_value()) {
     int64_t now_ms = report.feedback_time.ms();
@@ -489,17 +514,20 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
   acknowledged_bitrate_estimator_->IncomingPacketFeedbackVector(
       report.SortedByReceiveTime());
   auto acknowledged_bitrate = acknowledged_bitrate_estimator_->bitrate();
-  for (const auto& feedback : report.SortedByReceiveTime()) {
-    if (feedback.sent_packet.pacing_info.probe_cluster_id !=
-        PacedPacketInfo::kNotAProbe) {
-      probe_bitrate_estimator_->HandleProbeAndEstimateBitrate(feedback);
+  absl::optional<DataRate> probe_bitrate;
+  if (probe_bitrate_estimator_) {
+    for (const auto& feedback : report.SortedByReceiveTime()) {
+      if (feedback.sent_packet.pacing_info.probe_cluster_id !=
+          PacedPacketInfo::kNotAProbe) {
+        probe_bitrate_estimator_->HandleProbeAndEstimateBitrate(feedback);
+      }
     }
-  }
 
-  absl::optional<DataRate> probe_bitrate =
-      probe_bitrate_estimator_->FetchAndResetLastEstimatedBitrate();
-  if (fall_back_to_probe_rate_ && !acknowledged_bitrate)
-    acknowledged_bitrate = probe_bitrate_estimator_->last_estimate();
+    probe_bitrate =
+        probe_bitrate_estimator_->FetchAndResetLastEstimatedBitrate();
+    if (fall_back_to_probe_rate_ && !acknowledged_bitrate)
+      acknowledged_bitrate = probe_bitrate_estimator_->last_estimate();
+  }
   bandwidth_estimation_->SetAcknowledgedRate(acknowledged_bitrate,
                                              report.feedback_time);
   bandwidth_estimation_->IncomingPacketFeedbackVector(report);
@@ -533,12 +561,12 @@ NetworkControlUpdate GoogCcNetworkController::OnTransportPacketsFeedback(
   recovered_from_overuse = result.recovered_from_overuse;
   backoff_in_alr = result.backoff_in_alr;
 
-  if (recovered_from_overuse) {
+  if (probe_controller_ && recovered_from_overuse) {
     probe_controller_->SetAlrStartTimeMs(alr_start_time);
     auto probes = probe_controller_->RequestProbe(report.feedback_time.ms());
     update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
                                         probes.begin(), probes.end());
-  } else if (backoff_in_alr) {
+  } else if (probe_controller_ && backoff_in_alr) {
     // If we just backed off during ALR, request a new probe.
     auto probes = probe_controller_->RequestProbe(report.feedback_time.ms());
     update.probe_cluster_configs.insert(update.probe_cluster_configs.end(),
@@ -623,7 +651,8 @@ void GoogCcNetworkController::MaybeTriggerOnNetworkChanged(
     last_estimated_fraction_loss_ = fraction_loss;
     last_estimated_rtt_ms_ = rtt_ms;
 
-    alr_detector_->SetEstimatedBitrate(estimated_bitrate_bps);
+    if (alr_detector_)
+      alr_detector_->SetEstimatedBitrate(estimated_bitrate_bps);
 
     last_raw_target_rate_ = DataRate::bps(estimated_bitrate_bps);
 
@@ -642,10 +671,12 @@ void GoogCcNetworkController::MaybeTriggerOnNetworkChanged(
 
     update->target_rate = target_rate_msg;
 
-    auto probes = probe_controller_->SetEstimatedBitrate(
-        last_raw_target_rate_.bps(), at_time.ms());
-    update->probe_cluster_configs.insert(update->probe_cluster_configs.end(),
-                                         probes.begin(), probes.end());
+    if (probe_controller_) {
+      auto probes = probe_controller_->SetEstimatedBitrate(
+          last_raw_target_rate_.bps(), at_time.ms());
+      update->probe_cluster_configs.insert(update->probe_cluster_configs.end(),
+                                           probes.begin(), probes.end());
+    }
     update->pacer_config = GetPacingRates(at_time);
 
     RTC_LOG(LS_VERBOSE) << "bwe " << at_time.ms() << " pushback_target_bps="
@@ -42,6 +42,10 @@ struct GoogCcConfig {
   std::unique_ptr<NetworkStateEstimator> network_state_estimator = nullptr;
   std::unique_ptr<NetworkStatePredictor> network_state_predictor = nullptr;
   bool feedback_only = false;
+  // When set, the controller runs without probing and ALR detection state and
+  // relies on the loss and delay based estimators alone. See
+  // GoogCcFactoryConfig::lightweight.
+  bool lightweight = false;
 };
 
 class GoogCcNetworkController : public NetworkControllerInterface {
@@ -83,6 +87,7 @@ class GoogCcNetworkController : public NetworkControllerInterface {
   const WebRtcKeyValueConfig* const key_value_config_;
   RtcEventLog* const event_log_;
   const bool packet_feedback_only_;
+  const bool lightweight_;
   FieldTrialFlag safe_reset_on_route_change_;
   FieldTrialFlag safe_reset_acknowledged_rate_;
   const bool use_downlink_delay_for_congestion_window_;
@@ -90,6 +95,8 @@ class GoogCcNetworkController : public NetworkControllerInterface {
   const bool use_min_allocatable_as_lower_bound_;
   const RateControlSettings rate_control_settings_;
 
+  // Null in lightweight mode, together with |alr_detector_| and
+  // |probe_bitrate_estimator_|.
   const std::unique_ptr<ProbeController> probe_controller_;
   const std::unique_ptr<CongestionWindowPushbackController>
       congestion_window_pushback_controller_;
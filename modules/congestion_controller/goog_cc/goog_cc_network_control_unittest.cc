@@ -320,6 +320,28 @@ TEST_F(GoogCcNetworkControllerTest, ProbeOnRouteChange) {
   update = controller_->OnProcessInterval(DefaultInterval());
 }
 
+TEST_F(GoogCcNetworkControllerTest, LightweightModeGeneratesNoProbes) {
+  GoogCcFactoryConfig config;
+  config.lightweight = true;
+  GoogCcNetworkControllerFactory lightweight_factory(std::move(config));
+  controller_ = lightweight_factory.Create(InitialConfig());
+
+  NetworkControlUpdate update =
+      controller_->OnProcessInterval(DefaultInterval());
+  EXPECT_EQ(update.target_rate->target_rate, kInitialBitrate);
+  EXPECT_TRUE(update.probe_cluster_configs.empty());
+
+  update = controller_->OnNetworkRouteChange(
+      CreateRouteChange(2 * kInitialBitrate, DataRate::Zero(),
+                        20 * kInitialBitrate));
+  EXPECT_EQ(update.target_rate->target_rate, kInitialBitrate * 2);
+  EXPECT_TRUE(update.probe_cluster_configs.empty());
+
+  // The loss and delay based estimators still drive the target rate.
+  PacketTransmissionAndFeedbackBlock(1000, 0);
+  EXPECT_TRUE(target_bitrate_.has_value());
+}
+
 // Bandwidth estimation is updated when feedbacks are received.
 // Feedbacks which show an increasing delay cause the estimation to be reduced.
 TEST_F(GoogCcNetworkControllerTest, UpdatesDelayBasedEstimate) {
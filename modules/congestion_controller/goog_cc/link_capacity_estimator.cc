@@ -32,6 +32,7 @@ DataRate LinkCapacityEstimator::LowerBound() const {
 
 void LinkCapacityEstimator::Reset() {
   estimate_kbps_.reset();
+  cached_deviation_estimate_kbps_ = 0;
 }
 
 void LinkCapacityEstimator::OnOveruseDetected(DataRate acknowledged_rate) {
@@ -58,6 +59,7 @@ void LinkCapacityEstimator::Update(DataRate capacity_sample, double alpha) {
   // 0.4 ~= 14 kbit/s at 500 kbit/s
   // 2.5f ~= 35 kbit/s at 500 kbit/s
   deviation_kbps_ = rtc::SafeClamp(deviation_kbps_, 0.4f, 2.5f);
+  UpdateCachedDeviationEstimate();
 }
 
 bool LinkCapacityEstimator::has_estimate() const {
@@ -69,9 +71,14 @@ DataRate LinkCapacityEstimator::estimate() const {
 }
 
 double LinkCapacityEstimator::deviation_estimate_kbps() const {
+  return cached_deviation_estimate_kbps_;
+}
+
+void LinkCapacityEstimator::UpdateCachedDeviationEstimate() {
   // Calculate the max bit rate std dev given the normalized
   // variance and the current throughput bitrate. The standard deviation will
   // only be used if estimate_kbps_ has a value.
-  return sqrt(deviation_kbps_ * estimate_kbps_.value());
+  cached_deviation_estimate_kbps_ =
+      sqrt(deviation_kbps_ * estimate_kbps_.value());
 }
 }  // namespace webrtc
@@ -30,8 +30,12 @@ class LinkCapacityEstimator {
   void Update(DataRate capacity_sample, double alpha);
 
   double deviation_estimate_kbps() const;
+  void UpdateCachedDeviationEstimate();
   absl::optional<double> estimate_kbps_;
   double deviation_kbps_ = 0.4;
+  // Standard deviation of the estimate, recomputed when the estimate changes
+  // so that UpperBound()/LowerBound() stay free of transcendental math.
+  double cached_deviation_estimate_kbps_ = 0;
 };
 }  // namespace webrtc
 
@@ -68,30 +68,6 @@ size_t ReadTrendlineFilterWindowSize(
   return kDefaultTrendlineWindowSize;
 }
 
-absl::optional<double> LinearFitSlope(
-    const std::deque<std::pair<double, double>>& points) {
-  RTC_DCHECK(points.size() >= 2);
-  // Compute the "center of mass".
-  double sum_x = 0;
-  double sum_y = 0;
-  for (const auto& point : points) {
-    sum_x += point.first;
-    sum_y += point.second;
-  }
-  double x_avg = sum_x / points.size();
-  double y_avg = sum_y / points.size();
-  // Compute the slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2
-  double numerator = 0;
-  double denominator = 0;
-  for (const auto& point : points) {
-    numerator += (point.first - x_avg) * (point.second - y_avg);
-    denominator += (point.first - x_avg) * (point.first - x_avg);
-  }
-  if (denominator == 0)
-    return absl::nullopt;
-  return numerator / denominator;
-}
-
 constexpr double kMaxAdaptOffsetMs = 15.0;
 constexpr double kOverUsingTimeThreshold = 10;
 constexpr int kMinNumDeltas = 60;
@@ -114,7 +90,13 @@ TrendlineEstimator::TrendlineEstimator(
       first_arrival_time_ms_(-1),
       accumulated_delay_(0),
       smoothed_delay_(0),
-      delay_hist_(),
+      delay_hist_(window_size_),
+      delay_hist_first_(0),
+      delay_hist_size_(0),
+      sum_x_(0),
+      sum_y_(0),
+      sum_xx_(0),
+      sum_xy_(0),
       k_up_(0.0087),
       k_down_(0.039),
       overusing_time_threshold_(kOverUsingTimeThreshold),
@@ -173,19 +155,16 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
                         smoothed_delay_);
 
   // Simple linear regression.
-  delay_hist_.push_back(std::make_pair(
-      static_cast<double>(arrival_time_ms - first_arrival_time_ms_),
-      smoothed_delay_));
-  if (delay_hist_.size() > window_size_)
-    delay_hist_.pop_front();
+  AddDelaySample(static_cast<double>(arrival_time_ms - first_arrival_time_ms_),
+                 smoothed_delay_);
   double trend = prev_trend_;
-  if (delay_hist_.size() == window_size_) {
+  if (delay_hist_size_ == window_size_) {
     // Update trend_ if it is possible to fit a line to the data. The delay
     // trend can be seen as an estimate of (send_rate - capacity)/capacity.
     // 0 < trend < 1   ->  the delay increases, queues are filling up
     //   trend == 0    ->  the delay does not change
     //   trend < 0     ->  the delay decreases, queues are being emptied
-    trend = LinearFitSlope(delay_hist_).value_or(trend);
+    trend = LinearFitSlope().value_or(trend);
   }
   BWE_TEST_LOGGING_PLOT(1, "trendline_slope", arrival_time_ms, trend);
 
@@ -212,6 +191,69 @@ BandwidthUsage TrendlineEstimator::State() const {
   return network_state_predictor_ ? hypothesis_predicted_ : hypothesis_;
 }
 
+void TrendlineEstimator::AddDelaySample(double arrival_time_ms,
+                                        double smoothed_delay_ms) {
+  if (delay_hist_size_ == window_size_) {
+    // Evict the oldest point. Its x value relative to the base is zero, so
+    // only the y sum changes.
+    const double old_base = delay_hist_[delay_hist_first_].first;
+    sum_y_ -= delay_hist_[delay_hist_first_].second;
+    delay_hist_first_ = (delay_hist_first_ + 1) % window_size_;
+    --delay_hist_size_;
+    // Re-anchor the base on the point that is now the oldest: all relative x
+    // values decrease by |shift|.
+    const double shift = delay_hist_[delay_hist_first_].first - old_base;
+    const double n = delay_hist_size_;
+    sum_xx_ += shift * (n * shift - 2 * sum_x_);
+    sum_xy_ -= shift * sum_y_;
+    sum_x_ -= n * shift;
+  }
+
+  const size_t slot = (delay_hist_first_ + delay_hist_size_) % window_size_;
+  delay_hist_[slot] = std::make_pair(arrival_time_ms, smoothed_delay_ms);
+  ++delay_hist_size_;
+  const double x = arrival_time_ms - delay_hist_[delay_hist_first_].first;
+  sum_x_ += x;
+  sum_y_ += smoothed_delay_ms;
+  sum_xx_ += x * x;
+  sum_xy_ += x * smoothed_delay_ms;
+
+  if (slot + 1 == window_size_) {
+    // The incremental updates above can accumulate rounding drift over very
+    // long runs. Recompute the sums exactly once per lap around the ring,
+    // keeping the amortized cost per sample constant.
+    RecomputeRegressionSums();
+  }
+}
+
+void TrendlineEstimator::RecomputeRegressionSums() {
+  sum_x_ = 0;
+  sum_y_ = 0;
+  sum_xx_ = 0;
+  sum_xy_ = 0;
+  const double base = delay_hist_[delay_hist_first_].first;
+  for (size_t i = 0; i < delay_hist_size_; ++i) {
+    const std::pair<double, double>& point =
+        delay_hist_[(delay_hist_first_ + i) % window_size_];
+    const double x = point.first - base;
+    sum_x_ += x;
+    sum_y_ += point.second;
+    sum_xx_ += x * x;
+    sum_xy_ += x * point.second;
+  }
+}
+
+absl::optional<double> TrendlineEstimator::LinearFitSlope() const {
+  RTC_DCHECK_GE(delay_hist_size_, 2);
+  // The slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2, expressed
+  // in terms of the running sums.
+  const double n = delay_hist_size_;
+  const double denominator = n * sum_xx_ - sum_x_ * sum_x_;
+  if (denominator <= 0)
+    return absl::nullopt;
+  return (n * sum_xy_ - sum_x_ * sum_y_) / denominator;
+}
+
 void TrendlineEstimator::Detect(double trend, double ts_delta, int64_t now_ms) {
   if (num_of_deltas_ < 2) {
     hypothesis_ = BandwidthUsage::kBwNormal;
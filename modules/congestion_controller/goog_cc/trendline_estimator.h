@@ -13,10 +13,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <deque>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "absl/types/optional.h"
 #include "api/network_state_predictor.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "modules/congestion_controller/goog_cc/delay_increase_detector_interface.h"
@@ -72,6 +73,17 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
 
   void UpdateThreshold(double modified_offset, int64_t now_ms);
 
+  // Appends a (arrival time, smoothed delay) point to the history, evicting
+  // the oldest point if the window is full, and updates the regression sums
+  // incrementally.
+  void AddDelaySample(double arrival_time_ms, double smoothed_delay_ms);
+  // Recomputes the regression sums from the history, re-anchoring the x
+  // values on the oldest point.
+  void RecomputeRegressionSums();
+  // The least squares slope of the points in the history, computed from the
+  // running sums. Empty if the slope is undefined (all x values equal).
+  absl::optional<double> LinearFitSlope() const;
+
   // Filtering out small packets. (Intention is to base the detection only
   // on video packets even if we have TWCC sequence number for audio.)
   BweIgnoreSmallPacketsSettings ignore_small_packets_;
@@ -89,7 +101,19 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
   double accumulated_delay_;
   double smoothed_delay_;
   // Linear least squares regression.
-  std::deque<std::pair<double, double>> delay_hist_;
+  // History of (arrival time, smoothed delay) points, kept in a preallocated
+  // ring buffer of |window_size_| entries. |delay_hist_first_| indexes the
+  // oldest point and |delay_hist_size_| is the number of valid points.
+  std::vector<std::pair<double, double>> delay_hist_;
+  size_t delay_hist_first_;
+  size_t delay_hist_size_;
+  // Running sums over the points in the history, with x values taken relative
+  // to the oldest point to keep the arithmetic well conditioned. Maintained
+  // incrementally so the slope is an O(1) computation per update.
+  double sum_x_;
+  double sum_y_;
+  double sum_xx_;
+  double sum_xy_;
 
   const double k_up_;
   const double k_down_;
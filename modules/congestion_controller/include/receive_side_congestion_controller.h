@@ -19,6 +19,7 @@
 #include "modules/remote_bitrate_estimator/remote_estimator_proxy.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/critical_section.h"
+#include "rtc_base/synchronization/spin_mutex.h"
 
 namespace webrtc {
 class RemoteBitrateEstimator;
@@ -81,6 +82,14 @@ class ReceiveSideCongestionController : public CallStatsObserver,
     void SetMinBitrate(int min_bitrate_bps) override;
 
    private:
+    struct PacketSample {
+      int64_t arrival_time_ms;
+      size_t payload_size;
+      RTPHeader header;
+    };
+
+    // Runs all batched samples through the wrapped estimator.
+    void FlushPendingPackets();
     void PickEstimatorFromHeader(const RTPHeader& header)
         RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
     void PickEstimator() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
@@ -91,6 +100,12 @@ class ReceiveSideCongestionController : public CallStatsObserver,
     bool using_absolute_send_time_;
     uint32_t packets_since_absolute_send_time_;
     int min_bitrate_bps_;
+    // Incoming packets are recorded under this lightweight lock and run
+    // through the estimator in batches, so the per-packet fast path never
+    // contends with the estimator's clustering math under |crit_sect_|.
+    rtc::SpinMutex samples_mutex_;
+    std::vector<PacketSample> pending_samples_ RTC_GUARDED_BY(samples_mutex_);
+    std::vector<PacketSample> flushing_samples_ RTC_GUARDED_BY(crit_sect_);
 
     RTC_DISALLOW_IMPLICIT_CONSTRUCTORS(WrappingBitrateEstimator);
   };
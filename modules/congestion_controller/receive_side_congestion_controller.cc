@@ -10,6 +10,8 @@
 
 #include "modules/congestion_controller/include/receive_side_congestion_controller.h"
 
+#include <algorithm>
+
 #include "modules/pacing/packet_router.h"
 #include "modules/remote_bitrate_estimator/include/bwe_defines.h"
 #include "modules/remote_bitrate_estimator/remote_bitrate_estimator_abs_send_time.h"
@@ -20,6 +22,11 @@ namespace webrtc {
 
 namespace {
 static const uint32_t kTimeOffsetSwitchThreshold = 30;
+// Incoming packets are batched and run through the estimator on this cadence
+// (or sooner if the batch fills up), so per-packet cost is just recording a
+// sample.
+constexpr int64_t kPacketBatchWindowMs = 5;
+constexpr size_t kMaxBatchedPackets = 128;
 }  // namespace
 
 ReceiveSideCongestionController::WrappingBitrateEstimator::
@@ -38,20 +45,54 @@ void ReceiveSideCongestionController::WrappingBitrateEstimator::IncomingPacket(
     int64_t arrival_time_ms,
     size_t payload_size,
     const RTPHeader& header) {
+  bool flush;
+  {
+    rtc::SpinMutexLock lock(&samples_mutex_);
+    pending_samples_.push_back({arrival_time_ms, payload_size, header});
+    // Flush inline once the batch window has passed or the batch is full; at
+    // low packet rates this degenerates to per-packet processing, where lock
+    // contention is not a concern anyway.
+    flush = pending_samples_.size() >= kMaxBatchedPackets ||
+            arrival_time_ms - pending_samples_.front().arrival_time_ms >=
+                kPacketBatchWindowMs;
+  }
+  if (flush)
+    FlushPendingPackets();
+}
+
+void ReceiveSideCongestionController::WrappingBitrateEstimator::
+    FlushPendingPackets() {
   rtc::CritScope cs(&crit_sect_);
-  PickEstimatorFromHeader(header);
-  rbe_->IncomingPacket(arrival_time_ms, payload_size, header);
+  {
+    rtc::SpinMutexLock lock(&samples_mutex_);
+    pending_samples_.swap(flushing_samples_);
+  }
+  for (const PacketSample& sample : flushing_samples_) {
+    PickEstimatorFromHeader(sample.header);
+    rbe_->IncomingPacket(sample.arrival_time_ms, sample.payload_size,
+                         sample.header);
+  }
+  flushing_samples_.clear();
 }
 
 void ReceiveSideCongestionController::WrappingBitrateEstimator::Process() {
+  FlushPendingPackets();
   rtc::CritScope cs(&crit_sect_);
   rbe_->Process();
 }
 
 int64_t ReceiveSideCongestionController::WrappingBitrateEstimator::
     TimeUntilNextProcess() {
+  bool have_pending_samples;
+  {
+    rtc::SpinMutexLock lock(&samples_mutex_);
+    have_pending_samples = !pending_samples_.empty();
+  }
   rtc::CritScope cs(&crit_sect_);
-  return rbe_->TimeUntilNextProcess();
+  int64_t time_until_next_process = rbe_->TimeUntilNextProcess();
+  return have_pending_samples
+             ? std::min(kPacketBatchWindowMs, time_until_next_process)
+             : time_until_next_process;
 }
 
 void ReceiveSideCongestionController::WrappingBitrateEstimator::OnRttUpdate(
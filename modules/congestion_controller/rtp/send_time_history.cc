@@ -19,25 +19,70 @@
 
 namespace webrtc {
 
+constexpr size_t SendTimeHistory::kHistoryCapacity;
+
 SendTimeHistory::SendTimeHistory(int64_t packet_age_limit_ms)
-    : packet_age_limit_ms_(packet_age_limit_ms) {}
+    : packet_age_limit_ms_(packet_age_limit_ms),
+      history_(kHistoryCapacity),
+      history_begin_seq_(0),
+      history_end_seq_(0) {}
 
 SendTimeHistory::~SendTimeHistory() {}
 
+PacketFeedback* SendTimeHistory::FindEntry(int64_t unwrapped_seq_num) {
+  absl::optional<PacketFeedback>& slot =
+      history_[unwrapped_seq_num & (kHistoryCapacity - 1)];
+  if (slot && slot->long_sequence_number == unwrapped_seq_num)
+    return &*slot;
+  return nullptr;
+}
+
+const PacketFeedback* SendTimeHistory::FindEntry(
+    int64_t unwrapped_seq_num) const {
+  const absl::optional<PacketFeedback>& slot =
+      history_[unwrapped_seq_num & (kHistoryCapacity - 1)];
+  if (slot && slot->long_sequence_number == unwrapped_seq_num)
+    return &*slot;
+  return nullptr;
+}
+
 void SendTimeHistory::RemoveOld(int64_t at_time_ms) {
-  while (!history_.empty() &&
-         at_time_ms - history_.begin()->second.creation_time_ms >
-             packet_age_limit_ms_) {
-    // TODO(sprang): Warn if erasing (too many) old items?
-    RemovePacketBytes(history_.begin()->second);
-    history_.erase(history_.begin());
+  while (history_begin_seq_ < history_end_seq_) {
+    PacketFeedback* oldest = FindEntry(history_begin_seq_);
+    if (oldest) {
+      if (at_time_ms - oldest->creation_time_ms <= packet_age_limit_ms_)
+        break;
+      // TODO(sprang): Warn if erasing (too many) old items?
+      RemovePacketBytes(*oldest);
+      history_[history_begin_seq_ & (kHistoryCapacity - 1)].reset();
+    }
+    ++history_begin_seq_;
   }
 }
 
 void SendTimeHistory::AddNewPacket(PacketFeedback packet) {
   packet.long_sequence_number =
       seq_num_unwrapper_.Unwrap(packet.sequence_number);
-  history_.insert(std::make_pair(packet.long_sequence_number, packet));
+  const int64_t seq_num = packet.long_sequence_number;
+  if (history_begin_seq_ == history_end_seq_) {
+    history_begin_seq_ = seq_num;
+    history_end_seq_ = seq_num + 1;
+  } else {
+    history_begin_seq_ = std::min(history_begin_seq_, seq_num);
+    history_end_seq_ = std::max(history_end_seq_, seq_num + 1);
+    // Evict the oldest entries if the tracked span outgrows the array. Any
+    // slot collision after this is with an already evicted sequence number.
+    while (history_end_seq_ - history_begin_seq_ >
+           static_cast<int64_t>(kHistoryCapacity)) {
+      PacketFeedback* oldest = FindEntry(history_begin_seq_);
+      if (oldest) {
+        RemovePacketBytes(*oldest);
+        history_[history_begin_seq_ & (kHistoryCapacity - 1)].reset();
+      }
+      ++history_begin_seq_;
+    }
+  }
+  history_[seq_num & (kHistoryCapacity - 1)] = packet;
   if (packet.send_time_ms >= 0) {
     AddPacketBytes(packet);
     last_send_time_ms_ = std::max(last_send_time_ms_, packet.send_time_ms);
@@ -56,20 +101,20 @@ void SendTimeHistory::AddUntracked(size_t packet_size, int64_t send_time_ms) {
 SendTimeHistory::Status SendTimeHistory::OnSentPacket(uint16_t sequence_number,
                                                       int64_t send_time_ms) {
   int64_t unwrapped_seq_num = seq_num_unwrapper_.Unwrap(sequence_number);
-  auto it = history_.find(unwrapped_seq_num);
-  if (it == history_.end())
+  PacketFeedback* entry = FindEntry(unwrapped_seq_num);
+  if (entry == nullptr)
     return Status::kNotAdded;
-  bool packet_retransmit = it->second.send_time_ms >= 0;
-  it->second.send_time_ms = send_time_ms;
+  bool packet_retransmit = entry->send_time_ms >= 0;
+  entry->send_time_ms = send_time_ms;
   last_send_time_ms_ = std::max(last_send_time_ms_, send_time_ms);
   if (!packet_retransmit)
-    AddPacketBytes(it->second);
+    AddPacketBytes(*entry);
   if (pending_untracked_size_ > 0) {
     if (send_time_ms < last_untracked_send_time_ms_)
       RTC_LOG(LS_WARNING)
           << "appending acknowledged data for out of order packet. (Diff: "
           << last_untracked_send_time_ms_ - send_time_ms << " ms.)";
-    it->second.unacknowledged_data += pending_untracked_size_;
+    entry->unacknowledged_data += pending_untracked_size_;
     pending_untracked_size_ = 0;
   }
   return packet_retransmit ? Status::kDuplicate : Status::kOk;
@@ -80,9 +125,9 @@ absl::optional<PacketFeedback> SendTimeHistory::GetPacket(
   int64_t unwrapped_seq_num =
       seq_num_unwrapper_.UnwrapWithoutUpdate(sequence_number);
   absl::optional<PacketFeedback> optional_feedback;
-  auto it = history_.find(unwrapped_seq_num);
-  if (it != history_.end())
-    optional_feedback.emplace(it->second);
+  const PacketFeedback* entry = FindEntry(unwrapped_seq_num);
+  if (entry != nullptr)
+    optional_feedback.emplace(*entry);
   return optional_feedback;
 }
 
@@ -93,17 +138,17 @@ bool SendTimeHistory::GetFeedback(PacketFeedback* packet_feedback,
       seq_num_unwrapper_.Unwrap(packet_feedback->sequence_number);
   UpdateAckedSeqNum(unwrapped_seq_num);
   RTC_DCHECK_GE(*last_ack_seq_num_, 0);
-  auto it = history_.find(unwrapped_seq_num);
-  if (it == history_.end())
+  PacketFeedback* entry = FindEntry(unwrapped_seq_num);
+  if (entry == nullptr)
     return false;
 
   // Save arrival_time not to overwrite it.
   int64_t arrival_time_ms = packet_feedback->arrival_time_ms;
-  *packet_feedback = it->second;
+  *packet_feedback = *entry;
   packet_feedback->arrival_time_ms = arrival_time_ms;
 
   if (remove)
-    history_.erase(it);
+    history_[unwrapped_seq_num & (kHistoryCapacity - 1)].reset();
   return true;
 }
 
@@ -120,11 +165,10 @@ DataSize SendTimeHistory::GetOutstandingData(uint16_t local_net_id,
 absl::optional<int64_t> SendTimeHistory::GetFirstUnackedSendTime() const {
   if (!last_ack_seq_num_)
     return absl::nullopt;
-  auto it = history_.find(*last_ack_seq_num_);
-  if (it == history_.end() ||
-      it->second.send_time_ms == PacketFeedback::kNoSendTime)
+  const PacketFeedback* entry = FindEntry(*last_ack_seq_num_);
+  if (entry == nullptr || entry->send_time_ms == PacketFeedback::kNoSendTime)
     return absl::nullopt;
-  return it->second.send_time_ms;
+  return entry->send_time_ms;
 }
 
 void SendTimeHistory::AddPacketBytes(const PacketFeedback& packet) {
@@ -156,13 +200,14 @@ void SendTimeHistory::UpdateAckedSeqNum(int64_t acked_seq_num) {
   if (last_ack_seq_num_ && *last_ack_seq_num_ >= acked_seq_num)
     return;
 
-  auto unacked_it = history_.begin();
+  int64_t start_seq = history_begin_seq_;
   if (last_ack_seq_num_)
-    unacked_it = history_.lower_bound(*last_ack_seq_num_);
-
-  auto newly_acked_end = history_.upper_bound(acked_seq_num);
-  for (; unacked_it != newly_acked_end; ++unacked_it) {
-    RemovePacketBytes(unacked_it->second);
+    start_seq = std::max(start_seq, *last_ack_seq_num_);
+  const int64_t end_seq = std::min(acked_seq_num + 1, history_end_seq_);
+  for (int64_t seq_num = start_seq; seq_num < end_seq; ++seq_num) {
+    PacketFeedback* entry = FindEntry(seq_num);
+    if (entry)
+      RemovePacketBytes(*entry);
   }
   last_ack_seq_num_.emplace(acked_seq_num);
 }
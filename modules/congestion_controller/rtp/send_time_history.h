@@ -13,7 +13,9 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 
+#include "absl/types/optional.h"
 #include "api/units/data_size.h"
 #include "modules/include/module_common_types.h"
 #include "rtc_base/constructor_magic.h"
@@ -55,15 +57,34 @@ class SendTimeHistory {
  private:
   using RemoteAndLocalNetworkId = std::pair<uint16_t, uint16_t>;
 
+  // Maximum number of tracked packets. Must be a power of two. The transport
+  // feedback window is far smaller than this in practice; if the span of
+  // tracked sequence numbers outgrows the array, the oldest entries are
+  // evicted.
+  static constexpr size_t kHistoryCapacity = 4096;
+  static_assert((kHistoryCapacity & (kHistoryCapacity - 1)) == 0,
+                "kHistoryCapacity must be a power of two.");
+
   void AddPacketBytes(const PacketFeedback& packet);
   void RemovePacketBytes(const PacketFeedback& packet);
   void UpdateAckedSeqNum(int64_t acked_seq_num);
+  // Returns the tracked packet with the given unwrapped sequence number, or
+  // null if it is not in the history.
+  PacketFeedback* FindEntry(int64_t unwrapped_seq_num);
+  const PacketFeedback* FindEntry(int64_t unwrapped_seq_num) const;
+
   const int64_t packet_age_limit_ms_;
   size_t pending_untracked_size_ = 0;
   int64_t last_send_time_ms_ = -1;
   int64_t last_untracked_send_time_ms_ = -1;
   SequenceNumberUnwrapper seq_num_unwrapper_;
-  std::map<int64_t, PacketFeedback> history_;
+  // History of sent packets in a preallocated circular array indexed by
+  // unwrapped sequence number, making insertion and lookup allocation-free
+  // O(1). [history_begin_seq_, history_end_seq_) spans the tracked packets;
+  // slots within the span may be empty after feedback removal.
+  std::vector<absl::optional<PacketFeedback>> history_;
+  int64_t history_begin_seq_;
+  int64_t history_end_seq_;
   absl::optional<int64_t> last_ack_seq_num_;
   std::map<RemoteAndLocalNetworkId, size_t> in_flight_bytes_;
 
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/desktop_capture/desktop_frame_pool.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/ref_count.h"
+#include "rtc_base/ref_counted_object.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+namespace {
+
+// Capture pipelines typically keep a frame being filled, a frame being
+// encoded and possibly a frame queued in between alive at once, so a few
+// spare buffers cover steady state; anything beyond that (e.g. after a
+// resolution change) is better freed than kept around.
+constexpr size_t kMaxPooledFrames = 4;
+
+}  // namespace
+
+// State shared between the pool and the frames it has handed out. Outlives
+// the pool while any such frame is alive.
+class DesktopFramePool::Storage : public rtc::RefCountInterface {
+ public:
+  explicit Storage(std::unique_ptr<SharedMemoryFactory> shared_memory_factory)
+      : shared_memory_factory_(std::move(shared_memory_factory)) {}
+
+  std::unique_ptr<DesktopFrame> TakeFrame(DesktopSize size) {
+    rtc::CritScope lock(&lock_);
+    for (auto it = idle_frames_.begin(); it != idle_frames_.end(); ++it) {
+      if ((*it)->size().equals(size)) {
+        std::unique_ptr<DesktopFrame> frame = std::move(*it);
+        idle_frames_.erase(it);
+        return frame;
+      }
+    }
+    return nullptr;
+  }
+
+  void ReturnFrame(std::unique_ptr<DesktopFrame> frame) {
+    rtc::CritScope lock(&lock_);
+    if (pool_destroyed_ || idle_frames_.size() >= kMaxPooledFrames)
+      return;
+    idle_frames_.push_back(std::move(frame));
+  }
+
+  // Called by the pool destructor; frees idle buffers eagerly and makes
+  // later returns from in-flight frames free their buffer instead.
+  void OnPoolDestroyed() {
+    rtc::CritScope lock(&lock_);
+    pool_destroyed_ = true;
+    idle_frames_.clear();
+  }
+
+  size_t idle_frame_count() const {
+    rtc::CritScope lock(&lock_);
+    return idle_frames_.size();
+  }
+
+  SharedMemoryFactory* shared_memory_factory() {
+    return shared_memory_factory_.get();
+  }
+
+ private:
+  rtc::CriticalSection lock_;
+  std::vector<std::unique_ptr<DesktopFrame>> idle_frames_
+      RTC_GUARDED_BY(lock_);
+  bool pool_destroyed_ RTC_GUARDED_BY(lock_) = false;
+  const std::unique_ptr<SharedMemoryFactory> shared_memory_factory_;
+};
+
+// Wraps a recyclable frame; hands the underlying frame back to the pool
+// storage on destruction.
+class DesktopFramePool::PooledDesktopFrame : public DesktopFrame {
+ public:
+  PooledDesktopFrame(std::unique_ptr<DesktopFrame> frame,
+                     rtc::scoped_refptr<Storage> storage)
+      : DesktopFrame(frame->size(),
+                     frame->stride(),
+                     frame->data(),
+                     frame->shared_memory()),
+        frame_(std::move(frame)),
+        storage_(std::move(storage)) {}
+
+  ~PooledDesktopFrame() override {
+    // A pooled frame carries no pixel state over to its next user, but the
+    // metadata object is reused, so reset what previous users may have set.
+    frame_->mutable_updated_region()->Clear();
+    storage_->ReturnFrame(std::move(frame_));
+  }
+
+ private:
+  std::unique_ptr<DesktopFrame> frame_;
+  const rtc::scoped_refptr<Storage> storage_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(PooledDesktopFrame);
+};
+
+DesktopFramePool::DesktopFramePool() : DesktopFramePool(nullptr) {}
+
+DesktopFramePool::DesktopFramePool(
+    std::unique_ptr<SharedMemoryFactory> shared_memory_factory)
+    : storage_(new rtc::RefCountedObject<Storage>(
+          std::move(shared_memory_factory))) {}
+
+DesktopFramePool::~DesktopFramePool() {
+  storage_->OnPoolDestroyed();
+}
+
+std::unique_ptr<DesktopFrame> DesktopFramePool::AcquireFrame(
+    DesktopSize size) {
+  std::unique_ptr<DesktopFrame> frame = storage_->TakeFrame(size);
+  if (!frame) {
+    if (storage_->shared_memory_factory()) {
+      frame = SharedMemoryDesktopFrame::Create(
+          size, storage_->shared_memory_factory());
+      if (!frame)
+        return nullptr;
+    } else {
+      frame = absl::make_unique<BasicDesktopFrame>(size);
+    }
+  }
+  return absl::make_unique<PooledDesktopFrame>(std::move(frame), storage_);
+}
+
+size_t DesktopFramePool::pooled_frames() const {
+  return storage_->idle_frame_count();
+}
+
+}  // namespace webrtc
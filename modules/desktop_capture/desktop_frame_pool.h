@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_POOL_H_
+#define MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_POOL_H_
+
+#include <memory>
+
+#include "api/scoped_refptr.h"
+#include "modules/desktop_capture/desktop_frame.h"
+#include "modules/desktop_capture/desktop_geometry.h"
+#include "modules/desktop_capture/shared_memory.h"
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Recycles DesktopFrame buffers between captures, so that the capture path
+// does not allocate (and, for heap frames, zero) width*height*4 bytes per
+// frame. Frames handed out by the pool return their buffer when destroyed and
+// may safely outlive the pool itself; buffers returned after the pool is gone
+// are simply freed.
+//
+// When a SharedMemoryFactory is provided, pooled frames are backed by shared
+// memory created through it, so consumers which support shared memory (see
+// DesktopCapturer::SetSharedMemoryFactory()) can pass the captured pixels
+// across process or component boundaries without a copy.
+//
+// This class is thread-safe: frames may be released on a different thread
+// than the one calling AcquireFrame(), which is the common case when frames
+// are handed to an encoder.
+class RTC_EXPORT DesktopFramePool {
+ public:
+  DesktopFramePool();
+  // |shared_memory_factory| may be nullptr, in which case frames are
+  // allocated on the heap.
+  explicit DesktopFramePool(
+      std::unique_ptr<SharedMemoryFactory> shared_memory_factory);
+  ~DesktopFramePool();
+
+  // Returns a frame of |size|, reusing a pooled buffer when one of matching
+  // size is available. The frame contents are undefined; callers are expected
+  // to overwrite them. May return nullptr if the SharedMemoryFactory failed
+  // to create a buffer.
+  std::unique_ptr<DesktopFrame> AcquireFrame(DesktopSize size);
+
+  // Number of idle frames currently held by the pool. Exposed for tests.
+  size_t pooled_frames() const;
+
+ private:
+  class Storage;
+  class PooledDesktopFrame;
+
+  // Shared with the frames handed out by AcquireFrame(), so the pool can be
+  // destroyed while frames are still in flight.
+  const rtc::scoped_refptr<Storage> storage_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(DesktopFramePool);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_POOL_H_
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/desktop_capture/desktop_frame_pool.h"
+
+#include <string.h>
+
+#include <memory>
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "modules/desktop_capture/desktop_geometry.h"
+#include "modules/desktop_capture/shared_memory.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+class FakeSharedMemory : public SharedMemory {
+ public:
+  explicit FakeSharedMemory(size_t size)
+      : SharedMemory(new char[size], size, 0, next_id_++) {}
+  ~FakeSharedMemory() override { delete[] static_cast<char*>(data_); }
+
+ private:
+  static int next_id_;
+};
+
+// static
+int FakeSharedMemory::next_id_ = 0;
+
+class FakeSharedMemoryFactory : public SharedMemoryFactory {
+ public:
+  std::unique_ptr<SharedMemory> CreateSharedMemory(size_t size) override {
+    return absl::make_unique<FakeSharedMemory>(size);
+  }
+};
+
+}  // namespace
+
+TEST(DesktopFramePoolTest, ReusesReturnedFrameOfSameSize) {
+  DesktopFramePool pool;
+  std::unique_ptr<DesktopFrame> frame =
+      pool.AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  const uint8_t* data = frame->data();
+  ASSERT_EQ(0u, pool.pooled_frames());
+
+  frame.reset();
+  ASSERT_EQ(1u, pool.pooled_frames());
+
+  frame = pool.AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  ASSERT_EQ(data, frame->data());
+  ASSERT_EQ(0u, pool.pooled_frames());
+}
+
+TEST(DesktopFramePoolTest, DoesNotReuseFrameOfDifferentSize) {
+  DesktopFramePool pool;
+  std::unique_ptr<DesktopFrame> frame =
+      pool.AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  frame.reset();
+  ASSERT_EQ(1u, pool.pooled_frames());
+
+  frame = pool.AcquireFrame(DesktopSize(200, 100));
+  ASSERT_TRUE(frame);
+  ASSERT_TRUE(frame->size().equals(DesktopSize(200, 100)));
+  // The frame of the old size is still pooled.
+  ASSERT_EQ(1u, pool.pooled_frames());
+}
+
+TEST(DesktopFramePoolTest, ClearsFrameMetadataOnReuse) {
+  DesktopFramePool pool;
+  std::unique_ptr<DesktopFrame> frame = pool.AcquireFrame(DesktopSize(64, 64));
+  ASSERT_TRUE(frame);
+  frame->mutable_updated_region()->SetRect(DesktopRect::MakeWH(32, 32));
+  frame.reset();
+
+  frame = pool.AcquireFrame(DesktopSize(64, 64));
+  ASSERT_TRUE(frame);
+  ASSERT_TRUE(frame->updated_region().is_empty());
+}
+
+TEST(DesktopFramePoolTest, UsesSharedMemoryFactory) {
+  DesktopFramePool pool(absl::make_unique<FakeSharedMemoryFactory>());
+  std::unique_ptr<DesktopFrame> frame =
+      pool.AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  ASSERT_TRUE(frame->shared_memory());
+  const int id = frame->shared_memory()->id();
+
+  frame.reset();
+  frame = pool.AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  ASSERT_TRUE(frame->shared_memory());
+  ASSERT_EQ(id, frame->shared_memory()->id());
+}
+
+TEST(DesktopFramePoolTest, FramesMayOutliveThePool) {
+  auto pool = absl::make_unique<DesktopFramePool>();
+  std::unique_ptr<DesktopFrame> frame =
+      pool->AcquireFrame(DesktopSize(100, 200));
+  ASSERT_TRUE(frame);
+  pool.reset();
+  // The frame is still usable, and releasing it must not crash.
+  memset(frame->data(), 0, frame->stride() * frame->size().height());
+  frame.reset();
+}
+
+}  // namespace webrtc
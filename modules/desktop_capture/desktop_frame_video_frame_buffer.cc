@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/desktop_capture/desktop_frame_video_frame_buffer.h"
+
+#include <utility>
+
+#include "api/video/i420_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/ref_counted_object.h"
+#include "third_party/libyuv/include/libyuv/convert.h"
+
+namespace webrtc {
+
+rtc::scoped_refptr<DesktopFrameVideoFrameBuffer>
+DesktopFrameVideoFrameBuffer::Create(std::unique_ptr<DesktopFrame> frame) {
+  RTC_DCHECK(frame);
+  return new rtc::RefCountedObject<DesktopFrameVideoFrameBuffer>(
+      std::move(frame));
+}
+
+DesktopFrameVideoFrameBuffer::DesktopFrameVideoFrameBuffer(
+    std::unique_ptr<DesktopFrame> frame)
+    : frame_(std::move(frame)) {}
+
+DesktopFrameVideoFrameBuffer::~DesktopFrameVideoFrameBuffer() = default;
+
+VideoFrameBuffer::Type DesktopFrameVideoFrameBuffer::type() const {
+  return Type::kNative;
+}
+
+int DesktopFrameVideoFrameBuffer::width() const {
+  return frame_->size().width();
+}
+
+int DesktopFrameVideoFrameBuffer::height() const {
+  return frame_->size().height();
+}
+
+rtc::scoped_refptr<I420BufferInterface>
+DesktopFrameVideoFrameBuffer::ToI420() {
+  if (!i420_buffer_) {
+    rtc::scoped_refptr<I420Buffer> buffer =
+        I420Buffer::Create(width(), height());
+    // DesktopFrame always holds BGRA pixels, which is what libyuv calls ARGB
+    // (byte order B, G, R, A in memory).
+    libyuv::ARGBToI420(frame_->data(), frame_->stride(),
+                       buffer->MutableDataY(), buffer->StrideY(),
+                       buffer->MutableDataU(), buffer->StrideU(),
+                       buffer->MutableDataV(), buffer->StrideV(), width(),
+                       height());
+    i420_buffer_ = buffer;
+  }
+  return i420_buffer_;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_VIDEO_FRAME_BUFFER_H_
+#define MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_VIDEO_FRAME_BUFFER_H_
+
+#include <memory>
+
+#include "api/scoped_refptr.h"
+#include "api/video/video_frame_buffer.h"
+#include "modules/desktop_capture/desktop_frame.h"
+
+namespace webrtc {
+
+// A kNative VideoFrameBuffer backed by a DesktopFrame, so a captured frame
+// can enter the VideoFrame pipeline without copying its pixels. The BGRA to
+// I420 conversion is deferred until a consumer actually asks for I420 (e.g.
+// the software encoders); sinks that understand the native type can cast and
+// read the BGRA data directly.
+class DesktopFrameVideoFrameBuffer : public VideoFrameBuffer {
+ public:
+  // Takes ownership of |frame|, which must be non-null.
+  static rtc::scoped_refptr<DesktopFrameVideoFrameBuffer> Create(
+      std::unique_ptr<DesktopFrame> frame);
+
+  Type type() const override;
+  int width() const override;
+  int height() const override;
+
+  // Converts on first call and caches the result, so repeated consumers do
+  // not re-convert.
+  rtc::scoped_refptr<I420BufferInterface> ToI420() override;
+
+  // Access to the wrapped frame, e.g. for its updated region. Valid for the
+  // lifetime of this buffer.
+  const DesktopFrame& desktop_frame() const { return *frame_; }
+
+ protected:
+  explicit DesktopFrameVideoFrameBuffer(std::unique_ptr<DesktopFrame> frame);
+  ~DesktopFrameVideoFrameBuffer() override;
+
+ private:
+  const std::unique_ptr<DesktopFrame> frame_;
+  rtc::scoped_refptr<I420BufferInterface> i420_buffer_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_DESKTOP_CAPTURE_DESKTOP_FRAME_VIDEO_FRAME_BUFFER_H_
@@ -12,6 +12,7 @@
 
 #include <string.h>
 
+#include "modules/desktop_capture/differ_vector_avx2.h"
 #include "modules/desktop_capture/differ_vector_sse2.h"
 #include "rtc_base/system/arch.h"
 #include "system_wrappers/include/cpu_features_wrapper.h"
@@ -35,9 +36,14 @@ bool VectorDifference(const uint8_t* image1, const uint8_t* image2) {
     // TODO(hclam): Implement a NEON version.
     diff_proc = &VectorDifference_C;
 #else
+    bool have_avx2 = WebRtc_GetCPUInfo(kAVX2) != 0;
     bool have_sse2 = WebRtc_GetCPUInfo(kSSE2) != 0;
-    // For x86 processors, check if SSE2 is supported.
-    if (have_sse2 && kBlockSize == 32) {
+    // For x86 processors, pick the widest supported vector extension.
+    if (have_avx2 && kBlockSize == 32) {
+      diff_proc = &VectorDifference_AVX2_W32;
+    } else if (have_avx2 && kBlockSize == 16) {
+      diff_proc = &VectorDifference_AVX2_W16;
+    } else if (have_sse2 && kBlockSize == 32) {
       diff_proc = &VectorDifference_SSE2_W32;
     } else if (have_sse2 && kBlockSize == 16) {
       diff_proc = &VectorDifference_SSE2_W16;
@@ -54,6 +60,30 @@ bool BlockDifference(const uint8_t* image1,
                      const uint8_t* image2,
                      int height,
                      int stride) {
+  // Probe a few rows spread over the block first. A top-down scan needs to
+  // reach the first changed row before it can bail out, while the probe
+  // catches changes anywhere in the block within a handful of compares.
+  // Unchanged blocks still compare every row exactly once, since the second
+  // pass skips the probed rows.
+  const int kProbeInterval = 8;
+  if (height >= 2 * kProbeInterval) {
+    for (int i = kProbeInterval - 1; i < height; i += kProbeInterval) {
+      if (VectorDifference(image1 + i * stride, image2 + i * stride)) {
+        return true;
+      }
+    }
+    for (int i = 0; i < height; i++) {
+      if (i % kProbeInterval == kProbeInterval - 1) {
+        // Already compared in the probe pass.
+        continue;
+      }
+      if (VectorDifference(image1 + i * stride, image2 + i * stride)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   for (int i = 0; i < height; i++) {
     if (VectorDifference(image1, image2)) {
       return true;
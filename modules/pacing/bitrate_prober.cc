@@ -74,10 +74,6 @@ void BitrateProber::SetEnabled(bool enable) {
   }
 }
 
-bool BitrateProber::IsProbing() const {
-  return probing_state_ == ProbingState::kActive;
-}
-
 void BitrateProber::OnIncomingPacket(size_t packet_size) {
   // Don't initialize probing unless we have something large enough to start
   // probing.
@@ -112,6 +108,11 @@ void BitrateProber::CreateProbeCluster(int bitrate_bps,
   RTC_DCHECK_GE(cluster.pace_info.probe_cluster_min_bytes, 0);
   cluster.pace_info.send_bitrate_bps = bitrate_bps;
   cluster.pace_info.probe_cluster_id = cluster_id;
+  // Probe size is recommended based on the probe bitrate required. We choose
+  // a minimum of twice |min_probe_delta| interval to allow scheduling to be
+  // feasible.
+  cluster.recommended_probe_size = cluster.pace_info.send_bitrate_bps * 2 *
+                                   config_.min_probe_delta->ms() / (8 * 1000);
   clusters_.push(cluster);
 
   RTC_LOG(LS_INFO) << "Probe cluster (bitrate:min bytes:min packets): ("
@@ -149,13 +150,9 @@ PacedPacketInfo BitrateProber::CurrentCluster() const {
   return clusters_.front().pace_info;
 }
 
-// Probe size is recommended based on the probe bitrate required. We choose
-// a minimum of twice |kMinProbeDeltaMs| interval to allow scheduling to be
-// feasible.
 size_t BitrateProber::RecommendedMinProbeSize() const {
   RTC_DCHECK(!clusters_.empty());
-  return clusters_.front().pace_info.send_bitrate_bps * 2 *
-         config_.min_probe_delta->ms() / (8 * 1000);
+  return clusters_.front().recommended_probe_size;
 }
 
 void BitrateProber::ProbeSent(int64_t now_ms, size_t bytes) {
@@ -51,8 +51,9 @@ class BitrateProber {
 
   // Returns true if the prober is in a probing session, i.e., it currently
   // wants packets to be sent out according to the time returned by
-  // TimeUntilNextProbe().
-  bool IsProbing() const;
+  // TimeUntilNextProbe(). Inline since the pacer polls this on every process
+  // iteration, also when probing is idle.
+  bool IsProbing() const { return probing_state_ == ProbingState::kActive; }
 
   // Initializes a new probing session if the prober is allowed to probe. Does
   // not initialize the prober unless the packet size is large enough to probe
@@ -99,6 +100,10 @@ class BitrateProber {
   struct ProbeCluster {
     PacedPacketInfo pace_info;
 
+    // Probe size recommended for this cluster, precomputed at creation so
+    // that the per-iteration queries while probing don't redo the division.
+    size_t recommended_probe_size = 0;
+
     int sent_probes = 0;
     int sent_bytes = 0;
     int64_t time_created_ms = -1;
@@ -55,6 +55,15 @@ size_t IntervalBudget::bytes_remaining() const {
   return rtc::saturated_cast<size_t>(std::max<int64_t>(0, bytes_remaining_));
 }
 
+int64_t IntervalBudget::ms_until_budget_available() const {
+  if (bytes_remaining_ > 0)
+    return 0;
+  if (target_rate_kbps_ == 0)
+    return kWindowMs;
+  // IncreaseBudget() replenishes target_rate_kbps_ / 8 bytes per elapsed ms.
+  return std::min(kWindowMs, (-bytes_remaining_ * 8) / target_rate_kbps_ + 1);
+}
+
 double IntervalBudget::budget_ratio() const {
   if (max_bytes_in_budget_ == 0)
     return 0.0;
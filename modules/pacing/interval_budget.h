@@ -29,6 +29,9 @@ class IntervalBudget {
   void UseBudget(size_t bytes);
 
   size_t bytes_remaining() const;
+  // Time in ms until the budget, replenished at the current target rate,
+  // becomes positive again. Returns 0 if there already is budget available.
+  int64_t ms_until_budget_available() const;
   double budget_ratio() const;
   int target_rate_kbps() const;
 
@@ -11,6 +11,7 @@
 #include "modules/pacing/paced_sender.h"
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -24,9 +25,26 @@
 #include "system_wrappers/include/clock.h"
 
 namespace webrtc {
+namespace {
+// Number of staging rings used for deferred enqueues. Packets are mapped to
+// rings by SSRC, so this only needs to be large enough to make collisions
+// between concurrently enqueueing streams unlikely.
+constexpr size_t kNumEnqueueRings = 8;
+
+bool IsDeferredEnqueueEnabled(const WebRtcKeyValueConfig* field_trials) {
+  FieldTrialBasedConfig default_trials;
+  const WebRtcKeyValueConfig& trials =
+      field_trials ? *field_trials : default_trials;
+  return trials.Lookup("WebRTC-Pacer-DeferredEnqueue").find("Enabled") == 0;
+}
+}  // namespace
+
 const int64_t PacedSender::kMaxQueueLengthMs = 2000;
 const float PacedSender::kDefaultPaceMultiplier = 2.5f;
 
+PacedSender::EnqueueRing::EnqueueRing() = default;
+PacedSender::EnqueueRing::~EnqueueRing() = default;
+
 PacedSender::PacedSender(Clock* clock,
                          PacketRouter* packet_router,
                          RtcEventLog* event_log,
@@ -36,8 +54,13 @@ PacedSender::PacedSender(Clock* clock,
                          static_cast<PacingController::PacketSender*>(this),
                          event_log,
                          field_trials),
+      deferred_enqueue_(IsDeferredEnqueueEnabled(field_trials)),
       packet_router_(packet_router),
       process_thread_(process_thread) {
+  if (deferred_enqueue_) {
+    for (size_t i = 0; i < kNumEnqueueRings; ++i)
+      enqueue_rings_.push_back(absl::make_unique<EnqueueRing>());
+  }
   if (process_thread_)
     process_thread_->RegisterModule(&module_proxy_, RTC_FROM_HERE);
 }
@@ -92,10 +115,38 @@ void PacedSender::SetPacingRates(DataRate pacing_rate, DataRate padding_rate) {
 }
 
 void PacedSender::EnqueuePacket(std::unique_ptr<RtpPacketToSend> packet) {
+  if (deferred_enqueue_) {
+    // Stage the packet without touching |critsect_|; the next Process() call
+    // moves it into |pacing_controller_| ahead of the pacing pass. Selecting
+    // the ring by SSRC keeps packets of one stream in order.
+    EnqueueRing& ring = *enqueue_rings_[packet->Ssrc() % kNumEnqueueRings];
+    rtc::CritScope cs(&ring.lock);
+    ring.packets.push_back(std::move(packet));
+    return;
+  }
   rtc::CritScope cs(&critsect_);
   pacing_controller_.EnqueuePacket(std::move(packet));
 }
 
+void PacedSender::DrainEnqueueRings() {
+  std::vector<std::unique_ptr<RtpPacketToSend>> staged;
+  for (auto& ring : enqueue_rings_) {
+    rtc::CritScope cs(&ring->lock);
+    if (staged.empty()) {
+      staged.swap(ring->packets);
+    } else {
+      std::move(ring->packets.begin(), ring->packets.end(),
+                std::back_inserter(staged));
+      ring->packets.clear();
+    }
+  }
+  if (staged.empty())
+    return;
+  rtc::CritScope cs(&critsect_);
+  for (auto& packet : staged)
+    pacing_controller_.EnqueuePacket(std::move(packet));
+}
+
 void PacedSender::SetAccountForAudioPackets(bool account_for_audio) {
   rtc::CritScope cs(&critsect_);
   pacing_controller_.SetAccountForAudioPackets(account_for_audio);
@@ -126,6 +177,11 @@ TimeDelta PacedSender::OldestPacketWaitTime() const {
   return pacing_controller_.OldestPacketWaitTime();
 }
 
+PacingController::TimingStats PacedSender::GetTimingStats() const {
+  rtc::CritScope cs(&critsect_);
+  return pacing_controller_.GetTimingStats();
+}
+
 int64_t PacedSender::TimeUntilNextProcess() {
   rtc::CritScope cs(&critsect_);
 
@@ -148,6 +204,8 @@ int64_t PacedSender::TimeUntilNextProcess() {
 }
 
 void PacedSender::Process() {
+  if (deferred_enqueue_)
+    DrainEnqueueRings();
   rtc::CritScope cs(&critsect_);
   pacing_controller_.ProcessPackets();
 }
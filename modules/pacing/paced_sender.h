@@ -71,7 +71,10 @@ class PacedSender : public Module,
   // Methods implementing RtpPacketSender.
 
   // Adds the packet to the queue and calls PacketRouter::SendPacket() when
-  // it's time to send.
+  // it's time to send. If the WebRTC-Pacer-DeferredEnqueue field trial is
+  // enabled, the packet is staged in a lightly contended ring selected by
+  // SSRC and moved into the pacing queue by the next Process() call, so
+  // that packet producers never wait for an in-progress pacing pass.
   void EnqueuePacket(std::unique_ptr<RtpPacketToSend> packet) override;
 
   // Methods implementing RtpPacketPacer:
@@ -109,6 +112,10 @@ class PacedSender : public Module,
   // packets in the queue, given the current size and bitrate, ignoring prio.
   TimeDelta ExpectedQueueTime() const override;
 
+  // Snapshot of the opt-in pacer timing instrumentation, see
+  // PacingController::GetTimingStats().
+  PacingController::TimingStats GetTimingStats() const;
+
   void SetQueueTimeLimit(TimeDelta limit) override;
 
   // Below are methods specific to this implementation, such as things related
@@ -162,9 +169,28 @@ class PacedSender : public Module,
     PacedSender* const delegate_;
   } module_proxy_{this};
 
+  // Staging area for deferred enqueues. Each ring has its own lock, held
+  // only for the duration of a vector push or swap, so encoder threads
+  // neither wait for |critsect_| nor, with distinct SSRCs, for each other.
+  struct EnqueueRing {
+    EnqueueRing();
+    ~EnqueueRing();
+    rtc::CriticalSection lock;
+    std::vector<std::unique_ptr<RtpPacketToSend>> packets
+        RTC_GUARDED_BY(&lock);
+  };
+
+  // Moves staged packets into |pacing_controller_|. Only used when deferred
+  // enqueue is enabled.
+  void DrainEnqueueRings();
+
   rtc::CriticalSection critsect_;
   PacingController pacing_controller_ RTC_GUARDED_BY(critsect_);
 
+  // True if the WebRTC-Pacer-DeferredEnqueue field trial is enabled.
+  const bool deferred_enqueue_;
+  std::vector<std::unique_ptr<EnqueueRing>> enqueue_rings_;
+
   PacketRouter* const packet_router_;
   ProcessThread* const process_thread_;
 };
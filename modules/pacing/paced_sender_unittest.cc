@@ -114,5 +114,43 @@ TEST(PacedSenderTest, PacesPackets) {
   EXPECT_GT(duration, TimeDelta::ms(900));
 }
 
+TEST(PacedSenderTest, DeferredEnqueueDeliversAllPackets) {
+  ScopedFieldTrials trials("WebRTC-Pacer-DeferredEnqueue/Enabled/");
+  SimulatedClock clock(0);
+  MockCallback callback;
+  MockProcessThread process_thread;
+  Module* paced_module = nullptr;
+  EXPECT_CALL(process_thread, RegisterModule(_, _))
+      .WillOnce(SaveArg<0>(&paced_module));
+  PacedSender pacer(&clock, &callback, nullptr, nullptr, &process_thread);
+  EXPECT_CALL(process_thread, DeRegisterModule(paced_module)).Times(1);
+
+  static constexpr size_t kPacketsToSend = 42;
+  pacer.SetPacingRates(DataRate::bps(kDefaultPacketSize * 8 * kPacketsToSend),
+                       DataRate::Zero());
+  // Interleave streams so that several staging rings are exercised.
+  for (size_t i = 0; i < kPacketsToSend; ++i) {
+    pacer.EnqueuePacket(BuildRtpPacket(i % 2 == 0
+                                           ? RtpPacketToSend::Type::kVideo
+                                           : RtpPacketToSend::Type::kAudio));
+  }
+  // Staged packets are not visible to the pacing queue until Process() has
+  // run.
+  EXPECT_EQ(pacer.QueueSizePackets(), 0u);
+
+  size_t packets_sent = 0;
+  clock.AdvanceTimeMilliseconds(paced_module->TimeUntilNextProcess());
+  EXPECT_CALL(callback, SendPacket)
+      .WillRepeatedly(
+          [&](std::unique_ptr<RtpPacketToSend> packet,
+              const PacedPacketInfo& cluster_info) { ++packets_sent; });
+
+  while (packets_sent < kPacketsToSend) {
+    clock.AdvanceTimeMilliseconds(paced_module->TimeUntilNextProcess());
+    paced_module->Process();
+  }
+  EXPECT_EQ(packets_sent, kPacketsToSend);
+}
+
 }  // namespace test
 }  // namespace webrtc
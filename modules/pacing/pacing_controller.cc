@@ -20,6 +20,7 @@
 #include "modules/utility/include/process_thread.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/perf_sample.h"
 #include "rtc_base/time_utils.h"
 #include "system_wrappers/include/clock.h"
 
@@ -104,7 +105,9 @@ PacingController::PacingController(Clock* clock,
       congestion_window_size_(DataSize::PlusInfinity()),
       outstanding_data_(DataSize::Zero()),
       queue_time_limit(kMaxExpectedQueueLength),
-      account_for_audio_(false) {
+      account_for_audio_(false),
+      timing_stats_enabled_(
+          IsEnabled(*field_trials_, "WebRTC-Pacer-TimingStats")) {
   if (!drain_large_queues_) {
     RTC_LOG(LS_WARNING) << "Pacer queues will not be drained,"
                            "pushback experiment must be enabled.";
@@ -155,6 +158,16 @@ bool PacingController::Congested() const {
   return false;
 }
 
+PacingController::TimingStats PacingController::GetTimingStats() const {
+  TimingStats stats;
+  stats.enabled = timing_stats_enabled_;
+  if (timing_stats_enabled_) {
+    stats.queue_time_ms = queue_time_histogram_.GetSnapshot();
+    stats.send_burst_packets = send_burst_histogram_.GetSnapshot();
+  }
+  return stats;
+}
+
 Timestamp PacingController::CurrentTime() const {
   Timestamp time = clock_->CurrentTime();
   if (time < last_timestamp_) {
@@ -279,7 +292,51 @@ TimeDelta PacingController::TimeElapsedSinceLastProcess() const {
   return CurrentTime() - time_last_process_;
 }
 
+TimeDelta PacingController::TimeUntilAvailableBudget() const {
+  return TimeDelta::ms(media_budget_.ms_until_budget_available());
+}
+
+Timestamp PacingController::NextSendTime() {
+  Timestamp now = CurrentTime();
+
+  if (paused_ || Congested()) {
+    // While paused or congested, only the periodic keepalive padding goes out.
+    return last_send_time_ + kCongestedPacketInterval;
+  }
+
+  if (absl::optional<TimeDelta> time_until_probe = TimeUntilNextProbe()) {
+    return now + *time_until_probe;
+  }
+
+  // Time since the last process call is credited to the budget when
+  // ProcessPackets() runs, but the replenishment per call is capped at
+  // kMaxProcessingInterval. Thus never sleep longer than that cap while in
+  // debt, and count time already elapsed as paid off.
+  TimeDelta elapsed_time =
+      std::min(TimeElapsedSinceLastProcess(), kMaxProcessingInterval);
+
+  if (!packet_queue_.Empty()) {
+    // Media is queued; send as soon as the budget allows.
+    TimeDelta time_until_budget =
+        std::min(TimeUntilAvailableBudget(), kMaxProcessingInterval);
+    return now + std::max(time_until_budget - elapsed_time, TimeDelta::Zero());
+  }
+
+  if (padding_budget_.target_rate_kbps() > 0 && packet_counter_ > 0) {
+    // No media queued; wake up when the padding budget allows more padding.
+    TimeDelta time_until_padding =
+        std::min(TimeDelta::ms(padding_budget_.ms_until_budget_available()),
+                 kMaxProcessingInterval);
+    return now + std::max(time_until_padding - elapsed_time, TimeDelta::Zero());
+  }
+
+  // Nothing to send until a packet is enqueued; wake up periodically so that
+  // keepalives and budget bookkeeping don't fall too far behind.
+  return now + kPausedProcessInterval;
+}
+
 void PacingController::ProcessPackets() {
+  RTC_SCOPED_PERF_SAMPLE("PacingController::ProcessPackets");
   Timestamp now = CurrentTime();
   TimeDelta elapsed_time = UpdateTimeAndGetElapsed(now);
   if (ShouldSendKeepalive(now)) {
@@ -331,6 +388,7 @@ void PacingController::ProcessPackets() {
   }
 
   DataSize data_sent = DataSize::Zero();
+  int packets_sent = 0;
   // The paused state is checked in the loop since it leaves the critical
   // section allowing the paused state to be changed from other code.
   while (!paused_) {
@@ -361,12 +419,16 @@ void PacingController::ProcessPackets() {
     packet_sender_->SendRtpPacket(std::move(rtp_packet), pacing_info);
 
     data_sent += packet->size();
+    ++packets_sent;
     // Send succeeded, remove it from the queue.
     OnPacketSent(packet);
     if (recommended_probe_size && data_sent > *recommended_probe_size)
       break;
   }
 
+  if (timing_stats_enabled_ && packets_sent > 0)
+    send_burst_histogram_.Add(packets_sent);
+
   if (is_probing) {
     probing_send_failure_ = data_sent == DataSize::Zero();
     if (!probing_send_failure_) {
@@ -431,6 +493,8 @@ void PacingController::OnPacketSent(
   if (!first_sent_packet_time_) {
     first_sent_packet_time_ = now;
   }
+  if (timing_stats_enabled_)
+    queue_time_histogram_.Add((now - packet->enqueue_time()).ms());
   bool audio_packet = packet->type() == RtpPacketToSend::Type::kAudio;
   if (!audio_packet || account_for_audio_) {
     // Update media bytes sent.
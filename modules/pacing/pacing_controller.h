@@ -28,6 +28,7 @@
 #include "modules/pacing/interval_budget.h"
 #include "modules/pacing/round_robin_packet_queue.h"
 #include "modules/pacing/rtp_packet_pacer.h"
+#include "modules/pacing/streaming_histogram.h"
 #include "modules/rtp_rtcp/include/rtp_packet_sender.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "rtc_base/critical_section.h"
@@ -126,14 +127,34 @@ class PacingController {
   // Time since ProcessPackets() was last executed.
   TimeDelta TimeElapsedSinceLastProcess() const;
 
+  // Time until the media budget, replenished at the current pacing rate,
+  // allows another packet to be sent. Zero if budget is already available.
   TimeDelta TimeUntilAvailableBudget() const;
 
+  // The exact time the next queued packet (or keepalive, probe or padding
+  // packet) becomes sendable. An event-driven owner can sleep until this time
+  // and then call ProcessPackets(), instead of polling at a fixed interval;
+  // the returned time must be recomputed when a packet is enqueued or a
+  // setting changes.
+  Timestamp NextSendTime();
+
   // Check queue of pending packets and send them or padding packets, if budget
   // is available.
   void ProcessPackets();
 
   bool Congested() const;
 
+  // Snapshot of the timing instrumentation, only populated when opted in via
+  // the WebRTC-Pacer-TimingStats field trial. May be called from any thread.
+  struct TimingStats {
+    bool enabled = false;
+    // Enqueue to send latency per paced packet, in milliseconds.
+    StreamingHistogram::Snapshot queue_time_ms;
+    // Number of packets sent per ProcessPackets() call that sent anything.
+    StreamingHistogram::Snapshot send_burst_packets;
+  };
+  TimingStats GetTimingStats() const;
+
  private:
   TimeDelta UpdateTimeAndGetElapsed(Timestamp now);
   bool ShouldSendKeepalive(Timestamp now) const;
@@ -192,6 +213,13 @@ class PacingController {
 
   TimeDelta queue_time_limit;
   bool account_for_audio_;
+
+  // Opt-in timing instrumentation; the histograms are written with relaxed
+  // atomic adds so the cost is negligible when enabled and the snapshots can
+  // be read without holding the owner's lock.
+  const bool timing_stats_enabled_;
+  StreamingHistogram queue_time_histogram_;
+  StreamingHistogram send_burst_histogram_;
 };
 }  // namespace webrtc
 
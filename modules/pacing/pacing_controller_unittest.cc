@@ -21,6 +21,7 @@
 #include "api/units/data_rate.h"
 #include "modules/pacing/packet_router.h"
 #include "system_wrappers/include/clock.h"
+#include "test/allocation_counter.h"
 #include "test/field_trial.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
@@ -1266,5 +1267,100 @@ TEST_F(PacingControllerTest, OwnedPacketPrioritizedOnType) {
   clock_.AdvanceTimeMilliseconds(200);
   pacer_->ProcessPackets();
 }
+
+TEST_F(PacingControllerTest, SteadyStateSendPathStaysWithinAllocationBudget) {
+  // Use a callback without gmock bookkeeping, so that only allocations made
+  // by the pacer itself are counted.
+  PacingControllerPadding callback;
+  PacingController pacer(&clock_, &callback, nullptr, nullptr);
+  pacer.SetProbingEnabled(false);
+  pacer.SetPacingRates(kTargetRate * kPaceMultiplier, DataRate::Zero());
+
+  uint16_t sequence_number = 1234;
+  auto enqueue_and_drain = [&](std::unique_ptr<RtpPacketToSend> packet) {
+    pacer.EnqueuePacket(std::move(packet));
+    while (pacer.QueueSizePackets() > 0) {
+      clock_.AdvanceTimeMilliseconds(5);
+      pacer.ProcessPackets();
+    }
+  };
+
+  // Warm up until the pacer's internal containers have reached their
+  // steady-state capacities.
+  for (int i = 0; i < 50; ++i) {
+    enqueue_and_drain(BuildPacket(RtpPacketToSend::Type::kVideo, kVideoSsrc,
+                                  sequence_number++,
+                                  clock_.TimeInMilliseconds(), 1000));
+  }
+
+  // Build the packets up front so that only the send path itself is measured.
+  constexpr int kNumPackets = 100;
+  std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+  for (int i = 0; i < kNumPackets; ++i) {
+    packets.push_back(BuildPacket(RtpPacketToSend::Type::kVideo, kVideoSsrc,
+                                  sequence_number++,
+                                  clock_.TimeInMilliseconds(), 1000));
+  }
+
+  ScopedAllocationCounter counter;
+  for (auto& packet : packets) {
+    enqueue_and_drain(std::move(packet));
+  }
+  // The pacer queue stores packets in-place, so the steady-state send path
+  // makes no per-packet allocations; what remains is amortized block churn
+  // from the queue's deque storage.
+  EXPECT_LE(counter.allocations(), kNumPackets / 2);
+}
+
+TEST_F(PacingControllerTest, NextSendTimeAccountsForBudgetDebt) {
+  uint16_t sequence_number = 1234;
+
+  // Send a packet to get out of the initial "no packet sent" state, then
+  // drain the budget with a large packet.
+  SendAndExpectPacket(RtpPacketToSend::Type::kVideo, kVideoSsrc,
+                      sequence_number++, clock_.TimeInMilliseconds(), 250);
+  pacer_->ProcessPackets();
+
+  // The largest payload that fits in a default-capacity packet; large enough
+  // to overdraft the budget accumulated during one process interval.
+  const size_t kLargePacketSize = 1400;
+  SendAndExpectPacket(RtpPacketToSend::Type::kVideo, kVideoSsrc,
+                      sequence_number++, clock_.TimeInMilliseconds(),
+                      kLargePacketSize);
+  clock_.AdvanceTime(TimeUntilNextProcess());
+  pacer_->ProcessPackets();
+
+  // With another packet queued, the next send time reflects the time it takes
+  // to pay off the overdrafted media budget at the pacing rate.
+  Send(RtpPacketToSend::Type::kVideo, kVideoSsrc, sequence_number++,
+       clock_.TimeInMilliseconds(), 250);
+  Timestamp next_send_time = pacer_->NextSendTime();
+  EXPECT_GT(next_send_time, clock_.CurrentTime());
+
+  EXPECT_CALL(callback_, SendPacket(kVideoSsrc, _, _, false, false)).Times(1);
+  clock_.AdvanceTime(next_send_time - clock_.CurrentTime());
+  pacer_->ProcessPackets();
+}
+
+TEST_F(PacingControllerTest, NextSendTimeIsImmediateWithFreshBudget) {
+  uint16_t sequence_number = 1234;
+  SendAndExpectPacket(RtpPacketToSend::Type::kVideo, kVideoSsrc,
+                      sequence_number++, clock_.TimeInMilliseconds(), 250);
+  pacer_->ProcessPackets();
+
+  clock_.AdvanceTimeMilliseconds(500);
+  Send(RtpPacketToSend::Type::kVideo, kVideoSsrc, sequence_number++,
+       clock_.TimeInMilliseconds(), 250);
+  // Plenty of time has passed since the last process call, so there is budget
+  // available and the queued packet can go out immediately.
+  EXPECT_EQ(pacer_->NextSendTime(), clock_.CurrentTime());
+}
+
+TEST_F(PacingControllerTest, NextSendTimeWhileIdleIsKeepaliveInterval) {
+  // Queue empty and no padding rate configured; the pacer only needs to wake
+  // up for periodic bookkeeping.
+  EXPECT_EQ(pacer_->NextSendTime(),
+            clock_.CurrentTime() + PacingController::kPausedProcessInterval);
+}
 }  // namespace test
 }  // namespace webrtc
@@ -124,6 +124,20 @@ RtpRtcp* PacketRouter::FindRtpModule(uint32_t ssrc) {
 void PacketRouter::SendPacket(std::unique_ptr<RtpPacketToSend> packet,
                               const PacedPacketInfo& cluster_info) {
   rtc::CritScope cs(&modules_crit_);
+  RoutePacket(std::move(packet), cluster_info);
+}
+
+void PacketRouter::SendPacketBatch(
+    std::vector<std::unique_ptr<RtpPacketToSend>> packets,
+    const PacedPacketInfo& cluster_info) {
+  rtc::CritScope cs(&modules_crit_);
+  for (auto& packet : packets) {
+    RoutePacket(std::move(packet), cluster_info);
+  }
+}
+
+void PacketRouter::RoutePacket(std::unique_ptr<RtpPacketToSend> packet,
+                               const PacedPacketInfo& cluster_info) {
   // With the new pacer code path, transport sequence numbers are only set here,
   // on the pacer thread. Therefore we don't need atomics/synchronization.
   if (packet->IsExtensionReserved<TransportSequenceNumber>()) {
@@ -55,6 +55,14 @@ class PacketRouter : public RemoteBitrateObserver,
   virtual void SendPacket(std::unique_ptr<RtpPacketToSend> packet,
                           const PacedPacketInfo& cluster_info);
 
+  // Sends a burst of packets while taking the module list lock only once,
+  // instead of once per packet. Packets are routed in order; the SSRC to
+  // module cache makes all packets of a stream after the first resolve their
+  // RTP module without a search.
+  virtual void SendPacketBatch(
+      std::vector<std::unique_ptr<RtpPacketToSend>> packets,
+      const PacedPacketInfo& cluster_info);
+
   virtual std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
       size_t target_size_bytes);
 
@@ -95,6 +103,9 @@ class PacketRouter : public RemoteBitrateObserver,
                      const PacedPacketInfo& cluster_info,
                      RtpRtcp* rtp_module)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(modules_crit_);
+  void RoutePacket(std::unique_ptr<RtpPacketToSend> packet,
+                   const PacedPacketInfo& cluster_info)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(modules_crit_);
 
   rtc::CriticalSection modules_crit_;
   // Rtp and Rtcp modules of the rtp senders.
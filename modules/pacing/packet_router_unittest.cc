@@ -328,6 +328,39 @@ TEST_F(PacketRouterTest, SendPacketAssignsTransportSequenceNumbers) {
   packet_router_.RemoveSendRtpModule(&rtp_2);
 }
 
+TEST_F(PacketRouterTest, SendPacketBatchRoutesAllPackets) {
+  NiceMock<MockRtpRtcp> rtp_1;
+  NiceMock<MockRtpRtcp> rtp_2;
+
+  packet_router_.AddSendRtpModule(&rtp_1, false);
+  packet_router_.AddSendRtpModule(&rtp_2, false);
+
+  const uint16_t kSsrc1 = 1234;
+  const uint16_t kSsrc2 = 2345;
+
+  ON_CALL(rtp_1, SSRC).WillByDefault(Return(kSsrc1));
+  ON_CALL(rtp_2, SSRC).WillByDefault(Return(kSsrc2));
+
+  std::vector<std::unique_ptr<RtpPacketToSend>> batch;
+  batch.push_back(BuildRtpPacket(kSsrc1));
+  batch.push_back(BuildRtpPacket(kSsrc1));
+  batch.push_back(BuildRtpPacket(kSsrc2));
+
+  EXPECT_CALL(rtp_1, TrySendPacket(Property(&RtpPacketToSend::Ssrc, kSsrc1), _))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+  // The kSsrc2 packet misses the module cache; expect one failed attempt on
+  // the first module before the correct one is found.
+  EXPECT_CALL(rtp_1, TrySendPacket(Property(&RtpPacketToSend::Ssrc, kSsrc2), _))
+      .WillOnce(Return(false));
+  EXPECT_CALL(rtp_2, TrySendPacket(Property(&RtpPacketToSend::Ssrc, kSsrc2), _))
+      .WillOnce(Return(true));
+  packet_router_.SendPacketBatch(std::move(batch), PacedPacketInfo());
+
+  packet_router_.RemoveSendRtpModule(&rtp_1);
+  packet_router_.RemoveSendRtpModule(&rtp_2);
+}
+
 #if RTC_DCHECK_IS_ON && GTEST_HAS_DEATH_TEST && !defined(WEBRTC_ANDROID)
 TEST_F(PacketRouterTest, DoubleRegistrationOfSendModuleDisallowed) {
   NiceMock<MockRtpRtcp> module;
@@ -21,38 +21,34 @@ namespace {
 static constexpr DataSize kMaxLeadingSize = DataSize::Bytes<1400>();
 }
 
-RoundRobinPacketQueue::QueuedPacket::QueuedPacket(const QueuedPacket& rhs) =
-    default;
+RoundRobinPacketQueue::QueuedPacket::QueuedPacket(QueuedPacket&& rhs) = default;
+RoundRobinPacketQueue::QueuedPacket& RoundRobinPacketQueue::QueuedPacket::
+operator=(QueuedPacket&& rhs) = default;
 RoundRobinPacketQueue::QueuedPacket::~QueuedPacket() = default;
 
 RoundRobinPacketQueue::QueuedPacket::QueuedPacket(
     int priority,
     RtpPacketToSend::Type type,
-    uint32_t ssrc,
-    uint16_t seq_number,
-    int64_t capture_time_ms,
     Timestamp enqueue_time,
     DataSize size,
     bool retransmission,
     uint64_t enqueue_order,
-    std::multiset<Timestamp>::iterator enqueue_time_it,
-    absl::optional<std::list<std::unique_ptr<RtpPacketToSend>>::iterator>
-        packet_it)
+    std::unique_ptr<RtpPacketToSend> packet)
     : type_(type),
       priority_(priority),
-      ssrc_(ssrc),
-      sequence_number_(seq_number),
-      capture_time_ms_(capture_time_ms),
+      ssrc_(packet->Ssrc()),
+      sequence_number_(packet->SequenceNumber()),
+      capture_time_ms_(packet->capture_time_ms()),
       enqueue_time_(enqueue_time),
+      unadjusted_enqueue_time_(enqueue_time),
       size_(size),
       retransmission_(retransmission),
       enqueue_order_(enqueue_order),
-      enqueue_time_it_(enqueue_time_it),
-      packet_it_(packet_it) {}
+      packet_(std::move(packet)) {}
 
 std::unique_ptr<RtpPacketToSend>
 RoundRobinPacketQueue::QueuedPacket::ReleasePacket() {
-  return packet_it_ ? std::move(**packet_it_) : nullptr;
+  return std::move(packet_);
 }
 
 void RoundRobinPacketQueue::QueuedPacket::SubtractPauseTime(
@@ -60,20 +56,12 @@ void RoundRobinPacketQueue::QueuedPacket::SubtractPauseTime(
   enqueue_time_ -= pause_time_sum;
 }
 
-bool RoundRobinPacketQueue::QueuedPacket::operator<(
-    const RoundRobinPacketQueue::QueuedPacket& other) const {
-  if (priority_ != other.priority_)
-    return priority_ > other.priority_;
-  if (retransmission_ != other.retransmission_)
-    return other.retransmission_;
-
-  return enqueue_order_ > other.enqueue_order_;
-}
-
 RoundRobinPacketQueue::Stream::Stream() : size(DataSize::Zero()), ssrc(0) {}
-RoundRobinPacketQueue::Stream::Stream(const Stream& stream) = default;
 RoundRobinPacketQueue::Stream::~Stream() {}
 
+constexpr int RoundRobinPacketQueue::kNumPriorityLevels;
+constexpr int RoundRobinPacketQueue::kNumRungs;
+
 bool IsEnabled(const WebRtcKeyValueConfig* field_trials, const char* name) {
   if (!field_trials) {
     return false;
@@ -96,27 +84,10 @@ RoundRobinPacketQueue::RoundRobinPacketQueue(
 
 RoundRobinPacketQueue::~RoundRobinPacketQueue() {}
 
-void RoundRobinPacketQueue::Push(int priority,
-                                 RtpPacketToSend::Type type,
-                                 uint32_t ssrc,
-                                 uint16_t seq_number,
-                                 int64_t capture_time_ms,
-                                 Timestamp enqueue_time,
-                                 DataSize size,
-                                 bool retransmission,
-                                 uint64_t enqueue_order) {
-  Push(QueuedPacket(priority, type, ssrc, seq_number, capture_time_ms,
-                    enqueue_time, size, retransmission, enqueue_order,
-                    enqueue_times_.insert(enqueue_time), absl::nullopt));
-}
-
 void RoundRobinPacketQueue::Push(int priority,
                                  Timestamp enqueue_time,
                                  uint64_t enqueue_order,
                                  std::unique_ptr<RtpPacketToSend> packet) {
-  uint32_t ssrc = packet->Ssrc();
-  uint16_t sequence_number = packet->SequenceNumber();
-  int64_t capture_time_ms = packet->capture_time_ms();
   DataSize size =
       DataSize::bytes(send_side_bwe_with_overhead_
                           ? packet->size()
@@ -124,11 +95,9 @@ void RoundRobinPacketQueue::Push(int priority,
   auto type = packet->packet_type();
   RTC_DCHECK(type.has_value());
 
-  rtp_packets_.push_front(std::move(packet));
-  Push(QueuedPacket(
-      priority, *type, ssrc, sequence_number, capture_time_ms, enqueue_time,
-      size, *type == RtpPacketToSend::Type::kRetransmission, enqueue_order,
-      enqueue_times_.insert(enqueue_time), rtp_packets_.begin()));
+  Push(QueuedPacket(priority, *type, enqueue_time, size,
+                    *type == RtpPacketToSend::Type::kRetransmission,
+                    enqueue_order, std::move(packet)));
 }
 
 RoundRobinPacketQueue::QueuedPacket* RoundRobinPacketQueue::BeginPop() {
@@ -136,15 +105,20 @@ RoundRobinPacketQueue::QueuedPacket* RoundRobinPacketQueue::BeginPop() {
 
   Stream* stream = GetHighestPriorityStream();
   pop_stream_.emplace(stream);
-  pop_packet_.emplace(stream->packet_queue.top());
-  stream->packet_queue.pop();
+  const int rung = HighestPriorityRung(*stream);
+  RTC_CHECK_GE(rung, 0);
+  pop_packet_.emplace(std::move(stream->packets[rung].front()));
+  stream->packets[rung].pop_front();
 
   return &pop_packet_.value();
 }
 
 void RoundRobinPacketQueue::CancelPop() {
   RTC_CHECK(pop_packet_ && pop_stream_);
-  (*pop_stream_)->packet_queue.push(*pop_packet_);
+  // The packet was the front of its rung, put it back there.
+  (*pop_stream_)
+      ->packets[RungForPacket(*pop_packet_)]
+      .push_front(std::move(*pop_packet_));
   pop_packet_.reset();
   pop_stream_.reset();
 }
@@ -153,7 +127,7 @@ void RoundRobinPacketQueue::FinalizePop() {
   if (!Empty()) {
     RTC_CHECK(pop_packet_ && pop_stream_);
     Stream* stream = *pop_stream_;
-    stream_priorities_.erase(stream->priority_it);
+    UnscheduleStream(stream);
     const QueuedPacket& packet = *pop_packet_;
 
     // Calculate the total amount of time spent by this packet in the queue
@@ -165,14 +139,6 @@ void RoundRobinPacketQueue::FinalizePop() {
         time_last_updated_ - packet.enqueue_time() - pause_time_sum_;
     queue_time_sum_ -= time_in_non_paused_state;
 
-    RTC_CHECK(packet.EnqueueTimeIterator() != enqueue_times_.end());
-    enqueue_times_.erase(packet.EnqueueTimeIterator());
-
-    auto packet_it = packet.PacketIterator();
-    if (packet_it) {
-      rtp_packets_.erase(*packet_it);
-    }
-
     // Update |bytes| of this stream. The general idea is that the stream that
     // has sent the least amount of bytes should have the highest priority.
     // The problem with that is if streams send with different rates, in which
@@ -187,15 +153,12 @@ void RoundRobinPacketQueue::FinalizePop() {
     size_packets_ -= 1;
     RTC_CHECK(size_packets_ > 0 || queue_time_sum_ == TimeDelta::Zero());
 
-    // If there are packets left to be sent, schedule the stream again.
+    // If there are packets left to be sent, schedule the stream again. Moving
+    // it to the tail of its rung is what rotates the round robin.
     RTC_CHECK(!IsSsrcScheduled(stream->ssrc));
-    if (stream->packet_queue.empty()) {
-      stream->priority_it = stream_priorities_.end();
-    } else {
-      int priority = stream->packet_queue.top().priority();
-      stream->priority_it = stream_priorities_.emplace(
-          StreamPrioKey(priority, stream->size), stream->ssrc);
-    }
+    const int rung = HighestPriorityRung(*stream);
+    if (rung >= 0)
+      ScheduleStream(stream, rung);
 
     pop_packet_.reset();
     pop_stream_.reset();
@@ -203,9 +166,7 @@ void RoundRobinPacketQueue::FinalizePop() {
 }
 
 bool RoundRobinPacketQueue::Empty() const {
-  RTC_CHECK((!stream_priorities_.empty() && size_packets_ > 0) ||
-            (stream_priorities_.empty() && size_packets_ == 0));
-  return stream_priorities_.empty();
+  return size_packets_ == 0;
 }
 
 size_t RoundRobinPacketQueue::SizeInPackets() const {
@@ -219,8 +180,27 @@ DataSize RoundRobinPacketQueue::Size() const {
 Timestamp RoundRobinPacketQueue::OldestEnqueueTime() const {
   if (Empty())
     return Timestamp::MinusInfinity();
-  RTC_CHECK(!enqueue_times_.empty());
-  return *enqueue_times_.begin();
+  // Enqueue times are non-decreasing, so the front packet of each per-rung
+  // FIFO is the oldest of that rung; the global minimum is the minimum over
+  // the front packets of all scheduled streams. This scan replaces a
+  // per-packet ordered set, keeping the per-packet push free of allocations.
+  Timestamp oldest = Timestamp::PlusInfinity();
+  for (const auto& kv : streams_) {
+    const Stream& stream = kv.second;
+    if (stream.scheduled_rung < 0)
+      continue;
+    for (int rung = 0; rung < kNumRungs; ++rung) {
+      if (!stream.packets[rung].empty()) {
+        oldest = std::min(oldest,
+                          stream.packets[rung].front().unadjusted_enqueue_time());
+      }
+    }
+  }
+  if (pop_packet_) {
+    oldest = std::min(oldest, pop_packet_->unadjusted_enqueue_time());
+  }
+  RTC_DCHECK(oldest.IsFinite());
+  return oldest;
 }
 
 void RoundRobinPacketQueue::UpdateQueueTime(Timestamp now) {
@@ -253,29 +233,22 @@ TimeDelta RoundRobinPacketQueue::AverageQueueTime() const {
 }
 
 void RoundRobinPacketQueue::Push(QueuedPacket packet) {
-  auto stream_info_it = streams_.find(packet.ssrc());
-  if (stream_info_it == streams_.end()) {
-    stream_info_it = streams_.emplace(packet.ssrc(), Stream()).first;
-    stream_info_it->second.priority_it = stream_priorities_.end();
-    stream_info_it->second.ssrc = packet.ssrc();
-  }
+  Stream* stream = &streams_[packet.ssrc()];
+  stream->ssrc = packet.ssrc();
 
-  Stream* stream = &stream_info_it->second;
-
-  if (stream->priority_it == stream_priorities_.end()) {
-    // If the SSRC is not currently scheduled, add it to |stream_priorities_|.
+  const int rung = RungForPacket(packet);
+  if (stream->scheduled_rung < 0) {
+    // If the SSRC is not currently scheduled, add it to the ladder.
     RTC_CHECK(!IsSsrcScheduled(stream->ssrc));
-    stream->priority_it = stream_priorities_.emplace(
-        StreamPrioKey(packet.priority(), stream->size), packet.ssrc());
-  } else if (packet.priority() < stream->priority_it->first.priority) {
-    // If the priority of this SSRC increased, remove the outdated StreamPrioKey
-    // and insert a new one with the new priority. Note that |priority_| uses
-    // lower ordinal for higher priority.
-    stream_priorities_.erase(stream->priority_it);
-    stream->priority_it = stream_priorities_.emplace(
-        StreamPrioKey(packet.priority(), stream->size), packet.ssrc());
+    ScheduleStream(stream, rung);
+  } else if (rung < stream->scheduled_rung) {
+    // If the priority of this SSRC increased, move the stream to the rung of
+    // the new packet. Note that |priority_| uses lower ordinal for higher
+    // priority.
+    UnscheduleStream(stream);
+    ScheduleStream(stream, rung);
   }
-  RTC_CHECK(stream->priority_it != stream_priorities_.end());
+  RTC_CHECK_GE(stream->scheduled_rung, 0);
 
   // In order to figure out how much time a packet has spent in the queue while
   // not in a paused state, we subtract the total amount of time the queue has
@@ -289,25 +262,77 @@ void RoundRobinPacketQueue::Push(QueuedPacket packet) {
   size_packets_ += 1;
   size_ += packet.size();
 
-  stream->packet_queue.push(packet);
+  stream->packets[rung].push_back(std::move(packet));
+}
+
+int RoundRobinPacketQueue::RungForPacket(const QueuedPacket& packet) {
+  RTC_DCHECK_GE(packet.priority(), 0);
+  const int priority = std::min(packet.priority(), kNumPriorityLevels - 1);
+  // Retransmissions go ahead of other packets with the same priority.
+  return 2 * priority + (packet.is_retransmission() ? 0 : 1);
+}
+
+void RoundRobinPacketQueue::ScheduleStream(Stream* stream, int rung) {
+  RTC_DCHECK_EQ(stream->scheduled_rung, -1);
+  SchedulerRung& list = rungs_[rung];
+  stream->prev = list.tail;
+  stream->next = nullptr;
+  if (list.tail) {
+    list.tail->next = stream;
+  } else {
+    list.head = stream;
+  }
+  list.tail = stream;
+  stream->scheduled_rung = rung;
+}
+
+void RoundRobinPacketQueue::UnscheduleStream(Stream* stream) {
+  RTC_DCHECK_GE(stream->scheduled_rung, 0);
+  SchedulerRung& list = rungs_[stream->scheduled_rung];
+  if (stream->prev) {
+    stream->prev->next = stream->next;
+  } else {
+    list.head = stream->next;
+  }
+  if (stream->next) {
+    stream->next->prev = stream->prev;
+  } else {
+    list.tail = stream->prev;
+  }
+  stream->prev = nullptr;
+  stream->next = nullptr;
+  stream->scheduled_rung = -1;
 }
 
 RoundRobinPacketQueue::Stream*
 RoundRobinPacketQueue::GetHighestPriorityStream() {
-  RTC_CHECK(!stream_priorities_.empty());
-  uint32_t ssrc = stream_priorities_.begin()->second;
-
-  auto stream_info_it = streams_.find(ssrc);
-  RTC_CHECK(stream_info_it != streams_.end());
-  RTC_CHECK(stream_info_it->second.priority_it == stream_priorities_.begin());
-  RTC_CHECK(!stream_info_it->second.packet_queue.empty());
-  return &stream_info_it->second;
+  for (int rung = 0; rung < kNumRungs; ++rung) {
+    Stream* stream = rungs_[rung].head;
+    if (stream != nullptr) {
+      RTC_CHECK_EQ(stream->scheduled_rung, rung);
+      RTC_CHECK_EQ(HighestPriorityRung(*stream), rung);
+      return stream;
+    }
+  }
+  RTC_CHECK(false) << "No stream scheduled.";
+  return nullptr;
+}
+
+int RoundRobinPacketQueue::HighestPriorityRung(const Stream& stream) {
+  for (int rung = 0; rung < kNumRungs; ++rung) {
+    if (!stream.packets[rung].empty())
+      return rung;
+  }
+  return -1;
 }
 
 bool RoundRobinPacketQueue::IsSsrcScheduled(uint32_t ssrc) const {
-  for (const auto& scheduled_stream : stream_priorities_) {
-    if (scheduled_stream.second == ssrc)
-      return true;
+  for (const SchedulerRung& rung : rungs_) {
+    for (const Stream* stream = rung.head; stream != nullptr;
+         stream = stream->next) {
+      if (stream->ssrc == ssrc)
+        return true;
+    }
   }
   return false;
 }
@@ -14,11 +14,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <list>
-#include <map>
+#include <deque>
 #include <memory>
-#include <queue>
-#include <set>
+#include <unordered_map>
 
 #include "absl/types/optional.h"
 #include "api/transport/webrtc_key_value_config.h"
@@ -39,24 +37,21 @@ class RoundRobinPacketQueue {
 
   struct QueuedPacket {
    public:
-    QueuedPacket(
-        int priority,
-        RtpPacketToSend::Type type,
-        uint32_t ssrc,
-        uint16_t seq_number,
-        int64_t capture_time_ms,
-        Timestamp enqueue_time,
-        DataSize size,
-        bool retransmission,
-        uint64_t enqueue_order,
-        std::multiset<Timestamp>::iterator enqueue_time_it,
-        absl::optional<std::list<std::unique_ptr<RtpPacketToSend>>::iterator>
-            packet_it);
-    QueuedPacket(const QueuedPacket& rhs);
+    QueuedPacket(int priority,
+                 RtpPacketToSend::Type type,
+                 Timestamp enqueue_time,
+                 DataSize size,
+                 bool retransmission,
+                 uint64_t enqueue_order,
+                 std::unique_ptr<RtpPacketToSend> packet);
+    // Move-only: the packet is handed off down the send path without copies
+    // or extra allocations.
+    QueuedPacket(QueuedPacket&& rhs);
+    QueuedPacket& operator=(QueuedPacket&& rhs);
+    QueuedPacket(const QueuedPacket& rhs) = delete;
+    QueuedPacket& operator=(const QueuedPacket& rhs) = delete;
     ~QueuedPacket();
 
-    bool operator<(const QueuedPacket& other) const;
-
     int priority() const { return priority_; }
     RtpPacketToSend::Type type() const { return type_; }
     uint32_t ssrc() const { return ssrc_; }
@@ -69,41 +64,29 @@ class RoundRobinPacketQueue {
     std::unique_ptr<RtpPacketToSend> ReleasePacket();
 
     // For internal use.
-    absl::optional<std::list<std::unique_ptr<RtpPacketToSend>>::iterator>
-    PacketIterator() const {
-      return packet_it_;
-    }
-    std::multiset<Timestamp>::iterator EnqueueTimeIterator() const {
-      return enqueue_time_it_;
+    Timestamp unadjusted_enqueue_time() const {
+      return unadjusted_enqueue_time_;
     }
     void SubtractPauseTime(TimeDelta pause_time_sum);
 
    private:
     RtpPacketToSend::Type type_;
     int priority_;
+    // Metadata mirrored from |packet_|, so that it stays available after
+    // ReleasePacket() has handed the packet itself off.
     uint32_t ssrc_;
     uint16_t sequence_number_;
     int64_t capture_time_ms_;  // Absolute time of frame capture.
-    Timestamp enqueue_time_;   // Absolute time of pacer queue entry.
+    Timestamp enqueue_time_;  // Absolute time of pacer queue entry, adjusted
+                              // for time spent in a paused state.
+    // Actual time of pacer queue entry, used for OldestEnqueueTime().
+    Timestamp unadjusted_enqueue_time_;
     DataSize size_;
     bool retransmission_;
     uint64_t enqueue_order_;
-    std::multiset<Timestamp>::iterator enqueue_time_it_;
-    // Iterator into |rtp_packets_| where the memory for RtpPacket is owned,
-    // if applicable.
-    absl::optional<std::list<std::unique_ptr<RtpPacketToSend>>::iterator>
-        packet_it_;
+    std::unique_ptr<RtpPacketToSend> packet_;
   };
 
-  void Push(int priority,
-            RtpPacketToSend::Type type,
-            uint32_t ssrc,
-            uint16_t seq_number,
-            int64_t capture_time_ms,
-            Timestamp enqueue_time,
-            DataSize size,
-            bool retransmission,
-            uint64_t enqueue_order);
   void Push(int priority,
             Timestamp enqueue_time,
             uint64_t enqueue_order,
@@ -122,41 +105,53 @@ class RoundRobinPacketQueue {
   void SetPauseState(bool paused, Timestamp now);
 
  private:
-  struct StreamPrioKey {
-    StreamPrioKey(int priority, DataSize size)
-        : priority(priority), size(size) {}
-
-    bool operator<(const StreamPrioKey& other) const {
-      if (priority != other.priority)
-        return priority < other.priority;
-      return size < other.size;
-    }
-
-    const int priority;
-    const DataSize size;
-  };
+  // The priority ladder has one rung per (priority level, retransmission)
+  // pair; retransmissions go ahead of other packets with the same priority.
+  // Priorities from the caller beyond the last level are clamped onto it.
+  static constexpr int kNumPriorityLevels = 4;
+  static constexpr int kNumRungs = 2 * kNumPriorityLevels;
 
   struct Stream {
     Stream();
-    Stream(const Stream&);
+    Stream(const Stream&) = delete;
+    Stream& operator=(const Stream&) = delete;
 
-    virtual ~Stream();
+    ~Stream();
 
     DataSize size;
     uint32_t ssrc;
-    std::priority_queue<QueuedPacket> packet_queue;
-
-    // Whenever a packet is inserted for this stream we check if |priority_it|
-    // points to an element in |stream_priorities_|, and if it does it means
-    // this stream has already been scheduled, and if the scheduled priority is
-    // lower than the priority of the incoming packet we reschedule this stream
-    // with the higher priority.
-    std::multimap<StreamPrioKey, uint32_t>::iterator priority_it;
+
+    // Per-rung FIFOs of this stream's queued packets. The first non-empty
+    // rung holds the packet to send next.
+    std::deque<QueuedPacket> packets[kNumRungs];
+
+    // Intrusive links chaining scheduled streams into the per-rung lists of
+    // the scheduling ladder. A stream is scheduled on the rung of its best
+    // pending packet; |scheduled_rung| is -1 when the stream has no packets.
+    Stream* prev = nullptr;
+    Stream* next = nullptr;
+    int scheduled_rung = -1;
+  };
+
+  // One rung of the scheduling ladder: a FIFO of scheduled streams, served
+  // round robin.
+  struct SchedulerRung {
+    Stream* head = nullptr;
+    Stream* tail = nullptr;
   };
 
+  static int RungForPacket(const QueuedPacket& packet);
+
   void Push(QueuedPacket packet);
 
+  // Appends the stream to the tail of the given rung's round-robin list.
+  void ScheduleStream(Stream* stream, int rung);
+  // Unlinks the stream from its current rung.
+  void UnscheduleStream(Stream* stream);
+
   Stream* GetHighestPriorityStream();
+  // Index of the first non-empty packet rung of the stream, or -1.
+  static int HighestPriorityRung(const Stream& stream);
 
   // Just used to verify correctness.
   bool IsSsrcScheduled(uint32_t ssrc) const;
@@ -172,24 +167,16 @@ class RoundRobinPacketQueue {
   TimeDelta queue_time_sum_;
   TimeDelta pause_time_sum_;
 
-  // A map of streams used to prioritize from which stream to send next. We use
-  // a multimap instead of a priority_queue since the priority of a stream can
-  // change as a new packet is inserted, and a multimap allows us to remove and
-  // then reinsert a StreamPrioKey if the priority has increased.
-  std::multimap<StreamPrioKey, uint32_t> stream_priorities_;
-
-  // A map of SSRCs to Streams.
-  std::map<uint32_t, Stream> streams_;
-
-  // The enqueue time of every packet currently in the queue. Used to figure out
-  // the age of the oldest packet in the queue.
-  std::multiset<Timestamp> enqueue_times_;
+  // The scheduling ladder used to prioritize from which stream to send next:
+  // the head stream of the first non-empty rung is served, then rotated to
+  // the tail of the rung of its next pending packet. All scheduling
+  // operations relink a fixed number of pointers, so pushing and popping are
+  // O(1) regardless of the number of streams.
+  SchedulerRung rungs_[kNumRungs];
 
-  // List of RTP packets to be sent, not necessarily in the order they will be
-  // sent. PacketInfo.packet_it will point to an entry in this list, or the
-  // end iterator of this list if queue does not have direct ownership of the
-  // packet.
-  std::list<std::unique_ptr<RtpPacketToSend>> rtp_packets_;
+  // A map of SSRCs to Streams. Stream addresses are stable, the intrusive
+  // ladder links point into the map values.
+  std::unordered_map<uint32_t, Stream> streams_;
 
   const bool send_side_bwe_with_overhead_;
 };
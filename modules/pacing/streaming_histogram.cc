@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/streaming_histogram.h"
+
+namespace webrtc {
+namespace {
+
+size_t BucketIndex(int64_t value) {
+  size_t index = 0;
+  while (value > 0 && index < StreamingHistogram::kNumBuckets - 1) {
+    value >>= 1;
+    ++index;
+  }
+  return index;
+}
+
+// Exclusive upper bound of the values counted by bucket |index|.
+int64_t BucketUpperBound(size_t index) {
+  if (index == 0)
+    return 1;
+  return int64_t{1} << index;
+}
+
+}  // namespace
+
+StreamingHistogram::StreamingHistogram() {
+  for (std::atomic<uint64_t>& bucket : buckets_)
+    bucket.store(0, std::memory_order_relaxed);
+}
+
+void StreamingHistogram::Add(int64_t value) {
+  buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+StreamingHistogram::Snapshot StreamingHistogram::GetSnapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kNumBuckets; ++i)
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  return snapshot;
+}
+
+int64_t StreamingHistogram::Snapshot::Count() const {
+  int64_t count = 0;
+  for (uint64_t bucket : buckets)
+    count += bucket;
+  return count;
+}
+
+int64_t StreamingHistogram::Snapshot::Quantile(double quantile) const {
+  const int64_t count = Count();
+  if (count == 0)
+    return -1;
+  int64_t rank = static_cast<int64_t>(quantile * count);
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    rank -= buckets[i];
+    if (rank < 0)
+      return BucketUpperBound(i);
+  }
+  return Max();
+}
+
+int64_t StreamingHistogram::Snapshot::Max() const {
+  for (size_t i = kNumBuckets; i > 0; --i) {
+    if (buckets[i - 1] > 0)
+      return BucketUpperBound(i - 1);
+  }
+  return -1;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_PACING_STREAMING_HISTOGRAM_H_
+#define MODULES_PACING_STREAMING_HISTOGRAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Streaming histogram with power-of-two sized buckets, intended for always-on
+// instrumentation of hot paths. Recording a value is a single relaxed atomic
+// add, and snapshots may be taken concurrently from other threads. Since
+// writers and readers do not synchronize with each other a snapshot is only
+// approximate, which is acceptable for monitoring purposes.
+class StreamingHistogram {
+ public:
+  // Bucket 0 counts values <= 0 and bucket i >= 1 counts values in
+  // [2^(i-1), 2^i). Values that are too large are clamped into the last
+  // bucket.
+  static constexpr size_t kNumBuckets = 32;
+
+  StreamingHistogram();
+
+  // Records |value|. May be called concurrently with other Add() calls and
+  // with GetSnapshot().
+  void Add(int64_t value);
+
+  struct Snapshot {
+    // Sum of all bucket counts.
+    int64_t Count() const;
+    // Upper bound (exclusive) of the lowest bucket such that at least a
+    // |quantile| fraction of the recorded values fall within it or below.
+    // Returns -1 if the snapshot is empty.
+    int64_t Quantile(double quantile) const;
+    // Upper bound (exclusive) of the highest non-empty bucket, or -1 if the
+    // snapshot is empty.
+    int64_t Max() const;
+
+    uint64_t buckets[kNumBuckets] = {};
+  };
+  Snapshot GetSnapshot() const;
+
+ private:
+  std::atomic<uint64_t> buckets_[kNumBuckets];
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(StreamingHistogram);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_PACING_STREAMING_HISTOGRAM_H_
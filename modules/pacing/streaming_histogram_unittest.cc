@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/streaming_histogram.h"
+
+#include <limits>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(StreamingHistogramTest, EmptySnapshot) {
+  StreamingHistogram histogram;
+  StreamingHistogram::Snapshot snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(0, snapshot.Count());
+  EXPECT_EQ(-1, snapshot.Quantile(0.5));
+  EXPECT_EQ(-1, snapshot.Max());
+}
+
+TEST(StreamingHistogramTest, CountsAllSamples) {
+  StreamingHistogram histogram;
+  for (int i = 0; i < 100; ++i)
+    histogram.Add(i);
+  EXPECT_EQ(100, histogram.GetSnapshot().Count());
+}
+
+TEST(StreamingHistogramTest, QuantileReturnsBucketUpperBound) {
+  StreamingHistogram histogram;
+  // 90 small values in [0, 1) and 10 larger ones in [64, 128).
+  for (int i = 0; i < 90; ++i)
+    histogram.Add(0);
+  for (int i = 0; i < 10; ++i)
+    histogram.Add(100);
+  StreamingHistogram::Snapshot snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(1, snapshot.Quantile(0.5));
+  EXPECT_EQ(128, snapshot.Quantile(0.95));
+  EXPECT_EQ(128, snapshot.Max());
+}
+
+TEST(StreamingHistogramTest, ClampsLargeAndNegativeValues) {
+  StreamingHistogram histogram;
+  histogram.Add(-123);
+  histogram.Add(std::numeric_limits<int64_t>::max());
+  StreamingHistogram::Snapshot snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(2, snapshot.Count());
+  EXPECT_EQ(1, snapshot.Quantile(0.0));
+  EXPECT_EQ(int64_t{1} << (StreamingHistogram::kNumBuckets - 1),
+            snapshot.Max());
+}
+
+}  // namespace webrtc
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/task_queue_paced_sender.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "api/rtc_event_log/rtc_event_log.h"
+#include "rtc_base/checks.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+TaskQueuePacedSender::TaskQueuePacedSender(
+    Clock* clock,
+    PacketRouter* packet_router,
+    RtcEventLog* event_log,
+    const WebRtcKeyValueConfig* field_trials,
+    TaskQueueFactory* task_queue_factory)
+    : clock_(clock),
+      packet_router_(packet_router),
+      pacing_controller_(clock,
+                         static_cast<PacingController::PacketSender*>(this),
+                         event_log,
+                         field_trials),
+      next_wakeup_time_(Timestamp::PlusInfinity()),
+      task_queue_(task_queue_factory->CreateTaskQueue(
+          "TaskQueuePacedSender",
+          TaskQueueFactory::Priority::HIGH)) {}
+
+TaskQueuePacedSender::~TaskQueuePacedSender() = default;
+
+void TaskQueuePacedSender::CreateProbeCluster(DataRate bitrate,
+                                              int cluster_id) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.CreateProbeCluster(bitrate, cluster_id);
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::Pause() {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.Pause();
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::Resume() {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.Resume();
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::SetCongestionWindow(
+    DataSize congestion_window_size) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.SetCongestionWindow(congestion_window_size);
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::UpdateOutstandingData(DataSize outstanding_data) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.UpdateOutstandingData(outstanding_data);
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::SetPacingRates(DataRate pacing_rate,
+                                          DataRate padding_rate) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.SetPacingRates(pacing_rate, padding_rate);
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::EnqueuePacket(
+    std::unique_ptr<RtpPacketToSend> packet) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.EnqueuePacket(std::move(packet));
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::SetAccountForAudioPackets(bool account_for_audio) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.SetAccountForAudioPackets(account_for_audio);
+}
+
+TimeDelta TaskQueuePacedSender::ExpectedQueueTime() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.ExpectedQueueTime();
+}
+
+size_t TaskQueuePacedSender::QueueSizePackets() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.QueueSizePackets();
+}
+
+DataSize TaskQueuePacedSender::QueueSizeData() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.QueueSizeData();
+}
+
+absl::optional<Timestamp> TaskQueuePacedSender::FirstSentPacketTime() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.FirstSentPacketTime();
+}
+
+TimeDelta TaskQueuePacedSender::OldestPacketWaitTime() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.OldestPacketWaitTime();
+}
+
+PacingController::TimingStats TaskQueuePacedSender::GetTimingStats() const {
+  rtc::SpinMutexLock cs(&critsect_);
+  return pacing_controller_.GetTimingStats();
+}
+
+void TaskQueuePacedSender::SetQueueTimeLimit(TimeDelta limit) {
+  rtc::SpinMutexLock cs(&critsect_);
+  pacing_controller_.SetQueueTimeLimit(limit);
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::MaybeProcessPackets(Timestamp scheduled_for) {
+  RTC_DCHECK(task_queue_.IsCurrent());
+  rtc::SpinMutexLock cs(&critsect_);
+  if (scheduled_for == next_wakeup_time_) {
+    // This task is the pending wakeup; consume it.
+    next_wakeup_time_ = Timestamp::PlusInfinity();
+  }
+  if (pacing_controller_.NextSendTime() <= CurrentTime()) {
+    pacing_controller_.ProcessPackets();
+  }
+  MaybeScheduleWakeup();
+}
+
+void TaskQueuePacedSender::MaybeScheduleWakeup() {
+  Timestamp next_send_time = pacing_controller_.NextSendTime();
+  if (next_wakeup_time_ <= next_send_time) {
+    // An earlier (or identical) wakeup is already in flight. A task that has
+    // become stale because the send time moved back re-arms itself when it
+    // fires.
+    return;
+  }
+  next_wakeup_time_ = next_send_time;
+  TimeDelta delay = std::max(next_send_time - CurrentTime(), TimeDelta::Zero());
+  task_queue_.PostDelayedTask(
+      [this, next_send_time]() { MaybeProcessPackets(next_send_time); },
+      delay.ms());
+}
+
+Timestamp TaskQueuePacedSender::CurrentTime() const {
+  return clock_->CurrentTime();
+}
+
+void TaskQueuePacedSender::SendRtpPacket(
+    std::unique_ptr<RtpPacketToSend> packet,
+    const PacedPacketInfo& cluster_info) {
+  critsect_.Unlock();
+  packet_router_->SendPacket(std::move(packet), cluster_info);
+  critsect_.Lock();
+}
+
+std::vector<std::unique_ptr<RtpPacketToSend>>
+TaskQueuePacedSender::GeneratePadding(DataSize size) {
+  std::vector<std::unique_ptr<RtpPacketToSend>> padding_packets;
+  critsect_.Unlock();
+  padding_packets = packet_router_->GeneratePadding(size.bytes());
+  critsect_.Lock();
+  return padding_packets;
+}
+}  // namespace webrtc
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_PACING_TASK_QUEUE_PACED_SENDER_H_
+#define MODULES_PACING_TASK_QUEUE_PACED_SENDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/transport/webrtc_key_value_config.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/pacing/packet_router.h"
+#include "modules/pacing/rtp_packet_pacer.h"
+#include "modules/rtp_rtcp/include/rtp_packet_sender.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/synchronization/spin_mutex.h"
+#include "rtc_base/task_queue.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+class Clock;
+class RtcEventLog;
+
+// A pacer driven by its own task queue instead of a module process thread.
+// Rather than being polled at a fixed interval, it asks PacingController for
+// the exact time the next packet becomes sendable and arms a delayed task for
+// that instant, re-arming whenever an enqueued packet or a settings change
+// moves the release time closer. This gives send timing that is not quantized
+// to the process interval, and no wakeups at all while there is nothing to
+// send.
+class TaskQueuePacedSender : public RtpPacketPacer,
+                             public RtpPacketSender,
+                             private PacingController::PacketSender {
+ public:
+  TaskQueuePacedSender(Clock* clock,
+                       PacketRouter* packet_router,
+                       RtcEventLog* event_log,
+                       const WebRtcKeyValueConfig* field_trials,
+                       TaskQueueFactory* task_queue_factory);
+
+  ~TaskQueuePacedSender() override;
+
+  // Methods implementing RtpPacketSender.
+
+  // Adds the packet to the queue and calls PacketRouter::SendPacket() when
+  // it's time to send.
+  void EnqueuePacket(std::unique_ptr<RtpPacketToSend> packet) override;
+
+  // Methods implementing RtpPacketPacer:
+
+  void CreateProbeCluster(DataRate bitrate, int cluster_id) override;
+
+  // Temporarily pause all sending.
+  void Pause() override;
+
+  // Resume sending packets.
+  void Resume() override;
+
+  void SetCongestionWindow(DataSize congestion_window_size) override;
+  void UpdateOutstandingData(DataSize outstanding_data) override;
+
+  // Sets the pacing rates. Must be called once before packets can be sent.
+  void SetPacingRates(DataRate pacing_rate, DataRate padding_rate) override;
+
+  // Currently audio traffic is not accounted by pacer and passed through.
+  // With the introduction of audio BWE audio traffic will be accounted for
+  // the pacer budget calculation. The audio traffic still will be injected
+  // at high priority.
+  void SetAccountForAudioPackets(bool account_for_audio) override;
+
+  // Returns the time since the oldest queued packet was enqueued.
+  TimeDelta OldestPacketWaitTime() const override;
+
+  size_t QueueSizePackets() const override;
+  DataSize QueueSizeData() const override;
+
+  // Returns the time when the first packet was sent;
+  absl::optional<Timestamp> FirstSentPacketTime() const override;
+
+  // Returns the number of milliseconds it will take to send the current
+  // packets in the queue, given the current size and bitrate, ignoring prio.
+  TimeDelta ExpectedQueueTime() const override;
+
+  // Snapshot of the opt-in pacer timing instrumentation, see
+  // PacingController::GetTimingStats().
+  PacingController::TimingStats GetTimingStats() const;
+
+  void SetQueueTimeLimit(TimeDelta limit) override;
+
+ private:
+  // Methods implementing PacedSenderController:PacketSender.
+
+  void SendRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
+                     const PacedPacketInfo& cluster_info) override
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(critsect_);
+
+  std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
+      DataSize size) override RTC_EXCLUSIVE_LOCKS_REQUIRED(critsect_);
+
+  // Runs on |task_queue_|. Processes packets if this task is the pending
+  // wakeup (or the release time has passed anyway), then arms the next one.
+  void MaybeProcessPackets(Timestamp scheduled_for);
+
+  // Posts a delayed task for the controller's next send time, unless an
+  // earlier wakeup is already in flight.
+  void MaybeScheduleWakeup() RTC_EXCLUSIVE_LOCKS_REQUIRED(critsect_);
+
+  Timestamp CurrentTime() const;
+
+  Clock* const clock_;
+  PacketRouter* const packet_router_;
+
+  // The sections under this lock are all short and never block, so an
+  // adaptive spin mutex avoids futex wakeups between the task queue and the
+  // threads enqueueing packets. Note: NOT recursive; callouts below release
+  // it first.
+  rtc::SpinMutex critsect_;
+  PacingController pacing_controller_ RTC_GUARDED_BY(critsect_);
+  // The time the earliest pending wakeup task fires, or plus infinity if no
+  // wakeup is in flight.
+  Timestamp next_wakeup_time_ RTC_GUARDED_BY(critsect_);
+
+  // Declared last so that pending tasks are dropped before the members they
+  // reference are destroyed.
+  rtc::TaskQueue task_queue_;
+};
+}  // namespace webrtc
+#endif  // MODULES_PACING_TASK_QUEUE_PACED_SENDER_H_
@@ -0,0 +1,120 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/task_queue_paced_sender.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "modules/pacing/packet_router.h"
+#include "rtc_base/event.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+constexpr uint32_t kVideoSsrc = 234565;
+constexpr size_t kDefaultPacketSize = 234;
+
+// Counts sent packets and lets the test thread wait for deliveries, which
+// arrive on the pacer's task queue.
+class CountingPacketRouter : public PacketRouter {
+ public:
+  CountingPacketRouter() : packets_sent_(0) {}
+
+  void SendPacket(std::unique_ptr<RtpPacketToSend> packet,
+                  const PacedPacketInfo& cluster_info) override {
+    ++packets_sent_;
+    packet_sent_.Set();
+  }
+
+  std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
+      size_t target_size_bytes) override {
+    return {};
+  }
+
+  bool WaitForPackets(size_t count, int give_up_after_ms) {
+    while (packets_sent_ < count) {
+      if (!packet_sent_.Wait(give_up_after_ms))
+        return false;
+    }
+    return true;
+  }
+
+  size_t packets_sent() const { return packets_sent_; }
+
+ private:
+  std::atomic<size_t> packets_sent_;
+  rtc::Event packet_sent_;
+};
+
+std::unique_ptr<RtpPacketToSend> BuildRtpPacket() {
+  auto packet = absl::make_unique<RtpPacketToSend>(nullptr);
+  packet->set_packet_type(RtpPacketToSend::Type::kVideo);
+  packet->SetSsrc(kVideoSsrc);
+  packet->SetPayloadSize(kDefaultPacketSize);
+  return packet;
+}
+}  // namespace
+
+TEST(TaskQueuePacedSenderTest, PacesPackets) {
+  static constexpr size_t kPacketsToSend = 10;
+  // Rate chosen so the budget admits one packet per ~20ms.
+  const DataRate kPacingRate =
+      DataRate::bps(kDefaultPacketSize * 8 * kPacketsToSend * 5);
+
+  Clock* clock = Clock::GetRealTimeClock();
+  CountingPacketRouter packet_router;
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  TaskQueuePacedSender pacer(clock, &packet_router, nullptr, nullptr,
+                             task_queue_factory.get());
+
+  pacer.SetPacingRates(kPacingRate, DataRate::Zero());
+  const Timestamp start_time = clock->CurrentTime();
+  for (size_t i = 0; i < kPacketsToSend; ++i) {
+    pacer.EnqueuePacket(BuildRtpPacket());
+  }
+
+  // All packets should be released without any further prodding.
+  EXPECT_TRUE(
+      packet_router.WaitForPackets(kPacketsToSend, /*give_up_after_ms=*/5000));
+  TimeDelta duration = clock->CurrentTime() - start_time;
+  // The budget only admits kMaxProcessingInterval worth of data per process
+  // call, so delivery must have been spread out over time.
+  EXPECT_GT(duration, TimeDelta::ms(50));
+}
+
+TEST(TaskQueuePacedSenderTest, ReschedulesOnEnqueue) {
+  Clock* clock = Clock::GetRealTimeClock();
+  CountingPacketRouter packet_router;
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  TaskQueuePacedSender pacer(clock, &packet_router, nullptr, nullptr,
+                             task_queue_factory.get());
+
+  pacer.SetPacingRates(DataRate::kbps(800), DataRate::Zero());
+
+  // With an idle pacer, the pending wakeup is the long keepalive interval.
+  // Enqueuing must arm an earlier task rather than wait for that wakeup.
+  pacer.EnqueuePacket(BuildRtpPacket());
+  EXPECT_TRUE(packet_router.WaitForPackets(1, /*give_up_after_ms=*/1000));
+
+  pacer.EnqueuePacket(BuildRtpPacket());
+  EXPECT_TRUE(packet_router.WaitForPackets(2, /*give_up_after_ms=*/1000));
+}
+
+}  // namespace test
+}  // namespace webrtc
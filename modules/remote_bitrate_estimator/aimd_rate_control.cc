@@ -400,7 +400,12 @@ DataRate AimdRateControl::MultiplicativeRateIncrease(
   double alpha = 1.08;
   if (last_time.IsFinite()) {
     auto time_since_last_update = at_time - last_time;
-    alpha = pow(alpha, std::min(time_since_last_update.seconds<double>(), 1.0));
+    // pow() is only needed for fractional exponents; at one second or more
+    // since the last update the exponent saturates at 1.0 and alpha is used
+    // as is.
+    if (time_since_last_update < TimeDelta::seconds(1)) {
+      alpha = pow(alpha, time_since_last_update.seconds<double>());
+    }
   }
   DataRate multiplicative_increase =
       std::max(current_bitrate * (alpha - 1.0), DataRate::bps(1000));
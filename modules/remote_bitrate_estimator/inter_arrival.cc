@@ -108,6 +108,21 @@ bool InterArrival::ComputeDeltas(uint32_t timestamp,
   return calculated_deltas;
 }
 
+void InterArrival::ComputeDeltasBatch(
+    rtc::ArrayView<const PacketTiming> packets,
+    int64_t system_time_ms,
+    std::vector<PacketDeltas>* deltas) {
+  deltas->resize(packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    PacketDeltas& delta = (*deltas)[i];
+    delta = PacketDeltas();
+    delta.computed = ComputeDeltas(
+        packets[i].timestamp, packets[i].arrival_time_ms, system_time_ms,
+        packets[i].packet_size, &delta.timestamp_delta,
+        &delta.arrival_time_delta_ms, &delta.packet_size_delta);
+  }
+}
+
 bool InterArrival::PacketInOrder(uint32_t timestamp) {
   if (current_timestamp_group_.IsFirstPacket()) {
     return true;
@@ -14,6 +14,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <vector>
+
+#include "api/array_view.h"
 #include "rtc_base/constructor_magic.h"
 
 namespace webrtc {
@@ -51,6 +54,31 @@ class InterArrival {
                      int64_t* arrival_time_delta_ms,
                      int* packet_size_delta);
 
+  // Input to ComputeDeltasBatch(), one entry per packet.
+  struct PacketTiming {
+    uint32_t timestamp;
+    int64_t arrival_time_ms;
+    size_t packet_size;
+  };
+  // Output of ComputeDeltasBatch(), one entry per packet. |computed| mirrors
+  // the return value of ComputeDeltas(); the deltas are only valid when it is
+  // true.
+  struct PacketDeltas {
+    bool computed = false;
+    uint32_t timestamp_delta = 0;
+    int64_t arrival_time_delta_ms = 0;
+    int packet_size_delta = 0;
+  };
+
+  // Batch version of ComputeDeltas(). Processes |packets|, which must be
+  // ordered by arrival, in one pass and resizes |deltas| to hold one entry per
+  // packet, equivalent to calling ComputeDeltas() once per packet with the
+  // shared |system_time_ms|. The flat output lets callers feed downstream
+  // estimators in a tight loop without interleaved per-packet calls.
+  void ComputeDeltasBatch(rtc::ArrayView<const PacketTiming> packets,
+                          int64_t system_time_ms,
+                          std::vector<PacketDeltas>* deltas);
+
  private:
   struct TimestampGroup {
     TimestampGroup()
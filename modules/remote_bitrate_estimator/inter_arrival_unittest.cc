@@ -11,6 +11,7 @@
 #include "modules/remote_bitrate_estimator/inter_arrival.h"
 
 #include <memory>
+#include <vector>
 
 #include "test/gtest.h"
 
@@ -527,5 +528,44 @@ TEST_F(InterArrivalTest, NegativeArrivalTimeJump) {
   EXPECT_EQ(kTimeDeltaMs, arrival_delta);
   EXPECT_EQ(size_delta, 0);
 }
+
+TEST_F(InterArrivalTest, BatchMatchesPerPacketComputeDeltas) {
+  InterArrival per_packet(kTimestampGroupLengthUs / 1000, 1.0, true);
+  InterArrival batched(kTimestampGroupLengthUs / 1000, 1.0, true);
+
+  std::vector<InterArrival::PacketTiming> packets;
+  int64_t timestamp = 10000;
+  int64_t arrival_time_ms = 500;
+  for (int i = 0; i < 100; ++i) {
+    // Mix packets within a group with packets triggering new groups, and
+    // include a reordered packet.
+    timestamp += (i % 5 == 0) ? kTriggerNewGroupUs : kMinStep;
+    arrival_time_ms += (i % 5 == 0) ? 6 : 1;
+    if (i == 50)
+      timestamp -= 2 * kTriggerNewGroupUs;
+    packets.push_back({static_cast<uint32_t>(timestamp), arrival_time_ms,
+                       static_cast<size_t>(1000 + (i % 7) * 100)});
+  }
+  const int64_t system_time_ms = arrival_time_ms;
+
+  std::vector<InterArrival::PacketDeltas> deltas;
+  batched.ComputeDeltasBatch(packets, system_time_ms, &deltas);
+  ASSERT_EQ(packets.size(), deltas.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    uint32_t timestamp_delta = 0;
+    int64_t arrival_time_delta_ms = 0;
+    int packet_size_delta = 0;
+    bool computed = per_packet.ComputeDeltas(
+        packets[i].timestamp, packets[i].arrival_time_ms, system_time_ms,
+        packets[i].packet_size, &timestamp_delta, &arrival_time_delta_ms,
+        &packet_size_delta);
+    EXPECT_EQ(computed, deltas[i].computed);
+    if (computed) {
+      EXPECT_EQ(timestamp_delta, deltas[i].timestamp_delta);
+      EXPECT_EQ(arrival_time_delta_ms, deltas[i].arrival_time_delta_ms);
+      EXPECT_EQ(packet_size_delta, deltas[i].packet_size_delta);
+    }
+  }
+}
 }  // namespace testing
 }  // namespace webrtc
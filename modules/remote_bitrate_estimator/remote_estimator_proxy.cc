@@ -29,6 +29,10 @@ const int RemoteEstimatorProxy::kMaxNumberOfPackets = (1 << 15);
 static constexpr int64_t kMaxTimeMs =
     std::numeric_limits<int64_t>::max() / 1000;
 
+// Sentinel for entries in |packet_arrival_times_| that have not been received.
+// Actual arrival times are guaranteed to be non-negative.
+static constexpr int64_t kMissingArrivalTime = -1;
+
 RemoteEstimatorProxy::RemoteEstimatorProxy(
     Clock* clock,
     TransportFeedbackSenderInterface* feedback_sender,
@@ -39,6 +43,7 @@ RemoteEstimatorProxy::RemoteEstimatorProxy(
       last_process_time_ms_(-1),
       media_ssrc_(0),
       feedback_packet_count_(0),
+      arrival_times_begin_seq_(0),
       send_interval_ms_(send_config_.default_interval->ms()),
       send_periodic_feedback_(true) {
   RTC_LOG(LS_INFO)
@@ -63,6 +68,23 @@ void RemoteEstimatorProxy::IncomingPacket(int64_t arrival_time_ms,
                   header.extension.feedback_request);
 }
 
+void RemoteEstimatorProxy::IncomingPackets(
+    rtc::ArrayView<const PacketArrival> packets) {
+  rtc::CritScope cs(&lock_);
+  for (const PacketArrival& packet : packets) {
+    if (!packet.header.extension.hasTransportSequenceNumber) {
+      RTC_LOG(LS_WARNING)
+          << "RemoteEstimatorProxy: Incoming packet "
+             "is missing the transport sequence number extension!";
+      continue;
+    }
+    media_ssrc_ = packet.header.ssrc;
+    OnPacketArrival(packet.header.extension.transportSequenceNumber,
+                    packet.arrival_time_ms,
+                    packet.header.extension.feedback_request);
+  }
+}
+
 bool RemoteEstimatorProxy::LatestEstimate(std::vector<unsigned int>* ssrcs,
                                           unsigned int* bitrate_bps) const {
   return false;
@@ -128,15 +150,26 @@ void RemoteEstimatorProxy::OnPacketArrival(
 
   int64_t seq = unwrapper_.Unwrap(sequence_number);
 
+  int64_t stored_end_seq =
+      arrival_times_begin_seq_ +
+      static_cast<int64_t>(packet_arrival_times_.size());
+  if (!packet_arrival_times_.empty() &&
+      stored_end_seq - seq > kMaxNumberOfPackets) {
+    // Too old to be covered by feedback; it would be culled immediately.
+    return;
+  }
+
   if (send_periodic_feedback_) {
-    if (periodic_window_start_seq_ &&
-        packet_arrival_times_.lower_bound(*periodic_window_start_seq_) ==
-            packet_arrival_times_.end()) {
+    if (periodic_window_start_seq_ && !packet_arrival_times_.empty() &&
+        *periodic_window_start_seq_ >= stored_end_seq) {
       // Start new feedback packet, cull old packets.
-      for (auto it = packet_arrival_times_.begin();
-           it != packet_arrival_times_.end() && it->first < seq &&
-           arrival_time - it->second >= send_config_.back_window->ms();) {
-        it = packet_arrival_times_.erase(it);
+      while (!packet_arrival_times_.empty() &&
+             arrival_times_begin_seq_ < seq &&
+             arrival_time - packet_arrival_times_.front() >=
+                 send_config_.back_window->ms()) {
+        packet_arrival_times_.pop_front();
+        ++arrival_times_begin_seq_;
+        CullMissingFront();
       }
     }
     if (!periodic_window_start_seq_ || seq < *periodic_window_start_seq_) {
@@ -144,23 +177,43 @@ void RemoteEstimatorProxy::OnPacketArrival(
     }
   }
 
-  // We are only interested in the first time a packet is received.
-  if (packet_arrival_times_.find(seq) != packet_arrival_times_.end())
-    return;
-
-  packet_arrival_times_[seq] = arrival_time;
+  if (packet_arrival_times_.empty()) {
+    arrival_times_begin_seq_ = seq;
+    packet_arrival_times_.push_back(arrival_time);
+  } else if (seq < arrival_times_begin_seq_) {
+    // A reordered packet older than anything stored; make room at the front.
+    packet_arrival_times_.insert(packet_arrival_times_.begin(),
+                                 arrival_times_begin_seq_ - seq,
+                                 kMissingArrivalTime);
+    arrival_times_begin_seq_ = seq;
+    packet_arrival_times_.front() = arrival_time;
+  } else if (seq >= stored_end_seq) {
+    packet_arrival_times_.insert(packet_arrival_times_.end(),
+                                 seq - stored_end_seq, kMissingArrivalTime);
+    packet_arrival_times_.push_back(arrival_time);
+  } else {
+    // We are only interested in the first time a packet is received.
+    int64_t& slot = packet_arrival_times_[seq - arrival_times_begin_seq_];
+    if (slot != kMissingArrivalTime)
+      return;
+    slot = arrival_time;
+  }
 
   // Limit the range of sequence numbers to send feedback for.
-  auto first_arrival_time_to_keep = packet_arrival_times_.lower_bound(
-      packet_arrival_times_.rbegin()->first - kMaxNumberOfPackets);
-  if (first_arrival_time_to_keep != packet_arrival_times_.begin()) {
-    packet_arrival_times_.erase(packet_arrival_times_.begin(),
-                                first_arrival_time_to_keep);
+  const int64_t last_seq = arrival_times_begin_seq_ +
+                           static_cast<int64_t>(packet_arrival_times_.size()) -
+                           1;
+  if (last_seq - arrival_times_begin_seq_ >= kMaxNumberOfPackets) {
+    while (arrival_times_begin_seq_ < last_seq - kMaxNumberOfPackets) {
+      packet_arrival_times_.pop_front();
+      ++arrival_times_begin_seq_;
+    }
+    CullMissingFront();
     if (send_periodic_feedback_) {
       // |packet_arrival_times_| cannot be empty since we just added one element
       // and the last element is not deleted.
       RTC_DCHECK(!packet_arrival_times_.empty());
-      periodic_window_start_seq_ = packet_arrival_times_.begin()->first;
+      periodic_window_start_seq_ = arrival_times_begin_seq_;
     }
   }
 
@@ -170,6 +223,14 @@ void RemoteEstimatorProxy::OnPacketArrival(
   }
 }
 
+void RemoteEstimatorProxy::CullMissingFront() {
+  while (!packet_arrival_times_.empty() &&
+         packet_arrival_times_.front() == kMissingArrivalTime) {
+    packet_arrival_times_.pop_front();
+    ++arrival_times_begin_seq_;
+  }
+}
+
 void RemoteEstimatorProxy::SendPeriodicFeedbacks() {
   // |periodic_window_start_seq_| is the first sequence number to include in the
   // current feedback packet. Some older may still be in the map, in case a
@@ -177,15 +238,25 @@ void RemoteEstimatorProxy::SendPeriodicFeedbacks() {
   if (!periodic_window_start_seq_)
     return;
 
-  for (auto begin_iterator =
-           packet_arrival_times_.lower_bound(*periodic_window_start_seq_);
-       begin_iterator != packet_arrival_times_.cend();
-       begin_iterator =
-           packet_arrival_times_.lower_bound(*periodic_window_start_seq_)) {
+  const int64_t stored_end_seq =
+      arrival_times_begin_seq_ +
+      static_cast<int64_t>(packet_arrival_times_.size());
+  while (true) {
+    // Find the first received packet at or after the window start.
+    int64_t begin_send_seq =
+        std::max(*periodic_window_start_seq_, arrival_times_begin_seq_);
+    while (begin_send_seq < stored_end_seq &&
+           packet_arrival_times_[begin_send_seq - arrival_times_begin_seq_] ==
+               kMissingArrivalTime) {
+      ++begin_send_seq;
+    }
+    if (begin_send_seq >= stored_end_seq)
+      break;
+
     rtcp::TransportFeedback feedback_packet;
     periodic_window_start_seq_ = BuildFeedbackPacket(
         feedback_packet_count_++, media_ssrc_, *periodic_window_start_seq_,
-        begin_iterator, packet_arrival_times_.cend(), &feedback_packet);
+        begin_send_seq, stored_end_seq, &feedback_packet);
 
     RTC_DCHECK(feedback_sender_ != nullptr);
     feedback_sender_->SendTransportFeedback(&feedback_packet);
@@ -205,16 +276,26 @@ void RemoteEstimatorProxy::SendFeedbackOnRequest(
 
   int64_t first_sequence_number =
       sequence_number - feedback_request.sequence_count + 1;
-  auto begin_iterator =
-      packet_arrival_times_.lower_bound(first_sequence_number);
-  auto end_iterator = packet_arrival_times_.upper_bound(sequence_number);
+
+  // Find the first received packet in the requested range. |sequence_number|
+  // itself was just stored, so there is always at least one packet to include.
+  int64_t begin_send_seq =
+      std::max(first_sequence_number, arrival_times_begin_seq_);
+  while (packet_arrival_times_[begin_send_seq - arrival_times_begin_seq_] ==
+         kMissingArrivalTime) {
+    ++begin_send_seq;
+  }
+  RTC_DCHECK_LE(begin_send_seq, sequence_number);
 
   BuildFeedbackPacket(feedback_packet_count_++, media_ssrc_,
-                      first_sequence_number, begin_iterator, end_iterator,
-                      &feedback_packet);
+                      first_sequence_number, begin_send_seq,
+                      sequence_number + 1, &feedback_packet);
 
   // Clear up to the first packet that is included in this feedback packet.
-  packet_arrival_times_.erase(packet_arrival_times_.begin(), begin_iterator);
+  while (arrival_times_begin_seq_ < begin_send_seq) {
+    packet_arrival_times_.pop_front();
+    ++arrival_times_begin_seq_;
+  }
 
   RTC_DCHECK(feedback_sender_ != nullptr);
   feedback_sender_->SendTransportFeedback(&feedback_packet);
@@ -224,10 +305,11 @@ int64_t RemoteEstimatorProxy::BuildFeedbackPacket(
     uint8_t feedback_packet_count,
     uint32_t media_ssrc,
     int64_t base_sequence_number,
-    std::map<int64_t, int64_t>::const_iterator begin_iterator,
-    std::map<int64_t, int64_t>::const_iterator end_iterator,
+    int64_t begin_sequence_number,
+    int64_t end_sequence_number,
     rtcp::TransportFeedback* feedback_packet) {
-  RTC_DCHECK(begin_iterator != end_iterator);
+  RTC_DCHECK_LT(begin_sequence_number, end_sequence_number);
+  RTC_DCHECK_GE(begin_sequence_number, arrival_times_begin_seq_);
 
   // TODO(sprang): Measure receive times in microseconds and remove the
   // conversions below.
@@ -235,22 +317,28 @@ int64_t RemoteEstimatorProxy::BuildFeedbackPacket(
   // Base sequence number is the expected first sequence number. This is known,
   // but we might not have actually received it, so the base time shall be the
   // time of the first received packet in the feedback.
-  feedback_packet->SetBase(static_cast<uint16_t>(base_sequence_number & 0xFFFF),
-                           begin_iterator->second * 1000);
+  feedback_packet->SetBase(
+      static_cast<uint16_t>(base_sequence_number & 0xFFFF),
+      packet_arrival_times_[begin_sequence_number - arrival_times_begin_seq_] *
+          1000);
   feedback_packet->SetFeedbackSequenceNumber(feedback_packet_count);
   int64_t next_sequence_number = base_sequence_number;
-  for (auto it = begin_iterator; it != end_iterator; ++it) {
-    if (!feedback_packet->AddReceivedPacket(
-            static_cast<uint16_t>(it->first & 0xFFFF), it->second * 1000)) {
+  for (int64_t seq = begin_sequence_number; seq < end_sequence_number; ++seq) {
+    int64_t arrival_time =
+        packet_arrival_times_[seq - arrival_times_begin_seq_];
+    if (arrival_time == kMissingArrivalTime)
+      continue;
+    if (!feedback_packet->AddReceivedPacket(static_cast<uint16_t>(seq & 0xFFFF),
+                                            arrival_time * 1000)) {
       // If we can't even add the first seq to the feedback packet, we won't be
       // able to build it at all.
-      RTC_CHECK(begin_iterator != it);
+      RTC_CHECK_GT(seq, begin_sequence_number);
 
       // Could not add timestamp, feedback packet might be full. Return and
       // try again with a fresh packet.
       break;
     }
-    next_sequence_number = it->first + 1;
+    next_sequence_number = seq + 1;
   }
   return next_sequence_number;
 }
@@ -11,9 +11,10 @@
 #ifndef MODULES_REMOTE_BITRATE_ESTIMATOR_REMOTE_ESTIMATOR_PROXY_H_
 #define MODULES_REMOTE_BITRATE_ESTIMATOR_REMOTE_ESTIMATOR_PROXY_H_
 
-#include <map>
+#include <deque>
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "modules/remote_bitrate_estimator/include/remote_bitrate_estimator.h"
 #include "rtc_base/critical_section.h"
@@ -39,9 +40,19 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
                        const WebRtcKeyValueConfig* key_value_config);
   ~RemoteEstimatorProxy() override;
 
+  struct PacketArrival {
+    int64_t arrival_time_ms;
+    size_t payload_size;
+    RTPHeader header;
+  };
+
   void IncomingPacket(int64_t arrival_time_ms,
                       size_t payload_size,
                       const RTPHeader& header) override;
+  // Batched version of IncomingPacket(). Takes the lock once for the whole
+  // batch, for receive paths that drain several packets from the socket in
+  // one go (e.g. recvmmsg).
+  void IncomingPackets(rtc::ArrayView<const PacketArrival> packets);
   void RemoveStream(uint32_t ssrc) override {}
   bool LatestEstimate(std::vector<unsigned int>* ssrcs,
                       unsigned int* bitrate_bps) const override;
@@ -77,15 +88,17 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
   void SendFeedbackOnRequest(int64_t sequence_number,
                              const FeedbackRequest& feedback_request)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
-  static int64_t BuildFeedbackPacket(
+  int64_t BuildFeedbackPacket(
       uint8_t feedback_packet_count,
       uint32_t media_ssrc,
       int64_t base_sequence_number,
-      std::map<int64_t, int64_t>::const_iterator
-          begin_iterator,  // |begin_iterator| is inclusive.
-      std::map<int64_t, int64_t>::const_iterator
-          end_iterator,  // |end_iterator| is exclusive.
-      rtcp::TransportFeedback* feedback_packet);
+      int64_t begin_sequence_number,  // |begin_sequence_number| is inclusive.
+      int64_t end_sequence_number,    // |end_sequence_number| is exclusive.
+      rtcp::TransportFeedback* feedback_packet)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
+  // Drops leading entries of |packet_arrival_times_| that have not been
+  // received, so that the ring always starts at a received packet.
+  void CullMissingFront() RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
 
   Clock* const clock_;
   TransportFeedbackSenderInterface* const feedback_sender_;
@@ -98,8 +111,12 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
   uint8_t feedback_packet_count_ RTC_GUARDED_BY(&lock_);
   SeqNumUnwrapper<uint16_t> unwrapper_ RTC_GUARDED_BY(&lock_);
   absl::optional<int64_t> periodic_window_start_seq_ RTC_GUARDED_BY(&lock_);
-  // Map unwrapped seq -> time.
-  std::map<int64_t, int64_t> packet_arrival_times_ RTC_GUARDED_BY(&lock_);
+  // Ring of arrival times indexed by unwrapped sequence number: the entry at
+  // index i holds the arrival time of the packet with sequence number
+  // |arrival_times_begin_seq_ + i|, or -1 if that packet has not (yet) been
+  // received. Gives O(1) insert on the hot per-packet path.
+  std::deque<int64_t> packet_arrival_times_ RTC_GUARDED_BY(&lock_);
+  int64_t arrival_times_begin_seq_ RTC_GUARDED_BY(&lock_);
   int64_t send_interval_ms_ RTC_GUARDED_BY(&lock_);
   bool send_periodic_feedback_ RTC_GUARDED_BY(&lock_);
 };
@@ -111,6 +111,30 @@ TEST_F(RemoteEstimatorProxyTest, SendsSinglePacketFeedback) {
   Process();
 }
 
+TEST_F(RemoteEstimatorProxyTest, SendsFeedbackForBatchedPackets) {
+  RemoteEstimatorProxy::PacketArrival packets[3];
+  for (int i = 0; i < 3; ++i) {
+    packets[i].arrival_time_ms = kBaseTimeMs + i;
+    packets[i].payload_size = kDefaultPacketSize;
+    packets[i].header.extension.hasTransportSequenceNumber = true;
+    packets[i].header.extension.transportSequenceNumber = kBaseSeq + i;
+    packets[i].header.ssrc = kMediaSsrc;
+  }
+  proxy_.IncomingPackets(packets);
+
+  EXPECT_CALL(router_, SendTransportFeedback(_))
+      .WillOnce(Invoke([](rtcp::TransportFeedback* feedback_packet) {
+        EXPECT_EQ(kBaseSeq, feedback_packet->GetBaseSequence());
+        EXPECT_THAT(SequenceNumbers(*feedback_packet),
+                    ElementsAre(kBaseSeq, kBaseSeq + 1, kBaseSeq + 2));
+        EXPECT_THAT(TimestampsMs(*feedback_packet),
+                    ElementsAre(kBaseTimeMs, kBaseTimeMs + 1, kBaseTimeMs + 2));
+        return true;
+      }));
+
+  Process();
+}
+
 TEST_F(RemoteEstimatorProxyTest, DuplicatedPackets) {
   IncomingPacket(kBaseSeq, kBaseTimeMs);
   IncomingPacket(kBaseSeq, kBaseTimeMs + 1000);
@@ -13,6 +13,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "absl/strings/string_view.h"
 
 namespace webrtc {
@@ -25,12 +27,29 @@ struct RtcpStatistics {
   uint32_t jitter = 0;
 };
 
+// One entry of a batched statistics update, see
+// RtcpStatisticsCallback::StatisticsBatchUpdated.
+struct RtcpStatisticsUpdate {
+  uint32_t ssrc = 0;
+  RtcpStatistics statistics;
+};
+
 class RtcpStatisticsCallback {
  public:
   virtual ~RtcpStatisticsCallback() {}
 
   virtual void StatisticsUpdated(const RtcpStatistics& statistics,
                                  uint32_t ssrc) = 0;
+
+  // Called once per parsed RTCP compound packet, with every report block the
+  // packet carried. The default implementation forwards the entries one by
+  // one to StatisticsUpdated(); observers that want to process a compound
+  // packet in a single call can override this instead.
+  virtual void StatisticsBatchUpdated(
+      const std::vector<RtcpStatisticsUpdate>& updates) {
+    for (const RtcpStatisticsUpdate& update : updates)
+      StatisticsUpdated(update.statistics, update.ssrc);
+  }
 };
 
 // Statistics for RTCP packet types.
@@ -42,7 +42,11 @@ class RtpHeaderExtensionMap {
     return GetId(type) != kInvalidId;
   }
   // Return kInvalidType if not found.
-  RTPExtensionType GetType(int id) const;
+  RTPExtensionType GetType(int id) const {
+    RTC_DCHECK_GE(id, RtpExtension::kMinId);
+    RTC_DCHECK_LE(id, RtpExtension::kMaxId);
+    return types_[id];
+  }
   // Return kInvalidId if not found.
   uint8_t GetId(RTPExtensionType type) const {
     RTC_DCHECK_GT(type, kRtpExtensionNone);
@@ -68,6 +72,11 @@ class RtpHeaderExtensionMap {
   bool Register(int id, RTPExtensionType type, const char* uri);
 
   uint8_t ids_[kRtpExtensionNumberOfExtensions];
+  // Reverse mapping of |ids_|, so that identifying the type of an incoming
+  // extension element is a single array read. Parsing does one GetType() call
+  // per extension element per packet, which makes this lookup hot on the
+  // receive path.
+  RTPExtensionType types_[RtpExtension::kMaxId + 1];
   bool extmap_allow_mixed_;
 };
 
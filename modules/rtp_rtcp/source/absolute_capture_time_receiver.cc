@@ -23,9 +23,7 @@ constexpr Timestamp kInvalidLastReceiveTime = Timestamp::MinusInfinity();
 constexpr TimeDelta AbsoluteCaptureTimeReceiver::kInterpolationMaxInterval;
 
 AbsoluteCaptureTimeReceiver::AbsoluteCaptureTimeReceiver(Clock* clock)
-    : clock_(clock),
-      remote_to_local_clock_offset_(absl::nullopt),
-      last_receive_time_(kInvalidLastReceiveTime) {}
+    : clock_(clock), last_receive_time_(kInvalidLastReceiveTime) {}
 
 uint32_t AbsoluteCaptureTimeReceiver::GetSource(
     uint32_t ssrc,
@@ -39,9 +37,42 @@ uint32_t AbsoluteCaptureTimeReceiver::GetSource(
 
 void AbsoluteCaptureTimeReceiver::SetRemoteToLocalClockOffset(
     absl::optional<int64_t> value_q32x32) {
-  rtc::CritScope cs(&crit_);
+  // Mark the snapshot as being written (odd version), update the fields, then
+  // publish the new even version. The release fence keeps the field stores
+  // from being reordered above the odd-version store; a release store alone
+  // only orders the operations preceding it.
+  const uint32_t version =
+      clock_offset_version_.load(std::memory_order_relaxed);
+  clock_offset_version_.store(version + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  clock_offset_value_.store(value_q32x32.value_or(0),
+                            std::memory_order_relaxed);
+  clock_offset_has_value_.store(value_q32x32.has_value(),
+                                std::memory_order_relaxed);
+  clock_offset_version_.store(version + 2, std::memory_order_release);
+}
 
-  remote_to_local_clock_offset_ = value_q32x32;
+absl::optional<int64_t>
+AbsoluteCaptureTimeReceiver::ReadRemoteToLocalClockOffset() const {
+  while (true) {
+    const uint32_t version_before =
+        clock_offset_version_.load(std::memory_order_acquire);
+    if (version_before & 1) {
+      // A write is in flight; it finishes in a handful of instructions.
+      continue;
+    }
+    const int64_t value = clock_offset_value_.load(std::memory_order_relaxed);
+    const bool has_value =
+        clock_offset_has_value_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (clock_offset_version_.load(std::memory_order_relaxed) ==
+        version_before) {
+      if (!has_value) {
+        return absl::nullopt;
+      }
+      return value;
+    }
+  }
 }
 
 absl::optional<AbsoluteCaptureTime>
@@ -50,10 +81,9 @@ AbsoluteCaptureTimeReceiver::OnReceivePacket(
     uint32_t rtp_timestamp,
     uint32_t rtp_clock_frequency,
     const absl::optional<AbsoluteCaptureTime>& received_extension) {
+  RTC_CHECK_RUNS_SERIALIZED(&packet_race_checker_);
   const Timestamp receive_time = clock_->CurrentTime();
 
-  rtc::CritScope cs(&crit_);
-
   AbsoluteCaptureTime extension;
   if (received_extension == absl::nullopt) {
     if (!ShouldInterpolateExtension(receive_time, source, rtp_timestamp,
@@ -82,11 +112,68 @@ AbsoluteCaptureTimeReceiver::OnReceivePacket(
   }
 
   extension.estimated_capture_clock_offset = AdjustEstimatedCaptureClockOffset(
-      extension.estimated_capture_clock_offset);
+      extension.estimated_capture_clock_offset,
+      ReadRemoteToLocalClockOffset());
 
   return extension;
 }
 
+void AbsoluteCaptureTimeReceiver::OnReceivePacketBatch(
+    uint32_t source,
+    uint32_t rtp_clock_frequency,
+    rtc::ArrayView<PacketExtension> packets) {
+  RTC_CHECK_RUNS_SERIALIZED(&packet_race_checker_);
+  const Timestamp receive_time = clock_->CurrentTime();
+  const absl::optional<int64_t> remote_to_local_clock_offset =
+      ReadRemoteToLocalClockOffset();
+
+  // Whether packets without the extension can be interpolated off the stored
+  // state. Evaluated lazily for the leading run of extension-less packets and
+  // kept up to date as packets carrying the extension refresh the state.
+  absl::optional<bool> can_interpolate;
+  for (PacketExtension& packet : packets) {
+    if (packet.extension == absl::nullopt) {
+      if (!can_interpolate.has_value()) {
+        can_interpolate = ShouldInterpolateExtension(
+            receive_time, source, packet.rtp_timestamp, rtp_clock_frequency);
+      }
+      if (!*can_interpolate) {
+        last_receive_time_ = kInvalidLastReceiveTime;
+        continue;
+      }
+
+      AbsoluteCaptureTime extension;
+      extension.absolute_capture_timestamp =
+          InterpolateAbsoluteCaptureTimestamp(
+              packet.rtp_timestamp, rtp_clock_frequency, last_rtp_timestamp_,
+              last_absolute_capture_timestamp_);
+      extension.estimated_capture_clock_offset = AdjustEstimatedCaptureClockOffset(
+          last_estimated_capture_clock_offset_, remote_to_local_clock_offset);
+      packet.extension = extension;
+    } else {
+      last_source_ = source;
+      last_rtp_timestamp_ = packet.rtp_timestamp;
+      last_rtp_clock_frequency_ = rtp_clock_frequency;
+      last_absolute_capture_timestamp_ =
+          packet.extension->absolute_capture_timestamp;
+      last_estimated_capture_clock_offset_ =
+          packet.extension->estimated_capture_clock_offset;
+
+      last_receive_time_ = receive_time;
+
+      // Later extension-less packets in the burst interpolate off this
+      // packet, which trivially satisfies the preconditions (unless the
+      // clock frequency is invalid).
+      can_interpolate = rtp_clock_frequency > 0;
+
+      packet.extension->estimated_capture_clock_offset =
+          AdjustEstimatedCaptureClockOffset(
+              packet.extension->estimated_capture_clock_offset,
+              remote_to_local_clock_offset);
+    }
+  }
+}
+
 uint64_t AbsoluteCaptureTimeReceiver::InterpolateAbsoluteCaptureTimestamp(
     uint32_t rtp_timestamp,
     uint32_t rtp_clock_frequency,
@@ -136,15 +223,16 @@ bool AbsoluteCaptureTimeReceiver::ShouldInterpolateExtension(
 
 absl::optional<int64_t>
 AbsoluteCaptureTimeReceiver::AdjustEstimatedCaptureClockOffset(
-    absl::optional<int64_t> received_value) const {
+    absl::optional<int64_t> received_value,
+    absl::optional<int64_t> remote_to_local_clock_offset) {
   if (received_value == absl::nullopt ||
-      remote_to_local_clock_offset_ == absl::nullopt) {
+      remote_to_local_clock_offset == absl::nullopt) {
     return absl::nullopt;
   }
 
   // Do calculations as "unsigned" to make overflows deterministic.
   return static_cast<uint64_t>(*received_value) +
-         static_cast<uint64_t>(*remote_to_local_clock_offset_);
+         static_cast<uint64_t>(*remote_to_local_clock_offset);
 }
 
 }  // namespace webrtc
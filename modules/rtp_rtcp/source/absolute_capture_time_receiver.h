@@ -11,12 +11,13 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_ABSOLUTE_CAPTURE_TIME_RECEIVER_H_
 #define MODULES_RTP_RTCP_SOURCE_ABSOLUTE_CAPTURE_TIME_RECEIVER_H_
 
+#include <atomic>
+
 #include "api/array_view.h"
 #include "api/rtp_headers.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
-#include "rtc_base/critical_section.h"
-#include "rtc_base/thread_annotations.h"
+#include "rtc_base/race_checker.h"
 #include "system_wrappers/include/clock.h"
 
 namespace webrtc {
@@ -31,6 +32,11 @@ namespace webrtc {
 //   combination with RTP timestamps of packets without abs-capture-time, to
 //   extrapolate missing capture timestamps.
 //
+// The interpolation state is only touched by the packet path, which is
+// expected to be serialized, so OnReceivePacket() is lock free. The clock
+// offset set by SetRemoteToLocalClockOffset() may come from another thread
+// and is published through a versioned (seqlock style) snapshot.
+//
 // See: https://webrtc.org/experiments/rtp-hdrext/abs-capture-time/
 //
 class AbsoluteCaptureTimeReceiver {
@@ -50,6 +56,8 @@ class AbsoluteCaptureTimeReceiver {
   // by RTCP sender reports (see DLSR/DLRR).
   //
   // Note that the value must be in Q32.32-formatted fixed-point seconds.
+  // Concurrent calls must be externally serialized (in practice there is a
+  // single RTCP thread), but calls may race with the packet path.
   void SetRemoteToLocalClockOffset(absl::optional<int64_t> value_q32x32);
 
   // Returns a received header extension, an interpolated header extension, or
@@ -60,6 +68,24 @@ class AbsoluteCaptureTimeReceiver {
       uint32_t rtp_clock_frequency,
       const absl::optional<AbsoluteCaptureTime>& received_extension);
 
+  // One packet of a burst handed to OnReceivePacketBatch(). |extension| holds
+  // the received header extension on input (or |absl::nullopt|) and is
+  // overwritten with the received, interpolated or absent result, exactly as
+  // OnReceivePacket() would have returned for that packet.
+  struct PacketExtension {
+    uint32_t rtp_timestamp;
+    absl::optional<AbsoluteCaptureTime> extension;
+  };
+
+  // Batch variant of OnReceivePacket() for a burst of packets from the same
+  // capture system sharing one RTP clock frequency. Equivalent to calling
+  // OnReceivePacket() per packet in order, but samples the clock, reads the
+  // published clock offset and validates the interpolation preconditions once
+  // per burst instead of once per packet.
+  void OnReceivePacketBatch(uint32_t source,
+                            uint32_t rtp_clock_frequency,
+                            rtc::ArrayView<PacketExtension> packets);
+
  private:
   friend class AbsoluteCaptureTimeSender;
 
@@ -69,30 +95,39 @@ class AbsoluteCaptureTimeReceiver {
       uint32_t last_rtp_timestamp,
       uint64_t last_absolute_capture_timestamp);
 
+  // Reads a consistent snapshot of the offset published by
+  // SetRemoteToLocalClockOffset(), retrying if a write is in flight.
+  absl::optional<int64_t> ReadRemoteToLocalClockOffset() const;
+
+  static absl::optional<int64_t> AdjustEstimatedCaptureClockOffset(
+      absl::optional<int64_t> received_value,
+      absl::optional<int64_t> remote_to_local_clock_offset);
+
   bool ShouldInterpolateExtension(Timestamp receive_time,
                                   uint32_t source,
                                   uint32_t rtp_timestamp,
-                                  uint32_t rtp_clock_frequency) const
-      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
-
-  absl::optional<int64_t> AdjustEstimatedCaptureClockOffset(
-      absl::optional<int64_t> received_value) const
-      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+                                  uint32_t rtp_clock_frequency) const;
 
   Clock* const clock_;
 
-  rtc::CriticalSection crit_;
+  // Guards the interpolation state below; packets must be processed on one
+  // thread at a time.
+  rtc::RaceChecker packet_race_checker_;
 
-  absl::optional<int64_t> remote_to_local_clock_offset_ RTC_GUARDED_BY(crit_);
+  // Versioned snapshot of the remote-to-local clock offset. The version is
+  // odd while a write is in progress; readers retry until they observe the
+  // same even version around both field loads.
+  std::atomic<uint32_t> clock_offset_version_{0};
+  std::atomic<int64_t> clock_offset_value_{0};
+  std::atomic<bool> clock_offset_has_value_{false};
 
-  Timestamp last_receive_time_ RTC_GUARDED_BY(crit_);
+  Timestamp last_receive_time_;
 
-  uint32_t last_source_ RTC_GUARDED_BY(crit_);
-  uint32_t last_rtp_timestamp_ RTC_GUARDED_BY(crit_);
-  uint32_t last_rtp_clock_frequency_ RTC_GUARDED_BY(crit_);
-  uint64_t last_absolute_capture_timestamp_ RTC_GUARDED_BY(crit_);
-  absl::optional<int64_t> last_estimated_capture_clock_offset_
-      RTC_GUARDED_BY(crit_);
+  uint32_t last_source_;
+  uint32_t last_rtp_timestamp_;
+  uint32_t last_rtp_clock_frequency_;
+  uint64_t last_absolute_capture_timestamp_;
+  absl::optional<int64_t> last_estimated_capture_clock_offset_;
 };  // AbsoluteCaptureTimeReceiver
 
 }  // namespace webrtc
@@ -413,4 +413,56 @@ TEST(AbsoluteCaptureTimeReceiverTest, SkipInterpolateIsSticky) {
                    .has_value());
 }
 
+TEST(AbsoluteCaptureTimeReceiverTest, BatchMatchesPerPacketInterpolation) {
+  constexpr uint32_t kSource = 1337;
+  constexpr uint32_t kRtpClockFrequency = 64000;
+  constexpr uint32_t kRtpTimestamp0 = 1020300000;
+  static const absl::optional<AbsoluteCaptureTime> kExtension0 =
+      AbsoluteCaptureTime{Int64MsToUQ32x32(9000), Int64MsToQ32x32(-350)};
+
+  SimulatedClock clock(0);
+  AbsoluteCaptureTimeReceiver batch_receiver(&clock);
+  AbsoluteCaptureTimeReceiver per_packet_receiver(&clock);
+
+  batch_receiver.SetRemoteToLocalClockOffset(Int64MsToQ32x32(-7000000));
+  per_packet_receiver.SetRemoteToLocalClockOffset(Int64MsToQ32x32(-7000000));
+
+  // A burst: one packet carrying the extension followed by three that have to
+  // be interpolated.
+  AbsoluteCaptureTimeReceiver::PacketExtension packets[] = {
+      {kRtpTimestamp0, kExtension0},
+      {kRtpTimestamp0 + 1280, absl::nullopt},
+      {kRtpTimestamp0 + 2560, absl::nullopt},
+      {kRtpTimestamp0 + 3840, absl::nullopt},
+  };
+  batch_receiver.OnReceivePacketBatch(kSource, kRtpClockFrequency, packets);
+
+  for (const AbsoluteCaptureTimeReceiver::PacketExtension& packet : packets) {
+    const absl::optional<AbsoluteCaptureTime> expected =
+        per_packet_receiver.OnReceivePacket(
+            kSource, packet.rtp_timestamp, kRtpClockFrequency,
+            packet.rtp_timestamp == kRtpTimestamp0 ? kExtension0
+                                                   : absl::nullopt);
+    EXPECT_EQ(packet.extension, expected);
+  }
+}
+
+TEST(AbsoluteCaptureTimeReceiverTest, BatchWithoutStoredStateReturnsNothing) {
+  constexpr uint32_t kSource = 1337;
+  constexpr uint32_t kRtpClockFrequency = 64000;
+  constexpr uint32_t kRtpTimestamp0 = 1020300000;
+
+  SimulatedClock clock(0);
+  AbsoluteCaptureTimeReceiver receiver(&clock);
+
+  AbsoluteCaptureTimeReceiver::PacketExtension packets[] = {
+      {kRtpTimestamp0, absl::nullopt},
+      {kRtpTimestamp0 + 1280, absl::nullopt},
+  };
+  receiver.OnReceivePacketBatch(kSource, kRtpClockFrequency, packets);
+
+  EXPECT_FALSE(packets[0].extension.has_value());
+  EXPECT_FALSE(packets[1].extension.has_value());
+}
+
 }  // namespace webrtc
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_ATOMIC_STREAM_DATA_COUNTERS_H_
+#define MODULES_RTP_RTCP_SOURCE_ATOMIC_STREAM_DATA_COUNTERS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet.h"
+
+namespace webrtc {
+
+// Lock-free mirror of StreamDataCounters. The counter block is cache-line
+// aligned and updated with relaxed atomic increments from the packet path;
+// stats queries read it as a snapshot without taking any lock. The fields
+// are read independently, so a snapshot taken concurrently with a send may
+// be off by the packet in flight, which is fine for monotonic totals.
+class alignas(64) AtomicStreamDataCounters {
+ public:
+  AtomicStreamDataCounters() = default;
+
+  // Adds |packet| to the transmitted counters, and additionally to the fec
+  // or retransmitted counters when flagged as such.
+  void OnPacketSent(const RtpPacket& packet,
+                    bool is_fec,
+                    bool is_retransmit,
+                    int64_t now_ms) {
+    if (first_packet_time_ms_.load(std::memory_order_relaxed) == -1) {
+      int64_t expected = -1;
+      first_packet_time_ms_.compare_exchange_strong(expected, now_ms,
+                                                    std::memory_order_relaxed);
+    }
+    if (is_fec)
+      fec_.AddPacket(packet);
+    if (is_retransmit)
+      retransmitted_.AddPacket(packet);
+    transmitted_.AddPacket(packet);
+  }
+
+  StreamDataCounters GetSnapshot() const {
+    StreamDataCounters counters;
+    counters.first_packet_time_ms =
+        first_packet_time_ms_.load(std::memory_order_relaxed);
+    counters.transmitted = transmitted_.GetSnapshot();
+    counters.retransmitted = retransmitted_.GetSnapshot();
+    counters.fec = fec_.GetSnapshot();
+    return counters;
+  }
+
+ private:
+  struct AtomicPacketCounter {
+    void AddPacket(const RtpPacket& packet) {
+      packets.fetch_add(1, std::memory_order_relaxed);
+      header_bytes.fetch_add(packet.headers_size(),
+                             std::memory_order_relaxed);
+      padding_bytes.fetch_add(packet.padding_size(),
+                              std::memory_order_relaxed);
+      payload_bytes.fetch_add(packet.payload_size(),
+                              std::memory_order_relaxed);
+    }
+
+    RtpPacketCounter GetSnapshot() const {
+      RtpPacketCounter counter;
+      counter.header_bytes =
+          static_cast<size_t>(header_bytes.load(std::memory_order_relaxed));
+      counter.payload_bytes =
+          static_cast<size_t>(payload_bytes.load(std::memory_order_relaxed));
+      counter.padding_bytes =
+          static_cast<size_t>(padding_bytes.load(std::memory_order_relaxed));
+      counter.packets = packets.load(std::memory_order_relaxed);
+      return counter;
+    }
+
+    std::atomic<uint64_t> header_bytes{0};
+    std::atomic<uint64_t> payload_bytes{0};
+    std::atomic<uint64_t> padding_bytes{0};
+    std::atomic<uint32_t> packets{0};
+  };
+
+  std::atomic<int64_t> first_packet_time_ms_{-1};
+  AtomicPacketCounter transmitted_;
+  AtomicPacketCounter retransmitted_;
+  AtomicPacketCounter fec_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_ATOMIC_STREAM_DATA_COUNTERS_H_
@@ -25,12 +25,81 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/mod_ops.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
 namespace {
 // Transport header size in bytes. Assume UDP/IPv4 as a reasonable minimum.
 constexpr size_t kTransportOverhead = 28;
+
+// XORs |length| bytes from |src| into |dst|. Plain C version; processes one
+// machine word at a time. The buffers may be mutually misaligned, so loads
+// and stores go through memcpy, which compiles to single unaligned accesses.
+void XorBytes_C(uint8_t* dst, const uint8_t* src, size_t length) {
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t s;
+    uint64_t d;
+    memcpy(&s, &src[i], sizeof(uint64_t));
+    memcpy(&d, &dst[i], sizeof(uint64_t));
+    d ^= s;
+    memcpy(&dst[i], &d, sizeof(uint64_t));
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void XorBytes_SSE2(uint8_t* dst, const uint8_t* src, size_t length) {
+  size_t i = 0;
+  for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+    const __m128i s =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<__m128i*>(&dst[i]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]),
+                     _mm_xor_si128(d, s));
+  }
+  XorBytes_C(&dst[i], &src[i], length - i);
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+void XorBytes_NEON(uint8_t* dst, const uint8_t* src, size_t length) {
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16) {
+    vst1q_u8(&dst[i], veorq_u8(vld1q_u8(&dst[i]), vld1q_u8(&src[i])));
+  }
+  XorBytes_C(&dst[i], &src[i], length - i);
+}
+#endif
+
+// XORs |length| bytes from |src| into |dst| using the widest XOR the platform
+// supports, dispatched once at runtime. Payload XOR dominates both FEC
+// encoding (FlexfecSender/UlpfecGenerator) and recovery (FlexfecReceiver), so
+// this runs once per protected packet per FEC packet.
+void XorBytes(uint8_t* dst, const uint8_t* src, size_t length) {
+  static void (*xor_proc)(uint8_t*, const uint8_t*, size_t) = nullptr;
+  if (!xor_proc) {
+#if defined(WEBRTC_HAS_NEON)
+    xor_proc = &XorBytes_NEON;
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+    xor_proc = WebRtc_GetCPUInfo(kSSE2) != 0 ? &XorBytes_SSE2 : &XorBytes_C;
+#else
+    xor_proc = &XorBytes_C;
+#endif
+  }
+  xor_proc(dst, src, length);
+}
 }  // namespace
 
 ForwardErrorCorrection::Packet::Packet() : length(0), data(), ref_count_(0) {}
@@ -611,9 +680,7 @@ void ForwardErrorCorrection::XorPayloads(const Packet& src,
   // XOR the payload.
   RTC_DCHECK_LE(kRtpHeaderSize + payload_length, sizeof(src.data));
   RTC_DCHECK_LE(dst_offset + payload_length, sizeof(dst->data));
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst->data[dst_offset + i] ^= src.data[kRtpHeaderSize + i];
-  }
+  XorBytes(&dst->data[dst_offset], &src.data[kRtpHeaderSize], payload_length);
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
@@ -324,15 +324,19 @@ std::unique_ptr<ReceiveStatistics> ReceiveStatistics::Create(Clock* clock) {
   return absl::make_unique<ReceiveStatisticsImpl>(clock);
 }
 
+constexpr size_t ReceiveStatisticsImpl::kStatisticianShards;
+
 ReceiveStatisticsImpl::ReceiveStatisticsImpl(Clock* clock)
     : clock_(clock),
       last_returned_ssrc_(0),
       max_reordering_threshold_(kDefaultMaxReorderingThreshold) {}
 
 ReceiveStatisticsImpl::~ReceiveStatisticsImpl() {
-  while (!statisticians_.empty()) {
-    delete statisticians_.begin()->second;
-    statisticians_.erase(statisticians_.begin());
+  for (StatisticianShard& shard : shards_) {
+    while (!shard.statisticians.empty()) {
+      delete shard.statisticians.begin()->second;
+      shard.statisticians.erase(shard.statisticians.begin());
+    }
   }
 }
 
@@ -346,30 +350,49 @@ void ReceiveStatisticsImpl::OnRtpPacket(const RtpPacketReceived& packet) {
 
 StreamStatisticianImpl* ReceiveStatisticsImpl::GetStatistician(
     uint32_t ssrc) const {
-  rtc::CritScope cs(&receive_statistics_lock_);
-  const auto& it = statisticians_.find(ssrc);
-  if (it == statisticians_.end())
+  const StatisticianShard& shard = ShardForSsrc(ssrc);
+  rtc::CritScope cs(&shard.lock);
+  const auto& it = shard.statisticians.find(ssrc);
+  if (it == shard.statisticians.end())
     return NULL;
   return it->second;
 }
 
 StreamStatisticianImpl* ReceiveStatisticsImpl::GetOrCreateStatistician(
     uint32_t ssrc) {
-  rtc::CritScope cs(&receive_statistics_lock_);
-  StreamStatisticianImpl*& impl = statisticians_[ssrc];
+  StatisticianShard& shard = ShardForSsrc(ssrc);
+  {
+    rtc::CritScope cs(&shard.lock);
+    const auto& it = shard.statisticians.find(ssrc);
+    if (it != shard.statisticians.end())
+      return it->second;
+  }
+  // New SSRC; read the default reordering threshold outside the shard lock to
+  // keep lock ordering trivial, then insert unless another thread raced us.
+  int max_reordering_threshold;
+  {
+    rtc::CritScope cs(&receive_statistics_lock_);
+    max_reordering_threshold = max_reordering_threshold_;
+  }
+  rtc::CritScope cs(&shard.lock);
+  StreamStatisticianImpl*& impl = shard.statisticians[ssrc];
   if (impl == nullptr) {  // new element
-    impl = new StreamStatisticianImpl(ssrc, clock_, max_reordering_threshold_);
+    impl = new StreamStatisticianImpl(ssrc, clock_, max_reordering_threshold);
   }
   return impl;
 }
 
 void ReceiveStatisticsImpl::SetMaxReorderingThreshold(
     int max_reordering_threshold) {
-  std::map<uint32_t, StreamStatisticianImpl*> statisticians;
   {
     rtc::CritScope cs(&receive_statistics_lock_);
     max_reordering_threshold_ = max_reordering_threshold;
-    statisticians = statisticians_;
+  }
+  std::map<uint32_t, StreamStatisticianImpl*> statisticians;
+  for (StatisticianShard& shard : shards_) {
+    rtc::CritScope cs(&shard.lock);
+    statisticians.insert(shard.statisticians.begin(),
+                         shard.statisticians.end());
   }
   for (auto& statistician : statisticians) {
     statistician.second->SetMaxReorderingThreshold(max_reordering_threshold);
@@ -390,10 +413,13 @@ void ReceiveStatisticsImpl::EnableRetransmitDetection(uint32_t ssrc,
 
 std::vector<rtcp::ReportBlock> ReceiveStatisticsImpl::RtcpReportBlocks(
     size_t max_blocks) {
+  // Snapshot the statisticians one shard at a time; the packet path for other
+  // shards is never blocked while the report blocks are put together.
   std::map<uint32_t, StreamStatisticianImpl*> statisticians;
-  {
-    rtc::CritScope cs(&receive_statistics_lock_);
-    statisticians = statisticians_;
+  for (StatisticianShard& shard : shards_) {
+    rtc::CritScope cs(&shard.lock);
+    statisticians.insert(shard.statisticians.begin(),
+                         shard.statisticians.end());
   }
   std::vector<rtcp::ReportBlock> result;
   result.reserve(std::min(max_blocks, statisticians.size()));
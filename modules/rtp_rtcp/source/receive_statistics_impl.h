@@ -123,14 +123,30 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
   void EnableRetransmitDetection(uint32_t ssrc, bool enable) override;
 
  private:
+  // The per-SSRC statisticians are split across several independently locked
+  // shards so that packet accounting on one receive thread does not contend
+  // with accounting for other SSRCs or with report-block generation, which
+  // only holds one shard lock at a time while snapshotting.
+  static constexpr size_t kStatisticianShards = 16;
+  struct StatisticianShard {
+    rtc::CriticalSection lock;
+    std::map<uint32_t, StreamStatisticianImpl*> statisticians
+        RTC_GUARDED_BY(lock);
+  };
+
+  StatisticianShard& ShardForSsrc(uint32_t ssrc) {
+    return shards_[ssrc % kStatisticianShards];
+  }
+  const StatisticianShard& ShardForSsrc(uint32_t ssrc) const {
+    return shards_[ssrc % kStatisticianShards];
+  }
   StreamStatisticianImpl* GetOrCreateStatistician(uint32_t ssrc);
 
   Clock* const clock_;
   rtc::CriticalSection receive_statistics_lock_;
   uint32_t last_returned_ssrc_;
   int max_reordering_threshold_ RTC_GUARDED_BY(receive_statistics_lock_);
-  std::map<uint32_t, StreamStatisticianImpl*> statisticians_
-      RTC_GUARDED_BY(receive_statistics_lock_);
+  StatisticianShard shards_[kStatisticianShards];
 };
 }  // namespace webrtc
 #endif  // MODULES_RTP_RTCP_SOURCE_RECEIVE_STATISTICS_IMPL_H_
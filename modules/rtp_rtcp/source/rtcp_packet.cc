@@ -10,13 +10,109 @@
 
 #include "modules/rtp_rtcp/source/rtcp_packet.h"
 
+#include <cstddef>
+#include <new>
+#include <vector>
+
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
 namespace rtcp {
+namespace {
+
+// Header stored in front of every pooled allocation, padded so the packet
+// object behind it stays maximally aligned.
+struct alignas(alignof(std::max_align_t)) BlockHeader {
+  size_t size_class;
+};
+
+// Per-thread free lists of packet object storage, bucketed by size. RTCP
+// senders allocate a handful of small packet objects per stream per report
+// interval and free them right after serialization; with thousands of
+// streams that malloc/free churn is significant, while the pooled blocks
+// here are reused report after report.
+class RtcpPacketAllocator {
+ public:
+  static RtcpPacketAllocator& ForCurrentThread() {
+    thread_local RtcpPacketAllocator allocator;
+    return allocator;
+  }
+
+  ~RtcpPacketAllocator() {
+    for (auto& free_list : free_lists_) {
+      for (void* block : free_list)
+        ::operator delete(block);
+    }
+  }
+
+  void* Allocate(size_t size) {
+    size_t size_class = SizeClass(size);
+    if (size_class < kNumSizeClasses && !free_lists_[size_class].empty()) {
+      void* block = free_lists_[size_class].back();
+      free_lists_[size_class].pop_back();
+      return Payload(block);
+    }
+    void* block =
+        ::operator new(sizeof(BlockHeader) + PayloadSize(size_class, size));
+    static_cast<BlockHeader*>(block)->size_class = size_class;
+    return Payload(block);
+  }
+
+  void Free(void* payload) {
+    void* block = static_cast<uint8_t*>(payload) - sizeof(BlockHeader);
+    size_t size_class = static_cast<BlockHeader*>(block)->size_class;
+    if (size_class < kNumSizeClasses &&
+        free_lists_[size_class].size() < kMaxBlocksPerClass) {
+      free_lists_[size_class].push_back(block);
+      return;
+    }
+    ::operator delete(block);
+  }
+
+ private:
+  // Blocks are bucketed in 32 byte steps; objects above 1 kB (none of the
+  // current packet types come close) are not pooled.
+  static constexpr size_t kSizeClassShift = 5;
+  static constexpr size_t kNumSizeClasses = 32;
+  static constexpr size_t kMaxBlocksPerClass = 16;
+
+  static size_t SizeClass(size_t size) {
+    return size >> kSizeClassShift;
+  }
+
+  static size_t PayloadSize(size_t size_class, size_t size) {
+    if (size_class >= kNumSizeClasses)
+      return size;
+    // Round up to the top of the size class so the block is reusable for any
+    // allocation in the same class.
+    return (size_class + 1) << kSizeClassShift;
+  }
+
+  static void* Payload(void* block) {
+    return static_cast<uint8_t*>(block) + sizeof(BlockHeader);
+  }
+
+  std::vector<void*> free_lists_[kNumSizeClasses];
+};
+
+constexpr size_t RtcpPacketAllocator::kNumSizeClasses;
+constexpr size_t RtcpPacketAllocator::kMaxBlocksPerClass;
+
+}  // namespace
+
 constexpr size_t RtcpPacket::kHeaderLength;
 
+void* RtcpPacket::operator new(size_t size) {
+  return RtcpPacketAllocator::ForCurrentThread().Allocate(size);
+}
+
+void RtcpPacket::operator delete(void* ptr) {
+  if (ptr == nullptr)
+    return;
+  RtcpPacketAllocator::ForCurrentThread().Free(ptr);
+}
+
 rtc::Buffer RtcpPacket::Build() const {
   rtc::Buffer packet(BlockLength());
 
@@ -58,6 +58,12 @@ class RtcpPacket {
 
   virtual ~RtcpPacket() {}
 
+  // Packet objects are built per report group, per stream, per interval and
+  // torn down right after serialization, so their storage is recycled
+  // through a per-thread pool instead of hitting the allocator every time.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   // Convenience method mostly used for test. Creates packet without
   // fragmentation using BlockLength() to allocate big enough buffer.
   rtc::Buffer Build() const;
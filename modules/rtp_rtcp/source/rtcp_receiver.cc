@@ -209,15 +209,12 @@ int32_t RTCPReceiver::RTT(uint32_t remote_ssrc,
                           int64_t* max_rtt_ms) const {
   rtc::CritScope lock(&rtcp_receiver_lock_);
 
-  auto it = received_report_blocks_.find(main_ssrc_);
+  auto it =
+      received_report_blocks_.find(ReportBlockMapKey(main_ssrc_, remote_ssrc));
   if (it == received_report_blocks_.end())
     return -1;
 
-  auto it_info = it->second.find(remote_ssrc);
-  if (it_info == it->second.end())
-    return -1;
-
-  const ReportBlockData* report_block_data = &it_info->second;
+  const ReportBlockData* report_block_data = &it->second;
 
   if (report_block_data->num_rtts() == 0)
     return -1;
@@ -311,18 +308,16 @@ int32_t RTCPReceiver::StatisticsReceived(
     std::vector<RTCPReportBlock>* receive_blocks) const {
   RTC_DCHECK(receive_blocks);
   rtc::CritScope lock(&rtcp_receiver_lock_);
-  for (const auto& reports_per_receiver : received_report_blocks_)
-    for (const auto& report : reports_per_receiver.second)
-      receive_blocks->push_back(report.second.report_block());
+  for (const auto& report : received_report_blocks_)
+    receive_blocks->push_back(report.second.report_block());
   return 0;
 }
 
 std::vector<ReportBlockData> RTCPReceiver::GetLatestReportBlockData() const {
   std::vector<ReportBlockData> result;
   rtc::CritScope lock(&rtcp_receiver_lock_);
-  for (const auto& reports_per_receiver : received_report_blocks_)
-    for (const auto& report : reports_per_receiver.second)
-      result.push_back(report.second);
+  for (const auto& report : received_report_blocks_)
+    result.push_back(report.second);
   return result;
 }
 
@@ -502,7 +497,8 @@ void RTCPReceiver::HandleReportBlock(const ReportBlock& report_block,
   last_received_rb_ms_ = clock_->TimeInMilliseconds();
 
   ReportBlockData* report_block_data =
-      &received_report_blocks_[report_block.source_ssrc()][remote_ssrc];
+      &received_report_blocks_[ReportBlockMapKey(report_block.source_ssrc(),
+                                                 remote_ssrc)];
   RTCPReportBlock rtcp_report_block;
   rtcp_report_block.sender_ssrc = remote_ssrc;
   rtcp_report_block.source_ssrc = report_block.source_ssrc();
@@ -722,8 +718,14 @@ void RTCPReceiver::HandleBye(const CommonHeader& rtcp_block) {
   }
 
   // Clear our lists.
-  for (auto& reports_per_receiver : received_report_blocks_)
-    reports_per_receiver.second.erase(bye.sender_ssrc());
+  for (auto it = received_report_blocks_.begin();
+       it != received_report_blocks_.end();) {
+    if (static_cast<uint32_t>(it->first) == bye.sender_ssrc()) {
+      it = received_report_blocks_.erase(it);
+    } else {
+      ++it;
+    }
+  }
 
   TmmbrInformation* tmmbr_info = GetTmmbrInformation(bye.sender_ssrc());
   if (tmmbr_info)
@@ -1117,17 +1119,22 @@ void RTCPReceiver::TriggerCallbacksFromRtcpPacket(
 
   if (!receiver_only_) {
     rtc::CritScope cs(&feedbacks_lock_);
-    if (stats_callback_) {
+    if (stats_callback_ && !packet_information.report_blocks.empty()) {
+      // Batch up all the report blocks of the compound packet, so that the
+      // observer is called once per packet rather than once per block.
+      std::vector<RtcpStatisticsUpdate> updates;
+      updates.reserve(packet_information.report_blocks.size());
       for (const auto& report_block : packet_information.report_blocks) {
-        RtcpStatistics stats;
-        stats.packets_lost = report_block.packets_lost;
-        stats.extended_highest_sequence_number =
+        RtcpStatisticsUpdate update;
+        update.ssrc = report_block.source_ssrc;
+        update.statistics.packets_lost = report_block.packets_lost;
+        update.statistics.extended_highest_sequence_number =
             report_block.extended_highest_sequence_number;
-        stats.fraction_lost = report_block.fraction_lost;
-        stats.jitter = report_block.jitter;
-
-        stats_callback_->StatisticsUpdated(stats, report_block.source_ssrc);
+        update.statistics.fraction_lost = report_block.fraction_lost;
+        update.statistics.jitter = report_block.jitter;
+        updates.push_back(update);
       }
+      stats_callback_->StatisticsBatchUpdated(updates);
     }
     if (report_block_data_observer_) {
       for (const auto& report_block_data :
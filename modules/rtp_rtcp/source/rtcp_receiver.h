@@ -15,6 +15,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/rtp_rtcp/include/report_block_data.h"
@@ -120,10 +121,15 @@ class RTCPReceiver {
   struct TmmbrInformation;
   struct RrtrInformation;
   struct LastFirStatus;
-  // RTCP report blocks mapped by remote SSRC.
-  using ReportBlockDataMap = std::map<uint32_t, ReportBlockData>;
-  // RTCP report blocks map mapped by source SSRC.
-  using ReportBlockMap = std::map<uint32_t, ReportBlockDataMap>;
+  // RTCP report blocks in one flat map, keyed by the (source SSRC, sender
+  // SSRC) pair packed into a single 64-bit value. This keeps updating a
+  // report block to one hash lookup even when thousands of remote receivers
+  // report on the same send stream.
+  using ReportBlockMap = std::unordered_map<uint64_t, ReportBlockData>;
+  static constexpr uint64_t ReportBlockMapKey(uint32_t source_ssrc,
+                                              uint32_t sender_ssrc) {
+    return (static_cast<uint64_t>(source_ssrc) << 32) | sender_ssrc;
+  }
 
   bool ParseCompoundPacket(const uint8_t* packet_begin,
                            const uint8_t* packet_end,
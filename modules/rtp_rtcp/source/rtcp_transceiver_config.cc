@@ -63,6 +63,10 @@ bool RtcpTransceiverConfig::Validate() const {
                       << "missing task queue for periodic compound packets";
     return false;
   }
+  if (periodic_scheduler && !schedule_periodic_compound_packets)
+    RTC_LOG(LS_WARNING) << debug_id
+                        << "periodic scheduler is set but periodic compound "
+                           "packets are disabled; it will not be used.";
   if (rtcp_mode != RtcpMode::kCompound && rtcp_mode != RtcpMode::kReducedSize) {
     RTC_LOG(LS_ERROR) << debug_id << "unsupported rtcp mode";
     return false;
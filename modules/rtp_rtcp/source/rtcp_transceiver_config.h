@@ -21,6 +21,7 @@
 
 namespace webrtc {
 class ReceiveStatisticsProvider;
+class RtcpTransceiverScheduler;
 class Transport;
 
 // Interface to watch incoming rtcp packets by media (rtp) receiver.
@@ -94,6 +95,11 @@ struct RtcpTransceiverConfig {
   // Flags for features and experiments.
   //
   bool schedule_periodic_compound_packets = true;
+  // When set, periodic compound packets are driven by this shared scheduler
+  // instead of a delayed task owned by the transceiver, so that many
+  // transceivers wake the task queue with one coalesced tick. The scheduler
+  // must use the same |task_queue| and must outlive the transceiver.
+  RtcpTransceiverScheduler* periodic_scheduler = nullptr;
   // Estimate RTT as non-sender as described in
   // https://tools.ietf.org/html/rfc3611#section-4.4 and #section-4.5
   bool non_sender_rtt_measurement = false;
@@ -29,6 +29,7 @@
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sdes.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtcp_transceiver_scheduler.h"
 #include "modules/rtp_rtcp/source/time_util.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
@@ -98,7 +99,19 @@ RtcpTransceiverImpl::RtcpTransceiverImpl(const RtcpTransceiverConfig& config)
   }
 }
 
-RtcpTransceiverImpl::~RtcpTransceiverImpl() = default;
+RtcpTransceiverImpl::~RtcpTransceiverImpl() {
+  // The shared scheduler holds a callback into this object; make sure it is
+  // gone even if StopPeriodicTask was never called.
+  if (config_.periodic_scheduler)
+    config_.periodic_scheduler->Unschedule(this);
+}
+
+void RtcpTransceiverImpl::StopPeriodicTask() {
+  if (config_.periodic_scheduler)
+    config_.periodic_scheduler->Unschedule(this);
+  else
+    periodic_task_handle_.Stop();
+}
 
 void RtcpTransceiverImpl::AddMediaReceiverRtcpObserver(
     uint32_t remote_ssrc,
@@ -124,7 +137,7 @@ void RtcpTransceiverImpl::RemoveMediaReceiverRtcpObserver(
 void RtcpTransceiverImpl::SetReadyToSend(bool ready) {
   if (config_.schedule_periodic_compound_packets) {
     if (ready_to_send_ && !ready)
-      periodic_task_handle_.Stop();
+      StopPeriodicTask();
 
     if (!ready_to_send_ && ready)  // Restart periodic sending.
       SchedulePeriodicCompoundPackets(config_.report_period_ms / 2);
@@ -321,12 +334,20 @@ void RtcpTransceiverImpl::HandleTargetBitrate(
 void RtcpTransceiverImpl::ReschedulePeriodicCompoundPackets() {
   if (!config_.schedule_periodic_compound_packets)
     return;
-  periodic_task_handle_.Stop();
+  StopPeriodicTask();
   RTC_DCHECK(ready_to_send_);
   SchedulePeriodicCompoundPackets(config_.report_period_ms);
 }
 
 void RtcpTransceiverImpl::SchedulePeriodicCompoundPackets(int64_t delay_ms) {
+  if (config_.periodic_scheduler) {
+    config_.periodic_scheduler->Schedule(this, delay_ms,
+                                         config_.report_period_ms, [this] {
+                                           RTC_DCHECK(ready_to_send_);
+                                           SendPeriodicCompoundPacket();
+                                         });
+    return;
+  }
   periodic_task_handle_ = RepeatingTaskHandle::DelayedStart(
       config_.task_queue->Get(), TimeDelta::ms(delay_ms), [this] {
         RTC_DCHECK(config_.schedule_periodic_compound_packets);
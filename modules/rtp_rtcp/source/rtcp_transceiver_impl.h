@@ -39,7 +39,7 @@ class RtcpTransceiverImpl {
   RtcpTransceiverImpl& operator=(const RtcpTransceiverImpl&) = delete;
   ~RtcpTransceiverImpl();
 
-  void StopPeriodicTask() { periodic_task_handle_.Stop(); }
+  void StopPeriodicTask();
 
   void AddMediaReceiverRtcpObserver(uint32_t remote_ssrc,
                                     MediaReceiverRtcpObserver* observer);
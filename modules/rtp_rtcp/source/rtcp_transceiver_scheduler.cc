@@ -0,0 +1,79 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtcp_transceiver_scheduler.h"
+
+#include <utility>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+RtcpTransceiverScheduler::RtcpTransceiverScheduler(rtc::TaskQueue* task_queue,
+                                                   int64_t tick_period_ms)
+    : task_queue_(task_queue), tick_period_ms_(tick_period_ms) {
+  RTC_DCHECK(task_queue_);
+  RTC_DCHECK_GT(tick_period_ms_, 0);
+}
+
+RtcpTransceiverScheduler::~RtcpTransceiverScheduler() {
+  // Clients keep a callback registered here; they must all be unscheduled
+  // before the scheduler goes away. Unscheduling the last client also stops
+  // the tick, so there is nothing left to clean up.
+  RTC_DCHECK(clients_.empty());
+}
+
+void RtcpTransceiverScheduler::Schedule(const void* handle,
+                                        int64_t delay_ms,
+                                        int64_t period_ms,
+                                        std::function<void()> send) {
+  RTC_DCHECK_GE(delay_ms, 0);
+  RTC_DCHECK_GT(period_ms, 0);
+  Client& client = clients_[handle];
+  client.next_send_ms = rtc::TimeMillis() + delay_ms;
+  client.period_ms = period_ms;
+  client.send = std::move(send);
+  if (!tick_handle_.Running()) {
+    tick_handle_ = RepeatingTaskHandle::DelayedStart(
+        task_queue_->Get(), TimeDelta::ms(tick_period_ms_), [this] {
+          RunDueSends();
+          return TimeDelta::ms(tick_period_ms_);
+        });
+  }
+}
+
+void RtcpTransceiverScheduler::Unschedule(const void* handle) {
+  clients_.erase(handle);
+  if (clients_.empty())
+    tick_handle_.Stop();
+}
+
+void RtcpTransceiverScheduler::RunDueSends() {
+  const int64_t now_ms = rtc::TimeMillis();
+  // Collect the due handles before running anything: a send may reschedule or
+  // unschedule clients and thereby mutate |clients_|.
+  std::vector<const void*> due;
+  for (const auto& client : clients_) {
+    if (now_ms >= client.second.next_send_ms)
+      due.push_back(client.first);
+  }
+  for (const void* handle : due) {
+    auto it = clients_.find(handle);
+    if (it == clients_.end())
+      continue;
+    it->second.next_send_ms = now_ms + it->second.period_ms;
+    it->second.send();
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_RTCP_TRANSCEIVER_SCHEDULER_H_
+#define MODULES_RTP_RTCP_SOURCE_RTCP_TRANSCEIVER_SCHEDULER_H_
+
+#include <functional>
+#include <map>
+
+#include "rtc_base/task_queue.h"
+#include "rtc_base/task_utils/repeating_task.h"
+
+namespace webrtc {
+
+// Coalesces the periodic compound packet timers of many RtcpTransceiverImpl
+// instances into a single repeating task. With one transceiver per stream,
+// scheduling each periodic report with its own delayed task wakes the task
+// queue once per stream per report period; transceivers sharing a scheduler
+// instead wake it once per tick.
+// All transceivers sharing a scheduler must be configured with the same task
+// queue. This class is not thread-safe; it must be used on that task queue
+// only, and destroyed after all clients have been unscheduled.
+class RtcpTransceiverScheduler {
+ public:
+  // |tick_period_ms| bounds how late after its deadline a send may run. It
+  // should be small compared to the report periods of the scheduled clients.
+  RtcpTransceiverScheduler(rtc::TaskQueue* task_queue, int64_t tick_period_ms);
+  RtcpTransceiverScheduler(const RtcpTransceiverScheduler&) = delete;
+  RtcpTransceiverScheduler& operator=(const RtcpTransceiverScheduler&) = delete;
+  ~RtcpTransceiverScheduler();
+
+  // Schedules |send| to run once |delay_ms| from now and every |period_ms|
+  // thereafter. |handle| identifies the client; scheduling with a handle that
+  // is already known replaces its entry.
+  void Schedule(const void* handle,
+                int64_t delay_ms,
+                int64_t period_ms,
+                std::function<void()> send);
+
+  // Stops future sends for the client. No-op if the handle is unknown.
+  void Unschedule(const void* handle);
+
+  size_t NumScheduledForTesting() const { return clients_.size(); }
+
+ private:
+  struct Client {
+    int64_t next_send_ms;
+    int64_t period_ms;
+    std::function<void()> send;
+  };
+
+  void RunDueSends();
+
+  rtc::TaskQueue* const task_queue_;
+  const int64_t tick_period_ms_;
+  std::map<const void*, Client> clients_;
+  // The single coalesced tick. Runs while there is at least one client.
+  RepeatingTaskHandle tick_handle_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_RTCP_TRANSCEIVER_SCHEDULER_H_
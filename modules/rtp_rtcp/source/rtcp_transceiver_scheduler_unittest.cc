@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtcp_transceiver_scheduler.h"
+
+#include "rtc_base/event.h"
+#include "rtc_base/task_queue_for_test.h"
+#include "test/gtest.h"
+
+namespace {
+
+using ::webrtc::RtcpTransceiverScheduler;
+using ::webrtc::TaskQueueForTest;
+
+constexpr int64_t kTickPeriodMs = 5;
+constexpr int kWaitTimeoutMs = 1000;
+
+TEST(RtcpTransceiverSchedulerTest, RunsScheduledSendsPeriodically) {
+  TaskQueueForTest queue("rtcp_scheduler");
+  RtcpTransceiverScheduler scheduler(&queue, kTickPeriodMs);
+
+  int client1 = 0;
+  int client2 = 0;
+  rtc::Event client1_sent_twice;
+  rtc::Event client2_sent_twice;
+  queue.SendTask([&] {
+    scheduler.Schedule(&client1, /*delay_ms=*/0, /*period_ms=*/10, [&] {
+      if (++client1 == 2)
+        client1_sent_twice.Set();
+    });
+    scheduler.Schedule(&client2, /*delay_ms=*/0, /*period_ms=*/10, [&] {
+      if (++client2 == 2)
+        client2_sent_twice.Set();
+    });
+  });
+
+  EXPECT_TRUE(client1_sent_twice.Wait(kWaitTimeoutMs));
+  EXPECT_TRUE(client2_sent_twice.Wait(kWaitTimeoutMs));
+
+  queue.SendTask([&] {
+    scheduler.Unschedule(&client1);
+    scheduler.Unschedule(&client2);
+  });
+}
+
+TEST(RtcpTransceiverSchedulerTest, UnscheduleStopsSends) {
+  TaskQueueForTest queue("rtcp_scheduler");
+  RtcpTransceiverScheduler scheduler(&queue, kTickPeriodMs);
+
+  int sends = 0;
+  rtc::Event sent;
+  queue.SendTask([&] {
+    scheduler.Schedule(&sends, /*delay_ms=*/0, /*period_ms=*/10, [&] {
+      ++sends;
+      sent.Set();
+    });
+  });
+  EXPECT_TRUE(sent.Wait(kWaitTimeoutMs));
+
+  int sends_at_unschedule = 0;
+  queue.SendTask([&] {
+    scheduler.Unschedule(&sends);
+    sends_at_unschedule = sends;
+    EXPECT_EQ(scheduler.NumScheduledForTesting(), 0u);
+  });
+
+  // The send closure runs on |queue| only, so once a task posted after the
+  // unscheduling has run, no further sends may happen.
+  queue.SendTask([&] { EXPECT_EQ(sends, sends_at_unschedule); });
+}
+
+TEST(RtcpTransceiverSchedulerTest, RescheduleReplacesEntry) {
+  TaskQueueForTest queue("rtcp_scheduler");
+  RtcpTransceiverScheduler scheduler(&queue, kTickPeriodMs);
+
+  int old_sends = 0;
+  int new_sends = 0;
+  int handle = 0;
+  rtc::Event sent;
+  queue.SendTask([&] {
+    scheduler.Schedule(&handle, /*delay_ms=*/0, /*period_ms=*/10,
+                       [&] { ++old_sends; });
+    scheduler.Schedule(&handle, /*delay_ms=*/0, /*period_ms=*/10, [&] {
+      ++new_sends;
+      sent.Set();
+    });
+    EXPECT_EQ(scheduler.NumScheduledForTesting(), 1u);
+  });
+
+  EXPECT_TRUE(sent.Wait(kWaitTimeoutMs));
+  queue.SendTask([&] {
+    EXPECT_EQ(old_sends, 0);
+    scheduler.Unschedule(&handle);
+  });
+}
+
+}  // namespace
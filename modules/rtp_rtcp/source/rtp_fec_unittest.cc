@@ -8,6 +8,7 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <algorithm>
 #include <list>
 #include <memory>
 
@@ -17,7 +18,9 @@
 #include "modules/rtp_rtcp/source/flexfec_header_reader_writer.h"
 #include "modules/rtp_rtcp/source/forward_error_correction.h"
 #include "modules/rtp_rtcp/source/ulpfec_header_reader_writer.h"
+#include "rtc_base/logging.h"
 #include "rtc_base/random.h"
+#include "rtc_base/time_utils.h"
 #include "test/gtest.h"
 
 namespace webrtc {
@@ -1125,4 +1128,58 @@ TYPED_TEST(RtpFecTest, FecRecoveryNonConsecutivePacketsWrap) {
   EXPECT_FALSE(this->IsRecoveryComplete());
 }
 
+// XorPayloads() dispatches to a vectorized kernel; verify it against a plain
+// byte-wise XOR for lengths around the vector widths and for the offsets used
+// by encoding and recovery.
+TEST(FecXorPayloadsTest, MatchesBytewiseReference) {
+  Random random(0x12345678u);
+  for (size_t dst_offset :
+       {size_t{kRtpHeaderSize}, size_t{kRtpHeaderSize} + 2}) {
+    for (size_t length : {size_t{0}, size_t{1}, size_t{7}, size_t{8},
+                          size_t{15}, size_t{16}, size_t{17}, size_t{63},
+                          size_t{320}, size_t{1171}}) {
+      ForwardErrorCorrection::Packet src;
+      ForwardErrorCorrection::Packet dst;
+      ForwardErrorCorrection::Packet expected_dst;
+      for (size_t i = 0; i < sizeof(src.data); ++i) {
+        src.data[i] = random.Rand<uint8_t>();
+        dst.data[i] = random.Rand<uint8_t>();
+        expected_dst.data[i] = dst.data[i];
+      }
+      src.length = kRtpHeaderSize + length;
+
+      for (size_t i = 0; i < length; ++i) {
+        expected_dst.data[dst_offset + i] ^= src.data[kRtpHeaderSize + i];
+      }
+      ForwardErrorCorrection::XorPayloads(src, length, dst_offset, &dst);
+      EXPECT_EQ(0,
+                memcmp(dst.data, expected_dst.data, sizeof(dst.data)))
+          << "length = " << length << ", dst_offset = " << dst_offset;
+    }
+  }
+}
+
+// Not a functional test; logs XOR throughput so kernel regressions show up
+// when run locally.
+TEST(FecXorPayloadsTest, DISABLED_Microbenchmark) {
+  constexpr size_t kPayloadLength = 1200;
+  constexpr int kIterations = 100000;
+  ForwardErrorCorrection::Packet src;
+  ForwardErrorCorrection::Packet dst;
+  memset(src.data, 0xa5, sizeof(src.data));
+  memset(dst.data, 0x5a, sizeof(dst.data));
+  src.length = kRtpHeaderSize + kPayloadLength;
+
+  const int64_t start_us = rtc::TimeMicros();
+  for (int i = 0; i < kIterations; ++i) {
+    ForwardErrorCorrection::XorPayloads(src, kPayloadLength, kRtpHeaderSize,
+                                        &dst);
+  }
+  const int64_t elapsed_us = rtc::TimeMicros() - start_us;
+  RTC_LOG(LS_INFO) << "XorPayloads: "
+                   << (static_cast<double>(kPayloadLength) * kIterations) /
+                          std::max<int64_t>(elapsed_us, 1)
+                   << " MB/s";
+}
+
 }  // namespace webrtc
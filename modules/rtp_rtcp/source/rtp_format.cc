@@ -10,12 +10,15 @@
 
 #include "modules/rtp_rtcp/source/rtp_format.h"
 
+#include <string.h>
+
 #include "absl/memory/memory.h"
 #include "absl/types/variant.h"
 #include "modules/rtp_rtcp/source/rtp_format_h264.h"
 #include "modules/rtp_rtcp/source/rtp_format_video_generic.h"
 #include "modules/rtp_rtcp/source/rtp_format_vp8.h"
 #include "modules/rtp_rtcp/source/rtp_format_vp9.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "modules/video_coding/codecs/h264/include/h264_globals.h"
 #include "modules/video_coding/codecs/vp8/include/vp8_globals.h"
 #include "modules/video_coding/codecs/vp9/include/vp9_globals.h"
@@ -61,6 +64,32 @@ std::unique_ptr<RtpPacketizer> RtpPacketizer::Create(
   }
 }
 
+bool RtpPacketizer::NextPacketViews(PayloadViews* views) {
+  // Packetizers without explicit scatter-gather support keep the copying
+  // NextPacket() path as their only interface.
+  return false;
+}
+
+void RtpPacketizer::WritePayloadViews(const PayloadViews& views,
+                                      RtpPacketToSend* packet) {
+  size_t payload_size = 0;
+  for (const PayloadView& view : views)
+    payload_size += view.header.size() + view.data.size();
+  uint8_t* buffer = packet->AllocatePayload(payload_size);
+  RTC_CHECK(buffer);
+  size_t index = 0;
+  for (const PayloadView& view : views) {
+    if (!view.header.empty()) {
+      memcpy(&buffer[index], view.header.data(), view.header.size());
+      index += view.header.size();
+    }
+    if (!view.data.empty()) {
+      memcpy(&buffer[index], view.data.data(), view.data.size());
+      index += view.data.size();
+    }
+  }
+}
+
 std::vector<int> RtpPacketizer::SplitAboutEqually(
     int payload_len,
     const PayloadSizeLimits& limits) {
@@ -16,6 +16,7 @@
 #include <memory>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/types/optional.h"
 #include "api/array_view.h"
 #include "modules/include/module_common_types.h"
@@ -50,15 +51,42 @@ class RtpPacketizer {
   // Returns number of remaining packets to produce by the packetizer.
   virtual size_t NumPackets() const = 0;
 
+  // One slice of a packet payload: packetization overhead bytes generated by
+  // the packetizer (payload header, fragmentation header or length fields),
+  // followed by a view into the encoded frame. The encoded frame is
+  // referenced rather than copied, so it must be kept alive until the views
+  // have been consumed.
+  struct PayloadView {
+    absl::InlinedVector<uint8_t, 8> header;
+    rtc::ArrayView<const uint8_t> data;
+  };
+  using PayloadViews = absl::InlinedVector<PayloadView, 4>;
+
   // Get the next payload with payload header.
   // Write payload and set marker bit of the |packet|.
   // Returns true on success, false otherwise.
   virtual bool NextPacket(RtpPacketToSend* packet) = 0;
 
+  // Scatter-gather variant of NextPacket(): describes the next payload as
+  // header bytes interleaved with views into the encoded frame instead of
+  // copying the frame, so a caller that owns the final wire buffer can gather
+  // the payload with a single copy. The marker bit belongs on the packet the
+  // views are gathered into iff NumPackets() is zero after this call.
+  // Returns false if there are no more packets, or if the packetizer does not
+  // support scatter-gather packetization (the default); in the latter case
+  // callers must fall back to NextPacket().
+  virtual bool NextPacketViews(PayloadViews* views);
+
   // Split payload_len into sum of integers with respect to |limits|.
   // Returns empty vector on failure.
   static std::vector<int> SplitAboutEqually(int payload_len,
                                             const PayloadSizeLimits& limits);
+
+ protected:
+  // Gathers |views| into the payload of |packet|, for packetizers that
+  // implement NextPacket() on top of NextPacketViews().
+  static void WritePayloadViews(const PayloadViews& views,
+                                RtpPacketToSend* packet);
 };
 
 // TODO(sprang): Update the depacketizer to return a std::unqie_ptr with a copy
@@ -272,49 +272,63 @@ bool RtpPacketizerH264::PacketizeSingleNalu(size_t fragment_index) {
 
 bool RtpPacketizerH264::NextPacket(RtpPacketToSend* rtp_packet) {
   RTC_DCHECK(rtp_packet);
+  PayloadViews views;
+  if (!NextPacketViews(&views)) {
+    return false;
+  }
+  WritePayloadViews(views, rtp_packet);
+  rtp_packet->SetMarker(packets_.empty());
+  return true;
+}
+
+bool RtpPacketizerH264::NextPacketViews(PayloadViews* views) {
+  RTC_DCHECK(views);
+  views->clear();
   if (packets_.empty()) {
     return false;
   }
 
   PacketUnit packet = packets_.front();
   if (packet.first_fragment && packet.last_fragment) {
-    // Single NAL unit packet.
-    size_t bytes_to_send = packet.source_fragment.length;
-    uint8_t* buffer = rtp_packet->AllocatePayload(bytes_to_send);
-    memcpy(buffer, packet.source_fragment.buffer, bytes_to_send);
+    // Single NAL unit packet, passed through without payload header.
+    views->push_back(
+        {{},
+         rtc::MakeArrayView(packet.source_fragment.buffer,
+                            packet.source_fragment.length)});
     packets_.pop();
     input_fragments_.pop_front();
   } else if (packet.aggregated) {
-    NextAggregatePacket(rtp_packet);
+    NextAggregatePacketViews(views);
   } else {
-    NextFragmentPacket(rtp_packet);
+    NextFragmentPacketViews(views);
   }
-  rtp_packet->SetMarker(packets_.empty());
   --num_packets_left_;
   return true;
 }
 
-void RtpPacketizerH264::NextAggregatePacket(RtpPacketToSend* rtp_packet) {
-  // Reserve maximum available payload, set actual payload size later.
-  size_t payload_capacity = rtp_packet->FreeCapacity();
-  RTC_CHECK_GE(payload_capacity, kNalHeaderSize);
-  uint8_t* buffer = rtp_packet->AllocatePayload(payload_capacity);
-  RTC_DCHECK(buffer);
+void RtpPacketizerH264::NextAggregatePacketViews(PayloadViews* views) {
   PacketUnit* packet = &packets_.front();
   RTC_CHECK(packet->first_fragment);
-  // STAP-A NALU header.
-  buffer[0] = (packet->header & (kFBit | kNriMask)) | H264::NaluType::kStapA;
-  size_t index = kNalHeaderSize;
+  // STAP-A NALU header, preceding the first length field.
+  uint8_t stap_a_header =
+      (packet->header & (kFBit | kNriMask)) | H264::NaluType::kStapA;
+  bool is_first_fragment = true;
   bool is_last_fragment = packet->last_fragment;
   while (packet->aggregated) {
     const Fragment& fragment = packet->source_fragment;
-    RTC_CHECK_LE(index + kLengthFieldSize + fragment.length, payload_capacity);
+    PayloadView view;
+    if (is_first_fragment) {
+      view.header.push_back(stap_a_header);
+      is_first_fragment = false;
+    }
     // Add NAL unit length field.
-    ByteWriter<uint16_t>::WriteBigEndian(&buffer[index], fragment.length);
-    index += kLengthFieldSize;
-    // Add NAL unit.
-    memcpy(&buffer[index], fragment.buffer, fragment.length);
-    index += fragment.length;
+    uint8_t length_field[kLengthFieldSize];
+    ByteWriter<uint16_t>::WriteBigEndian(length_field, fragment.length);
+    view.header.insert(view.header.end(), length_field,
+                       length_field + kLengthFieldSize);
+    // Reference the NAL unit itself.
+    view.data = rtc::MakeArrayView(fragment.buffer, fragment.length);
+    views->push_back(std::move(view));
     packets_.pop();
     input_fragments_.pop_front();
     if (is_last_fragment)
@@ -323,10 +337,9 @@ void RtpPacketizerH264::NextAggregatePacket(RtpPacketToSend* rtp_packet) {
     is_last_fragment = packet->last_fragment;
   }
   RTC_CHECK(is_last_fragment);
-  rtp_packet->SetPayloadSize(index);
 }
 
-void RtpPacketizerH264::NextFragmentPacket(RtpPacketToSend* rtp_packet) {
+void RtpPacketizerH264::NextFragmentPacketViews(PayloadViews* views) {
   PacketUnit* packet = &packets_.front();
   // NAL unit fragmented over multiple packets (FU-A).
   // We do not send original NALU header, so it will be replaced by the
@@ -341,11 +354,10 @@ void RtpPacketizerH264::NextFragmentPacket(RtpPacketToSend* rtp_packet) {
   uint8_t type = packet->header & kTypeMask;
   fu_header |= type;
   const Fragment& fragment = packet->source_fragment;
-  uint8_t* buffer =
-      rtp_packet->AllocatePayload(kFuAHeaderSize + fragment.length);
-  buffer[0] = fu_indicator;
-  buffer[1] = fu_header;
-  memcpy(buffer + kFuAHeaderSize, fragment.buffer, fragment.length);
+  PayloadView view;
+  view.header = {fu_indicator, fu_header};
+  view.data = rtc::MakeArrayView(fragment.buffer, fragment.length);
+  views->push_back(std::move(view));
   if (packet->last_fragment)
     input_fragments_.pop_front();
   packets_.pop();
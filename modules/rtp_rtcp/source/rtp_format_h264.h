@@ -46,6 +46,10 @@ class RtpPacketizerH264 : public RtpPacketizer {
   // Returns true on success, false otherwise.
   bool NextPacket(RtpPacketToSend* rtp_packet) override;
 
+  // Describes the next payload as views into the encoded frame instead of
+  // copying it. See RtpPacketizer::NextPacketViews().
+  bool NextPacketViews(PayloadViews* views) override;
+
  private:
   // Input fragments (NAL units), with an optionally owned temporary buffer,
   // used in case the fragment gets modified.
@@ -87,8 +91,8 @@ class RtpPacketizerH264 : public RtpPacketizer {
   size_t PacketizeStapA(size_t fragment_index);
   bool PacketizeSingleNalu(size_t fragment_index);
 
-  void NextAggregatePacket(RtpPacketToSend* rtp_packet);
-  void NextFragmentPacket(RtpPacketToSend* rtp_packet);
+  void NextAggregatePacketViews(PayloadViews* views);
+  void NextFragmentPacketViews(PayloadViews* views);
 
   const PayloadSizeLimits limits_;
   size_t num_packets_left_;
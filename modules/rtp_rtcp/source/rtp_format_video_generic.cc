@@ -52,23 +52,30 @@ size_t RtpPacketizerGeneric::NumPackets() const {
 
 bool RtpPacketizerGeneric::NextPacket(RtpPacketToSend* packet) {
   RTC_DCHECK(packet);
+  PayloadViews views;
+  if (!NextPacketViews(&views))
+    return false;
+  WritePayloadViews(views, packet);
+  packet->SetMarker(remaining_payload_.empty());
+  return true;
+}
+
+bool RtpPacketizerGeneric::NextPacketViews(PayloadViews* views) {
+  RTC_DCHECK(views);
+  views->clear();
   if (current_packet_ == payload_sizes_.end())
     return false;
 
   size_t next_packet_payload_len = *current_packet_;
 
-  uint8_t* out_ptr =
-      packet->AllocatePayload(header_size_ + next_packet_payload_len);
-  RTC_CHECK(out_ptr);
-
+  PayloadView view;
   if (header_size_ > 0) {
-    memcpy(out_ptr, header_, header_size_);
+    view.header.assign(header_, header_ + header_size_);
     // Remove first-packet bit, following packets are intermediate.
     header_[0] &= ~RtpFormatVideoGeneric::kFirstPacketBit;
   }
-
-  memcpy(out_ptr + header_size_, remaining_payload_.data(),
-         next_packet_payload_len);
+  view.data = remaining_payload_.subview(0, next_packet_payload_len);
+  views->push_back(std::move(view));
 
   remaining_payload_ = remaining_payload_.subview(next_packet_payload_len);
 
@@ -77,8 +84,6 @@ bool RtpPacketizerGeneric::NextPacket(RtpPacketToSend* packet) {
   // Packets left to produce and data left to split should end at the same time.
   RTC_DCHECK_EQ(current_packet_ == payload_sizes_.end(),
                 remaining_payload_.empty());
-
-  packet->SetMarker(remaining_payload_.empty());
   return true;
 }
 
@@ -56,6 +56,10 @@ class RtpPacketizerGeneric : public RtpPacketizer {
   // Returns true on success, false otherwise.
   bool NextPacket(RtpPacketToSend* packet) override;
 
+  // Describes the next payload as a view into the encoded frame instead of
+  // copying it. See RtpPacketizer::NextPacketViews().
+  bool NextPacketViews(PayloadViews* views) override;
+
  private:
   // Fills header_ and header_size_ members.
   void BuildHeader(const RTPVideoHeader& rtp_video_header,
@@ -68,6 +68,8 @@ RtpHeaderExtensionMap::RtpHeaderExtensionMap(bool extmap_allow_mixed)
     : extmap_allow_mixed_(extmap_allow_mixed) {
   for (auto& id : ids_)
     id = kInvalidId;
+  for (auto& type : types_)
+    type = kInvalidType;
 }
 
 RtpHeaderExtensionMap::RtpHeaderExtensionMap(
@@ -94,20 +96,9 @@ bool RtpHeaderExtensionMap::RegisterByUri(int id, const std::string& uri) {
   return false;
 }
 
-RTPExtensionType RtpHeaderExtensionMap::GetType(int id) const {
-  RTC_DCHECK_GE(id, RtpExtension::kMinId);
-  RTC_DCHECK_LE(id, RtpExtension::kMaxId);
-  for (int type = kRtpExtensionNone + 1; type < kRtpExtensionNumberOfExtensions;
-       ++type) {
-    if (ids_[type] == id) {
-      return static_cast<RTPExtensionType>(type);
-    }
-  }
-  return kInvalidType;
-}
-
 int32_t RtpHeaderExtensionMap::Deregister(RTPExtensionType type) {
   if (IsRegistered(type)) {
+    types_[ids_[type]] = kInvalidType;
     ids_[type] = kInvalidId;
   }
   return 0;
@@ -144,6 +135,7 @@ bool RtpHeaderExtensionMap::Register(int id,
 
   // There is a run-time check above id fits into uint8_t.
   ids_[type] = static_cast<uint8_t>(id);
+  types_[id] = type;
   return true;
 }
 
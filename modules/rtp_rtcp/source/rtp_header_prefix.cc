@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_header_prefix.h"
+
+#include "modules/rtp_rtcp/source/byte_io.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kFixedHeaderSize = 12;
+constexpr uint8_t kRtpVersion = 2;
+
+}  // namespace
+
+bool ParseRtpHeaderPrefix(rtc::ArrayView<const uint8_t> datagram,
+                          RtpHeaderPrefix* prefix) {
+  if (datagram.size() < kFixedHeaderSize)
+    return false;
+  const uint8_t* data = datagram.data();
+  if (data[0] >> 6 != kRtpVersion)
+    return false;
+  prefix->payload_type = data[1] & 0x7f;
+  prefix->sequence_number = ByteReader<uint16_t>::ReadBigEndian(&data[2]);
+  prefix->timestamp = ByteReader<uint32_t>::ReadBigEndian(&data[4]);
+  prefix->ssrc = ByteReader<uint32_t>::ReadBigEndian(&data[8]);
+  return true;
+}
+
+size_t ParseRtpHeaderPrefixes(
+    rtc::ArrayView<const rtc::ArrayView<const uint8_t>> datagrams,
+    std::vector<absl::optional<RtpHeaderPrefix>>* prefixes) {
+  prefixes->reserve(prefixes->size() + datagrams.size());
+  size_t parsed = 0;
+  for (rtc::ArrayView<const uint8_t> datagram : datagrams) {
+    RtpHeaderPrefix prefix;
+    if (ParseRtpHeaderPrefix(datagram, &prefix)) {
+      prefixes->push_back(prefix);
+      ++parsed;
+    } else {
+      prefixes->push_back(absl::nullopt);
+    }
+  }
+  return parsed;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_RTP_HEADER_PREFIX_H_
+#define MODULES_RTP_RTCP_SOURCE_RTP_HEADER_PREFIX_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// The fixed fields of the 12-byte RTP header (RFC 3550 section 5.1),
+// extracted without a full parse of the packet.
+struct RtpHeaderPrefix {
+  uint8_t payload_type = 0;
+  uint16_t sequence_number = 0;
+  uint32_t timestamp = 0;
+  uint32_t ssrc = 0;
+};
+
+// Extracts the fixed header fields of a single datagram into |prefix|.
+// Returns false if the datagram is shorter than the fixed header or is not
+// RTP version 2. Only the first 12 bytes of the datagram are read; header
+// extensions and payload stay untouched.
+bool ParseRtpHeaderPrefix(rtc::ArrayView<const uint8_t> datagram,
+                          RtpHeaderPrefix* prefix);
+
+// Burst variant for a batched socket receive: extracts the fixed header
+// fields of every datagram in |datagrams| and appends one entry per datagram
+// to |prefixes|, nullopt for datagrams that do not look like RTP. This allows
+// demuxing and duplicate detection of a whole receive burst before any
+// per-packet full parse. Returns the number of parsed (non-nullopt) entries.
+size_t ParseRtpHeaderPrefixes(
+    rtc::ArrayView<const rtc::ArrayView<const uint8_t>> datagrams,
+    std::vector<absl::optional<RtpHeaderPrefix>>* prefixes);
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_RTP_HEADER_PREFIX_H_
@@ -0,0 +1,63 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_header_prefix.h"
+
+#include <string.h>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Version 2, payload type 111, sequence number 0x1234, timestamp 0x11223344,
+// ssrc 0xdeadbeef, followed by two payload bytes.
+constexpr uint8_t kMinimalPacket[] = {0x80, 0x6f, 0x12, 0x34, 0x11, 0x22, 0x33,
+                                      0x44, 0xde, 0xad, 0xbe, 0xef, 0x01, 0x02};
+
+TEST(RtpHeaderPrefixTest, ParsesFixedHeaderFields) {
+  RtpHeaderPrefix prefix;
+  ASSERT_TRUE(ParseRtpHeaderPrefix(kMinimalPacket, &prefix));
+  EXPECT_EQ(prefix.payload_type, 111);
+  EXPECT_EQ(prefix.sequence_number, 0x1234);
+  EXPECT_EQ(prefix.timestamp, 0x11223344u);
+  EXPECT_EQ(prefix.ssrc, 0xdeadbeefu);
+}
+
+TEST(RtpHeaderPrefixTest, RejectsTooShortDatagram) {
+  RtpHeaderPrefix prefix;
+  EXPECT_FALSE(ParseRtpHeaderPrefix(
+      rtc::ArrayView<const uint8_t>(kMinimalPacket, 11), &prefix));
+}
+
+TEST(RtpHeaderPrefixTest, RejectsWrongVersion) {
+  uint8_t packet[sizeof(kMinimalPacket)];
+  memcpy(packet, kMinimalPacket, sizeof(kMinimalPacket));
+  packet[0] = 0x40;  // Version 1.
+  RtpHeaderPrefix prefix;
+  EXPECT_FALSE(ParseRtpHeaderPrefix(packet, &prefix));
+}
+
+TEST(RtpHeaderPrefixTest, ParsesBurstSkippingNonRtp) {
+  const uint8_t kNotRtp[] = {0x13, 0x37};
+  const rtc::ArrayView<const uint8_t> datagrams[] = {kMinimalPacket, kNotRtp,
+                                                     kMinimalPacket};
+  std::vector<absl::optional<RtpHeaderPrefix>> prefixes;
+  EXPECT_EQ(ParseRtpHeaderPrefixes(datagrams, &prefixes), 2u);
+  ASSERT_EQ(prefixes.size(), 3u);
+  ASSERT_TRUE(prefixes[0].has_value());
+  EXPECT_FALSE(prefixes[1].has_value());
+  ASSERT_TRUE(prefixes[2].has_value());
+  EXPECT_EQ(prefixes[0]->ssrc, 0xdeadbeefu);
+  EXPECT_EQ(prefixes[2]->sequence_number, 0x1234);
+}
+
+}  // namespace
+}  // namespace webrtc
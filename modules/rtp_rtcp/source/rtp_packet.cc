@@ -29,6 +29,52 @@ constexpr uint16_t kTwoByteExtensionProfileId = 0x1000;
 constexpr size_t kOneByteExtensionHeaderLength = 1;
 constexpr size_t kTwoByteExtensionHeaderLength = 2;
 constexpr size_t kDefaultPacketSize = 1500;
+
+// Per-thread recycling pool for packet buffer storage. Packets are created
+// and destroyed tens of thousands of times per second on a loaded sender, and
+// the malloc/free pair for the underlying CopyOnWriteBuffer storage dominates
+// that cost. Buffers whose storage is still shared (e.g. retained by the
+// packet history) are simply not recycled.
+class PacketBufferRecycler {
+ public:
+  static PacketBufferRecycler& ForCurrentThread() {
+    thread_local PacketBufferRecycler recycler;
+    return recycler;
+  }
+
+  rtc::CopyOnWriteBuffer Take(size_t capacity) {
+    for (auto it = buffers_.begin(); it != buffers_.end(); ++it) {
+      // Only exact capacity matches may be reused: RtpPacket::capacity()
+      // reports the underlying buffer capacity, and handing out a larger
+      // buffer would let packets grow past their requested maximum size.
+      // Packets are almost always allocated at the configured max packet
+      // size, so exact matching still recycles the common case.
+      if (it->capacity() == capacity) {
+        rtc::CopyOnWriteBuffer buffer = std::move(*it);
+        buffers_.erase(it);
+        buffer.SetSize(capacity);
+        return buffer;
+      }
+    }
+    return rtc::CopyOnWriteBuffer(capacity);
+  }
+
+  void Recycle(rtc::CopyOnWriteBuffer* buffer) {
+    if (buffers_.size() >= kMaxRecycledBuffers || buffer->capacity() == 0 ||
+        !buffer->HasOneRef()) {
+      return;
+    }
+    buffers_.push_back(std::move(*buffer));
+  }
+
+ private:
+  // Bounds per-thread memory usage to roughly 32 full-size packets.
+  static constexpr size_t kMaxRecycledBuffers = 32;
+
+  std::vector<rtc::CopyOnWriteBuffer> buffers_;
+};
+
+constexpr size_t PacketBufferRecycler::kMaxRecycledBuffers;
 }  // namespace
 
 //  0                   1                   2                   3
@@ -62,12 +108,14 @@ RtpPacket::RtpPacket(const RtpPacket&) = default;
 
 RtpPacket::RtpPacket(const ExtensionManager* extensions, size_t capacity)
     : extensions_(extensions ? *extensions : ExtensionManager()),
-      buffer_(capacity) {
+      buffer_(PacketBufferRecycler::ForCurrentThread().Take(capacity)) {
   RTC_DCHECK_GE(capacity, kFixedHeaderSize);
   Clear();
 }
 
-RtpPacket::~RtpPacket() {}
+RtpPacket::~RtpPacket() {
+  PacketBufferRecycler::ForCurrentThread().Recycle(&buffer_);
+}
 
 void RtpPacket::IdentifyExtensions(const ExtensionManager& extensions) {
   extensions_ = extensions;
@@ -402,6 +450,40 @@ uint8_t* RtpPacket::SetPayloadSize(size_t size_bytes) {
   return WriteAt(payload_offset_);
 }
 
+bool RtpPacket::SetAsRtxOf(const RtpPacket& original) {
+  const size_t header_size = original.headers_size();
+  const size_t payload_size = original.payload_size() + kRtxHeaderSize;
+  if (header_size + payload_size > capacity())
+    return false;
+  marker_ = original.marker_;
+  payload_type_ = original.payload_type_;
+  sequence_number_ = original.sequence_number_;
+  timestamp_ = original.timestamp_;
+  ssrc_ = original.ssrc_;
+  payload_offset_ = original.payload_offset_;
+  payload_size_ = payload_size;
+  padding_size_ = 0;
+  extensions_ = original.extensions_;
+  extension_entries_ = original.extension_entries_;
+  extensions_size_ = original.extensions_size_;
+  // One pass over the bytes: header block verbatim, then the original
+  // sequence number in the two-byte RTX headroom, then the payload. Media
+  // packets are already sized to leave this headroom free when RTX is
+  // enabled (see RTPSenderVideo::SendVideo()), so the capacity check above
+  // only fails for packets built before RTX was configured.
+  buffer_.SetSize(header_size + payload_size);
+  uint8_t* write_at = WriteAt(0);
+  memcpy(write_at, original.data(), header_size);
+  ByteWriter<uint16_t>::WriteBigEndian(write_at + header_size,
+                                       original.SequenceNumber());
+  memcpy(write_at + header_size + kRtxHeaderSize,
+         original.data() + original.payload_offset_, original.payload_size());
+  // Padding is not retransmitted; clear the padding bit in case |original|
+  // carried any.
+  WriteAt(0, data()[0] & ~0x20);
+  return true;
+}
+
 bool RtpPacket::SetPadding(size_t padding_bytes) {
   if (payload_offset_ + payload_size_ + padding_bytes > capacity()) {
     RTC_LOG(LS_WARNING) << "Cannot set padding size " << padding_bytes
@@ -144,6 +144,16 @@ class RtpPacket {
 
   bool SetPadding(size_t padding_size);
 
+  // Rewrites this packet as an RTX (RFC 4588) retransmission of |original|:
+  // the header and extension block are copied verbatim and the payload is
+  // written with a two-byte headroom holding the original sequence number.
+  // The fields that differ on the RTX stream - SSRC, payload type and
+  // sequence number - must be set by the caller afterwards. The caller is
+  // also responsible for ensuring |original| carries no extensions that are
+  // scoped to its SSRC (MID, RID). Returns false if |original| plus headroom
+  // does not fit this packet's capacity.
+  bool SetAsRtxOf(const RtpPacket& original);
+
   // Returns debug string of RTP packet (without detailed extension info).
   std::string ToString() const;
 
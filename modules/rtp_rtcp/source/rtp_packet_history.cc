@@ -15,6 +15,7 @@
 #include <utility>
 
 #include "absl/memory/memory.h"
+#include "modules/include/module_common_types_public.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
@@ -130,17 +131,33 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
 
   // Store packet.
   const uint16_t rtp_seq_no = packet->SequenceNumber();
-  auto packet_it = packet_history_.emplace(
-      rtp_seq_no,
-      StoredPacket(std::move(packet), send_time_ms, packets_inserted_++));
-  RTC_DCHECK(packet_it.second) << "Failed to insert packet in history.";
-  StoredPacket& stored_packet = packet_it.first->second;
+  int packet_index = GetPacketIndex(rtp_seq_no);
+  if (packet_index >= 0 &&
+      static_cast<size_t>(packet_index) < packet_history_.size() &&
+      packet_history_[packet_index].packet_ != nullptr) {
+    RTC_LOG(LS_WARNING) << "Duplicate packet inserted: " << rtp_seq_no;
+    // Remove previous packet to avoid inconsistent state.
+    RemovePacket(packet_index);
+    packet_index = GetPacketIndex(rtp_seq_no);
+  }
 
-  if (!start_seqno_) {
-    start_seqno_ = rtp_seq_no;
+  // Packet to be inserted ahead of first packet, expand front.
+  for (; packet_index < 0; ++packet_index) {
+    packet_history_.emplace_front();
+  }
+  // Packet to be inserted behind last packet, expand back.
+  while (static_cast<int>(packet_history_.size()) <= packet_index) {
+    packet_history_.emplace_back();
   }
 
-  // Store the sequence number of the last send packet with this size.
+  RTC_DCHECK_GE(packet_index, 0);
+  RTC_DCHECK_LT(packet_index, packet_history_.size());
+  RTC_DCHECK(packet_history_[packet_index].packet_ == nullptr);
+
+  packet_history_[packet_index] =
+      StoredPacket(std::move(packet), send_time_ms, packets_inserted_++);
+  StoredPacket& stored_packet = packet_history_[packet_index];
+
   auto prio_it = padding_priority_.insert(&stored_packet);
   RTC_DCHECK(prio_it.second) << "Failed to insert packet into prio set.";
 }
@@ -153,13 +170,13 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPacketAndSetSendTime(
   }
 
   int64_t now_ms = clock_->TimeInMilliseconds();
-  StoredPacketIterator rtp_it = packet_history_.find(sequence_number);
-  if (rtp_it == packet_history_.end()) {
+  StoredPacket* stored_packet = GetStoredPacket(sequence_number);
+  if (stored_packet == nullptr) {
     return nullptr;
   }
 
-  StoredPacket& packet = rtp_it->second;
-  if (!VerifyRtt(rtp_it->second, now_ms)) {
+  StoredPacket& packet = *stored_packet;
+  if (!VerifyRtt(packet, now_ms)) {
     return nullptr;
   }
 
@@ -193,19 +210,19 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPacketAndMarkAsPending(
   }
 
   int64_t now_ms = clock_->TimeInMilliseconds();
-  StoredPacketIterator rtp_it = packet_history_.find(sequence_number);
-  if (rtp_it == packet_history_.end()) {
+  StoredPacket* stored_packet = GetStoredPacket(sequence_number);
+  if (stored_packet == nullptr) {
     return nullptr;
   }
 
-  StoredPacket& packet = rtp_it->second;
+  StoredPacket& packet = *stored_packet;
 
   if (packet.pending_transmission_) {
     // Packet already in pacer queue, ignore this request.
     return nullptr;
   }
 
-  if (!VerifyRtt(rtp_it->second, now_ms)) {
+  if (!VerifyRtt(packet, now_ms)) {
     // Packet already resent within too short a time window, ignore.
     return nullptr;
   }
@@ -227,12 +244,12 @@ void RtpPacketHistory::MarkPacketAsSent(uint16_t sequence_number) {
   }
 
   int64_t now_ms = clock_->TimeInMilliseconds();
-  StoredPacketIterator rtp_it = packet_history_.find(sequence_number);
-  if (rtp_it == packet_history_.end()) {
+  StoredPacket* stored_packet = GetStoredPacket(sequence_number);
+  if (stored_packet == nullptr) {
     return;
   }
 
-  StoredPacket& packet = rtp_it->second;
+  StoredPacket& packet = *stored_packet;
   RTC_DCHECK(packet.send_time_ms_);
 
   // Update send-time, mark as no longer in pacer queue, and increment
@@ -249,16 +266,19 @@ absl::optional<RtpPacketHistory::PacketState> RtpPacketHistory::GetPacketState(
     return absl::nullopt;
   }
 
-  auto rtp_it = packet_history_.find(sequence_number);
-  if (rtp_it == packet_history_.end()) {
+  int packet_index = GetPacketIndex(sequence_number);
+  if (packet_index < 0 ||
+      static_cast<size_t>(packet_index) >= packet_history_.size() ||
+      packet_history_[packet_index].packet_ == nullptr) {
     return absl::nullopt;
   }
+  const StoredPacket& packet = packet_history_[packet_index];
 
-  if (!VerifyRtt(rtp_it->second, clock_->TimeInMilliseconds())) {
+  if (!VerifyRtt(packet, clock_->TimeInMilliseconds())) {
     return absl::nullopt;
   }
 
-  return StoredPacketToPacketState(rtp_it->second);
+  return StoredPacketToPacketState(packet);
 }
 
 bool RtpPacketHistory::VerifyRtt(const RtpPacketHistory::StoredPacket& packet,
@@ -322,10 +342,13 @@ void RtpPacketHistory::CullAcknowledgedPackets(
   }
 
   for (uint16_t sequence_number : sequence_numbers) {
-    auto stored_packet_it = packet_history_.find(sequence_number);
-    if (stored_packet_it != packet_history_.end()) {
-      RemovePacket(stored_packet_it);
+    int packet_index = GetPacketIndex(sequence_number);
+    if (packet_index < 0 ||
+        static_cast<size_t>(packet_index) >= packet_history_.size() ||
+        packet_history_[packet_index].packet_ == nullptr) {
+      continue;
     }
+    RemovePacket(packet_index);
   }
 }
 
@@ -335,12 +358,12 @@ bool RtpPacketHistory::SetPendingTransmission(uint16_t sequence_number) {
     return false;
   }
 
-  auto rtp_it = packet_history_.find(sequence_number);
-  if (rtp_it == packet_history_.end()) {
+  StoredPacket* stored_packet = GetStoredPacket(sequence_number);
+  if (stored_packet == nullptr) {
     return false;
   }
 
-  rtp_it->second.pending_transmission_ = true;
+  stored_packet->pending_transmission_ = true;
   return true;
 }
 
@@ -352,25 +375,21 @@ void RtpPacketHistory::Clear() {
 void RtpPacketHistory::Reset() {
   packet_history_.clear();
   padding_priority_.clear();
-  start_seqno_.reset();
 }
 
 void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
   int64_t packet_duration_ms =
       std::max(kMinPacketDurationRtt * rtt_ms_, kMinPacketDurationMs);
   while (!packet_history_.empty()) {
-    auto stored_packet_it = packet_history_.find(*start_seqno_);
-    RTC_DCHECK(stored_packet_it != packet_history_.end());
-
     if (packet_history_.size() >= kMaxCapacity) {
       // We have reached the absolute max capacity, remove one packet
       // unconditionally.
-      RemovePacket(stored_packet_it);
+      RemovePacket(0);
       continue;
     }
 
-    const StoredPacket& stored_packet = stored_packet_it->second;
-    if (stored_packet_it->second.pending_transmission_) {
+    const StoredPacket& stored_packet = packet_history_.front();
+    if (stored_packet.pending_transmission_) {
       // Don't remove packets in the pacer queue, pending tranmission.
       return;
     }
@@ -386,7 +405,7 @@ void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
             now_ms) {
       // Too many packets in history, or this packet has timed out. Remove it
       // and continue.
-      RemovePacket(stored_packet_it);
+      RemovePacket(0);
     } else {
       // No more packets can be removed right now.
       return;
@@ -395,17 +414,13 @@ void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
 }
 
 std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
-    StoredPacketIterator packet_it) {
+    int packet_index) {
   // Move the packet out from the StoredPacket container.
   std::unique_ptr<RtpPacketToSend> rtp_packet =
-      std::move(packet_it->second.packet_);
-
-  // Check if this is the oldest packet in the history, as this must be updated
-  // in order to cull old packets.
-  const bool is_first_packet = packet_it->first == start_seqno_;
+      std::move(packet_history_[packet_index].packet_);
 
   // Erase from padding priority set, if eligible.
-  size_t num_erased = padding_priority_.erase(&packet_it->second);
+  size_t num_erased = padding_priority_.erase(&packet_history_[packet_index]);
   RTC_DCHECK_EQ(num_erased, 1)
       << "Failed to remove one packet from prio set, got " << num_erased;
   if (num_erased != 1) {
@@ -414,25 +429,53 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
     return nullptr;
   }
 
-  // Erase the packet from the map, and capture iterator to the next one.
-  StoredPacketIterator next_it = packet_history_.erase(packet_it);
-
-  if (is_first_packet) {
-    // |next_it| now points to the next element, or to the end. If the end,
-    // check if we can wrap around.
-    if (next_it == packet_history_.end()) {
-      next_it = packet_history_.begin();
+  // Removing elsewhere than at the front just leaves a placeholder; the slot
+  // is reclaimed once all older packets are gone.
+  if (packet_index == 0) {
+    while (!packet_history_.empty() &&
+           packet_history_.front().packet_ == nullptr) {
+      packet_history_.pop_front();
     }
+  }
 
-    // Update |start_seq_no| to the new oldest item.
-    if (next_it != packet_history_.end()) {
-      start_seqno_ = next_it->first;
-    } else {
-      start_seqno_.reset();
+  return rtp_packet;
+}
+
+int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
+  if (packet_history_.empty()) {
+    return 0;
+  }
+
+  RTC_DCHECK(packet_history_.front().packet_ != nullptr);
+  int first_seq = packet_history_.front().packet_->SequenceNumber();
+  if (first_seq == sequence_number) {
+    return 0;
+  }
+
+  int packet_index = sequence_number - first_seq;
+  constexpr int kSeqNumSpan = std::numeric_limits<uint16_t>::max() + 1;
+
+  if (IsNewerSequenceNumber(sequence_number, first_seq)) {
+    if (sequence_number < first_seq) {
+      // Forward wrap.
+      packet_index += kSeqNumSpan;
     }
+  } else if (sequence_number > first_seq) {
+    // Backwards wrap.
+    packet_index -= kSeqNumSpan;
   }
 
-  return rtp_packet;
+  return packet_index;
+}
+
+RtpPacketHistory::StoredPacket* RtpPacketHistory::GetStoredPacket(
+    uint16_t sequence_number) {
+  int index = GetPacketIndex(sequence_number);
+  if (index < 0 || static_cast<size_t>(index) >= packet_history_.size() ||
+      packet_history_[index].packet_ == nullptr) {
+    return nullptr;
+  }
+  return &packet_history_[index];
 }
 
 RtpPacketHistory::PacketState RtpPacketHistory::StoredPacketToPacketState(
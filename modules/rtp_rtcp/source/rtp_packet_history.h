@@ -11,7 +11,7 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 
-#include <map>
+#include <deque>
 #include <memory>
 #include <set>
 #include <vector>
@@ -139,6 +139,7 @@ class RtpPacketHistory {
 
   class StoredPacket {
    public:
+    StoredPacket() = default;
     StoredPacket(std::unique_ptr<RtpPacketToSend> packet,
                  absl::optional<int64_t> send_time_ms,
                  uint64_t insert_order);
@@ -153,26 +154,25 @@ class RtpPacketHistory {
     // The time of last transmission, including retransmissions.
     absl::optional<int64_t> send_time_ms_;
 
-    // The actual packet.
+    // The actual packet. A default-constructed StoredPacket with a null
+    // |packet_| acts as a placeholder for a culled entry in |packet_history_|.
     std::unique_ptr<RtpPacketToSend> packet_;
 
     // True if the packet is currently in the pacer queue pending transmission.
-    bool pending_transmission_;
+    bool pending_transmission_ = false;
 
    private:
     // Unique number per StoredPacket, incremented by one for each added
     // packet. Used to sort on insert order.
-    uint64_t insert_order_;
+    uint64_t insert_order_ = 0;
 
     // Number of times RE-transmitted, ie excluding the first transmission.
-    size_t times_retransmitted_;
+    size_t times_retransmitted_ = 0;
   };
   struct MoreUseful {
     bool operator()(StoredPacket* lhs, StoredPacket* rhs) const;
   };
 
-  using StoredPacketIterator = std::map<uint16_t, StoredPacket>::iterator;
-
   // Helper method used by GetPacketAndSetSendTime() and GetPacketState() to
   // check if packet has too recently been sent.
   bool VerifyRtt(const StoredPacket& packet, int64_t now_ms) const
@@ -181,7 +181,17 @@ class RtpPacketHistory {
   void CullOldPackets(int64_t now_ms) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   // Removes the packet from the history, and context/mapping that has been
   // stored. Returns the RTP packet instance contained within the StoredPacket.
-  std::unique_ptr<RtpPacketToSend> RemovePacket(StoredPacketIterator packet)
+  std::unique_ptr<RtpPacketToSend> RemovePacket(int packet_index)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Converts |sequence_number| to the index of the corresponding slot in
+  // |packet_history_|, relative to the sequence number of the oldest stored
+  // packet. May be negative or beyond the current size if the packet is not
+  // in the history.
+  int GetPacketIndex(uint16_t sequence_number) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Returns the stored packet with the given sequence number, or nullptr if
+  // it is not in the history.
+  StoredPacket* GetStoredPacket(uint16_t sequence_number)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   static PacketState StoredPacketToPacketState(
       const StoredPacket& stored_packet);
@@ -192,8 +202,12 @@ class RtpPacketHistory {
   StorageMode mode_ RTC_GUARDED_BY(lock_);
   int64_t rtt_ms_ RTC_GUARDED_BY(lock_);
 
-  // Map from rtp sequence numbers to stored packet.
-  std::map<uint16_t, StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  // Ring of stored packets, ordered and indexed by sequence number. Slot i
+  // holds the packet with sequence number front + i; culled packets leave a
+  // placeholder with a null |packet_| so lookups stay O(1). Payload storage
+  // itself is refcounted (CopyOnWriteBuffer), so handing out copies for
+  // retransmission does not copy the media bytes.
+  std::deque<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
 
   // Total number of packets with inserted.
   uint64_t packets_inserted_ RTC_GUARDED_BY(lock_);
@@ -201,10 +215,6 @@ class RtpPacketHistory {
   // in GetPayloadPaddingPacket().
   PacketPrioritySet padding_priority_ RTC_GUARDED_BY(lock_);
 
-  // The earliest packet in the history. This might not be the lowest sequence
-  // number, in case there is a wraparound.
-  absl::optional<uint16_t> start_seqno_ RTC_GUARDED_BY(lock_);
-
   RTC_DISALLOW_IMPLICIT_CONSTRUCTORS(RtpPacketHistory);
 };
 }  // namespace webrtc
@@ -9,6 +9,7 @@
  */
 #include "common_video/test/utilities.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
 #include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
@@ -1117,4 +1118,48 @@ TEST(RtpPacketTest, RemoveExtensionFailure) {
   EXPECT_THAT(kPacketWithTO, ElementsAreArray(packet.data(), packet.size()));
 }
 
+TEST(RtpPacketTest, SetAsRtxOfPrefixesPayloadWithOriginalSequenceNumber) {
+  RtpPacketToSend::ExtensionManager extensions;
+  extensions.Register(kRtpExtensionTransmissionTimeOffset,
+                      kTransmissionOffsetExtensionId);
+  RtpPacketToSend media_packet(&extensions);
+  media_packet.SetPayloadType(kPayloadType);
+  media_packet.SetSequenceNumber(kSeqNum);
+  media_packet.SetTimestamp(kTimestamp);
+  media_packet.SetSsrc(kSsrc);
+  media_packet.SetExtension<TransmissionOffset>(kTimeOffset);
+  constexpr uint8_t kPayloadData[] = {0x11, 0x22, 0x33, 0x44, 0x55};
+  uint8_t* payload = media_packet.AllocatePayload(sizeof(kPayloadData));
+  memcpy(payload, kPayloadData, sizeof(kPayloadData));
+
+  RtpPacketToSend rtx_packet(&extensions);
+  ASSERT_TRUE(rtx_packet.SetAsRtxOf(media_packet));
+  rtx_packet.SetPayloadType(kPayloadType + 1);
+  rtx_packet.SetSequenceNumber(kSeqNum + 1);
+  rtx_packet.SetSsrc(kSsrc + 1);
+
+  // Marker, timestamp and extensions are carried over verbatim.
+  EXPECT_EQ(rtx_packet.Marker(), media_packet.Marker());
+  EXPECT_EQ(rtx_packet.Timestamp(), media_packet.Timestamp());
+  EXPECT_EQ(rtx_packet.GetExtension<TransmissionOffset>(), kTimeOffset);
+  // Payload is the original sequence number followed by the original payload.
+  ASSERT_EQ(rtx_packet.payload_size(),
+            sizeof(kPayloadData) + kRtxHeaderSize);
+  auto rtx_payload = rtx_packet.payload();
+  EXPECT_EQ(ByteReader<uint16_t>::ReadBigEndian(rtx_payload.data()), kSeqNum);
+  EXPECT_THAT(rtx_payload.subview(kRtxHeaderSize),
+              ElementsAreArray(kPayloadData));
+}
+
+TEST(RtpPacketTest, SetAsRtxOfFailsWhenPayloadDoesNotFit) {
+  RtpPacketToSend media_packet(nullptr, kMaxPaddingSize);
+  media_packet.SetSequenceNumber(kSeqNum);
+  media_packet.SetSsrc(kSsrc);
+  media_packet.AllocatePayload(media_packet.MaxPayloadSize());
+
+  // No room for the two byte headroom in an equally sized packet.
+  RtpPacketToSend rtx_packet(nullptr, kMaxPaddingSize);
+  EXPECT_FALSE(rtx_packet.SetAsRtxOf(media_packet));
+}
+
 }  // namespace webrtc
@@ -528,26 +528,22 @@ void RTPSender::UpdateRtpStats(const RtpPacketToSend& packet,
                                bool is_retransmit) {
   int64_t now_ms = clock_->TimeInMilliseconds();
 
-  rtc::CritScope lock(&statistics_crit_);
-  StreamDataCounters* counters = is_rtx ? &rtx_rtp_stats_ : &rtp_stats_;
+  // The counter block is lock-free; update it before taking
+  // |statistics_crit_|, which is only needed for the rate trackers and the
+  // callback registration below.
+  AtomicStreamDataCounters& counters = is_rtx ? rtx_rtp_stats_ : rtp_stats_;
+  const bool is_fec =
+      packet.packet_type() == RtpPacketToSend::Type::kForwardErrorCorrection;
+  counters.OnPacketSent(packet, is_fec, is_retransmit, now_ms);
 
+  rtc::CritScope lock(&statistics_crit_);
   total_bitrate_sent_.Update(packet.size(), now_ms);
-
-  if (counters->first_packet_time_ms == -1)
-    counters->first_packet_time_ms = now_ms;
-
-  if (packet.packet_type() == RtpPacketToSend::Type::kForwardErrorCorrection) {
-    counters->fec.AddPacket(packet);
-  }
-
-  if (is_retransmit) {
-    counters->retransmitted.AddPacket(packet);
+  if (is_retransmit)
     nack_bitrate_sent_.Update(packet.size(), now_ms);
-  }
-  counters->transmitted.AddPacket(packet);
 
   if (rtp_stats_callback_)
-    rtp_stats_callback_->DataCountersUpdated(*counters, packet.Ssrc());
+    rtp_stats_callback_->DataCountersUpdated(counters.GetSnapshot(),
+                                             packet.Ssrc());
 }
 
 std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
@@ -597,7 +593,23 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
     padding_bytes_in_packet = rtc::SafeMin(max_payload_size, kMaxPaddingLength);
   }
 
+  // All padding packets generated below are identical except for their
+  // sequence numbers, so once the first one has been built the remaining ones
+  // are copies of it with the sequence number replaced. This skips reserving
+  // the header extensions and clearing the padding payload over and over when
+  // a probe cluster asks for several packets worth of padding at once.
+  const RtpPacketToSend* padding_template = nullptr;
   while (bytes_left > 0) {
+    if (padding_template != nullptr) {
+      auto padding_packet =
+          absl::make_unique<RtpPacketToSend>(*padding_template);
+      padding_packet->SetSequenceNumber(
+          rtx_ == kRtxOff ? sequence_number_++ : sequence_number_rtx_++);
+      bytes_left -= std::min(bytes_left, padding_bytes_in_packet);
+      padding_packets.push_back(std::move(padding_packet));
+      continue;
+    }
+
     auto padding_packet =
         absl::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
     padding_packet->set_packet_type(RtpPacketToSend::Type::kPadding);
@@ -660,6 +672,7 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
     padding_packet->SetPadding(padding_bytes_in_packet);
     bytes_left -= std::min(bytes_left, padding_bytes_in_packet);
     padding_packets.push_back(std::move(padding_packet));
+    padding_template = padding_packets.back().get();
   }
 
   return padding_packets;
@@ -811,9 +824,8 @@ uint16_t RTPSender::AllocateSequenceNumber(uint16_t packets_to_send) {
 
 void RTPSender::GetDataCounters(StreamDataCounters* rtp_stats,
                                 StreamDataCounters* rtx_stats) const {
-  rtc::CritScope lock(&statistics_crit_);
-  *rtp_stats = rtp_stats_;
-  *rtx_stats = rtx_rtp_stats_;
+  *rtp_stats = rtp_stats_.GetSnapshot();
+  *rtx_stats = rtx_rtp_stats_.GetSnapshot();
 }
 
 std::unique_ptr<RtpPacketToSend> RTPSender::AllocatePacket() const {
@@ -1040,6 +1052,21 @@ std::unique_ptr<RtpPacketToSend> RTPSender::BuildRtxPacket(
     rtx_packet = absl::make_unique<RtpPacketToSend>(&rtp_header_extension_map_,
                                                     max_packet_size_);
 
+    // In steady state (RTX SSRC acked, no per-SSRC stream id extensions on
+    // the media packet) nothing needs to be added or stripped, so the whole
+    // packet can be converted in a single pass instead of rebuilding the
+    // header and copying extensions one by one.
+    if (rtx_ssrc_has_acked_ && !packet.HasExtension(kRtpExtensionMid) &&
+        !packet.HasExtension(kRtpExtensionRtpStreamId) &&
+        rtx_packet->SetAsRtxOf(packet)) {
+      rtx_packet->SetPayloadType(kv->second);
+      rtx_packet->SetSequenceNumber(sequence_number_rtx_++);
+      rtx_packet->SetSsrc(*ssrc_rtx_);
+      rtx_packet->set_application_data(packet.application_data());
+      rtx_packet->set_capture_time_ms(packet.capture_time_ms());
+      return rtx_packet;
+    }
+
     rtx_packet->SetPayloadType(kv->second);
 
     // Replace sequence number.
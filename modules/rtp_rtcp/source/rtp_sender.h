@@ -27,6 +27,7 @@
 #include "modules/rtp_rtcp/include/rtp_packet_sender.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/atomic_stream_data_counters.h"
 #include "modules/rtp_rtcp/source/rtp_packet_history.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_config.h"
 #include "rtc_base/constructor_magic.h"
@@ -245,8 +246,10 @@ class RTPSender {
   int64_t sum_delays_ms_ RTC_GUARDED_BY(statistics_crit_);
   // The sum of delays of all packets sent.
   uint64_t total_packet_send_delay_ms_ RTC_GUARDED_BY(statistics_crit_);
-  StreamDataCounters rtp_stats_ RTC_GUARDED_BY(statistics_crit_);
-  StreamDataCounters rtx_rtp_stats_ RTC_GUARDED_BY(statistics_crit_);
+  // Updated with relaxed atomics on the packet path and read as lock-free
+  // snapshots on the stats path, so they don't need |statistics_crit_|.
+  AtomicStreamDataCounters rtp_stats_;
+  AtomicStreamDataCounters rtx_rtp_stats_;
   StreamDataCountersCallback* rtp_stats_callback_
       RTC_GUARDED_BY(statistics_crit_);
   RateStatistics total_bitrate_sent_ RTC_GUARDED_BY(statistics_crit_);
@@ -21,6 +21,7 @@
 #include "absl/memory/memory.h"
 #include "absl/strings/match.h"
 #include "api/crypto/frame_encryptor_interface.h"
+#include "api/task_queue/default_task_queue_factory.h"
 #include "modules/remote_bitrate_estimator/test/bwe_test_logging.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
@@ -233,9 +234,22 @@ RTPSenderVideo::RTPSenderVideo(Clock* clock,
           field_trials.Lookup(kExcludeTransportSequenceNumberFromFecFieldTrial)
               .find("Enabled") == 0) {
   RTC_DCHECK(playout_delay_oracle_);
+  if (frame_encryptor_ != nullptr &&
+      field_trials.Lookup("WebRTC-AsyncFrameEncryption").find("Enabled") ==
+          0) {
+    encryption_queue_factory_ = CreateDefaultTaskQueueFactory();
+    encryption_queue_ = absl::make_unique<rtc::TaskQueue>(
+        encryption_queue_factory_->CreateTaskQueue(
+            "FrameEncryptor", TaskQueueFactory::Priority::HIGH));
+  }
 }
 
-RTPSenderVideo::~RTPSenderVideo() {}
+RTPSenderVideo::~RTPSenderVideo() {
+  // Stop the encryption queue before any other member is torn down. This
+  // blocks until a task in progress has finished; tasks that have not yet
+  // started are discarded.
+  encryption_queue_ = nullptr;
+}
 
 void RTPSenderVideo::RegisterPayloadType(int8_t payload_type,
                                          absl::string_view payload_name,
@@ -459,6 +473,33 @@ absl::optional<uint32_t> RTPSenderVideo::FlexfecSsrc() const {
   return absl::nullopt;
 }
 
+// Everything SendVideo() prepares before encryption that the packetization
+// stage needs, so that a frame can be handed over to |encryption_queue_| when
+// asynchronous frame encryption is enabled.
+struct RTPSenderVideo::PendingFrame {
+  VideoFrameType frame_type;
+  int8_t payload_type;
+  uint32_t rtp_timestamp;
+  int64_t capture_time_ms;
+  RTPVideoHeader packetize_video_header;
+  uint8_t temporal_id;
+  absl::optional<PlayoutDelay> playout_delay;
+  RtpPacketizer::PayloadSizeLimits limits;
+  std::unique_ptr<RtpPacketToSend> single_packet;
+  std::unique_ptr<RtpPacketToSend> first_packet;
+  std::unique_ptr<RtpPacketToSend> middle_packet;
+  std::unique_ptr<RtpPacketToSend> last_packet;
+  int32_t retransmission_settings;
+  bool red_enabled;
+  absl::optional<int64_t> expected_retransmission_time_ms;
+  // Owned copies of the payload, the authenticated descriptor bytes and the
+  // fragmentation. Set only on the asynchronous path, where the caller's
+  // buffers do not outlive SendVideo().
+  rtc::Buffer payload;
+  rtc::Buffer additional_data;
+  std::unique_ptr<RTPFragmentationHeader> fragmentation;
+};
+
 bool RTPSenderVideo::SendVideo(
     VideoFrameType frame_type,
     int8_t payload_type,
@@ -609,6 +650,23 @@ bool RTPSenderVideo::SendVideo(
     }
   }
 
+  auto frame = absl::make_unique<PendingFrame>();
+  frame->frame_type = frame_type;
+  frame->payload_type = payload_type;
+  frame->rtp_timestamp = rtp_timestamp;
+  frame->capture_time_ms = capture_time_ms;
+  frame->packetize_video_header = *packetize_video_header;
+  frame->temporal_id = GetTemporalId(*video_header);
+  frame->playout_delay = playout_delay;
+  frame->limits = limits;
+  frame->single_packet = std::move(single_packet);
+  frame->first_packet = std::move(first_packet);
+  frame->middle_packet = std::move(middle_packet);
+  frame->last_packet = std::move(last_packet);
+  frame->retransmission_settings = retransmission_settings;
+  frame->red_enabled = red_enabled;
+  frame->expected_retransmission_time_ms = expected_retransmission_time_ms;
+
   // TODO(benwright@webrtc.org) - Allocate enough to always encrypt inline.
   rtc::Buffer encrypted_video_payload;
   if (frame_encryptor_ != nullptr) {
@@ -616,22 +674,40 @@ bool RTPSenderVideo::SendVideo(
       return false;
     }
 
-    const size_t max_ciphertext_size =
-        frame_encryptor_->GetMaxCiphertextByteSize(cricket::MEDIA_TYPE_VIDEO,
-                                                   payload_size);
-    encrypted_video_payload.SetSize(max_ciphertext_size);
-
-    size_t bytes_written = 0;
-
     // Only enable header authentication if the field trial is enabled.
     rtc::ArrayView<const uint8_t> additional_data;
     if (generic_descriptor_auth_experiment_) {
       additional_data = generic_descriptor_raw;
     }
 
+    if (encryption_queue_) {
+      // The caller's buffers do not outlive this call, so the payload, the
+      // authenticated descriptor bytes and the fragmentation have to be
+      // copied before the frame is handed over to the encryption queue.
+      frame->payload.SetData(payload_data, payload_size);
+      if (!additional_data.empty()) {
+        frame->additional_data.SetData(additional_data.data(),
+                                       additional_data.size());
+      }
+      if (fragmentation) {
+        frame->fragmentation = absl::make_unique<RTPFragmentationHeader>();
+        frame->fragmentation->CopyFrom(*fragmentation);
+      }
+      PendingFrame* raw_frame = frame.release();
+      encryption_queue_->PostTask(
+          [this, raw_frame] { EncryptAndSendVideo(absl::WrapUnique(raw_frame)); });
+      return true;
+    }
+
+    const size_t max_ciphertext_size =
+        frame_encryptor_->GetMaxCiphertextByteSize(cricket::MEDIA_TYPE_VIDEO,
+                                                   payload_size);
+    encrypted_video_payload.SetSize(max_ciphertext_size);
+
+    size_t bytes_written = 0;
     if (frame_encryptor_->Encrypt(
-            cricket::MEDIA_TYPE_VIDEO, first_packet->Ssrc(), additional_data,
-            rtc::MakeArrayView(payload_data, payload_size),
+            cricket::MEDIA_TYPE_VIDEO, frame->first_packet->Ssrc(),
+            additional_data, rtc::MakeArrayView(payload_data, payload_size),
             encrypted_video_payload, &bytes_written) != 0) {
       return false;
     }
@@ -645,29 +721,62 @@ bool RTPSenderVideo::SendVideo(
         << "one is required since require_frame_encryptor is set";
   }
 
+  return PacketizeAndSendVideo(frame.get(),
+                               rtc::MakeArrayView(payload_data, payload_size),
+                               fragmentation);
+}
+
+void RTPSenderVideo::EncryptAndSendVideo(std::unique_ptr<PendingFrame> frame) {
+  const size_t max_ciphertext_size = frame_encryptor_->GetMaxCiphertextByteSize(
+      cricket::MEDIA_TYPE_VIDEO, frame->payload.size());
+  rtc::Buffer encrypted_video_payload(max_ciphertext_size);
+
+  size_t bytes_written = 0;
+  if (frame_encryptor_->Encrypt(cricket::MEDIA_TYPE_VIDEO,
+                                frame->first_packet->Ssrc(),
+                                frame->additional_data, frame->payload,
+                                encrypted_video_payload, &bytes_written) != 0) {
+    RTC_LOG(LS_WARNING) << "Frame encryption failed, dropping frame.";
+    return;
+  }
+
+  encrypted_video_payload.SetSize(bytes_written);
+  frame->payload = std::move(encrypted_video_payload);
+  if (!PacketizeAndSendVideo(frame.get(), frame->payload,
+                             frame->fragmentation.get())) {
+    RTC_LOG(LS_WARNING) << "Failed to packetize encrypted video frame.";
+  }
+}
+
+bool RTPSenderVideo::PacketizeAndSendVideo(
+    PendingFrame* frame,
+    rtc::ArrayView<const uint8_t> payload,
+    const RTPFragmentationHeader* fragmentation) {
   absl::optional<VideoCodecType> type;
   {
     rtc::CritScope cs(&payload_type_crit_);
-    const auto it = payload_type_map_.find(payload_type);
+    const auto it = payload_type_map_.find(frame->payload_type);
     if (it == payload_type_map_.end()) {
-      RTC_LOG(LS_ERROR) << "Payload type " << static_cast<int>(payload_type)
+      RTC_LOG(LS_ERROR) << "Payload type "
+                        << static_cast<int>(frame->payload_type)
                         << " not registered.";
       return false;
     }
     type = it->second;
   }
-  std::unique_ptr<RtpPacketizer> packetizer = RtpPacketizer::Create(
-      type, rtc::MakeArrayView(payload_data, payload_size), limits,
-      *packetize_video_header, frame_type, fragmentation);
+  const RtpPacketizer::PayloadSizeLimits& limits = frame->limits;
+  std::unique_ptr<RtpPacketizer> packetizer =
+      RtpPacketizer::Create(type, payload, limits, frame->packetize_video_header,
+                            frame->frame_type, fragmentation);
 
-  const uint8_t temporal_id = GetTemporalId(*video_header);
+  const uint8_t temporal_id = frame->temporal_id;
   // TODO(bugs.webrtc.org/10714): retransmission_settings_ should generally be
   // replaced by expected_retransmission_time_ms.has_value(). For now, though,
   // only VP8 with an injected frame buffer controller actually controls it.
   const bool allow_retransmission =
-      expected_retransmission_time_ms.has_value()
-          ? AllowRetransmission(temporal_id, retransmission_settings,
-                                expected_retransmission_time_ms.value())
+      frame->expected_retransmission_time_ms.has_value()
+          ? AllowRetransmission(temporal_id, frame->retransmission_settings,
+                                frame->expected_retransmission_time_ms.value())
           : false;
   const size_t num_packets = packetizer->NumPackets();
 
@@ -678,7 +787,7 @@ bool RTPSenderVideo::SendVideo(
       unpacketized_payload_size += fragmentation->fragmentationLength[i];
     }
   } else {
-    unpacketized_payload_size = payload_size;
+    unpacketized_payload_size = payload.size();
   }
   size_t packetized_payload_size = 0;
 
@@ -692,19 +801,19 @@ bool RTPSenderVideo::SendVideo(
     int expected_payload_capacity;
     // Choose right packet template:
     if (num_packets == 1) {
-      packet = std::move(single_packet);
+      packet = std::move(frame->single_packet);
       expected_payload_capacity =
           limits.max_payload_len - limits.single_packet_reduction_len;
     } else if (i == 0) {
-      packet = std::move(first_packet);
+      packet = std::move(frame->first_packet);
       expected_payload_capacity =
           limits.max_payload_len - limits.first_packet_reduction_len;
     } else if (i == num_packets - 1) {
-      packet = std::move(last_packet);
+      packet = std::move(frame->last_packet);
       expected_payload_capacity =
           limits.max_payload_len - limits.last_packet_reduction_len;
     } else {
-      packet = absl::make_unique<RtpPacketToSend>(*middle_packet);
+      packet = absl::make_unique<RtpPacketToSend>(*frame->middle_packet);
       expected_payload_capacity = limits.max_payload_len;
     }
 
@@ -721,7 +830,7 @@ bool RTPSenderVideo::SendVideo(
 
     if (i == 0) {
       playout_delay_oracle_->OnSentPacket(packet->SequenceNumber(),
-                                          playout_delay);
+                                          frame->playout_delay);
     }
     // No FEC protection for upper temporal layers, if used.
     bool protect_packet = temporal_id == 0 || temporal_id == kNoTemporalIdx;
@@ -744,7 +853,7 @@ bool RTPSenderVideo::SendVideo(
       // TODO(brandtr): Remove the FlexFEC code path when FlexfecSender
       // is wired up to PacedSender instead.
       SendVideoPacketWithFlexfec(std::move(packet), protect_packet);
-    } else if (red_enabled) {
+    } else if (frame->red_enabled) {
       SendVideoPacketAsRedMaybeWithUlpfec(std::move(packet), protect_packet);
     } else {
       SendVideoPacket(std::move(packet));
@@ -763,7 +872,8 @@ bool RTPSenderVideo::SendVideo(
   }
 
   if (rtp_sequence_number_map_) {
-    const uint32_t timestamp = rtp_timestamp - rtp_sender_->TimestampOffset();
+    const uint32_t timestamp =
+        frame->rtp_timestamp - rtp_sender_->TimestampOffset();
     rtc::CritScope cs(&crit_);
     rtp_sequence_number_map_->InsertFrame(first_sequence_number, num_packets,
                                           timestamp);
@@ -775,8 +885,8 @@ bool RTPSenderVideo::SendVideo(
       packetized_payload_size - unpacketized_payload_size,
       clock_->TimeInMilliseconds());
 
-  TRACE_EVENT_ASYNC_END1("webrtc", "Video", capture_time_ms, "timestamp",
-                         rtp_timestamp);
+  TRACE_EVENT_ASYNC_END1("webrtc", "Video", frame->capture_time_ms, "timestamp",
+                         frame->rtp_timestamp);
   return true;
 }
 
@@ -800,31 +910,12 @@ std::vector<RtpSequenceNumberMap::Info> RTPSenderVideo::GetSentRtpPacketInfos(
     rtc::ArrayView<const uint16_t> sequence_numbers) const {
   RTC_DCHECK(!sequence_numbers.empty());
 
-  std::vector<RtpSequenceNumberMap::Info> results;
   if (!rtp_sequence_number_map_) {
-    return results;
-  }
-  results.reserve(sequence_numbers.size());
-
-  {
-    rtc::CritScope cs(&crit_);
-    for (uint16_t sequence_number : sequence_numbers) {
-      const absl::optional<RtpSequenceNumberMap::Info> info =
-          rtp_sequence_number_map_->Get(sequence_number);
-      if (!info) {
-        // The empty vector will be returned. We can delay the clearing
-        // of the vector until after we exit the critical section.
-        break;
-      }
-      results.push_back(*info);
-    }
+    return std::vector<RtpSequenceNumberMap::Info>();
   }
 
-  if (results.size() != sequence_numbers.size()) {
-    results.clear();  // Some sequence number was not found.
-  }
-
-  return results;
+  rtc::CritScope cs(&crit_);
+  return rtp_sequence_number_map_->Get(sequence_numbers);
 }
 
 bool RTPSenderVideo::AllowRetransmission(
@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "api/array_view.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "modules/rtp_rtcp/include/flexfec_sender.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/playout_delay_oracle.h"
@@ -29,6 +30,7 @@
 #include "rtc_base/one_time_event.h"
 #include "rtc_base/rate_statistics.h"
 #include "rtc_base/synchronization/sequence_checker.h"
+#include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
@@ -126,6 +128,21 @@ class RTPSenderVideo {
     int64_t last_frame_time_ms;
   };
 
+  // Everything SendVideo() prepares before encryption that the packetization
+  // stage needs, gathered in one place so a frame can be handed over to
+  // |encryption_queue_|. Defined in the .cc file.
+  struct PendingFrame;
+
+  // Encrypts |frame->payload| in place and packetizes the result. Runs on
+  // |encryption_queue_| when asynchronous frame encryption is enabled.
+  void EncryptAndSendVideo(std::unique_ptr<PendingFrame> frame);
+
+  // Packetization half of SendVideo(): creates the packetizer for |payload|
+  // and sends the resulting packets. |fragmentation| may be null.
+  bool PacketizeAndSendVideo(PendingFrame* frame,
+                             rtc::ArrayView<const uint8_t> payload,
+                             const RTPFragmentationHeader* fragmentation);
+
   size_t CalculateFecPacketOverhead() const RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
   void SendVideoPacket(std::unique_ptr<RtpPacketToSend> packet);
@@ -218,6 +235,13 @@ class RTPSenderVideo {
   const bool generic_descriptor_auth_experiment_;
 
   const bool exclude_transport_sequence_number_from_fec_experiment_;
+
+  // Set when the WebRTC-AsyncFrameEncryption field trial is enabled and a
+  // frame encryptor is attached. Frames are then encrypted and packetized on
+  // this queue instead of on the encoder callback thread; the queue is serial
+  // so the per-stream send order is preserved.
+  std::unique_ptr<TaskQueueFactory> encryption_queue_factory_;
+  std::unique_ptr<rtc::TaskQueue> encryption_queue_;
 };
 
 }  // namespace webrtc
@@ -10,74 +10,99 @@
 
 #include "modules/rtp_rtcp/source/rtp_sequence_number_map.h"
 
-#include <algorithm>
-#include <iterator>
 #include <limits>
 
-#include "absl/algorithm/container.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/sequence_number_util.h"
 
 namespace webrtc {
+namespace {
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+  return result;
+}
+
+}  // namespace
 
 RtpSequenceNumberMap::RtpSequenceNumberMap(size_t max_entries)
-    : max_entries_(max_entries) {
+    : max_entries_(max_entries),
+      ring_(RoundUpToPowerOfTwo(max_entries), Association(0)),
+      first_(0),
+      size_(0) {
   RTC_DCHECK_GT(max_entries_, 4);  // See code paring down to |max_entries_|.
   RTC_DCHECK_LE(max_entries_, 1 << 15);
 }
 
 RtpSequenceNumberMap::~RtpSequenceNumberMap() = default;
 
+void RtpSequenceNumberMap::PopFront(size_t count) {
+  RTC_DCHECK_LE(count, size_);
+  first_ = (first_ + count) & (ring_.size() - 1);
+  size_ -= count;
+}
+
+void RtpSequenceNumberMap::PushBack(const Association& association) {
+  RTC_DCHECK_LT(size_, ring_.size());
+  ring_[(first_ + size_) & (ring_.size() - 1)] = association;
+  ++size_;
+}
+
 void RtpSequenceNumberMap::InsertPacket(uint16_t sequence_number, Info info) {
-  RTC_DCHECK(associations_.size() < 2 ||
-             AheadOf(associations_.back().sequence_number,
-                     associations_.front().sequence_number));
+  RTC_DCHECK(size_ < 2 || AheadOf(At(size_ - 1).sequence_number,
+                                  At(0).sequence_number));
 
-  if (associations_.empty()) {
-    associations_.emplace_back(sequence_number, info);
+  if (size_ == 0) {
+    PushBack(Association(sequence_number, info));
     return;
   }
 
-  if (AheadOrAt(sequence_number, associations_.front().sequence_number) &&
-      AheadOrAt(associations_.back().sequence_number, sequence_number)) {
+  if (AheadOrAt(sequence_number, At(0).sequence_number) &&
+      AheadOrAt(At(size_ - 1).sequence_number, sequence_number)) {
     // The sequence number has wrapped around and is within the range
-    // currently held by |associations_| - we should invalidate all entries.
+    // currently held by the map - we should invalidate all entries.
     RTC_LOG(LS_WARNING) << "Sequence number wrapped-around unexpectedly.";
-    associations_.clear();
-    associations_.emplace_back(sequence_number, info);
+    size_ = 0;
+    PushBack(Association(sequence_number, info));
     return;
   }
 
-  std::deque<Association>::iterator erase_to = associations_.begin();
+  size_t erase_to = 0;
 
-  RTC_DCHECK_LE(associations_.size(), max_entries_);
-  if (associations_.size() == max_entries_) {
+  RTC_DCHECK_LE(size_, max_entries_);
+  if (size_ == max_entries_) {
     // Pare down the container so that inserting some additional elements
     // would not exceed the maximum size.
     const size_t new_size = 3 * max_entries_ / 4;
-    erase_to = std::next(erase_to, max_entries_ - new_size);
+    erase_to = max_entries_ - new_size;
   }
 
-  // It is guaranteed that |associations_| can be split into two partitions,
+  // It is guaranteed that the associations can be split into two partitions,
   // either partition possibly empty, such that:
   // * In the first partition, all elements are AheadOf the new element.
   //   This is the partition of the obsolete elements.
   // * In the second partition, the new element is AheadOf all the elements.
   //   The elements of this partition may stay.
-  auto cmp = [](const Association& a, uint16_t sequence_number) {
-    return AheadOf(a.sequence_number, sequence_number);
-  };
-  RTC_DCHECK(erase_to != associations_.end());
-  erase_to =
-      std::lower_bound(erase_to, associations_.end(), sequence_number, cmp);
-  associations_.erase(associations_.begin(), erase_to);
-
-  associations_.emplace_back(sequence_number, info);
-
-  RTC_DCHECK(associations_.size() == 1 ||
-             AheadOf(associations_.back().sequence_number,
-                     associations_.front().sequence_number));
+  size_t lower = erase_to;
+  size_t upper = size_;
+  while (lower < upper) {
+    const size_t middle = (lower + upper) / 2;
+    if (AheadOf(At(middle).sequence_number, sequence_number)) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
+  PopFront(lower);
+
+  PushBack(Association(sequence_number, info));
+
+  RTC_DCHECK(size_ == 1 || AheadOf(At(size_ - 1).sequence_number,
+                                   At(0).sequence_number));
 }
 
 void RtpSequenceNumberMap::InsertFrame(uint16_t first_sequence_number,
@@ -104,26 +129,45 @@ absl::optional<RtpSequenceNumberMap::Info> RtpSequenceNumberMap::Get(
   // Finding such an offset is easy - the offset that would map the oldest
   // element to 0 would serve this purpose.
 
-  if (associations_.empty()) {
+  if (size_ == 0) {
     return absl::nullopt;
   }
 
-  const uint16_t offset =
-      static_cast<uint16_t>(0) - associations_.front().sequence_number;
-
-  auto cmp = [offset](const Association& a, uint16_t sequence_number) {
-    return static_cast<uint16_t>(a.sequence_number + offset) <
-           static_cast<uint16_t>(sequence_number + offset);
-  };
-  const auto elem = absl::c_lower_bound(associations_, sequence_number, cmp);
+  const uint16_t offset = static_cast<uint16_t>(0) - At(0).sequence_number;
+
+  size_t lower = 0;
+  size_t upper = size_;
+  while (lower < upper) {
+    const size_t middle = (lower + upper) / 2;
+    if (static_cast<uint16_t>(At(middle).sequence_number + offset) <
+        static_cast<uint16_t>(sequence_number + offset)) {
+      lower = middle + 1;
+    } else {
+      upper = middle;
+    }
+  }
 
-  return elem != associations_.end() && elem->sequence_number == sequence_number
-             ? absl::optional<Info>(elem->info)
+  return lower != size_ && At(lower).sequence_number == sequence_number
+             ? absl::optional<Info>(At(lower).info)
              : absl::nullopt;
 }
 
+std::vector<RtpSequenceNumberMap::Info> RtpSequenceNumberMap::Get(
+    rtc::ArrayView<const uint16_t> sequence_numbers) const {
+  std::vector<Info> infos;
+  infos.reserve(sequence_numbers.size());
+  for (uint16_t sequence_number : sequence_numbers) {
+    const absl::optional<Info> info = Get(sequence_number);
+    if (!info) {
+      return std::vector<Info>();
+    }
+    infos.push_back(*info);
+  }
+  return infos;
+}
+
 size_t RtpSequenceNumberMap::AssociationCountForTesting() const {
-  return associations_.size();
+  return size_;
 }
 
 }  // namespace webrtc
@@ -13,9 +13,10 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <vector>
 
 #include "absl/types/optional.h"
+#include "api/array_view.h"
 
 namespace webrtc {
 
@@ -59,6 +60,12 @@ class RtpSequenceNumberMap final {
 
   absl::optional<Info> Get(uint16_t sequence_number) const;
 
+  // Batch variant of Get(), for callers that look up all the sequence numbers
+  // of a feedback message at once. Returns the recorded Info for each element
+  // of |sequence_numbers|, in order, or an empty vector if any of them is
+  // unknown.
+  std::vector<Info> Get(rtc::ArrayView<const uint16_t> sequence_numbers) const;
+
   size_t AssociationCountForTesting() const;
 
  private:
@@ -73,11 +80,25 @@ class RtpSequenceNumberMap final {
     Info info;
   };
 
+  // Returns the association at logical position |index|, with 0 the oldest.
+  const Association& At(size_t index) const {
+    return ring_[(first_ + index) & (ring_.size() - 1)];
+  }
+
+  void PopFront(size_t count);
+  void PushBack(const Association& association);
+
   const size_t max_entries_;
 
-  // The non-transitivity of AheadOf() would be problematic with a map,
-  // so we use a deque instead.
-  std::deque<Association> associations_;
+  // The associations, in insertion order; the non-transitivity of AheadOf()
+  // would be problematic with a map. They are kept in a fixed power-of-two
+  // ring sized for |max_entries_|, allocated up front: entries only ever
+  // leave at the front and enter at the back, so inserting and paring down
+  // just move |first_| and |size_| and steady-state operation does not
+  // allocate.
+  std::vector<Association> ring_;
+  size_t first_;
+  size_t size_;
 };
 
 }  // namespace webrtc
@@ -167,6 +167,34 @@ TEST_F(RtpSequenceNumberMapTest, GetUnknownSequenceNumberReturnsNullOpt2) {
   EXPECT_FALSE(uut.Get(1001));
 }
 
+TEST_F(RtpSequenceNumberMapTest, BatchGetReturnsAllKnownSequenceNumbers) {
+  RtpSequenceNumberMap uut(kMaxPossibleMaxEntries);
+
+  const std::vector<Association> setup = {CreateAssociation(1000, 500),  //
+                                          CreateAssociation(1001, 501),  //
+                                          CreateAssociation(1002, 502)};
+  for (const Association& association : setup) {
+    uut.InsertPacket(association.sequence_number, association.info);
+  }
+
+  const uint16_t sequence_numbers[] = {1002, 1000};
+  const std::vector<Info> infos = uut.Get(sequence_numbers);
+  ASSERT_EQ(infos.size(), 2u);
+  EXPECT_EQ(infos[0], setup[2].info);
+  EXPECT_EQ(infos[1], setup[0].info);
+}
+
+TEST_F(RtpSequenceNumberMapTest,
+       BatchGetReturnsEmptyIfAnySequenceNumberUnknown) {
+  RtpSequenceNumberMap uut(kMaxPossibleMaxEntries);
+
+  const Association association = CreateAssociation(1000, 500);
+  uut.InsertPacket(association.sequence_number, association.info);
+
+  const uint16_t sequence_numbers[] = {1000, 1001};
+  EXPECT_TRUE(uut.Get(sequence_numbers).empty());
+}
+
 TEST_P(RtpSequenceNumberMapTestWithParams,
        GetKnownSequenceNumberReturnsCorrectValue) {
   RtpSequenceNumberMap uut(kMaxPossibleMaxEntries);
@@ -32,6 +32,12 @@ class ProcessThread {
 
   static std::unique_ptr<ProcessThread> Create(const char* thread_name);
 
+  // Creates a handle backed by a process-wide pool of scheduler threads
+  // instead of a dedicated thread per instance. Modules keep per-thread
+  // affinity, but the total number of worker threads stays flat no matter
+  // how many handles exist. See SharedProcessThread.
+  static std::unique_ptr<ProcessThread> CreateShared(const char* thread_name);
+
   // Starts the worker thread.  Must be called from the construction thread.
   virtual void Start() = 0;
 
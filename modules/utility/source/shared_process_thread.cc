@@ -0,0 +1,433 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/utility/source/shared_process_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <queue>
+#include <string>
+#include <utility>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_base/trace_event.h"
+#include "system_wrappers/include/cpu_info.h"
+
+namespace webrtc {
+namespace {
+
+// Same sentinel as ProcessThreadImpl: the module asked to be processed
+// right away, skip the TimeUntilNextProcess() query.
+const int64_t kCallProcessImmediately = -1;
+
+// Timing wheel geometry. 256 slots of 4 ms give a one second horizon;
+// deadlines beyond it simply circulate the wheel until their time comes,
+// which costs one extra look per rotation.
+constexpr int kWheelSlots = 256;
+constexpr int64_t kSlotSpanMs = 4;
+constexpr uint32_t kWheelMask = kWheelSlots - 1;
+
+int64_t GetNextCallbackTime(Module* module, int64_t time_now) {
+  int64_t interval = module->TimeUntilNextProcess();
+  if (interval < 0) {
+    // Falling behind, we should call the callback now.
+    return time_now;
+  }
+  return time_now + interval;
+}
+
+}  // namespace
+
+// One worker thread plus the timing wheel it serves. Shards are created
+// once per process and never torn down.
+class ProcessSchedulerShard {
+ public:
+  explicit ProcessSchedulerShard(int index) : stop_(false) {
+    rtc::StringBuilder name;
+    name << "SharedProcessThread" << index;
+    thread_name_ = name.Release();
+    thread_.reset(new rtc::PlatformThread(&ProcessSchedulerShard::Run, this,
+                                          thread_name_.c_str()));
+    thread_->Start();
+  }
+
+  void AddModule(Module* module,
+                 const rtc::Location& location,
+                 ProcessThread* owner) {
+    {
+      rtc::CritScope lock(&lock_);
+#if RTC_DCHECK_IS_ON
+      RTC_DCHECK(FindEntry(module) == nullptr)
+          << "Already registered, now attempting from: " << location.ToString();
+#endif
+      immediate_.push_back(ModuleEntry(module, location, owner));
+    }
+    wake_up_.Set();
+  }
+
+  // Guaranteed not to return while the module's Process() is running, since
+  // Process() is called with |lock_| held.
+  void RemoveModule(Module* module) {
+    rtc::CritScope lock(&lock_);
+    auto has_module = [module](const ModuleEntry& e) {
+      return e.module == module;
+    };
+    immediate_.remove_if(has_module);
+    for (std::list<ModuleEntry>& slot : slots_)
+      slot.remove_if(has_module);
+  }
+
+  void WakeUpModule(Module* module) {
+    {
+      rtc::CritScope lock(&lock_);
+      ModuleEntry* entry = FindEntry(module);
+      if (!entry)
+        return;
+      entry->next_callback = kCallProcessImmediately;
+      MoveToImmediate(module);
+    }
+    wake_up_.Set();
+  }
+
+  void PostTask(std::unique_ptr<QueuedTask> task) {
+    {
+      rtc::CritScope lock(&lock_);
+      queue_.push(task.release());
+    }
+    wake_up_.Set();
+  }
+
+ private:
+  struct ModuleEntry {
+    ModuleEntry(Module* module,
+                const rtc::Location& location,
+                ProcessThread* owner)
+        : module(module), location(location), owner(owner) {}
+
+    Module* module;
+    rtc::Location location;
+    ProcessThread* owner;
+    int64_t next_callback = 0;  // Absolute timestamp; 0 means "query".
+  };
+
+  static void Run(void* obj) {
+    auto* shard = static_cast<ProcessSchedulerShard*>(obj);
+    while (shard->Process()) {
+    }
+  }
+
+  ModuleEntry* FindEntry(Module* module) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    for (ModuleEntry& entry : immediate_) {
+      if (entry.module == module)
+        return &entry;
+    }
+    for (std::list<ModuleEntry>& slot : slots_) {
+      for (ModuleEntry& entry : slot) {
+        if (entry.module == module)
+          return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  void MoveToImmediate(Module* module) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    for (std::list<ModuleEntry>& slot : slots_) {
+      for (auto it = slot.begin(); it != slot.end(); ++it) {
+        if (it->module == module) {
+          immediate_.splice(immediate_.end(), slot, it);
+          return;
+        }
+      }
+    }
+  }
+
+  void InsertIntoWheel(std::list<ModuleEntry>& from,
+                       std::list<ModuleEntry>::iterator it)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    uint32_t index =
+        static_cast<uint32_t>(it->next_callback / kSlotSpanMs) & kWheelMask;
+    slots_[index].splice(slots_[index].end(), from, it);
+  }
+
+  // Returns the absolute time of the next deadline in the wheel, or
+  // |horizon| if nothing is due before then. Scans slots, not modules.
+  int64_t NextDeadline(int64_t now, int64_t horizon)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    int64_t next = horizon;
+    for (int i = 0; i < kWheelSlots; ++i) {
+      int64_t slot_time = cursor_ms_ + i * kSlotSpanMs;
+      if (slot_time >= next)
+        break;
+      for (const ModuleEntry& entry :
+           slots_[static_cast<uint32_t>(slot_time / kSlotSpanMs) &
+                  kWheelMask]) {
+        next = std::min(next, std::max(entry.next_callback, now));
+      }
+    }
+    return next;
+  }
+
+  bool Process() {
+    TRACE_EVENT1("webrtc", "ProcessSchedulerShard", "name",
+                 thread_name_.c_str());
+    int64_t now = rtc::TimeMillis();
+    int64_t next_checkpoint = now + (1000 * 60);
+
+    {
+      rtc::CritScope lock(&lock_);
+      if (stop_)
+        return false;
+
+      if (cursor_ms_ == 0)
+        cursor_ms_ = now - (now % kSlotSpanMs);
+
+      // Advance the wheel, collecting entries that are due. Entries in a
+      // reached slot whose deadline is still in the future belong to a
+      // later rotation and stay put.
+      std::list<ModuleEntry> due;
+      due.splice(due.end(), immediate_);
+      while (cursor_ms_ <= now) {
+        std::list<ModuleEntry>& slot =
+            slots_[static_cast<uint32_t>(cursor_ms_ / kSlotSpanMs) &
+                   kWheelMask];
+        for (auto it = slot.begin(); it != slot.end();) {
+          auto current = it++;
+          if (current->next_callback <= now)
+            due.splice(due.end(), slot, current);
+        }
+        if (cursor_ms_ + kSlotSpanMs > now)
+          break;
+        cursor_ms_ += kSlotSpanMs;
+      }
+
+      for (auto it = due.begin(); it != due.end();) {
+        auto current = it++;
+        ModuleEntry& m = *current;
+        if (m.next_callback == 0)
+          m.next_callback = GetNextCallbackTime(m.module, now);
+
+        if (m.next_callback <= now ||
+            m.next_callback == kCallProcessImmediately) {
+          {
+            TRACE_EVENT2("webrtc", "ModuleProcess", "function",
+                         m.location.function_name(), "file",
+                         m.location.file_and_line());
+            m.module->Process();
+          }
+          int64_t new_now = rtc::TimeMillis();
+          m.next_callback = GetNextCallbackTime(m.module, new_now);
+        }
+        next_checkpoint = std::min(next_checkpoint, m.next_callback);
+        InsertIntoWheel(due, current);
+      }
+
+      next_checkpoint = NextDeadline(now, next_checkpoint);
+
+      while (!queue_.empty()) {
+        QueuedTask* task = queue_.front();
+        queue_.pop();
+        lock_.Leave();
+        task->Run();
+        delete task;
+        lock_.Enter();
+      }
+    }
+
+    int64_t time_to_wait = next_checkpoint - rtc::TimeMillis();
+    if (time_to_wait > 0)
+      wake_up_.Wait(static_cast<int>(time_to_wait));
+
+    return true;
+  }
+
+  std::string thread_name_;
+  rtc::CriticalSection lock_;
+  rtc::Event wake_up_;
+  std::unique_ptr<rtc::PlatformThread> thread_;
+
+  // Entries to handle on the next pass regardless of the wheel: newly
+  // added modules and explicit wakeups.
+  std::list<ModuleEntry> immediate_ RTC_GUARDED_BY(lock_);
+  std::list<ModuleEntry> slots_[kWheelSlots] RTC_GUARDED_BY(lock_);
+  std::queue<QueuedTask*> queue_ RTC_GUARDED_BY(lock_);
+  int64_t cursor_ms_ RTC_GUARDED_BY(lock_) = 0;
+  bool stop_ RTC_GUARDED_BY(lock_);
+};
+
+namespace {
+
+// The process-wide shard pool, created on first use and intentionally
+// leaked. M scales with the core count but stays small; the point is a
+// flat thread count regardless of how many Call pipelines exist.
+class ProcessScheduler {
+ public:
+  static ProcessScheduler& Instance() {
+    static ProcessScheduler* const instance = new ProcessScheduler();
+    return *instance;
+  }
+
+  ProcessSchedulerShard* NextShard() {
+    uint32_t index =
+        next_shard_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+    return shards_[index].get();
+  }
+
+ private:
+  ProcessScheduler() {
+    int num_shards = std::max(
+        1, std::min(8, static_cast<int>(CpuInfo::DetectNumberOfCores()) / 2));
+    for (int i = 0; i < num_shards; ++i)
+      shards_.push_back(
+          std::unique_ptr<ProcessSchedulerShard>(new ProcessSchedulerShard(i)));
+  }
+
+  std::vector<std::unique_ptr<ProcessSchedulerShard>> shards_;
+  std::atomic<uint32_t> next_shard_{0};
+};
+
+}  // namespace
+
+// static
+std::unique_ptr<ProcessThread> ProcessThread::CreateShared(
+    const char* thread_name) {
+  return std::unique_ptr<ProcessThread>(new SharedProcessThread(thread_name));
+}
+
+SharedProcessThread::SharedProcessThread(const char* thread_name)
+    : thread_name_(thread_name),
+      task_shard_(ProcessScheduler::Instance().NextShard()),
+      running_(false) {}
+
+SharedProcessThread::~SharedProcessThread() {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  RTC_DCHECK(!running_);
+}
+
+void SharedProcessThread::Start() {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (running_)
+    return;
+  running_ = true;
+
+  // Assign shards under the lock, but call out to the modules and shards
+  // without it: a shard worker inside Process() may call back into
+  // WakeUp(), which takes |lock_|.
+  std::vector<RegisteredModule> to_add;
+  {
+    rtc::CritScope lock(&lock_);
+    for (RegisteredModule& m : modules_) {
+      m.shard = ProcessScheduler::Instance().NextShard();
+      to_add.push_back(m);
+    }
+  }
+  for (const RegisteredModule& m : to_add) {
+    m.module->ProcessThreadAttached(this);
+    m.shard->AddModule(m.module, m.location, this);
+  }
+}
+
+void SharedProcessThread::Stop() {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (!running_)
+    return;
+
+  std::vector<RegisteredModule> to_remove;
+  {
+    rtc::CritScope lock(&lock_);
+    for (RegisteredModule& m : modules_) {
+      to_remove.push_back(m);
+      m.shard = nullptr;
+    }
+  }
+  for (const RegisteredModule& m : to_remove) {
+    m.shard->RemoveModule(m.module);
+    m.module->ProcessThreadAttached(nullptr);
+  }
+  running_ = false;
+}
+
+void SharedProcessThread::WakeUp(Module* module) {
+  // Allowed to be called on any thread. The module knows which shard it
+  // lives on only via this handle, so look it up here. The shard call is
+  // made without |lock_| held to keep lock order one-way (shard workers
+  // may re-enter WakeUp() from Process()).
+  ProcessSchedulerShard* shard = nullptr;
+  {
+    rtc::CritScope lock(&lock_);
+    for (const RegisteredModule& m : modules_) {
+      if (m.module == module) {
+        shard = m.shard;
+        break;
+      }
+    }
+  }
+  if (shard)
+    shard->WakeUpModule(module);
+}
+
+void SharedProcessThread::PostTask(std::unique_ptr<QueuedTask> task) {
+  // Allowed to be called on any thread.
+  task_shard_->PostTask(std::move(task));
+}
+
+void SharedProcessThread::RegisterModule(Module* module,
+                                         const rtc::Location& from) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  RTC_DCHECK(module) << from.ToString();
+
+  RegisteredModule registered;
+  registered.module = module;
+  registered.location = from;
+  registered.shard = running_ ? ProcessScheduler::Instance().NextShard()
+                              : nullptr;
+  {
+    rtc::CritScope lock(&lock_);
+#if RTC_DCHECK_IS_ON
+    for (const RegisteredModule& m : modules_) {
+      RTC_DCHECK(m.module != module)
+          << "Already registered here: " << m.location.ToString() << "\n"
+          << "Now attempting from here: " << from.ToString();
+    }
+#endif
+    modules_.push_back(registered);
+  }
+  if (registered.shard) {
+    module->ProcessThreadAttached(this);
+    registered.shard->AddModule(module, from, this);
+  }
+}
+
+void SharedProcessThread::DeRegisterModule(Module* module) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  RTC_DCHECK(module);
+
+  ProcessSchedulerShard* shard = nullptr;
+  {
+    rtc::CritScope lock(&lock_);
+    for (auto it = modules_.begin(); it != modules_.end(); ++it) {
+      if (it->module == module) {
+        shard = it->shard;
+        modules_.erase(it);
+        break;
+      }
+    }
+  }
+  if (shard)
+    shard->RemoveModule(module);
+  module->ProcessThreadAttached(nullptr);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_UTILITY_SOURCE_SHARED_PROCESS_THREAD_H_
+#define MODULES_UTILITY_SOURCE_SHARED_PROCESS_THREAD_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/queued_task.h"
+#include "modules/include/module.h"
+#include "modules/utility/include/process_thread.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/location.h"
+#include "rtc_base/thread_checker.h"
+
+namespace webrtc {
+
+class ProcessSchedulerShard;
+
+// A ProcessThread handle backed by a process-wide pool of scheduler shards
+// instead of a dedicated thread per instance. Each shard runs one worker
+// thread with a timing wheel keyed by the modules' stated next-process
+// times, so the worker only touches modules that are actually due instead
+// of polling TimeUntilNextProcess() across every registered module. A
+// module is pinned to one shard from RegisterModule() until
+// DeRegisterModule(), so all of its Process() calls happen on the same
+// thread, like a dedicated ProcessThreadImpl would provide.
+//
+// Many handles share the M shard workers (M scales with the core count),
+// which keeps the thread count flat as the number of Call pipelines grows.
+class SharedProcessThread : public ProcessThread {
+ public:
+  explicit SharedProcessThread(const char* thread_name);
+  ~SharedProcessThread() override;
+
+  void Start() override;
+  void Stop() override;
+
+  void WakeUp(Module* module) override;
+  void PostTask(std::unique_ptr<QueuedTask> task) override;
+
+  void RegisterModule(Module* module, const rtc::Location& from) override;
+  void DeRegisterModule(Module* module) override;
+
+ private:
+  struct RegisteredModule {
+    Module* module;
+    rtc::Location location;
+    ProcessSchedulerShard* shard;  // Null until the handle is started.
+  };
+
+  rtc::ThreadChecker thread_checker_;
+  const char* const thread_name_;
+  // Shard that receives this handle's posted tasks.
+  ProcessSchedulerShard* const task_shard_;
+  // Guards modules_ against WakeUp(), which may run on any thread; all
+  // other accesses are from the construction thread.
+  rtc::CriticalSection lock_;
+  bool running_;
+  std::vector<RegisteredModule> modules_ RTC_GUARDED_BY(lock_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_UTILITY_SOURCE_SHARED_PROCESS_THREAD_H_
@@ -0,0 +1,155 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/utility/source/shared_process_thread.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "api/task_queue/queued_task.h"
+#include "modules/include/module.h"
+#include "rtc_base/event.h"
+#include "rtc_base/location.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::Return;
+
+// The length of time, in milliseconds, to wait for an event to become signaled.
+static const int kEventWaitTimeout = 500;
+
+class MockModule : public Module {
+ public:
+  MOCK_METHOD0(TimeUntilNextProcess, int64_t());
+  MOCK_METHOD0(Process, void());
+  MOCK_METHOD1(ProcessThreadAttached, void(ProcessThread*));
+};
+
+class RaiseEventTask : public QueuedTask {
+ public:
+  explicit RaiseEventTask(rtc::Event* event) : event_(event) {}
+  bool Run() override {
+    event_->Set();
+    return true;
+  }
+
+ private:
+  rtc::Event* event_;
+};
+
+ACTION_P(SetEvent, event) {
+  event->Set();
+}
+
+TEST(SharedProcessThread, StartStop) {
+  SharedProcessThread thread("SharedProcess");
+  thread.Start();
+  thread.Stop();
+}
+
+TEST(SharedProcessThread, ProcessCall) {
+  SharedProcessThread thread("SharedProcess");
+  thread.Start();
+
+  rtc::Event event;
+
+  MockModule module;
+  EXPECT_CALL(module, TimeUntilNextProcess())
+      .WillOnce(Return(0))
+      .WillRepeatedly(Return(1000));
+  EXPECT_CALL(module, Process())
+      .WillOnce(DoAll(SetEvent(&event), Return()))
+      .WillRepeatedly(Return());
+  EXPECT_CALL(module, ProcessThreadAttached(&thread)).Times(1);
+
+  thread.RegisterModule(&module, RTC_FROM_HERE);
+  EXPECT_TRUE(event.Wait(kEventWaitTimeout));
+
+  EXPECT_CALL(module, ProcessThreadAttached(nullptr)).Times(1);
+  thread.Stop();
+}
+
+TEST(SharedProcessThread, WakeUp) {
+  SharedProcessThread thread("SharedProcess");
+  thread.Start();
+
+  rtc::Event started;
+  rtc::Event called;
+
+  MockModule module;
+  // A long time until next process after the first call, so the second
+  // Process() can only come from the WakeUp call.
+  EXPECT_CALL(module, TimeUntilNextProcess())
+      .WillOnce(Return(0))
+      .WillRepeatedly(Return(60000));
+  EXPECT_CALL(module, Process())
+      .WillOnce(DoAll(SetEvent(&started), Return()))
+      .WillOnce(DoAll(SetEvent(&called), Return()))
+      .WillRepeatedly(Return());
+  EXPECT_CALL(module, ProcessThreadAttached(&thread)).Times(1);
+
+  thread.RegisterModule(&module, RTC_FROM_HERE);
+  EXPECT_TRUE(started.Wait(kEventWaitTimeout));
+
+  thread.WakeUp(&module);
+  EXPECT_TRUE(called.Wait(kEventWaitTimeout));
+
+  EXPECT_CALL(module, ProcessThreadAttached(nullptr)).Times(1);
+  thread.Stop();
+}
+
+TEST(SharedProcessThread, PostTask) {
+  SharedProcessThread thread("SharedProcess");
+  rtc::Event event;
+  auto task = absl::make_unique<RaiseEventTask>(&event);
+  thread.Start();
+  thread.PostTask(std::move(task));
+  EXPECT_TRUE(event.Wait(kEventWaitTimeout));
+  thread.Stop();
+}
+
+// Modules registered through different handles all get serviced even
+// though the handles share the process-wide worker pool.
+TEST(SharedProcessThread, ModulesAcrossHandles) {
+  constexpr int kNumHandles = 4;
+  std::vector<std::unique_ptr<ProcessThread>> threads;
+  std::vector<std::unique_ptr<rtc::Event>> events;
+  std::vector<std::unique_ptr<MockModule>> modules;
+
+  for (int i = 0; i < kNumHandles; ++i) {
+    threads.push_back(ProcessThread::CreateShared("SharedProcess"));
+    threads.back()->Start();
+    events.push_back(absl::make_unique<rtc::Event>());
+    modules.push_back(absl::make_unique<MockModule>());
+    EXPECT_CALL(*modules.back(), TimeUntilNextProcess())
+        .WillOnce(Return(0))
+        .WillRepeatedly(Return(1000));
+    EXPECT_CALL(*modules.back(), Process())
+        .WillOnce(DoAll(SetEvent(events.back().get()), Return()))
+        .WillRepeatedly(Return());
+    EXPECT_CALL(*modules.back(), ProcessThreadAttached(_)).Times(2);
+    threads.back()->RegisterModule(modules.back().get(), RTC_FROM_HERE);
+  }
+
+  for (int i = 0; i < kNumHandles; ++i)
+    EXPECT_TRUE(events[i]->Wait(kEventWaitTimeout));
+
+  for (int i = 0; i < kNumHandles; ++i)
+    threads[i]->Stop();
+}
+
+}  // namespace webrtc
@@ -100,7 +100,8 @@ VideoFrameType ConvertToVideoFrameType(EVideoFrameType type) {
 static void RtpFragmentize(EncodedImage* encoded_image,
                            const VideoFrameBuffer& frame_buffer,
                            SFrameBSInfo* info,
-                           RTPFragmentationHeader* frag_header) {
+                           RTPFragmentationHeader* frag_header,
+                           EncodedImageBufferPool* buffer_pool) {
   // Calculate minimum buffer size required to hold encoded data.
   size_t required_capacity = 0;
   size_t fragments_count = 0;
@@ -114,8 +115,13 @@ static void RtpFragmentize(EncodedImage* encoded_image,
       required_capacity += layerInfo.pNalLengthInByte[nal];
     }
   }
-  // TODO(nisse): Use a cache or buffer pool to avoid allocation?
-  encoded_image->SetEncodedData(EncodedImageBuffer::Create(required_capacity));
+  // Borrow the output buffer from the pool; a buffer the send pipeline still
+  // references is left alone and another one is recycled or created.
+  rtc::scoped_refptr<EncodedImageBuffer> output_buffer =
+      buffer_pool->CreateBuffer(required_capacity);
+  if (!output_buffer)
+    output_buffer = EncodedImageBuffer::Create(required_capacity);
+  encoded_image->SetEncodedData(std::move(output_buffer));
 
   // Iterate layers and NAL units, note each NAL unit as a fragment and copy
   // the data to |encoded_image->_buffer|.
@@ -279,12 +285,9 @@ int32_t H264EncoderImpl::InitEncode(const VideoCodec* inst,
     int video_format = EVideoFormatType::videoFormatI420;
     openh264_encoder->SetOption(ENCODER_OPTION_DATAFORMAT, &video_format);
 
-    // Initialize encoded image. Default buffer size: size of unencoded data.
-
-    const size_t new_capacity =
-        CalcBufferSize(VideoType::kI420, codec_.simulcastStream[idx].width,
-                       codec_.simulcastStream[idx].height);
-    encoded_images_[i].SetEncodedData(EncodedImageBuffer::Create(new_capacity));
+    // Initialize encoded image. The output buffers are borrowed from
+    // |encoded_image_buffer_pool_| per frame in RtpFragmentize, so no
+    // up-front allocation is needed.
     encoded_images_[i]._completeFrame = true;
     encoded_images_[i]._encodedWidth = codec_.simulcastStream[idx].width;
     encoded_images_[i]._encodedHeight = codec_.simulcastStream[idx].height;
@@ -313,6 +316,7 @@ int32_t H264EncoderImpl::Release() {
   downscaled_buffers_.clear();
   configurations_.clear();
   encoded_images_.clear();
+  encoded_image_buffer_pool_.Release();
   pictures_.clear();
   tl0sync_limit_.clear();
   return WEBRTC_VIDEO_CODEC_OK;
@@ -487,7 +491,8 @@ int32_t H264EncoderImpl::Encode(
     // Split encoded image up into fragments. This also updates
     // |encoded_image_|.
     RTPFragmentationHeader frag_header;
-    RtpFragmentize(&encoded_images_[i], *frame_buffer, &info, &frag_header);
+    RtpFragmentize(&encoded_images_[i], *frame_buffer, &info, &frag_header,
+                   &encoded_image_buffer_pool_);
 
     // Encoder can skip frames to save bandwidth in which case
     // |encoded_images_[i]._length| == 0.
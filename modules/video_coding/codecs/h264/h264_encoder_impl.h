@@ -27,6 +27,7 @@
 #include "api/video/i420_buffer.h"
 #include "api/video_codecs/video_encoder.h"
 #include "common_video/h264/h264_bitstream_parser.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/video_coding/codecs/h264/include/h264.h"
 #include "modules/video_coding/utility/quality_scaler.h"
 #include "third_party/openh264/src/codec/api/svc/codec_app_def.h"
@@ -97,6 +98,9 @@ class H264EncoderImpl : public H264Encoder {
   std::vector<rtc::scoped_refptr<I420Buffer>> downscaled_buffers_;
   std::vector<LayerConfig> configurations_;
   std::vector<EncodedImage> encoded_images_;
+  // Recycles the bitstream buffers handed to |encoded_image_callback_|, so
+  // the encode hot path does not allocate a fresh buffer per frame.
+  EncodedImageBufferPool encoded_image_buffer_pool_;
 
   VideoCodec codec_;
   H264PacketizationMode packetization_mode_;
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "api/test/create_videocodec_test_fixture.h"
+#include "api/test/videocodec_test_fixture.h"
+#include "api/test/videocodec_test_stats.h"
+#include "rtc_base/checks.h"
+
+// Define command line flags.
+ABSL_FLAG(std::string, codec, "VP8", "Codec to benchmark: VP8, VP9 or H264.");
+ABSL_FLAG(std::string, filepath, "", "Path to an I420 YUV file to encode.");
+ABSL_FLAG(int, width, 1280, "Width of the input file.");
+ABSL_FLAG(int, height, 720, "Height of the input file.");
+ABSL_FLAG(int, framerate_fps, 30, "Input framerate.");
+ABSL_FLAG(int, bitrate_kbps, 1000, "Target bitrate.");
+ABSL_FLAG(int, num_frames, 300, "Number of frames to process.");
+ABSL_FLAG(bool, use_single_core, false, "Force codecs to use a single core.");
+ABSL_FLAG(bool, decode, false, "Also decode and measure decode speed.");
+ABSL_FLAG(std::string,
+          output_json,
+          "",
+          "File to write the JSON result to. Writes to stdout if empty.");
+
+namespace webrtc {
+namespace test {
+namespace {
+
+// Returns the |fraction| percentile of |sorted_values|.
+size_t Percentile(const std::vector<size_t>& sorted_values, double fraction) {
+  RTC_DCHECK(!sorted_values.empty());
+  const size_t index = static_cast<size_t>(fraction *
+                                           (sorted_values.size() - 1) + 0.5);
+  return sorted_values[index];
+}
+
+int RunSpeedBench() {
+  VideoCodecTestFixture::Config config;
+  config.filepath = absl::GetFlag(FLAGS_filepath);
+  config.num_frames = absl::GetFlag(FLAGS_num_frames);
+  config.use_single_core = absl::GetFlag(FLAGS_use_single_core);
+  config.decode = absl::GetFlag(FLAGS_decode);
+  config.SetCodecSettings(absl::GetFlag(FLAGS_codec),
+                          /*num_simulcast_streams=*/1,
+                          /*num_spatial_layers=*/1,
+                          /*num_temporal_layers=*/1,
+                          /*denoising_on=*/false,
+                          /*frame_dropper_on=*/true,
+                          /*spatial_resize_on=*/false,
+                          absl::GetFlag(FLAGS_width),
+                          absl::GetFlag(FLAGS_height));
+
+  auto fixture = CreateVideoCodecTestFixture(config);
+
+  std::vector<RateProfile> rate_profiles = {
+      {static_cast<size_t>(absl::GetFlag(FLAGS_bitrate_kbps)),
+       static_cast<double>(absl::GetFlag(FLAGS_framerate_fps)), 0}};
+  fixture->RunTest(rate_profiles, /*rc_thresholds=*/nullptr,
+                   /*quality_thresholds=*/nullptr, /*bs_thresholds=*/nullptr);
+
+  std::vector<VideoCodecTestStats::FrameStatistics> frame_stats =
+      fixture->GetStats().GetFrameStatistics();
+
+  std::vector<size_t> encode_times_us;
+  std::vector<size_t> decode_times_us;
+  size_t total_encoded_bytes = 0;
+  for (const auto& stat : frame_stats) {
+    if (stat.encoding_successful) {
+      encode_times_us.push_back(stat.encode_time_us);
+      total_encoded_bytes += stat.length_bytes;
+    }
+    if (stat.decoding_successful)
+      decode_times_us.push_back(stat.decode_time_us);
+  }
+
+  if (encode_times_us.empty()) {
+    fprintf(stderr, "No frames were successfully encoded.\n");
+    return -1;
+  }
+
+  std::sort(encode_times_us.begin(), encode_times_us.end());
+  std::sort(decode_times_us.begin(), decode_times_us.end());
+
+  size_t total_encode_time_us = 0;
+  for (size_t time_us : encode_times_us)
+    total_encode_time_us += time_us;
+  size_t total_decode_time_us = 0;
+  for (size_t time_us : decode_times_us)
+    total_decode_time_us += time_us;
+
+  const double encode_fps =
+      1000000.0 * encode_times_us.size() / total_encode_time_us;
+  const double decode_fps =
+      decode_times_us.empty()
+          ? 0.0
+          : 1000000.0 * decode_times_us.size() / total_decode_time_us;
+
+  FILE* out = stdout;
+  const std::string output_json = absl::GetFlag(FLAGS_output_json);
+  if (!output_json.empty()) {
+    out = fopen(output_json.c_str(), "w");
+    if (!out) {
+      fprintf(stderr, "Failed to open %s for writing.\n", output_json.c_str());
+      return -1;
+    }
+  }
+
+  fprintf(out, "{\n");
+  fprintf(out, "  \"codec\": \"%s\",\n", absl::GetFlag(FLAGS_codec).c_str());
+  fprintf(out, "  \"width\": %d,\n", absl::GetFlag(FLAGS_width));
+  fprintf(out, "  \"height\": %d,\n", absl::GetFlag(FLAGS_height));
+  fprintf(out, "  \"num_cores\": %zu,\n", config.NumberOfCores());
+  fprintf(out, "  \"num_frames\": %zu,\n", encode_times_us.size());
+  fprintf(out, "  \"target_bitrate_kbps\": %d,\n",
+          absl::GetFlag(FLAGS_bitrate_kbps));
+  fprintf(out, "  \"encode_fps\": %.2f,\n", encode_fps);
+  fprintf(out, "  \"encode_time_us\": {\n");
+  fprintf(out, "    \"avg\": %zu,\n",
+          total_encode_time_us / encode_times_us.size());
+  fprintf(out, "    \"p50\": %zu,\n", Percentile(encode_times_us, 0.50));
+  fprintf(out, "    \"p95\": %zu,\n", Percentile(encode_times_us, 0.95));
+  fprintf(out, "    \"p99\": %zu\n", Percentile(encode_times_us, 0.99));
+  fprintf(out, "  },\n");
+  fprintf(out, "  \"avg_encoded_bytes_per_frame\": %zu,\n",
+          total_encoded_bytes / encode_times_us.size());
+  fprintf(out, "  \"decode_fps\": %.2f\n", decode_fps);
+  fprintf(out, "}\n");
+
+  if (out != stdout)
+    fclose(out);
+  return 0;
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
+
+int main(int argc, char* argv[]) {
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  std::string program_name = args[0];
+  std::string usage =
+      "Tool for measuring video codec speed.\n"
+      "Usage: " +
+      program_name +
+      " [options]\n\n"
+      "  --codec=NAME           codec to benchmark; default is VP8\n"
+      "  --filepath=PATH        path to an I420 YUV input file\n"
+      "  --width=N              width of the input file; default is 1280\n"
+      "  --height=N             height of the input file; default is 720\n"
+      "  --framerate_fps=N      input framerate; default is 30\n"
+      "  --bitrate_kbps=N       target bitrate; default is 1000\n"
+      "  --num_frames=N         number of frames to process; default is 300\n"
+      "  --use_single_core      force codecs to use a single core\n"
+      "  --decode               also decode and measure decode speed\n"
+      "  --output_json=PATH     file to write the JSON result to\n";
+  if (args.size() != 1 || absl::GetFlag(FLAGS_filepath).empty()) {
+    printf("%s", usage.c_str());
+    return 1;
+  }
+  RTC_CHECK_GT(absl::GetFlag(FLAGS_width), 0);
+  RTC_CHECK_GT(absl::GetFlag(FLAGS_height), 0);
+  RTC_CHECK_GT(absl::GetFlag(FLAGS_framerate_fps), 0);
+  RTC_CHECK_GT(absl::GetFlag(FLAGS_bitrate_kbps), 0);
+  RTC_CHECK_GT(absl::GetFlag(FLAGS_num_frames), 0);
+
+  return webrtc::test::RunSpeedBench();
+}
@@ -293,6 +293,7 @@ LibvpxVp8Encoder::LibvpxVp8Encoder(
       frame_buffer_controller_factory_(
           std::move(frame_buffer_controller_factory)),
       key_frame_request_(kMaxSimulcastStreams, false),
+      active_map_is_partial_(false),
       variable_framerate_experiment_(ParseVariableFramerateConfig(
           "WebRTC-VP8VariableFramerateScreenshare")),
       framerate_controller_(variable_framerate_experiment_.framerate_limit),
@@ -318,6 +319,7 @@ int LibvpxVp8Encoder::Release() {
   int ret_val = WEBRTC_VIDEO_CODEC_OK;
 
   encoded_images_.clear();
+  encoded_image_buffer_pool_.Release();
 
   if (inited_) {
     for (auto it = encoders_.rbegin(); it != encoders_.rend(); ++it) {
@@ -538,11 +540,8 @@ int LibvpxVp8Encoder::InitEncode(const VideoCodec* inst,
     downsampling_factors_[number_of_streams - 1].den = 1;
   }
   for (int i = 0; i < number_of_streams; ++i) {
-    // allocate memory for encoded image
-    size_t frame_capacity =
-        CalcBufferSize(VideoType::kI420, codec_.width, codec_.height);
-    encoded_images_[i].SetEncodedData(
-        EncodedImageBuffer::Create(frame_capacity));
+    // The output buffers are borrowed from |encoded_image_buffer_pool_| per
+    // frame in GetEncodedPartitions, so no up-front allocation is needed.
     encoded_images_[i]._completeFrame = true;
   }
   // populate encoder configuration with default values
@@ -841,10 +840,60 @@ int LibvpxVp8Encoder::InitAndSetControlSettings() {
         &(encoders_[i]), VP8E_SET_SCREEN_CONTENT_MODE,
         codec_.mode == VideoCodecMode::kScreensharing ? 2u : 0u);
   }
+  active_map_.clear();
+  active_map_is_partial_ = false;
   inited_ = true;
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
+void LibvpxVp8Encoder::MaybeSetActiveMap(const VideoFrame& frame,
+                                         bool is_key_frame) {
+  // Only used for screensharing, where the capturer reports accurate update
+  // rects; camera content updates the whole frame every time. Simulcast
+  // would need the rect rescaled per stream, and the win there is small, so
+  // it is not supported.
+  if (codec_.mode != VideoCodecMode::kScreensharing || encoders_.size() != 1)
+    return;
+
+  const unsigned int mb_cols = (codec_.width + 15) / 16;
+  const unsigned int mb_rows = (codec_.height + 15) / 16;
+  active_map_.resize(mb_cols * mb_rows);
+
+  VideoFrame::UpdateRect rect = frame.update_rect();
+  const bool full_frame_update =
+      rect.offset_x == 0 && rect.offset_y == 0 && rect.width >= codec_.width &&
+      rect.height >= codec_.height;
+  if (is_key_frame || full_frame_update) {
+    // Every block must be coded; only issue the control call if a partial
+    // map is currently installed.
+    if (!active_map_is_partial_)
+      return;
+    std::fill(active_map_.begin(), active_map_.end(), 1);
+    active_map_is_partial_ = false;
+  } else {
+    // Expand the rect by one macroblock on each side so that the loop filter
+    // and sub-pel motion on the dirty-region boundary have valid data.
+    const int mb_start_col = std::max(rect.offset_x / 16 - 1, 0);
+    const int mb_end_col = std::min((rect.offset_x + rect.width + 15) / 16 + 1,
+                                    static_cast<int>(mb_cols));
+    const int mb_start_row = std::max(rect.offset_y / 16 - 1, 0);
+    const int mb_end_row = std::min((rect.offset_y + rect.height + 15) / 16 + 1,
+                                    static_cast<int>(mb_rows));
+    std::fill(active_map_.begin(), active_map_.end(), 0);
+    for (int mb_row = mb_start_row; mb_row < mb_end_row; ++mb_row) {
+      std::fill(active_map_.begin() + mb_row * mb_cols + mb_start_col,
+                active_map_.begin() + mb_row * mb_cols + mb_end_col, 1);
+    }
+    active_map_is_partial_ = true;
+  }
+
+  vpx_active_map_t map;
+  map.active_map = active_map_.data();
+  map.cols = mb_cols;
+  map.rows = mb_rows;
+  libvpx_->codec_control(&encoders_[0], VP8E_SET_ACTIVEMAP, &map);
+}
+
 uint32_t LibvpxVp8Encoder::MaxIntraTarget(uint32_t optimalBuffersize) {
   // Set max to the optimal buffer level (normalized by target BR),
   // and scaled by a scalePar.
@@ -1070,6 +1119,8 @@ int LibvpxVp8Encoder::Encode(const VideoFrame& frame,
     libvpx_->codec_control(&encoders_[i], VP8E_SET_TEMPORAL_LAYER_ID,
                            tl_configs[i].encoder_layer_id);
   }
+
+  MaybeSetActiveMap(frame, send_key_frame);
   // TODO(holmer): Ideally the duration should be the timestamp diff of this
   // frame and the next frame to be encoded, which we don't have. Instead we
   // would like to use the duration of the previous frame. Unfortunately the
@@ -1143,7 +1194,21 @@ int LibvpxVp8Encoder::GetEncodedPartitions(const VideoFrame& input_image,
         case VPX_CODEC_CX_FRAME_PKT: {
           const size_t size = encoded_images_[encoder_idx].size();
           const size_t new_size = pkt->data.frame.sz + size;
-          encoded_images_[encoder_idx].Allocate(new_size);
+          if (size == 0) {
+            // First partition of this frame. Borrow an output buffer from the
+            // pool instead of reallocating the one from the previous frame,
+            // which the send pipeline may still be referencing.
+            rtc::scoped_refptr<EncodedImageBuffer> buffer =
+                encoded_image_buffer_pool_.CreateBuffer(new_size);
+            if (!buffer)
+              buffer = EncodedImageBuffer::Create(new_size);
+            encoded_images_[encoder_idx].SetEncodedData(std::move(buffer));
+            encoded_images_[encoder_idx].set_size(0);
+          } else if (encoded_images_[encoder_idx].capacity() < new_size) {
+            // The pool buffer has the only reference here, so this grows it
+            // in place.
+            encoded_images_[encoder_idx].Allocate(new_size);
+          }
           memcpy(&encoded_images_[encoder_idx].data()[size],
                  pkt->data.frame.buf, pkt->data.frame.sz);
           encoded_images_[encoder_idx].set_size(new_size);
@@ -21,6 +21,7 @@
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/vp8_frame_buffer_controller.h"
 #include "api/video_codecs/vp8_frame_config.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
 #include "modules/video_coding/codecs/vp8/libvpx_interface.h"
 #include "modules/video_coding/include/video_codec_interface.h"
@@ -98,6 +99,12 @@ class LibvpxVp8Encoder : public VideoEncoder {
 
   bool UpdateVpxConfiguration(size_t stream_index);
 
+  // Translates the frame's update rect into a macroblock active map so the
+  // encoder can skip blocks outside the dirty region. Only used for
+  // screensharing without simulcast; a key frame or full-frame update resets
+  // the map to all-active.
+  void MaybeSetActiveMap(const VideoFrame& frame, bool is_key_frame);
+
   const std::unique_ptr<LibvpxInterface> libvpx_;
 
   const absl::optional<std::vector<CpuSpeedExperiment::Config>>
@@ -121,11 +128,19 @@ class LibvpxVp8Encoder : public VideoEncoder {
   std::vector<int> cpu_speed_;
   std::vector<vpx_image_t> raw_images_;
   std::vector<EncodedImage> encoded_images_;
+  // Recycles the bitstream buffers handed to |encoded_complete_callback_|,
+  // so the encode hot path does not allocate a fresh buffer per frame.
+  EncodedImageBufferPool encoded_image_buffer_pool_;
   std::vector<vpx_codec_ctx_t> encoders_;
   std::vector<vpx_codec_enc_cfg_t> vpx_configs_;
   std::vector<Vp8EncoderConfig> config_overrides_;
   std::vector<vpx_rational_t> downsampling_factors_;
 
+  // Macroblock active map built from VideoFrame::update_rect(), see
+  // MaybeSetActiveMap().
+  std::vector<uint8_t> active_map_;
+  bool active_map_is_partial_;
+
   // Variable frame-rate screencast related fields and methods.
   const struct VariableFramerateExperiment {
     bool enabled = false;
@@ -13,6 +13,8 @@
 
 #include "modules/video_coding/codecs/vp9/vp9_impl.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <limits>
 #include <utility>
@@ -249,7 +251,8 @@ VP9EncoderImpl::VP9EncoderImpl(const cricket::VideoCodec& codec)
           "WebRTC-VP9VariableFramerateScreenshare")),
       variable_framerate_controller_(
           variable_framerate_experiment_.framerate_limit),
-      num_steady_state_frames_(0) {
+      num_steady_state_frames_(0),
+      active_map_is_partial_(false) {
   codec_ = {};
   memset(&svc_params_, 0, sizeof(vpx_svc_extra_cfg_t));
 }
@@ -267,6 +270,7 @@ int VP9EncoderImpl::Release() {
   int ret_val = WEBRTC_VIDEO_CODEC_OK;
 
   encoded_image_.Allocate(0);
+  encoded_image_buffer_pool_.Release();
   if (encoder_ != nullptr) {
     if (inited_) {
       if (vpx_codec_destroy(encoder_)) {
@@ -561,9 +565,14 @@ int VP9EncoderImpl::InitEncode(const VideoCodec* inst,
   config_->kf_max_dist = inst->VP9().keyFrameInterval;
   config_->kf_min_dist = config_->kf_max_dist;
   config_->rc_resize_allowed = inst->VP9().automaticResizeOn ? 1 : 0;
+  threading_settings_ = settings.threading;
   // Determine number of threads based on the image size and #cores.
   config_->g_threads =
       NumberOfThreads(config_->g_w, config_->g_h, settings.number_of_cores);
+  if (threading_settings_.max_threads) {
+    config_->g_threads = std::min<int>(
+        config_->g_threads, std::max(*threading_settings_.max_threads, 1));
+  }
 
   cpu_speed_ = GetCpuSpeed(config_->g_w, config_->g_h);
 
@@ -636,7 +645,9 @@ int VP9EncoderImpl::NumberOfThreads(int width,
                                     int number_of_cores) {
   // Keep the number of encoder threads equal to the possible number of column
   // tiles, which is (1, 2, 4, 8). See comments below for VP9E_SET_TILE_COLUMNS.
-  if (width * height >= 1280 * 720 && number_of_cores > 4) {
+  if (width * height >= 2560 * 1440 && number_of_cores > 8) {
+    return 8;
+  } else if (width * height >= 1280 * 720 && number_of_cores > 4) {
     return 4;
   } else if (width * height >= 640 * 360 && number_of_cores > 2) {
     return 2;
@@ -795,10 +806,14 @@ int VP9EncoderImpl::InitAndSetControlSettings(const VideoCodec* inst) {
   // log2 unit: e.g., 0 = 1 tile column, 1 = 2 tile columns, 2 = 4 tile columns.
   // The number tile columns will be capped by the encoder based on image size
   // (minimum width of tile column is 256 pixels, maximum is 4096).
-  vpx_codec_control(encoder_, VP9E_SET_TILE_COLUMNS, (config_->g_threads >> 1));
+  vpx_codec_control(
+      encoder_, VP9E_SET_TILE_COLUMNS,
+      threading_settings_.tile_columns_log2.value_or(config_->g_threads >> 1));
 
-  // Turn on row-based multithreading.
-  vpx_codec_control(encoder_, VP9E_SET_ROW_MT, 1);
+  // Row-based multithreading is on by default.
+  vpx_codec_control(encoder_, VP9E_SET_ROW_MT,
+                    threading_settings_.row_multithreading.value_or(true) ? 1
+                                                                          : 0);
 
 #if !defined(WEBRTC_ARCH_ARM) && !defined(WEBRTC_ARCH_ARM64) && \
     !defined(ANDROID)
@@ -814,10 +829,59 @@ int VP9EncoderImpl::InitAndSetControlSettings(const VideoCodec* inst) {
   }
   // Enable encoder skip of static/low content blocks.
   vpx_codec_control(encoder_, VP8E_SET_STATIC_THRESHOLD, 1);
+  active_map_.clear();
+  active_map_is_partial_ = false;
   inited_ = true;
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
+void VP9EncoderImpl::MaybeSetActiveMap(const VideoFrame& frame) {
+  // Only used for screensharing, where the capturer reports accurate update
+  // rects; camera content updates the whole frame every time. Spatial layers
+  // would need the rect rescaled per layer, and the win there is small, so
+  // they are not supported.
+  if (codec_.mode != VideoCodecMode::kScreensharing || num_spatial_layers_ > 1)
+    return;
+
+  const unsigned int mb_cols = (codec_.width + 15) / 16;
+  const unsigned int mb_rows = (codec_.height + 15) / 16;
+  active_map_.resize(mb_cols * mb_rows);
+
+  VideoFrame::UpdateRect rect = frame.update_rect();
+  const bool full_frame_update =
+      rect.offset_x == 0 && rect.offset_y == 0 && rect.width >= codec_.width &&
+      rect.height >= codec_.height;
+  if (force_key_frame_ || full_frame_update) {
+    // Every block must be coded; only issue the control call if a partial
+    // map is currently installed.
+    if (!active_map_is_partial_)
+      return;
+    std::fill(active_map_.begin(), active_map_.end(), 1);
+    active_map_is_partial_ = false;
+  } else {
+    // Expand the rect by one macroblock on each side so that the loop filter
+    // and sub-pel motion on the dirty-region boundary have valid data.
+    const int mb_start_col = std::max(rect.offset_x / 16 - 1, 0);
+    const int mb_end_col = std::min((rect.offset_x + rect.width + 15) / 16 + 1,
+                                    static_cast<int>(mb_cols));
+    const int mb_start_row = std::max(rect.offset_y / 16 - 1, 0);
+    const int mb_end_row = std::min((rect.offset_y + rect.height + 15) / 16 + 1,
+                                    static_cast<int>(mb_rows));
+    std::fill(active_map_.begin(), active_map_.end(), 0);
+    for (int mb_row = mb_start_row; mb_row < mb_end_row; ++mb_row) {
+      std::fill(active_map_.begin() + mb_row * mb_cols + mb_start_col,
+                active_map_.begin() + mb_row * mb_cols + mb_end_col, 1);
+    }
+    active_map_is_partial_ = true;
+  }
+
+  vpx_active_map_t map;
+  map.active_map = active_map_.data();
+  map.cols = mb_cols;
+  map.rows = mb_rows;
+  vpx_codec_control(encoder_, VP8E_SET_ACTIVEMAP, &map);
+}
+
 uint32_t VP9EncoderImpl::MaxIntraTarget(uint32_t optimal_buffer_size) {
   // Set max to the optimal buffer level (normalized by target BR),
   // and scaled by a scale_par.
@@ -938,6 +1002,8 @@ int VP9EncoderImpl::Encode(const VideoFrame& input_image,
     return WEBRTC_VIDEO_CODEC_ERROR;
   }
 
+  MaybeSetActiveMap(input_image);
+
   RTC_DCHECK_EQ(input_image.width(), raw_->d_w);
   RTC_DCHECK_EQ(input_image.height(), raw_->d_h);
 
@@ -1435,10 +1501,15 @@ int VP9EncoderImpl::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
     DeliverBufferedFrame(end_of_picture);
   }
 
-  // TODO(nisse): Introduce some buffer cache or buffer pool, to reduce
-  // allocations and/or copy operations.
-  encoded_image_.SetEncodedData(EncodedImageBuffer::Create(
-      static_cast<const uint8_t*>(pkt->data.frame.buf), pkt->data.frame.sz));
+  // Borrow the output buffer from the pool; a buffer the send pipeline still
+  // references is left alone and another one is recycled or created.
+  rtc::scoped_refptr<EncodedImageBuffer> output_buffer =
+      encoded_image_buffer_pool_.CreateBuffer(pkt->data.frame.sz);
+  if (!output_buffer)
+    output_buffer = EncodedImageBuffer::Create(pkt->data.frame.sz);
+  memcpy(output_buffer->data(), pkt->data.frame.buf, pkt->data.frame.sz);
+  encoded_image_.SetEncodedData(std::move(output_buffer));
+  encoded_image_.set_size(pkt->data.frame.sz);
 
   const bool is_key_frame =
       (pkt->data.frame.flags & VPX_FRAME_IS_KEY) ? true : false;
@@ -21,6 +21,7 @@
 
 #include "api/fec_controller_override.h"
 #include "api/video_codecs/video_encoder.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "media/base/vp9_profile.h"
 #include "modules/video_coding/codecs/vp9/include/vp9.h"
 #include "modules/video_coding/codecs/vp9/vp9_frame_buffer_pool.h"
@@ -98,10 +99,20 @@ class VP9EncoderImpl : public VP9Encoder {
 
   size_t SteadyStateSize(int sid, int tid);
 
+  // Translates the frame's update rect into a macroblock active map so the
+  // encoder can skip blocks outside the dirty region. Only used for
+  // screensharing without spatial layers; a key frame or full-frame update
+  // resets the map to all-active.
+  void MaybeSetActiveMap(const VideoFrame& frame);
+
   EncodedImage encoded_image_;
+  // Recycles the bitstream buffers handed to |encoded_complete_callback_|,
+  // so the encode hot path does not allocate a fresh buffer per frame.
+  EncodedImageBufferPool encoded_image_buffer_pool_;
   CodecSpecificInfo codec_specific_;
   EncodedImageCallback* encoded_complete_callback_;
   VideoCodec codec_;
+  ThreadingSettings threading_settings_;
   const VP9Profile profile_;
   bool inited_;
   int64_t timestamp_;
@@ -176,6 +187,11 @@ class VP9EncoderImpl : public VP9Encoder {
       std::string group_name);
   FramerateController variable_framerate_controller_;
   int num_steady_state_frames_;
+
+  // Macroblock active map built from VideoFrame::update_rect(), see
+  // MaybeSetActiveMap().
+  std::vector<uint8_t> active_map_;
+  bool active_map_is_partial_;
 };
 
 class VP9DecoderImpl : public VP9Decoder {
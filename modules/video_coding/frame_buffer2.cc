@@ -27,6 +27,7 @@
 #include "rtc_base/experiments/rtt_mult_experiment.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/sequence_number_util.h"
+#include "rtc_base/perf_sample.h"
 #include "rtc_base/trace_event.h"
 #include "system_wrappers/include/clock.h"
 #include "system_wrappers/include/field_trial.h"
@@ -121,6 +122,7 @@ FrameBuffer::ReturnReason FrameBuffer::NextFrame(
     std::unique_ptr<EncodedFrame>* frame_out,
     bool keyframe_required) {
   TRACE_EVENT0("webrtc", "FrameBuffer::NextFrame");
+  RTC_SCOPED_PERF_SAMPLE("FrameBuffer::NextFrame");
   int64_t latest_return_time_ms =
       clock_->TimeInMilliseconds() + max_wait_time_ms;
   int64_t wait_ms = max_wait_time_ms;
@@ -164,15 +166,11 @@ int64_t FrameBuffer::FindNextFrame(int64_t now_ms) {
   int64_t wait_ms = latest_return_time_ms_ - now_ms;
   frames_to_decode_.clear();
 
-  // |last_continuous_frame_| may be empty below, but nullopt is smaller
-  // than everything else and loop will immediately terminate as expected.
-  for (auto frame_it = frames_.begin();
-       frame_it != frames_.end() && frame_it->first <= last_continuous_frame_;
-       ++frame_it) {
-    if (!frame_it->second.continuous ||
-        frame_it->second.num_missing_decodable > 0) {
-      continue;
-    }
+  // Every frame in |decodable_frames_| is continuous and has no missing
+  // decodable references, so only actual decode candidates are visited here.
+  for (const VideoLayerFrameId& candidate : decodable_frames_) {
+    FrameMap::iterator frame_it = frames_.find(candidate);
+    RTC_DCHECK(frame_it != frames_.end());
 
     EncodedFrame* frame = frame_it->second.frame.get();
 
@@ -297,6 +295,8 @@ EncodedFrame* FrameBuffer::GetNextFrame() {
       }
     }
 
+    decodable_frames_.erase(decodable_frames_.begin(),
+                            decodable_frames_.upper_bound(frame_it->first));
     frames_.erase(frames_.begin(), ++frame_it);
 
     frames_out.push_back(frame);
@@ -595,6 +595,10 @@ void FrameBuffer::PropagateContinuity(FrameMap::iterator start) {
       last_continuous_frame_ = frame->first;
     }
 
+    if (frame->second.num_missing_decodable == 0) {
+      decodable_frames_.insert(frame->first);
+    }
+
     // Loop through all dependent frames, and if that frame no longer has
     // any unfulfilled dependencies then that frame is continuous as well.
     for (size_t d = 0; d < frame->second.dependent_frames.size(); ++d) {
@@ -622,6 +626,10 @@ void FrameBuffer::PropagateDecodability(const FrameInfo& info) {
     if (ref_info != frames_.end()) {
       RTC_DCHECK_GT(ref_info->second.num_missing_decodable, 0U);
       --ref_info->second.num_missing_decodable;
+      if (ref_info->second.num_missing_decodable == 0 &&
+          ref_info->second.continuous) {
+        decodable_frames_.insert(ref_info->first);
+      }
     }
   }
 }
@@ -745,6 +753,7 @@ void FrameBuffer::ClearFramesAndHistory() {
     }
   }
   frames_.clear();
+  decodable_frames_.clear();
   last_continuous_frame_.reset();
   frames_to_decode_.clear();
   decoded_frames_history_.Clear();
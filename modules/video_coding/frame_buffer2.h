@@ -14,6 +14,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -169,6 +170,11 @@ class FrameBuffer {
 
   // Stores only undecoded frames.
   FrameMap frames_ RTC_GUARDED_BY(crit_);
+  // Ordered index over the frames in |frames_| that are continuous and have
+  // no missing decodable references. Updated incrementally as frames are
+  // inserted, decoded and erased so that FindNextFrame only has to consider
+  // actual decode candidates instead of rescanning all buffered frames.
+  std::set<VideoLayerFrameId> decodable_frames_ RTC_GUARDED_BY(crit_);
   DecodedFramesHistory decoded_frames_history_ RTC_GUARDED_BY(crit_);
 
   rtc::CriticalSection crit_;
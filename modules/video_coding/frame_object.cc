@@ -59,7 +59,7 @@ RtpFrameObject::RtpFrameObject(PacketBuffer* packet_buffer,
   SetPlayoutDelay(first_packet->video_header.playout_delay);
 
   // TODO(nisse): Change GetBitstream to return the buffer?
-  SetEncodedData(EncodedImageBuffer::Create(frame_size));
+  SetEncodedData(packet_buffer->AllocateBitstreamBuffer(frame_size));
   bool bitstream_copied = packet_buffer->GetBitstream(*this, data());
   RTC_DCHECK(bitstream_copied);
   _encodedWidth = first_packet->width();
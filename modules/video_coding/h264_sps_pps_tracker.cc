@@ -29,7 +29,8 @@ namespace {
 const uint8_t start_code_h264[] = {0, 0, 0, 1};
 }  // namespace
 
-H264SpsPpsTracker::H264SpsPpsTracker() = default;
+H264SpsPpsTracker::H264SpsPpsTracker()
+    : start_code_prepend_(start_code_h264, sizeof(start_code_h264)) {}
 H264SpsPpsTracker::~H264SpsPpsTracker() = default;
 
 H264SpsPpsTracker::PpsInfo::PpsInfo() = default;
@@ -100,11 +101,9 @@ H264SpsPpsTracker::PacketAction H264SpsPpsTracker::CopyAndFixBitstream(
           packet->video_header.width = sps->second.width;
           packet->video_header.height = sps->second.height;
 
-          // If the SPS/PPS was supplied out of band then we will have saved
-          // the actual bitstream in |data|.
-          if (sps->second.data && pps->second.data) {
-            RTC_DCHECK_GT(sps->second.size, 0);
-            RTC_DCHECK_GT(pps->second.size, 0);
+          // If the SPS/PPS was supplied out of band then the actual
+          // bitstream is saved in the precomputed prepend chunk.
+          if (pps->second.prepend.size() > 0) {
             append_sps_pps = true;
           }
         }
@@ -118,52 +117,9 @@ H264SpsPpsTracker::PacketAction H264SpsPpsTracker::CopyAndFixBitstream(
   RTC_CHECK(!append_sps_pps ||
             (sps != sps_data_.end() && pps != pps_data_.end()));
 
-  // Calculate how much space we need for the rest of the bitstream.
-  size_t required_size = 0;
-
-  if (append_sps_pps) {
-    required_size += sps->second.size + sizeof(start_code_h264);
-    required_size += pps->second.size + sizeof(start_code_h264);
-  }
-
-  if (h264_header.packetization_type == kH264StapA) {
-    const uint8_t* nalu_ptr = data + 1;
-    while (nalu_ptr < data + data_size) {
-      RTC_DCHECK(video_header.is_first_packet_in_frame);
-      required_size += sizeof(start_code_h264);
-
-      // The first two bytes describe the length of a segment.
-      uint16_t segment_length = nalu_ptr[0] << 8 | nalu_ptr[1];
-      nalu_ptr += 2;
-
-      required_size += segment_length;
-      nalu_ptr += segment_length;
-    }
-  } else {
-    if (h264_header.nalus_length > 0) {
-      required_size += sizeof(start_code_h264);
-    }
-    required_size += data_size;
-  }
-
-  // Then we copy to the new buffer.
-  uint8_t* buffer = new uint8_t[required_size];
-  uint8_t* insert_at = buffer;
-
   if (append_sps_pps) {
-    // Insert SPS.
-    memcpy(insert_at, start_code_h264, sizeof(start_code_h264));
-    insert_at += sizeof(start_code_h264);
-    memcpy(insert_at, sps->second.data.get(), sps->second.size);
-    insert_at += sps->second.size;
-
-    // Insert PPS.
-    memcpy(insert_at, start_code_h264, sizeof(start_code_h264));
-    insert_at += sizeof(start_code_h264);
-    memcpy(insert_at, pps->second.data.get(), pps->second.size);
-    insert_at += pps->second.size;
-
-    // Update codec header to reflect the newly added SPS and PPS.
+    // Update codec header to reflect the SPS and PPS that frame assembly
+    // will prepend from the shared chunk.
     NaluInfo sps_info;
     sps_info.type = H264::NaluType::kSps;
     sps_info.sps_id = sps->first;
@@ -181,37 +137,67 @@ H264SpsPpsTracker::PacketAction H264SpsPpsTracker::CopyAndFixBitstream(
     }
   }
 
-  // Copy the rest of the bitstream and insert start codes.
+  // Start codes (and out-of-band parameter sets) are not copied in front of
+  // the payload here; they are handed to frame assembly as a shared prepend
+  // descriptor, so in the common case the payload is copied exactly once.
   if (h264_header.packetization_type == kH264StapA) {
+    // STAP-A payloads still need a rewrite since the two byte segment
+    // lengths inside the payload are replaced by start codes. The start
+    // code in front of the first segment comes from the prepend.
+    size_t required_size = 0;
     const uint8_t* nalu_ptr = data + 1;
     while (nalu_ptr < data + data_size) {
-      memcpy(insert_at, start_code_h264, sizeof(start_code_h264));
-      insert_at += sizeof(start_code_h264);
+      RTC_DCHECK(video_header.is_first_packet_in_frame);
+      if (nalu_ptr != data + 1)
+        required_size += sizeof(start_code_h264);
 
       // The first two bytes describe the length of a segment.
       uint16_t segment_length = nalu_ptr[0] << 8 | nalu_ptr[1];
       nalu_ptr += 2;
 
-      size_t copy_end = nalu_ptr - data + segment_length;
-      if (copy_end > data_size) {
-        delete[] buffer;
+      size_t segment_end = nalu_ptr - data + segment_length;
+      if (segment_end > data_size)
         return kDrop;
+
+      required_size += segment_length;
+      nalu_ptr += segment_length;
+    }
+
+    uint8_t* buffer = new uint8_t[required_size];
+    uint8_t* insert_at = buffer;
+
+    nalu_ptr = data + 1;
+    while (nalu_ptr < data + data_size) {
+      if (nalu_ptr != data + 1) {
+        memcpy(insert_at, start_code_h264, sizeof(start_code_h264));
+        insert_at += sizeof(start_code_h264);
       }
 
+      uint16_t segment_length = nalu_ptr[0] << 8 | nalu_ptr[1];
+      nalu_ptr += 2;
+
       memcpy(insert_at, nalu_ptr, segment_length);
       insert_at += segment_length;
       nalu_ptr += segment_length;
     }
+
+    packet->dataPtr = buffer;
+    packet->sizeBytes = required_size;
+    packet->bitstream_prepend =
+        append_sps_pps ? pps->second.prepend : start_code_prepend_;
   } else {
-    if (h264_header.nalus_length > 0) {
-      memcpy(insert_at, start_code_h264, sizeof(start_code_h264));
-      insert_at += sizeof(start_code_h264);
+    if (append_sps_pps) {
+      // The prepend chunk ends with the start code of this packet's IDR.
+      packet->bitstream_prepend = pps->second.prepend;
+    } else if (h264_header.nalus_length > 0) {
+      packet->bitstream_prepend = start_code_prepend_;
     }
-    memcpy(insert_at, data, data_size);
+
+    uint8_t* buffer = new uint8_t[data_size];
+    memcpy(buffer, data, data_size);
+    packet->dataPtr = buffer;
   }
 
-  packet->dataPtr = buffer;
-  packet->sizeBytes = required_size;
   return kInsert;
 }
 
@@ -254,20 +240,21 @@ void H264SpsPpsTracker::InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
   }
 
   SpsInfo sps_info;
-  sps_info.size = sps.size();
   sps_info.width = parsed_sps->width;
   sps_info.height = parsed_sps->height;
-  uint8_t* sps_data = new uint8_t[sps_info.size];
-  memcpy(sps_data, sps.data(), sps_info.size);
-  sps_info.data.reset(sps_data);
   sps_data_[parsed_sps->id] = std::move(sps_info);
 
+  // Precompute the chunk prepended to the first packet of every IDR:
+  // both parameter sets with start codes, plus the start code of the IDR
+  // NALU itself. It is built once here and shared by reference with every
+  // keyframe packet afterwards.
   PpsInfo pps_info;
-  pps_info.size = pps.size();
   pps_info.sps_id = parsed_pps->sps_id;
-  uint8_t* pps_data = new uint8_t[pps_info.size];
-  memcpy(pps_data, pps.data(), pps_info.size);
-  pps_info.data.reset(pps_data);
+  pps_info.prepend.AppendData(start_code_h264);
+  pps_info.prepend.AppendData(sps.data(), sps.size());
+  pps_info.prepend.AppendData(start_code_h264);
+  pps_info.prepend.AppendData(pps.data(), pps.size());
+  pps_info.prepend.AppendData(start_code_h264);
   pps_data_[parsed_pps->id] = std::move(pps_info);
 
   RTC_LOG(LS_INFO) << "Inserted SPS id " << parsed_sps->id << " and PPS id "
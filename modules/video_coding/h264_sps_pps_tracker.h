@@ -13,10 +13,10 @@
 
 #include <cstdint>
 #include <map>
-#include <memory>
 #include <vector>
 
 #include "modules/include/module_common_types.h"
+#include "rtc_base/copy_on_write_buffer.h"
 
 namespace webrtc {
 
@@ -44,8 +44,11 @@ class H264SpsPpsTracker {
     ~PpsInfo();
 
     int sps_id = -1;
-    size_t size = 0;
-    std::unique_ptr<uint8_t[]> data;
+    // Annex-B chunk prepended to the first packet of every IDR when the
+    // parameter sets arrived out-of-band: both parameter sets with start
+    // codes plus the start code of the IDR NALU itself. Refcounted, so
+    // handing it to a packet is a pointer copy.
+    rtc::CopyOnWriteBuffer prepend;
   };
 
   struct SpsInfo {
@@ -54,14 +57,14 @@ class H264SpsPpsTracker {
     SpsInfo& operator=(SpsInfo&& rhs);
     ~SpsInfo();
 
-    size_t size = 0;
     int width = -1;
     int height = -1;
-    std::unique_ptr<uint8_t[]> data;
   };
 
   std::map<uint32_t, PpsInfo> pps_data_;
   std::map<uint32_t, SpsInfo> sps_data_;
+  // A plain start code, shared by every packet that only needs one inserted.
+  rtc::CopyOnWriteBuffer start_code_prepend_;
 };
 
 }  // namespace video_coding
@@ -67,6 +67,19 @@ class H264VcmPacket : public VCMPacket {
   }
 };
 
+// Reconstructs the bitstream contribution of |packet| the way frame assembly
+// does: any prepend bytes followed by the payload.
+std::vector<uint8_t> Bitstream(const VCMPacket& packet) {
+  std::vector<uint8_t> result;
+  if (packet.bitstream_prepend.size() > 0) {
+    result.insert(
+        result.end(), packet.bitstream_prepend.cdata(),
+        packet.bitstream_prepend.cdata() + packet.bitstream_prepend.size());
+  }
+  result.insert(result.end(), packet.dataPtr, packet.dataPtr + packet.sizeBytes);
+  return result;
+}
+
 }  // namespace
 
 class TestH264SpsPpsTracker : public ::testing::Test {
@@ -119,7 +132,7 @@ TEST_F(TestH264SpsPpsTracker, NoNalus) {
   packet.sizeBytes = sizeof(data);
 
   EXPECT_EQ(H264SpsPpsTracker::kInsert, tracker_.CopyAndFixBitstream(&packet));
-  EXPECT_EQ(memcmp(packet.dataPtr, data, sizeof(data)), 0);
+  EXPECT_EQ(Bitstream(packet), std::vector<uint8_t>(data, data + sizeof(data)));
   delete[] packet.dataPtr;
 }
 
@@ -136,7 +149,7 @@ TEST_F(TestH264SpsPpsTracker, FuAFirstPacket) {
   std::vector<uint8_t> expected;
   expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
   expected.insert(expected.end(), {1, 2, 3});
-  EXPECT_EQ(memcmp(packet.dataPtr, expected.data(), expected.size()), 0);
+  EXPECT_EQ(Bitstream(packet), expected);
   delete[] packet.dataPtr;
 }
 
@@ -162,7 +175,7 @@ TEST_F(TestH264SpsPpsTracker, SingleNaluInsertStartCode) {
   std::vector<uint8_t> expected;
   expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
   expected.insert(expected.end(), {1, 2, 3});
-  EXPECT_EQ(memcmp(packet.dataPtr, expected.data(), expected.size()), 0);
+  EXPECT_EQ(Bitstream(packet), expected);
   delete[] packet.dataPtr;
 }
 
@@ -178,7 +191,8 @@ TEST_F(TestH264SpsPpsTracker, NoStartCodeInsertedForSubsequentFuAPacket) {
   packet.sizeBytes = data.size();
 
   EXPECT_EQ(H264SpsPpsTracker::kInsert, tracker_.CopyAndFixBitstream(&packet));
-  EXPECT_EQ(memcmp(packet.dataPtr, data.data(), data.size()), 0);
+  EXPECT_EQ(0u, packet.bitstream_prepend.size());
+  EXPECT_EQ(Bitstream(packet), data);
   delete[] packet.dataPtr;
 }
 
@@ -250,7 +264,7 @@ TEST_F(TestH264SpsPpsTracker, SpsPpsPacketThenIdrFirstPacket) {
   std::vector<uint8_t> expected;
   expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
   expected.insert(expected.end(), {1, 2, 3});
-  EXPECT_EQ(memcmp(idr_packet.dataPtr, expected.data(), expected.size()), 0);
+  EXPECT_EQ(Bitstream(idr_packet), expected);
   delete[] idr_packet.dataPtr;
 }
 
@@ -281,7 +295,7 @@ TEST_F(TestH264SpsPpsTracker, SpsPpsIdrInStapA) {
   expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
   expected.insert(expected.end(), {1, 2, 3, 2, 1});
 
-  EXPECT_EQ(memcmp(packet.dataPtr, expected.data(), expected.size()), 0);
+  EXPECT_EQ(Bitstream(packet), expected);
   delete[] packet.dataPtr;
 }
 
@@ -310,12 +324,52 @@ TEST_F(TestH264SpsPpsTracker, SpsPpsOutOfBand) {
   EXPECT_EQ(240, idr_packet.height());
   ExpectSpsPpsIdr(idr_packet.h264(), 0, 0);
 
-  if (idr_packet.dataPtr != kData) {
-    // In case CopyAndFixBitStream() prepends SPS/PPS nalus to the packet, it
-    // uses new uint8_t[] to allocate memory. Caller of CopyAndFixBitStream()
-    // needs to take care of freeing the memory.
-    delete[] idr_packet.dataPtr;
-  }
+  // The SPS/PPS end up in the prepend descriptor rather than the payload
+  // copy, followed by the start code of the IDR itself.
+  std::vector<uint8_t> expected;
+  expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
+  expected.insert(expected.end(), sps.begin(), sps.end());
+  expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
+  expected.insert(expected.end(), pps.begin(), pps.end());
+  expected.insert(expected.end(), start_code, start_code + sizeof(start_code));
+  expected.insert(expected.end(), kData, kData + sizeof(kData));
+  EXPECT_EQ(Bitstream(idr_packet), expected);
+
+  delete[] idr_packet.dataPtr;
+}
+
+TEST_F(TestH264SpsPpsTracker, OutOfBandPrependSharedBetweenKeyframes) {
+  const std::vector<uint8_t> sps(
+      {0x67, 0x7a, 0x00, 0x0d, 0xbc, 0xd9, 0x41, 0x41, 0xfa, 0x10, 0x00, 0x00,
+       0x03, 0x00, 0x10, 0x00, 0x00, 0x03, 0x03, 0xc0, 0xf1, 0x42, 0x99, 0x60});
+  const std::vector<uint8_t> pps({0x68, 0xeb, 0xe3, 0xcb, 0x22, 0xc0});
+  tracker_.InsertSpsPpsNalus(sps, pps);
+
+  constexpr uint8_t kData[] = {1, 2, 3};
+  H264VcmPacket first_idr;
+  first_idr.video_header.is_first_packet_in_frame = true;
+  AddIdr(&first_idr, 0);
+  first_idr.dataPtr = kData;
+  first_idr.sizeBytes = sizeof(kData);
+  EXPECT_EQ(H264SpsPpsTracker::kInsert,
+            tracker_.CopyAndFixBitstream(&first_idr));
+
+  H264VcmPacket second_idr;
+  second_idr.video_header.is_first_packet_in_frame = true;
+  AddIdr(&second_idr, 0);
+  second_idr.dataPtr = kData;
+  second_idr.sizeBytes = sizeof(kData);
+  EXPECT_EQ(H264SpsPpsTracker::kInsert,
+            tracker_.CopyAndFixBitstream(&second_idr));
+
+  // Both packets reference the same underlying parameter set bytes; no copy
+  // of the SPS/PPS is made per keyframe.
+  EXPECT_GT(first_idr.bitstream_prepend.size(), 0u);
+  EXPECT_EQ(first_idr.bitstream_prepend.cdata(),
+            second_idr.bitstream_prepend.cdata());
+
+  delete[] first_idr.dataPtr;
+  delete[] second_idr.dataPtr;
 }
 
 TEST_F(TestH264SpsPpsTracker, SpsPpsOutOfBandWrongNaluHeader) {
@@ -31,11 +31,14 @@ static constexpr int64_t kFsAccuStartupSamples = 5;
 static constexpr double kMaxFramerateEstimate = 200.0;
 static constexpr int64_t kNackCountTimeoutMs = 60000;
 static constexpr double kDefaultMaxTimestampDeviationInSigmas = 3.5;
+// Percentile of the frame size distribution tracked as the "max" frame size.
+// Streamed through a constant-time quantile estimator, so no frame size
+// window has to be kept or rescanned.
+static constexpr double kMaxFrameSizePercentile = 0.95;
 }  // namespace
 
 VCMJitterEstimator::VCMJitterEstimator(Clock* clock)
     : _phi(0.97),
-      _psi(0.9999),
       _alphaCountMax(400),
       _thetaLow(0.000001),
       _nackLimit(3),
@@ -44,6 +47,7 @@ VCMJitterEstimator::VCMJitterEstimator(Clock* clock)
       _noiseStdDevs(2.33),       // ~Less than 1% chance
                                  // (look up in normal distribution table)...
       _noiseStdDevOffset(30.0),  // ...of getting 30 ms freezes
+      frame_size_quantile_(kMaxFrameSizePercentile),
       _rttFilter(),
       fps_counter_(30),  // TODO(sprang): Use an estimator with limit based on
                          // time, rather than number of samples.
@@ -65,6 +69,7 @@ VCMJitterEstimator& VCMJitterEstimator::operator=(
     _avgFrameSize = rhs._avgFrameSize;
     _varFrameSize = rhs._varFrameSize;
     _maxFrameSize = rhs._maxFrameSize;
+    frame_size_quantile_ = rhs.frame_size_quantile_;
     _fsSum = rhs._fsSum;
     _fsCount = rhs._fsCount;
     _lastUpdateT = rhs._lastUpdateT;
@@ -109,6 +114,7 @@ void VCMJitterEstimator::Reset() {
   _fsSum = 0;
   _fsCount = 0;
   _startupCount = 0;
+  frame_size_quantile_.Reset();
   _rttFilter.Reset();
   fps_counter_.Reset();
 }
@@ -143,9 +149,12 @@ void VCMJitterEstimator::UpdateEstimate(int64_t frameDelayMS,
         1.0);
   }
 
-  // Update max frameSize estimate.
-  _maxFrameSize =
-      VCM_MAX(_psi * _maxFrameSize, static_cast<double>(frameSizeBytes));
+  // Update the frame size quantile estimate, used as a robust "max" frame
+  // size. The estimator is O(1) per sample; the high percentile also keeps a
+  // single oversized frame from inflating the estimate for a long time the
+  // way the old slowly decaying running max did.
+  frame_size_quantile_.AddSample(static_cast<double>(frameSizeBytes));
+  _maxFrameSize = VCM_MAX(frame_size_quantile_.GetEstimate(), _avgFrameSize);
 
   if (_prevFrameSize == 0) {
     _prevFrameSize = frameSizeBytes;
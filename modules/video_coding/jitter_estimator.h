@@ -12,6 +12,7 @@
 #define MODULES_VIDEO_CODING_JITTER_ESTIMATOR_H_
 
 #include "modules/video_coding/rtt_filter.h"
+#include "rtc_base/numerics/quantile_estimator.h"
 #include "rtc_base/rolling_accumulator.h"
 
 namespace webrtc {
@@ -115,7 +116,6 @@ class VCMJitterEstimator {
 
   // Constants, filter parameters.
   const double _phi;
-  const double _psi;
   const uint32_t _alphaCountMax;
   const double _thetaLow;
   const uint32_t _nackLimit;
@@ -128,8 +128,9 @@ class VCMJitterEstimator {
   double _Qcov[2][2];      // Process noise covariance
   double _avgFrameSize;    // Average frame size
   double _varFrameSize;    // Frame size variance
-  double _maxFrameSize;    // Largest frame size received (descending
-                           // with a factor _psi)
+  double _maxFrameSize;    // Cached high percentile of the received frame
+                           // sizes, from |frame_size_quantile_|
+  QuantileEstimator frame_size_quantile_;
   uint32_t _fsSum;
   uint32_t _fsCount;
 
@@ -164,6 +164,7 @@ void NackModule::UpdateRtt(int64_t rtt_ms) {
 void NackModule::Clear() {
   rtc::CritScope lock(&crit_);
   nack_list_.clear();
+  send_at_seq_num_index_.clear();
   keyframe_list_.clear();
   recovered_list_.clear();
 }
@@ -225,6 +226,11 @@ void NackModule::AddPacketsToNack(uint16_t seq_num_start,
   // Remove old packets.
   auto it = nack_list_.lower_bound(seq_num_end - kMaxPacketAge);
   nack_list_.erase(nack_list_.begin(), it);
+  // Also remove old index entries, so that all keys in the index stay within
+  // half the sequence number range of each other.
+  send_at_seq_num_index_.erase(
+      send_at_seq_num_index_.begin(),
+      send_at_seq_num_index_.lower_bound(seq_num_end - kMaxPacketAge));
 
   // If the nack list is too large, remove packets from the nack list until
   // the latest first packet of a keyframe. If the list is still too large,
@@ -237,6 +243,7 @@ void NackModule::AddPacketsToNack(uint16_t seq_num_start,
 
     if (nack_list_.size() + num_new_nacks > kMaxNackPackets) {
       nack_list_.clear();
+      send_at_seq_num_index_.clear();
       RTC_LOG(LS_WARNING) << "NACK list full, clearing NACK"
                              " list and requesting keyframe.";
       keyframe_request_sender_->RequestKeyFrame();
@@ -252,6 +259,7 @@ void NackModule::AddPacketsToNack(uint16_t seq_num_start,
                        clock_->TimeInMilliseconds());
     RTC_DCHECK(nack_list_.find(seq_num) == nack_list_.end());
     nack_list_[seq_num] = nack_info;
+    send_at_seq_num_index_.emplace(nack_info.send_at_seq_num, seq_num);
   }
 }
 
@@ -260,6 +268,40 @@ std::vector<uint16_t> NackModule::GetNackBatch(NackFilterOptions options) {
   bool consider_timestamp = options != kSeqNumOnly;
   int64_t now_ms = clock_->TimeInMilliseconds();
   std::vector<uint16_t> nack_batch;
+
+  if (options == kSeqNumOnly) {
+    // The entries that are waiting for a sequence number that
+    // |newest_seq_num_| has passed form a range at the beginning of the
+    // index, so the rest of the nack list does not have to be scanned on the
+    // receive path.
+    auto index_it = send_at_seq_num_index_.begin();
+    auto index_end = send_at_seq_num_index_.upper_bound(newest_seq_num_);
+    while (index_it != index_end) {
+      auto nack_it = nack_list_.find(index_it->second);
+      if (nack_it == nack_list_.end() || nack_it->second.sent_at_time != -1) {
+        // The nack list entry has been erased or was already sent on rtt
+        // timeout, drop the stale index entry.
+        index_it = send_at_seq_num_index_.erase(index_it);
+        continue;
+      }
+      if (now_ms - nack_it->second.created_at_time < send_nack_delay_ms_) {
+        // Keep the entry in the index until the send delay has passed.
+        ++index_it;
+        continue;
+      }
+      nack_batch.emplace_back(nack_it->second.seq_num);
+      ++nack_it->second.retries;
+      nack_it->second.sent_at_time = now_ms;
+      if (nack_it->second.retries >= kMaxNackRetries) {
+        RTC_LOG(LS_WARNING) << "Sequence number " << nack_it->second.seq_num
+                            << " removed from NACK list due to max retries.";
+        nack_list_.erase(nack_it);
+      }
+      index_it = send_at_seq_num_index_.erase(index_it);
+    }
+    return nack_batch;
+  }
+
   auto it = nack_list_.begin();
   while (it != nack_list_.end()) {
     bool delay_timed_out =
@@ -92,6 +92,12 @@ class NackModule : public Module {
   // synchronized access.
   std::map<uint16_t, NackInfo, DescendingSeqNumComp<uint16_t>> nack_list_
       RTC_GUARDED_BY(crit_);
+  // Index over the entries in |nack_list_| that have not yet been sent,
+  // keyed by the sequence number they are waiting for. Only the range that
+  // |newest_seq_num_| has passed is scanned on the receive path, and entries
+  // that no longer match the nack list are erased lazily during that scan.
+  std::multimap<uint16_t, uint16_t, DescendingSeqNumComp<uint16_t>>
+      send_at_seq_num_index_ RTC_GUARDED_BY(crit_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> keyframe_list_
       RTC_GUARDED_BY(crit_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> recovered_list_
@@ -20,6 +20,7 @@
 #include "api/video/video_frame_type.h"
 #include "modules/rtp_rtcp/source/rtp_generic_frame_descriptor.h"
 #include "modules/rtp_rtcp/source/rtp_video_header.h"
+#include "rtc_base/copy_on_write_buffer.h"
 
 namespace webrtc {
 
@@ -66,6 +67,12 @@ class VCMPacket {
   bool markerBit;
   int timesNacked;
 
+  // Bytes that frame assembly writes to the bitstream immediately before the
+  // payload in |dataPtr| (H.264 Annex-B start codes and parameter sets). The
+  // buffer is refcounted and typically shared by many packets, so setting it
+  // costs a pointer copy rather than a payload rewrite.
+  rtc::CopyOnWriteBuffer bitstream_prepend;
+
   VCMNaluCompleteness completeNALU;  // Default is kNaluIncomplete.
   bool insertStartCode;  // True if a start code should be inserted before this
                          // packet.
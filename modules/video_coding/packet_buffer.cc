@@ -10,12 +10,14 @@
 
 #include "modules/video_coding/packet_buffer.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include <algorithm>
 #include <cstdint>
 #include <utility>
 
+#include "absl/memory/memory.h"
 #include "absl/types/variant.h"
 #include "api/video/encoded_frame.h"
 #include "common_video/h264/h264_common.h"
@@ -24,6 +26,8 @@
 #include "modules/video_coding/frame_object.h"
 #include "rtc_base/atomic_ops.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/ref_counted_object.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/mod_ops.h"
 #include "system_wrappers/include/clock.h"
@@ -32,6 +36,63 @@
 namespace webrtc {
 namespace video_coding {
 
+namespace {
+// Max number of bitstream buffers kept for reuse. Buffers are only recycled
+// once the frames that reference them have been released, so this bounds the
+// pool to roughly the depth of the decode pipeline.
+constexpr size_t kMaxPooledBitstreamBuffers = 8;
+
+size_t Log2(size_t value) {
+  size_t result = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++result;
+  }
+  return result;
+}
+}  // namespace
+
+PooledEncodedImageBuffer::PooledEncodedImageBuffer(size_t capacity)
+    : capacity_(capacity),
+      size_(capacity),
+      buffer_(static_cast<uint8_t*>(malloc(capacity))) {}
+
+PooledEncodedImageBuffer::~PooledEncodedImageBuffer() {
+  free(buffer_);
+}
+
+// static
+rtc::scoped_refptr<PooledEncodedImageBuffer> PooledEncodedImageBuffer::Create(
+    size_t capacity) {
+  return new rtc::RefCountedObject<PooledEncodedImageBuffer>(capacity);
+}
+
+const uint8_t* PooledEncodedImageBuffer::data() const {
+  return buffer_;
+}
+uint8_t* PooledEncodedImageBuffer::data() {
+  return buffer_;
+}
+size_t PooledEncodedImageBuffer::size() const {
+  return size_;
+}
+size_t PooledEncodedImageBuffer::capacity() const {
+  return capacity_;
+}
+
+void PooledEncodedImageBuffer::SetSize(size_t size) {
+  RTC_DCHECK_LE(size, capacity_);
+  size_ = size;
+}
+
+void PooledEncodedImageBuffer::Realloc(size_t size) {
+  if (size > capacity_) {
+    buffer_ = static_cast<uint8_t*>(realloc(buffer_, size));
+    capacity_ = size;
+  }
+  size_ = size;
+}
+
 rtc::scoped_refptr<PacketBuffer> PacketBuffer::Create(
     Clock* clock,
     size_t start_buffer_size,
@@ -48,11 +109,11 @@ PacketBuffer::PacketBuffer(Clock* clock,
     : clock_(clock),
       size_(start_buffer_size),
       max_size_(max_buffer_size),
+      segment_shift_(Log2(start_buffer_size)),
+      segment_mask_(start_buffer_size - 1),
       first_seq_num_(0),
       first_packet_received_(false),
       is_cleared_to_first_seq_num_(false),
-      data_buffer_(start_buffer_size),
-      sequence_buffer_(start_buffer_size),
       assembled_frame_callback_(assembled_frame_callback),
       unique_frames_seen_(0),
       sps_pps_idr_is_h264_keyframe_(
@@ -61,6 +122,7 @@ PacketBuffer::PacketBuffer(Clock* clock,
   // Buffer size must always be a power of 2.
   RTC_DCHECK((start_buffer_size & (start_buffer_size - 1)) == 0);
   RTC_DCHECK((max_buffer_size & (max_buffer_size - 1)) == 0);
+  segments_.push_back(absl::make_unique<Segment>(start_buffer_size));
 }
 
 PacketBuffer::~PacketBuffer() {
@@ -92,21 +154,21 @@ bool PacketBuffer::InsertPacket(VCMPacket* packet) {
       first_seq_num_ = seq_num;
     }
 
-    if (sequence_buffer_[index].used) {
+    if (Sequence(index).used) {
       // Duplicate packet, just delete the payload.
-      if (data_buffer_[index].seqNum == packet->seqNum) {
+      if (Data(index).seqNum == packet->seqNum) {
         delete[] packet->dataPtr;
         packet->dataPtr = nullptr;
         return true;
       }
 
       // The packet buffer is full, try to expand the buffer.
-      while (ExpandBufferSize() && sequence_buffer_[seq_num % size_].used) {
+      while (ExpandBufferSize() && Sequence(seq_num % size_).used) {
       }
       index = seq_num % size_;
 
       // Packet buffer is still full since we were unable to expand the buffer.
-      if (sequence_buffer_[index].used) {
+      if (Sequence(index).used) {
         // Clear the buffer, delete payload, and return false to signal that a
         // new keyframe is needed.
         RTC_LOG(LS_WARNING) << "Clear PacketBuffer and request key frame.";
@@ -117,13 +179,13 @@ bool PacketBuffer::InsertPacket(VCMPacket* packet) {
       }
     }
 
-    sequence_buffer_[index].frame_begin = packet->is_first_packet_in_frame();
-    sequence_buffer_[index].frame_end = packet->is_last_packet_in_frame();
-    sequence_buffer_[index].seq_num = packet->seqNum;
-    sequence_buffer_[index].continuous = false;
-    sequence_buffer_[index].frame_created = false;
-    sequence_buffer_[index].used = true;
-    data_buffer_[index] = *packet;
+    Sequence(index).frame_begin = packet->is_first_packet_in_frame();
+    Sequence(index).frame_end = packet->is_last_packet_in_frame();
+    Sequence(index).seq_num = packet->seqNum;
+    Sequence(index).continuous = false;
+    Sequence(index).frame_created = false;
+    Sequence(index).used = true;
+    Data(index) = *packet;
     packet->dataPtr = nullptr;
 
     UpdateMissingPackets(packet->seqNum);
@@ -161,11 +223,11 @@ void PacketBuffer::ClearTo(uint16_t seq_num) {
   size_t iterations = std::min(diff, size_);
   for (size_t i = 0; i < iterations; ++i) {
     size_t index = first_seq_num_ % size_;
-    RTC_DCHECK_EQ(data_buffer_[index].seqNum, sequence_buffer_[index].seq_num);
-    if (AheadOf<uint16_t>(seq_num, sequence_buffer_[index].seq_num)) {
-      delete[] data_buffer_[index].dataPtr;
-      data_buffer_[index].dataPtr = nullptr;
-      sequence_buffer_[index].used = false;
+    RTC_DCHECK_EQ(Data(index).seqNum, Sequence(index).seq_num);
+    if (AheadOf<uint16_t>(seq_num, Sequence(index).seq_num)) {
+      delete[] Data(index).dataPtr;
+      Data(index).dataPtr = nullptr;
+      Sequence(index).used = false;
     }
     ++first_seq_num_;
   }
@@ -189,11 +251,11 @@ void PacketBuffer::ClearInterval(uint16_t start_seq_num,
   uint16_t seq_num = start_seq_num;
   for (size_t i = 0; i < iterations; ++i) {
     size_t index = seq_num % size_;
-    RTC_DCHECK_EQ(sequence_buffer_[index].seq_num, seq_num);
-    RTC_DCHECK_EQ(sequence_buffer_[index].seq_num, data_buffer_[index].seqNum);
-    delete[] data_buffer_[index].dataPtr;
-    data_buffer_[index].dataPtr = nullptr;
-    sequence_buffer_[index].used = false;
+    RTC_DCHECK_EQ(Sequence(index).seq_num, seq_num);
+    RTC_DCHECK_EQ(Sequence(index).seq_num, Data(index).seqNum);
+    delete[] Data(index).dataPtr;
+    Data(index).dataPtr = nullptr;
+    Sequence(index).used = false;
 
     ++seq_num;
   }
@@ -202,9 +264,9 @@ void PacketBuffer::ClearInterval(uint16_t start_seq_num,
 void PacketBuffer::Clear() {
   rtc::CritScope lock(&crit_);
   for (size_t i = 0; i < size_; ++i) {
-    delete[] data_buffer_[i].dataPtr;
-    data_buffer_[i].dataPtr = nullptr;
-    sequence_buffer_[i].used = false;
+    delete[] Data(i).dataPtr;
+    Data(i).dataPtr = nullptr;
+    Sequence(i).used = false;
   }
 
   first_packet_received_ = false;
@@ -249,19 +311,31 @@ bool PacketBuffer::ExpandBufferSize() {
     return false;
   }
 
-  size_t new_size = std::min(max_size_, 2 * size_);
-  std::vector<VCMPacket> new_data_buffer(new_size);
-  std::vector<ContinuityInfo> new_sequence_buffer(new_size);
-  for (size_t i = 0; i < size_; ++i) {
-    if (sequence_buffer_[i].used) {
-      size_t index = sequence_buffer_[i].seq_num % new_size;
-      new_sequence_buffer[index] = sequence_buffer_[i];
-      new_data_buffer[index] = data_buffer_[i];
-    }
+  const size_t old_size = size_;
+  const size_t new_size = std::min(max_size_, 2 * size_);
+  RTC_DCHECK_EQ(new_size, 2 * old_size);
+
+  // Link new segments instead of reallocating and copying the old storage.
+  while (segments_.size() << segment_shift_ < new_size) {
+    segments_.push_back(
+        absl::make_unique<Segment>(size_t{1} << segment_shift_));
   }
   size_ = new_size;
-  sequence_buffer_ = std::move(new_sequence_buffer);
-  data_buffer_ = std::move(new_data_buffer);
+
+  // Since the size is a power of two, a packet either keeps its slot or moves
+  // to the mirrored slot in the newly linked half of the buffer.
+  for (size_t i = 0; i < old_size; ++i) {
+    ContinuityInfo& info = Sequence(i);
+    if (!info.used)
+      continue;
+    size_t new_index = info.seq_num % new_size;
+    if (new_index != i) {
+      Sequence(new_index) = info;
+      Data(new_index) = Data(i);
+      Data(i) = VCMPacket();
+      info = ContinuityInfo();
+    }
+  }
   RTC_LOG(LS_INFO) << "PacketBuffer size expanded to " << new_size;
   return true;
 }
@@ -270,25 +344,25 @@ bool PacketBuffer::PotentialNewFrame(uint16_t seq_num) const {
   size_t index = seq_num % size_;
   int prev_index = index > 0 ? index - 1 : size_ - 1;
 
-  if (!sequence_buffer_[index].used)
+  if (!Sequence(index).used)
     return false;
-  if (sequence_buffer_[index].seq_num != seq_num)
+  if (Sequence(index).seq_num != seq_num)
     return false;
-  if (sequence_buffer_[index].frame_created)
+  if (Sequence(index).frame_created)
     return false;
-  if (sequence_buffer_[index].frame_begin)
+  if (Sequence(index).frame_begin)
     return true;
-  if (!sequence_buffer_[prev_index].used)
+  if (!Sequence(prev_index).used)
     return false;
-  if (sequence_buffer_[prev_index].frame_created)
+  if (Sequence(prev_index).frame_created)
     return false;
-  if (sequence_buffer_[prev_index].seq_num !=
-      static_cast<uint16_t>(sequence_buffer_[index].seq_num - 1)) {
+  if (Sequence(prev_index).seq_num !=
+      static_cast<uint16_t>(Sequence(index).seq_num - 1)) {
     return false;
   }
-  if (data_buffer_[prev_index].timestamp != data_buffer_[index].timestamp)
+  if (Data(prev_index).timestamp != Data(index).timestamp)
     return false;
-  if (sequence_buffer_[prev_index].continuous)
+  if (Sequence(prev_index).continuous)
     return true;
 
   return false;
@@ -299,26 +373,26 @@ std::vector<std::unique_ptr<RtpFrameObject>> PacketBuffer::FindFrames(
   std::vector<std::unique_ptr<RtpFrameObject>> found_frames;
   for (size_t i = 0; i < size_ && PotentialNewFrame(seq_num); ++i) {
     size_t index = seq_num % size_;
-    sequence_buffer_[index].continuous = true;
+    Sequence(index).continuous = true;
 
     // If all packets of the frame is continuous, find the first packet of the
     // frame and create an RtpFrameObject.
-    if (sequence_buffer_[index].frame_end) {
+    if (Sequence(index).frame_end) {
       size_t frame_size = 0;
       int max_nack_count = -1;
       uint16_t start_seq_num = seq_num;
-      int64_t min_recv_time = data_buffer_[index].packet_info.receive_time_ms();
-      int64_t max_recv_time = data_buffer_[index].packet_info.receive_time_ms();
+      int64_t min_recv_time = Data(index).packet_info.receive_time_ms();
+      int64_t max_recv_time = Data(index).packet_info.receive_time_ms();
       RtpPacketInfos::vector_type packet_infos;
 
       // Find the start index by searching backward until the packet with
       // the |frame_begin| flag is set.
       int start_index = index;
       size_t tested_packets = 0;
-      int64_t frame_timestamp = data_buffer_[start_index].timestamp;
+      int64_t frame_timestamp = Data(start_index).timestamp;
 
       // Identify H.264 keyframes by means of SPS, PPS, and IDR.
-      bool is_h264 = data_buffer_[start_index].codec() == kVideoCodecH264;
+      bool is_h264 = Data(start_index).codec() == kVideoCodecH264;
       bool has_h264_sps = false;
       bool has_h264_pps = false;
       bool has_h264_idr = false;
@@ -326,29 +400,30 @@ std::vector<std::unique_ptr<RtpFrameObject>> PacketBuffer::FindFrames(
 
       while (true) {
         ++tested_packets;
-        frame_size += data_buffer_[start_index].sizeBytes;
+        frame_size += Data(start_index).sizeBytes +
+                      Data(start_index).bitstream_prepend.size();
         max_nack_count =
-            std::max(max_nack_count, data_buffer_[start_index].timesNacked);
-        sequence_buffer_[start_index].frame_created = true;
+            std::max(max_nack_count, Data(start_index).timesNacked);
+        Sequence(start_index).frame_created = true;
 
         min_recv_time =
             std::min(min_recv_time,
-                     data_buffer_[start_index].packet_info.receive_time_ms());
+                     Data(start_index).packet_info.receive_time_ms());
         max_recv_time =
             std::max(max_recv_time,
-                     data_buffer_[start_index].packet_info.receive_time_ms());
+                     Data(start_index).packet_info.receive_time_ms());
 
         // Should use |push_front()| since the loop traverses backwards. But
         // it's too inefficient to do so on a vector so we'll instead fix the
         // order afterwards.
-        packet_infos.push_back(data_buffer_[start_index].packet_info);
+        packet_infos.push_back(Data(start_index).packet_info);
 
-        if (!is_h264 && sequence_buffer_[start_index].frame_begin)
+        if (!is_h264 && Sequence(start_index).frame_begin)
           break;
 
         if (is_h264 && !is_h264_keyframe) {
           const auto* h264_header = absl::get_if<RTPVideoHeaderH264>(
-              &data_buffer_[start_index].video_header.video_type_header);
+              &Data(start_index).video_header.video_type_header);
           if (!h264_header || h264_header->nalus_length >= kMaxNalusPerPacket)
             return found_frames;
 
@@ -380,8 +455,8 @@ std::vector<std::unique_ptr<RtpFrameObject>> PacketBuffer::FindFrames(
         // the PacketBuffer to hand out incomplete frames.
         // See: https://bugs.chromium.org/p/webrtc/issues/detail?id=7106
         if (is_h264 &&
-            (!sequence_buffer_[start_index].used ||
-             data_buffer_[start_index].timestamp != frame_timestamp)) {
+            (!Sequence(start_index).used ||
+             Data(start_index).timestamp != frame_timestamp)) {
           break;
         }
 
@@ -409,23 +484,23 @@ std::vector<std::unique_ptr<RtpFrameObject>> PacketBuffer::FindFrames(
         const size_t first_packet_index = start_seq_num % size_;
         RTC_CHECK_LT(first_packet_index, size_);
         if (is_h264_keyframe) {
-          data_buffer_[first_packet_index].video_header.frame_type =
+          Data(first_packet_index).video_header.frame_type =
               VideoFrameType::kVideoFrameKey;
         } else {
-          data_buffer_[first_packet_index].video_header.frame_type =
+          Data(first_packet_index).video_header.frame_type =
               VideoFrameType::kVideoFrameDelta;
         }
 
         // With IPPP, if this is not a keyframe, make sure there are no gaps
         // in the packet sequence numbers up until this point.
         const uint8_t h264tid =
-            data_buffer_[start_index].video_header.frame_marking.temporal_id;
+            Data(start_index).video_header.frame_marking.temporal_id;
         if (h264tid == kNoTemporalIdx && !is_h264_keyframe &&
             missing_packets_.upper_bound(start_seq_num) !=
                 missing_packets_.begin()) {
           uint16_t stop_index = (index + 1) % size_;
           while (start_index != stop_index) {
-            sequence_buffer_[start_index].frame_created = false;
+            Sequence(start_index).frame_created = false;
             start_index = (start_index + 1) % size_;
           }
 
@@ -460,14 +535,15 @@ bool PacketBuffer::GetBitstream(const RtpFrameObject& frame,
   do {
     // Check both seq_num and timestamp to handle the case when seq_num wraps
     // around too quickly for high packet rates.
-    if (!sequence_buffer_[index].used ||
-        sequence_buffer_[index].seq_num != seq_num ||
-        data_buffer_[index].timestamp != timestamp) {
+    if (!Sequence(index).used ||
+        Sequence(index).seq_num != seq_num ||
+        Data(index).timestamp != timestamp) {
       return false;
     }
 
-    RTC_DCHECK_EQ(data_buffer_[index].seqNum, sequence_buffer_[index].seq_num);
-    size_t length = data_buffer_[index].sizeBytes;
+    RTC_DCHECK_EQ(Data(index).seqNum, Sequence(index).seq_num);
+    const rtc::CopyOnWriteBuffer& prepend = Data(index).bitstream_prepend;
+    size_t length = prepend.size() + Data(index).sizeBytes;
     if (destination + length > destination_end) {
       RTC_LOG(LS_WARNING) << "Frame (" << frame.id.picture_id << ":"
                           << static_cast<int>(frame.id.spatial_layer) << ")"
@@ -475,9 +551,15 @@ bool PacketBuffer::GetBitstream(const RtpFrameObject& frame,
       return false;
     }
 
-    const uint8_t* source = data_buffer_[index].dataPtr;
-    memcpy(destination, source, length);
-    destination += length;
+    // Write any prepend bytes (H.264 start codes and parameter sets shared
+    // by reference between packets) followed by the payload itself.
+    if (prepend.size() > 0) {
+      memcpy(destination, prepend.cdata(), prepend.size());
+      destination += prepend.size();
+    }
+    const uint8_t* source = Data(index).dataPtr;
+    memcpy(destination, source, Data(index).sizeBytes);
+    destination += Data(index).sizeBytes;
     index = (index + 1) % size_;
     ++seq_num;
   } while (index != end);
@@ -485,13 +567,49 @@ bool PacketBuffer::GetBitstream(const RtpFrameObject& frame,
   return true;
 }
 
+rtc::scoped_refptr<EncodedImageBufferInterface>
+PacketBuffer::AllocateBitstreamBuffer(size_t frame_size) {
+  rtc::CritScope lock(&crit_);
+  // Prefer a pooled buffer that is no longer referenced by a previously
+  // assembled frame and is large enough to hold this frame.
+  for (const auto& pooled_buffer : bitstream_buffer_pool_) {
+    if (pooled_buffer->HasOneRef() &&
+        pooled_buffer->capacity() >= frame_size) {
+      pooled_buffer->SetSize(frame_size);
+      return pooled_buffer;
+    }
+  }
+
+  // Round the capacity up to the next power of two so that the buffer can be
+  // reused for subsequent frames of slightly different sizes.
+  size_t capacity = 1;
+  while (capacity < frame_size)
+    capacity *= 2;
+  rtc::scoped_refptr<PooledEncodedImageBuffer> buffer =
+      PooledEncodedImageBuffer::Create(capacity);
+  buffer->SetSize(frame_size);
+
+  // Pool the new buffer, replacing a free buffer that was too small if the
+  // pool is already at max size. If all pooled buffers are still in use the
+  // new buffer is handed out unpooled.
+  for (auto& pooled_buffer : bitstream_buffer_pool_) {
+    if (pooled_buffer->HasOneRef()) {
+      pooled_buffer = buffer;
+      return buffer;
+    }
+  }
+  if (bitstream_buffer_pool_.size() < kMaxPooledBitstreamBuffers)
+    bitstream_buffer_pool_.push_back(buffer);
+  return buffer;
+}
+
 VCMPacket* PacketBuffer::GetPacket(uint16_t seq_num) {
   size_t index = seq_num % size_;
-  if (!sequence_buffer_[index].used ||
-      seq_num != sequence_buffer_[index].seq_num) {
+  if (!Sequence(index).used ||
+      seq_num != Sequence(index).seq_num) {
     return nullptr;
   }
-  return &data_buffer_[index];
+  return &Data(index);
 }
 
 int PacketBuffer::AddRef() const {
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
 #include "modules/include/module_common_types.h"
 #include "modules/video_coding/packet.h"
 #include "modules/video_coding/rtp_frame_reference_finder.h"
@@ -39,6 +40,33 @@ class OnAssembledFrameCallback {
   virtual void OnAssembledFrame(std::unique_ptr<RtpFrameObject> frame) = 0;
 };
 
+// EncodedImageBuffer implementation that keeps its allocation when a smaller
+// frame is written into it, allowing the PacketBuffer to recycle bitstream
+// buffers between assembled frames instead of allocating a new buffer for
+// every frame.
+class PooledEncodedImageBuffer : public EncodedImageBufferInterface {
+ public:
+  static rtc::scoped_refptr<PooledEncodedImageBuffer> Create(size_t capacity);
+
+  const uint8_t* data() const override;
+  uint8_t* data() override;
+  size_t size() const override;
+  void Realloc(size_t size) override;
+
+  size_t capacity() const;
+  // Set the size of the contained bitstream, must not exceed the capacity.
+  void SetSize(size_t size);
+
+ protected:
+  explicit PooledEncodedImageBuffer(size_t capacity);
+  ~PooledEncodedImageBuffer();
+
+ private:
+  size_t capacity_;
+  size_t size_;
+  uint8_t* buffer_;
+};
+
 class PacketBuffer {
  public:
   static rtc::scoped_refptr<PacketBuffer> Create(
@@ -118,6 +146,12 @@ class PacketBuffer {
   // Virtual for testing.
   virtual bool GetBitstream(const RtpFrameObject& frame, uint8_t* destination);
 
+  // Returns a bitstream buffer of |frame_size| bytes, reusing a pooled buffer
+  // that is no longer referenced by any previously assembled frame if one of
+  // sufficient capacity is available.
+  rtc::scoped_refptr<EncodedImageBufferInterface> AllocateBitstreamBuffer(
+      size_t frame_size);
+
   // Get the packet with sequence number |seq_num|.
   // Virtual for testing.
   virtual VCMPacket* GetPacket(uint16_t seq_num)
@@ -137,10 +171,40 @@ class PacketBuffer {
 
   rtc::CriticalSection crit_;
 
+  // Storage for one chunk of packet slots. The buffer is segment-chained;
+  // growing it links a new segment instead of reallocating and copying the
+  // whole buffer.
+  struct Segment {
+    explicit Segment(size_t size) : data(size), info(size) {}
+    std::vector<VCMPacket> data;
+    std::vector<ContinuityInfo> info;
+  };
+
+  // Accessors for the packet slot with the given index, |index| must be
+  // smaller than |size_|.
+  VCMPacket& Data(size_t index) RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_) {
+    return segments_[index >> segment_shift_]->data[index & segment_mask_];
+  }
+  const VCMPacket& Data(size_t index) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_) {
+    return segments_[index >> segment_shift_]->data[index & segment_mask_];
+  }
+  ContinuityInfo& Sequence(size_t index) RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_) {
+    return segments_[index >> segment_shift_]->info[index & segment_mask_];
+  }
+  const ContinuityInfo& Sequence(size_t index) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_) {
+    return segments_[index >> segment_shift_]->info[index & segment_mask_];
+  }
+
   // Buffer size_ and max_size_ must always be a power of two.
   size_t size_ RTC_GUARDED_BY(crit_);
   const size_t max_size_;
 
+  // Each segment holds |1 << segment_shift_| slots.
+  const size_t segment_shift_;
+  const size_t segment_mask_;
+
   // The fist sequence number currently in the buffer.
   uint16_t first_seq_num_ RTC_GUARDED_BY(crit_);
 
@@ -150,12 +214,14 @@ class PacketBuffer {
   // If the buffer is cleared to |first_seq_num_|.
   bool is_cleared_to_first_seq_num_ RTC_GUARDED_BY(crit_);
 
-  // Buffer that holds the inserted packets.
-  std::vector<VCMPacket> data_buffer_ RTC_GUARDED_BY(crit_);
+  // Segments that hold the inserted packets and the information needed to
+  // determine the continuity between them.
+  std::vector<std::unique_ptr<Segment>> segments_ RTC_GUARDED_BY(crit_);
 
-  // Buffer that holds the information about which slot that is currently in use
-  // and information needed to determine the continuity between packets.
-  std::vector<ContinuityInfo> sequence_buffer_ RTC_GUARDED_BY(crit_);
+  // Bitstream buffers kept for reuse once the frames that referenced them
+  // have been released.
+  std::vector<rtc::scoped_refptr<PooledEncodedImageBuffer>>
+      bitstream_buffer_pool_ RTC_GUARDED_BY(crit_);
 
   // Called when all packets in a frame are received, allowing the frame
   // to be assembled.
@@ -26,6 +26,7 @@ namespace video_coding {
 RtpFrameReferenceFinder::RtpFrameReferenceFinder(
     OnCompleteFrameCallback* frame_callback)
     : last_picture_id_(-1),
+      unblock_generation_(0),
       current_ss_idx_(0),
       cleared_to_seq_num_(-1),
       frame_callback_(frame_callback) {}
@@ -48,9 +49,10 @@ void RtpFrameReferenceFinder::ManageFrame(
     case kStash:
       if (stashed_frames_.size() > kMaxStashedFrames)
         stashed_frames_.pop_back();
-      stashed_frames_.push_front(std::move(frame));
+      stashed_frames_.push_front({std::move(frame), unblock_generation_});
       break;
     case kHandOff:
+      ++unblock_generation_;
       frame_callback_->OnCompleteFrame(std::move(frame));
       RetryStashedFrames();
       break;
@@ -65,7 +67,14 @@ void RtpFrameReferenceFinder::RetryStashedFrames() {
     complete_frame = false;
     for (auto frame_it = stashed_frames_.begin();
          frame_it != stashed_frames_.end();) {
-      FrameDecision decision = ManageFrameInternal(frame_it->get());
+      // If nothing that could unblock this frame has arrived since it was
+      // last evaluated, then it is known to still be blocked.
+      if (frame_it->last_retry_generation == unblock_generation_) {
+        ++frame_it;
+        continue;
+      }
+      frame_it->last_retry_generation = unblock_generation_;
+      FrameDecision decision = ManageFrameInternal(frame_it->frame.get());
 
       switch (decision) {
         case kStash:
@@ -73,7 +82,8 @@ void RtpFrameReferenceFinder::RetryStashedFrames() {
           break;
         case kHandOff:
           complete_frame = true;
-          frame_callback_->OnCompleteFrame(std::move(*frame_it));
+          ++unblock_generation_;
+          frame_callback_->OnCompleteFrame(std::move(frame_it->frame));
           RTC_FALLTHROUGH();
         case kDrop:
           frame_it = stashed_frames_.erase(frame_it);
@@ -116,6 +126,7 @@ void RtpFrameReferenceFinder::PaddingReceived(uint16_t seq_num) {
   stashed_padding_.erase(stashed_padding_.begin(), clean_padding_to);
   stashed_padding_.insert(seq_num);
   UpdateLastPictureIdWithPadding(seq_num);
+  ++unblock_generation_;
   RetryStashedFrames();
 }
 
@@ -125,7 +136,7 @@ void RtpFrameReferenceFinder::ClearTo(uint16_t seq_num) {
 
   auto it = stashed_frames_.begin();
   while (it != stashed_frames_.end()) {
-    if (AheadOf<uint16_t>(cleared_to_seq_num_, (*it)->first_seq_num())) {
+    if (AheadOf<uint16_t>(cleared_to_seq_num_, it->frame->first_seq_num())) {
       it = stashed_frames_.erase(it);
     } else {
       ++it;
@@ -83,7 +83,8 @@ class RtpFrameReferenceFinder {
   void UpdateLastPictureIdWithPadding(uint16_t seq_num)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
-  // Retry stashed frames until no more complete frames are found.
+  // Retry stashed frames until no more complete frames are found. Frames
+  // that have already been evaluated against the current state are skipped.
   void RetryStashedFrames() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
   FrameDecision ManageFrameInternal(RtpFrameObject* frame)
@@ -184,8 +185,19 @@ class RtpFrameReferenceFinder {
 
   // Frames that have been fully received but didn't have all the information
   // needed to determine their references.
-  std::deque<std::unique_ptr<RtpFrameObject>> stashed_frames_
-      RTC_GUARDED_BY(crit_);
+  struct StashedFrame {
+    std::unique_ptr<RtpFrameObject> frame;
+    // The value of |unblock_generation_| when the frame was last evaluated.
+    // Used to skip frames that are known to still be blocked when the stash
+    // is retried.
+    int64_t last_retry_generation;
+  };
+  std::deque<StashedFrame> stashed_frames_ RTC_GUARDED_BY(crit_);
+
+  // Incremented every time new information arrives that could unblock a
+  // stashed frame, i.e. when a frame is handed off or continuous padding
+  // advances a group of pictures.
+  int64_t unblock_generation_ RTC_GUARDED_BY(crit_);
 
   // Holds the information about the last completed frame for a given temporal
   // layer given an unwrapped Tl0 picture index.
@@ -12,7 +12,6 @@
 
 #include <math.h>
 #include <stdlib.h>
-#include <string.h>
 
 #include "modules/video_coding/internal_defines.h"
 
@@ -35,8 +34,10 @@ VCMRttFilter& VCMRttFilter::operator=(const VCMRttFilter& rhs) {
     _filtFactCount = rhs._filtFactCount;
     _jumpCount = rhs._jumpCount;
     _driftCount = rhs._driftCount;
-    memcpy(_jumpBuf, rhs._jumpBuf, sizeof(_jumpBuf));
-    memcpy(_driftBuf, rhs._driftBuf, sizeof(_driftBuf));
+    _jumpMaxRtt = rhs._jumpMaxRtt;
+    _jumpSumRtt = rhs._jumpSumRtt;
+    _driftMaxRtt = rhs._driftMaxRtt;
+    _driftSumRtt = rhs._driftSumRtt;
   }
   return *this;
 }
@@ -49,8 +50,10 @@ void VCMRttFilter::Reset() {
   _filtFactCount = 1;
   _jumpCount = 0;
   _driftCount = 0;
-  memset(_jumpBuf, 0, sizeof(_jumpBuf));
-  memset(_driftBuf, 0, sizeof(_driftBuf));
+  _jumpMaxRtt = 0;
+  _jumpSumRtt = 0;
+  _driftMaxRtt = 0;
+  _driftSumRtt = 0;
 }
 
 void VCMRttFilter::Update(int64_t rttMs) {
@@ -96,30 +99,37 @@ bool VCMRttFilter::JumpDetection(int64_t rttMs) {
     int diffSign = (diffFromAvg >= 0) ? 1 : -1;
     int jumpCountSign = (_jumpCount >= 0) ? 1 : -1;
     if (diffSign != jumpCountSign) {
-      // Since the signs differ the samples currently
-      // in the buffer is useless as they represent a
-      // jump in a different direction.
+      // Since the signs differ the samples gathered so
+      // far are useless as they represent a jump in a
+      // different direction.
       _jumpCount = 0;
+      _jumpMaxRtt = 0;
+      _jumpSumRtt = 0;
     }
     if (abs(_jumpCount) < kMaxDriftJumpCount) {
-      // Update the buffer used for the short time
-      // statistics.
+      // Update the short time statistics incrementally.
       // The sign of the diff is used for updating the counter since
-      // we want to use the same buffer for keeping track of when
+      // we want to use the same statistics for keeping track of when
       // the RTT jumps down and up.
-      _jumpBuf[abs(_jumpCount)] = rttMs;
+      _jumpMaxRtt = VCM_MAX(rttMs, _jumpMaxRtt);
+      _jumpSumRtt += rttMs;
       _jumpCount += diffSign;
     }
     if (abs(_jumpCount) >= _detectThreshold) {
       // Detected an RTT jump
-      ShortRttFilter(_jumpBuf, abs(_jumpCount));
+      _maxRtt = _jumpMaxRtt;
+      _avgRtt = _jumpSumRtt / abs(_jumpCount);
       _filtFactCount = _detectThreshold + 1;
       _jumpCount = 0;
+      _jumpMaxRtt = 0;
+      _jumpSumRtt = 0;
     } else {
       return false;
     }
   } else {
     _jumpCount = 0;
+    _jumpMaxRtt = 0;
+    _jumpSumRtt = 0;
   }
   return true;
 }
@@ -127,38 +137,28 @@ bool VCMRttFilter::JumpDetection(int64_t rttMs) {
 bool VCMRttFilter::DriftDetection(int64_t rttMs) {
   if (_maxRtt - _avgRtt > _driftStdDevs * sqrt(_varRtt)) {
     if (_driftCount < kMaxDriftJumpCount) {
-      // Update the buffer used for the short time
-      // statistics.
-      _driftBuf[_driftCount] = rttMs;
+      // Update the short time statistics incrementally.
+      _driftMaxRtt = VCM_MAX(rttMs, _driftMaxRtt);
+      _driftSumRtt += rttMs;
       _driftCount++;
     }
     if (_driftCount >= _detectThreshold) {
       // Detected an RTT drift
-      ShortRttFilter(_driftBuf, _driftCount);
+      _maxRtt = _driftMaxRtt;
+      _avgRtt = _driftSumRtt / _driftCount;
       _filtFactCount = _detectThreshold + 1;
       _driftCount = 0;
+      _driftMaxRtt = 0;
+      _driftSumRtt = 0;
     }
   } else {
     _driftCount = 0;
+    _driftMaxRtt = 0;
+    _driftSumRtt = 0;
   }
   return true;
 }
 
-void VCMRttFilter::ShortRttFilter(int64_t* buf, uint32_t length) {
-  if (length == 0) {
-    return;
-  }
-  _maxRtt = 0;
-  _avgRtt = 0;
-  for (uint32_t i = 0; i < length; i++) {
-    if (buf[i] > _maxRtt) {
-      _maxRtt = buf[i];
-    }
-    _avgRtt += buf[i];
-  }
-  _avgRtt = _avgRtt / static_cast<double>(length);
-}
-
 int64_t VCMRttFilter::RttMs() const {
   return static_cast<int64_t>(_maxRtt + 0.5);
 }
@@ -29,9 +29,8 @@ class VCMRttFilter {
   int64_t RttMs() const;
 
  private:
-  // The size of the drift and jump memory buffers
-  // and thus also the detection threshold for these
-  // detectors in number of samples.
+  // The number of samples the drift and jump detectors
+  // accumulate, and thus also their detection threshold.
   enum { kMaxDriftJumpCount = 5 };
   // Detects RTT jumps by comparing the difference between
   // samples and average to the standard deviation.
@@ -43,8 +42,6 @@ class VCMRttFilter {
   // Returns true if the long time statistics should be updated
   // and false otherwise
   bool DriftDetection(int64_t rttMs);
-  // Computes the short time average and maximum of the vector buf.
-  void ShortRttFilter(int64_t* buf, uint32_t length);
 
   bool _gotNonZeroUpdate;
   double _avgRtt;
@@ -57,8 +54,13 @@ class VCMRttFilter {
   int32_t _jumpCount;
   int32_t _driftCount;
   const int32_t _detectThreshold;
-  int64_t _jumpBuf[kMaxDriftJumpCount];
-  int64_t _driftBuf[kMaxDriftJumpCount];
+  // Short time statistics of the candidate samples gathered by the jump and
+  // drift detectors, maintained incrementally as the samples arrive instead
+  // of buffering the samples and rescanning them on detection.
+  int64_t _jumpMaxRtt;
+  double _jumpSumRtt;
+  int64_t _driftMaxRtt;
+  double _driftSumRtt;
 };
 
 }  // namespace webrtc
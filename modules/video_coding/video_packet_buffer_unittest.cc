@@ -481,6 +481,27 @@ TEST_F(TestPacketBuffer, GetBitstreamOneFrameOnePacket) {
             0);
 }
 
+TEST_F(TestPacketBuffer, ReusesBitstreamBufferOfReleasedFrame) {
+  uint8_t bitstream_data[] = "All the bitstream data for this frame!";
+  uint8_t* data = new uint8_t[sizeof(bitstream_data)];
+  memcpy(data, bitstream_data, sizeof(bitstream_data));
+
+  EXPECT_TRUE(
+      Insert(0, kKeyFrame, kFirst, kLast, sizeof(bitstream_data), data));
+  ASSERT_EQ(1UL, frames_from_callback_.size());
+  const uint8_t* released_buffer = frames_from_callback_[0]->data();
+  DeleteFrame(0);
+
+  // Once the first frame has been released its bitstream buffer should be
+  // recycled for the next assembled frame.
+  data = new uint8_t[sizeof(bitstream_data)];
+  memcpy(data, bitstream_data, sizeof(bitstream_data));
+  EXPECT_TRUE(Insert(1, kKeyFrame, kFirst, kLast, sizeof(bitstream_data), data,
+                     124u));
+  ASSERT_EQ(1UL, frames_from_callback_.size());
+  EXPECT_EQ(released_buffer, frames_from_callback_[1]->data());
+}
+
 TEST_F(TestPacketBuffer, GetBitstreamOneFrameFullBuffer) {
   uint8_t* data_arr[kStartSize];
   uint8_t expected[kStartSize];
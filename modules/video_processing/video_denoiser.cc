@@ -18,6 +18,17 @@
 
 namespace webrtc {
 
+namespace {
+
+// A block enters the temporal skip state after this many consecutive
+// frames of being filtered without a moving edge.
+const int kConsecStaticThreshold = 8;
+// Even static blocks run the full moving-edge/noise-estimation path once
+// every this many frames, so slow scene changes are still picked up.
+const uint32_t kStaticRefreshPeriod = 4;
+
+}  // namespace
+
 #if DISPLAY || DISPLAYNEON
 static void CopyMem8x8(const uint8_t* src,
                        int src_stride,
@@ -94,6 +105,8 @@ void VideoDenoiser::DenoiserReset(
   x_density_.reset(new uint8_t[mb_cols_]);
   y_density_.reset(new uint8_t[mb_rows_]);
   moving_object_.reset(new uint8_t[mb_cols_ * mb_rows_]);
+  mb_static_count_.reset(new uint8_t[mb_cols_ * mb_rows_]);
+  memset(mb_static_count_.get(), 0, mb_cols_ * mb_rows_);
 }
 
 int VideoDenoiser::PositionCheck(int mb_row, int mb_col, int noise_level) {
@@ -281,6 +294,18 @@ rtc::scoped_refptr<I420BufferInterface> VideoDenoiser::DenoiseFrame(
           filter_->MbDenoise(mb_dst_prev, stride_prev, mb_dst, stride_y_dst,
                              mb_src, stride_y_src, 0, noise_level);
 
+      // Temporal skip for static blocks: a block that has been filtered
+      // without a moving edge for a while keeps last frame's decisions and
+      // skips the variance/noise-estimation work on most frames. MbDenoise
+      // above is still the change detector; real motion flips it to
+      // COPY_BLOCK, which resets the static count below.
+      if (mb_filter_decision_[mb_index] == FILTER_BLOCK &&
+          mb_static_count_[mb_index] >= kConsecStaticThreshold &&
+          (frame_count_ % kStaticRefreshPeriod) != 0) {
+        moving_edge_[mb_index] = 0;
+        continue;
+      }
+
       // If filter decision is FILTER_BLOCK, no need to check moving edge.
       // It is unlikely for a moving edge block to be filtered in current
       // setting.
@@ -318,8 +343,18 @@ rtc::scoped_refptr<I420BufferInterface> VideoDenoiser::DenoiseFrame(
           }
         }
       }
+
+      // Track how long the block has stayed static for the temporal skip.
+      if (mb_filter_decision_[mb_index] == FILTER_BLOCK &&
+          !moving_edge_[mb_index]) {
+        if (mb_static_count_[mb_index] < 255)
+          ++mb_static_count_[mb_index];
+      } else {
+        mb_static_count_[mb_index] = 0;
+      }
     }  // End of for loop
   }    // End of for loop
+  ++frame_count_;
 
   ReduceFalseDetection(moving_edge_, &moving_object_, noise_level);
 
@@ -77,6 +77,16 @@ class VideoDenoiser {
   std::unique_ptr<uint8_t[]> y_density_;
   // Save the return values by MbDenoise for each block.
   std::unique_ptr<DenoiserDecision[]> mb_filter_decision_;
+  // Number of consecutive frames each block has been filtered without being
+  // part of a moving edge. Blocks past the static threshold skip the
+  // moving-edge/noise-estimation checks on most frames and reuse the
+  // previous frame's decisions; MbDenoise itself still runs and acts as the
+  // change detector (motion makes it return COPY_BLOCK, which drops the
+  // block out of the static state).
+  std::unique_ptr<uint8_t[]> mb_static_count_;
+  // Frame counter used to periodically force the full decision path on
+  // static blocks.
+  uint32_t frame_count_ = 0;
   I420BufferPool buffer_pool_;
   rtc::scoped_refptr<I420BufferInterface> prev_buffer_;
 };
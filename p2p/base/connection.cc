@@ -13,6 +13,7 @@
 #include <math.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -675,6 +676,43 @@ void Connection::UpdateState(int64_t now) {
   }
 }
 
+int64_t Connection::ComputeNextUpdateTime(int64_t now) const {
+  int64_t next = std::numeric_limits<int64_t>::max();
+  if (!pings_since_last_response_.empty()) {
+    int rtt = ConservativeRTTEstimate(rtt_);
+    if (write_state_ == STATE_WRITABLE) {
+      // Becoming unwritable requires the last ping to be older than |rtt| and
+      // the first to be older than unwritable_timeout(); see the
+      // TooManyFailures() and TooLongWithoutResponse() checks in
+      // UpdateState().
+      next = std::min(
+          next, std::max(pings_since_last_response_.back().sent_time + rtt,
+                         pings_since_last_response_[0].sent_time +
+                             unwritable_timeout()));
+    } else {
+      // STATE_WRITE_UNRELIABLE or STATE_WRITE_INIT times out
+      // inactive_timeout() after the first unanswered ping.
+      next = std::min(next, pings_since_last_response_[0].sent_time +
+                                inactive_timeout());
+    }
+  }
+  // The receiving state can only flip to false once the receiving timeout
+  // has passed since the last receive time. A connection whose last ping was
+  // answered stays receiving until a newer ping goes unanswered, and that
+  // ping is a new input.
+  if (receiving_ && last_ping_sent() >= last_ping_response_received()) {
+    next = std::min(next, last_received() + receiving_timeout());
+  }
+  // Deadlines for dead(); an active connection that has never received
+  // anything is kept alive until some other input changes.
+  if (last_received() > 0) {
+    next = std::min(next, last_received() + DEAD_CONNECTION_RECEIVE_TIMEOUT);
+  } else if (!active()) {
+    next = std::min(next, time_created_ms_ + MIN_CONNECTION_LIFETIME);
+  }
+  return std::max(next, now);
+}
+
 void Connection::Ping(int64_t now) {
   last_ping_sent_ = now;
   ConnectionRequest* req = new ConnectionRequest(this);
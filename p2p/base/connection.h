@@ -209,6 +209,13 @@ class Connection : public CandidatePairInterface,
   // the current time, which is compared against various timeouts.
   void UpdateState(int64_t now);
 
+  // Returns a conservative lower bound on the next time at which
+  // UpdateState() could change this connection's state, given its current
+  // inputs. Events that add new inputs - a ping being sent, a write state
+  // change, a config change - can move the bound earlier, so a scheduler
+  // relying on this must re-query it after such events.
+  int64_t ComputeNextUpdateTime(int64_t now) const;
+
   // Called when this connection should try checking writability again.
   int64_t last_ping_sent() const { return last_ping_sent_; }
   void Ping(int64_t now);
@@ -80,6 +80,21 @@ rtc::StreamResult StreamInterfaceChannel::Read(void* buffer,
     return rtc::SR_BLOCK;
   }
 
+  // Feed any further queued datagrams into the same read. DTLS records are
+  // self-delimiting, so the SSL stack parses them out of a contiguous buffer
+  // just as it already does for multiple records within one datagram, and the
+  // whole backlog is decrypted in a single pump instead of one BIO read per
+  // datagram. Only append while a maximum-sized packet still fits, since
+  // ReadFront() truncates packets that don't.
+  if (read) {
+    size_t appended;
+    while (buffer_len - *read >= kMaxDtlsPacketLen &&
+           packets_.ReadFront(static_cast<char*>(buffer) + *read,
+                              buffer_len - *read, &appended)) {
+      *read += appended;
+    }
+  }
+
   return rtc::SR_SUCCESS;
 }
 
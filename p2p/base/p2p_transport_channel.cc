@@ -36,6 +36,16 @@ namespace {
 // The minimum improvement in RTT that justifies a switch.
 const int kMinImprovement = 10;
 
+// Width of the buckets that connections are scheduled into for periodic
+// UpdateState() evaluation. Coarser buckets mean fewer map nodes but more
+// connections re-examined slightly early.
+const int kConnectionUpdateBucketMs = 50;
+
+// Safety net: no connection goes longer than this without an UpdateState()
+// pass, so a deadline that was computed under since-changed inputs (e.g. a
+// timeout shortened by SetIceConfig) is still honored promptly.
+const int kConnectionUpdateMaxIntervalMs = 2500;
+
 bool IsRelayRelay(const cricket::Connection* conn) {
   return conn->local_candidate().type() == cricket::RELAY_PORT_TYPE &&
          conn->remote_candidate().type() == cricket::RELAY_PORT_TYPE;
@@ -220,6 +230,8 @@ void P2PTransportChannel::AddConnection(Connection* connection) {
 
   had_connection_ = true;
 
+  ScheduleConnectionUpdate(connection, rtc::TimeMillis());
+
   connection->set_ice_event_log(&ice_event_log_);
   LogCandidatePairConfig(connection,
                          webrtc::IceCandidatePairConfigType::kAdded);
@@ -1106,7 +1118,8 @@ void P2PTransportChannel::OnNominated(Connection* conn) {
                                     "nomination on the controlled side")) {
     // Now that we have selected a connection, it is time to prune other
     // connections and update the read/write state of the channel.
-    RequestSortAndStateUpdate("nomination on the controlled side");
+    RequestConnectionResortAndStateUpdate(conn,
+                                          "nomination on the controlled side");
   } else {
     RTC_LOG(LS_INFO)
         << "Not switching the selected connection on controlled side yet: "
@@ -1538,17 +1551,61 @@ void P2PTransportChannel::UpdateConnectionStates() {
   RTC_DCHECK_RUN_ON(network_thread_);
   int64_t now = rtc::TimeMillis();
 
-  // We need to copy the list of connections since some may delete themselves
-  // when we call UpdateState.
-  for (Connection* c : connections_) {
+  // Pop the connections whose next possible state transition is due rather
+  // than scanning all of them; with many idle-but-kept-alive connections most
+  // have nothing to do on any given tick. Collect them first since
+  // UpdateState() may destroy a connection, which unschedules it.
+  std::vector<Connection*> due;
+  auto end = connection_update_buckets_.upper_bound(now);
+  for (auto it = connection_update_buckets_.begin(); it != end; ++it) {
+    due.insert(due.end(), it->second.begin(), it->second.end());
+  }
+  connection_update_buckets_.erase(connection_update_buckets_.begin(), end);
+  for (Connection* c : due) {
+    connection_update_deadlines_.erase(c);
+  }
+  for (Connection* c : due) {
+    // Destruction is asynchronous (Connection::Destroy() posts a message), so
+    // |c| stays valid for the remainder of this loop even if UpdateState()
+    // decides to destroy it.
     c->UpdateState(now);
+    ScheduleConnectionUpdate(c, now);
   }
 }
 
+void P2PTransportChannel::ScheduleConnectionUpdate(Connection* conn,
+                                                  int64_t now) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  UnscheduleConnectionUpdate(conn);
+  int64_t deadline = std::min(conn->ComputeNextUpdateTime(now),
+                              now + kConnectionUpdateMaxIntervalMs);
+  int64_t bucket = deadline - deadline % kConnectionUpdateBucketMs;
+  connection_update_buckets_[bucket].push_back(conn);
+  connection_update_deadlines_[conn] = bucket;
+}
+
+void P2PTransportChannel::UnscheduleConnectionUpdate(Connection* conn) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  auto it = connection_update_deadlines_.find(conn);
+  if (it == connection_update_deadlines_.end()) {
+    return;
+  }
+  auto bucket_it = connection_update_buckets_.find(it->second);
+  RTC_DCHECK(bucket_it != connection_update_buckets_.end());
+  std::vector<Connection*>& bucket = bucket_it->second;
+  bucket.erase(absl::c_find(bucket, conn));
+  if (bucket.empty()) {
+    connection_update_buckets_.erase(bucket_it);
+  }
+  connection_update_deadlines_.erase(it);
+}
+
 // Prepare for best candidate sorting.
 void P2PTransportChannel::RequestSortAndStateUpdate(
     const std::string& reason_to_sort) {
   RTC_DCHECK_RUN_ON(network_thread_);
+  // Upgrades any queued incremental re-sort to a full sort.
+  full_resort_requested_ = true;
   if (!sort_dirty_) {
     invoker_.AsyncInvoke<void>(
         RTC_FROM_HERE, thread(),
@@ -1558,6 +1615,20 @@ void P2PTransportChannel::RequestSortAndStateUpdate(
   }
 }
 
+void P2PTransportChannel::RequestConnectionResortAndStateUpdate(
+    Connection* conn,
+    const std::string& reason) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  connections_to_resort_.insert(conn);
+  if (!sort_dirty_) {
+    invoker_.AsyncInvoke<void>(
+        RTC_FROM_HERE, thread(),
+        rtc::Bind(&P2PTransportChannel::ResortConnectionsAndUpdateState, this,
+                  reason));
+    sort_dirty_ = true;
+  }
+}
+
 void P2PTransportChannel::MaybeStartPinging() {
   RTC_DCHECK_RUN_ON(network_thread_);
   if (started_pinging_) {
@@ -1787,6 +1858,18 @@ bool P2PTransportChannel::PresumedWritable(const Connection* conn) const {
            conn->remote_candidate().type() == PRFLX_PORT_TYPE));
 }
 
+bool P2PTransportChannel::ShouldOrderConnectionBefore(
+    const Connection* a,
+    const Connection* b) const {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
+  if (cmp != 0) {
+    return cmp > 0;
+  }
+  // Otherwise, sort based on latency estimate.
+  return a->rtt() < b->rtt();
+}
+
 // Sort the available connections to find the best one.  We also monitor
 // the number of available connections and the current state.
 void P2PTransportChannel::SortConnectionsAndUpdateState(
@@ -1799,6 +1882,9 @@ void P2PTransportChannel::SortConnectionsAndUpdateState(
 
   // Any changes after this point will require a re-sort.
   sort_dirty_ = false;
+  full_resort_requested_ = false;
+  // The full sort supersedes any queued incremental work.
+  connections_to_resort_.clear();
 
   // Find the best alternative connection by sorting.  It is important to note
   // that amongst equal preference, writable connections, this will choose the
@@ -1807,12 +1893,7 @@ void P2PTransportChannel::SortConnectionsAndUpdateState(
   // TODO(honghaiz): Don't sort;  Just use std::max_element in the right places.
   absl::c_stable_sort(
       connections_, [this](const Connection* a, const Connection* b) {
-        int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
-        if (cmp != 0) {
-          return cmp > 0;
-        }
-        // Otherwise, sort based on latency estimate.
-        return a->rtt() < b->rtt();
+        return ShouldOrderConnectionBefore(a, b);
       });
 
   RTC_LOG(LS_VERBOSE) << "Sorting " << connections_.size()
@@ -1821,6 +1902,72 @@ void P2PTransportChannel::SortConnectionsAndUpdateState(
     RTC_LOG(LS_VERBOSE) << connections_[i]->ToString();
   }
 
+  FinishSortAndUpdateState(reason_to_sort);
+}
+
+void P2PTransportChannel::ResortConnectionsAndUpdateState(
+    const std::string& reason_to_sort) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+
+  // A full sort was requested after this task was queued; the incremental
+  // path would not honor it.
+  if (full_resort_requested_) {
+    SortConnectionsAndUpdateState(reason_to_sort);
+    return;
+  }
+
+  // Only refresh the states of the connections that got us here; the states
+  // and therefore the relative order of all other connections are unchanged.
+  // Copy the set first: UpdateState() may destroy a connection, which removes
+  // it from |connections_to_resort_|, or queue additional connections.
+  int64_t now = rtc::TimeMillis();
+  std::vector<Connection*> changed_connections(connections_to_resort_.begin(),
+                                               connections_to_resort_.end());
+  for (Connection* conn : changed_connections) {
+    conn->UpdateState(now);
+    ScheduleConnectionUpdate(conn, now);
+  }
+
+  // Any changes after this point will require another pass.
+  sort_dirty_ = false;
+
+  if (full_resort_requested_) {
+    // A state update above escalated to a full sort (e.g. the selected
+    // connection was destroyed).
+    SortConnectionsAndUpdateState(reason_to_sort);
+    return;
+  }
+
+  while (!connections_to_resort_.empty()) {
+    Connection* conn = *connections_to_resort_.begin();
+    connections_to_resort_.erase(connections_to_resort_.begin());
+    ResortConnection(conn);
+  }
+
+  FinishSortAndUpdateState(reason_to_sort);
+}
+
+void P2PTransportChannel::ResortConnection(Connection* conn) {
+  RTC_DCHECK_RUN_ON(network_thread_);
+  auto it = absl::c_find(connections_, conn);
+  if (it == connections_.end()) {
+    // Destroyed while the re-sort was pending.
+    return;
+  }
+  connections_.erase(it);
+  // upper_bound keeps |conn| after connections it ties with, matching the
+  // stable full sort.
+  auto insert_pos = std::upper_bound(
+      connections_.begin(), connections_.end(), conn,
+      [this](const Connection* a, const Connection* b) {
+        return ShouldOrderConnectionBefore(a, b);
+      });
+  connections_.insert(insert_pos, conn);
+}
+
+void P2PTransportChannel::FinishSortAndUpdateState(
+    const std::string& reason_to_sort) {
+  RTC_DCHECK_RUN_ON(network_thread_);
   Connection* top_connection =
       (connections_.size() > 0) ? connections_[0] : nullptr;
 
@@ -2345,6 +2492,9 @@ void P2PTransportChannel::PingConnection(Connection* conn) {
   conn->set_use_candidate_attr(use_candidate_attr);
   last_ping_sent_ms_ = rtc::TimeMillis();
   conn->Ping(last_ping_sent_ms_);
+  // The ping is a new unanswered request, which moves the connection's next
+  // possible write/receiving timeout earlier.
+  ScheduleConnectionUpdate(conn, last_ping_sent_ms_);
 }
 
 uint32_t P2PTransportChannel::GetNominationAttr(Connection* conn) const {
@@ -2407,9 +2557,15 @@ void P2PTransportChannel::OnConnectionStateChange(Connection* connection) {
   if (strongly_connected && latest_generation) {
     MaybeStopPortAllocatorSessions();
   }
+  // The new state may bring the connection's next possible transition (e.g.
+  // its dead() deadline after being pruned) earlier.
+  ScheduleConnectionUpdate(connection, rtc::TimeMillis());
+
   // We have to unroll the stack before doing this because we may be changing
-  // the state of connections while sorting.
-  RequestSortAndStateUpdate("candidate pair state changed");
+  // the state of connections while sorting. Only this connection's state
+  // changed, so an incremental re-sort is sufficient.
+  RequestConnectionResortAndStateUpdate(connection,
+                                        "candidate pair state changed");
 }
 
 // When a connection is removed, edit it out, and then update our best
@@ -2425,6 +2581,8 @@ void P2PTransportChannel::OnConnectionDestroyed(Connection* connection) {
   RTC_DCHECK(iter != connections_.end());
   pinged_connections_.erase(connection);
   unpinged_connections_.erase(connection);
+  connections_to_resort_.erase(connection);
+  UnscheduleConnectionUpdate(connection);
   connections_.erase(iter);
 
   RTC_LOG(LS_INFO) << ToString() << ": Removed connection " << connection
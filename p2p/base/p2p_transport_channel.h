@@ -230,7 +230,21 @@ class RTC_EXPORT P2PTransportChannel : public IceTransportInternal {
   // Returns true if it's possible to send packets on |connection|.
   bool ReadyToSend(Connection* connection) const;
   void UpdateConnectionStates();
+  // (Re)inserts |conn| into the time-bucketed update schedule at its next
+  // possible state-transition time. Must be called whenever an event gives
+  // the connection a new input that can move that time earlier, e.g. a ping
+  // being sent or a write state change.
+  void ScheduleConnectionUpdate(Connection* conn, int64_t now);
+  void UnscheduleConnectionUpdate(Connection* conn);
   void RequestSortAndStateUpdate(const std::string& reason_to_sort);
+  // Schedules a re-sort limited to |conn|, whose state changed. The relative
+  // order of all other connections cannot have changed, so |conn| is moved to
+  // its new position instead of re-sorting (and re-comparing) the entire
+  // list. Requests are coalesced the same way as full sort requests, and an
+  // intervening RequestSortAndStateUpdate() upgrades the queued work to a
+  // full sort.
+  void RequestConnectionResortAndStateUpdate(Connection* conn,
+                                             const std::string& reason);
   // Start pinging if we haven't already started, and we now have a connection
   // that's pingable.
   void MaybeStartPinging();
@@ -266,7 +280,21 @@ class RTC_EXPORT P2PTransportChannel : public IceTransportInternal {
 
   bool PresumedWritable(const cricket::Connection* conn) const;
 
+  // Returns true if |a| belongs before |b| in |connections_|. This is the
+  // ordering used both by the full sort and by ResortConnection().
+  bool ShouldOrderConnectionBefore(const Connection* a,
+                                   const Connection* b) const;
+
   void SortConnectionsAndUpdateState(const std::string& reason_to_sort);
+  // Incremental counterpart of SortConnectionsAndUpdateState(): moves only
+  // the connections queued in |connections_to_resort_| to their new
+  // positions, then runs the same selection/prune/state update logic.
+  void ResortConnectionsAndUpdateState(const std::string& reason_to_sort);
+  // Moves |conn| to its correct position in the sorted |connections_|.
+  void ResortConnection(Connection* conn);
+  // Selection, pruning and state update steps shared by the full and the
+  // incremental sort paths. |connections_| must be sorted.
+  void FinishSortAndUpdateState(const std::string& reason_to_sort);
   void SwitchSelectedConnection(Connection* conn, const std::string& reason);
   void UpdateState();
   void HandleAllTimedOut();
@@ -447,6 +475,23 @@ class RTC_EXPORT P2PTransportChannel : public IceTransportInternal {
       RTC_GUARDED_BY(network_thread_);
   bool sort_dirty_ RTC_GUARDED_BY(
       network_thread_);  // indicates whether another sort is needed right now
+  // True when a queued sort request must re-sort the full list (config or
+  // candidate set changed) rather than just the connections in
+  // |connections_to_resort_|.
+  bool full_resort_requested_ RTC_GUARDED_BY(network_thread_) = false;
+  // Connections whose state changed since the last sort, to be repositioned
+  // by ResortConnectionsAndUpdateState().
+  std::set<Connection*> connections_to_resort_ RTC_GUARDED_BY(network_thread_);
+  // Time-bucketed schedule of per-connection UpdateState() evaluation, keyed
+  // by deadline rounded down to a fixed bucket width. UpdateConnectionStates()
+  // pops the buckets that are due instead of scanning every connection, which
+  // matters with many idle-but-kept-alive connections.
+  // |connection_update_deadlines_| records each connection's bucket so it can
+  // be removed when rescheduled or destroyed.
+  std::map<int64_t, std::vector<Connection*>> connection_update_buckets_
+      RTC_GUARDED_BY(network_thread_);
+  std::map<Connection*, int64_t> connection_update_deadlines_
+      RTC_GUARDED_BY(network_thread_);
   bool had_connection_ RTC_GUARDED_BY(network_thread_) =
       false;  // if connections_ has ever been nonempty
   typedef std::map<rtc::Socket::Option, int> OptionMap;
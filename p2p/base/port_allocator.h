@@ -88,6 +88,14 @@ enum {
   // Exclude link-local network interfaces
   // from considertaion after adapter enumeration.
   PORTALLOCATOR_DISABLE_LINK_LOCAL_NETWORKS = 0x10000,
+
+  // Run all allocation phases (UDP/STUN/relay/TCP) immediately instead of
+  // stepping through them with a delay between phases. Relay ports for all
+  // configured TURN servers are created - and their hostnames resolved - at
+  // the same time as the local UDP ports, which shortens time-to-first-
+  // candidate at the cost of a burst of socket and DNS activity when
+  // gathering starts.
+  PORTALLOCATOR_ENABLE_PARALLEL_ALLOCATION = 0x20000,
 };
 
 // Defines various reasons that have caused ICE regathering.
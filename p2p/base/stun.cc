@@ -42,6 +42,29 @@ uint32_t ReduceTransactionId(const std::string& transaction_id) {
   return result;
 }
 
+// Returns a thread-local SHA-1 HMAC context keyed with |password|, or null if
+// SHA-1 is unavailable. The keyed context is cached, so consecutive
+// verifications under the same ICE password - many packets per connection in
+// practice - skip both digest construction and re-keying.
+rtc::HmacContext* GetSha1HmacContextForPassword(const std::string& password) {
+  thread_local rtc::HmacContext* context = nullptr;
+  thread_local std::string* context_password = nullptr;
+  if (!context) {
+    context = new rtc::HmacContext(rtc::DIGEST_SHA_1);
+  }
+  if (!context_password || *context_password != password) {
+    if (!context->SetKey(password.data(), password.size())) {
+      return nullptr;
+    }
+    if (!context_password) {
+      context_password = new std::string(password);
+    } else {
+      *context_password = password;
+    }
+  }
+  return context;
+}
+
 }  // namespace
 
 namespace cricket {
@@ -69,6 +92,7 @@ StunMessage::StunMessage()
     : type_(0),
       length_(0),
       transaction_id_(EMPTY_TRANSACTION_ID),
+      view_data_(nullptr),
       stun_magic_cookie_(kStunMagicCookie) {
   RTC_DCHECK(IsValidTransactionId(transaction_id_));
 }
@@ -123,6 +147,30 @@ std::unique_ptr<StunAttribute> StunMessage::RemoveAttribute(int type) {
       break;
     }
   }
+  if (!attribute) {
+    // Attributes added after a view-based parse live in |attrs_| and were
+    // handled above; now check the attributes still recorded as views.
+    for (auto it = attr_views_.rbegin(); it != attr_views_.rend(); ++it) {
+      if (it->type == type) {
+        attribute = CreateAttributeFromView(*it);
+        if (!attribute) {
+          // Malformed value; leave the message unchanged.
+          break;
+        }
+        attr_views_.erase(std::next(it).base());
+        // Drop any cached materialization so a stale object can't be
+        // returned for an attribute that is no longer in the message.
+        for (auto cached = materialized_attrs_.begin();
+             cached != materialized_attrs_.end(); ++cached) {
+          if ((*cached)->type() == type) {
+            materialized_attrs_.erase(cached);
+            break;
+          }
+        }
+        break;
+      }
+    }
+  }
   if (attribute) {
     attribute->SetOwner(nullptr);
     size_t attr_length = attribute->length();
@@ -227,28 +275,37 @@ bool StunMessage::ValidateMessageIntegrity(const char* data,
 
   // Getting length of the message to calculate Message Integrity.
   size_t mi_pos = current_pos;
-  std::unique_ptr<char[]> temp_data(new char[current_pos]);
-  memcpy(temp_data.get(), data, current_pos);
+  rtc::HmacContext* hmac_context = GetSha1HmacContextForPassword(password);
+  if (!hmac_context) {
+    return false;
+  }
+  hmac_context->Start();
   if (size > mi_pos + kStunAttributeHeaderSize + kStunMessageIntegritySize) {
     // Stun message has other attributes after message integrity.
-    // Adjust the length parameter in stun message to calculate HMAC.
+    // Adjust the length parameter in stun message to calculate HMAC by
+    // feeding a rewritten Message Length field in place of the original one;
+    // the rest of the message is hashed straight out of |data|.
     size_t extra_offset =
         size - (mi_pos + kStunAttributeHeaderSize + kStunMessageIntegritySize);
     size_t new_adjusted_len = size - extra_offset - kStunHeaderSize;
 
-    // Writing new length of the STUN message @ Message Length in temp buffer.
+    // New length of the STUN message @ Message Length in the header.
     //      0                   1                   2                   3
     //      0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
     //     |0 0|     STUN Message Type     |         Message Length        |
     //     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-    rtc::SetBE16(temp_data.get() + 2, static_cast<uint16_t>(new_adjusted_len));
+    char adjusted_length[2];
+    rtc::SetBE16(adjusted_length, static_cast<uint16_t>(new_adjusted_len));
+    hmac_context->Update(data, 2);
+    hmac_context->Update(adjusted_length, sizeof(adjusted_length));
+    hmac_context->Update(data + 4, mi_pos - 4);
+  } else {
+    hmac_context->Update(data, mi_pos);
   }
 
   char hmac[kStunMessageIntegritySize];
-  size_t ret =
-      rtc::ComputeHmac(rtc::DIGEST_SHA_1, password.c_str(), password.size(),
-                       temp_data.get(), mi_pos, hmac, sizeof(hmac));
+  size_t ret = hmac_context->Finish(hmac, sizeof(hmac));
   RTC_DCHECK(ret == sizeof(hmac));
   if (ret != sizeof(hmac))
     return false;
@@ -258,6 +315,18 @@ bool StunMessage::ValidateMessageIntegrity(const char* data,
                 sizeof(hmac)) == 0;
 }
 
+void StunMessage::ValidateMessageIntegrityBatch(const PacketView* packets,
+                                                size_t num_packets,
+                                                const std::string& password,
+                                                bool* results) {
+  // The per-thread HMAC context is keyed on the first packet and reused for
+  // the rest of the batch.
+  for (size_t i = 0; i < num_packets; ++i) {
+    results[i] =
+        ValidateMessageIntegrity(packets[i].data, packets[i].size, password);
+  }
+}
+
 bool StunMessage::AddMessageIntegrity(const std::string& password) {
   return AddMessageIntegrity(password.c_str(), password.size());
 }
@@ -382,6 +451,9 @@ bool StunMessage::Read(ByteBufferReader* buf) {
     return false;
 
   attrs_.resize(0);
+  attr_views_.clear();
+  materialized_attrs_.clear();
+  view_data_ = nullptr;
 
   size_t rest = buf->Length() - length_;
   while (buf->Length() > rest) {
@@ -411,6 +483,85 @@ bool StunMessage::Read(ByteBufferReader* buf) {
   return true;
 }
 
+bool StunMessage::ReadViews(ByteBufferReader* buf) {
+  // Remember where the message starts in the caller's buffer; attribute
+  // views are recorded as offsets from this point.
+  const char* data = buf->Data();
+  const size_t size = buf->Length();
+
+  if (!buf->ReadUInt16(&type_))
+    return false;
+
+  if (type_ & 0x8000) {
+    // RTP and RTCP set the MSB of first byte, since first two bits are version,
+    // and version is always 2 (10). If set, this is not a STUN packet.
+    return false;
+  }
+
+  if (!buf->ReadUInt16(&length_))
+    return false;
+
+  std::string magic_cookie;
+  if (!buf->ReadString(&magic_cookie, kStunMagicCookieLength))
+    return false;
+
+  std::string transaction_id;
+  if (!buf->ReadString(&transaction_id, kStunTransactionIdLength))
+    return false;
+
+  uint32_t magic_cookie_int;
+  static_assert(sizeof(magic_cookie_int) == kStunMagicCookieLength,
+                "Integer size mismatch: magic_cookie_int and kStunMagicCookie");
+  std::memcpy(&magic_cookie_int, magic_cookie.data(), sizeof(magic_cookie_int));
+  if (rtc::NetworkToHost32(magic_cookie_int) != kStunMagicCookie) {
+    // If magic cookie is invalid it means that the peer implements
+    // RFC3489 instead of RFC5389.
+    transaction_id.insert(0, magic_cookie);
+  }
+  RTC_DCHECK(IsValidTransactionId(transaction_id));
+  transaction_id_ = transaction_id;
+  reduced_transaction_id_ = ReduceTransactionId(transaction_id_);
+
+  if (length_ != buf->Length())
+    return false;
+
+  attrs_.resize(0);
+  attr_views_.clear();
+  materialized_attrs_.clear();
+  view_data_ = data;
+
+  size_t rest = buf->Length() - length_;
+  while (buf->Length() > rest) {
+    uint16_t attr_type, attr_length;
+    if (!buf->ReadUInt16(&attr_type))
+      return false;
+    if (!buf->ReadUInt16(&attr_length))
+      return false;
+
+    size_t offset = size - buf->Length();
+    uint16_t padded_length = attr_length;
+    if ((padded_length % 4) != 0) {
+      padded_length += (4 - (padded_length % 4));
+    }
+    if (!buf->Consume(padded_length))
+      return false;
+
+    // Record a view only for attributes that CreateAttribute() would accept;
+    // the rest are skipped, as in Read().
+    if (GetAttributeValueType(attr_type) != STUN_VALUE_UNKNOWN ||
+        DesignatedExpertRange(attr_type)) {
+      AttributeView view;
+      view.type = attr_type;
+      view.length = attr_length;
+      view.offset = static_cast<uint32_t>(offset);
+      attr_views_.push_back(view);
+    }
+  }
+
+  RTC_DCHECK(buf->Length() == rest);
+  return true;
+}
+
 bool StunMessage::Write(ByteBufferWriter* buf) const {
   buf->WriteUInt16(type_);
   buf->WriteUInt16(length_);
@@ -418,6 +569,18 @@ bool StunMessage::Write(ByteBufferWriter* buf) const {
     buf->WriteUInt32(stun_magic_cookie_);
   buf->WriteString(transaction_id_);
 
+  // Attributes parsed by ReadViews() precede any added afterwards, and are
+  // serialized straight from the original buffer.
+  for (const AttributeView& view : attr_views_) {
+    buf->WriteUInt16(view.type);
+    buf->WriteUInt16(view.length);
+    buf->WriteBytes(view_data_ + view.offset, view.length);
+    if (view.length % 4 != 0) {
+      char zeroes[4] = {0};
+      buf->WriteBytes(zeroes, 4 - view.length % 4);
+    }
+  }
+
   for (const auto& attr : attrs_) {
     buf->WriteUInt16(attr->type());
     buf->WriteUInt16(static_cast<uint16_t>(attr->length()));
@@ -487,6 +650,13 @@ StunAttribute* StunMessage::CreateAttribute(int type, size_t length) /*const*/ {
 }
 
 const StunAttribute* StunMessage::GetAttribute(int type) const {
+  // Views, when present, hold the attributes that arrived on the wire, so
+  // they are searched before attributes added to the message afterwards.
+  for (const AttributeView& view : attr_views_) {
+    if (view.type == type) {
+      return MaterializeAttributeView(view);
+    }
+  }
   for (const auto& attr : attrs_) {
     if (attr->type() == type) {
       return attr.get();
@@ -495,6 +665,40 @@ const StunAttribute* StunMessage::GetAttribute(int type) const {
   return NULL;
 }
 
+std::unique_ptr<StunAttribute> StunMessage::CreateAttributeFromView(
+    const AttributeView& view) const {
+  // CreateAttribute() is conceptually const but passes |this| as the
+  // non-const owner of XOR-address attributes.
+  std::unique_ptr<StunAttribute> attr(
+      const_cast<StunMessage*>(this)->CreateAttribute(view.type, view.length));
+  // ReadViews() only records attributes that CreateAttribute() accepts.
+  RTC_DCHECK(attr);
+  uint16_t padded_length = view.length;
+  if ((padded_length % 4) != 0) {
+    padded_length += (4 - (padded_length % 4));
+  }
+  ByteBufferReader reader(view_data_ + view.offset, padded_length);
+  if (!attr->Read(&reader)) {
+    return nullptr;
+  }
+  return attr;
+}
+
+const StunAttribute* StunMessage::MaterializeAttributeView(
+    const AttributeView& view) const {
+  for (const auto& attr : materialized_attrs_) {
+    if (attr->type() == view.type) {
+      return attr.get();
+    }
+  }
+  std::unique_ptr<StunAttribute> attr = CreateAttributeFromView(view);
+  if (!attr) {
+    return NULL;
+  }
+  materialized_attrs_.push_back(std::move(attr));
+  return materialized_attrs_.back().get();
+}
+
 bool StunMessage::IsValidTransactionId(const std::string& transaction_id) {
   return transaction_id.size() == kStunTransactionIdLength ||
          transaction_id.size() == kStunLegacyTransactionIdLength;
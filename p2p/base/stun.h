@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "rtc_base/byte_buffer.h"
 #include "rtc_base/ip_address.h"
 #include "rtc_base/socket_address.h"
@@ -179,6 +180,18 @@ class StunMessage {
   static bool ValidateMessageIntegrity(const char* data,
                                        size_t size,
                                        const std::string& password);
+  // Batched version of ValidateMessageIntegrity() for receive paths that
+  // drain several packets from the socket in one go (e.g. recvmmsg). All
+  // packets are verified against the same password with the HMAC keyed only
+  // once; |results[i]| receives the verdict for |packets[i]|.
+  struct PacketView {
+    const char* data;
+    size_t size;
+  };
+  static void ValidateMessageIntegrityBatch(const PacketView* packets,
+                                            size_t num_packets,
+                                            const std::string& password,
+                                            bool* results);
   // Adds a MESSAGE-INTEGRITY attribute that is valid for the current message.
   bool AddMessageIntegrity(const std::string& password);
   bool AddMessageIntegrity(const char* key, size_t keylen);
@@ -193,6 +206,16 @@ class StunMessage {
   // return value indicates whether this was successful.
   bool Read(rtc::ByteBufferReader* buf);
 
+  // Like Read(), but does not copy attribute payloads out of the buffer.
+  // Instead, each attribute is recorded as a (type, offset, length) view over
+  // the buffer, and the Get* accessors materialize an attribute object the
+  // first time that attribute is requested. Attribute framing is validated
+  // here; malformed attribute values are only detected on first access, where
+  // the accessor returns null. The buffer that |buf| reads from must outlive
+  // this message and must not be modified while the message is alive; use
+  // Read() when that cannot be guaranteed.
+  bool ReadViews(rtc::ByteBufferReader* buf);
+
   // Writes this object into a STUN packet. The return value indicates whether
   // this was successful.
   bool Write(rtc::ByteBufferWriter* buf) const;
@@ -209,8 +232,25 @@ class StunMessage {
   virtual StunAttributeValueType GetAttributeValueType(int type) const;
 
  private:
+  // An attribute parsed by ReadViews() that has not been materialized yet:
+  // |offset| is the offset of the attribute value from the start of the
+  // message, in the buffer passed to ReadViews().
+  struct AttributeView {
+    uint16_t type;
+    uint16_t length;
+    uint32_t offset;
+  };
+
+  // Most STUN messages carry only a handful of attributes; keeping this many
+  // view records inline avoids a heap allocation per parsed message.
+  static constexpr size_t kInlineAttributeViews = 8;
+
   StunAttribute* CreateAttribute(int type, size_t length) /* const*/;
   const StunAttribute* GetAttribute(int type) const;
+  std::unique_ptr<StunAttribute> CreateAttributeFromView(
+      const AttributeView& view) const;
+  const StunAttribute* MaterializeAttributeView(const AttributeView& view)
+      const;
   static bool IsValidTransactionId(const std::string& transaction_id);
 
   uint16_t type_;
@@ -218,6 +258,13 @@ class StunMessage {
   std::string transaction_id_;
   uint32_t reduced_transaction_id_;
   std::vector<std::unique_ptr<StunAttribute>> attrs_;
+  // State for messages parsed with ReadViews(). |view_data_| points at the
+  // start of the message in the caller's buffer and is not owned.
+  // |materialized_attrs_| caches attributes that have been materialized from
+  // |attr_views_|, so repeated Get* calls parse each value at most once.
+  const char* view_data_;
+  absl::InlinedVector<AttributeView, kInlineAttributeViews> attr_views_;
+  mutable std::vector<std::unique_ptr<StunAttribute>> materialized_attrs_;
   uint32_t stun_magic_cookie_;
 };
 
@@ -731,6 +731,92 @@ TEST_F(StunTest, ReadLegacyMessage) {
                             test_address);
 }
 
+// Parse the RFC5769 sample request with ReadViews() and verify that the
+// lazily materialized attributes match the eagerly parsed ones.
+TEST_F(StunTest, ReadViewsRfc5769RequestMessage) {
+  StunMessage msg;
+  const char* input = reinterpret_cast<const char*>(kRfc5769SampleRequest);
+  rtc::ByteBufferReader buf(input, sizeof(kRfc5769SampleRequest));
+  ASSERT_TRUE(msg.ReadViews(&buf));
+  CheckStunHeader(msg, STUN_BINDING_REQUEST,
+                  sizeof(kRfc5769SampleRequest) - kStunHeaderSize);
+  CheckStunTransactionID(msg, kRfc5769SampleMsgTransactionId,
+                         kStunTransactionIdLength);
+
+  const StunByteStringAttribute* software =
+      msg.GetByteString(STUN_ATTR_SOFTWARE);
+  ASSERT_TRUE(software != NULL);
+  EXPECT_EQ(kRfc5769SampleMsgClientSoftware, software->GetString());
+
+  const StunByteStringAttribute* username =
+      msg.GetByteString(STUN_ATTR_USERNAME);
+  ASSERT_TRUE(username != NULL);
+  EXPECT_EQ(kRfc5769SampleMsgUsername, username->GetString());
+
+  const StunUInt32Attribute* fingerprint = msg.GetUInt32(STUN_ATTR_FINGERPRINT);
+  ASSERT_TRUE(fingerprint != NULL);
+  EXPECT_EQ(0xe57a3bcf, fingerprint->value());
+
+  // Repeated lookups must return the same materialized attribute.
+  EXPECT_EQ(username, msg.GetByteString(STUN_ATTR_USERNAME));
+}
+
+// XOR-address attributes need the owning message's transaction ID when they
+// are materialized, so exercise that path through ReadViews().
+TEST_F(StunTest, ReadViewsMessageWithIPv6XorAddressAttribute) {
+  StunMessage msg;
+  const char* input =
+      reinterpret_cast<const char*>(kStunMessageWithIPv6XorMappedAddress);
+  rtc::ByteBufferReader buf(input,
+                            sizeof(kStunMessageWithIPv6XorMappedAddress));
+  ASSERT_TRUE(msg.ReadViews(&buf));
+
+  rtc::IPAddress test_address(kIPv6TestAddress1);
+  const StunAddressAttribute* addr =
+      msg.GetAddress(STUN_ATTR_XOR_MAPPED_ADDRESS);
+  ASSERT_TRUE(addr != NULL);
+  CheckStunAddressAttribute(addr, STUN_ADDRESS_IPV6, kTestMessagePort1,
+                            test_address);
+}
+
+// A message parsed with ReadViews() must serialize to the same bytes as one
+// parsed with Read().
+TEST_F(StunTest, WriteViewParsedMessage) {
+  const char* input =
+      reinterpret_cast<const char*>(kStunMessageWithIPv4MappedAddress);
+
+  StunMessage eager;
+  rtc::ByteBufferReader buf1(input, sizeof(kStunMessageWithIPv4MappedAddress));
+  ASSERT_TRUE(eager.Read(&buf1));
+  rtc::ByteBufferWriter expected;
+  ASSERT_TRUE(eager.Write(&expected));
+
+  StunMessage lazy;
+  rtc::ByteBufferReader buf2(input, sizeof(kStunMessageWithIPv4MappedAddress));
+  ASSERT_TRUE(lazy.ReadViews(&buf2));
+  rtc::ByteBufferWriter actual;
+  ASSERT_TRUE(lazy.Write(&actual));
+
+  ASSERT_EQ(expected.Length(), actual.Length());
+  EXPECT_EQ(0, memcmp(expected.Data(), actual.Data(), actual.Length()));
+}
+
+TEST_F(StunTest, RemoveAttributeFromViewParsedMessage) {
+  StunMessage msg;
+  const char* input = reinterpret_cast<const char*>(kRfc5769SampleRequest);
+  rtc::ByteBufferReader buf(input, sizeof(kRfc5769SampleRequest));
+  ASSERT_TRUE(msg.ReadViews(&buf));
+
+  size_t len = msg.length();
+  auto attr = msg.RemoveAttribute(STUN_ATTR_USERNAME);
+  ASSERT_NE(attr, nullptr);
+  EXPECT_EQ(attr->type(), STUN_ATTR_USERNAME);
+  EXPECT_EQ(kRfc5769SampleMsgUsername,
+            static_cast<StunByteStringAttribute*>(attr.get())->GetString());
+  EXPECT_LT(msg.length(), len);
+  EXPECT_EQ(msg.GetByteString(STUN_ATTR_USERNAME), nullptr);
+}
+
 TEST_F(StunTest, SetIPv6XorAddressAttributeOwner) {
   StunMessage msg;
   StunMessage msg2;
@@ -1230,6 +1316,31 @@ TEST_F(StunTest, ValidateMessageIntegrity) {
   }
 }
 
+// Check the batch variant against the same RFC5769 test messages, including
+// a mix of valid and tampered packets in one batch.
+TEST_F(StunTest, ValidateMessageIntegrityBatch) {
+  char tampered[sizeof(kRfc5769SampleRequest)];
+  memcpy(tampered, kRfc5769SampleRequest, sizeof(tampered));
+  tampered[kStunHeaderSize] ^= 0x01;
+
+  StunMessage::PacketView packets[] = {
+      {reinterpret_cast<const char*>(kRfc5769SampleRequest),
+       sizeof(kRfc5769SampleRequest)},
+      {tampered, sizeof(tampered)},
+      {reinterpret_cast<const char*>(kRfc5769SampleResponse),
+       sizeof(kRfc5769SampleResponse)},
+      {reinterpret_cast<const char*>(kRfc5769SampleResponseIPv6),
+       sizeof(kRfc5769SampleResponseIPv6)},
+  };
+  bool results[arraysize(packets)];
+  StunMessage::ValidateMessageIntegrityBatch(
+      packets, arraysize(packets), kRfc5769SampleMsgPassword, results);
+  EXPECT_TRUE(results[0]);
+  EXPECT_FALSE(results[1]);
+  EXPECT_TRUE(results[2]);
+  EXPECT_TRUE(results[3]);
+}
+
 // Validate that we generate correct MESSAGE-INTEGRITY attributes.
 // Note the use of IceMessage instead of StunMessage; this is necessary because
 // the RFC5769 test messages used include attributes not found in basic STUN.
@@ -10,6 +10,8 @@
 
 #include "p2p/base/turn_port.h"
 
+#include <string.h>
+
 #include <functional>
 #include <utility>
 #include <vector>
@@ -1770,35 +1772,46 @@ int TurnEntry::Send(const void* data,
                     size_t size,
                     bool payload,
                     const rtc::PacketOptions& options) {
-  rtc::ByteBufferWriter buf;
-  if (state_ != STATE_BOUND ||
-      !port_->TurnCustomizerAllowChannelData(data, size, payload)) {
-    // If we haven't bound the channel yet, we have to use a Send Indication.
-    // The turn_customizer_ can also make us use Send Indication.
-    TurnMessage msg;
-    msg.SetType(TURN_SEND_INDICATION);
-    msg.SetTransactionID(rtc::CreateRandomString(kStunTransactionIdLength));
-    msg.AddAttribute(absl::make_unique<StunXorAddressAttribute>(
-        STUN_ATTR_XOR_PEER_ADDRESS, ext_addr_));
-    msg.AddAttribute(
-        absl::make_unique<StunByteStringAttribute>(STUN_ATTR_DATA, data, size));
-
-    port_->TurnCustomizerMaybeModifyOutgoingStunMessage(&msg);
-
-    const bool success = msg.Write(&buf);
-    RTC_DCHECK(success);
-
-    // If we're sending real data, request a channel bind that we can use later.
-    if (state_ == STATE_UNBOUND && payload) {
-      SendChannelBindRequest(0);
-      state_ = STATE_BINDING;
-    }
-  } else {
+  if (state_ == STATE_BOUND &&
+      port_->TurnCustomizerAllowChannelData(data, size, payload)) {
     // If the channel is bound, we can send the data as a Channel Message.
-    buf.WriteUInt16(channel_id_);
-    buf.WriteUInt16(static_cast<uint16_t>(size));
-    buf.WriteBytes(reinterpret_cast<const char*>(data), size);
+    // Frame it in a scratch buffer reused across sends: the 4-byte header is
+    // written in front of a single copy of the payload, with no per-packet
+    // allocation once the buffer has grown to steady-state capacity.
+    rtc::Buffer& buf = port_->channel_data_buffer_;
+    buf.SetSize(TURN_CHANNEL_HEADER_SIZE + size);
+    rtc::SetBE16(buf.data(), static_cast<uint16_t>(channel_id_));
+    rtc::SetBE16(buf.data() + 2, static_cast<uint16_t>(size));
+    memcpy(buf.data() + TURN_CHANNEL_HEADER_SIZE, data, size);
+
+    rtc::PacketOptions modified_options(options);
+    modified_options.info_signaled_after_sent.turn_overhead_bytes =
+        TURN_CHANNEL_HEADER_SIZE;
+    return port_->Send(buf.data(), buf.size(), modified_options);
+  }
+
+  // If we haven't bound the channel yet, we have to use a Send Indication.
+  // The turn_customizer_ can also make us use Send Indication.
+  rtc::ByteBufferWriter buf;
+  TurnMessage msg;
+  msg.SetType(TURN_SEND_INDICATION);
+  msg.SetTransactionID(rtc::CreateRandomString(kStunTransactionIdLength));
+  msg.AddAttribute(absl::make_unique<StunXorAddressAttribute>(
+      STUN_ATTR_XOR_PEER_ADDRESS, ext_addr_));
+  msg.AddAttribute(
+      absl::make_unique<StunByteStringAttribute>(STUN_ATTR_DATA, data, size));
+
+  port_->TurnCustomizerMaybeModifyOutgoingStunMessage(&msg);
+
+  const bool success = msg.Write(&buf);
+  RTC_DCHECK(success);
+
+  // If we're sending real data, request a channel bind that we can use later.
+  if (state_ == STATE_UNBOUND && payload) {
+    SendChannelBindRequest(0);
+    state_ = STATE_BINDING;
   }
+
   rtc::PacketOptions modified_options(options);
   modified_options.info_signaled_after_sent.turn_overhead_bytes =
       buf.Length() - size;
@@ -25,6 +25,7 @@
 #include "p2p/client/basic_port_allocator.h"
 #include "rtc_base/async_invoker.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/ssl_certificate.h"
 
 namespace webrtc {
@@ -379,6 +380,10 @@ class TurnPort : public Port {
   int next_channel_number_;
   EntryList entries_;
 
+  // Scratch buffer reused by TurnEntry::Send to frame outgoing ChannelData
+  // messages, so the bound-channel fast path does not allocate per packet.
+  rtc::Buffer channel_data_buffer_;
+
   PortState state_;
   // By default the value will be set to 0. This value will be used in
   // calculating the candidate priority.
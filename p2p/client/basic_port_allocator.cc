@@ -1370,6 +1370,22 @@ void AllocationSequence::OnMessage(rtc::Message* msg) {
 
   const char* const PHASE_NAMES[kNumPhases] = {"Udp", "Relay", "Tcp"};
 
+  if (IsFlagSet(PORTALLOCATOR_ENABLE_PARALLEL_ALLOCATION)) {
+    // Fire every phase at once; the relay ports start resolving and
+    // contacting all configured TURN servers concurrently with the local
+    // UDP/STUN allocation.
+    RTC_LOG(LS_INFO) << network_->ToString()
+                     << ": Running all allocation phases in parallel";
+    CreateUDPPorts();
+    CreateStunPorts();
+    CreateRelayPorts();
+    CreateTCPPorts();
+    state_ = kCompleted;
+    session_->network_thread()->Clear(this, MSG_ALLOCATION_PHASE);
+    SignalPortAllocationComplete(this);
+    return;
+  }
+
   // Perform all of the phases in the current step.
   RTC_LOG(LS_INFO) << network_->ToString()
                    << ": Allocation Phase=" << PHASE_NAMES[phase_];
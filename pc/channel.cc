@@ -525,20 +525,41 @@ void BaseChannel::OnPacketReceived(bool rtcp,
     return;
   }
 
-  invoker_.AsyncInvoke<void>(
-      RTC_FROM_HERE, worker_thread_,
-      Bind(&BaseChannel::ProcessPacket, this, rtcp, packet, packet_time_us));
+  // Coalesce the cross-thread handoff: queue the packet, and only post a
+  // drain task if one isn't already pending. Under load many packets ride on
+  // a single worker wakeup instead of paying an allocation and a wakeup each.
+  bool post_task = false;
+  {
+    rtc::CritScope cs(&pending_packets_lock_);
+    pending_packets_.push_back({rtcp, packet, packet_time_us});
+    if (!pending_packets_task_queued_) {
+      pending_packets_task_queued_ = true;
+      post_task = true;
+    }
+  }
+  if (post_task) {
+    invoker_.AsyncInvoke<void>(
+        RTC_FROM_HERE, worker_thread_,
+        Bind(&BaseChannel::ProcessPendingPackets_w, this));
+  }
 }
 
-void BaseChannel::ProcessPacket(bool rtcp,
-                                const rtc::CopyOnWriteBuffer& packet,
-                                int64_t packet_time_us) {
+void BaseChannel::ProcessPendingPackets_w() {
   RTC_DCHECK(worker_thread_->IsCurrent());
 
-  if (rtcp) {
-    media_channel_->OnRtcpReceived(packet, packet_time_us);
-  } else {
-    media_channel_->OnPacketReceived(packet, packet_time_us);
+  std::vector<PendingPacket> packets;
+  {
+    rtc::CritScope cs(&pending_packets_lock_);
+    packets.swap(pending_packets_);
+    pending_packets_task_queued_ = false;
+  }
+  for (const PendingPacket& pending : packets) {
+    if (pending.rtcp) {
+      media_channel_->OnRtcpReceived(pending.packet, pending.packet_time_us);
+    } else {
+      media_channel_->OnPacketReceived(pending.packet,
+                                       pending.packet_time_us);
+    }
   }
 }
 
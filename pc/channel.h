@@ -227,9 +227,10 @@ class BaseChannel : public ChannelInterface,
   void OnPacketReceived(bool rtcp,
                         const rtc::CopyOnWriteBuffer& packet,
                         int64_t packet_time_us);
-  void ProcessPacket(bool rtcp,
-                     const rtc::CopyOnWriteBuffer& packet,
-                     int64_t packet_time_us);
+  // Drains all packets queued by OnPacketReceived() and hands them to the
+  // media channel. Runs on the worker thread; one queued task processes every
+  // packet that arrived since the last drain.
+  void ProcessPendingPackets_w();
 
   void EnableMedia_w();
   void DisableMedia_w();
@@ -298,10 +299,26 @@ class BaseChannel : public ChannelInterface,
   // MediaTransportNetworkChangeCallback override.
   void OnNetworkRouteChanged(const rtc::NetworkRoute& network_route) override;
 
+  // A received packet waiting for its hop to the worker thread.
+  struct PendingPacket {
+    bool rtcp;
+    rtc::CopyOnWriteBuffer packet;
+    int64_t packet_time_us;
+  };
+
   rtc::Thread* const worker_thread_;
   rtc::Thread* const network_thread_;
   rtc::Thread* const signaling_thread_;
   rtc::AsyncInvoker invoker_;
+
+  // Incoming packets are batched here on the network thread, and a single
+  // queued task per burst drains them on the worker thread. This replaces a
+  // task allocation and worker wakeup per packet with one per burst.
+  rtc::CriticalSection pending_packets_lock_;
+  std::vector<PendingPacket> pending_packets_
+      RTC_GUARDED_BY(pending_packets_lock_);
+  bool pending_packets_task_queued_ RTC_GUARDED_BY(pending_packets_lock_) =
+      false;
   sigslot::signal1<ChannelInterface*> SignalFirstPacketReceived_;
 
   const std::string content_name_;
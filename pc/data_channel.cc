@@ -27,6 +27,12 @@ namespace webrtc {
 
 static size_t kMaxQueuedReceivedDataBytes = 16 * 1024 * 1024;
 static size_t kMaxQueuedSendDataBytes = 16 * 1024 * 1024;
+// OnBufferedAmountChange() fires as soon as this many sent bytes have gone
+// unreported; smaller amounts are flushed from a deferred task instead so a
+// burst of small messages costs one observer callback, not one per message.
+static size_t kBufferedAmountChangeCoalesceBytes = 64 * 1024;
+// Upper bound on recycled DataBuffer allocations kept per queue.
+static size_t kMaxPooledPackets = 64;
 
 namespace {
 
@@ -121,8 +127,29 @@ void DataChannel::PacketQueue::PushBack(std::unique_ptr<DataBuffer> packet) {
   packets_.push_back(std::move(packet));
 }
 
+std::unique_ptr<DataBuffer> DataChannel::PacketQueue::TakePooledBuffer() {
+  if (free_packets_.empty()) {
+    return nullptr;
+  }
+  std::unique_ptr<DataBuffer> packet = std::move(free_packets_.back());
+  free_packets_.pop_back();
+  return packet;
+}
+
+void DataChannel::PacketQueue::RecycleBuffer(
+    std::unique_ptr<DataBuffer> packet) {
+  if (free_packets_.size() >= kMaxPooledPackets) {
+    return;
+  }
+  // Drop the payload reference now; the pooled node must not keep the
+  // refcounted payload alive after the message has been consumed.
+  packet->data.Clear();
+  free_packets_.push_back(std::move(packet));
+}
+
 void DataChannel::PacketQueue::Clear() {
   packets_.clear();
+  free_packets_.clear();
   byte_count_ = 0;
 }
 
@@ -426,11 +453,13 @@ void DataChannel::OnDataReceived(const cricket::ReceiveDataParams& params,
   }
 
   bool binary = (params.type == cricket::DMT_BINARY);
-  auto buffer = absl::make_unique<DataBuffer>(payload, binary);
   if (state_ == kOpen && observer_) {
     ++messages_received_;
-    bytes_received_ += buffer->size();
-    observer_->OnMessage(*buffer.get());
+    bytes_received_ += payload.size();
+    // Deliver from the stack; the payload itself is refcounted so this copies
+    // no message bytes.
+    DataBuffer buffer(payload, binary);
+    observer_->OnMessage(buffer);
   } else {
     if (queued_received_data_.byte_count() + payload.size() >
         kMaxQueuedReceivedDataBytes) {
@@ -443,6 +472,14 @@ void DataChannel::OnDataReceived(const cricket::ReceiveDataParams& params,
 
       return;
     }
+    std::unique_ptr<DataBuffer> buffer =
+        queued_received_data_.TakePooledBuffer();
+    if (buffer) {
+      buffer->data = payload;
+      buffer->binary = binary;
+    } else {
+      buffer = absl::make_unique<DataBuffer>(payload, binary);
+    }
     queued_received_data_.PushBack(std::move(buffer));
   }
 }
@@ -467,6 +504,10 @@ void DataChannel::CloseAbruptly() {
     DisconnectFromProvider();
   }
 
+  // Report any sent bytes that were still waiting for a coalesced callback
+  // before the observer learns the channel is closing.
+  FlushBufferedAmountChange();
+
   // Closing abruptly means any queued data gets thrown away.
   queued_send_data_.Clear();
   buffered_amount_ = 0;
@@ -579,6 +620,30 @@ void DataChannel::DeliverQueuedReceivedData() {
     ++messages_received_;
     bytes_received_ += buffer->size();
     observer_->OnMessage(*buffer);
+    queued_received_data_.RecycleBuffer(std::move(buffer));
+  }
+}
+
+void DataChannel::AccumulateSentDataSize(size_t sent_data_size) {
+  unreported_sent_bytes_ += sent_data_size;
+  if (unreported_sent_bytes_ >= kBufferedAmountChangeCoalesceBytes) {
+    FlushBufferedAmountChange();
+  } else if (!buffered_amount_flush_pending_) {
+    buffered_amount_flush_pending_ = true;
+    invoker_.AsyncInvoke<void>(RTC_FROM_HERE, rtc::Thread::Current(),
+                               [this] { FlushBufferedAmountChange(); });
+  }
+}
+
+void DataChannel::FlushBufferedAmountChange() {
+  buffered_amount_flush_pending_ = false;
+  if (unreported_sent_bytes_ == 0) {
+    return;
+  }
+  uint64_t sent_bytes = unreported_sent_bytes_;
+  unreported_sent_bytes_ = 0;
+  if (observer_) {
+    observer_->OnBufferedAmountChange(sent_bytes);
   }
 }
 
@@ -596,6 +661,7 @@ void DataChannel::SendQueuedDataMessages() {
       queued_send_data_.PushFront(std::move(buffer));
       break;
     }
+    queued_send_data_.RecycleBuffer(std::move(buffer));
   }
 }
 
@@ -632,8 +698,8 @@ bool DataChannel::SendDataMessage(const DataBuffer& buffer,
 
     RTC_DCHECK(buffered_amount_ >= buffer.size());
     buffered_amount_ -= buffer.size();
-    if (observer_ && buffer.size() > 0) {
-      observer_->OnBufferedAmountChange(buffer.size());
+    if (buffer.size() > 0) {
+      AccumulateSentDataSize(buffer.size());
     }
     return true;
   }
@@ -663,7 +729,15 @@ bool DataChannel::QueueSendDataMessage(const DataBuffer& buffer) {
     RTC_LOG(LS_ERROR) << "Can't buffer any more data for the data channel.";
     return false;
   }
-  queued_send_data_.PushBack(absl::make_unique<DataBuffer>(buffer));
+  std::unique_ptr<DataBuffer> packet = queued_send_data_.TakePooledBuffer();
+  if (packet) {
+    // Refcounted payload; copies no message bytes.
+    packet->data = buffer.data;
+    packet->binary = buffer.binary;
+  } else {
+    packet = absl::make_unique<DataBuffer>(buffer);
+  }
+  queued_send_data_.PushBack(std::move(packet));
   return true;
 }
 
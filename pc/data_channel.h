@@ -15,6 +15,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "api/data_channel_interface.h"
 #include "api/proxy.h"
@@ -239,12 +240,21 @@ class DataChannel : public DataChannelInterface, public sigslot::has_slots<> {
     void PushFront(std::unique_ptr<DataBuffer> packet);
     void PushBack(std::unique_ptr<DataBuffer> packet);
 
+    // Returns a recycled DataBuffer, or null if the pool is empty. The
+    // returned buffer's contents are unspecified; the caller must overwrite
+    // them. Lets high-rate channels avoid a heap allocation per message.
+    std::unique_ptr<DataBuffer> TakePooledBuffer();
+    // Releases the payload reference of |packet| and returns its allocation
+    // to the pool for reuse by a later TakePooledBuffer() call.
+    void RecycleBuffer(std::unique_ptr<DataBuffer> packet);
+
     void Clear();
 
     void Swap(PacketQueue* other);
 
    private:
     std::deque<std::unique_ptr<DataBuffer>> packets_;
+    std::vector<std::unique_ptr<DataBuffer>> free_packets_;
     size_t byte_count_ = 0;
   };
 
@@ -264,6 +274,13 @@ class DataChannel : public DataChannelInterface, public sigslot::has_slots<> {
 
   void DeliverQueuedReceivedData();
 
+  // Adds |sent_data_size| to the bytes pending an OnBufferedAmountChange()
+  // callback, and either reports them right away (once enough bytes have
+  // accumulated) or schedules a deferred flush so a burst of sends produces a
+  // single observer callback.
+  void AccumulateSentDataSize(size_t sent_data_size);
+  void FlushBufferedAmountChange();
+
   void SendQueuedDataMessages();
   bool SendDataMessage(const DataBuffer& buffer, bool queue_if_blocked);
   bool QueueSendDataMessage(const DataBuffer& buffer);
@@ -284,6 +301,10 @@ class DataChannel : public DataChannelInterface, public sigslot::has_slots<> {
   // Number of bytes of data that have been queued using Send(). Increased
   // before each transport send and decreased after each successful send.
   uint64_t buffered_amount_;
+  // Bytes successfully handed to the transport but not yet reported through
+  // OnBufferedAmountChange(). See AccumulateSentDataSize().
+  uint64_t unreported_sent_bytes_ = 0;
+  bool buffered_amount_flush_pending_ = false;
   cricket::DataChannelType data_channel_type_;
   DataChannelProviderInterface* provider_;
   HandshakeState handshake_state_;
@@ -132,11 +132,19 @@ RTCError JsepTransportController::SetRemoteDescription(
 
 RtpTransportInternal* JsepTransportController::GetRtpTransport(
     const std::string& mid) const {
-  auto jsep_transport = GetJsepTransportForMid(mid);
-  if (!jsep_transport) {
+  // Resolve against the published routing snapshot instead of
+  // |mid_to_transport_|; this is called off the network thread while a
+  // renegotiation on the network thread may be rebuilding that map.
+  rtc::scoped_refptr<MidToRtpTransportSnapshot> snapshot;
+  {
+    rtc::CritScope cs(&mid_snapshot_lock_);
+    snapshot = mid_to_rtp_transport_snapshot_;
+  }
+  if (!snapshot) {
     return nullptr;
   }
-  return jsep_transport->rtp_transport();
+  auto it = snapshot->mid_to_rtp_transport.find(mid);
+  return it == snapshot->mid_to_rtp_transport.end() ? nullptr : it->second;
 }
 
 MediaTransportConfig JsepTransportController::GetMediaTransportConfig(
@@ -867,10 +875,14 @@ bool JsepTransportController::SetTransportForMid(
     cricket::JsepTransport* jsep_transport) {
   RTC_DCHECK(jsep_transport);
   if (mid_to_transport_[mid] == jsep_transport) {
+    // The mapping is unchanged, but the transport selected inside the
+    // JsepTransport may have been renegotiated; refresh the snapshot.
+    PublishMidToRtpTransportSnapshot_n();
     return true;
   }
 
   mid_to_transport_[mid] = jsep_transport;
+  PublishMidToRtpTransportSnapshot_n();
   return config_.transport_observer->OnTransportChanged(
       mid, jsep_transport->rtp_transport(), jsep_transport->RtpDtlsTransport(),
       jsep_transport->media_transport(), jsep_transport->datagram_transport(),
@@ -884,6 +896,18 @@ void JsepTransportController::RemoveTransportForMid(const std::string& mid) {
   // only expected to fail when adding media to a transport (not removing).
   RTC_DCHECK(ret);
   mid_to_transport_.erase(mid);
+  PublishMidToRtpTransportSnapshot_n();
+}
+
+void JsepTransportController::PublishMidToRtpTransportSnapshot_n() {
+  RTC_DCHECK(network_thread_->IsCurrent());
+  rtc::scoped_refptr<MidToRtpTransportSnapshot> snapshot(
+      new rtc::RefCountedObject<MidToRtpTransportSnapshot>());
+  for (const auto& kv : mid_to_transport_) {
+    snapshot->mid_to_rtp_transport[kv.first] = kv.second->rtp_transport();
+  }
+  rtc::CritScope cs(&mid_snapshot_lock_);
+  mid_to_rtp_transport_snapshot_ = std::move(snapshot);
 }
 
 cricket::JsepTransportDescription
@@ -1279,6 +1303,13 @@ void JsepTransportController::DestroyAllJsepTransports_n() {
   }
 
   jsep_transports_by_name_.clear();
+
+  // The routing snapshot would otherwise keep handing out pointers to the
+  // transports destroyed above.
+  {
+    rtc::CritScope cs(&mid_snapshot_lock_);
+    mid_to_rtp_transport_snapshot_ = nullptr;
+  }
 }
 
 void JsepTransportController::SetIceRole_n(cricket::IceRole ice_role) {
@@ -35,6 +35,8 @@
 #include "pc/srtp_transport.h"
 #include "rtc_base/async_invoker.h"
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/ref_count.h"
 #include "rtc_base/ref_counted_object.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 
@@ -303,6 +305,10 @@ class JsepTransportController : public sigslot::has_slots<> {
   bool SetTransportForMid(const std::string& mid,
                           cricket::JsepTransport* jsep_transport);
   void RemoveTransportForMid(const std::string& mid);
+  // Rebuilds and atomically swaps in the MID routing snapshot read by
+  // GetRtpTransport(). Must be called after every change to
+  // |mid_to_transport_|.
+  void PublishMidToRtpTransportSnapshot_n();
 
   cricket::JsepTransportDescription CreateJsepTransportDescription(
       const cricket::ContentInfo& content_info,
@@ -450,6 +456,18 @@ class JsepTransportController : public sigslot::has_slots<> {
   // (BaseChannel/SctpTransport) and the JsepTransport underneath.
   std::map<std::string, cricket::JsepTransport*> mid_to_transport_;
 
+  // Immutable snapshot of the MID to RTP transport routing table. A new
+  // snapshot is published on the network thread whenever the routing changes,
+  // which happens once per negotiation; GetRtpTransport() resolves MIDs
+  // against the current snapshot from any thread without hopping to the
+  // network thread or synchronizing with a renegotiation in progress.
+  struct MidToRtpTransportSnapshot : public rtc::RefCountInterface {
+    std::map<std::string, RtpTransportInternal*> mid_to_rtp_transport;
+  };
+  mutable rtc::CriticalSection mid_snapshot_lock_;
+  rtc::scoped_refptr<MidToRtpTransportSnapshot> mid_to_rtp_transport_snapshot_
+      RTC_GUARDED_BY(mid_snapshot_lock_);
+
   // Aggregate states for Transports.
   // standardized_ice_connection_state_ is intended to replace
   // ice_connection_state, see bugs.webrtc.org/9308
@@ -33,8 +33,10 @@
 #include "pc/srtp_filter.h"
 #include "pc/used_ids.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/helpers.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/strings/string_builder.h"
 #include "rtc_base/third_party/base64/base64.h"
 #include "rtc_base/unique_id_generator.h"
 
@@ -715,11 +717,79 @@ void NegotiatePacketization(const VideoCodec& local_codec,
       VideoCodec::IntersectPacketization(local_codec, remote_codec);
 }
 
+static void AppendCodecExtraFingerprint(const AudioCodec& codec,
+                                        rtc::StringBuilder* sb) {
+  *sb << codec.bitrate << "/" << codec.channels;
+}
+
+static void AppendCodecExtraFingerprint(const VideoCodec& codec,
+                                        rtc::StringBuilder* sb) {
+  if (codec.packetization) {
+    *sb << *codec.packetization;
+  }
+}
+
+static void AppendCodecExtraFingerprint(const RtpDataCodec& codec,
+                                        rtc::StringBuilder* sb) {}
+
+// Appends a stable fingerprint of |codecs| - every field that
+// NegotiateCodecs() reads - to |sb|.
+template <class C>
+static void AppendCodecListFingerprint(const std::vector<C>& codecs,
+                                       rtc::StringBuilder* sb) {
+  for (const C& codec : codecs) {
+    *sb << codec.id << " " << codec.name << " " << codec.clockrate << " ";
+    AppendCodecExtraFingerprint(codec, sb);
+    for (const auto& param : codec.params) {
+      *sb << " " << param.first << "=" << param.second;
+    }
+    for (const FeedbackParam& fb : codec.feedback_params.params()) {
+      *sb << " " << fb.id() << "/" << fb.param();
+    }
+    *sb << "|";
+  }
+}
+
+// Cache of NegotiateCodecs() results. Repeated renegotiations - e.g. an SFU
+// re-offering on every participant join or leave - present the same local and
+// remote codec lists over and over, so keying on their fingerprints turns the
+// recompute into a lookup. NegotiateCodecs() is a pure function of its
+// inputs, which makes memoizing it safe.
+static rtc::CriticalSection* NegotiatedCodecsCacheLock() {
+  static rtc::CriticalSection* const lock = new rtc::CriticalSection();
+  return lock;
+}
+
+template <class C>
+static std::map<std::string, std::vector<C>>* NegotiatedCodecsCache() {
+  static std::map<std::string, std::vector<C>>* const cache =
+      new std::map<std::string, std::vector<C>>();
+  return cache;
+}
+
+// Bounds the cache; entries are cheap, and a renegotiation storm cycles
+// through a handful of keys, so a simple clear-when-full policy suffices.
+static const size_t kMaxNegotiatedCodecsCacheSize = 100;
+
 template <class C>
 static void NegotiateCodecs(const std::vector<C>& local_codecs,
                             const std::vector<C>& offered_codecs,
                             std::vector<C>* negotiated_codecs,
                             bool keep_offer_order) {
+  rtc::StringBuilder key;
+  AppendCodecListFingerprint(local_codecs, &key);
+  key << "#";
+  AppendCodecListFingerprint(offered_codecs, &key);
+  key << "#" << keep_offer_order;
+  {
+    rtc::CritScope cs(NegotiatedCodecsCacheLock());
+    auto* cache = NegotiatedCodecsCache<C>();
+    auto it = cache->find(key.str());
+    if (it != cache->end()) {
+      *negotiated_codecs = it->second;
+      return;
+    }
+  }
   for (const C& ours : local_codecs) {
     C theirs;
     // Note that we intentionally only find one matching codec for each of our
@@ -760,6 +830,14 @@ static void NegotiateCodecs(const std::vector<C>& local_codecs,
       return payload_type_preferences[a.id] > payload_type_preferences[b.id];
     });
   }
+  {
+    rtc::CritScope cs(NegotiatedCodecsCacheLock());
+    auto* cache = NegotiatedCodecsCache<C>();
+    if (cache->size() >= kMaxNegotiatedCodecsCacheSize) {
+      cache->clear();
+    }
+    (*cache)[key.str()] = *negotiated_codecs;
+  }
 }
 
 // Finds a codec in |codecs2| that matches |codec_to_match|, which is
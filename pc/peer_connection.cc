@@ -771,6 +771,7 @@ bool PeerConnectionInterface::RTCConfiguration::operator==(
     bool disable_ipv6_on_wifi;
     int max_ipv6_networks;
     bool disable_link_local_networks;
+    bool parallel_port_allocation;
     bool enable_rtp_data_channel;
     absl::optional<int> screencast_min_bitrate;
     absl::optional<bool> combined_audio_video_bwe;
@@ -838,6 +839,7 @@ bool PeerConnectionInterface::RTCConfiguration::operator==(
          disable_ipv6_on_wifi == o.disable_ipv6_on_wifi &&
          max_ipv6_networks == o.max_ipv6_networks &&
          disable_link_local_networks == o.disable_link_local_networks &&
+         parallel_port_allocation == o.parallel_port_allocation &&
          enable_rtp_data_channel == o.enable_rtp_data_channel &&
          screencast_min_bitrate == o.screencast_min_bitrate &&
          combined_audio_video_bwe == o.combined_audio_video_bwe &&
@@ -5605,6 +5607,11 @@ PeerConnection::InitializePortAllocator_n(
     RTC_LOG(LS_INFO) << "Disable candidates on link-local network interfaces.";
   }
 
+  if (configuration.parallel_port_allocation) {
+    port_allocator_flags |= cricket::PORTALLOCATOR_ENABLE_PARALLEL_ALLOCATION;
+    RTC_LOG(LS_INFO) << "Gathering all candidate types in parallel.";
+  }
+
   port_allocator_->set_flags(port_allocator_flags);
   // No step delay is used while allocating ports.
   port_allocator_->set_step_delay(cricket::kMinimumStepDelay);
@@ -5788,6 +5795,62 @@ RTCError PeerConnection::UpdateSessionState(
   return RTCError::OK();
 }
 
+static bool CryptoParamsListsMatch(
+    const std::vector<cricket::CryptoParams>& a,
+    const std::vector<cricket::CryptoParams>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].tag != b[i].tag || a[i].cipher_suite != b[i].cipher_suite ||
+        a[i].key_params != b[i].key_params ||
+        a[i].session_params != b[i].session_params) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if |old_desc| and |new_desc| would configure a channel
+// identically when pushed down, so re-applying |new_desc| over |old_desc| can
+// be skipped. Conservative: returns false whenever a field without cheap
+// equality (e.g. simulcast) is in use.
+static bool MediaSectionUnchanged(
+    const cricket::MediaContentDescription* old_desc,
+    const cricket::MediaContentDescription* new_desc) {
+  if (old_desc->type() != new_desc->type()) {
+    return false;
+  }
+  if (old_desc->HasSimulcast() || new_desc->HasSimulcast() ||
+      !old_desc->receive_rids().empty() || !new_desc->receive_rids().empty()) {
+    return false;
+  }
+  if (old_desc->protocol() != new_desc->protocol() ||
+      old_desc->direction() != new_desc->direction() ||
+      old_desc->rtcp_mux() != new_desc->rtcp_mux() ||
+      old_desc->rtcp_reduced_size() != new_desc->rtcp_reduced_size() ||
+      old_desc->remote_estimate() != new_desc->remote_estimate() ||
+      old_desc->bandwidth() != new_desc->bandwidth() ||
+      old_desc->conference_mode() != new_desc->conference_mode() ||
+      old_desc->extmap_allow_mixed_enum() !=
+          new_desc->extmap_allow_mixed_enum() ||
+      old_desc->rtp_header_extensions_set() !=
+          new_desc->rtp_header_extensions_set() ||
+      old_desc->rtp_header_extensions() != new_desc->rtp_header_extensions() ||
+      old_desc->streams() != new_desc->streams() ||
+      !CryptoParamsListsMatch(old_desc->cryptos(), new_desc->cryptos())) {
+    return false;
+  }
+  switch (new_desc->type()) {
+    case cricket::MEDIA_TYPE_AUDIO:
+      return old_desc->as_audio()->codecs() == new_desc->as_audio()->codecs();
+    case cricket::MEDIA_TYPE_VIDEO:
+      return old_desc->as_video()->codecs() == new_desc->as_video()->codecs();
+    default:
+      return false;
+  }
+}
+
 RTCError PeerConnection::PushdownMediaDescription(
     SdpType type,
     cricket::ContentSource source) {
@@ -5796,6 +5859,10 @@ RTCError PeerConnection::PushdownMediaDescription(
                                    : remote_description());
   RTC_DCHECK(sdesc);
 
+  std::map<std::string, PushedDownMediaSection>& pushed_down_media =
+      (source == cricket::CS_LOCAL) ? pushed_down_local_media_
+                                    : pushed_down_remote_media_;
+
   // Push down the new SDP media section for each audio/video transceiver.
   for (const auto& transceiver : transceivers_) {
     const ContentInfo* content_info =
@@ -5809,6 +5876,16 @@ RTCError PeerConnection::PushdownMediaDescription(
     if (!content_desc) {
       continue;
     }
+    // Skip the worker-thread invoke if this m= section is identical to what
+    // the channel last applied; a renegotiation that only adds or removes
+    // other participants' sections then costs nothing for this channel.
+    auto pushed = pushed_down_media.find(content_info->name);
+    if (pushed != pushed_down_media.end() &&
+        pushed->second.channel == channel && pushed->second.type == type &&
+        MediaSectionUnchanged(pushed->second.description.get(),
+                              content_desc)) {
+      continue;
+    }
     std::string error;
     bool success = (source == cricket::CS_LOCAL)
                        ? channel->SetLocalContent(content_desc, type, &error)
@@ -5816,6 +5893,10 @@ RTCError PeerConnection::PushdownMediaDescription(
     if (!success) {
       LOG_AND_RETURN_ERROR(RTCErrorType::INVALID_PARAMETER, error);
     }
+    PushedDownMediaSection& entry = pushed_down_media[content_info->name];
+    entry.channel = channel;
+    entry.type = type;
+    entry.description = content_desc->Clone();
   }
 
   // If using the RtpDataChannel, push down the new SDP section for it too.
@@ -7414,6 +7495,19 @@ void PeerConnection::DestroyDataChannel() {
 void PeerConnection::DestroyChannelInterface(
     cricket::ChannelInterface* channel) {
   RTC_DCHECK(channel);
+  // Forget any media sections memoized for this channel, so that a future
+  // channel reusing the same address is not mistaken for it.
+  for (auto* pushed_down_media :
+       {&pushed_down_local_media_, &pushed_down_remote_media_}) {
+    for (auto it = pushed_down_media->begin();
+         it != pushed_down_media->end();) {
+      if (it->second.channel == channel) {
+        it = pushed_down_media->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
   switch (channel->media_type()) {
     case cricket::MEDIA_TYPE_AUDIO:
       channel_manager()->DestroyVoiceChannel(
@@ -1308,6 +1308,20 @@ class PeerConnection : public PeerConnectionInternal,
 
   SessionError session_error_ RTC_GUARDED_BY(signaling_thread()) =
       SessionError::kNone;
+
+  // Media sections most recently pushed down to each channel, keyed by content
+  // name. Lets PushdownMediaDescription() skip the per-channel worker-thread
+  // invoke for m= sections that an offer/answer left unchanged, so applying a
+  // description costs time proportional to the number of changed sections
+  // rather than the total number of transceivers. Accessed on the signaling
+  // thread only.
+  struct PushedDownMediaSection {
+    cricket::ChannelInterface* channel;
+    SdpType type;
+    std::unique_ptr<cricket::MediaContentDescription> description;
+  };
+  std::map<std::string, PushedDownMediaSection> pushed_down_local_media_;
+  std::map<std::string, PushedDownMediaSection> pushed_down_remote_media_;
   std::string session_error_desc_ RTC_GUARDED_BY(signaling_thread());
 
   std::string session_id_ RTC_GUARDED_BY(signaling_thread());
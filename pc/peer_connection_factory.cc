@@ -237,12 +237,50 @@ PeerConnectionFactory::CreatePeerConnection(
   return CreatePeerConnection(configuration, std::move(dependencies));
 }
 
+void PeerConnectionFactory::PrewarmCertificates(size_t count) {
+  RTC_DCHECK(signaling_thread_->IsCurrent());
+  rtc::scoped_refptr<PeerConnectionFactory> self(this);
+  for (size_t i = 0; i < count; ++i) {
+    worker_thread_->PostTask(RTC_FROM_HERE, [self]() {
+      rtc::scoped_refptr<rtc::RTCCertificate> certificate =
+          rtc::RTCCertificateGenerator::GenerateCertificate(
+              rtc::KeyParams::ECDSA(), absl::nullopt);
+      if (!certificate) {
+        RTC_LOG(LS_WARNING) << "Failed to pre-generate a certificate.";
+        return;
+      }
+      rtc::CritScope cs(&self->prewarmed_certificates_lock_);
+      self->prewarmed_certificates_.push_back(std::move(certificate));
+    });
+  }
+}
+
+rtc::scoped_refptr<rtc::RTCCertificate>
+PeerConnectionFactory::PopPrewarmedCertificate() {
+  rtc::CritScope cs(&prewarmed_certificates_lock_);
+  if (prewarmed_certificates_.empty()) {
+    return nullptr;
+  }
+  rtc::scoped_refptr<rtc::RTCCertificate> certificate =
+      std::move(prewarmed_certificates_.back());
+  prewarmed_certificates_.pop_back();
+  return certificate;
+}
+
 rtc::scoped_refptr<PeerConnectionInterface>
 PeerConnectionFactory::CreatePeerConnection(
     const PeerConnectionInterface::RTCConfiguration& configuration,
     PeerConnectionDependencies dependencies) {
   RTC_DCHECK(signaling_thread_->IsCurrent());
 
+  // Hand out a pre-warmed certificate when the caller brought neither a
+  // certificate nor a generator of their own, so the connection never has to
+  // wait for key generation before its first offer.
+  rtc::scoped_refptr<rtc::RTCCertificate> prewarmed_certificate;
+  if (configuration.certificates.empty() && !dependencies.cert_generator) {
+    prewarmed_certificate = PopPrewarmedCertificate();
+  }
+
   // Set internal defaults if optional dependencies are not set.
   if (!dependencies.cert_generator) {
     dependencies.cert_generator =
@@ -280,7 +318,17 @@ PeerConnectionFactory::CreatePeerConnection(
       new rtc::RefCountedObject<PeerConnection>(this, std::move(event_log),
                                                 std::move(call)));
   ActionsBeforeInitializeForTesting(pc);
-  if (!pc->Initialize(configuration, std::move(dependencies))) {
+  if (prewarmed_certificate) {
+    // PeerConnection favors a configured certificate over the generator, so
+    // injecting the pooled certificate here skips key generation entirely.
+    PeerConnectionInterface::RTCConfiguration modified_configuration =
+        configuration;
+    modified_configuration.certificates.push_back(
+        std::move(prewarmed_certificate));
+    if (!pc->Initialize(modified_configuration, std::move(dependencies))) {
+      return nullptr;
+    }
+  } else if (!pc->Initialize(configuration, std::move(dependencies))) {
     return nullptr;
   }
   return PeerConnectionProxy::Create(signaling_thread(), pc);
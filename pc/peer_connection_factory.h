@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "api/media_stream_interface.h"
 #include "api/media_transport_interface.h"
@@ -21,6 +22,7 @@
 #include "api/scoped_refptr.h"
 #include "media/sctp/sctp_transport_internal.h"
 #include "pc/channel_manager.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/rtc_certificate_generator.h"
 #include "rtc_base/thread.h"
 
@@ -37,6 +39,8 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
  public:
   void SetOptions(const Options& options) override;
 
+  void PrewarmCertificates(size_t count) override;
+
   rtc::scoped_refptr<PeerConnectionInterface> CreatePeerConnection(
       const PeerConnectionInterface::RTCConfiguration& configuration,
       std::unique_ptr<cricket::PortAllocator> allocator,
@@ -106,6 +110,9 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
  private:
   std::unique_ptr<RtcEventLog> CreateRtcEventLog_w();
   std::unique_ptr<Call> CreateCall_w(RtcEventLog* event_log);
+  // Takes a certificate out of the pre-warmed pool, or returns null if the
+  // pool is empty.
+  rtc::scoped_refptr<rtc::RTCCertificate> PopPrewarmedCertificate();
 
   bool wraps_current_thread_;
   rtc::Thread* network_thread_;
@@ -127,6 +134,13 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
   std::unique_ptr<NetworkControllerFactoryInterface>
       injected_network_controller_factory_;
   std::unique_ptr<MediaTransportFactory> media_transport_factory_;
+
+  // Certificates generated ahead of time by PrewarmCertificates(). Generation
+  // finishes on the worker thread while CreatePeerConnection() pops entries on
+  // the signaling thread, hence the lock.
+  rtc::CriticalSection prewarmed_certificates_lock_;
+  std::vector<rtc::scoped_refptr<rtc::RTCCertificate>> prewarmed_certificates_
+      RTC_GUARDED_BY(prewarmed_certificates_lock_);
 };
 
 }  // namespace webrtc
@@ -822,6 +822,20 @@ void ProduceReceiverMediaTrackStats(
   }
 }
 
+// Deep-copies a certificate stats chain, for sharing cached certificate stats
+// between consecutive reports.
+std::unique_ptr<rtc::SSLCertificateStats> CopySSLCertificateStats(
+    const rtc::SSLCertificateStats& source) {
+  std::unique_ptr<rtc::SSLCertificateStats> issuer;
+  if (source.issuer) {
+    issuer = CopySSLCertificateStats(*source.issuer);
+  }
+  return absl::make_unique<rtc::SSLCertificateStats>(
+      std::string(source.fingerprint),
+      std::string(source.fingerprint_algorithm),
+      std::string(source.base64_certificate), std::move(issuer));
+}
+
 rtc::scoped_refptr<RTCStatsReport> CreateReportFilteredBySelector(
     bool filter_by_sender_selector,
     rtc::scoped_refptr<const RTCStatsReport> report,
@@ -979,51 +993,83 @@ void RTCStatsCollector::GetStatsReportInternal(
     // Only start gathering stats if we're not already gathering stats. In the
     // case of already gathering stats, |callback_| will be invoked when there
     // are no more pending partial reports.
+    StartStatsGathering(cache_now_us);
+  }
+}
+
+void RTCStatsCollector::StartStatsGathering(int64_t cache_now_us) {
+  RTC_DCHECK(signaling_thread_->IsCurrent());
+  RTC_DCHECK_EQ(num_pending_partial_reports_, 0);
+  RTC_DCHECK(!requests_.empty());
 
-    // "Now" using a system clock, relative to the UNIX epoch (Jan 1, 1970,
-    // UTC), in microseconds. The system clock could be modified and is not
-    // necessarily monotonically increasing.
-    int64_t timestamp_us = rtc::TimeUTCMicros();
-
-    num_pending_partial_reports_ = 2;
-    partial_report_timestamp_us_ = cache_now_us;
-
-    // Prepare |transceiver_stats_infos_| for use in
-    // |ProducePartialResultsOnNetworkThread| and
-    // |ProducePartialResultsOnSignalingThread|.
-    transceiver_stats_infos_ = PrepareTransceiverStatsInfos_s();
-    // Prepare |transport_names_| for use in
-    // |ProducePartialResultsOnNetworkThread|.
-    transport_names_ = PrepareTransportNames_s();
-
-    // Prepare |call_stats_| here since GetCallStats() will hop to the worker
-    // thread.
-    // TODO(holmer): To avoid the hop we could move BWE and BWE stats to the
-    // network thread, where it more naturally belongs.
-    call_stats_ = pc_->GetCallStats();
-
-    // Don't touch |network_report_| on the signaling thread until
-    // ProducePartialResultsOnNetworkThread() has signaled the
-    // |network_report_event_|.
-    network_report_event_.Reset();
-    network_thread_->PostTask(
-        RTC_FROM_HERE,
-        rtc::Bind(&RTCStatsCollector::ProducePartialResultsOnNetworkThread,
-                  this, timestamp_us));
-    ProducePartialResultsOnSignalingThread(timestamp_us);
+  // If every queued request has a selector we can skip the sections that the
+  // stats selection algorithm always discards. Such a partial report is only
+  // delivered filtered and never cached.
+  partial_production_for_selectors_ = true;
+  for (const RequestInfo& request : requests_) {
+    if (request.filter_mode() == RequestInfo::FilterMode::kAll) {
+      partial_production_for_selectors_ = false;
+      break;
+    }
   }
+
+  // "Now" using a system clock, relative to the UNIX epoch (Jan 1, 1970,
+  // UTC), in microseconds. The system clock could be modified and is not
+  // necessarily monotonically increasing.
+  int64_t timestamp_us = rtc::TimeUTCMicros();
+
+  num_pending_partial_reports_ = 2;
+  partial_report_timestamp_us_ = cache_now_us;
+
+  // Prepare |transceiver_stats_infos_| for use in
+  // |ProducePartialResultsOnNetworkThread| and
+  // |ProducePartialResultsOnSignalingThread|.
+  transceiver_stats_infos_ = PrepareTransceiverStatsInfos_s();
+  // Prepare |transport_names_| for use in
+  // |ProducePartialResultsOnNetworkThread|.
+  transport_names_ = PrepareTransportNames_s();
+
+  // Prepare |call_stats_| here since GetCallStats() will hop to the worker
+  // thread.
+  // TODO(holmer): To avoid the hop we could move BWE and BWE stats to the
+  // network thread, where it more naturally belongs.
+  call_stats_ = pc_->GetCallStats();
+
+  // Don't touch |network_report_| on the signaling thread until
+  // ProducePartialResultsOnNetworkThread() has signaled the
+  // |network_report_event_|.
+  network_report_event_.Reset();
+  network_thread_->PostTask(
+      RTC_FROM_HERE,
+      rtc::Bind(&RTCStatsCollector::ProducePartialResultsOnNetworkThread, this,
+                timestamp_us));
+  ProducePartialResultsOnSignalingThread(timestamp_us);
 }
 
 void RTCStatsCollector::ClearCachedStatsReport() {
   RTC_DCHECK(signaling_thread_->IsCurrent());
   cached_report_ = nullptr;
+  // The certificates of a transport may have changed (e.g. because the
+  // transport was recreated); drop the certificate stats cache as well.
+  network_thread_->PostTask(
+      RTC_FROM_HERE,
+      rtc::Bind(&RTCStatsCollector::ClearCertificateStatsCache_n, this));
+}
+
+void RTCStatsCollector::ClearCertificateStatsCache_n() {
+  RTC_DCHECK(network_thread_->IsCurrent());
+  cached_certificates_by_transport_.clear();
 }
 
 void RTCStatsCollector::WaitForPendingRequest() {
   RTC_DCHECK(signaling_thread_->IsCurrent());
   // If a request is pending, blocks until the |network_report_event_| is
-  // signaled and then delivers the result. Otherwise this is a NO-OP.
-  MergeNetworkReport_s();
+  // signaled and then delivers the result. Otherwise this is a NO-OP. Merging
+  // a partial round may start a full round for requests that joined it late,
+  // so loop until no round is in progress.
+  do {
+    MergeNetworkReport_s();
+  } while (num_pending_partial_reports_ > 0);
 }
 
 void RTCStatsCollector::ProducePartialResultsOnSignalingThread(
@@ -1046,11 +1092,16 @@ void RTCStatsCollector::ProducePartialResultsOnSignalingThreadImpl(
     int64_t timestamp_us,
     RTCStatsReport* partial_report) {
   RTC_DCHECK(signaling_thread_->IsCurrent());
-  ProduceDataChannelStats_s(timestamp_us, partial_report);
-  ProduceMediaStreamStats_s(timestamp_us, partial_report);
+  // Data channel, stream and peer connection stats are never referenced by an
+  // RTP stream, so the stats selection algorithm always discards them; they
+  // are skipped when every queued request has a selector.
+  if (!partial_production_for_selectors_) {
+    ProduceDataChannelStats_s(timestamp_us, partial_report);
+    ProduceMediaStreamStats_s(timestamp_us, partial_report);
+    ProducePeerConnectionStats_s(timestamp_us, partial_report);
+  }
   ProduceMediaStreamTrackStats_s(timestamp_us, partial_report);
   ProduceMediaSourceStats_s(timestamp_us, partial_report);
-  ProducePeerConnectionStats_s(timestamp_us, partial_report);
 }
 
 void RTCStatsCollector::ProducePartialResultsOnNetworkThread(
@@ -1118,20 +1169,46 @@ void RTCStatsCollector::MergeNetworkReport_s() {
   // asynchronously, so |num_pending_partial_reports_| must now be 0 and we are
   // ready to deliver the result.
   RTC_DCHECK_EQ(num_pending_partial_reports_, 0);
-  cache_timestamp_us_ = partial_report_timestamp_us_;
-  cached_report_ = partial_report_;
+  rtc::scoped_refptr<const RTCStatsReport> report = partial_report_;
   partial_report_ = nullptr;
   transceiver_stats_infos_.clear();
+  if (!partial_production_for_selectors_) {
+    // Partial reports miss the sections without a selector; only full reports
+    // may serve later requests from the cache.
+    cache_timestamp_us_ = partial_report_timestamp_us_;
+    cached_report_ = report;
+  }
   // Trace WebRTC Stats when getStats is called on Javascript.
   // This allows access to WebRTC stats from trace logs. To enable them,
   // select the "webrtc_stats" category when recording traces.
   TRACE_EVENT_INSTANT1("webrtc_stats", "webrtc_stats", "report",
-                       cached_report_->ToJson());
+                       report->ToJson());
 
   // Deliver report and clear |requests_|.
   std::vector<RequestInfo> requests;
   requests.swap(requests_);
-  DeliverCachedReport(cached_report_, std::move(requests));
+  if (partial_production_for_selectors_) {
+    partial_production_for_selectors_ = false;
+    // Requests without a selector that arrived while this partial round was
+    // in flight need sections the round skipped. Keep them queued and start a
+    // full round for them once the selector requests have been served.
+    std::vector<RequestInfo> selector_requests;
+    for (RequestInfo& request : requests) {
+      if (request.filter_mode() == RequestInfo::FilterMode::kAll) {
+        requests_.push_back(std::move(request));
+      } else {
+        selector_requests.push_back(std::move(request));
+      }
+    }
+    if (!selector_requests.empty()) {
+      DeliverCachedReport(report, std::move(selector_requests));
+    }
+    if (!requests_.empty()) {
+      StartStatsGathering(rtc::TimeMicros());
+    }
+  } else {
+    DeliverCachedReport(report, std::move(requests));
+  }
 }
 
 void RTCStatsCollector::DeliverCachedReport(
@@ -1725,16 +1802,42 @@ RTCStatsCollector::PrepareTransportCertificateStats_n(
     const std::string& transport_name = entry.first;
 
     CertificateStatsPair certificate_stats_pair;
-    rtc::scoped_refptr<rtc::RTCCertificate> local_certificate;
-    if (pc_->GetLocalCertificate(transport_name, &local_certificate)) {
+    // Certificates are immutable for the lifetime of a transport, so share the
+    // cached stats once both chains have been seen instead of DER encoding and
+    // digesting every certificate again for each report.
+    auto cached = cached_certificates_by_transport_.find(transport_name);
+    if (cached != cached_certificates_by_transport_.end() &&
+        cached->second.local && cached->second.remote) {
       certificate_stats_pair.local =
-          local_certificate->GetSSLCertificateChain().GetStats();
-    }
+          CopySSLCertificateStats(*cached->second.local);
+      certificate_stats_pair.remote =
+          CopySSLCertificateStats(*cached->second.remote);
+    } else {
+      rtc::scoped_refptr<rtc::RTCCertificate> local_certificate;
+      if (pc_->GetLocalCertificate(transport_name, &local_certificate)) {
+        certificate_stats_pair.local =
+            local_certificate->GetSSLCertificateChain().GetStats();
+      }
 
-    std::unique_ptr<rtc::SSLCertChain> remote_cert_chain =
-        pc_->GetRemoteSSLCertChain(transport_name);
-    if (remote_cert_chain) {
-      certificate_stats_pair.remote = remote_cert_chain->GetStats();
+      std::unique_ptr<rtc::SSLCertChain> remote_cert_chain =
+          pc_->GetRemoteSSLCertChain(transport_name);
+      if (remote_cert_chain) {
+        certificate_stats_pair.remote = remote_cert_chain->GetStats();
+      }
+
+      // Cache the result; the entry keeps being refreshed until the remote
+      // chain is available.
+      CertificateStatsPair cache_entry;
+      if (certificate_stats_pair.local) {
+        cache_entry.local =
+            CopySSLCertificateStats(*certificate_stats_pair.local);
+      }
+      if (certificate_stats_pair.remote) {
+        cache_entry.remote =
+            CopySSLCertificateStats(*certificate_stats_pair.remote);
+      }
+      cached_certificates_by_transport_[transport_name] =
+          std::move(cache_entry);
     }
 
     transport_cert_stats.insert(
@@ -136,6 +136,9 @@ class RTCStatsCollector : public virtual rtc::RefCountInterface,
   };
 
   void GetStatsReportInternal(RequestInfo request);
+  // Starts a round of stats gathering on all threads for the requests queued
+  // in |requests_|. Must only be called when no round is in progress.
+  void StartStatsGathering(int64_t cache_now_us);
 
   // Structure for tracking stats about each RtpTransceiver managed by the
   // PeerConnection. This can either by a Plan B style or Unified Plan style
@@ -215,6 +218,8 @@ class RTCStatsCollector : public virtual rtc::RefCountInterface,
   PrepareTransportCertificateStats_n(
       const std::map<std::string, cricket::TransportStats>&
           transport_stats_by_name) const;
+  // Drops |cached_certificates_by_transport_|. Runs on the network thread.
+  void ClearCertificateStatsCache_n();
   std::vector<RtpTransceiverStatsInfo> PrepareTransceiverStatsInfos_s() const;
   std::set<std::string> PrepareTransportNames_s() const;
 
@@ -271,6 +276,20 @@ class RTCStatsCollector : public virtual rtc::RefCountInterface,
   int64_t cache_lifetime_us_;
   rtc::scoped_refptr<const RTCStatsReport> cached_report_;
 
+  // True while the in-progress round of gathering only serves requests with a
+  // selector. Such a round skips the sections that can never survive the stats
+  // selection algorithm, so its result is delivered filtered but never
+  // published as |cached_report_|.
+  bool partial_production_for_selectors_ = false;
+
+  // Certificate stats do not change for the lifetime of a transport but are
+  // expensive to produce (DER encoding and fingerprint digests of the whole
+  // chains), so they are shared between consecutive reports. An entry is
+  // refreshed until the remote chain has been seen; the whole cache is dropped
+  // by ClearCachedStatsReport(). Only accessed on the network thread.
+  mutable std::map<std::string, CertificateStatsPair>
+      cached_certificates_by_transport_;
+
   // Data recorded and maintained by the stats collector during its lifetime.
   // Some stats are produced from this record instead of other components.
   struct InternalRecord {
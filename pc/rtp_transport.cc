@@ -15,6 +15,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/types/optional.h"
 #include "api/rtp_headers.h"
 #include "api/rtp_parameters.h"
 #include "media/base/rtp_utils.h"
@@ -22,6 +23,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/packet_buffer_pool.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 #include "rtc_base/trace_event.h"
 
@@ -262,7 +264,19 @@ void RtpTransport::OnReadPacket(rtc::PacketTransportInternal* transport,
     return;
   }
 
-  rtc::CopyOnWriteBuffer packet(data, len);
+  // This is the terminal consumer of the (const char*, size_t) read signal
+  // chain. Adopt the pooled receive buffer when the socket layer staged one
+  // for this dispatch; the adopted buffer is exclusively owned, so the SRTP
+  // layer can decrypt it and trim the auth tag in place. Otherwise fall back
+  // to materializing a copy.
+  rtc::CopyOnWriteBuffer packet;
+  absl::optional<rtc::CopyOnWriteBuffer> pooled =
+      rtc::ReceivedPacketHandoff::Take(data, len);
+  if (pooled) {
+    packet = std::move(*pooled);
+  } else {
+    packet = rtc::CopyOnWriteBuffer(data, len);
+  }
   if (packet_type == cricket::RtpPacketType::kRtcp) {
     OnRtcpPacketReceived(std::move(packet), packet_time_us);
   } else {
@@ -172,6 +172,39 @@ bool SrtpSession::UnprotectRtcp(void* p, int in_len, int* out_len) {
   return true;
 }
 
+size_t SrtpSession::ProtectRtpBatch(rtc::ArrayView<RtpPacketRef> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  // libsrtp has no multi-packet primitive, so for now a batch is a plain loop
+  // over the per-packet call. Keeping the loop down here still saves the
+  // callers a virtual call and a length check per packet, and is the single
+  // place to switch over once a pipelined srtp_protect variant exists.
+  size_t ok = 0;
+  for (RtpPacketRef& packet : packets) {
+    if (ProtectRtp(packet.data, packet.in_len, packet.max_len,
+                   packet.out_len)) {
+      ++ok;
+    } else {
+      *packet.out_len = -1;
+    }
+  }
+  return ok;
+}
+
+size_t SrtpSession::UnprotectRtpBatch(rtc::ArrayView<RtpPacketRef> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  size_t ok = 0;
+  for (RtpPacketRef& packet : packets) {
+    if (UnprotectRtp(packet.data, packet.in_len, packet.out_len)) {
+      ++ok;
+    } else {
+      // A failed unprotect is not fatal for the rest of the batch; replay
+      // rejections and auth failures are per-packet conditions.
+      *packet.out_len = -1;
+    }
+  }
+  return ok;
+}
+
 bool SrtpSession::GetRtpAuthParams(uint8_t** key, int* key_len, int* tag_len) {
   RTC_DCHECK(thread_checker_.IsCurrent());
   RTC_DCHECK(IsExternalAuthActive());
@@ -13,6 +13,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "rtc_base/thread_checker.h"
 
@@ -65,6 +66,25 @@ class SrtpSession {
   bool UnprotectRtp(void* data, int in_len, int* out_len);
   bool UnprotectRtcp(void* data, int in_len, int* out_len);
 
+  // One packet of a batch. |data|/|max_len| describe the buffer, |in_len| the
+  // packet within it; |out_len| receives the processed length. |max_len| is
+  // ignored when unprotecting.
+  struct RtpPacketRef {
+    void* data;
+    int in_len;
+    int max_len;
+    int* out_len;
+  };
+
+  // Batched variants of ProtectRtp/UnprotectRtp. Each packet is processed
+  // in place; a packet that fails has its |out_len| set to -1 and should be
+  // dropped, while the rest of the batch is still processed. Returns the
+  // number of packets that succeeded. Handing the SRTP layer whole bursts at
+  // once is also the seam where a multi-packet libsrtp primitive (pipelined
+  // AES-GCM) can be slotted in without touching the callers again.
+  size_t ProtectRtpBatch(rtc::ArrayView<RtpPacketRef> packets);
+  size_t UnprotectRtpBatch(rtc::ArrayView<RtpPacketRef> packets);
+
   // Helper method to get authentication params.
   bool GetRtpAuthParams(uint8_t** key, int* key_len, int* tag_len);
 
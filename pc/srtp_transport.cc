@@ -207,6 +207,10 @@ void SrtpTransport::OnRtpPacketReceived(rtc::CopyOnWriteBuffer packet,
     return;
   }
   TRACE_EVENT0("webrtc", "SRTP Decode");
+  // The transport hands us an exclusively owned buffer (adopted from the
+  // pooled socket receive path, or materialized in OnReadPacket), so
+  // decrypting in place and trimming the auth tag below are plain in-place
+  // operations, not copy-on-write clones.
   char* data = packet.data<char>();
   int len = rtc::checked_cast<int>(packet.size());
   if (!UnprotectRtp(data, len, &len)) {
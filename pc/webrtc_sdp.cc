@@ -490,7 +490,9 @@ static bool GetLine(const std::string& message,
   if (line_end > 0 && (message.at(line_end - 1) == kReturnChar)) {
     --line_end;
   }
-  *line = message.substr(line_begin, (line_end - line_begin));
+  // Assign rather than substr so that the line buffer the parse loops reuse
+  // across calls keeps its capacity instead of allocating per line.
+  line->assign(message, line_begin, line_end - line_begin);
   const char* cline = line->c_str();
   // RFC 4566
   // An SDP session description consists of a number of lines of text of
@@ -869,6 +871,9 @@ std::string SdpSerialize(const JsepSessionDescription& jdesc) {
   }
 
   std::string message;
+  // SDPs for a handful of media sections run to a few kilobytes; start with a
+  // buffer in that range rather than growing from empty one line at a time.
+  message.reserve(4096);
 
   // Session Description.
   AddLine(kSessionVersion, &message);
@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <string>
 
 #include "rtc_base/checks.h"
@@ -87,6 +88,58 @@ int AsyncUDPSocket::SendTo(const void* pv,
   return ret;
 }
 
+int AsyncUDPSocket::SendToBatch(const BatchedPacket* packets, size_t count) {
+  static constexpr size_t kMaxBatch = 64;
+  size_t total_sent = 0;
+  while (total_sent < count) {
+    size_t batch = std::min(count - total_sent, kMaxBatch);
+    Socket::SendDatagram datagrams[kMaxBatch];
+    for (size_t i = 0; i < batch; ++i) {
+      const BatchedPacket& packet = packets[total_sent + i];
+      datagrams[i].data = packet.data;
+      datagrams[i].length = packet.length;
+      datagrams[i].addr = packet.addr;
+    }
+    int sent = socket_->SendToBatch(datagrams, batch);
+    if (sent < 0) {
+      return (total_sent == 0) ? sent : static_cast<int>(total_sent);
+    }
+    int64_t now = rtc::TimeMillis();
+    for (int i = 0; i < sent; ++i) {
+      const BatchedPacket& packet = packets[total_sent + i];
+      rtc::SentPacket sent_packet(packet.options.packet_id, now,
+                                  packet.options.info_signaled_after_sent);
+      CopySocketInformationToPacketInfo(packet.length, *this, true,
+                                        &sent_packet.info);
+      SignalSentPacket(this, sent_packet);
+    }
+    total_sent += sent;
+    if (static_cast<size_t>(sent) < batch) {
+      break;
+    }
+  }
+  return static_cast<int>(total_sent);
+}
+
+void AsyncUDPSocket::EnablePooledReceiveBuffers(size_t pool_size) {
+  RTC_DCHECK_GE(pool_size, 1);
+  buffer_pool_.reset(new PacketBufferPool(size_, pool_size));
+}
+
+void AsyncUDPSocket::SetBatchedReceiveMode(size_t max_packets,
+                                           size_t packet_size) {
+  RTC_DCHECK_GE(max_packets, 1);
+  RTC_DCHECK_GT(packet_size, 0);
+  batch_max_packets_ = max_packets;
+  batch_packet_size_ = packet_size;
+  if (max_packets > 1) {
+    batch_buf_.resize(max_packets * packet_size);
+  } else {
+    batch_buf_.clear();
+    batch_buf_.shrink_to_fit();
+  }
+}
+
 int AsyncUDPSocket::Close() {
   return socket_->Close();
 }
@@ -114,10 +167,29 @@ void AsyncUDPSocket::SetError(int error) {
 void AsyncUDPSocket::OnReadEvent(AsyncSocket* socket) {
   RTC_DCHECK(socket_.get() == socket);
 
+  if (batch_max_packets_ > 1) {
+    ReadBatch();
+    return;
+  }
+
+  // In pooled mode, read straight into a refcounted pool buffer so that
+  // consumers can take a reference instead of copying. Fall back to the
+  // plain member buffer when the pool is exhausted.
+  char* buf = buf_;
+  if (buffer_pool_) {
+    uint8_t* pooled = buffer_pool_->ReserveBuffer();
+    if (pooled) {
+      buf = reinterpret_cast<char*>(pooled);
+    }
+  }
+
   SocketAddress remote_addr;
   int64_t timestamp;
-  int len = socket_->RecvFrom(buf_, size_, &remote_addr, &timestamp);
+  int len = socket_->RecvFrom(buf, size_, &remote_addr, &timestamp);
   if (len < 0) {
+    if (buf != buf_) {
+      buffer_pool_->FinishBuffer(0);
+    }
     // An error here typically means we got an ICMP error in response to our
     // send datagram, indicating the remote address was unreachable.
     // When doing ICE, this kind of thing will often happen.
@@ -130,8 +202,62 @@ void AsyncUDPSocket::OnReadEvent(AsyncSocket* socket) {
 
   // TODO: Make sure that we got all of the packet.
   // If we did not, then we should resize our buffer to be large enough.
-  SignalReadPacket(this, buf_, static_cast<size_t>(len), remote_addr,
-                   (timestamp > -1 ? timestamp : TimeMicros()));
+  int64_t packet_time = (timestamp > -1 ? timestamp : TimeMicros());
+  if (buf != buf_) {
+    CopyOnWriteBuffer packet =
+        buffer_pool_->FinishBuffer(static_cast<size_t>(len));
+    SignalReadPacketBuffer(this, packet, remote_addr, packet_time);
+    // Stage the pooled buffer so the terminal consumer of the legacy signal
+    // chain (e.g. the RTP transport behind ICE/DTLS demuxing) can adopt the
+    // storage instead of materializing a copy.
+    ReceivedPacketHandoff::Stage(std::move(packet));
+    SignalReadPacket(this, buf, static_cast<size_t>(len), remote_addr,
+                     packet_time);
+    ReceivedPacketHandoff::Clear();
+    return;
+  }
+  SignalReadPacket(this, buf, static_cast<size_t>(len), remote_addr,
+                   packet_time);
+}
+
+void AsyncUDPSocket::ReadBatch() {
+  // Cap the number of batches drained per read event so that one busy socket
+  // cannot starve the rest of the socket server.
+  static constexpr int kMaxBatchesPerEvent = 8;
+  std::vector<Socket::RecvDatagram> datagrams(batch_max_packets_);
+  for (int iteration = 0; iteration < kMaxBatchesPerEvent; ++iteration) {
+    for (size_t i = 0; i < batch_max_packets_; ++i) {
+      datagrams[i].buffer = &batch_buf_[i * batch_packet_size_];
+      datagrams[i].size = batch_packet_size_;
+    }
+    int received =
+        socket_->RecvFromBatch(datagrams.data(), batch_max_packets_);
+    if (received < 0) {
+      SocketAddress local_addr = socket_->GetLocalAddress();
+      RTC_LOG(LS_INFO) << "AsyncUDPSocket[" << local_addr.ToSensitiveString()
+                       << "] batched receive failed with error "
+                       << socket_->GetError();
+      return;
+    }
+    for (int i = 0; i < received; ++i) {
+      const Socket::RecvDatagram& datagram = datagrams[i];
+      if (datagram.received >= batch_packet_size_) {
+        // Possibly truncated by the per-packet cap; the tail is gone, so the
+        // packet cannot be delivered.
+        RTC_LOG(LS_WARNING) << "Dropping oversized datagram in batched "
+                               "receive mode, size >= "
+                            << batch_packet_size_;
+        continue;
+      }
+      SignalReadPacket(
+          this, static_cast<const char*>(datagram.buffer), datagram.received,
+          datagram.addr,
+          (datagram.timestamp > -1 ? datagram.timestamp : TimeMicros()));
+    }
+    if (static_cast<size_t>(received) < batch_max_packets_) {
+      return;
+    }
+  }
 }
 
 void AsyncUDPSocket::OnWriteEvent(AsyncSocket* socket) {
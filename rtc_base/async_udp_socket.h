@@ -14,9 +14,12 @@
 #include <stddef.h>
 
 #include <memory>
+#include <vector>
 
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/async_socket.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/packet_buffer_pool.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/socket_factory.h"
@@ -48,6 +51,42 @@ class AsyncUDPSocket : public AsyncPacketSocket {
              size_t cb,
              const SocketAddress& addr,
              const rtc::PacketOptions& options) override;
+
+  // One packet of a batched SendToBatch() call.
+  struct BatchedPacket {
+    const void* data;
+    size_t length;
+    SocketAddress addr;
+    PacketOptions options;
+  };
+  // Sends a batch of packets, using a single syscall per batch where the
+  // platform supports it (see Socket::SendToBatch). SignalSentPacket fires
+  // once per packet handed to the kernel. Returns the number of packets sent.
+  int SendToBatch(const BatchedPacket* packets, size_t count);
+
+  // Enables pooled receive buffers: packets are read directly into refcounted
+  // buffers drawn from a per-socket pool and delivered through
+  // SignalReadPacketBuffer, so consumers that keep the payload (e.g. the RTP
+  // demuxing path) can take a reference instead of copying. The legacy
+  // SignalReadPacket still fires with a view of the same storage.
+  void EnablePooledReceiveBuffers(size_t pool_size);
+
+  // Emitted in pooled receive mode. The buffer shares pooled storage; holding
+  // a reference keeps it alive, and dropping the last reference returns the
+  // storage to the pool.
+  sigslot::signal4<AsyncUDPSocket*,
+                   const CopyOnWriteBuffer&,
+                   const SocketAddress&,
+                   int64_t>
+      SignalReadPacketBuffer;
+
+  // Enables batched receive mode: each read event drains up to |max_packets|
+  // queued datagrams per syscall on platforms with recvmmsg, instead of one
+  // recvfrom() per packet. |packet_size| caps an individual datagram in this
+  // mode, so it should only be enabled on sockets whose peers honor the path
+  // MTU (e.g. RTP); oversized datagrams are truncated and dropped.
+  void SetBatchedReceiveMode(size_t max_packets, size_t packet_size);
+
   int Close() override;
 
   State GetState() const override;
@@ -61,10 +100,18 @@ class AsyncUDPSocket : public AsyncPacketSocket {
   void OnReadEvent(AsyncSocket* socket);
   // Called when the underlying socket is ready to send.
   void OnWriteEvent(AsyncSocket* socket);
+  // Drains queued datagrams in batches; used when batched receive mode is on.
+  void ReadBatch();
 
   std::unique_ptr<AsyncSocket> socket_;
   char* buf_;
   size_t size_;
+  // Batched receive mode state; |batch_max_packets_| == 1 means disabled.
+  size_t batch_max_packets_ = 1;
+  size_t batch_packet_size_ = 0;
+  std::vector<char> batch_buf_;
+  // Receive buffer pool; null unless pooled receive mode is enabled.
+  std::unique_ptr<PacketBufferPool> buffer_pool_;
 };
 
 }  // namespace rtc
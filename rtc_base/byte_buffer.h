@@ -16,12 +16,35 @@
 
 #include <string>
 
+#include "absl/container/inlined_vector.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/byte_order.h"
 #include "rtc_base/constructor_magic.h"
 
 namespace rtc {
 
+// Buffer backend for ByteBufferWriterT with inline storage: contents up to
+// |InlineSize| bytes - which covers virtually all STUN and RTCP control
+// messages - are stored inside the object, so writing them never touches the
+// heap. Implements the subset of the BufferT API that ByteBufferWriterT uses.
+template <size_t InlineSize>
+class InlineBuffer {
+ public:
+  const char* data() const { return storage_.data(); }
+  char* data() { return storage_.data(); }
+  size_t size() const { return storage_.size(); }
+  size_t capacity() const { return storage_.capacity(); }
+  void AppendData(const char* data, size_t size) {
+    storage_.insert(storage_.end(), data, data + size);
+  }
+  void SetSize(size_t size) { storage_.resize(size); }
+  void EnsureCapacity(size_t capacity) { storage_.reserve(capacity); }
+  void Clear() { storage_.clear(); }
+
+ private:
+  absl::InlinedVector<char, InlineSize> storage_;
+};
+
 class ByteBuffer {
  public:
   enum ByteOrder {
@@ -120,7 +143,9 @@ class ByteBufferWriterT : public ByteBuffer {
   void Clear() { buffer_.Clear(); }
 
  private:
-  static constexpr size_t kDefaultCapacity = 4096;
+  // Matches the inline capacity of ByteBufferWriter's backing store, so the
+  // default constructor stays allocation free.
+  static constexpr size_t kDefaultCapacity = 512;
 
   void Construct(const char* bytes, size_t size) {
     if (bytes) {
@@ -137,7 +162,7 @@ class ByteBufferWriterT : public ByteBuffer {
   RTC_DISALLOW_COPY_AND_ASSIGN(ByteBufferWriterT);
 };
 
-class ByteBufferWriter : public ByteBufferWriterT<BufferT<char>> {
+class ByteBufferWriter : public ByteBufferWriterT<InlineBuffer<512>> {
  public:
   // |byte_order| defines order of bytes in the buffer.
   ByteBufferWriter();
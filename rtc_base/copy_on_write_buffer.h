@@ -230,7 +230,19 @@ class CopyOnWriteBuffer {
     std::swap(a.buffer_, b.buffer_);
   }
 
+  // Returns true if no other CopyOnWriteBuffer shares the underlying storage,
+  // i.e. mutating this buffer cannot trigger a copy. An empty buffer
+  // trivially has one reference. Used by buffer-recycling code to check that
+  // storage is exclusively owned before reusing it.
+  bool HasOneRef() const { return !buffer_ || buffer_->HasOneRef(); }
+
  private:
+  // Wraps an already-filled refcounted buffer without copying it. Used by
+  // PacketBufferPool, which keeps its own reference to the storage so that it
+  // can recycle it once all other references are gone.
+  friend class PacketBufferPool;
+  explicit CopyOnWriteBuffer(scoped_refptr<RefCountedObject<Buffer>> buffer);
+
   // Create a copy of the underlying data if it is referenced from other Buffer
   // objects.
   void CloneDataIfReferenced(size_t new_capacity);
@@ -10,19 +10,37 @@
 
 #include "rtc_base/crc32.h"
 
-#include "rtc_base/arraysize.h"
+#include <string.h>
+
+#include "rtc_base/byte_order.h"
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
 
 namespace rtc {
 
-// This implementation is based on the sample implementation in RFC 1952.
+// This implementation is based on the sample implementation in RFC 1952,
+// extended with slicing-by-8 so that the generic path consumes eight bytes
+// per table-lookup round instead of one. On ARM cores with the CRC extension
+// the dedicated CRC32 instructions are used instead; they compute the same
+// IEEE 802.3 polynomial. (The x86 SSE4.2 crc32 instruction is *not* usable
+// here: it hard-codes the Castagnoli polynomial, which would change every
+// checksum we emit on the wire.)
 
 // CRC32 polynomial, in reversed form.
 // See RFC 1952, or http://en.wikipedia.org/wiki/Cyclic_redundancy_check
 static const uint32_t kCrc32Polynomial = 0xEDB88320;
 
-static uint32_t* LoadCrc32Table() {
-  static uint32_t kCrc32Table[256];
-  for (uint32_t i = 0; i < arraysize(kCrc32Table); ++i) {
+#if !defined(__ARM_FEATURE_CRC32)
+
+static const size_t kNumCrc32Tables = 8;
+
+typedef uint32_t Crc32TableSet[kNumCrc32Tables][256];
+
+static Crc32TableSet* LoadCrc32Tables() {
+  static Crc32TableSet tables;
+  for (uint32_t i = 0; i < 256; ++i) {
     uint32_t c = i;
     for (size_t j = 0; j < 8; ++j) {
       if (c & 1) {
@@ -31,19 +49,56 @@ static uint32_t* LoadCrc32Table() {
         c >>= 1;
       }
     }
-    kCrc32Table[i] = c;
+    tables[0][i] = c;
+  }
+  // tables[k][i] is the CRC of byte i followed by k zero bytes, which is what
+  // lets eight independent lookups cover eight input bytes at once.
+  for (size_t k = 1; k < kNumCrc32Tables; ++k) {
+    for (uint32_t i = 0; i < 256; ++i) {
+      tables[k][i] =
+          tables[0][tables[k - 1][i] & 0xFF] ^ (tables[k - 1][i] >> 8);
+    }
   }
-  return kCrc32Table;
+  return &tables;
 }
 
-uint32_t UpdateCrc32(uint32_t start, const void* buf, size_t len) {
-  static uint32_t* kCrc32Table = LoadCrc32Table();
+#endif  // !defined(__ARM_FEATURE_CRC32)
 
+uint32_t UpdateCrc32(uint32_t start, const void* buf, size_t len) {
   uint32_t c = start ^ 0xFFFFFFFF;
   const uint8_t* u = static_cast<const uint8_t*>(buf);
-  for (size_t i = 0; i < len; ++i) {
-    c = kCrc32Table[(c ^ u[i]) & 0xFF] ^ (c >> 8);
+  size_t i = 0;
+
+#if defined(__ARM_FEATURE_CRC32)
+  for (; i + 8 <= len; i += 8) {
+    uint64_t chunk;
+    memcpy(&chunk, u + i, sizeof(chunk));
+    c = __crc32d(c, chunk);
+  }
+  for (; i < len; ++i) {
+    c = __crc32b(c, u[i]);
   }
+#else
+  static Crc32TableSet* tables = LoadCrc32Tables();
+  const Crc32TableSet& t = *tables;
+#if defined(WEBRTC_ARCH_LITTLE_ENDIAN)
+  // Slicing-by-8: fold two 32-bit words per round with independent lookups.
+  for (; i + 8 <= len; i += 8) {
+    uint32_t lo;
+    uint32_t hi;
+    memcpy(&lo, u + i, sizeof(lo));
+    memcpy(&hi, u + i + 4, sizeof(hi));
+    lo ^= c;
+    c = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^
+        t[4][lo >> 24] ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^
+        t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+  }
+#endif  // defined(WEBRTC_ARCH_LITTLE_ENDIAN)
+  for (; i < len; ++i) {
+    c = t[0][(c ^ u[i]) & 0xFF] ^ (c >> 8);
+  }
+#endif  // defined(__ARM_FEATURE_CRC32)
+
   return c ^ 0xFFFFFFFF;
 }
 
@@ -14,6 +14,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -84,6 +87,191 @@ static void EventTracingThreadFunc(void* params);
 // Atomic-int fast path for avoiding logging when disabled.
 static volatile int g_event_logging_active = 0;
 
+// Keep one in every this many events per thread; 1 keeps everything.
+static volatile int g_trace_sample_rate = 1;
+
+// Number of binary records each thread-local ring can hold before events are
+// dropped. Must be a power of two so indices can wrap with a mask.
+static const size_t kTraceRingCapacity = 4096;
+// TRACE_EVENT macros pass at most two arguments (TRACE_EVENT2).
+static const int kMaxInlineTraceArgs = 2;
+// TRACE_VALUE_TYPE_COPY_STRING payloads are copied into the record itself so
+// the hot path never allocates; longer strings are truncated.
+static const size_t kCopyStringLength = 64;
+
+// One trace event in fixed-size binary form. Everything is either a raw value
+// or a pointer to a string literal, except copied strings which live in the
+// inline |string_copies| buffer and travel with the record when it is copied
+// out of the ring.
+struct TraceRecord {
+  const char* name;
+  const unsigned char* category_enabled;
+  uint64_t timestamp;
+  rtc::PlatformThreadId tid;
+  char phase;
+  unsigned char num_args;
+  const char* arg_names[kMaxInlineTraceArgs];
+  unsigned char arg_types[kMaxInlineTraceArgs];
+  unsigned long long arg_values[kMaxInlineTraceArgs];
+  char string_copies[kMaxInlineTraceArgs][kCopyStringLength];
+};
+
+// Fixed-size single-producer/single-consumer ring of TraceRecords. The
+// producer is the thread the ring is registered for, the consumer is the
+// logging thread. When the ring is full new events are counted as dropped
+// rather than blocking the producer.
+class ThreadTraceBuffer {
+ public:
+  bool Write(char phase,
+             const unsigned char* category_enabled,
+             const char* name,
+             int num_args,
+             const char** arg_names,
+             const unsigned char* arg_types,
+             const unsigned long long* arg_values,
+             uint64_t timestamp,
+             rtc::PlatformThreadId tid) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= kTraceRingCapacity) {
+      dropped_events_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    TraceRecord& record = records_[head % kTraceRingCapacity];
+    record.name = name;
+    record.category_enabled = category_enabled;
+    record.timestamp = timestamp;
+    record.tid = tid;
+    record.phase = phase;
+    if (num_args > kMaxInlineTraceArgs)
+      num_args = kMaxInlineTraceArgs;
+    record.num_args = static_cast<unsigned char>(num_args);
+    for (int i = 0; i < num_args; ++i) {
+      record.arg_names[i] = arg_names[i];
+      record.arg_types[i] = arg_types[i];
+      record.arg_values[i] = arg_values[i];
+      if (arg_types[i] == TRACE_VALUE_TYPE_COPY_STRING) {
+        // Value is a pointer to a temporary string; copy it into the record.
+        const char* str =
+            reinterpret_cast<const char*>(static_cast<uintptr_t>(arg_values[i]));
+        strncpy(record.string_copies[i], str, kCopyStringLength - 1);
+        record.string_copies[i][kCopyStringLength - 1] = '\0';
+      }
+    }
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Copies all pending records to |output|. Called on the logging thread.
+  void Drain(std::vector<TraceRecord>* output) {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    while (tail != head) {
+      output->push_back(records_[tail % kTraceRingCapacity]);
+      ++tail;
+    }
+    tail_.store(tail, std::memory_order_release);
+  }
+
+  void DiscardPending() {
+    tail_.store(head_.load(std::memory_order_acquire),
+                std::memory_order_release);
+    dropped_events_.store(0, std::memory_order_relaxed);
+  }
+
+  uint64_t dropped_events() const {
+    return dropped_events_.load(std::memory_order_relaxed);
+  }
+
+  // Called from the owning thread's exit hook; afterwards the ring may be
+  // handed to a new thread. Pending records (which carry their own tid) are
+  // drained by the logging thread as usual.
+  void Retire() { retired_.store(true, std::memory_order_release); }
+  bool TryReclaim() {
+    // Only hand out rings whose events have all been drained, so a new
+    // thread starts with the full capacity.
+    if (head_.load(std::memory_order_acquire) !=
+        tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    bool expected = true;
+    return retired_.compare_exchange_strong(expected, false,
+                                            std::memory_order_acq_rel);
+  }
+
+ private:
+  TraceRecord records_[kTraceRingCapacity];
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<uint64_t> dropped_events_{0};
+  std::atomic<bool> retired_{true};
+};
+
+// Owns one ThreadTraceBuffer per thread that has ever traced; rings from
+// exited threads are reused for new threads. The lock is only taken when a
+// thread traces for the first time and when the logging thread walks the
+// rings, never on the per-event path.
+class TraceRingRegistry {
+ public:
+  static TraceRingRegistry& Instance() {
+    static TraceRingRegistry* const instance = new TraceRingRegistry();
+    return *instance;
+  }
+
+  ThreadTraceBuffer* RegisterCurrentThread() {
+    rtc::CritScope lock(&crit_);
+    for (auto& ring : rings_) {
+      if (ring->TryReclaim())
+        return ring.get();
+    }
+    rings_.push_back(std::unique_ptr<ThreadTraceBuffer>(new ThreadTraceBuffer));
+    rings_.back()->TryReclaim();
+    return rings_.back().get();
+  }
+
+  void Drain(std::vector<TraceRecord>* output) {
+    rtc::CritScope lock(&crit_);
+    for (auto& ring : rings_)
+      ring->Drain(output);
+  }
+
+  // Discards events left over from a previous capture session.
+  void DiscardPending() {
+    rtc::CritScope lock(&crit_);
+    for (auto& ring : rings_)
+      ring->DiscardPending();
+  }
+
+  uint64_t TotalDroppedEvents() {
+    rtc::CritScope lock(&crit_);
+    uint64_t dropped = 0;
+    for (auto& ring : rings_)
+      dropped += ring->dropped_events();
+    return dropped;
+  }
+
+ private:
+  rtc::CriticalSection crit_;
+  std::vector<std::unique_ptr<ThreadTraceBuffer>> rings_ RTC_GUARDED_BY(crit_);
+};
+
+// Registers the calling thread's ring on first use and retires it when the
+// thread exits, so the ring can be recycled for a later thread.
+class ThreadRingHandle {
+ public:
+  ThreadRingHandle()
+      : ring_(TraceRingRegistry::Instance().RegisterCurrentThread()) {}
+  ~ThreadRingHandle() { ring_->Retire(); }
+  ThreadTraceBuffer* ring() const { return ring_; }
+
+ private:
+  ThreadTraceBuffer* const ring_;
+};
+
+ThreadTraceBuffer* GetCurrentThreadRing() {
+  thread_local ThreadRingHandle handle;
+  return handle.ring();
+}
+
 // TODO(pbos): Log metadata for all threads, etc.
 class EventLogger final {
  public:
@@ -94,37 +282,6 @@ class EventLogger final {
                         kLowPriority) {}
   ~EventLogger() { RTC_DCHECK(thread_checker_.IsCurrent()); }
 
-  void AddTraceEvent(const char* name,
-                     const unsigned char* category_enabled,
-                     char phase,
-                     int num_args,
-                     const char** arg_names,
-                     const unsigned char* arg_types,
-                     const unsigned long long* arg_values,
-                     uint64_t timestamp,
-                     int pid,
-                     rtc::PlatformThreadId thread_id) {
-    std::vector<TraceArg> args(num_args);
-    for (int i = 0; i < num_args; ++i) {
-      TraceArg& arg = args[i];
-      arg.name = arg_names[i];
-      arg.type = arg_types[i];
-      arg.value.as_uint = arg_values[i];
-
-      // Value is a pointer to a temporary string, so we have to make a copy.
-      if (arg.type == TRACE_VALUE_TYPE_COPY_STRING) {
-        // Space for the string and for the terminating null character.
-        size_t str_length = strlen(arg.value.as_string) + 1;
-        char* str_copy = new char[str_length];
-        memcpy(str_copy, arg.value.as_string, str_length);
-        arg.value.as_string = str_copy;
-      }
-    }
-    rtc::CritScope lock(&crit_);
-    trace_events_.push_back(
-        {name, category_enabled, phase, args, timestamp, 1, thread_id});
-  }
-
   // The TraceEvent format is documented here:
   // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview
   void Log() {
@@ -132,34 +289,36 @@ class EventLogger final {
     static const int kLoggingIntervalMs = 100;
     fprintf(output_file_, "{ \"traceEvents\": [\n");
     bool has_logged_event = false;
+    std::vector<TraceRecord> events;
     while (true) {
       bool shutting_down = shutdown_event_.Wait(kLoggingIntervalMs);
-      std::vector<TraceEvent> events;
-      {
-        rtc::CritScope lock(&crit_);
-        trace_events_.swap(events);
-      }
+      events.clear();
+      TraceRingRegistry::Instance().Drain(&events);
+      // Each ring is drained in order, but events from different threads
+      // interleave arbitrarily; sort so the output is globally ordered.
+      std::stable_sort(events.begin(), events.end(),
+                       [](const TraceRecord& a, const TraceRecord& b) {
+                         return a.timestamp < b.timestamp;
+                       });
       std::string args_str;
       args_str.reserve(kEventLoggerArgsStrBufferInitialSize);
-      for (TraceEvent& e : events) {
+      for (const TraceRecord& e : events) {
         args_str.clear();
-        if (!e.args.empty()) {
+        if (e.num_args > 0) {
           args_str += ", \"args\": {";
-          bool is_first_argument = true;
-          for (TraceArg& arg : e.args) {
-            if (!is_first_argument)
+          for (int i = 0; i < e.num_args; ++i) {
+            if (i > 0)
               args_str += ",";
-            is_first_argument = false;
             args_str += " \"";
-            args_str += arg.name;
+            args_str += e.arg_names[i];
             args_str += "\": ";
+            TraceArg arg;
+            arg.name = e.arg_names[i];
+            arg.type = e.arg_types[i];
+            arg.value.as_uint = e.arg_values[i];
+            if (arg.type == TRACE_VALUE_TYPE_COPY_STRING)
+              arg.value.as_string = e.string_copies[i];
             args_str += TraceArgValueAsString(arg);
-
-            // Delete our copy of the string.
-            if (arg.type == TRACE_VALUE_TYPE_COPY_STRING) {
-              delete[] arg.value.as_string;
-              arg.value.as_string = nullptr;
-            }
           }
           args_str += " }";
         }
@@ -177,13 +336,18 @@ class EventLogger final {
                 "%s"
                 "}\n",
                 has_logged_event ? "," : " ", e.name, e.category_enabled,
-                e.phase, e.timestamp, e.pid, e.tid, args_str.c_str());
+                e.phase, e.timestamp, 1, e.tid, args_str.c_str());
         has_logged_event = true;
       }
       if (shutting_down)
         break;
     }
     fprintf(output_file_, "]}\n");
+    uint64_t dropped = TraceRingRegistry::Instance().TotalDroppedEvents();
+    if (dropped > 0) {
+      RTC_LOG(LS_WARNING) << "Dropped " << dropped
+                          << " trace events on full per-thread rings.";
+    }
     if (output_file_owned_)
       fclose(output_file_);
     output_file_ = nullptr;
@@ -195,14 +359,11 @@ class EventLogger final {
     RTC_DCHECK(!output_file_);
     output_file_ = file;
     output_file_owned_ = owned;
-    {
-      rtc::CritScope lock(&crit_);
-      // Since the atomic fast-path for adding events to the queue can be
-      // bypassed while the logging thread is shutting down there may be some
-      // stale events in the queue, hence the vector needs to be cleared to not
-      // log events from a previous logging session (which may be days old).
-      trace_events_.clear();
-    }
+    // Since the atomic fast-path for adding events can be bypassed while the
+    // logging thread is shutting down there may be some stale events in the
+    // rings, hence they need to be discarded to not log events from a previous
+    // logging session (which may be days old).
+    TraceRingRegistry::Instance().DiscardPending();
     // Enable event logging (fast-path). This should be disabled since starting
     // shouldn't be done twice.
     RTC_CHECK_EQ(0,
@@ -247,16 +408,6 @@ class EventLogger final {
                   "the uint field of that union.");
   };
 
-  struct TraceEvent {
-    const char* name;
-    const unsigned char* category_enabled;
-    char phase;
-    std::vector<TraceArg> args;
-    uint64_t timestamp;
-    int pid;
-    rtc::PlatformThreadId tid;
-  };
-
   static std::string TraceArgValueAsString(TraceArg arg) {
     std::string output;
 
@@ -317,8 +468,6 @@ class EventLogger final {
     return output;
   }
 
-  rtc::CriticalSection crit_;
-  std::vector<TraceEvent> trace_events_ RTC_GUARDED_BY(crit_);
   rtc::PlatformThread logging_thread_;
   rtc::Event shutdown_event_;
   rtc::ThreadChecker thread_checker_;
@@ -357,9 +506,16 @@ void InternalAddTraceEvent(char phase,
   if (rtc::AtomicOps::AcquireLoad(&g_event_logging_active) == 0)
     return;
 
-  g_event_logger->AddTraceEvent(name, category_enabled, phase, num_args,
+  const int sample_rate = rtc::AtomicOps::AcquireLoad(&g_trace_sample_rate);
+  if (sample_rate > 1) {
+    thread_local int sample_counter = 0;
+    if (++sample_counter % sample_rate != 0)
+      return;
+  }
+
+  GetCurrentThreadRing()->Write(phase, category_enabled, name, num_args,
                                 arg_names, arg_types, arg_values,
-                                rtc::TimeMicros(), 1, rtc::CurrentThreadId());
+                                rtc::TimeMicros(), rtc::CurrentThreadId());
 }
 
 }  // namespace
@@ -397,6 +553,11 @@ void StopInternalCapture() {
   }
 }
 
+void SetInternalTracerSampleRate(int sample_rate) {
+  RTC_DCHECK_GE(sample_rate, 1);
+  rtc::AtomicOps::ReleaseStore(&g_trace_sample_rate, sample_rate);
+}
+
 void ShutdownInternalTracer() {
   StopInternalCapture();
   EventLogger* old_logger = rtc::AtomicOps::AcquireLoadPtr(&g_event_logger);
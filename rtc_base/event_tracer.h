@@ -74,6 +74,10 @@ void SetupInternalTracer();
 bool StartInternalCapture(const char* filename);
 void StartInternalCaptureToFile(FILE* file);
 void StopInternalCapture();
+// Keep only one in every |sample_rate| trace events per thread; 1 (the
+// default) keeps everything. May be changed while a capture is running, e.g.
+// to cheapen always-on tracing in production.
+void SetInternalTracerSampleRate(int sample_rate);
 // Make sure we run this, this will tear down the internal tracing.
 void ShutdownInternalTracer();
 }  // namespace tracing
@@ -0,0 +1,55 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_EXPERIMENTS_FIELD_TRIAL_SETTINGS_CACHE_H_
+#define RTC_BASE_EXPERIMENTS_FIELD_TRIAL_SETTINGS_CACHE_H_
+
+#include <stdint.h>
+
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/field_trial.h"
+
+namespace webrtc {
+
+// Returns a shared, default-constructed instance of a settings/experiment
+// struct whose constructor parses the field trial string (e.g.
+// BalancedDegradationSettings). The instance is constructed on first use and
+// then reused, so repeated callers - per-stream setup paths in particular -
+// pay for the string parsing only once instead of on every construction.
+//
+// If InitFieldTrialsFromString is called again, the next access constructs a
+// fresh instance from the new trials string. The superseded instance is
+// deliberately leaked since callers may hold the returned reference for the
+// lifetime of the process; re-initialization is rare (tests, startup) so the
+// leak is bounded.
+//
+// Settings must be default constructible and must not depend on any state
+// other than the field trial string.
+template <typename Settings>
+const Settings& GetFieldTrialSettings() {
+  struct Cache {
+    rtc::CriticalSection lock;
+    const Settings* instance RTC_GUARDED_BY(lock) = nullptr;
+    uint64_t revision RTC_GUARDED_BY(lock) = 0;
+  };
+  static Cache* const cache = new Cache();
+  const uint64_t revision = field_trial::FieldTrialsRevision();
+  rtc::CritScope cs(&cache->lock);
+  if (cache->instance == nullptr || cache->revision != revision) {
+    cache->instance = new Settings();
+    cache->revision = revision;
+  }
+  return *cache->instance;
+}
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_EXPERIMENTS_FIELD_TRIAL_SETTINGS_CACHE_H_
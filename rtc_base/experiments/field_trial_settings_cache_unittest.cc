@@ -0,0 +1,46 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/experiments/field_trial_settings_cache.h"
+
+#include <string>
+
+#include "system_wrappers/include/field_trial.h"
+#include "test/field_trial.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+struct FakeSettings {
+  FakeSettings()
+      : group(field_trial::FindFullName("WebRTC-FakeCachedSettings")) {}
+  std::string group;
+};
+
+TEST(FieldTrialSettingsCacheTest, ReturnsSameInstanceOnRepeatedAccess) {
+  const FakeSettings& first = GetFieldTrialSettings<FakeSettings>();
+  const FakeSettings& second = GetFieldTrialSettings<FakeSettings>();
+  EXPECT_EQ(&first, &second);
+}
+
+TEST(FieldTrialSettingsCacheTest, ReparsesAfterFieldTrialsChange) {
+  const FakeSettings& before = GetFieldTrialSettings<FakeSettings>();
+  test::ScopedFieldTrials trials("WebRTC-FakeCachedSettings/Enabled/");
+  const FakeSettings& after = GetFieldTrialSettings<FakeSettings>();
+  EXPECT_NE(&before, &after);
+  EXPECT_EQ("Enabled", after.group);
+  // The superseded instance is leaked on purpose; references to it stay
+  // valid.
+  EXPECT_NE("Enabled", before.group);
+}
+
+}  // namespace
+}  // namespace webrtc
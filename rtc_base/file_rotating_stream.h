@@ -18,6 +18,9 @@
 #include <vector>
 
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/stream.h"
 #include "rtc_base/system/file_wrapper.h"
 
@@ -63,6 +66,14 @@ class FileRotatingStream : public StreamInterface {
   // enabled by default for performance.
   bool DisableBuffering();
 
+  // Keeps the file that will become the new current file pre-opened, so that
+  // rotation only renames files instead of paying for an open() while writes
+  // are stalled. Must be called before Open(). The scratch file is renamed
+  // into place on rotation (on platforms where renaming an open file fails,
+  // rotation falls back to the regular reopen) and deleted by Close(); until
+  // then it exists, empty, next to the log files.
+  void EnablePreopenedRotation();
+
   // Returns the path used for the i-th newest file, where the 0th file is the
   // newest file. The file may or may not exist, this is just used for
   // formatting. Index must be less than GetNumFiles().
@@ -85,6 +96,8 @@ class FileRotatingStream : public StreamInterface {
  private:
   bool OpenCurrentFile();
   void CloseCurrentFile();
+  // Best-effort open of the scratch file used by EnablePreopenedRotation().
+  void PreopenNextFile();
 
   // Rotates the files by creating a new current file, renaming the
   // existing files, and deleting the oldest one. e.g.
@@ -113,6 +126,11 @@ class FileRotatingStream : public StreamInterface {
   // buffering the file size read from disk might not be accurate.
   size_t current_bytes_written_;
   bool disable_buffering_;
+  // Pre-opened file that becomes the current file on the next rotation, when
+  // EnablePreopenedRotation() has been called.
+  bool preopen_rotation_;
+  webrtc::FileWrapper next_file_;
+  std::string next_file_path_;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(FileRotatingStream);
 };
@@ -157,6 +175,67 @@ class CallSessionFileRotatingStream : public FileRotatingStream {
   RTC_DISALLOW_COPY_AND_ASSIGN(CallSessionFileRotatingStream);
 };
 
+// Asynchronous adapter around FileRotatingStream for always-on diagnostics:
+// Write() appends to an in-memory buffer and returns without touching the
+// file system; a background writer thread swaps in the second buffer and
+// flushes full batches to the underlying stream, including any rotation. If
+// the disk cannot keep up and the pending buffer reaches its cap, new writes
+// are dropped and counted instead of blocking the calling thread.
+//
+// Write() may be called from any single thread (or under external
+// synchronization); the other methods must be called on the thread that
+// called Open().
+class AsyncFileRotatingStream : public StreamInterface {
+ public:
+  AsyncFileRotatingStream(const std::string& dir_path,
+                          const std::string& file_prefix,
+                          size_t max_file_size,
+                          size_t num_files);
+  ~AsyncFileRotatingStream() override;
+
+  // StreamInterface methods.
+  StreamState GetState() const override;
+  StreamResult Read(void* buffer,
+                    size_t buffer_len,
+                    size_t* read,
+                    int* error) override;
+  StreamResult Write(const void* data,
+                     size_t data_len,
+                     size_t* written,
+                     int* error) override;
+  // Blocks until everything buffered so far is on disk.
+  bool Flush() override;
+  void Close() override;
+
+  // Opens the underlying stream and starts the writer thread. Call this
+  // before using the stream.
+  bool Open();
+
+  // Number of bytes discarded because the pending buffer was full.
+  size_t bytes_dropped() const;
+
+ private:
+  static void ThreadRun(void* obj);
+  void ProcessBuffers();
+
+  // Only touched by the writer thread between Open() and Close().
+  FileRotatingStream stream_;
+  std::unique_ptr<PlatformThread> thread_;
+
+  CriticalSection lock_;
+  bool open_ RTC_GUARDED_BY(&lock_) = false;
+  // Buffer being filled by Write(); the writer thread swaps it against its
+  // own (recycled) drain buffer.
+  std::vector<char> fill_buffer_ RTC_GUARDED_BY(&lock_);
+  size_t bytes_dropped_ RTC_GUARDED_BY(&lock_) = 0;
+  bool flush_requested_ RTC_GUARDED_BY(&lock_) = false;
+  bool stop_ RTC_GUARDED_BY(&lock_) = false;
+  Event wake_writer_;
+  Event flush_done_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(AsyncFileRotatingStream);
+};
+
 // This is a convenience class, to read all files produced by a
 // FileRotatingStream, all in one go. Typical use calls GetSize and ReadData
 // only once. The list of file names to read is based on the contents of the log
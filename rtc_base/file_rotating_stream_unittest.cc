@@ -244,6 +244,122 @@ TEST_F(MAYBE_FileRotatingStreamTest, GetFilePath) {
   }
 }
 
+// Tests that pre-opened rotation writes and rotates the same way as the
+// regular path, and that the scratch file exists while the stream is open and
+// is deleted by Close().
+TEST_F(MAYBE_FileRotatingStreamTest, PreopenedRotationWriteOverflowAndRead) {
+  Init("FileRotatingStreamTestPreopenedRotation", kFilePrefix, kMaxFileSize, 3);
+  stream_->EnablePreopenedRotation();
+  ASSERT_TRUE(stream_->Open());
+  const std::string scratch_path = dir_path_ + kFilePrefix + "_next";
+  EXPECT_TRUE(webrtc::test::FileExists(scratch_path));
+  // Same data as WriteOverflowAndRead; results must match.
+  std::string message("foobarbaz");
+  WriteAndFlush(message.c_str(), message.size());
+  std::string expected_file_contents("z");
+  VerifyFileContents(expected_file_contents.c_str(),
+                     expected_file_contents.size(), stream_->GetFilePath(0));
+  std::string expected_stream_contents("arbaz");
+  VerifyStreamRead(expected_stream_contents.c_str(),
+                   expected_stream_contents.size(), dir_path_, kFilePrefix);
+  stream_->Close();
+  EXPECT_FALSE(webrtc::test::FileExists(scratch_path));
+}
+
+#if defined(WEBRTC_ANDROID)
+// Fails on Android: https://bugs.chromium.org/p/webrtc/issues/detail?id=4364.
+#define MAYBE_AsyncFileRotatingStreamTest DISABLED_AsyncFileRotatingStreamTest
+#else
+#define MAYBE_AsyncFileRotatingStreamTest AsyncFileRotatingStreamTest
+#endif
+
+class MAYBE_AsyncFileRotatingStreamTest : public ::testing::Test {
+ protected:
+  static const char* kFilePrefix;
+
+  void Init(const std::string& dir_name,
+            size_t max_file_size,
+            size_t num_log_files) {
+    dir_path_ = webrtc::test::OutputPath();
+
+    // Append per-test output path in order to run within gtest parallel.
+    dir_path_.append(dir_name);
+    dir_path_.append(webrtc::test::kPathDelimiter);
+    ASSERT_TRUE(webrtc::test::CreateDir(dir_path_));
+    stream_.reset(new AsyncFileRotatingStream(dir_path_, kFilePrefix,
+                                              max_file_size, num_log_files));
+  }
+
+  void TearDown() override {
+    stream_->Close();
+    stream_.reset();
+    // The async stream doesn't expose its file paths; reconstruct them with a
+    // stream configured like the ones the tests use.
+    FileRotatingStream cleanup_stream(dir_path_, kFilePrefix, 2, 3);
+    CleanupLogDirectory(cleanup_stream);
+    webrtc::test::RemoveFile(dir_path_ + kFilePrefix + "_next");
+    EXPECT_TRUE(webrtc::test::RemoveDir(dir_path_));
+  }
+
+  // Checks that the stream reads in the expected contents and then returns an
+  // end of stream result.
+  void VerifyStreamRead(const char* expected_contents,
+                        const size_t expected_length) {
+    FileRotatingStreamReader reader(dir_path_, kFilePrefix);
+    EXPECT_EQ(reader.GetSize(), expected_length);
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[expected_length]);
+    memset(buffer.get(), 0, expected_length);
+    EXPECT_EQ(expected_length, reader.ReadAll(buffer.get(), expected_length));
+    EXPECT_EQ(0, memcmp(expected_contents, buffer.get(), expected_length));
+  }
+
+  std::unique_ptr<AsyncFileRotatingStream> stream_;
+  std::string dir_path_;
+};
+
+const char* MAYBE_AsyncFileRotatingStreamTest::kFilePrefix =
+    "AsyncFileRotatingStreamTest";
+
+// Tests that stream state is correct before and after Open / Close.
+TEST_F(MAYBE_AsyncFileRotatingStreamTest, State) {
+  Init("AsyncFileRotatingStreamTestState", 2, 3);
+
+  EXPECT_EQ(SS_CLOSED, stream_->GetState());
+  ASSERT_TRUE(stream_->Open());
+  EXPECT_EQ(SS_OPEN, stream_->GetState());
+  stream_->Close();
+  EXPECT_EQ(SS_CLOSED, stream_->GetState());
+}
+
+// Tests that data written across rotations ends up on disk after Flush() and
+// reads back like the synchronous stream's output, without drops.
+TEST_F(MAYBE_AsyncFileRotatingStreamTest, WriteOverflowFlushAndRead) {
+  Init("AsyncFileRotatingStreamTestWriteOverflowFlushAndRead", 2, 3);
+
+  ASSERT_TRUE(stream_->Open());
+  // Same data and result as the synchronous WriteOverflowAndRead test.
+  std::string message("foobarbaz");
+  for (size_t i = 0; i < message.size(); ++i) {
+    EXPECT_EQ(SR_SUCCESS, stream_->WriteAll(&message[i], 1, nullptr, nullptr));
+  }
+  EXPECT_TRUE(stream_->Flush());
+  EXPECT_EQ(0u, stream_->bytes_dropped());
+  std::string expected_stream_contents("arbaz");
+  VerifyStreamRead(expected_stream_contents.c_str(),
+                   expected_stream_contents.size());
+}
+
+// Tests that writing after Close() fails instead of touching the writer
+// thread.
+TEST_F(MAYBE_AsyncFileRotatingStreamTest, WriteAfterCloseFails) {
+  Init("AsyncFileRotatingStreamTestWriteAfterCloseFails", 2, 3);
+
+  ASSERT_TRUE(stream_->Open());
+  stream_->Close();
+  size_t written = 0;
+  EXPECT_EQ(SR_ERROR, stream_->Write("a", 1, &written, nullptr));
+}
+
 #if defined(WEBRTC_ANDROID)
 // Fails on Android: https://bugs.chromium.org/p/webrtc/issues/detail?id=4364.
 #define MAYBE_CallSessionFileRotatingStreamTest \
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "rtc_base/checks.h"
 #include "rtc_base/openssl_digest.h"
 #include "rtc_base/string_encode.h"
 
@@ -93,6 +94,67 @@ std::string ComputeDigest(const std::string& alg, const std::string& input) {
   return output;
 }
 
+constexpr size_t HmacContext::kBlockSize;
+
+HmacContext::HmacContext(const std::string& alg)
+    : digest_(MessageDigestFactory::Create(alg)) {}
+
+HmacContext::~HmacContext() = default;
+
+bool HmacContext::SetKey(const void* key, size_t key_len) {
+  // We only handle algorithms with a 64-byte blocksize.
+  if (!digest_ || digest_->Size() > 32) {
+    return false;
+  }
+  // Copy the key to a block-sized buffer to simplify padding.
+  // If the key is longer than a block, hash it and use the result instead.
+  uint8_t new_key[kBlockSize];
+  if (key_len > kBlockSize) {
+    ComputeDigest(digest_.get(), key, key_len, new_key, kBlockSize);
+    memset(new_key + digest_->Size(), 0, kBlockSize - digest_->Size());
+  } else {
+    memcpy(new_key, key, key_len);
+    memset(new_key + key_len, 0, kBlockSize - key_len);
+  }
+  // Set up the padding from the key, salting appropriately for each padding.
+  for (size_t i = 0; i < kBlockSize; ++i) {
+    o_pad_[i] = 0x5c ^ new_key[i];
+    i_pad_[i] = 0x36 ^ new_key[i];
+  }
+  keyed_ = true;
+  return true;
+}
+
+size_t HmacContext::Compute(const void* input,
+                            size_t in_len,
+                            void* output,
+                            size_t out_len) {
+  Start();
+  Update(input, in_len);
+  return Finish(output, out_len);
+}
+
+void HmacContext::Start() {
+  RTC_DCHECK(keyed_);
+  // Start the inner hash with the inner padding.
+  digest_->Update(i_pad_, kBlockSize);
+}
+
+void HmacContext::Update(const void* input, size_t in_len) {
+  digest_->Update(input, in_len);
+}
+
+size_t HmacContext::Finish(void* output, size_t out_len) {
+  // Finish the inner hash, then compute the outer hash over the outer
+  // padding and the inner result. Finish() reinitializes the digest, so the
+  // context is ready for the next Start().
+  uint8_t inner[32];
+  digest_->Finish(inner, digest_->Size());
+  digest_->Update(o_pad_, kBlockSize);
+  digest_->Update(inner, digest_->Size());
+  return digest_->Finish(output, out_len);
+}
+
 // Compute a RFC 2104 HMAC: H(K XOR opad, H(K XOR ipad, text))
 size_t ComputeHmac(MessageDigest* digest,
                    const void* key,
@@ -12,7 +12,9 @@
 #define RTC_BASE_MESSAGE_DIGEST_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <memory>
 #include <string>
 
 namespace rtc {
@@ -48,6 +50,44 @@ class MessageDigestFactory {
 // A whitelist of approved digest algorithms from RFC 4572 (FIPS 180).
 bool IsFips180DigestAlgorithm(const std::string& alg);
 
+// Computes RFC 2104 HMACs with a reusable keyed context. SetKey() precomputes
+// the padded key blocks, so that computing an HMAC makes no heap allocations
+// and keying cost is only paid when the key actually changes. This matters on
+// paths that verify many small packets under the same key, e.g. STUN
+// message-integrity checks.
+class HmacContext {
+ public:
+  // |alg| is a digest name, e.g. DIGEST_SHA_1. Only algorithms with a
+  // 64-byte block size (SHA-256 and down) are supported.
+  explicit HmacContext(const std::string& alg);
+  HmacContext(const HmacContext&) = delete;
+  HmacContext& operator=(const HmacContext&) = delete;
+  ~HmacContext();
+
+  // Re-keys the context. Returns false if the digest algorithm given to the
+  // constructor is unavailable or unsupported.
+  bool SetKey(const void* key, size_t key_len);
+
+  // Computes the HMAC of |in_len| bytes of |input| with the current key,
+  // like ComputeHmac(). The context must have been keyed with SetKey().
+  size_t Compute(const void* input, size_t in_len, void* output, size_t out_len);
+
+  // Streaming interface for input that is not contiguous in memory:
+  // Start(), any number of Update() calls, then Finish(). Compute() is
+  // shorthand for the three. After Finish() the context can be reused.
+  void Start();
+  void Update(const void* input, size_t in_len);
+  size_t Finish(void* output, size_t out_len);
+
+ private:
+  static constexpr size_t kBlockSize = 64;
+
+  std::unique_ptr<MessageDigest> digest_;
+  bool keyed_ = false;
+  uint8_t i_pad_[kBlockSize];
+  uint8_t o_pad_[kBlockSize];
+};
+
 // Functions to create hashes.
 
 // Computes the hash of |in_len| bytes of |input|, using the |digest| hash
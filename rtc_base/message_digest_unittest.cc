@@ -152,4 +152,46 @@ TEST(MessageDigestTest, TestBadHmac) {
   EXPECT_EQ("", ComputeHmac("sha-9000", "key", "abc"));
 }
 
+// Test vectors from RFC 2202, matching the ComputeHmac tests above; a keyed
+// context must give the same answers when reused and when re-keyed.
+TEST(MessageDigestTest, TestHmacContextReuseAndRekey) {
+  HmacContext context(DIGEST_SHA_1);
+  std::string key(20, '\x0b');
+  ASSERT_TRUE(context.SetKey(key.data(), key.size()));
+
+  std::string input("Hi There");
+  char output[20];
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(sizeof(output), context.Compute(input.data(), input.size(),
+                                              output, sizeof(output)));
+    EXPECT_EQ("b617318655057264e28bc0b6fb378c8ef146be00",
+              hex_encode(output, sizeof(output)));
+  }
+
+  // The streaming interface must give the same result for split input.
+  context.Start();
+  context.Update(input.data(), 3);
+  context.Update(input.data() + 3, input.size() - 3);
+  EXPECT_EQ(sizeof(output), context.Finish(output, sizeof(output)));
+  EXPECT_EQ("b617318655057264e28bc0b6fb378c8ef146be00",
+            hex_encode(output, sizeof(output)));
+
+  // Re-keying reuses the context; a key longer than the block size is hashed
+  // first, as in ComputeHmac.
+  std::string long_key(80, '\xaa');
+  ASSERT_TRUE(context.SetKey(long_key.data(), long_key.size()));
+  std::string long_input(
+      "Test Using Larger Than Block-Size Key - Hash Key First");
+  EXPECT_EQ(sizeof(output), context.Compute(long_input.data(),
+                                            long_input.size(), output,
+                                            sizeof(output)));
+  EXPECT_EQ("aa4ae5e15272d00e95705637ce8a3b55ed402112",
+            hex_encode(output, sizeof(output)));
+}
+
+TEST(MessageDigestTest, TestBadHmacContext) {
+  HmacContext context("sha-9000");
+  EXPECT_FALSE(context.SetKey("key", 3));
+}
+
 }  // namespace rtc
@@ -279,7 +279,7 @@ bool MessageQueue::Get(Message* pmsg, int cmsWait, bool process_io) {
               cmsDelayNext = TimeDiff(dmsgq_.top().msTrigger_, msCurrent);
               break;
             }
-            msgq_.push_back(dmsgq_.top().msg_);
+            PushBackReusingNode(dmsgq_.top().msg_);
             dmsgq_.pop();
           }
         }
@@ -288,7 +288,7 @@ bool MessageQueue::Get(Message* pmsg, int cmsWait, bool process_io) {
           break;
         } else {
           *pmsg = msgq_.front();
-          msgq_.pop_front();
+          PopFrontReusingNode();
         }
       }  // crit_ is released here.
 
@@ -369,11 +369,32 @@ void MessageQueue::Post(const Location& posted_from,
     if (time_sensitive) {
       msg.ts_sensitive = TimeMillis() + kMaxMsgLatency;
     }
-    msgq_.push_back(msg);
+    PushBackReusingNode(msg);
   }
   WakeUpSocketServer();
 }
 
+void MessageQueue::PushBackReusingNode(const Message& msg) {
+  if (free_msgq_.empty()) {
+    msgq_.push_back(msg);
+    return;
+  }
+  free_msgq_.front() = msg;
+  msgq_.splice(msgq_.end(), free_msgq_, free_msgq_.begin());
+}
+
+void MessageQueue::PopFrontReusingNode() {
+  // Bounds the node cache to the depth of a typical posting burst.
+  static const size_t kMaxFreeMessageNodes = 64;
+  if (free_msgq_.size() >= kMaxFreeMessageNodes) {
+    msgq_.pop_front();
+    return;
+  }
+  // Drop references held by the spent message before caching its node.
+  msgq_.front() = Message();
+  free_msgq_.splice(free_msgq_.end(), msgq_, msgq_.begin());
+}
+
 void MessageQueue::PostDelayed(const Location& posted_from,
                                int cmsDelay,
                                MessageHandler* phandler,
@@ -302,6 +302,15 @@ class MessageQueue {
                      uint32_t id,
                      MessageList* removed) RTC_EXCLUSIVE_LOCKS_REQUIRED(&crit_);
 
+  // Appends |msg| to msgq_, reusing a cached list node if one is available so
+  // that steady-state posting does not allocate.
+  void PushBackReusingNode(const Message& msg)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(&crit_);
+
+  // Pops the front of msgq_, parking the list node in free_msgq_ (bounded)
+  // for reuse by a later PushBackReusingNode call.
+  void PopFrontReusingNode() RTC_EXCLUSIVE_LOCKS_REQUIRED(&crit_);
+
   // Perform cleanup; subclasses must call this from the destructor,
   // and are not expected to actually hold the lock.
   void DoDestroy() RTC_EXCLUSIVE_LOCKS_REQUIRED(&crit_);
@@ -311,6 +320,9 @@ class MessageQueue {
   bool fPeekKeep_;
   Message msgPeek_;
   MessageList msgq_ RTC_GUARDED_BY(crit_);
+  // Cache of spent msgq_ nodes; the post/dispatch hot loop shuttles nodes
+  // between the two lists with splice() instead of hitting the heap.
+  MessageList free_msgq_ RTC_GUARDED_BY(crit_);
   PriorityQueue dmsgq_ RTC_GUARDED_BY(crit_);
   uint32_t dmsgq_next_num_ RTC_GUARDED_BY(crit_);
   CriticalSection crit_;
@@ -26,12 +26,101 @@
 #endif
 #endif  // defined(WEBRTC_POSIX) && !defined(__native_client__)
 
+#include <map>
+#include <utility>
+
+#include "rtc_base/critical_section.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/signal_thread.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"  // for signal_with_thread...
+#include "rtc_base/time_utils.h"
 
 namespace rtc {
 
+namespace {
+
+// How long a cached resolution may be served. Once an entry reaches half this
+// age it is still served, but a background refresh is kicked off so steady
+// traffic to the same hostname never observes a stale-then-slow transition.
+const int64_t kDnsCacheTimeoutMs = 60 * 1000;
+
+// Message id used by AsyncResolver to deliver a cached result asynchronously
+// on the calling thread.
+enum { MSG_CACHED_RESOLUTION_DONE = SignalThread::ST_MSG_FIRST_AVAILABLE };
+
+// Process-wide cache of successful hostname resolutions. All methods are
+// thread-safe; the worker threads of refreshing resolvers store into it
+// directly.
+class DnsResolutionCache {
+ public:
+  static DnsResolutionCache* GetInstance() {
+    static DnsResolutionCache* const instance = new DnsResolutionCache();
+    return instance;
+  }
+
+  // Returns true and copies the cached addresses if |hostname| (resolved with
+  // |family|) has an unexpired entry. |needs_refresh| is set when the entry
+  // has reached half its time-to-live and no other resolver is already
+  // refreshing it; the caller is then expected to re-resolve in the
+  // background.
+  bool Lookup(const std::string& hostname,
+              int family,
+              std::vector<IPAddress>* addresses,
+              bool* needs_refresh) {
+    CritScope cs(&lock_);
+    auto it = entries_.find(hostname);
+    if (it == entries_.end() || it->second.family != family) {
+      return false;
+    }
+    int64_t age_ms = TimeMillis() - it->second.resolved_time_ms;
+    if (age_ms >= kDnsCacheTimeoutMs) {
+      entries_.erase(it);
+      return false;
+    }
+    *addresses = it->second.addresses;
+    *needs_refresh = age_ms >= kDnsCacheTimeoutMs / 2 &&
+                     !it->second.refresh_in_progress;
+    if (*needs_refresh) {
+      it->second.refresh_in_progress = true;
+    }
+    return true;
+  }
+
+  void Store(const std::string& hostname,
+             int family,
+             std::vector<IPAddress> addresses) {
+    CritScope cs(&lock_);
+    Entry& entry = entries_[hostname];
+    entry.addresses = std::move(addresses);
+    entry.family = family;
+    entry.resolved_time_ms = TimeMillis();
+    entry.refresh_in_progress = false;
+  }
+
+  // Clears the refresh-in-progress mark after a failed refresh, so the entry
+  // can be refreshed again (or expire normally).
+  void AbortRefresh(const std::string& hostname) {
+    CritScope cs(&lock_);
+    auto it = entries_.find(hostname);
+    if (it != entries_.end()) {
+      it->second.refresh_in_progress = false;
+    }
+  }
+
+ private:
+  struct Entry {
+    std::vector<IPAddress> addresses;
+    int family = AF_UNSPEC;
+    int64_t resolved_time_ms = 0;
+    bool refresh_in_progress = false;
+  };
+
+  CriticalSection lock_;
+  std::map<std::string, Entry> entries_ RTC_GUARDED_BY(lock_);
+};
+
+}  // namespace
+
 int ResolveHostname(const std::string& hostname,
                     int family,
                     std::vector<IPAddress>* addresses) {
@@ -84,12 +173,28 @@ int ResolveHostname(const std::string& hostname,
 }
 
 // AsyncResolver
-AsyncResolver::AsyncResolver() : SignalThread(), error_(-1) {}
+AsyncResolver::AsyncResolver()
+    : SignalThread(), error_(-1), refreshing_cache_(false) {}
 
 AsyncResolver::~AsyncResolver() = default;
 
 void AsyncResolver::Start(const SocketAddress& addr) {
   addr_ = addr;
+  bool needs_refresh = false;
+  if (DnsResolutionCache::GetInstance()->Lookup(addr.hostname(), addr.family(),
+                                                &addresses_, &needs_refresh)) {
+    error_ = 0;
+    // Deliver the cached result asynchronously, as callers expect, without
+    // spawning a worker thread.
+    Thread::Current()->Post(RTC_FROM_HERE, this, MSG_CACHED_RESOLUTION_DONE);
+    if (needs_refresh) {
+      // Re-resolve in the background to keep the cached entry current; the
+      // result only goes into the cache, not into this resolver.
+      refreshing_cache_ = true;
+      SignalThread::Start();
+    }
+    return;
+  }
   // SignalThred Start will kickoff the resolve process.
   SignalThread::Start();
 }
@@ -117,14 +222,47 @@ void AsyncResolver::Destroy(bool wait) {
 }
 
 void AsyncResolver::DoWork() {
+  if (refreshing_cache_) {
+    // This resolver already delivered a cached result; re-resolve into local
+    // storage and only update the cache, so the members the caller may still
+    // be reading are left untouched.
+    std::vector<IPAddress> addresses;
+    if (ResolveHostname(addr_.hostname().c_str(), addr_.family(),
+                        &addresses) == 0) {
+      DnsResolutionCache::GetInstance()->Store(
+          addr_.hostname(), addr_.family(), std::move(addresses));
+    } else {
+      DnsResolutionCache::GetInstance()->AbortRefresh(addr_.hostname());
+    }
+    return;
+  }
   error_ =
       ResolveHostname(addr_.hostname().c_str(), addr_.family(), &addresses_);
 }
 
 void AsyncResolver::OnWorkDone() {
+  if (refreshing_cache_) {
+    // The caller was signaled when the cached result was delivered.
+    return;
+  }
+  if (error_ == 0 && !addresses_.empty()) {
+    DnsResolutionCache::GetInstance()->Store(addr_.hostname(), addr_.family(),
+                                             addresses_);
+  }
   SignalDone(this);
 }
 
+void AsyncResolver::OnMessage(Message* msg) {
+  if (msg->message_id == MSG_CACHED_RESOLUTION_DONE) {
+    // |this| may be deleted inside the signal (callers commonly call
+    // Destroy() from their SignalDone handler), so don't touch any members
+    // afterwards.
+    SignalDone(this);
+    return;
+  }
+  SignalThread::OnMessage(msg);
+}
+
 const char* inet_ntop(int af, const void* src, char* dst, socklen_t size) {
 #if defined(WEBRTC_WIN)
   return win32_inet_ntop(af, src, dst, size);
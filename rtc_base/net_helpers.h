@@ -28,6 +28,12 @@ namespace rtc {
 
 // AsyncResolver will perform async DNS resolution, signaling the result on
 // the SignalDone from AsyncResolverInterface when the operation completes.
+//
+// Successful resolutions are stored in a process-wide cache, so repeated
+// resolutions of the same hostname (e.g. the same TURN fleet across many
+// sessions) are answered from the cache without spawning a worker thread.
+// Cached entries are refreshed in the background once they reach half their
+// time-to-live and expire entirely at the full time-to-live.
 class AsyncResolver : public SignalThread, public AsyncResolverInterface {
  public:
   AsyncResolver();
@@ -44,11 +50,16 @@ class AsyncResolver : public SignalThread, public AsyncResolverInterface {
  protected:
   void DoWork() override;
   void OnWorkDone() override;
+  void OnMessage(Message* msg) override;
 
  private:
   SocketAddress addr_;
   std::vector<IPAddress> addresses_;
   int error_;
+  // True when this resolver was answered from the process-wide cache and its
+  // worker thread, if started, is only re-resolving to refresh the cached
+  // entry rather than to produce this resolver's result.
+  bool refreshing_cache_;
 };
 
 // rtc namespaced wrappers for inet_ntop and inet_pton so we can avoid
@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/netlink_network_monitor.h"
+
+#if defined(WEBRTC_LINUX)
+
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+
+namespace rtc {
+namespace {
+
+// Process-wide netlink subscription shared by all NetlinkNetworkMonitor
+// instances. The first started monitor opens the route socket and spawns the
+// reader thread; every event is then fanned out to all registered monitors.
+// The socket and thread are kept for the lifetime of the process once
+// created - they are a single mostly-idle fd and thread, and keeping them
+// avoids having to synchronize thread shutdown with event delivery.
+class NetlinkEventDispatcher {
+ public:
+  static NetlinkEventDispatcher* GetInstance() {
+    static NetlinkEventDispatcher* const instance = new NetlinkEventDispatcher;
+    return instance;
+  }
+
+  void AddObserver(NetworkMonitorBase* observer) {
+    CritScope cs(&lock_);
+    observers_.push_back(observer);
+    EnsureStartedLocked();
+  }
+
+  void RemoveObserver(NetworkMonitorBase* observer) {
+    CritScope cs(&lock_);
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer),
+                     observers_.end());
+  }
+
+ private:
+  NetlinkEventDispatcher() = default;
+
+  void EnsureStartedLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_) {
+    if (thread_) {
+      return;
+    }
+    netlink_fd_ = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (netlink_fd_ < 0) {
+      RTC_LOG_ERR(LS_ERROR) << "Failed to open netlink route socket";
+      return;
+    }
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+    if (bind(netlink_fd_, reinterpret_cast<struct sockaddr*>(&addr),
+             sizeof(addr)) < 0) {
+      RTC_LOG_ERR(LS_ERROR) << "Failed to bind netlink route socket";
+      close(netlink_fd_);
+      netlink_fd_ = -1;
+      return;
+    }
+    thread_.reset(new PlatformThread(&NetlinkEventDispatcher::ThreadRun, this,
+                                     "NetlinkMonitor"));
+    thread_->Start();
+  }
+
+  static void ThreadRun(void* obj) {
+    static_cast<NetlinkEventDispatcher*>(obj)->ProcessEvents();
+  }
+
+  void ProcessEvents() {
+    while (true) {
+      struct pollfd pfd = {netlink_fd_, POLLIN, 0};
+      if (poll(&pfd, 1, -1) < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        RTC_LOG_ERR(LS_ERROR) << "poll on netlink route socket failed";
+        return;
+      }
+      // Drain everything queued on the socket, so that a burst of kernel
+      // messages results in a single notification. The message contents are
+      // not interesting; any change triggers a re-enumeration.
+      char buffer[4096];
+      while (recv(netlink_fd_, buffer, sizeof(buffer), MSG_DONTWAIT) > 0) {
+      }
+      NotifyObservers();
+    }
+  }
+
+  void NotifyObservers() {
+    CritScope cs(&lock_);
+    for (NetworkMonitorBase* observer : observers_) {
+      // Posts to the observer's worker thread; the actual interface
+      // enumeration happens there.
+      observer->OnNetworksChanged();
+    }
+  }
+
+  CriticalSection lock_;
+  std::vector<NetworkMonitorBase*> observers_ RTC_GUARDED_BY(&lock_);
+  std::unique_ptr<PlatformThread> thread_ RTC_GUARDED_BY(&lock_);
+  int netlink_fd_ = -1;
+};
+
+}  // namespace
+
+NetlinkNetworkMonitor::NetlinkNetworkMonitor() = default;
+
+NetlinkNetworkMonitor::~NetlinkNetworkMonitor() {
+  Stop();
+}
+
+void NetlinkNetworkMonitor::Start() {
+  if (started_) {
+    return;
+  }
+  started_ = true;
+  NetlinkEventDispatcher::GetInstance()->AddObserver(this);
+}
+
+void NetlinkNetworkMonitor::Stop() {
+  if (!started_) {
+    return;
+  }
+  NetlinkEventDispatcher::GetInstance()->RemoveObserver(this);
+  started_ = false;
+}
+
+AdapterType NetlinkNetworkMonitor::GetAdapterType(
+    const std::string& interface_name) {
+  return ADAPTER_TYPE_UNKNOWN;
+}
+
+NetworkMonitorInterface* NetlinkNetworkMonitorFactory::CreateNetworkMonitor() {
+  return new NetlinkNetworkMonitor();
+}
+
+}  // namespace rtc
+
+#endif  // defined(WEBRTC_LINUX)
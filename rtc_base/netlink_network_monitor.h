@@ -0,0 +1,56 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_NETLINK_NETWORK_MONITOR_H_
+#define RTC_BASE_NETLINK_NETWORK_MONITOR_H_
+
+#if defined(WEBRTC_LINUX)
+
+#include <string>
+
+#include "rtc_base/network_monitor.h"
+
+namespace rtc {
+
+// Event-driven network monitor for Linux. Interface and address changes are
+// delivered through a netlink route socket instead of being discovered by the
+// BasicNetworkManager polling timer. All monitor instances in the process
+// share a single netlink socket and reader thread, so any number of network
+// managers cost one kernel subscription; change events are fanned out to
+// every started monitor on its own worker thread.
+//
+// Install before creating network managers, e.g. with:
+//   NetworkMonitorFactory::SetFactory(new NetlinkNetworkMonitorFactory());
+class NetlinkNetworkMonitor : public NetworkMonitorBase {
+ public:
+  NetlinkNetworkMonitor();
+  ~NetlinkNetworkMonitor() override;
+
+  void Start() override;
+  void Stop() override;
+
+  // Returns ADAPTER_TYPE_UNKNOWN; the network manager then falls back to its
+  // interface name based heuristics.
+  AdapterType GetAdapterType(const std::string& interface_name) override;
+
+ private:
+  bool started_ = false;
+};
+
+class NetlinkNetworkMonitorFactory : public NetworkMonitorFactory {
+ public:
+  NetworkMonitorInterface* CreateNetworkMonitor() override;
+};
+
+}  // namespace rtc
+
+#endif  // defined(WEBRTC_LINUX)
+
+#endif  // RTC_BASE_NETLINK_NETWORK_MONITOR_H_
@@ -0,0 +1,59 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/netlink_network_monitor.h"
+
+#if defined(WEBRTC_LINUX)
+
+#include <memory>
+
+#include "rtc_base/thread.h"
+#include "test/gtest.h"
+
+namespace rtc {
+
+// The monitors share one process-wide netlink subscription; make sure that
+// any number of them can be started, stopped and restarted in any order.
+TEST(NetlinkNetworkMonitorTest, StartAndStopSharedSubscription) {
+  AutoThread current_thread;
+
+  NetlinkNetworkMonitor first_monitor;
+  NetlinkNetworkMonitor second_monitor;
+  first_monitor.Start();
+  second_monitor.Start();
+  // Starting twice is a no-op.
+  first_monitor.Start();
+
+  EXPECT_EQ(ADAPTER_TYPE_UNKNOWN, first_monitor.GetAdapterType("eth0"));
+
+  second_monitor.Stop();
+  first_monitor.Stop();
+  // Stopping twice is a no-op.
+  first_monitor.Stop();
+
+  // A monitor started after the shared subscription already exists.
+  first_monitor.Start();
+  first_monitor.Stop();
+}
+
+TEST(NetlinkNetworkMonitorTest, FactoryCreatesMonitor) {
+  AutoThread current_thread;
+
+  NetlinkNetworkMonitorFactory factory;
+  std::unique_ptr<NetworkMonitorInterface> monitor(
+      factory.CreateNetworkMonitor());
+  ASSERT_TRUE(monitor != nullptr);
+  monitor->Start();
+  monitor->Stop();
+}
+
+}  // namespace rtc
+
+#endif  // defined(WEBRTC_LINUX)
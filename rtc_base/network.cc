@@ -948,6 +948,12 @@ void BasicNetworkManager::UpdateNetworksOnce() {
 
 void BasicNetworkManager::UpdateNetworksContinually() {
   UpdateNetworksOnce();
+  // With a network monitor attached, interface changes are signaled as they
+  // happen, so there is no need to keep polling; re-enumeration is triggered
+  // by OnNetworksChanged() instead.
+  if (network_monitor_) {
+    return;
+  }
   thread_->PostDelayed(RTC_FROM_HERE, kNetworksUpdateIntervalMs, this,
                        kUpdateNetworksMessage);
 }
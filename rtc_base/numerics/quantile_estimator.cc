@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/numerics/quantile_estimator.h"
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+constexpr int QuantileEstimator::kNumMarkers;
+
+QuantileEstimator::QuantileEstimator(double quantile) : quantile_(quantile) {
+  RTC_DCHECK_GT(quantile, 0.0);
+  RTC_DCHECK_LT(quantile, 1.0);
+  Reset();
+}
+
+void QuantileEstimator::Reset() {
+  sample_count_ = 0;
+  for (int i = 0; i < kNumMarkers; ++i) {
+    marker_height_[i] = 0.0;
+    marker_position_[i] = i + 1;
+  }
+  desired_position_[0] = 1.0;
+  desired_position_[1] = 1.0 + 2.0 * quantile_;
+  desired_position_[2] = 1.0 + 4.0 * quantile_;
+  desired_position_[3] = 3.0 + 2.0 * quantile_;
+  desired_position_[4] = 5.0;
+}
+
+void QuantileEstimator::AddSample(double sample) {
+  if (sample_count_ < kNumMarkers) {
+    // Bootstrap phase: keep the first five samples sorted in the marker
+    // heights.
+    marker_height_[sample_count_++] = sample;
+    std::sort(marker_height_, marker_height_ + sample_count_);
+    return;
+  }
+
+  // Find the cell the new sample falls into, adjusting the extreme markers
+  // if it falls outside the current range.
+  int cell;
+  if (sample < marker_height_[0]) {
+    marker_height_[0] = sample;
+    cell = 0;
+  } else if (sample >= marker_height_[kNumMarkers - 1]) {
+    marker_height_[kNumMarkers - 1] = sample;
+    cell = kNumMarkers - 2;
+  } else {
+    cell = 0;
+    while (sample >= marker_height_[cell + 1])
+      ++cell;
+  }
+
+  for (int i = cell + 1; i < kNumMarkers; ++i)
+    marker_position_[i] += 1.0;
+  ++sample_count_;
+
+  // Desired positions advance by 0, q/2, q, (1+q)/2 and 1 per sample.
+  desired_position_[1] += quantile_ / 2.0;
+  desired_position_[2] += quantile_;
+  desired_position_[3] += (1.0 + quantile_) / 2.0;
+  desired_position_[4] += 1.0;
+
+  // Nudge the three middle markers towards their desired positions, using
+  // piecewise-parabolic interpolation between the neighboring markers, or
+  // linear interpolation if that would break the height ordering.
+  for (int i = 1; i < kNumMarkers - 1; ++i) {
+    double delta = desired_position_[i] - marker_position_[i];
+    if ((delta >= 1.0 &&
+         marker_position_[i + 1] - marker_position_[i] > 1.0) ||
+        (delta <= -1.0 &&
+         marker_position_[i - 1] - marker_position_[i] < -1.0)) {
+      double direction = delta >= 0.0 ? 1.0 : -1.0;
+      double pos_prev = marker_position_[i - 1];
+      double pos = marker_position_[i];
+      double pos_next = marker_position_[i + 1];
+      double parabolic =
+          marker_height_[i] +
+          direction / (pos_next - pos_prev) *
+              ((pos - pos_prev + direction) * (marker_height_[i + 1] -
+                                               marker_height_[i]) /
+                   (pos_next - pos) +
+               (pos_next - pos - direction) * (marker_height_[i] -
+                                               marker_height_[i - 1]) /
+                   (pos - pos_prev));
+      if (marker_height_[i - 1] < parabolic &&
+          parabolic < marker_height_[i + 1]) {
+        marker_height_[i] = parabolic;
+      } else {
+        // Linear fallback towards the neighbor in the movement direction.
+        int neighbor = i + static_cast<int>(direction);
+        marker_height_[i] +=
+            direction * (marker_height_[neighbor] - marker_height_[i]) /
+            (marker_position_[neighbor] - pos);
+      }
+      marker_position_[i] += direction;
+    }
+  }
+}
+
+double QuantileEstimator::GetEstimate() const {
+  if (sample_count_ == 0)
+    return 0.0;
+  if (sample_count_ < static_cast<size_t>(kNumMarkers)) {
+    // Exact quantile of the sorted bootstrap samples.
+    size_t index = static_cast<size_t>(quantile_ * (sample_count_ - 1) + 0.5);
+    return marker_height_[std::min(index, sample_count_ - 1)];
+  }
+  return marker_height_[(kNumMarkers - 1) / 2];
+}
+
+}  // namespace webrtc
@@ -0,0 +1,66 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_NUMERICS_QUANTILE_ESTIMATOR_H_
+#define RTC_BASE_NUMERICS_QUANTILE_ESTIMATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+
+// Streaming estimator of a single quantile based on the P-square algorithm
+// (Jain & Chlamtac, 1985). Unlike PercentileFilter it does not keep the
+// observed samples around: it maintains five markers that are nudged towards
+// the requested quantile as samples arrive, so both the per-sample cost and
+// the memory footprint are constant regardless of how many samples have been
+// added. The estimate is exact for the first five samples and converges to
+// the true quantile afterwards.
+//
+// Intended for hot paths that previously kept a sample window and scanned or
+// sorted it on every update.
+class QuantileEstimator {
+ public:
+  // |quantile| must be in (0, 1), e.g. 0.95 for the 95th percentile.
+  explicit QuantileEstimator(double quantile);
+
+  // QuantileEstimator is copyable so it can live in copyable filter classes.
+
+  // Adds a new sample, updating the markers in constant time.
+  void AddSample(double sample);
+
+  // Returns the current estimate of the configured quantile, or 0 if no
+  // samples have been added.
+  double GetEstimate() const;
+
+  // Returns the number of samples added since construction or last Reset().
+  size_t SampleCount() const { return sample_count_; }
+
+  // Resets to the initial state before any samples were added.
+  void Reset();
+
+ private:
+  static constexpr int kNumMarkers = 5;
+
+  // Not const so that the default copy assignment stays available.
+  double quantile_;
+  size_t sample_count_;
+  // Heights of the five markers; marker 2 (0-indexed) tracks the quantile.
+  // During the first five samples this doubles as sorted sample storage.
+  double marker_height_[kNumMarkers];
+  // Actual marker positions, in number of samples.
+  double marker_position_[kNumMarkers];
+  // Positions the markers should ideally be at, advanced per sample.
+  double desired_position_[kNumMarkers];
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_NUMERICS_QUANTILE_ESTIMATOR_H_
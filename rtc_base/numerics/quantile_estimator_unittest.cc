@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/numerics/quantile_estimator.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(QuantileEstimatorTest, NoSamples) {
+  QuantileEstimator estimator(0.5);
+  EXPECT_EQ(0.0, estimator.GetEstimate());
+  EXPECT_EQ(0u, estimator.SampleCount());
+}
+
+TEST(QuantileEstimatorTest, ExactForFewSamples) {
+  QuantileEstimator estimator(0.5);
+  estimator.AddSample(10.0);
+  EXPECT_EQ(10.0, estimator.GetEstimate());
+  estimator.AddSample(4.0);
+  estimator.AddSample(8.0);
+  // Median of {4, 8, 10}.
+  EXPECT_EQ(8.0, estimator.GetEstimate());
+}
+
+TEST(QuantileEstimatorTest, ConvergesToMedianOfUniformDistribution) {
+  QuantileEstimator estimator(0.5);
+  Random random(17);
+  for (int i = 0; i < 10000; ++i)
+    estimator.AddSample(100.0 * random.Rand<double>());
+  EXPECT_NEAR(50.0, estimator.GetEstimate(), 2.0);
+}
+
+TEST(QuantileEstimatorTest, TracksHighPercentile) {
+  QuantileEstimator estimator(0.95);
+  Random random(42);
+  std::vector<double> samples;
+  for (int i = 0; i < 10000; ++i) {
+    double sample = random.Gaussian(1000.0, 250.0);
+    samples.push_back(sample);
+    estimator.AddSample(sample);
+  }
+  std::sort(samples.begin(), samples.end());
+  double true_percentile = samples[samples.size() * 95 / 100];
+  EXPECT_NEAR(true_percentile, estimator.GetEstimate(),
+              0.05 * true_percentile);
+}
+
+TEST(QuantileEstimatorTest, ResetForgetsHistory) {
+  QuantileEstimator estimator(0.5);
+  for (int i = 0; i < 100; ++i)
+    estimator.AddSample(1000.0);
+  estimator.Reset();
+  EXPECT_EQ(0u, estimator.SampleCount());
+  estimator.AddSample(1.0);
+  EXPECT_EQ(1.0, estimator.GetEstimate());
+}
+
+TEST(QuantileEstimatorTest, MonotoneInputs) {
+  QuantileEstimator estimator(0.9);
+  for (int i = 1; i <= 1000; ++i)
+    estimator.AddSample(i);
+  EXPECT_NEAR(900.0, estimator.GetEstimate(), 25.0);
+}
+
+}  // namespace webrtc
@@ -21,12 +21,15 @@
 #include <openssl/ssl.h>
 #endif
 
+#include <list>
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "absl/memory/memory.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/openssl.h"
@@ -35,6 +38,7 @@
 #include "rtc_base/openssl_identity.h"
 #include "rtc_base/ssl_certificate.h"
 #include "rtc_base/stream.h"
+#include "rtc_base/string_encode.h"
 #include "rtc_base/thread.h"
 #include "rtc_base/time_utils.h"
 
@@ -146,6 +150,79 @@ void TimeCallbackForTesting(const SSL* ssl, struct timeval* out_clock) {
 }
 #endif
 
+// Process-wide cache of DTLS client sessions, keyed by the remote peer's
+// certificate digest. A reconnect to a peer whose fingerprint we already
+// completed a handshake against can then offer session resumption, skipping
+// the certificate exchange and asymmetric crypto of a full handshake. Only
+// the client role can use this: server-side resumption would need session
+// ids or ticket keys shared across SSL contexts, and every stream adapter
+// builds its own context.
+//
+// The cache holds at most kDtlsSessionCacheSize entries, evicting the least
+// recently used one when full. Sessions are roughly a kilobyte each, and a
+// process that connects to many distinct peers (each self-signed certificate
+// yields a new digest) would otherwise grow the cache without bound; only
+// recently seen peers are plausible resumption candidates anyway.
+const size_t kDtlsSessionCacheSize = 50;
+
+class DtlsSessionCache {
+ public:
+  static DtlsSessionCache* GetInstance() {
+    static DtlsSessionCache* const instance = new DtlsSessionCache();
+    return instance;
+  }
+
+  // Returns the cached session for |digest_key| with an added reference, or
+  // null. The caller is responsible for freeing the reference.
+  SSL_SESSION* Lookup(const std::string& digest_key) {
+    CritScope cs(&lock_);
+    auto it = index_.find(digest_key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    // Mark the entry as most recently used.
+    sessions_.splice(sessions_.begin(), sessions_, it->second);
+    SSL_SESSION_up_ref(it->second->second);
+    return it->second->second;
+  }
+
+  // Stores |session|, taking over the caller's reference. Any previously
+  // cached session with the same key is replaced; if the cache is full, the
+  // least recently used entry is evicted.
+  void Add(const std::string& digest_key, SSL_SESSION* session) {
+    CritScope cs(&lock_);
+    auto it = index_.find(digest_key);
+    if (it != index_.end()) {
+      SSL_SESSION_free(it->second->second);
+      it->second->second = session;
+      sessions_.splice(sessions_.begin(), sessions_, it->second);
+      return;
+    }
+    if (sessions_.size() >= kDtlsSessionCacheSize) {
+      SSL_SESSION_free(sessions_.back().second);
+      index_.erase(sessions_.back().first);
+      sessions_.pop_back();
+    }
+    sessions_.emplace_front(digest_key, session);
+    index_[digest_key] = sessions_.begin();
+  }
+
+ private:
+  // Most recently used entries first.
+  using SessionList = std::list<std::pair<std::string, SSL_SESSION*>>;
+
+  CriticalSection lock_;
+  SessionList sessions_ RTC_GUARDED_BY(lock_);
+  std::map<std::string, SessionList::iterator> index_ RTC_GUARDED_BY(lock_);
+};
+
+std::string DtlsSessionCacheKey(const std::string& digest_alg,
+                                const Buffer& digest) {
+  return digest_alg + ":" +
+         hex_encode(reinterpret_cast<const char*>(digest.data()),
+                    digest.size());
+}
+
 }  // namespace
 
 //////////////////////////////////////////////////////////////////////
@@ -807,6 +884,19 @@ int OpenSSLStreamAdapter::BeginSSL() {
     // before parsing. This is done internally by BoringSSL for DTLS.
     SSL_set_read_ahead(ssl_, 1);
 #endif
+    if (role_ == SSL_CLIENT && HasPeerCertificateDigest()) {
+      // Offer resumption of a session previously established with, and
+      // authenticated against, the same certificate fingerprint.
+      SSL_SESSION* cached = DtlsSessionCache::GetInstance()->Lookup(
+          DtlsSessionCacheKey(peer_certificate_digest_algorithm_,
+                              peer_certificate_digest_value_));
+      if (cached) {
+        if (SSL_set_session(ssl_, cached) == 1) {
+          RTC_LOG(LS_INFO) << "Offering cached DTLS session for resumption.";
+        }
+        SSL_SESSION_free(cached);
+      }
+    }
   }
 
   SSL_set_mode(ssl_, SSL_MODE_ENABLE_PARTIAL_WRITE |
@@ -829,11 +919,38 @@ int OpenSSLStreamAdapter::ContinueSSL() {
   switch (ssl_error) {
     case SSL_ERROR_NONE:
       RTC_LOG(LS_VERBOSE) << " -- success";
+      if (!peer_cert_chain_ && SSL_session_reused(ssl_)) {
+        // An abbreviated handshake carries no Certificate message, so the
+        // verify callback never ran. Recover the peer certificate that was
+        // authenticated when the session was first established and verify it
+        // against the signaled digest, which is always known here since
+        // resumption is only offered once the digest is set.
+        X509* cert = SSL_get_peer_certificate(ssl_);
+        if (cert) {
+          peer_cert_chain_.reset(
+              new SSLCertChain(absl::make_unique<OpenSSLCertificate>(cert)));
+          X509_free(cert);
+        }
+        if (!VerifyPeerCertificate()) {
+          RTC_LOG(LS_ERROR)
+              << "Certificate of resumed session failed verification.";
+          return -1;
+        }
+      }
       // By this point, OpenSSL should have given us a certificate, or errored
       // out if one was missing.
       RTC_DCHECK(peer_cert_chain_ || !GetClientAuthEnabled());
 
       state_ = SSL_CONNECTED;
+      if (ssl_mode_ == SSL_MODE_DTLS && role_ == SSL_CLIENT &&
+          HasPeerCertificateDigest()) {
+        // Cache the session keyed by the peer's fingerprint, so a later
+        // connection to the same peer can offer an abbreviated handshake.
+        DtlsSessionCache::GetInstance()->Add(
+            DtlsSessionCacheKey(peer_certificate_digest_algorithm_,
+                                peer_certificate_digest_value_),
+            SSL_get1_session(ssl_));
+      }
       if (!WaitingToVerifyPeerCertificate()) {
         // We have everything we need to start the connection, so signal
         // SE_OPEN. If we need a client certificate fingerprint and don't have
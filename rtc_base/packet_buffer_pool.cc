@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/packet_buffer_pool.h"
+
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace rtc {
+
+// A pool slot. Overrides Release() so that dropping the last downstream
+// reference returns the slot to the pool's free list instead of deleting it;
+// the loaned-out CopyOnWriteBuffer therefore holds the only reference and
+// can be modified in place without a copy-on-write clone.
+class PacketBufferPool::PooledBuffer : public RefCountedObject<Buffer> {
+ public:
+  PooledBuffer(scoped_refptr<RefCountedObject<SharedState>> state,
+               size_t size,
+               size_t capacity)
+      : RefCountedObject<Buffer>(size, capacity), state_(std::move(state)) {}
+
+  RefCountReleaseStatus Release() const override {
+    const RefCountReleaseStatus status = ref_count_.DecRef();
+    if (status == RefCountReleaseStatus::kDroppedLastRef) {
+      // The last reference may be dropped on any thread. Recycle the slot if
+      // the pool is still alive, otherwise fall back to normal deletion.
+      bool recycled = false;
+      {
+        CritScope cs(&state_->lock);
+        if (state_->pool_alive) {
+          state_->free_buffers.push_back(const_cast<PooledBuffer*>(this));
+          recycled = true;
+        }
+      }
+      if (!recycled) {
+        delete this;
+      }
+    }
+    return status;
+  }
+
+ private:
+  const scoped_refptr<RefCountedObject<SharedState>> state_;
+};
+
+PacketBufferPool::PacketBufferPool(size_t buffer_size,
+                                   size_t max_number_of_buffers)
+    : buffer_size_(buffer_size),
+      max_number_of_buffers_(max_number_of_buffers),
+      state_(new RefCountedObject<SharedState>()) {
+  RTC_DCHECK_GT(buffer_size, 0);
+  RTC_DCHECK_GT(max_number_of_buffers, 0);
+}
+
+PacketBufferPool::~PacketBufferPool() {
+  std::vector<PooledBuffer*> free_buffers;
+  {
+    CritScope cs(&state_->lock);
+    state_->pool_alive = false;
+    free_buffers.swap(state_->free_buffers);
+  }
+  for (PooledBuffer* buffer : free_buffers) {
+    delete buffer;
+  }
+  delete reserved_;
+}
+
+uint8_t* PacketBufferPool::ReserveBuffer() {
+  RTC_CHECK_RUNS_SERIALIZED(&race_checker_);
+  RTC_DCHECK(reserved_ == nullptr);
+  // Prefer a recycled slot whose downstream references are all gone.
+  {
+    CritScope cs(&state_->lock);
+    if (!state_->free_buffers.empty()) {
+      reserved_ = state_->free_buffers.back();
+      state_->free_buffers.pop_back();
+    }
+  }
+  if (reserved_) {
+    reserved_->SetSize(buffer_size_);
+    return reserved_->data();
+  }
+  if (num_buffers_ >= max_number_of_buffers_) {
+    return nullptr;
+  }
+  ++num_buffers_;
+  reserved_ = new PooledBuffer(state_, buffer_size_, buffer_size_);
+  return reserved_->data();
+}
+
+CopyOnWriteBuffer PacketBufferPool::FinishBuffer(size_t size) {
+  RTC_CHECK_RUNS_SERIALIZED(&race_checker_);
+  RTC_DCHECK(reserved_ != nullptr);
+  RTC_DCHECK_LE(size, buffer_size_);
+  PooledBuffer* buffer = reserved_;
+  reserved_ = nullptr;
+  buffer->SetSize(size);
+  return CopyOnWriteBuffer(scoped_refptr<RefCountedObject<Buffer>>(buffer));
+}
+
+namespace {
+
+absl::optional<CopyOnWriteBuffer>& StagedPacket() {
+  thread_local absl::optional<CopyOnWriteBuffer> staged;
+  return staged;
+}
+
+}  // namespace
+
+void ReceivedPacketHandoff::Stage(CopyOnWriteBuffer buffer) {
+  StagedPacket() = std::move(buffer);
+}
+
+void ReceivedPacketHandoff::Clear() {
+  StagedPacket().reset();
+}
+
+absl::optional<CopyOnWriteBuffer> ReceivedPacketHandoff::Take(const void* data,
+                                                              size_t size) {
+  absl::optional<CopyOnWriteBuffer>& staged = StagedPacket();
+  if (!staged || staged->cdata() != data || size > staged->size()) {
+    return absl::nullopt;
+  }
+  absl::optional<CopyOnWriteBuffer> taken = std::move(staged);
+  staged.reset();
+  taken->SetSize(size);
+  return taken;
+}
+
+}  // namespace rtc
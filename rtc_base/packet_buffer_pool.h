@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_PACKET_BUFFER_POOL_H_
+#define RTC_BASE_PACKET_BUFFER_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/scoped_refptr.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace rtc {
+
+// Simple recycling pool of packet-sized buffers for the datagram receive
+// path. A slot is reserved with ReserveBuffer(), filled in place (e.g. by
+// recvfrom) and then wrapped into a CopyOnWriteBuffer with FinishBuffer().
+// The returned buffer holds the only reference to the pooled storage, so the
+// consumer can modify it (e.g. decrypt SRTP and trim the auth tag) in place
+// without triggering a copy-on-write clone; when the last downstream
+// reference is dropped the slot returns itself to the pool for reuse, so
+// steady-state receive traffic does not touch the heap. Reserve/Finish are
+// not thread safe and intended to be called on the network thread; the
+// returned buffers may be released from any thread.
+class PacketBufferPool {
+ public:
+  PacketBufferPool(size_t buffer_size, size_t max_number_of_buffers);
+  ~PacketBufferPool();
+
+  // Reserves a slot and returns its writable storage of buffer_size() bytes.
+  // Returns null if all |max_number_of_buffers| slots are still referenced
+  // downstream; callers should then fall back to a one-off allocation.
+  uint8_t* ReserveBuffer();
+
+  // Wraps the slot returned by the preceding ReserveBuffer() call into a
+  // CopyOnWriteBuffer holding its first |size| bytes, without copying. Must
+  // be called exactly once per successful ReserveBuffer() call.
+  CopyOnWriteBuffer FinishBuffer(size_t size);
+
+  size_t buffer_size() const { return buffer_size_; }
+
+ private:
+  class PooledBuffer;
+
+  // State shared between the pool and its loaned-out slots. A slot pushes
+  // itself onto |free_buffers| when its last downstream reference is dropped,
+  // which may happen on any thread; if the pool is already gone the slot
+  // deletes itself instead.
+  struct SharedState {
+    CriticalSection lock;
+    bool pool_alive RTC_GUARDED_BY(lock) = true;
+    std::vector<PooledBuffer*> free_buffers RTC_GUARDED_BY(lock);
+  };
+
+  RaceChecker race_checker_;
+  const size_t buffer_size_;
+  const size_t max_number_of_buffers_;
+  const scoped_refptr<RefCountedObject<SharedState>> state_;
+  // Total number of slots created, including those loaned out.
+  size_t num_buffers_ = 0;
+  // Slot handed out by ReserveBuffer() and not yet finished.
+  PooledBuffer* reserved_ = nullptr;
+};
+
+// The datagram receive path hands packets up through layered (const char*,
+// size_t) read signals (port -> ICE -> DTLS -> RTP transport), so the
+// terminal consumer normally has to materialize its own copy of the payload.
+// When the receiving socket has read the packet into a pooled buffer, it can
+// stage that buffer here for the duration of the synchronous dispatch; the
+// terminal consumer then adopts the storage instead of copying it. The slot
+// is per thread, and adoption is keyed on the payload pointer so that layers
+// which re-frame the packet (e.g. TURN channel data) simply miss and fall
+// back to copying.
+class ReceivedPacketHandoff {
+ public:
+  // Stages |buffer| for the current thread. Called by the receiving socket
+  // right before dispatching the read signal for the packet held in |buffer|.
+  static void Stage(CopyOnWriteBuffer buffer);
+
+  // Drops any still-staged buffer. Called after the dispatch returns.
+  static void Clear();
+
+  // Moves the staged buffer out, trimmed to |size|, if |data| points at its
+  // first byte and |size| does not exceed it; returns nullopt otherwise. At
+  // most one consumer can adopt a given packet, and if nothing else kept a
+  // reference the adopted buffer is exclusively owned, so it can be modified
+  // (e.g. decrypted) in place without triggering a copy-on-write clone.
+  static absl::optional<CopyOnWriteBuffer> Take(const void* data, size_t size);
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_PACKET_BUFFER_POOL_H_
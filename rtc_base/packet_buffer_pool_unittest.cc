@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/packet_buffer_pool.h"
+
+#include <string.h>
+
+#include "rtc_base/copy_on_write_buffer.h"
+#include "test/gtest.h"
+
+namespace rtc {
+
+TEST(PacketBufferPoolTest, FinishedBufferHoldsWrittenData) {
+  PacketBufferPool pool(16, 2);
+  uint8_t* data = pool.ReserveBuffer();
+  ASSERT_TRUE(data != nullptr);
+  memcpy(data, "abcd", 4);
+  CopyOnWriteBuffer buffer = pool.FinishBuffer(4);
+  EXPECT_EQ(4u, buffer.size());
+  EXPECT_EQ(0, memcmp(buffer.data(), "abcd", 4));
+}
+
+TEST(PacketBufferPoolTest, ReusesStorageOnceReferenceIsDropped) {
+  PacketBufferPool pool(16, 1);
+  uint8_t* first = pool.ReserveBuffer();
+  ASSERT_TRUE(first != nullptr);
+  {
+    CopyOnWriteBuffer buffer = pool.FinishBuffer(4);
+    // The only slot is referenced by |buffer|, so the pool is exhausted.
+    EXPECT_TRUE(pool.ReserveBuffer() == nullptr);
+  }
+  // Dropping the last reference makes the slot reusable.
+  uint8_t* second = pool.ReserveBuffer();
+  EXPECT_EQ(first, second);
+  pool.FinishBuffer(0);
+}
+
+TEST(PacketBufferPoolTest, SharedStorageIsNotReusedWhileReferenced) {
+  PacketBufferPool pool(16, 2);
+  uint8_t* first = pool.ReserveBuffer();
+  ASSERT_TRUE(first != nullptr);
+  memcpy(first, "abcd", 4);
+  CopyOnWriteBuffer held = pool.FinishBuffer(4);
+
+  // A second buffer must not alias the storage that |held| still references.
+  uint8_t* second = pool.ReserveBuffer();
+  ASSERT_TRUE(second != nullptr);
+  EXPECT_NE(first, second);
+  memcpy(second, "efgh", 4);
+  pool.FinishBuffer(4);
+
+  EXPECT_EQ(0, memcmp(held.data(), "abcd", 4));
+}
+
+TEST(PacketBufferPoolTest, FinishedBufferIsExclusivelyOwned) {
+  PacketBufferPool pool(16, 1);
+  uint8_t* data = pool.ReserveBuffer();
+  ASSERT_TRUE(data != nullptr);
+  CopyOnWriteBuffer buffer = pool.FinishBuffer(4);
+  // In-place modification must not clone the pooled storage.
+  EXPECT_EQ(data, buffer.data());
+  buffer.SetSize(2);
+  EXPECT_EQ(data, buffer.data());
+}
+
+TEST(ReceivedPacketHandoffTest, TakeMatchesStagedPointerAndTrims) {
+  PacketBufferPool pool(16, 1);
+  uint8_t* data = pool.ReserveBuffer();
+  ASSERT_TRUE(data != nullptr);
+  memcpy(data, "abcd", 4);
+  ReceivedPacketHandoff::Stage(pool.FinishBuffer(4));
+
+  absl::optional<CopyOnWriteBuffer> taken = ReceivedPacketHandoff::Take(data, 3);
+  ASSERT_TRUE(taken.has_value());
+  EXPECT_EQ(3u, taken->size());
+  // Adoption is zero copy and transfers exclusive ownership.
+  EXPECT_EQ(data, taken->data());
+  // A packet can only be adopted once.
+  EXPECT_FALSE(ReceivedPacketHandoff::Take(data, 3).has_value());
+}
+
+TEST(ReceivedPacketHandoffTest, TakeRejectsMismatchedPointerOrSize) {
+  PacketBufferPool pool(16, 1);
+  uint8_t* data = pool.ReserveBuffer();
+  ASSERT_TRUE(data != nullptr);
+  ReceivedPacketHandoff::Stage(pool.FinishBuffer(4));
+
+  // Offset into the payload (e.g. a TURN channel data header was peeled off)
+  // or a size beyond the staged packet must miss.
+  EXPECT_FALSE(ReceivedPacketHandoff::Take(data + 1, 3).has_value());
+  EXPECT_FALSE(ReceivedPacketHandoff::Take(data, 5).has_value());
+  ReceivedPacketHandoff::Clear();
+
+  // After Clear() nothing is staged.
+  EXPECT_FALSE(ReceivedPacketHandoff::Take(data, 4).has_value());
+}
+
+}  // namespace rtc
@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/perf_sample.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "rtc_base/critical_section.h"
+#include "rtc_base/system/arch.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_base/trace_event.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(_MSC_VER)
+#include <x86intrin.h>
+#endif
+
+namespace rtc {
+namespace perf_sample {
+namespace {
+
+// Power-of-two size of the per-thread category table; categories beyond
+// this (per thread) are silently dropped. Far more slots than sanctioned
+// instrumentation points.
+constexpr int kMaxCategoriesPerThread = 64;
+
+// EWMA smoothing: ewma += (sample - ewma) / 16.
+constexpr int kEwmaShift = 4;
+
+// Publish a TRACE_COUNTER for a category every this many samples, so
+// captures carry the aggregate without per-call events.
+constexpr int64_t kPublishInterval = 1024;
+
+int HistogramBucket(uint64_t cycles) {
+  int bucket = 0;
+  while (cycles > 1 && bucket < kHistogramBuckets - 1) {
+    cycles >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Per-category counters. Written by the owning thread only; read by
+// GetSummaries() from other threads, hence the relaxed atomics.
+struct CategorySlot {
+  std::atomic<const char*> category{nullptr};
+  std::atomic<int64_t> samples{0};
+  std::atomic<int64_t> total_cycles{0};
+  std::atomic<int64_t> ewma_cycles{0};
+  std::atomic<int64_t> histogram[kHistogramBuckets] = {};
+};
+
+class ThreadSampleTable {
+ public:
+  void Record(const char* category, uint64_t cycles) {
+    CategorySlot* slot = FindOrAddSlot(category);
+    if (!slot)
+      return;
+    slot->total_cycles.fetch_add(cycles, std::memory_order_relaxed);
+    int64_t ewma = slot->ewma_cycles.load(std::memory_order_relaxed);
+    ewma += (static_cast<int64_t>(cycles) - ewma) >> kEwmaShift;
+    slot->ewma_cycles.store(ewma, std::memory_order_relaxed);
+    slot->histogram[HistogramBucket(cycles)].fetch_add(
+        1, std::memory_order_relaxed);
+    int64_t samples =
+        slot->samples.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (samples % kPublishInterval == 0)
+      TRACE_COUNTER1("webrtc_perf", category, ewma);
+  }
+
+  // Merges this table into |out|, summing counters and averaging EWMAs of
+  // threads that saw the same category.
+  void AccumulateInto(std::vector<CategorySummary>* out) const {
+    for (const CategorySlot& slot : slots_) {
+      const char* category = slot.category.load(std::memory_order_acquire);
+      if (!category)
+        continue;
+      CategorySummary* summary = nullptr;
+      for (CategorySummary& existing : *out) {
+        if (existing.category == category) {
+          summary = &existing;
+          break;
+        }
+      }
+      if (!summary) {
+        out->push_back(CategorySummary());
+        summary = &out->back();
+        summary->category = category;
+        summary->samples = 0;
+        summary->total_cycles = 0;
+        summary->ewma_cycles = 0;
+        std::fill(summary->histogram,
+                  summary->histogram + kHistogramBuckets, 0);
+      }
+      int64_t samples = slot.samples.load(std::memory_order_relaxed);
+      int64_t prior_samples = summary->samples;
+      summary->samples += samples;
+      summary->total_cycles +=
+          slot.total_cycles.load(std::memory_order_relaxed);
+      // Sample-weighted average of the per-thread EWMAs.
+      if (summary->samples > 0) {
+        summary->ewma_cycles =
+            (summary->ewma_cycles * prior_samples +
+             static_cast<double>(
+                 slot.ewma_cycles.load(std::memory_order_relaxed)) *
+                 samples) /
+            summary->samples;
+      }
+      for (int i = 0; i < kHistogramBuckets; ++i)
+        summary->histogram[i] +=
+            slot.histogram[i].load(std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  CategorySlot* FindOrAddSlot(const char* category) {
+    size_t index = (reinterpret_cast<uintptr_t>(category) >> 4) &
+                   (kMaxCategoriesPerThread - 1);
+    for (int probe = 0; probe < kMaxCategoriesPerThread; ++probe) {
+      CategorySlot& slot = slots_[index];
+      const char* existing = slot.category.load(std::memory_order_relaxed);
+      if (existing == category)
+        return &slot;
+      if (!existing) {
+        // Only the owning thread writes the table, so no CAS is needed; the
+        // release store makes the key visible to GetSummaries() readers.
+        slot.category.store(category, std::memory_order_release);
+        return &slot;
+      }
+      index = (index + 1) & (kMaxCategoriesPerThread - 1);
+    }
+    return nullptr;
+  }
+
+  CategorySlot slots_[kMaxCategoriesPerThread];
+};
+
+class SampleTableRegistry {
+ public:
+  static SampleTableRegistry& Instance() {
+    static SampleTableRegistry* const instance = new SampleTableRegistry();
+    return *instance;
+  }
+
+  ThreadSampleTable* RegisterCurrentThread() {
+    CritScope lock(&crit_);
+    tables_.push_back(std::unique_ptr<ThreadSampleTable>(
+        new ThreadSampleTable()));
+    return tables_.back().get();
+  }
+
+  // Exited threads' tables stay in |tables_| so their counts survive; the
+  // tables are small and threads with samplers are long-lived, so nothing
+  // is recycled.
+  std::vector<CategorySummary> GetSummaries() const {
+    std::vector<CategorySummary> summaries;
+    CritScope lock(&crit_);
+    for (const auto& table : tables_)
+      table->AccumulateInto(&summaries);
+    return summaries;
+  }
+
+  void Reset() {
+    CritScope lock(&crit_);
+    tables_.clear();
+    // Live threads re-register lazily through a fresh thread-local below;
+    // the old pointers are gone, so invalidate them via the epoch.
+    ++epoch_;
+  }
+
+  int epoch() const {
+    CritScope lock(&crit_);
+    return epoch_;
+  }
+
+ private:
+  rtc::CriticalSection crit_;
+  std::vector<std::unique_ptr<ThreadSampleTable>> tables_
+      RTC_GUARDED_BY(crit_);
+  int epoch_ RTC_GUARDED_BY(crit_) = 0;
+};
+
+ThreadSampleTable* GetCurrentThreadTable() {
+  thread_local ThreadSampleTable* table = nullptr;
+  thread_local int table_epoch = -1;
+  int current_epoch = SampleTableRegistry::Instance().epoch();
+  if (!table || table_epoch != current_epoch) {
+    table = SampleTableRegistry::Instance().RegisterCurrentThread();
+    table_epoch = current_epoch;
+  }
+  return table;
+}
+
+}  // namespace
+
+uint64_t ScopedPerfSample::ReadCycleCounter() {
+#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(_MSC_VER)
+  return __rdtsc();
+#else
+  return static_cast<uint64_t>(rtc::TimeNanos());
+#endif
+}
+
+ScopedPerfSample::~ScopedPerfSample() {
+  uint64_t cycles = ReadCycleCounter() - start_cycles_;
+  GetCurrentThreadTable()->Record(category_, cycles);
+}
+
+std::vector<CategorySummary> GetSummaries() {
+  return SampleTableRegistry::Instance().GetSummaries();
+}
+
+void ResetForTesting() {
+  SampleTableRegistry::Instance().Reset();
+}
+
+}  // namespace perf_sample
+}  // namespace rtc
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Scoped cycle-count sampling for hot functions.
+//
+// RTC_SCOPED_PERF_SAMPLE("PacingController::ProcessPackets") measures the
+// cycles (TSC on x86, wall-clock nanoseconds elsewhere) spent in the
+// enclosing scope and aggregates them per category in thread-local storage:
+// a sample count, an exponentially weighted moving average and a log2
+// histogram. Aggregation is lock-free on the hot path; a periodic summary is
+// published as a TRACE_COUNTER through the event tracer so captures carry
+// overhead accounting without per-call trace events.
+//
+// The category must be a string literal (categories are keyed by pointer).
+// Define RTC_DISABLE_PERF_SAMPLING to compile the macro away entirely.
+
+#ifndef RTC_BASE_PERF_SAMPLE_H_
+#define RTC_BASE_PERF_SAMPLE_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace rtc {
+namespace perf_sample {
+
+// Number of log2 buckets in the per-category duration histogram. Bucket i
+// counts samples with 2^i <= cycles < 2^(i+1); the last bucket absorbs the
+// overflow.
+constexpr int kHistogramBuckets = 40;
+
+// Aggregated view of one category across all threads, live and exited.
+struct CategorySummary {
+  const char* category;
+  int64_t samples;
+  int64_t total_cycles;
+  // EWMA of cycles per sample (alpha = 1/16). When several threads sample
+  // the same category this is the average of the per-thread EWMAs.
+  double ewma_cycles;
+  int64_t histogram[kHistogramBuckets];
+};
+
+// Returns a summary per category observed so far. Counters are read without
+// stopping the samplers, so values from currently running threads are
+// slightly stale but internally consistent enough for monitoring.
+std::vector<CategorySummary> GetSummaries();
+
+// Drops all accumulated data, including that of exited threads.
+void ResetForTesting();
+
+class ScopedPerfSample {
+ public:
+  explicit ScopedPerfSample(const char* category)
+      : category_(category), start_cycles_(ReadCycleCounter()) {}
+  ~ScopedPerfSample();
+
+  ScopedPerfSample(const ScopedPerfSample&) = delete;
+  ScopedPerfSample& operator=(const ScopedPerfSample&) = delete;
+
+ private:
+  static uint64_t ReadCycleCounter();
+
+  const char* const category_;
+  const uint64_t start_cycles_;
+};
+
+}  // namespace perf_sample
+}  // namespace rtc
+
+#if defined(RTC_DISABLE_PERF_SAMPLING)
+#define RTC_SCOPED_PERF_SAMPLE(category)
+#else
+#define RTC_SCOPED_PERF_SAMPLE(category)                    \
+  rtc::perf_sample::ScopedPerfSample RTC_PERF_SAMPLE_UID2(  \
+      rtc_perf_sample_, __LINE__)(category)
+#define RTC_PERF_SAMPLE_UID2(prefix, line) RTC_PERF_SAMPLE_UID3(prefix, line)
+#define RTC_PERF_SAMPLE_UID3(prefix, line) prefix##line
+#endif
+
+#endif  // RTC_BASE_PERF_SAMPLE_H_
@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/perf_sample.h"
+
+#include <numeric>
+
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace perf_sample {
+namespace {
+
+const CategorySummary* FindCategory(
+    const std::vector<CategorySummary>& summaries,
+    const char* category) {
+  for (const CategorySummary& summary : summaries) {
+    if (summary.category == category)
+      return &summary;
+  }
+  return nullptr;
+}
+
+class PerfSampleTest : public ::testing::Test {
+ protected:
+  PerfSampleTest() { ResetForTesting(); }
+  ~PerfSampleTest() override { ResetForTesting(); }
+};
+
+TEST_F(PerfSampleTest, CountsSamplesPerCategory) {
+  for (int i = 0; i < 10; ++i) {
+    RTC_SCOPED_PERF_SAMPLE("PerfSampleTestCategoryA");
+  }
+  for (int i = 0; i < 3; ++i) {
+    RTC_SCOPED_PERF_SAMPLE("PerfSampleTestCategoryB");
+  }
+
+  std::vector<CategorySummary> summaries = GetSummaries();
+  const CategorySummary* a =
+      FindCategory(summaries, "PerfSampleTestCategoryA");
+  const CategorySummary* b =
+      FindCategory(summaries, "PerfSampleTestCategoryB");
+  ASSERT_TRUE(a != nullptr);
+  ASSERT_TRUE(b != nullptr);
+  EXPECT_EQ(10, a->samples);
+  EXPECT_EQ(3, b->samples);
+  EXPECT_EQ(a->samples,
+            std::accumulate(a->histogram,
+                            a->histogram + kHistogramBuckets, int64_t{0}));
+}
+
+TEST_F(PerfSampleTest, AggregatesAcrossThreads) {
+  static const char kCategory[] = "PerfSampleTestThreaded";
+  auto thread_body = [](void*) {
+    for (int i = 0; i < 100; ++i) {
+      RTC_SCOPED_PERF_SAMPLE(kCategory);
+    }
+  };
+  PlatformThread thread1(thread_body, nullptr, "PerfSample1");
+  PlatformThread thread2(thread_body, nullptr, "PerfSample2");
+  thread1.Start();
+  thread2.Start();
+  thread1.Stop();
+  thread2.Stop();
+
+  const CategorySummary* summary = FindCategory(GetSummaries(), kCategory);
+  ASSERT_TRUE(summary != nullptr);
+  EXPECT_EQ(200, summary->samples);
+  EXPECT_GT(summary->total_cycles, 0);
+}
+
+TEST_F(PerfSampleTest, ResetDropsData) {
+  { RTC_SCOPED_PERF_SAMPLE("PerfSampleTestReset"); }
+  ResetForTesting();
+  EXPECT_TRUE(FindCategory(GetSummaries(), "PerfSampleTestReset") == nullptr);
+
+  // Sampling keeps working after a reset.
+  { RTC_SCOPED_PERF_SAMPLE("PerfSampleTestReset"); }
+  const CategorySummary* summary =
+      FindCategory(GetSummaries(), "PerfSampleTestReset");
+  ASSERT_TRUE(summary != nullptr);
+  EXPECT_EQ(1, summary->samples);
+}
+
+}  // namespace
+}  // namespace perf_sample
+}  // namespace rtc
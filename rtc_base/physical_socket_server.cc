@@ -53,6 +53,9 @@
 
 #if defined(WEBRTC_LINUX)
 #include <linux/sockios.h>
+#if !defined(WEBRTC_ANDROID)
+#include <netinet/udp.h>  // For UDP_SEGMENT (UDP generic segmentation).
+#endif
 #endif
 
 #if defined(WEBRTC_WIN)
@@ -415,6 +418,159 @@ int PhysicalSocket::RecvFrom(void* buffer,
   return received;
 }
 
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+
+int PhysicalSocket::SendToBatch(const SendDatagram* datagrams, size_t count) {
+  static constexpr size_t kMaxBatch = 64;
+#if defined(UDP_SEGMENT)
+  // Pacer bursts are typically equal-size datagrams to a single destination;
+  // hand such bursts to the kernel as one generically-segmented send.
+  if (udp_ && udp_gso_supported_ && count > 1 && count <= kMaxBatch) {
+    const size_t segment = datagrams[0].length;
+    size_t total = segment;
+    bool uniform = segment > 0;
+    for (size_t i = 1; uniform && i < count; ++i) {
+      uniform = datagrams[i].addr == datagrams[0].addr &&
+                (datagrams[i].length == segment ||
+                 (i == count - 1 && datagrams[i].length <= segment));
+      total += datagrams[i].length;
+    }
+    // 65507 is the largest payload a single UDP/IPv4 datagram can carry.
+    if (uniform && total <= 65507) {
+      int sent = SendGso(datagrams, count, segment);
+      if (sent != -2) {
+        return sent;
+      }
+    }
+  }
+#endif
+  size_t total_sent = 0;
+  while (total_sent < count) {
+    size_t batch = std::min(count - total_sent, kMaxBatch);
+    struct mmsghdr msgs[kMaxBatch];
+    struct iovec iovs[kMaxBatch];
+    sockaddr_storage addrs[kMaxBatch];
+    memset(msgs, 0, batch * sizeof(msgs[0]));
+    for (size_t i = 0; i < batch; ++i) {
+      const SendDatagram& datagram = datagrams[total_sent + i];
+      iovs[i].iov_base = const_cast<void*>(datagram.data);
+      iovs[i].iov_len = datagram.length;
+      size_t len = datagram.addr.ToSockAddrStorage(&addrs[i]);
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(len);
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int sent = ::sendmmsg(s_, msgs, static_cast<unsigned int>(batch),
+                          MSG_NOSIGNAL);
+    UpdateLastError();
+    MaybeRemapSendError();
+    if (sent < 0) {
+      if (total_sent > 0)
+        break;
+      if (IsBlockingError(GetError()))
+        EnableEvents(DE_WRITE);
+      return SOCKET_ERROR;
+    }
+    total_sent += sent;
+    if (static_cast<size_t>(sent) < batch) {
+      // The kernel accepted only part of the batch; the send buffer is full.
+      EnableEvents(DE_WRITE);
+      break;
+    }
+  }
+  return static_cast<int>(total_sent);
+}
+
+#if defined(UDP_SEGMENT)
+int PhysicalSocket::SendGso(const SendDatagram* datagrams,
+                            size_t count,
+                            size_t segment) {
+  struct iovec iovs[64];
+  for (size_t i = 0; i < count; ++i) {
+    iovs[i].iov_base = const_cast<void*>(datagrams[i].data);
+    iovs[i].iov_len = datagrams[i].length;
+  }
+  sockaddr_storage saddr;
+  size_t addr_len = datagrams[0].addr.ToSockAddrStorage(&saddr);
+
+  char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+  struct msghdr msg = {};
+  msg.msg_name = &saddr;
+  msg.msg_namelen = static_cast<socklen_t>(addr_len);
+  msg.msg_iov = iovs;
+  msg.msg_iovlen = count;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = IPPROTO_UDP;
+  cmsg->cmsg_type = UDP_SEGMENT;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+  uint16_t segment_size = static_cast<uint16_t>(segment);
+  memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+
+  int sent = ::sendmsg(s_, &msg, MSG_NOSIGNAL);
+  if (sent < 0) {
+    if (errno == EINVAL || errno == ENOTSUP || errno == EOPNOTSUPP ||
+        errno == EIO) {
+      // No GSO on this kernel or device; remember and use sendmmsg instead.
+      udp_gso_supported_ = false;
+      return -2;
+    }
+    UpdateLastError();
+    MaybeRemapSendError();
+    if (IsBlockingError(GetError())) {
+      EnableEvents(DE_WRITE);
+    }
+    return SOCKET_ERROR;
+  }
+  UpdateLastError();
+  // The kernel either takes the whole segmented datagram or none of it.
+  return static_cast<int>(count);
+}
+#endif  // defined(UDP_SEGMENT)
+
+int PhysicalSocket::RecvFromBatch(RecvDatagram* datagrams, size_t count) {
+  static constexpr size_t kMaxBatch = 64;
+  size_t batch = std::min(count, kMaxBatch);
+  struct mmsghdr msgs[kMaxBatch];
+  struct iovec iovs[kMaxBatch];
+  sockaddr_storage addrs[kMaxBatch];
+  memset(msgs, 0, batch * sizeof(msgs[0]));
+  for (size_t i = 0; i < batch; ++i) {
+    iovs[i].iov_base = datagrams[i].buffer;
+    iovs[i].iov_len = datagrams[i].size;
+    msgs[i].msg_hdr.msg_name = &addrs[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  int received = ::recvmmsg(s_, msgs, static_cast<unsigned int>(batch),
+                            MSG_DONTWAIT, nullptr);
+  UpdateLastError();
+  if (received < 0) {
+    if (IsBlockingError(GetError())) {
+      EnableEvents(DE_READ);
+      return 0;
+    }
+    if (udp_)
+      EnableEvents(DE_READ);
+    return SOCKET_ERROR;
+  }
+  // One timestamp query covers the whole batch; the skew between packets
+  // delivered by a single syscall is negligible.
+  int64_t timestamp = GetSocketRecvTimestamp(s_);
+  for (int i = 0; i < received; ++i) {
+    datagrams[i].received = msgs[i].msg_len;
+    SocketAddressFromSockAddrStorage(addrs[i], &datagrams[i].addr);
+    datagrams[i].timestamp = timestamp;
+  }
+  EnableEvents(DE_READ);
+  return received;
+}
+
+#endif  // defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+
 int PhysicalSocket::Listen(int backlog) {
   int err = ::listen(s_, backlog);
   UpdateLastError();
@@ -1168,16 +1324,21 @@ class Signaler : public EventDispatcher {
   bool* pf_;
 };
 
-PhysicalSocketServer::PhysicalSocketServer() : fWait_(false) {
+PhysicalSocketServer::PhysicalSocketServer()
+    : PhysicalSocketServer(Backend::kDefault) {}
+
+PhysicalSocketServer::PhysicalSocketServer(Backend backend) : fWait_(false) {
 #if defined(WEBRTC_USE_EPOLL)
-  // Since Linux 2.6.8, the size argument is ignored, but must be greater than
-  // zero. Before that the size served as hint to the kernel for the amount of
-  // space to initially allocate in internal data structures.
-  epoll_fd_ = epoll_create(FD_SETSIZE);
-  if (epoll_fd_ == -1) {
-    // Not an error, will fall back to "select" below.
-    RTC_LOG_E(LS_WARNING, EN, errno) << "epoll_create";
-    epoll_fd_ = INVALID_SOCKET;
+  if (backend != Backend::kSelect) {
+    // Since Linux 2.6.8, the size argument is ignored, but must be greater
+    // than zero. Before that the size served as hint to the kernel for the
+    // amount of space to initially allocate in internal data structures.
+    epoll_fd_ = epoll_create(FD_SETSIZE);
+    if (epoll_fd_ == -1) {
+      // Not an error, will fall back to "select" below.
+      RTC_LOG_E(LS_WARNING, EN, errno) << "epoll_create";
+      epoll_fd_ = INVALID_SOCKET;
+    }
   }
 #endif
   signal_wakeup_ = new Signaler(this, &fWait_);
@@ -63,7 +63,23 @@ class Dispatcher {
 // A socket server that provides the real sockets of the underlying OS.
 class PhysicalSocketServer : public SocketServer {
  public:
+  // I/O multiplexing backend used by Wait().
+  enum class Backend {
+    // Picks the best backend available on the platform: epoll on Linux,
+    // select elsewhere.
+    kDefault,
+    // Forces the portable select() backend. Wakeup cost grows with the total
+    // number of dispatchers, and descriptors must stay below FD_SETSIZE.
+    kSelect,
+#if defined(WEBRTC_USE_EPOLL)
+    // Forces the epoll backend, whose wakeup cost is proportional to the
+    // number of ready descriptors rather than the number of registered ones.
+    kEpoll,
+#endif
+  };
+
   PhysicalSocketServer();
+  explicit PhysicalSocketServer(Backend backend);
   ~PhysicalSocketServer() override;
 
   // SocketFactory:
@@ -164,6 +180,15 @@ class PhysicalSocket : public AsyncSocket, public sigslot::has_slots<> {
                SocketAddress* out_addr,
                int64_t* timestamp) override;
 
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  // Batched datagram I/O using sendmmsg/recvmmsg, one syscall per batch.
+  // Uniform bursts (equal-size datagrams to one destination, the common
+  // pacer shape) additionally use UDP generic segmentation offload where the
+  // kernel supports it, collapsing the whole burst into one send.
+  int SendToBatch(const SendDatagram* datagrams, size_t count) override;
+  int RecvFromBatch(RecvDatagram* datagrams, size_t count) override;
+#endif
+
   int Listen(int backlog) override;
   AsyncSocket* Accept(SocketAddress* out_addr) override;
 
@@ -213,6 +238,16 @@ class PhysicalSocket : public AsyncSocket, public sigslot::has_slots<> {
 #endif
 
  private:
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  // Sends |count| equal-size datagrams (the last may be shorter) to one
+  // destination as a single UDP_SEGMENT sendmsg. Returns the number of
+  // datagrams sent, SOCKET_ERROR, or -2 if the kernel lacks GSO support and
+  // the caller should fall back to sendmmsg.
+  int SendGso(const SendDatagram* datagrams, size_t count, size_t segment);
+
+  // Cleared the first time the kernel rejects a UDP_SEGMENT send.
+  bool udp_gso_supported_ = true;
+#endif
   uint8_t enabled_events_ = 0;
 };
 
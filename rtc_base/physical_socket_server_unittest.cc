@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 
 #include "rtc_base/gunit.h"
 #include "rtc_base/ip_address.h"
@@ -447,6 +448,64 @@ TEST_F(PhysicalSocketTest, TestGetSetOptionsIPv6) {
   SocketTest::TestGetSetOptionsIPv6();
 }
 
+// Exercises the batched UDP send/receive path on every Wait() backend. On
+// platforms without sendmmsg/recvmmsg this covers the per-packet fallback.
+class PhysicalSocketServerBatchTest
+    : public ::testing::TestWithParam<PhysicalSocketServer::Backend> {};
+
+TEST_P(PhysicalSocketServerBatchTest, UdpSendToBatchRecvFromBatch) {
+  if (!HasIPv4Enabled()) {
+    RTC_LOG(LS_INFO) << "No IPv4... skipping";
+    return;
+  }
+  PhysicalSocketServer server(GetParam());
+  std::unique_ptr<Socket> sender(server.CreateSocket(AF_INET, SOCK_DGRAM));
+  std::unique_ptr<Socket> receiver(server.CreateSocket(AF_INET, SOCK_DGRAM));
+  ASSERT_TRUE(sender != nullptr && receiver != nullptr);
+  ASSERT_EQ(0, receiver->Bind(SocketAddress("127.0.0.1", 0)));
+
+  static constexpr size_t kNumPackets = 4;
+  const char payloads[kNumPackets] = {'a', 'b', 'c', 'd'};
+  Socket::SendDatagram to_send[kNumPackets];
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    to_send[i].data = &payloads[i];
+    to_send[i].length = 1;
+    to_send[i].addr = receiver->GetLocalAddress();
+  }
+  EXPECT_EQ(static_cast<int>(kNumPackets),
+            sender->SendToBatch(to_send, kNumPackets));
+
+  // RecvFromBatch never blocks, so poll until all packets have arrived.
+  char buffers[kNumPackets];
+  Socket::RecvDatagram slots[kNumPackets];
+  std::string received;
+  int64_t deadline = TimeMillis() + 5000;
+  while (received.size() < kNumPackets && TimeMillis() < deadline) {
+    for (size_t i = 0; i < kNumPackets; ++i) {
+      slots[i].buffer = &buffers[i];
+      slots[i].size = 1;
+    }
+    int n = receiver->RecvFromBatch(slots, kNumPackets - received.size());
+    ASSERT_GE(n, 0);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(1u, slots[i].received);
+      received.push_back(buffers[i]);
+    }
+    if (received.size() < kNumPackets) {
+      Thread::SleepMs(1);
+    }
+  }
+  // Loopback delivery is in-order in practice, but only check the contents.
+  std::sort(received.begin(), received.end());
+  EXPECT_EQ("abcd", received);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    PhysicalSocketServerBatchTests,
+    PhysicalSocketServerBatchTest,
+    ::testing::Values(PhysicalSocketServer::Backend::kDefault,
+                      PhysicalSocketServer::Backend::kSelect));
+
 #if defined(WEBRTC_POSIX)
 
 // We don't get recv timestamps on Mac.
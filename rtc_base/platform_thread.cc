@@ -19,13 +19,14 @@
 #include <algorithm>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/thread_attributes.h"
 
 namespace rtc {
 namespace {
 #if !defined(WEBRTC_WIN)
-struct ThreadAttributes {
-  ThreadAttributes() { pthread_attr_init(&attr); }
-  ~ThreadAttributes() { pthread_attr_destroy(&attr); }
+struct PthreadAttributes {
+  PthreadAttributes() { pthread_attr_init(&attr); }
+  ~PthreadAttributes() { pthread_attr_destroy(&attr); }
   pthread_attr_t* operator&() { return &attr; }
   pthread_attr_t attr;
 };
@@ -81,7 +82,7 @@ void PlatformThread::Start() {
   RTC_CHECK(thread_) << "CreateThread failed";
   RTC_DCHECK(thread_id_);
 #else
-  ThreadAttributes attr;
+  PthreadAttributes attr;
   // Set the stack stack size to 1M.
   pthread_attr_setstacksize(&attr, 1024 * 1024);
   RTC_CHECK_EQ(0, pthread_create(&thread_, &attr, &StartThread, this));
@@ -127,6 +128,10 @@ void PlatformThread::Run() {
   RTC_DCHECK(spawned_thread_checker_.IsCurrent());
   rtc::SetCurrentThreadName(name_.c_str());
   SetPriority(priority_);
+  // Apply any installed placement policy (affinity/NUMA) for this thread
+  // name before entering the run function, so that the policy also covers
+  // the task queue implementations built on PlatformThread.
+  ApplyThreadAttributes(name_);
   run_function_(obj_);
 }
 
@@ -16,28 +16,44 @@
 #include "rtc_base/checks.h"
 
 namespace webrtc {
+namespace {
+
+// At most one bucket per millisecond inside the window, so a capacity of
+// the window size rounded up to a power of two can never overflow.
+uint32_t RingCapacity(int64_t window_size_ms) {
+  uint32_t capacity = 1;
+  while (capacity < window_size_ms)
+    capacity <<= 1;
+  return capacity;
+}
+
+}  // namespace
 
 RateStatistics::RateStatistics(int64_t window_size_ms, float scale)
-    : buckets_(new Bucket[window_size_ms]()),
+    : buckets_(new Bucket[RingCapacity(window_size_ms)]),
+      ring_mask_(RingCapacity(window_size_ms) - 1),
+      first_bucket_(0),
+      num_buckets_(0),
       accumulated_count_(0),
       num_samples_(0),
       oldest_time_(-window_size_ms),
-      oldest_index_(0),
       scale_(scale),
       max_window_size_ms_(window_size_ms),
       current_window_size_ms_(max_window_size_ms_) {}
 
 RateStatistics::RateStatistics(const RateStatistics& other)
-    : accumulated_count_(other.accumulated_count_),
+    : ring_mask_(other.ring_mask_),
+      first_bucket_(other.first_bucket_),
+      num_buckets_(other.num_buckets_),
+      accumulated_count_(other.accumulated_count_),
       num_samples_(other.num_samples_),
       oldest_time_(other.oldest_time_),
-      oldest_index_(other.oldest_index_),
       scale_(other.scale_),
       max_window_size_ms_(other.max_window_size_ms_),
       current_window_size_ms_(other.current_window_size_ms_) {
-  buckets_ = absl::make_unique<Bucket[]>(other.max_window_size_ms_);
-  std::copy(other.buckets_.get(),
-            other.buckets_.get() + other.max_window_size_ms_, buckets_.get());
+  buckets_ = absl::make_unique<Bucket[]>(other.ring_mask_ + 1);
+  std::copy(other.buckets_.get(), other.buckets_.get() + other.ring_mask_ + 1,
+            buckets_.get());
 }
 
 RateStatistics::RateStatistics(RateStatistics&& other) = default;
@@ -45,16 +61,21 @@ RateStatistics::RateStatistics(RateStatistics&& other) = default;
 RateStatistics::~RateStatistics() {}
 
 void RateStatistics::Reset() {
+  // Occupied buckets are tracked by |first_bucket_|/|num_buckets_|, so the
+  // ring contents need no clearing.
+  first_bucket_ = 0;
+  num_buckets_ = 0;
   accumulated_count_ = 0;
   num_samples_ = 0;
   oldest_time_ = -max_window_size_ms_;
-  oldest_index_ = 0;
   current_window_size_ms_ = max_window_size_ms_;
-  for (int64_t i = 0; i < max_window_size_ms_; i++)
-    buckets_[i] = Bucket();
 }
 
 void RateStatistics::Update(size_t count, int64_t now_ms) {
+  Update(count, 1, now_ms);
+}
+
+void RateStatistics::Update(size_t count, size_t samples, int64_t now_ms) {
   if (now_ms < oldest_time_) {
     // Too old data is ignored.
     return;
@@ -66,15 +87,25 @@ void RateStatistics::Update(size_t count, int64_t now_ms) {
   if (!IsInitialized())
     oldest_time_ = now_ms;
 
-  uint32_t now_offset = static_cast<uint32_t>(now_ms - oldest_time_);
-  RTC_DCHECK_LT(now_offset, max_window_size_ms_);
-  uint32_t index = oldest_index_ + now_offset;
-  if (index >= max_window_size_ms_)
-    index -= max_window_size_ms_;
-  buckets_[index].sum += count;
-  ++buckets_[index].samples;
   accumulated_count_ += count;
-  ++num_samples_;
+  num_samples_ += samples;
+
+  if (num_buckets_ > 0) {
+    Bucket& newest = buckets_[(first_bucket_ + num_buckets_ - 1) & ring_mask_];
+    // >= also folds samples from a non-monotonic clock into the newest
+    // bucket rather than rewinding the ring.
+    if (newest.time_ms >= now_ms) {
+      newest.sum += count;
+      newest.samples += samples;
+      return;
+    }
+  }
+  RTC_DCHECK_LE(num_buckets_, ring_mask_);
+  Bucket& bucket = buckets_[(first_bucket_ + num_buckets_) & ring_mask_];
+  ++num_buckets_;
+  bucket.sum = count;
+  bucket.samples = samples;
+  bucket.time_ms = now_ms;
 }
 
 absl::optional<uint32_t> RateStatistics::Rate(int64_t now_ms) const {
@@ -105,17 +136,18 @@ void RateStatistics::EraseOld(int64_t now_ms) {
   if (new_oldest_time <= oldest_time_)
     return;
 
-  // Loop over buckets and remove too old data points.
-  while (num_samples_ > 0 && oldest_time_ < new_oldest_time) {
-    const Bucket& oldest_bucket = buckets_[oldest_index_];
+  // Pop buckets that slid out of the window off the front of the ring. Only
+  // occupied buckets are visited, so a long quiet period costs nothing.
+  while (num_buckets_ > 0) {
+    const Bucket& oldest_bucket = buckets_[first_bucket_ & ring_mask_];
+    if (oldest_bucket.time_ms >= new_oldest_time)
+      break;
     RTC_DCHECK_GE(accumulated_count_, oldest_bucket.sum);
     RTC_DCHECK_GE(num_samples_, oldest_bucket.samples);
     accumulated_count_ -= oldest_bucket.sum;
     num_samples_ -= oldest_bucket.samples;
-    buckets_[oldest_index_] = Bucket();
-    if (++oldest_index_ >= max_window_size_ms_)
-      oldest_index_ = 0;
-    ++oldest_time_;
+    ++first_bucket_;
+    --num_buckets_;
   }
   oldest_time_ = new_oldest_time;
 }
@@ -43,6 +43,11 @@ class RateStatistics {
   // Update rate with a new data point, moving averaging window as needed.
   void Update(size_t count, int64_t now_ms);
 
+  // Batched update: adds |count| spread over |samples| data points at
+  // |now_ms|, equivalent to |samples| single Update() calls in the same
+  // millisecond. For callers that drain several packets per wakeup.
+  void Update(size_t count, size_t samples, int64_t now_ms);
+
   // Note that despite this being a const method, it still updates the internal
   // state (moves averaging window), but it doesn't make any alterations that
   // are observable from the other methods, as long as supplied timestamps are
@@ -59,26 +64,38 @@ class RateStatistics {
   void EraseOld(int64_t now_ms);
   bool IsInitialized() const;
 
-  // Counters are kept in buckets (circular buffer), with one bucket
-  // per millisecond.
+  // Counters are kept in a ring of buckets, one bucket per millisecond that
+  // actually received samples; quiet milliseconds occupy no bucket. The ring
+  // capacity is the max window size rounded up to a power of two so indices
+  // are computed with a mask, and buckets are popped off the front as the
+  // window slides. Each bucket is written once and removed once, so the
+  // bookkeeping is amortized O(1) per sample with no per-millisecond erase
+  // pass after idle periods.
   struct Bucket {
-    size_t sum;      // Sum of all samples in this bucket.
-    size_t samples;  // Number of samples in this bucket.
+    size_t sum;       // Sum of all samples in this bucket.
+    size_t samples;   // Number of samples in this bucket.
+    int64_t time_ms;  // Timestamp this bucket covers.
   };
   std::unique_ptr<Bucket[]> buckets_;
 
+  // Ring capacity (power of two) minus one; index = counter & ring_mask_.
+  const uint32_t ring_mask_;
+
+  // Free-running index of the oldest occupied bucket.
+  uint32_t first_bucket_;
+
+  // Number of occupied buckets, starting at first_bucket_.
+  uint32_t num_buckets_;
+
   // Total count recorded in buckets.
   size_t accumulated_count_;
 
   // The total number of samples in the buckets.
   size_t num_samples_;
 
-  // Oldest time recorded in buckets.
+  // Oldest time included in the window.
   int64_t oldest_time_;
 
-  // Bucket index of oldest counter recorded in buckets.
-  uint32_t oldest_index_;
-
   // To convert counts/ms to desired units
   const float scale_;
 
@@ -278,4 +278,18 @@ TEST_F(RateStatisticsTest, HandlesQuietPeriods) {
   EXPECT_TRUE(static_cast<bool>(bitrate));
   EXPECT_EQ(0u, *bitrate);
 }
+
+TEST_F(RateStatisticsTest, BatchedUpdateMatchesRepeatedUpdates) {
+  RateStatistics batched(kWindowMs, 8000);
+  int64_t now_ms = 0;
+  const uint32_t kPacketSize = 1200u;
+  const int kPacketsPerBatch = 5;
+  for (int i = 0; i < 2 * kWindowMs; now_ms += 10, ++i) {
+    for (int j = 0; j < kPacketsPerBatch; ++j)
+      stats_.Update(kPacketSize, now_ms);
+    batched.Update(kPacketsPerBatch * kPacketSize, kPacketsPerBatch, now_ms);
+    EXPECT_EQ(stats_.Rate(now_ms), batched.Rate(now_ms));
+  }
+  EXPECT_TRUE(static_cast<bool>(batched.Rate(now_ms)));
+}
 }  // namespace
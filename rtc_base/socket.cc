@@ -10,4 +10,34 @@
 
 #include "rtc_base/socket.h"
 
-namespace rtc {}  // namespace rtc
+namespace rtc {
+
+int Socket::SendToBatch(const SendDatagram* datagrams, size_t count) {
+  // Fallback for sockets without a batched implementation: one syscall per
+  // datagram, stopping at the first send the kernel does not accept.
+  for (size_t i = 0; i < count; ++i) {
+    int sent = SendTo(datagrams[i].data, datagrams[i].length, datagrams[i].addr);
+    if (sent < 0) {
+      return (i == 0) ? sent : static_cast<int>(i);
+    }
+  }
+  return static_cast<int>(count);
+}
+
+int Socket::RecvFromBatch(RecvDatagram* datagrams, size_t count) {
+  // Fallback for sockets without a batched implementation: a single receive,
+  // which preserves the "one packet per read event" behavior of RecvFrom.
+  if (count == 0) {
+    return 0;
+  }
+  RecvDatagram& datagram = datagrams[0];
+  int received = RecvFrom(datagram.buffer, datagram.size, &datagram.addr,
+                          &datagram.timestamp);
+  if (received < 0) {
+    return IsBlocking() ? 0 : received;
+  }
+  datagram.received = static_cast<size_t>(received);
+  return 1;
+}
+
+}  // namespace rtc
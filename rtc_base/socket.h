@@ -146,6 +146,33 @@ class Socket {
                        size_t cb,
                        SocketAddress* paddr,
                        int64_t* timestamp) = 0;
+
+  // One datagram of a SendToBatch() call.
+  struct SendDatagram {
+    const void* data;
+    size_t length;
+    SocketAddress addr;
+  };
+  // One datagram slot of a RecvFromBatch() call. |buffer| and |size| are
+  // provided by the caller; the remaining fields are filled in by the socket.
+  // |timestamp| is in units of microseconds, or -1 if unavailable.
+  struct RecvDatagram {
+    void* buffer;
+    size_t size;
+    size_t received;
+    SocketAddress addr;
+    int64_t timestamp;
+  };
+  // Sends |count| datagrams, using fewer syscalls than a SendTo() loop where
+  // the platform supports it (sendmmsg on Linux). Returns the number of
+  // datagrams handed to the kernel, which may be less than |count| if the
+  // socket would block, or SOCKET_ERROR if the first send fails.
+  virtual int SendToBatch(const SendDatagram* datagrams, size_t count);
+  // Receives up to |count| datagrams that are already queued on the socket,
+  // without blocking (recvmmsg on Linux). Returns the number of |datagrams|
+  // slots filled, 0 if none are pending, or SOCKET_ERROR.
+  virtual int RecvFromBatch(RecvDatagram* datagrams, size_t count);
+
   virtual int Listen(int backlog) = 0;
   virtual Socket* Accept(SocketAddress* paddr) = 0;
   virtual int Close() = 0;
@@ -10,6 +10,7 @@
 
 #include "rtc_base/string_encode.h"
 
+#include <algorithm>
 #include <cstdio>
 
 #include "rtc_base/arraysize.h"
@@ -280,14 +281,17 @@ size_t split(const std::string& source,
              std::vector<std::string>* fields) {
   RTC_DCHECK(fields);
   fields->clear();
+  // Reserve the exact field count up front so growing the vector doesn't
+  // reallocate and move the strings collected so far.
+  fields->reserve(1 + std::count(source.begin(), source.end(), delimiter));
   size_t last = 0;
   for (size_t i = 0; i < source.length(); ++i) {
     if (source[i] == delimiter) {
-      fields->push_back(source.substr(last, i - last));
+      fields->emplace_back(source, last, i - last);
       last = i + 1;
     }
   }
-  fields->push_back(source.substr(last, source.length() - last));
+  fields->emplace_back(source, last, source.length() - last);
   return fields->size();
 }
 
@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/synchronization/read_mostly_rw_lock.h"
+
+#include "rtc_base/checks.h"
+#include "rtc_base/synchronization/yield_policy.h"
+
+#if defined(WEBRTC_WIN)
+// clang-format off
+#include <winsock2.h>
+#include <windows.h>
+// clang-format on
+#else
+#include <sched.h>
+#endif
+
+namespace webrtc {
+namespace {
+
+// Number of distinct ReadMostlyRWLocks one thread can read-hold at once.
+constexpr int kMaxHeldLocks = 8;
+
+// Per-thread record of read-lock nesting, so that a nested acquisition can
+// be distinguished from a fresh one (a fresh reader must back off for a
+// pending writer; a nested one must not, since the writer is already
+// waiting on this thread's outer hold).
+struct ReadState {
+  const void* lock = nullptr;
+  int depth = 0;
+};
+
+thread_local ReadState read_states[kMaxHeldLocks];
+
+ReadState* GetReadState(const void* lock) {
+  ReadState* free_state = nullptr;
+  for (ReadState& state : read_states) {
+    if (state.lock == lock)
+      return &state;
+    if (free_state == nullptr && state.lock == nullptr)
+      free_state = &state;
+  }
+  RTC_CHECK(free_state)
+      << "Thread read-holds more than " << kMaxHeldLocks
+      << " ReadMostlyRWLocks at once.";
+  free_state->lock = lock;
+  free_state->depth = 0;
+  return free_state;
+}
+
+// Stable per-thread shard index; threads get sequential ids so that up to
+// kNumShards concurrent readers do not collide. Collisions are benign, they
+// only share a counter cache line.
+uint32_t CurrentThreadId() {
+  static std::atomic<uint32_t> next_thread_id(0);
+  static thread_local const uint32_t thread_id =
+      next_thread_id.fetch_add(1, std::memory_order_relaxed);
+  return thread_id;
+}
+
+void YieldCurrentThread() {
+  // Let the thread-local yield policy run first so that simulated-time
+  // tests can advance the thread being waited on.
+  rtc::ScopedYieldPolicy::YieldExecution();
+#if defined(WEBRTC_WIN)
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
+
+}  // namespace
+
+ReadMostlyRWLock::ReadMostlyRWLock() = default;
+ReadMostlyRWLock::~ReadMostlyRWLock() = default;
+
+void ReadMostlyRWLock::AcquireLockShared() const {
+  ReadState* state = GetReadState(this);
+  std::atomic<int32_t>& count = shards_[CurrentThreadId() % kNumShards].count;
+  if (state->depth > 0) {
+    // Nested read on this thread; the outer hold already keeps any writer
+    // out, so enter without consulting writer_pending_.
+    count.fetch_add(1, std::memory_order_acquire);
+    ++state->depth;
+    return;
+  }
+  for (;;) {
+    // Count in first, then check for a writer; seq_cst makes sure that
+    // either the writer's drain scan sees our count or we see its
+    // announcement (and back off).
+    count.fetch_add(1, std::memory_order_seq_cst);
+    if (!writer_pending_.load(std::memory_order_seq_cst))
+      break;
+    count.fetch_sub(1, std::memory_order_release);
+    while (writer_pending_.load(std::memory_order_acquire))
+      YieldCurrentThread();
+  }
+  state->depth = 1;
+}
+
+void ReadMostlyRWLock::ReleaseLockShared() const {
+  ReadState* state = GetReadState(this);
+  RTC_DCHECK_GT(state->depth, 0);
+  shards_[CurrentThreadId() % kNumShards].count.fetch_sub(
+      1, std::memory_order_release);
+  if (--state->depth == 0)
+    state->lock = nullptr;
+}
+
+void ReadMostlyRWLock::AcquireLockExclusive() {
+  writer_lock_.Enter();
+  writer_pending_.store(true, std::memory_order_seq_cst);
+  // Wait for all reader shards to drain. New readers back off as soon as
+  // they observe writer_pending_, so this only waits out sections already
+  // in progress.
+  for (ReaderShard& shard : shards_) {
+    while (shard.count.load(std::memory_order_seq_cst) != 0)
+      YieldCurrentThread();
+  }
+}
+
+void ReadMostlyRWLock::ReleaseLockExclusive() {
+  writer_pending_.store(false, std::memory_order_release);
+  writer_lock_.Leave();
+}
+
+}  // namespace webrtc
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef RTC_BASE_SYNCHRONIZATION_READ_MOSTLY_RW_LOCK_H_
+#define RTC_BASE_SYNCHRONIZATION_READ_MOSTLY_RW_LOCK_H_
+
+#include <atomic>
+
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// A reader/writer lock for read-mostly data, e.g. per-SSRC config tables
+// consulted on every received packet. A pthread rwlock makes every reader
+// do a read-modify-write on one shared cache line, so the read path scales
+// negatively with core count. Here each reader thread instead counts itself
+// in on a shard of its own (epoch/brlock style), so uncontended readers
+// touch no shared line; writers announce themselves, then wait for every
+// reader shard to drain, which makes write acquisition much more expensive
+// than with a pthread rwlock. Use only where writes are rare (stream
+// creation/teardown) and reads are hot.
+//
+// Read acquisition is reentrant on the same thread, like the pthreads lock
+// it replaces. Lock ordering obligations are unchanged; acquiring the read
+// lock while holding the write lock on the same thread deadlocks.
+class RTC_LOCKABLE ReadMostlyRWLock {
+ public:
+  ReadMostlyRWLock();
+  ~ReadMostlyRWLock();
+
+  void AcquireLockShared() const RTC_SHARED_LOCK_FUNCTION();
+  void ReleaseLockShared() const RTC_UNLOCK_FUNCTION();
+
+  void AcquireLockExclusive() RTC_EXCLUSIVE_LOCK_FUNCTION();
+  void ReleaseLockExclusive() RTC_UNLOCK_FUNCTION();
+
+ private:
+  // One reader count per thread-id shard, padded so that shards used by
+  // different threads do not share a cache line.
+  struct ReaderShard {
+    std::atomic<int32_t> count{0};
+    uint8_t padding[64 - sizeof(std::atomic<int32_t>)];
+  };
+  static constexpr int kNumShards = 32;
+
+  mutable ReaderShard shards_[kNumShards];
+  // True from just before a writer starts waiting for readers to drain
+  // until it releases the lock. New (non-nested) readers back off while set.
+  std::atomic<bool> writer_pending_{false};
+  // Serializes writers against each other.
+  rtc::CriticalSection writer_lock_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(ReadMostlyRWLock);
+};
+
+// RAII guards, mirroring ReadLockScoped/WriteLockScoped for RWLockWrapper.
+class RTC_SCOPED_LOCKABLE ReadMostlyReadLockScoped {
+ public:
+  explicit ReadMostlyReadLockScoped(const ReadMostlyRWLock& lock)
+      RTC_SHARED_LOCK_FUNCTION(lock)
+      : lock_(lock) {
+    lock_.AcquireLockShared();
+  }
+  ~ReadMostlyReadLockScoped() RTC_UNLOCK_FUNCTION() {
+    lock_.ReleaseLockShared();
+  }
+
+ private:
+  const ReadMostlyRWLock& lock_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(ReadMostlyReadLockScoped);
+};
+
+class RTC_SCOPED_LOCKABLE ReadMostlyWriteLockScoped {
+ public:
+  explicit ReadMostlyWriteLockScoped(ReadMostlyRWLock& lock)
+      RTC_EXCLUSIVE_LOCK_FUNCTION(lock)
+      : lock_(lock) {
+    lock_.AcquireLockExclusive();
+  }
+  ~ReadMostlyWriteLockScoped() RTC_UNLOCK_FUNCTION() {
+    lock_.ReleaseLockExclusive();
+  }
+
+ private:
+  ReadMostlyRWLock& lock_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(ReadMostlyWriteLockScoped);
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_SYNCHRONIZATION_READ_MOSTLY_RW_LOCK_H_
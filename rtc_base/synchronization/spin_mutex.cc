@@ -0,0 +1,97 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/synchronization/spin_mutex.h"
+
+#include "rtc_base/synchronization/yield_policy.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_WIN)
+// clang-format off
+#include <winsock2.h>
+#include <windows.h>
+// clang-format on
+#else
+#include <sched.h>
+#include <time.h>
+#endif
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <immintrin.h>
+#endif
+
+namespace rtc {
+namespace {
+
+// Spin counts double from kInitialSpins until kMaxSpins per attempt; in
+// total roughly a microsecond of busy waiting before the first yield.
+constexpr int kInitialSpins = 8;
+constexpr int kMaxSpins = 512;
+// Number of sched_yield rounds after spinning fails before backing off to a
+// real sleep. Sleeping caps the wasted CPU when the lock holder has been
+// preempted and will not run again for a scheduling quantum.
+constexpr int kMaxYields = 8;
+
+void CpuRelax() {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  _mm_pause();
+#elif defined(WEBRTC_ARCH_ARM_FAMILY)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+void YieldThread() {
+#if defined(WEBRTC_WIN)
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
+
+void SleepBriefly() {
+#if defined(WEBRTC_WIN)
+  Sleep(1);
+#else
+  timespec duration = {0, 500 * 1000};  // 500 microseconds.
+  nanosleep(&duration, nullptr);
+#endif
+}
+
+}  // namespace
+
+void SpinMutex::LockSlow() const {
+  int spins = kInitialSpins;
+  int yields = 0;
+  for (;;) {
+    // Wait for the lock to look free before attempting the exchange, so
+    // that waiters do not bounce the cache line between cores.
+    for (int i = 0; i < spins; ++i) {
+      if (!locked_.load(std::memory_order_relaxed) && TryLock())
+        return;
+      CpuRelax();
+    }
+    if (spins < kMaxSpins) {
+      spins <<= 1;
+      continue;
+    }
+    // Bounded spinning failed; the holder has likely been preempted (or the
+    // section is longer than this lock is meant for). Let the thread-local
+    // yield policy run first so that simulated-time tests can advance the
+    // holder, then give up the processor.
+    ScopedYieldPolicy::YieldExecution();
+    if (yields < kMaxYields) {
+      ++yields;
+      YieldThread();
+    } else {
+      SleepBriefly();
+    }
+  }
+}
+
+}  // namespace rtc
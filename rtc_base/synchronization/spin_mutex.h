@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef RTC_BASE_SYNCHRONIZATION_SPIN_MUTEX_H_
+#define RTC_BASE_SYNCHRONIZATION_SPIN_MUTEX_H_
+
+#include <atomic>
+
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace rtc {
+
+// An adaptive mutex for critical sections that are held for well under a
+// microsecond, e.g. the pacer's packet queue bookkeeping. The fast path is a
+// single atomic exchange; under contention the waiter spins with exponential
+// backoff before giving up its timeslice, which avoids the futex sleep/wake
+// context switches a plain pthread mutex pays when the lock is released
+// within a few dozen cycles.
+//
+// Unlike rtc::CriticalSection this lock is NOT recursive, and a section that
+// can block (I/O, other locks, callbacks into application code) should keep
+// using CriticalSection.
+// Locking methods are const to permit protecting members in a const context,
+// mirroring CriticalSection.
+class RTC_LOCKABLE SpinMutex {
+ public:
+  SpinMutex() = default;
+
+  void Lock() const RTC_EXCLUSIVE_LOCK_FUNCTION() {
+    if (!TryLock())
+      LockSlow();
+  }
+  bool TryLock() const RTC_EXCLUSIVE_TRYLOCK_FUNCTION(true) {
+    return !locked_.exchange(true, std::memory_order_acquire);
+  }
+  void Unlock() const RTC_UNLOCK_FUNCTION() {
+    locked_.store(false, std::memory_order_release);
+  }
+
+ private:
+  void LockSlow() const;
+
+  mutable std::atomic<bool> locked_{false};
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(SpinMutex);
+};
+
+// Scoped guard, equivalent of CritScope for SpinMutex.
+class RTC_SCOPED_LOCKABLE SpinMutexLock {
+ public:
+  explicit SpinMutexLock(const SpinMutex* mutex)
+      RTC_EXCLUSIVE_LOCK_FUNCTION(mutex)
+      : mutex_(mutex) {
+    mutex->Lock();
+  }
+  ~SpinMutexLock() RTC_UNLOCK_FUNCTION() { mutex_->Unlock(); }
+
+ private:
+  const SpinMutex* const mutex_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(SpinMutexLock);
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_SYNCHRONIZATION_SPIN_MUTEX_H_
@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/synchronization/spin_mutex.h"
+
+#include <memory>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "rtc_base/platform_thread.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace {
+
+constexpr int kNumThreads = 4;
+constexpr int kIncrementsPerThread = 100000;
+
+struct Counter {
+  SpinMutex mutex;
+  int value RTC_GUARDED_BY(mutex) = 0;
+};
+
+void IncrementLoop(void* obj) {
+  Counter* counter = static_cast<Counter*>(obj);
+  for (int i = 0; i < kIncrementsPerThread; ++i) {
+    SpinMutexLock lock(&counter->mutex);
+    ++counter->value;
+  }
+}
+
+TEST(SpinMutexTest, TryLockReflectsLockState) {
+  SpinMutex mutex;
+  EXPECT_TRUE(mutex.TryLock());
+  EXPECT_FALSE(mutex.TryLock());
+  mutex.Unlock();
+  EXPECT_TRUE(mutex.TryLock());
+  mutex.Unlock();
+}
+
+TEST(SpinMutexTest, ProtectsCounterUnderContention) {
+  Counter counter;
+  std::vector<std::unique_ptr<PlatformThread>> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.push_back(absl::make_unique<PlatformThread>(
+        &IncrementLoop, &counter, "SpinMutexTest"));
+    threads.back()->Start();
+  }
+  for (auto& thread : threads)
+    thread->Stop();
+
+  SpinMutexLock lock(&counter.mutex);
+  EXPECT_EQ(counter.value, kNumThreads * kIncrementsPerThread);
+}
+
+}  // namespace
+}  // namespace rtc
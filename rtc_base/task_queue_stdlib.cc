@@ -13,8 +13,8 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
-#include <queue>
 #include <utility>
 
 #include "absl/memory/memory.h"
@@ -50,7 +50,7 @@ rtc::ThreadPriority TaskQueuePriorityToThreadPriority(
 class TaskQueueStdlib final : public TaskQueueBase {
  public:
   TaskQueueStdlib(absl::string_view queue_name, rtc::ThreadPriority priority);
-  ~TaskQueueStdlib() override = default;
+  ~TaskQueueStdlib() override;
 
   void Delete() override;
   void PostTask(std::unique_ptr<QueuedTask> task) override;
@@ -60,6 +60,43 @@ class TaskQueueStdlib final : public TaskQueueBase {
  private:
   using OrderId = uint64_t;
 
+  // Singly-linked node carrying one posted task. Nodes are recycled through
+  // |free_nodes_| so that steady-state posting does not allocate.
+  struct TaskNode {
+    TaskNode* next{nullptr};
+    OrderId order{};
+    std::unique_ptr<QueuedTask> task;
+  };
+
+  // Lock-free multi-producer single-consumer task list. Producers push onto
+  // an atomic LIFO head with a compare-exchange; the consumer detaches the
+  // whole chain with a single exchange and reverses it into FIFO order.
+  class MpscTaskList {
+   public:
+    void Push(TaskNode* node) {
+      TaskNode* old_head = head_.load(std::memory_order_relaxed);
+      do {
+        node->next = old_head;
+      } while (!head_.compare_exchange_weak(old_head, node,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed));
+    }
+
+    // Detaches and returns the whole chain in LIFO order, or null.
+    TaskNode* PopAll() {
+      return head_.exchange(nullptr, std::memory_order_acquire);
+    }
+
+   private:
+    std::atomic<TaskNode*> head_{nullptr};
+  };
+
+  TaskNode* AllocateTaskNode();
+  void FreeTaskNode(TaskNode* node);
+  // Moves any newly posted tasks into |ready_head_| in FIFO order.
+  void RefillReadyList();
+  static void DeleteChain(TaskNode* node);
+
   struct DelayedEntryTimeout {
     int64_t next_fire_at_ms_{};
     OrderId order_{};
@@ -97,19 +134,27 @@ class TaskQueueStdlib final : public TaskQueueBase {
   // tasks (including delayed tasks).
   rtc::PlatformThread thread_;
 
+  // Guards only the delayed-task map; the immediate-task path is lock free.
   rtc::CriticalSection pending_lock_;
 
   // Indicates if the worker thread needs to shutdown now.
-  bool thread_should_quit_ RTC_GUARDED_BY(pending_lock_){false};
+  std::atomic<bool> thread_should_quit_{false};
 
   // Holds the next order to use for the next task to be
   // put into one of the pending queues.
-  OrderId thread_posting_order_ RTC_GUARDED_BY(pending_lock_){};
+  std::atomic<OrderId> thread_posting_order_{};
 
-  // The list of all pending tasks that need to be processed in the
-  // FIFO queue ordering on the worker thread.
-  std::queue<std::pair<OrderId, std::unique_ptr<QueuedTask>>> pending_queue_
-      RTC_GUARDED_BY(pending_lock_);
+  // Newly posted tasks, pushed by any thread and drained by the worker.
+  MpscTaskList incoming_;
+
+  // Recycled task nodes, so that posting does not allocate in steady state.
+  MpscTaskList free_nodes_;
+  std::atomic<int> free_node_count_{0};
+
+  // Tasks already drained from |incoming_|, in FIFO order. Only touched by
+  // the worker thread.
+  TaskNode* ready_head_ = nullptr;
+  TaskNode* ready_tail_ = nullptr;
 
   // The list of all pending tasks that need to be processed at a future
   // time based upon a delay. On the off change the delayed task should
@@ -131,13 +176,80 @@ TaskQueueStdlib::TaskQueueStdlib(absl::string_view queue_name,
   started_.Wait(rtc::Event::kForever);
 }
 
+TaskQueueStdlib::~TaskQueueStdlib() {
+  DeleteChain(ready_head_);
+  DeleteChain(incoming_.PopAll());
+  DeleteChain(free_nodes_.PopAll());
+}
+
+// static
+void TaskQueueStdlib::DeleteChain(TaskNode* node) {
+  while (node) {
+    TaskNode* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+TaskQueueStdlib::TaskNode* TaskQueueStdlib::AllocateTaskNode() {
+  // Take the whole free list with one exchange; keeping a single-pop here
+  // would be subject to the classic ABA problem. Leftover nodes are pushed
+  // right back, so contention just degrades to an occasional allocation.
+  TaskNode* node = free_nodes_.PopAll();
+  if (!node) {
+    return new TaskNode();
+  }
+  TaskNode* rest = node->next;
+  while (rest) {
+    TaskNode* next = rest->next;
+    free_nodes_.Push(rest);
+    rest = next;
+  }
+  free_node_count_.fetch_sub(1, std::memory_order_relaxed);
+  node->next = nullptr;
+  return node;
+}
+
+void TaskQueueStdlib::FreeTaskNode(TaskNode* node) {
+  // Bounds the free list to roughly the depth of a posting burst.
+  static constexpr int kMaxFreeNodes = 256;
+  node->task = nullptr;
+  if (free_node_count_.load(std::memory_order_relaxed) >= kMaxFreeNodes) {
+    delete node;
+    return;
+  }
+  free_node_count_.fetch_add(1, std::memory_order_relaxed);
+  free_nodes_.Push(node);
+}
+
+void TaskQueueStdlib::RefillReadyList() {
+  TaskNode* chain = incoming_.PopAll();
+  // The chain is in LIFO order; reverse it onto the ready list.
+  TaskNode* reversed = nullptr;
+  while (chain) {
+    TaskNode* next = chain->next;
+    chain->next = reversed;
+    reversed = chain;
+    chain = next;
+  }
+  if (!reversed) {
+    return;
+  }
+  if (ready_tail_) {
+    ready_tail_->next = reversed;
+  } else {
+    ready_head_ = reversed;
+  }
+  ready_tail_ = reversed;
+  while (ready_tail_->next) {
+    ready_tail_ = ready_tail_->next;
+  }
+}
+
 void TaskQueueStdlib::Delete() {
   RTC_DCHECK(!IsCurrent());
 
-  {
-    rtc::CritScope lock(&pending_lock_);
-    thread_should_quit_ = true;
-  }
+  thread_should_quit_.store(true, std::memory_order_release);
 
   NotifyWake();
 
@@ -147,13 +259,10 @@ void TaskQueueStdlib::Delete() {
 }
 
 void TaskQueueStdlib::PostTask(std::unique_ptr<QueuedTask> task) {
-  {
-    rtc::CritScope lock(&pending_lock_);
-    OrderId order = thread_posting_order_++;
-
-    pending_queue_.push(std::pair<OrderId, std::unique_ptr<QueuedTask>>(
-        order, std::move(task)));
-  }
+  TaskNode* node = AllocateTaskNode();
+  node->order = thread_posting_order_.fetch_add(1, std::memory_order_relaxed);
+  node->task = std::move(task);
+  incoming_.Push(node);
 
   NotifyWake();
 }
@@ -164,10 +273,11 @@ void TaskQueueStdlib::PostDelayedTask(std::unique_ptr<QueuedTask> task,
 
   DelayedEntryTimeout delay;
   delay.next_fire_at_ms_ = fire_at;
+  delay.order_ =
+      1 + thread_posting_order_.fetch_add(1, std::memory_order_relaxed);
 
   {
     rtc::CritScope lock(&pending_lock_);
-    delay.order_ = ++thread_posting_order_;
     delayed_queue_[delay] = std::move(task);
   }
 
@@ -179,41 +289,45 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
 
   auto tick = rtc::TimeMillis();
 
-  rtc::CritScope lock(&pending_lock_);
-
-  if (thread_should_quit_) {
+  if (thread_should_quit_.load(std::memory_order_acquire)) {
     result.final_task_ = true;
     return result;
   }
 
-  if (delayed_queue_.size() > 0) {
-    auto delayed_entry = delayed_queue_.begin();
-    const auto& delay_info = delayed_entry->first;
-    auto& delay_run = delayed_entry->second;
-    if (tick >= delay_info.next_fire_at_ms_) {
-      if (pending_queue_.size() > 0) {
-        auto& entry = pending_queue_.front();
-        auto& entry_order = entry.first;
-        auto& entry_run = entry.second;
-        if (entry_order < delay_info.order_) {
-          result.run_task_ = std::move(entry_run);
-          pending_queue_.pop();
+  if (!ready_head_) {
+    RefillReadyList();
+  }
+
+  {
+    rtc::CritScope lock(&pending_lock_);
+    if (delayed_queue_.size() > 0) {
+      auto delayed_entry = delayed_queue_.begin();
+      const auto& delay_info = delayed_entry->first;
+      auto& delay_run = delayed_entry->second;
+      if (tick >= delay_info.next_fire_at_ms_) {
+        if (ready_head_ && ready_head_->order < delay_info.order_) {
+          // An immediate task was posted before the delayed one; run it
+          // first to preserve posting order.
+        } else {
+          result.run_task_ = std::move(delay_run);
+          delayed_queue_.erase(delayed_entry);
           return result;
         }
+      } else {
+        result.sleep_time_ms_ = delay_info.next_fire_at_ms_ - tick;
       }
-
-      result.run_task_ = std::move(delay_run);
-      delayed_queue_.erase(delayed_entry);
-      return result;
     }
-
-    result.sleep_time_ms_ = delay_info.next_fire_at_ms_ - tick;
   }
 
-  if (pending_queue_.size() > 0) {
-    auto& entry = pending_queue_.front();
-    result.run_task_ = std::move(entry.second);
-    pending_queue_.pop();
+  if (ready_head_) {
+    TaskNode* node = ready_head_;
+    ready_head_ = node->next;
+    if (!ready_head_) {
+      ready_tail_ = nullptr;
+    }
+    result.run_task_ = std::move(node->task);
+    result.sleep_time_ms_ = 0;
+    FreeTaskNode(node);
   }
 
   return result;
@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+
+#include <utility>
+
+#include "absl/memory/memory.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+namespace {
+
+// Task queue that runs its tasks on a worker task queue shared with other
+// pooled queues. Tasks are wrapped so that the pooled queue is what
+// TaskQueueBase::Current() returns while they run, and so that tasks still
+// queued on the worker when the pooled queue is deleted turn into no-ops
+// instead of running.
+class PooledTaskQueue : public TaskQueueBase {
+ public:
+  explicit PooledTaskQueue(TaskQueueBase* worker)
+      : worker_(worker), state_(std::make_shared<SharedState>()) {}
+
+  void Delete() override {
+    {
+      // Taking the lock waits for a task currently running on this queue to
+      // finish, and clearing |alive| stops already posted tasks from running.
+      rtc::CritScope cs(&state_->lock);
+      state_->alive = false;
+    }
+    delete this;
+  }
+
+  void PostTask(std::unique_ptr<QueuedTask> task) override {
+    worker_->PostTask(
+        absl::make_unique<WrapperTask>(this, state_, std::move(task)));
+  }
+
+  void PostDelayedTask(std::unique_ptr<QueuedTask> task,
+                       uint32_t milliseconds) override {
+    worker_->PostDelayedTask(
+        absl::make_unique<WrapperTask>(this, state_, std::move(task)),
+        milliseconds);
+  }
+
+ private:
+  // Outlives the queue so that wrapper tasks that run after the queue has
+  // been deleted can still find out that it is gone.
+  struct SharedState {
+    rtc::CriticalSection lock;
+    bool alive RTC_GUARDED_BY(lock) = true;
+  };
+
+  class WrapperTask : public QueuedTask {
+   public:
+    WrapperTask(TaskQueueBase* queue,
+                std::shared_ptr<SharedState> state,
+                std::unique_ptr<QueuedTask> task)
+        : queue_(queue), state_(std::move(state)), task_(std::move(task)) {}
+
+   private:
+    bool Run() override {
+      rtc::CritScope cs(&state_->lock);
+      if (!state_->alive)
+        return true;
+      CurrentTaskQueueSetter set_current(queue_);
+      if (!task_->Run())
+        task_.release();
+      return true;
+    }
+
+    TaskQueueBase* const queue_;
+    const std::shared_ptr<SharedState> state_;
+    std::unique_ptr<QueuedTask> task_;
+  };
+
+  ~PooledTaskQueue() override = default;
+
+  TaskQueueBase* const worker_;
+  const std::shared_ptr<SharedState> state_;
+};
+
+}  // namespace
+
+PooledTaskQueueFactory::PooledTaskQueueFactory(
+    const TaskQueueFactory& base_factory,
+    size_t num_workers,
+    absl::string_view worker_name_prefix,
+    Priority priority)
+    : next_worker_(0) {
+  RTC_DCHECK_GT(num_workers, 0u);
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    rtc::StringBuilder name;
+    name << worker_name_prefix << i;
+    workers_.push_back(base_factory.CreateTaskQueue(name.str(), priority));
+  }
+}
+
+std::unique_ptr<TaskQueueBase, TaskQueueDeleter>
+PooledTaskQueueFactory::CreateTaskQueue(absl::string_view name,
+                                        Priority priority) const {
+  TaskQueueBase* worker =
+      workers_[next_worker_.fetch_add(1) % workers_.size()].get();
+  return std::unique_ptr<TaskQueueBase, TaskQueueDeleter>(
+      new PooledTaskQueue(worker));
+}
+
+}  // namespace webrtc
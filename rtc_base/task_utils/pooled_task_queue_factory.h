@@ -0,0 +1,55 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
+#define RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+
+namespace webrtc {
+
+// TaskQueueFactory that runs the task queues it creates on a fixed-size pool
+// of worker task queues instead of giving every queue its own thread. Each
+// created queue is pinned to one worker, selected round-robin, so tasks
+// posted to a single queue still run in FIFO order and never overlap while
+// the number of threads is bounded by |num_workers|.
+//
+// The per-queue priority passed to CreateTaskQueue is ignored; all workers
+// run at the priority given to the constructor. Deleting a created queue
+// blocks until a task currently running on it has finished, so a queue must
+// not be deleted from a task running on the worker it is pinned to.
+class PooledTaskQueueFactory : public TaskQueueFactory {
+ public:
+  // |base_factory| is used to create the workers and must outlive this
+  // factory.
+  PooledTaskQueueFactory(const TaskQueueFactory& base_factory,
+                         size_t num_workers,
+                         absl::string_view worker_name_prefix,
+                         Priority priority);
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override;
+
+ private:
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> workers_;
+  mutable std::atomic<size_t> next_worker_;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+
+#include <memory>
+
+#include "absl/memory/memory.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_test.h"
+#include "rtc_base/event.h"
+#include "rtc_base/task_utils/to_queued_task.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Wraps a PooledTaskQueueFactory together with the factory its workers are
+// created from, so that tests can own both through a single
+// TaskQueueFactory pointer.
+class PooledTaskQueueFactoryForTest : public TaskQueueFactory {
+ public:
+  explicit PooledTaskQueueFactoryForTest(size_t num_workers)
+      : base_factory_(CreateDefaultTaskQueueFactory()),
+        pooled_factory_(*base_factory_,
+                        num_workers,
+                        "PooledWorker",
+                        Priority::NORMAL) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override {
+    return pooled_factory_.CreateTaskQueue(name, priority);
+  }
+
+ private:
+  const std::unique_ptr<TaskQueueFactory> base_factory_;
+  PooledTaskQueueFactory pooled_factory_;
+};
+
+std::unique_ptr<TaskQueueFactory> CreateSingleWorkerPool() {
+  return absl::make_unique<PooledTaskQueueFactoryForTest>(1);
+}
+
+std::unique_ptr<TaskQueueFactory> CreateTwoWorkerPool() {
+  return absl::make_unique<PooledTaskQueueFactoryForTest>(2);
+}
+
+// A pool with one worker is the interesting configuration since every queue
+// shares the same thread, but the task queue contract has to hold for larger
+// pools as well.
+INSTANTIATE_TEST_SUITE_P(PooledSingleWorker,
+                         TaskQueueTest,
+                         ::testing::Values(CreateSingleWorkerPool));
+INSTANTIATE_TEST_SUITE_P(PooledTwoWorkers,
+                         TaskQueueTest,
+                         ::testing::Values(CreateTwoWorkerPool));
+
+TEST(PooledTaskQueueFactoryTest, QueuesSharingWorkerReportOwnCurrent) {
+  PooledTaskQueueFactoryForTest factory(1);
+  auto queue1 =
+      factory.CreateTaskQueue("Queue1", TaskQueueFactory::Priority::NORMAL);
+  auto queue2 =
+      factory.CreateTaskQueue("Queue2", TaskQueueFactory::Priority::NORMAL);
+
+  rtc::Event done;
+  queue1->PostTask(ToQueuedTask([&] {
+    EXPECT_TRUE(queue1->IsCurrent());
+    EXPECT_FALSE(queue2->IsCurrent());
+    queue2->PostTask(ToQueuedTask([&] {
+      EXPECT_TRUE(queue2->IsCurrent());
+      EXPECT_FALSE(queue1->IsCurrent());
+      done.Set();
+    }));
+  }));
+  EXPECT_TRUE(done.Wait(1000));
+}
+
+TEST(PooledTaskQueueFactoryTest, DeletedQueueDoesNotRunPendingTasks) {
+  PooledTaskQueueFactoryForTest factory(1);
+  auto blocker =
+      factory.CreateTaskQueue("Blocker", TaskQueueFactory::Priority::NORMAL);
+  auto deleted =
+      factory.CreateTaskQueue("Deleted", TaskQueueFactory::Priority::NORMAL);
+
+  rtc::Event unblock;
+  rtc::Event ran;
+  // Keep the shared worker busy so that the task posted below is still
+  // queued when its task queue is deleted.
+  blocker->PostTask(
+      ToQueuedTask([&unblock] { unblock.Wait(rtc::Event::kForever); }));
+  deleted->PostTask(ToQueuedTask([&ran] { ran.Set(); }));
+  deleted = nullptr;
+  unblock.Set();
+  EXPECT_FALSE(ran.Wait(100));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/thread_attributes.h"
+
+#if defined(WEBRTC_LINUX)
+#include <sched.h>
+#endif
+#if defined(WEBRTC_WIN)
+// clang-format off
+// clang formatting would put <windows.h> last, which breaks the build.
+#include <windows.h>
+// clang-format on
+#endif
+
+namespace rtc {
+namespace {
+
+// Written once at startup before any WebRTC thread is spawned, read from the
+// spawned threads afterwards.
+ThreadAttributesPolicy g_policy = nullptr;
+ThreadMemoryBindingHook g_memory_binding_hook = nullptr;
+
+void ApplyAffinity(const std::vector<int>& cpus) {
+  if (cpus.empty())
+    return;
+#if defined(WEBRTC_LINUX)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &cpu_set);
+  }
+  sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#elif defined(WEBRTC_WIN)
+  DWORD_PTR mask = 0;
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < static_cast<int>(8 * sizeof(DWORD_PTR)))
+      mask |= static_cast<DWORD_PTR>(1) << cpu;
+  }
+  if (mask != 0)
+    ::SetThreadAffinityMask(::GetCurrentThread(), mask);
+#endif
+}
+
+}  // namespace
+
+ThreadAttributes::ThreadAttributes() = default;
+ThreadAttributes::ThreadAttributes(const ThreadAttributes&) = default;
+ThreadAttributes& ThreadAttributes::operator=(const ThreadAttributes&) =
+    default;
+ThreadAttributes::~ThreadAttributes() = default;
+
+void SetThreadAttributesPolicy(ThreadAttributesPolicy policy,
+                               ThreadMemoryBindingHook memory_binding_hook) {
+  g_policy = policy;
+  g_memory_binding_hook = memory_binding_hook;
+}
+
+void ApplyThreadAttributes(absl::string_view name) {
+  if (g_policy == nullptr)
+    return;
+  absl::optional<ThreadAttributes> attributes = g_policy(name);
+  if (!attributes)
+    return;
+  ApplyAffinity(attributes->affinity_cpus);
+  if (g_memory_binding_hook != nullptr)
+    g_memory_binding_hook(attributes->numa_node);
+}
+
+}  // namespace rtc
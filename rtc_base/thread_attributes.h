@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_THREAD_ATTRIBUTES_H_
+#define RTC_BASE_THREAD_ATTRIBUTES_H_
+
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+namespace rtc {
+
+// Placement attributes applied to a WebRTC-owned thread right after it has
+// been spawned. Embedders running on multi-socket hosts use this to keep the
+// network thread, the pacer and the encoder queues on one NUMA node instead
+// of letting the scheduler bounce them across sockets.
+struct ThreadAttributes {
+  ThreadAttributes();
+  ThreadAttributes(const ThreadAttributes&);
+  ThreadAttributes& operator=(const ThreadAttributes&);
+  ~ThreadAttributes();
+
+  // CPU indices the thread may run on. An empty list leaves the thread
+  // unpinned.
+  std::vector<int> affinity_cpus;
+  // NUMA node the thread's allocations should come from, or -1 for no
+  // preference. WebRTC does not bind memory itself; the value is forwarded
+  // to the memory binding hook below so the embedder can apply its own
+  // policy (e.g. set_mempolicy or numa_setlocal_memory).
+  int numa_node = -1;
+};
+
+// Returns the attributes to apply to the thread named |name| (the same name
+// that is passed to PlatformThread and TaskQueueFactory::CreateTaskQueue),
+// or nullopt to leave the thread alone. Called on the spawned thread itself,
+// so implementations must be thread-safe.
+typedef absl::optional<ThreadAttributes> (*ThreadAttributesPolicy)(
+    absl::string_view name);
+
+// Called on the spawned thread after its affinity has been applied, with the
+// |numa_node| requested by the policy (may be -1). Gives the embedder a spot
+// to bind the thread's allocations node-local before any are made.
+typedef void (*ThreadMemoryBindingHook)(int numa_node);
+
+// Installs the process-wide placement policy. Both arguments may be null to
+// disable the respective step. Must be called before WebRTC threads are
+// spawned; typically once at process startup.
+void SetThreadAttributesPolicy(ThreadAttributesPolicy policy,
+                               ThreadMemoryBindingHook memory_binding_hook);
+
+// Applies the installed policy to the calling thread. Invoked by
+// PlatformThread::Run() on every spawned thread, which also covers the task
+// queue implementations built on PlatformThread. No-op when no policy is
+// installed or the policy declines the thread.
+void ApplyThreadAttributes(absl::string_view name);
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_THREAD_ATTRIBUTES_H_
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/thread_attributes.h"
+
+#include <string>
+
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace {
+
+std::string* g_last_policy_name = nullptr;
+int g_last_bound_numa_node = -2;
+
+absl::optional<ThreadAttributes> RecordingPolicy(absl::string_view name) {
+  *g_last_policy_name = std::string(name);
+  ThreadAttributes attributes;
+  attributes.numa_node = 1;
+  return attributes;
+}
+
+void RecordingMemoryBindingHook(int numa_node) {
+  g_last_bound_numa_node = numa_node;
+}
+
+absl::optional<ThreadAttributes> DecliningPolicy(absl::string_view name) {
+  *g_last_policy_name = std::string(name);
+  return absl::nullopt;
+}
+
+void NopRunFunction(void* obj) {
+  static_cast<Event*>(obj)->Set();
+}
+
+class ThreadAttributesTest : public ::testing::Test {
+ public:
+  ThreadAttributesTest() {
+    g_last_policy_name = &policy_name_;
+    g_last_bound_numa_node = -2;
+  }
+  ~ThreadAttributesTest() override {
+    SetThreadAttributesPolicy(nullptr, nullptr);
+    g_last_policy_name = nullptr;
+  }
+
+ protected:
+  void RunThread(const char* name) {
+    Event done;
+    PlatformThread thread(&NopRunFunction, &done, name);
+    thread.Start();
+    EXPECT_TRUE(done.Wait(30000));
+    thread.Stop();
+  }
+
+  std::string policy_name_;
+};
+
+TEST_F(ThreadAttributesTest, PolicyReceivesThreadNameAndHookTheNode) {
+  SetThreadAttributesPolicy(&RecordingPolicy, &RecordingMemoryBindingHook);
+  RunThread("AttributesTestThread");
+  EXPECT_EQ(policy_name_, "AttributesTestThread");
+  EXPECT_EQ(g_last_bound_numa_node, 1);
+}
+
+TEST_F(ThreadAttributesTest, DecliningPolicySkipsMemoryBindingHook) {
+  SetThreadAttributesPolicy(&DecliningPolicy, &RecordingMemoryBindingHook);
+  RunThread("DeclinedThread");
+  EXPECT_EQ(policy_name_, "DeclinedThread");
+  EXPECT_EQ(g_last_bound_numa_node, -2);
+}
+
+TEST_F(ThreadAttributesTest, NoPolicyIsANoOp) {
+  SetThreadAttributesPolicy(nullptr, &RecordingMemoryBindingHook);
+  RunThread("UnmanagedThread");
+  EXPECT_EQ(policy_name_, "");
+  EXPECT_EQ(g_last_bound_numa_node, -2);
+}
+
+}  // namespace
+}  // namespace rtc
@@ -12,10 +12,16 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <memory>
 
+#include "absl/memory/memory.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+#include "system_wrappers/include/cpu_info.h"
 #include "test/testsupport/perf_test.h"
 #include "third_party/libyuv/include/libyuv/compare.h"
 
@@ -53,23 +59,74 @@ double Ssim(const rtc::scoped_refptr<I420BufferInterface>& ref_buffer,
   return CalculateMetric(&libyuv::I420Ssim, ref_buffer, test_buffer);
 }
 
-std::vector<AnalysisResult> RunAnalysis(
-    const rtc::scoped_refptr<webrtc::test::Video>& reference_video,
-    const rtc::scoped_refptr<webrtc::test::Video>& test_video,
-    const std::vector<size_t>& test_frame_indices) {
-  std::vector<AnalysisResult> results;
-  for (size_t i = 0; i < test_video->number_of_frames(); ++i) {
-    const rtc::scoped_refptr<I420BufferInterface>& test_frame =
-        test_video->GetFrame(i);
-    const rtc::scoped_refptr<I420BufferInterface>& reference_frame =
-        reference_video->GetFrame(i);
+namespace {
+
+// Shared state for the analysis worker threads. Each worker claims the next
+// unprocessed frame index from |next_frame_index|, so faster threads simply
+// take on more frames, and writes its result to the per-frame slot in
+// |results|.
+struct FrameAnalysisContext {
+  rtc::scoped_refptr<webrtc::test::Video> reference_video;
+  rtc::scoped_refptr<webrtc::test::Video> test_video;
+  const std::vector<size_t>* test_frame_indices;
+  std::vector<AnalysisResult>* results;
+  std::atomic<size_t> next_frame_index{0};
+  // Frame fetches are serialized since file-backed videos share a file
+  // position; the metric computation, which dominates, runs in parallel.
+  rtc::CriticalSection frame_fetch_lock;
+};
+
+void AnalyzeFrames(void* obj) {
+  FrameAnalysisContext* context = static_cast<FrameAnalysisContext*>(obj);
+  const size_t number_of_frames = context->test_video->number_of_frames();
+  while (true) {
+    const size_t i = context->next_frame_index.fetch_add(1);
+    if (i >= number_of_frames)
+      return;
+
+    rtc::scoped_refptr<I420BufferInterface> reference_frame;
+    rtc::scoped_refptr<I420BufferInterface> test_frame;
+    {
+      rtc::CritScope lock(&context->frame_fetch_lock);
+      reference_frame = context->reference_video->GetFrame(i);
+      test_frame = context->test_video->GetFrame(i);
+    }
 
     // Fill in the result struct.
-    AnalysisResult result;
-    result.frame_number = test_frame_indices[i];
+    AnalysisResult& result = (*context->results)[i];
+    result.frame_number = (*context->test_frame_indices)[i];
     result.psnr_value = Psnr(reference_frame, test_frame);
     result.ssim_value = Ssim(reference_frame, test_frame);
-    results.push_back(result);
+  }
+}
+
+}  // namespace
+
+std::vector<AnalysisResult> RunAnalysis(
+    const rtc::scoped_refptr<webrtc::test::Video>& reference_video,
+    const rtc::scoped_refptr<webrtc::test::Video>& test_video,
+    const std::vector<size_t>& test_frame_indices) {
+  const size_t number_of_frames = test_video->number_of_frames();
+  std::vector<AnalysisResult> results(number_of_frames);
+
+  FrameAnalysisContext context;
+  context.reference_video = reference_video;
+  context.test_video = test_video;
+  context.test_frame_indices = &test_frame_indices;
+  context.results = &results;
+
+  // The frames are independent, so compare them on all available cores.
+  const size_t number_of_threads =
+      std::min(number_of_frames,
+               static_cast<size_t>(CpuInfo::DetectNumberOfCores()));
+  std::vector<std::unique_ptr<rtc::PlatformThread>> threads;
+  for (size_t i = 0; i < number_of_threads; ++i) {
+    threads.push_back(absl::make_unique<rtc::PlatformThread>(
+        &AnalyzeFrames, &context, "FrameAnalyzer"));
+    threads.back()->Start();
+  }
+  for (const std::unique_ptr<rtc::PlatformThread>& thread : threads) {
+    thread->Stop();
   }
 
   return results;
@@ -12,8 +12,15 @@
 
 #include <cstdio>
 #include <string>
+#include <utility>
 #include <vector>
 
+#if defined(WEBRTC_POSIX)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "absl/strings/match.h"
 #include "absl/types/optional.h"
 #include "api/video/i420_buffer.h"
@@ -76,6 +83,84 @@ class VideoFile : public Video {
   FILE* const file_;
 };
 
+#if defined(WEBRTC_POSIX)
+
+class MappedVideoFile;
+
+// I420 frame that points straight into a read-only memory mapping of the
+// video file. Keeps a reference to the owning video so that the mapping
+// outlives the frame.
+class MappedFrameBuffer : public I420BufferInterface {
+ public:
+  MappedFrameBuffer(rtc::scoped_refptr<const Video> video,
+                    int width,
+                    int height,
+                    const uint8_t* data)
+      : video_(std::move(video)), width_(width), height_(height), data_(data) {}
+
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+
+  const uint8_t* DataY() const override { return data_; }
+  const uint8_t* DataU() const override { return data_ + width_ * height_; }
+  const uint8_t* DataV() const override {
+    return data_ + width_ * height_ + ChromaWidth() * ChromaHeight();
+  }
+
+  int StrideY() const override { return width_; }
+  int StrideU() const override { return ChromaWidth(); }
+  int StrideV() const override { return ChromaWidth(); }
+
+ private:
+  const rtc::scoped_refptr<const Video> video_;
+  const int width_;
+  const int height_;
+  const uint8_t* const data_;
+};
+
+// Video backed by a read-only memory mapping of the file. GetFrame() returns
+// frames referencing the mapping directly, without copying pixel data or
+// touching any shared file position, so it is safe to call concurrently from
+// several threads.
+class MappedVideoFile : public Video {
+ public:
+  MappedVideoFile(int width,
+                  int height,
+                  std::vector<size_t> frame_offsets,
+                  const uint8_t* mapping,
+                  size_t mapping_size)
+      : width_(width),
+        height_(height),
+        frame_offsets_(std::move(frame_offsets)),
+        mapping_(mapping),
+        mapping_size_(mapping_size) {}
+
+  ~MappedVideoFile() override {
+    munmap(const_cast<uint8_t*>(mapping_), mapping_size_);
+  }
+
+  size_t number_of_frames() const override { return frame_offsets_.size(); }
+  int width() const override { return width_; }
+  int height() const override { return height_; }
+
+  rtc::scoped_refptr<I420BufferInterface> GetFrame(
+      size_t frame_index) const override {
+    RTC_CHECK_LT(frame_index, frame_offsets_.size());
+    return new rtc::RefCountedObject<MappedFrameBuffer>(
+        rtc::scoped_refptr<const Video>(this), width_, height_,
+        mapping_ + frame_offsets_[frame_index]);
+  }
+
+ private:
+  const int width_;
+  const int height_;
+  const std::vector<size_t> frame_offsets_;
+  const uint8_t* const mapping_;
+  const size_t mapping_size_;
+};
+
+#endif  // defined(WEBRTC_POSIX)
+
 }  // namespace
 
 Video::Iterator::Iterator(const rtc::scoped_refptr<const Video>& video,
@@ -203,6 +288,7 @@ rtc::scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
 
   const int i420_frame_size = 3 * *width * *height / 2;
   std::vector<fpos_t> frame_positions;
+  std::vector<size_t> frame_offsets;
   while (true) {
     int parse_frame_header_result = -1;
     if (fscanf(file, "FRAME\n%n", &parse_frame_header_result) != 0 ||
@@ -215,6 +301,7 @@ rtc::scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
     fpos_t pos;
     fgetpos(file, &pos);
     frame_positions.push_back(pos);
+    frame_offsets.push_back(static_cast<size_t>(ftell(file)));
     // Skip over YUV pixel data.
     fseek(file, i420_frame_size, SEEK_CUR);
   }
@@ -224,6 +311,35 @@ rtc::scoped_refptr<Video> OpenY4mFile(const std::string& file_name) {
   }
   RTC_LOG(LS_INFO) << "Video has " << frame_positions.size() << " frames";
 
+#if defined(WEBRTC_POSIX)
+  // Map the file read-only and stream frames straight out of the page cache
+  // instead of buffering every frame through stdio. This also makes GetFrame()
+  // safe to call from several threads at once.
+  struct stat file_stat;
+  if (fstat(fileno(file), &file_stat) == 0) {
+    const size_t file_size = static_cast<size_t>(file_stat.st_size);
+    // A truncated last frame can't be served from the mapping; drop it like
+    // the buffered reader would have failed to read it.
+    while (!frame_offsets.empty() &&
+           frame_offsets.back() + i420_frame_size > file_size) {
+      RTC_LOG(LS_WARNING) << "Dropping truncated last frame";
+      frame_offsets.pop_back();
+    }
+    if (!frame_offsets.empty()) {
+      void* mapping =
+          mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fileno(file), 0);
+      if (mapping != MAP_FAILED) {
+        fclose(file);
+        return new rtc::RefCountedObject<MappedVideoFile>(
+            *width, *height, std::move(frame_offsets),
+            static_cast<const uint8_t*>(mapping), file_size);
+      }
+    }
+  }
+  RTC_LOG(LS_WARNING) << "Could not mmap " << file_name
+                      << ", falling back to buffered reads";
+#endif
+
   return new rtc::RefCountedObject<VideoFile>(*width, *height, frame_positions,
                                               file);
 }
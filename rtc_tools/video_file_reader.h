@@ -23,8 +23,9 @@
 namespace webrtc {
 namespace test {
 
-// Iterable class representing a sequence of I420 buffers. This class is not
-// thread safe because it is expected to be backed by a file.
+// Iterable class representing a sequence of I420 buffers. Implementations
+// backed by a shared file position are not thread safe; memory-mapped
+// implementations (.y4m files on POSIX) support concurrent GetFrame() calls.
 class Video : public rtc::RefCountInterface {
  public:
   class Iterator {
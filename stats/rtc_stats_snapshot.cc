@@ -0,0 +1,457 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "stats/rtc_stats_snapshot.h"
+
+#include <string.h>
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "rtc_base/arraysize.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/strings/string_builder.h"
+
+namespace webrtc {
+
+namespace {
+
+// Snapshot layout (all multi-byte integers are varints unless noted):
+//   "RTCS" magic, version, group count
+// then per group:
+//   schema id (8 bytes LE), type name, member count,
+//   member table: (name, type byte) per member,
+//   stats count, ids column, zigzag timestamps column,
+//   per member: presence bitmap (stats count bits), defined values.
+const char kSnapshotMagic[4] = {'R', 'T', 'C', 'S'};
+const uint64_t kSnapshotVersion = 1;
+
+void AppendVarInt(uint64_t value, rtc::Buffer* out) {
+  uint8_t bytes[10];
+  size_t length = 0;
+  do {
+    uint8_t byte = value & 0x7f;
+    value >>= 7;
+    if (value > 0)
+      byte |= 0x80;
+    bytes[length++] = byte;
+  } while (value > 0);
+  out->AppendData(bytes, length);
+}
+
+void AppendZigZag(int64_t value, rtc::Buffer* out) {
+  AppendVarInt((static_cast<uint64_t>(value) << 1) ^
+                   static_cast<uint64_t>(value >> 63),
+               out);
+}
+
+void AppendDouble(double value, rtc::Buffer* out) {
+  uint8_t bytes[sizeof(double)];
+  memcpy(bytes, &value, sizeof(double));
+  out->AppendData(bytes, sizeof(double));
+}
+
+void AppendString(absl::string_view value, rtc::Buffer* out) {
+  AppendVarInt(value.size(), out);
+  out->AppendData(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+}
+
+template <typename T>
+const T& ValueOf(const RTCStatsMemberInterface& member) {
+  return *member.cast_to<RTCStatsMember<T>>();
+}
+
+void AppendMemberValue(const RTCStatsMemberInterface& member,
+                       rtc::Buffer* out) {
+  switch (member.type()) {
+    case RTCStatsMemberInterface::kBool:
+      AppendVarInt(ValueOf<bool>(member) ? 1 : 0, out);
+      break;
+    case RTCStatsMemberInterface::kInt32:
+      AppendZigZag(ValueOf<int32_t>(member), out);
+      break;
+    case RTCStatsMemberInterface::kUint32:
+      AppendVarInt(ValueOf<uint32_t>(member), out);
+      break;
+    case RTCStatsMemberInterface::kInt64:
+      AppendZigZag(ValueOf<int64_t>(member), out);
+      break;
+    case RTCStatsMemberInterface::kUint64:
+      AppendVarInt(ValueOf<uint64_t>(member), out);
+      break;
+    case RTCStatsMemberInterface::kDouble:
+      AppendDouble(ValueOf<double>(member), out);
+      break;
+    case RTCStatsMemberInterface::kString:
+      AppendString(ValueOf<std::string>(member), out);
+      break;
+    case RTCStatsMemberInterface::kSequenceBool: {
+      const std::vector<bool>& values = ValueOf<std::vector<bool>>(member);
+      AppendVarInt(values.size(), out);
+      for (bool value : values)
+        AppendVarInt(value ? 1 : 0, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceInt32: {
+      const std::vector<int32_t>& values =
+          ValueOf<std::vector<int32_t>>(member);
+      AppendVarInt(values.size(), out);
+      for (int32_t value : values)
+        AppendZigZag(value, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceUint32: {
+      const std::vector<uint32_t>& values =
+          ValueOf<std::vector<uint32_t>>(member);
+      AppendVarInt(values.size(), out);
+      for (uint32_t value : values)
+        AppendVarInt(value, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceInt64: {
+      const std::vector<int64_t>& values =
+          ValueOf<std::vector<int64_t>>(member);
+      AppendVarInt(values.size(), out);
+      for (int64_t value : values)
+        AppendZigZag(value, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceUint64: {
+      const std::vector<uint64_t>& values =
+          ValueOf<std::vector<uint64_t>>(member);
+      AppendVarInt(values.size(), out);
+      for (uint64_t value : values)
+        AppendVarInt(value, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceDouble: {
+      const std::vector<double>& values = ValueOf<std::vector<double>>(member);
+      AppendVarInt(values.size(), out);
+      for (double value : values)
+        AppendDouble(value, out);
+      break;
+    }
+    case RTCStatsMemberInterface::kSequenceString: {
+      const std::vector<std::string>& values =
+          ValueOf<std::vector<std::string>>(member);
+      AppendVarInt(values.size(), out);
+      for (const std::string& value : values)
+        AppendString(value, out);
+      break;
+    }
+  }
+}
+
+uint64_t Fnv1a64(uint64_t hash, const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3u;
+  }
+  return hash;
+}
+
+uint64_t SchemaIdOf(
+    absl::string_view type_name,
+    const std::vector<const RTCStatsMemberInterface*>& members) {
+  uint64_t hash = 0xcbf29ce484222325u;
+  hash = Fnv1a64(hash, type_name.data(), type_name.size());
+  for (const RTCStatsMemberInterface* member : members) {
+    hash = Fnv1a64(hash, member->name(), strlen(member->name()));
+    uint8_t type = static_cast<uint8_t>(member->type());
+    hash = Fnv1a64(hash, &type, 1);
+  }
+  return hash;
+}
+
+// Decoding side. The reader turns malformed input into |ok() == false|
+// rather than reading out of bounds; all Read functions are no-ops once a
+// read has failed.
+class SnapshotReader {
+ public:
+  explicit SnapshotReader(rtc::ArrayView<const uint8_t> data)
+      : ptr_(data.data()), end_(data.data() + data.size()) {}
+
+  bool ok() const { return ok_; }
+
+  bool ReadBytes(void* out, size_t size) {
+    if (!ok_ || static_cast<size_t>(end_ - ptr_) < size) {
+      ok_ = false;
+      return false;
+    }
+    memcpy(out, ptr_, size);
+    ptr_ += size;
+    return true;
+  }
+
+  uint64_t ReadVarInt() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (!ok_ || ptr_ == end_) {
+        ok_ = false;
+        return 0;
+      }
+      uint8_t byte = *ptr_++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+        return value;
+    }
+    ok_ = false;
+    return 0;
+  }
+
+  int64_t ReadZigZag() {
+    uint64_t value = ReadVarInt();
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+  }
+
+  double ReadDouble() {
+    double value = 0;
+    ReadBytes(&value, sizeof(double));
+    return value;
+  }
+
+  absl::string_view ReadString() {
+    uint64_t size = ReadVarInt();
+    if (!ok_ || static_cast<uint64_t>(end_ - ptr_) < size) {
+      ok_ = false;
+      return absl::string_view();
+    }
+    absl::string_view value(reinterpret_cast<const char*>(ptr_),
+                            static_cast<size_t>(size));
+    ptr_ += size;
+    return value;
+  }
+
+ private:
+  const uint8_t* ptr_;
+  const uint8_t* const end_;
+  bool ok_ = true;
+};
+
+// Mirrors rtc_stats.cc's ToStringAsDouble: JSON numbers only hold about 15
+// decimal digits, so 64-bit integers and doubles are formatted as doubles.
+void AppendJsonDouble(double value, rtc::StringBuilder* sb) {
+  char buf[32];
+  const int len = std::snprintf(&buf[0], arraysize(buf), "%.16g", value);
+  RTC_DCHECK_LE(len, arraysize(buf));
+  *sb << absl::string_view(buf, len);
+}
+
+bool AppendJsonValue(RTCStatsMemberInterface::Type type,
+                     SnapshotReader* reader,
+                     rtc::StringBuilder* sb) {
+  switch (type) {
+    case RTCStatsMemberInterface::kBool:
+      *sb << (reader->ReadVarInt() != 0 ? "true" : "false");
+      return true;
+    case RTCStatsMemberInterface::kInt32:
+      *sb << static_cast<int32_t>(reader->ReadZigZag());
+      return true;
+    case RTCStatsMemberInterface::kUint32:
+      *sb << static_cast<uint32_t>(reader->ReadVarInt());
+      return true;
+    case RTCStatsMemberInterface::kInt64:
+      AppendJsonDouble(static_cast<double>(reader->ReadZigZag()), sb);
+      return true;
+    case RTCStatsMemberInterface::kUint64:
+      AppendJsonDouble(static_cast<double>(reader->ReadVarInt()), sb);
+      return true;
+    case RTCStatsMemberInterface::kDouble:
+      AppendJsonDouble(reader->ReadDouble(), sb);
+      return true;
+    case RTCStatsMemberInterface::kString:
+      *sb << "\"" << std::string(reader->ReadString()) << "\"";
+      return true;
+    case RTCStatsMemberInterface::kSequenceBool:
+    case RTCStatsMemberInterface::kSequenceInt32:
+    case RTCStatsMemberInterface::kSequenceUint32:
+    case RTCStatsMemberInterface::kSequenceInt64:
+    case RTCStatsMemberInterface::kSequenceUint64:
+    case RTCStatsMemberInterface::kSequenceDouble:
+    case RTCStatsMemberInterface::kSequenceString: {
+      RTCStatsMemberInterface::Type element_type;
+      switch (type) {
+        case RTCStatsMemberInterface::kSequenceBool:
+          element_type = RTCStatsMemberInterface::kBool;
+          break;
+        case RTCStatsMemberInterface::kSequenceInt32:
+          element_type = RTCStatsMemberInterface::kInt32;
+          break;
+        case RTCStatsMemberInterface::kSequenceUint32:
+          element_type = RTCStatsMemberInterface::kUint32;
+          break;
+        case RTCStatsMemberInterface::kSequenceInt64:
+          element_type = RTCStatsMemberInterface::kInt64;
+          break;
+        case RTCStatsMemberInterface::kSequenceUint64:
+          element_type = RTCStatsMemberInterface::kUint64;
+          break;
+        case RTCStatsMemberInterface::kSequenceDouble:
+          element_type = RTCStatsMemberInterface::kDouble;
+          break;
+        default:
+          element_type = RTCStatsMemberInterface::kString;
+          break;
+      }
+      uint64_t count = reader->ReadVarInt();
+      *sb << "[";
+      const char* separator = "";
+      for (uint64_t i = 0; reader->ok() && i < count; ++i) {
+        *sb << separator;
+        AppendJsonValue(element_type, reader, sb);
+        separator = ",";
+      }
+      *sb << "]";
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+uint64_t RtcStatsSchemaId(const RTCStats& stats) {
+  return SchemaIdOf(stats.type(), stats.Members());
+}
+
+void WriteRtcStatsSnapshot(const RTCStatsReport& report, rtc::Buffer* buffer) {
+  buffer->Clear();
+
+  // Group stats by type. kType is a unique static per stats class, so the
+  // pointer doubles as the group key.
+  std::map<const char*, std::vector<const RTCStats*>> groups;
+  for (RTCStatsReport::ConstIterator it = report.begin(); it != report.end();
+       ++it) {
+    groups[it->type()].push_back(&*it);
+  }
+
+  buffer->AppendData(reinterpret_cast<const uint8_t*>(kSnapshotMagic),
+                     sizeof(kSnapshotMagic));
+  AppendVarInt(kSnapshotVersion, buffer);
+  AppendVarInt(groups.size(), buffer);
+
+  std::vector<uint8_t> presence;
+  for (const auto& group : groups) {
+    const std::vector<const RTCStats*>& stats = group.second;
+    // All stats of one type expose the same members in the same order; take
+    // the member table from the first one.
+    std::vector<const RTCStatsMemberInterface*> members =
+        stats.front()->Members();
+
+    uint64_t schema_id = SchemaIdOf(group.first, members);
+    uint8_t schema_bytes[sizeof(uint64_t)];
+    for (size_t i = 0; i < sizeof(uint64_t); ++i)
+      schema_bytes[i] = static_cast<uint8_t>(schema_id >> (8 * i));
+    buffer->AppendData(schema_bytes, sizeof(schema_bytes));
+
+    AppendString(group.first, buffer);
+    AppendVarInt(members.size(), buffer);
+    for (const RTCStatsMemberInterface* member : members) {
+      AppendString(member->name(), buffer);
+      uint8_t type = static_cast<uint8_t>(member->type());
+      buffer->AppendData(&type, 1);
+    }
+
+    AppendVarInt(stats.size(), buffer);
+    for (const RTCStats* stat : stats)
+      AppendString(stat->id(), buffer);
+    for (const RTCStats* stat : stats)
+      AppendZigZag(stat->timestamp_us(), buffer);
+
+    presence.assign((stats.size() + 7) / 8, 0);
+    for (size_t m = 0; m < members.size(); ++m) {
+      presence.assign(presence.size(), 0);
+      for (size_t s = 0; s < stats.size(); ++s) {
+        if (stats[s]->Members()[m]->is_defined())
+          presence[s / 8] |= 1 << (s % 8);
+      }
+      buffer->AppendData(presence.data(), presence.size());
+      for (const RTCStats* stat : stats) {
+        const RTCStatsMemberInterface* member = stat->Members()[m];
+        if (member->is_defined())
+          AppendMemberValue(*member, buffer);
+      }
+    }
+  }
+}
+
+bool RtcStatsSnapshotToJson(rtc::ArrayView<const uint8_t> snapshot,
+                            std::string* json) {
+  SnapshotReader reader(snapshot);
+  char magic[sizeof(kSnapshotMagic)];
+  if (!reader.ReadBytes(magic, sizeof(magic)) ||
+      memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0) {
+    return false;
+  }
+  if (reader.ReadVarInt() != kSnapshotVersion)
+    return false;
+
+  uint64_t group_count = reader.ReadVarInt();
+  rtc::StringBuilder sb;
+  sb << "[";
+  const char* stat_separator = "";
+  for (uint64_t g = 0; reader.ok() && g < group_count; ++g) {
+    uint8_t schema_bytes[sizeof(uint64_t)];
+    reader.ReadBytes(schema_bytes, sizeof(schema_bytes));
+    std::string type_name(reader.ReadString());
+
+    uint64_t member_count = reader.ReadVarInt();
+    std::vector<std::string> member_names;
+    std::vector<RTCStatsMemberInterface::Type> member_types;
+    for (uint64_t m = 0; reader.ok() && m < member_count; ++m) {
+      member_names.push_back(std::string(reader.ReadString()));
+      uint8_t type;
+      reader.ReadBytes(&type, 1);
+      if (type > RTCStatsMemberInterface::kSequenceString)
+        return false;
+      member_types.push_back(static_cast<RTCStatsMemberInterface::Type>(type));
+    }
+
+    uint64_t stats_count = reader.ReadVarInt();
+    if (!reader.ok() || stats_count > snapshot.size())
+      return false;
+    // One StringBuilder per stat; members arrive column-wise but each stat's
+    // JSON object needs them together.
+    std::vector<rtc::StringBuilder> stats(stats_count);
+    for (uint64_t s = 0; reader.ok() && s < stats_count; ++s) {
+      stats[s] << "{\"type\":\"" << type_name << "\","
+               << "\"id\":\"" << std::string(reader.ReadString()) << "\",";
+    }
+    for (uint64_t s = 0; reader.ok() && s < stats_count; ++s)
+      stats[s] << "\"timestamp\":" << reader.ReadZigZag();
+
+    std::vector<uint8_t> presence((stats_count + 7) / 8);
+    for (uint64_t m = 0; reader.ok() && m < member_count; ++m) {
+      reader.ReadBytes(presence.data(), presence.size());
+      for (uint64_t s = 0; reader.ok() && s < stats_count; ++s) {
+        if (!(presence[s / 8] & (1 << (s % 8))))
+          continue;
+        stats[s] << ",\"" << member_names[m] << "\":";
+        if (!AppendJsonValue(member_types[m], &reader, &stats[s]))
+          return false;
+      }
+    }
+
+    for (uint64_t s = 0; reader.ok() && s < stats_count; ++s) {
+      sb << stat_separator << stats[s].Release() << "}";
+      stat_separator = ",";
+    }
+  }
+  if (!reader.ok())
+    return false;
+  sb << "]";
+  *json = sb.Release();
+  return true;
+}
+
+}  // namespace webrtc
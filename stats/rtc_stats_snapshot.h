@@ -0,0 +1,53 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef STATS_RTC_STATS_SNAPSHOT_H_
+#define STATS_RTC_STATS_SNAPSHOT_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "api/array_view.h"
+#include "api/stats/rtc_stats.h"
+#include "api/stats/rtc_stats_report.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// A compact binary serialization of an RTCStatsReport, meant for shipping
+// stats off-host at a regular cadence without paying for JSON marshalling.
+//
+// Stats objects are grouped by type and laid out column-wise: one member
+// table per group, then per member a presence bitmap followed by the defined
+// values. Integers use varint (zigzag for signed) encoding, doubles are raw
+// little-endian and strings are length-prefixed. Each group carries a schema
+// id derived from the member names and types, so a consumer can detect
+// schema changes without parsing member tables it has already seen.
+//
+// The writer clears |buffer| and appends the snapshot, reusing the buffer's
+// existing capacity; serializing at a fixed rate into the same buffer does
+// not allocate once the buffer has reached its steady-state size.
+RTC_EXPORT void WriteRtcStatsSnapshot(const RTCStatsReport& report,
+                                      rtc::Buffer* buffer);
+
+// Returns the schema id a snapshot group for |stats|' type would carry.
+RTC_EXPORT uint64_t RtcStatsSchemaId(const RTCStats& stats);
+
+// Converts a snapshot back into the JSON produced by RTCStats::ToJson, one
+// object per stat, grouped the way the snapshot is. Returns false and leaves
+// |json| untouched if |snapshot| is malformed or of an unknown version.
+RTC_EXPORT bool RtcStatsSnapshotToJson(rtc::ArrayView<const uint8_t> snapshot,
+                                       std::string* json);
+
+}  // namespace webrtc
+
+#endif  // STATS_RTC_STATS_SNAPSHOT_H_
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "stats/rtc_stats_snapshot.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api/stats/rtc_stats_report.h"
+#include "stats/test/rtc_test_stats.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+std::unique_ptr<RTCTestStats> CreateFullTestStats(const std::string& id,
+                                                  int64_t timestamp_us) {
+  std::unique_ptr<RTCTestStats> stats(new RTCTestStats(id, timestamp_us));
+  stats->m_bool = true;
+  stats->m_int32 = -42;
+  stats->m_uint32 = 42u;
+  stats->m_int64 = static_cast<int64_t>(-9007199254740993LL);
+  stats->m_uint64 = static_cast<uint64_t>(18446744073709551615ULL);
+  stats->m_double = 3.14159265358979;
+  stats->m_string = std::string("hello world");
+  stats->m_sequence_bool = std::vector<bool>{true, false, true};
+  stats->m_sequence_int32 = std::vector<int32_t>{-1, 0, 1};
+  stats->m_sequence_uint32 = std::vector<uint32_t>{1, 2, 3};
+  stats->m_sequence_int64 = std::vector<int64_t>{-5000000000, 5000000000};
+  stats->m_sequence_uint64 = std::vector<uint64_t>{0, 99999999999};
+  stats->m_sequence_double = std::vector<double>{0.5, -2.25};
+  stats->m_sequence_string = std::vector<std::string>{"a", "b"};
+  return stats;
+}
+
+}  // namespace
+
+TEST(RTCStatsSnapshotTest, RoundTripsToEquivalentJson) {
+  std::unique_ptr<RTCTestStats> full = CreateFullTestStats("full", 12345);
+  std::unique_ptr<RTCTestStats> partial(new RTCTestStats("partial", -7));
+  partial->m_uint32 = 7u;
+  partial->m_string = std::string("x");
+  std::unique_ptr<RTCTestStats> empty(new RTCTestStats("empty", 0));
+
+  // Stats of one type are serialized in report (id) order, so the converter's
+  // output matches the concatenation of the individual ToJson strings.
+  std::string expected_json = "[" + empty->ToJson() + "," + full->ToJson() +
+                              "," + partial->ToJson() + "]";
+
+  rtc::scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(1000);
+  report->AddStats(std::move(full));
+  report->AddStats(std::move(partial));
+  report->AddStats(std::move(empty));
+
+  rtc::Buffer buffer;
+  WriteRtcStatsSnapshot(*report, &buffer);
+  std::string json;
+  EXPECT_TRUE(RtcStatsSnapshotToJson(buffer, &json));
+  EXPECT_EQ(expected_json, json);
+}
+
+TEST(RTCStatsSnapshotTest, RepeatedWritesReuseBufferCapacity) {
+  rtc::scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(1000);
+  report->AddStats(CreateFullTestStats("stats", 42));
+
+  rtc::Buffer buffer;
+  WriteRtcStatsSnapshot(*report, &buffer);
+  const rtc::Buffer first_snapshot(buffer.data(), buffer.size());
+  const size_t capacity = buffer.capacity();
+
+  WriteRtcStatsSnapshot(*report, &buffer);
+  EXPECT_EQ(capacity, buffer.capacity());
+  EXPECT_EQ(first_snapshot, buffer);
+}
+
+TEST(RTCStatsSnapshotTest, SchemaIdDependsOnTypeNotInstance) {
+  RTCTestStats a("a", 1);
+  RTCTestStats b("b", 2);
+  EXPECT_NE(0u, RtcStatsSchemaId(a));
+  EXPECT_EQ(RtcStatsSchemaId(a), RtcStatsSchemaId(b));
+}
+
+TEST(RTCStatsSnapshotTest, RejectsMalformedSnapshots) {
+  rtc::scoped_refptr<RTCStatsReport> report = RTCStatsReport::Create(1000);
+  report->AddStats(CreateFullTestStats("stats", 42));
+
+  rtc::Buffer buffer;
+  WriteRtcStatsSnapshot(*report, &buffer);
+
+  std::string json = "sentinel";
+  EXPECT_FALSE(RtcStatsSnapshotToJson(
+      rtc::ArrayView<const uint8_t>(buffer.data(), 3), &json));
+  rtc::Buffer truncated(buffer.data(), buffer.size() - 5);
+  EXPECT_FALSE(RtcStatsSnapshotToJson(truncated, &json));
+  EXPECT_EQ("sentinel", json);
+}
+
+}  // namespace webrtc
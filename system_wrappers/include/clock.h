@@ -53,6 +53,32 @@ class Clock {
   static Clock* GetRealTimeClock();
 };
 
+// Caches the current wall-clock reading for the duration of a scope on the
+// current thread. While active, real-time Clock reads on this thread reuse
+// the cached value instead of issuing one clock_gettime syscall per call,
+// which matters in per-packet hot loops that consult the clock many times
+// per iteration. The cache is refreshed on construction and by Refresh();
+// holders are expected to Refresh() once per loop iteration. Scopes nest;
+// the innermost cache wins.
+class ScopedTimeCache {
+ public:
+  ScopedTimeCache();
+  ~ScopedTimeCache();
+
+  ScopedTimeCache(const ScopedTimeCache&) = delete;
+  ScopedTimeCache& operator=(const ScopedTimeCache&) = delete;
+
+  // Re-reads the system clock; cached reads are never older than the last
+  // Refresh() call.
+  void Refresh();
+
+  int64_t cached_time_us() const { return cached_time_us_; }
+
+ private:
+  int64_t cached_time_us_;
+  ScopedTimeCache* const previous_;
+};
+
 class SimulatedClock : public Clock {
  public:
   explicit SimulatedClock(int64_t initial_time_us);
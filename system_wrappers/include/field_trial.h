@@ -11,6 +11,8 @@
 #ifndef SYSTEM_WRAPPERS_INCLUDE_FIELD_TRIAL_H_
 #define SYSTEM_WRAPPERS_INCLUDE_FIELD_TRIAL_H_
 
+#include <stdint.h>
+
 #include <string>
 
 // Field trials allow webrtc clients (such as Chrome) to turn on feature code
@@ -76,6 +78,29 @@ inline bool IsDisabled(const char* name) {
   return FindFullName(name).find("Disabled") == 0;
 }
 
+// Resolves a trial's group once at construction and serves later queries from
+// the cached value, so hot paths do not re-query the trial string. Declare as
+// a function-local static next to the hot path:
+//
+//   static const FieldTrialCachedValue trial("WebRTC-SomeExperiment");
+//   if (trial.Enabled()) ...
+//
+// The thread-safe static initialization resolves the lookup on first use.
+// Requires that field trials are initialized before the first query and, like
+// all cached trial lookups, does not observe later re-initialization.
+class FieldTrialCachedValue {
+ public:
+  explicit FieldTrialCachedValue(const char* name)
+      : value_(FindFullName(name)) {}
+
+  const std::string& Value() const { return value_; }
+  bool Enabled() const { return value_.find("Enabled") == 0; }
+  bool Disabled() const { return value_.find("Disabled") == 0; }
+
+ private:
+  const std::string value_;
+};
+
 // Optionally initialize field trial from a string.
 // This method can be called at most once before any other call into webrtc.
 // E.g. before the peer connection factory is constructed.
@@ -84,6 +109,12 @@ void InitFieldTrialsFromString(const char* trials_string);
 
 const char* GetFieldTrialString();
 
+// Returns the number of times InitFieldTrialsFromString has been called.
+// State derived from the trials string (e.g. the typed settings cache in
+// rtc_base/experiments/field_trial_settings_cache.h) compares this against
+// a stored value to detect re-initialization.
+uint64_t FieldTrialsRevision();
+
 }  // namespace field_trial
 }  // namespace webrtc
 
@@ -30,16 +30,39 @@
 #include "rtc_base/time_utils.h"
 
 namespace webrtc {
+namespace {
+
+// Innermost active time cache on this thread, or null when reads should go
+// to the system clock. See ScopedTimeCache.
+thread_local ScopedTimeCache* current_time_cache = nullptr;
+
+}  // namespace
+
+ScopedTimeCache::ScopedTimeCache()
+    : cached_time_us_(rtc::TimeMicros()), previous_(current_time_cache) {
+  current_time_cache = this;
+}
+
+ScopedTimeCache::~ScopedTimeCache() {
+  current_time_cache = previous_;
+}
+
+void ScopedTimeCache::Refresh() {
+  cached_time_us_ = rtc::TimeMicros();
+}
 
 class RealTimeClock : public Clock {
-  Timestamp CurrentTime() override { return Timestamp::us(rtc::TimeMicros()); }
+  Timestamp CurrentTime() override { return Timestamp::us(TimeInMicroseconds()); }
   // Return a timestamp in milliseconds relative to some arbitrary source; the
   // source is fixed for this clock.
-  int64_t TimeInMilliseconds() override { return rtc::TimeMillis(); }
+  int64_t TimeInMilliseconds() override { return TimeInMicroseconds() / 1000; }
 
   // Return a timestamp in microseconds relative to some arbitrary source; the
   // source is fixed for this clock.
-  int64_t TimeInMicroseconds() override { return rtc::TimeMicros(); }
+  int64_t TimeInMicroseconds() override {
+    return current_time_cache ? current_time_cache->cached_time_us()
+                              : rtc::TimeMicros();
+  }
 
   // Retrieve an NTP absolute timestamp.
   NtpTime CurrentNtpTime() override {
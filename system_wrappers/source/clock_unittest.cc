@@ -31,4 +31,24 @@ TEST(ClockTest, NtpTime) {
   EXPECT_GE(milliseconds_upper_bound + 1, ntp_time.ToMs());
 }
 
+TEST(ClockTest, ScopedTimeCacheFreezesReads) {
+  Clock* clock = Clock::GetRealTimeClock();
+  ScopedTimeCache cache;
+  int64_t first = clock->TimeInMicroseconds();
+  // All reads within the scope return the cached value until Refresh().
+  EXPECT_EQ(first, clock->TimeInMicroseconds());
+  EXPECT_EQ(first, clock->CurrentTime().us());
+  EXPECT_EQ(first / 1000, clock->TimeInMilliseconds());
+  cache.Refresh();
+  EXPECT_GE(clock->TimeInMicroseconds(), first);
+}
+
+TEST(ClockTest, ScopedTimeCacheRestoresRealReads) {
+  Clock* clock = Clock::GetRealTimeClock();
+  { ScopedTimeCache cache; }
+  int64_t first = clock->TimeInMicroseconds();
+  int64_t second = clock->TimeInMicroseconds();
+  EXPECT_GE(second, first);
+}
+
 }  // namespace webrtc
@@ -44,10 +44,41 @@ static inline void __cpuid(int cpu_info[4], int info_type) {
                    : "a"(info_type));
 }
 #endif
+// Intrinsic for "cpuid" with an explicit subleaf, needed for leaf 7.
+#if defined(__pic__) && defined(__i386__)
+static inline void __cpuidex(int cpu_info[4], int info_type, int sub_info) {
+  __asm__ volatile(
+      "mov %%ebx, %%edi\n"
+      "cpuid\n"
+      "xchg %%edi, %%ebx\n"
+      : "=a"(cpu_info[0]), "=D"(cpu_info[1]), "=c"(cpu_info[2]),
+        "=d"(cpu_info[3])
+      : "a"(info_type), "c"(sub_info));
+}
+#else
+static inline void __cpuidex(int cpu_info[4], int info_type, int sub_info) {
+  __asm__ volatile("cpuid\n"
+                   : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]),
+                     "=d"(cpu_info[3])
+                   : "a"(info_type), "c"(sub_info));
+}
+#endif
 #endif  // _MSC_VER
 #endif  // WEBRTC_ARCH_X86_FAMILY
 
 #if defined(WEBRTC_ARCH_X86_FAMILY)
+// Reads the extended control register 0, which holds the state of the
+// OS-enabled register sets.
+static inline unsigned int GetXCR0() {
+#if defined(_MSC_VER)
+  return static_cast<unsigned int>(_xgetbv(0));
+#else
+  unsigned int xcr0;
+  __asm__ volatile("xgetbv" : "=a"(xcr0) : "c"(0) : "%edx");
+  return xcr0;
+#endif
+}
+
 // Actual feature detection for x86.
 static int GetCPUInfo(CPUFeature feature) {
   int cpu_info[4];
@@ -58,6 +89,23 @@ static int GetCPUInfo(CPUFeature feature) {
   if (feature == kSSE3) {
     return 0 != (cpu_info[2] & 0x00000001);
   }
+  if (feature == kAVX2) {
+    int cpu_info7[4];
+    __cpuid(cpu_info7, 0);
+    if (cpu_info7[0] < 7) {
+      return 0;
+    }
+    __cpuidex(cpu_info7, 7, 0);
+
+    // AVX2 instructions can be used when
+    //  a) AVX2 is supported by the CPU,
+    //  b) XSAVE is supported by the CPU and enabled by the OS for the
+    //     XMM and YMM register state.
+    return (cpu_info[2] & 0x10000000) != 0 /* AVX */ &&
+           (cpu_info[2] & 0x08000000) != 0 /* OSXSAVE */ &&
+           (GetXCR0() & 0x00000006) == 6 /* XMM and YMM state enabled */ &&
+           (cpu_info7[1] & 0x00000020) != 0 /* AVX2 */;
+  }
   return 0;
 }
 #else
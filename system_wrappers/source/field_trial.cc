@@ -11,6 +11,8 @@
 
 #include <stddef.h>
 
+#include <atomic>
+
 #include <map>
 #include <string>
 
@@ -25,6 +27,12 @@ namespace field_trial {
 
 static const char* trials_init_string = NULL;
 
+// Bumped on every InitFieldTrialsFromString call so that caches keyed on the
+// trials string can detect re-initialization. Kept outside the
+// WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT guard; custom FindFullName
+// implementations still route initialization through this function.
+static std::atomic<uint64_t> field_trials_revision(0);
+
 #ifndef WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
 namespace {
 constexpr char kPersistentStringSeparator = '/';
@@ -67,38 +75,48 @@ bool FieldTrialsStringIsValid(const absl::string_view trials) {
 
   return true;
 }
-}  // namespace
 
-std::string FindFullName(const std::string& name) {
-  if (trials_init_string == NULL)
-    return std::string();
-
-  std::string trials_string(trials_init_string);
-  if (trials_string.empty())
-    return std::string();
+// The trials string parsed into name/group pairs, so each FindFullName()
+// query is a map lookup instead of a scan over the whole string. Leaked
+// deliberately; cached pointers into the map may be read until process exit.
+std::map<std::string, std::string>& ParsedFieldTrials() {
+  static std::map<std::string, std::string>* const trials_map =
+      new std::map<std::string, std::string>();
+  return *trials_map;
+}
 
+// Mirrors the parsing loop previously in FindFullName: iteration stops at the
+// first malformed entry, and the first group registered for a name wins.
+std::map<std::string, std::string> ParseFieldTrialsString(
+    const absl::string_view trials) {
+  std::map<std::string, std::string> field_trials;
   size_t next_item = 0;
-  while (next_item < trials_string.length()) {
+  while (next_item < trials.length()) {
     // Find next name/value pair in field trial configuration string.
-    size_t field_name_end =
-        trials_string.find(kPersistentStringSeparator, next_item);
-    if (field_name_end == trials_string.npos || field_name_end == next_item)
+    size_t field_name_end = trials.find(kPersistentStringSeparator, next_item);
+    if (field_name_end == trials.npos || field_name_end == next_item)
       break;
     size_t field_value_end =
-        trials_string.find(kPersistentStringSeparator, field_name_end + 1);
-    if (field_value_end == trials_string.npos ||
+        trials.find(kPersistentStringSeparator, field_name_end + 1);
+    if (field_value_end == trials.npos ||
         field_value_end == field_name_end + 1)
       break;
-    std::string field_name(trials_string, next_item,
-                           field_name_end - next_item);
-    std::string field_value(trials_string, field_name_end + 1,
-                            field_value_end - field_name_end - 1);
+    std::string field_name(trials.substr(next_item, field_name_end - next_item));
+    std::string field_value(
+        trials.substr(field_name_end + 1, field_value_end - field_name_end - 1));
     next_item = field_value_end + 1;
 
-    if (name == field_name)
-      return field_value;
+    field_trials.insert(std::make_pair(std::move(field_name),
+                                       std::move(field_value)));
   }
-  return std::string();
+  return field_trials;
+}
+}  // namespace
+
+std::string FindFullName(const std::string& name) {
+  const std::map<std::string, std::string>& trials_map = ParsedFieldTrials();
+  const auto it = trials_map.find(name);
+  return (it == trials_map.end()) ? std::string() : it->second;
 }
 #endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
 
@@ -110,13 +128,21 @@ void InitFieldTrialsFromString(const char* trials_string) {
     RTC_DCHECK(FieldTrialsStringIsValid(trials_string))
         << "Invalid field trials string:" << trials_string;
   };
+  ParsedFieldTrials() = trials_string
+                            ? ParseFieldTrialsString(trials_string)
+                            : std::map<std::string, std::string>();
 #endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
   trials_init_string = trials_string;
+  field_trials_revision.fetch_add(1, std::memory_order_release);
 }
 
 const char* GetFieldTrialString() {
   return trials_init_string;
 }
 
+uint64_t FieldTrialsRevision() {
+  return field_trials_revision.load(std::memory_order_acquire);
+}
+
 }  // namespace field_trial
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 #include "system_wrappers/include/metrics.h"
 
 #include <algorithm>
+#include <atomic>
 
 #include "rtc_base/critical_section.h"
 #include "rtc_base/thread_annotations.h"
@@ -27,10 +28,21 @@ namespace {
 // linearly/exponentially spaced buckets) if samples are logged more frequently.
 const int kMaxSampleMapSize = 300;
 
+// Stores samples in a fixed array of open-addressed slots, each holding one
+// distinct sample value and an atomic count. Add() is lock-free: the macro
+// call sites already cache the histogram pointer, so recording a sample costs
+// a probe plus a relaxed increment, and never shows up as lock contention on
+// media threads. GetAndReset() releases the value claims as it folds the
+// counts out, so each collection interval can record kMaxSampleMapSize
+// distinct values, like the map-based storage that was swapped out on every
+// reset. An Add() racing with the release may leave a single increment
+// behind in an unclaimed slot, where it gets attributed to the next value
+// that claims the slot; that misattribution is rare and bounded to one
+// sample, which is acceptable for UMA data.
 class RtcHistogram {
  public:
   RtcHistogram(const std::string& name, int min, int max, int bucket_count)
-      : min_(min), max_(max), info_(name, min, max, bucket_count) {
+      : name_(name), min_(min), max_(max), bucket_count_(bucket_count) {
     RTC_DCHECK_GT(bucket_count, 0);
   }
 
@@ -38,66 +50,113 @@ class RtcHistogram {
     sample = std::min(sample, max_);
     sample = std::max(sample, min_ - 1);  // Underflow bucket.
 
-    rtc::CritScope cs(&crit_);
-    if (info_.samples.size() == kMaxSampleMapSize &&
-        info_.samples.find(sample) == info_.samples.end()) {
-      return;
+    const uint64_t claim = kClaimedFlag | static_cast<uint32_t>(sample);
+    size_t pos = static_cast<uint32_t>(sample) % kMaxSampleMapSize;
+    for (int i = 0; i < kMaxSampleMapSize; ++i) {
+      Slot& slot = slots_[pos];
+      uint64_t value = slot.value.load(std::memory_order_acquire);
+      if (value == 0 &&
+          slot.value.compare_exchange_strong(value, claim,
+                                             std::memory_order_acq_rel)) {
+        value = claim;
+      }
+      if (value == claim) {
+        slot.count.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      pos = (pos + 1) % kMaxSampleMapSize;
     }
-    ++info_.samples[sample];
+    // All slots claimed by other values; drop the sample. This matches the
+    // size limit that the previous map-based storage enforced per collection
+    // interval.
   }
 
   // Returns a copy (or nullptr if there are no samples) and clears samples.
   std::unique_ptr<SampleInfo> GetAndReset() {
-    rtc::CritScope cs(&crit_);
-    if (info_.samples.empty())
+    std::unique_ptr<SampleInfo> copy(
+        new SampleInfo(name_, min_, max_, bucket_count_));
+    for (Slot& slot : slots_) {
+      uint64_t value = slot.value.load(std::memory_order_acquire);
+      if (value == 0)
+        continue;
+      int count = slot.count.exchange(0, std::memory_order_relaxed);
+      // Release the claim so the slot can hold a new value next interval.
+      // Add() only writes a slot whose value is 0, so nothing else can have
+      // changed |value| since the load above.
+      slot.value.store(0, std::memory_order_release);
+      if (count > 0)
+        copy->samples[DecodeSample(value)] = count;
+    }
+    if (copy->samples.empty())
       return nullptr;
-
-    SampleInfo* copy =
-        new SampleInfo(info_.name, info_.min, info_.max, info_.bucket_count);
-
-    std::swap(info_.samples, copy->samples);
-
-    return std::unique_ptr<SampleInfo>(copy);
+    return copy;
   }
 
-  const std::string& name() const { return info_.name; }
+  const std::string& name() const { return name_; }
 
   // Functions only for testing.
   void Reset() {
-    rtc::CritScope cs(&crit_);
-    info_.samples.clear();
+    for (Slot& slot : slots_) {
+      slot.count.store(0, std::memory_order_relaxed);
+      slot.value.store(0, std::memory_order_release);
+    }
   }
 
   int NumEvents(int sample) const {
-    rtc::CritScope cs(&crit_);
-    const auto it = info_.samples.find(sample);
-    return (it == info_.samples.end()) ? 0 : it->second;
+    for (const Slot& slot : slots_) {
+      uint64_t value = slot.value.load(std::memory_order_acquire);
+      if (value != 0 && DecodeSample(value) == sample)
+        return slot.count.load(std::memory_order_relaxed);
+    }
+    return 0;
   }
 
   int NumSamples() const {
     int num_samples = 0;
-    rtc::CritScope cs(&crit_);
-    for (const auto& sample : info_.samples) {
-      num_samples += sample.second;
+    for (const Slot& slot : slots_) {
+      if (slot.value.load(std::memory_order_acquire) != 0)
+        num_samples += slot.count.load(std::memory_order_relaxed);
     }
     return num_samples;
   }
 
   int MinSample() const {
-    rtc::CritScope cs(&crit_);
-    return (info_.samples.empty()) ? -1 : info_.samples.begin()->first;
+    std::map<int, int> samples = Samples();
+    return samples.empty() ? -1 : samples.begin()->first;
   }
 
   std::map<int, int> Samples() const {
-    rtc::CritScope cs(&crit_);
-    return info_.samples;
+    std::map<int, int> samples;
+    for (const Slot& slot : slots_) {
+      uint64_t value = slot.value.load(std::memory_order_acquire);
+      if (value == 0)
+        continue;
+      int count = slot.count.load(std::memory_order_relaxed);
+      if (count > 0)
+        samples[DecodeSample(value)] = count;
+    }
+    return samples;
   }
 
  private:
-  rtc::CriticalSection crit_;
+  // A zero |value| marks the slot as unclaimed; claimed slots carry the
+  // sample in the low bits with kClaimedFlag set so that sample value 0 is
+  // distinguishable from an empty slot.
+  struct Slot {
+    std::atomic<uint64_t> value{0};
+    std::atomic<int> count{0};
+  };
+  static constexpr uint64_t kClaimedFlag = uint64_t{1} << 32;
+
+  static int DecodeSample(uint64_t value) {
+    return static_cast<int>(static_cast<uint32_t>(value & 0xFFFFFFFF));
+  }
+
+  const std::string name_;
   const int min_;
   const int max_;
-  SampleInfo info_ RTC_GUARDED_BY(crit_);
+  const size_t bucket_count_;
+  Slot slots_[kMaxSampleMapSize];
 
   RTC_DISALLOW_COPY_AND_ASSIGN(RtcHistogram);
 };
@@ -149,6 +149,28 @@ TEST_F(MetricsDefaultTest, GetAndReset) {
   EXPECT_EQ(1, metrics::NumEvents("Histogram2", 8));
 }
 
+TEST_F(MetricsDefaultTest, GetAndResetRestoresDistinctValueCapacity) {
+  const std::string kName = "DistinctCapacity";
+  // Saturate the histogram's capacity of 300 (kMaxSampleMapSize) distinct
+  // values for this collection interval.
+  for (int i = 1; i <= 300; ++i)
+    RTC_HISTOGRAM_COUNTS_10000(kName, i);
+  EXPECT_EQ(300, metrics::NumSamples(kName));
+  // A 301st distinct value is dropped.
+  RTC_HISTOGRAM_COUNTS_10000(kName, 301);
+  EXPECT_EQ(300, metrics::NumSamples(kName));
+
+  std::map<std::string, std::unique_ptr<metrics::SampleInfo>> histograms;
+  metrics::GetAndReset(&histograms);
+  EXPECT_EQ(300, NumSamples(kName, histograms));
+
+  // Collection released the value slots, so new distinct values are recorded
+  // again.
+  RTC_HISTOGRAM_COUNTS_10000(kName, 301);
+  EXPECT_EQ(1, metrics::NumSamples(kName));
+  EXPECT_EQ(1, metrics::NumEvents(kName, 301));
+}
+
 TEST_F(MetricsDefaultTest, TestMinMaxBucket) {
   const std::string kName = "MinMaxCounts100";
   RTC_HISTOGRAM_COUNTS_100(kName, 4);
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "test/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace webrtc {
+namespace test {
+namespace {
+
+// Plain thread-local counters; the allocation functions below may not
+// themselves allocate.
+thread_local size_t g_allocations = 0;
+thread_local size_t g_deallocations = 0;
+
+}  // namespace
+
+ScopedAllocationCounter::ScopedAllocationCounter()
+    : start_allocations_(g_allocations),
+      start_deallocations_(g_deallocations) {}
+
+ScopedAllocationCounter::~ScopedAllocationCounter() = default;
+
+size_t ScopedAllocationCounter::allocations() const {
+  return g_allocations - start_allocations_;
+}
+
+size_t ScopedAllocationCounter::deallocations() const {
+  return g_deallocations - start_deallocations_;
+}
+
+}  // namespace test
+}  // namespace webrtc
+
+// Counting replacements of the global allocation functions. The sized and
+// array forms forward to these, which is permitted by the standard.
+void* operator new(size_t size) {
+  ++webrtc::test::g_allocations;
+  void* ptr = malloc(size);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr) {
+    ++webrtc::test::g_deallocations;
+    free(ptr);
+  }
+}
+
+void operator delete(void* ptr, size_t size) noexcept {
+  operator delete(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t size) noexcept {
+  operator delete(ptr);
+}
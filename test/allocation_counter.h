@@ -0,0 +1,48 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef TEST_ALLOCATION_COUNTER_H_
+#define TEST_ALLOCATION_COUNTER_H_
+
+#include <stddef.h>
+
+namespace webrtc {
+namespace test {
+
+// Counts heap allocations made by the current thread while in scope, by
+// overriding the global allocation functions. Used to assert that hot paths
+// stay free of (or within a budget of) per-call allocations.
+//
+// Note that linking the accompanying translation unit replaces operator
+// new/delete for the whole test binary, so this header must only be used from
+// test targets that depend on test:allocation_counter.
+class ScopedAllocationCounter {
+ public:
+  ScopedAllocationCounter();
+  ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+  ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+  ~ScopedAllocationCounter();
+
+  // Number of calls to an allocation function on this thread since this
+  // counter was created.
+  size_t allocations() const;
+  // Number of calls to a deallocation function (of a non-null pointer) on
+  // this thread since this counter was created.
+  size_t deallocations() const;
+
+ private:
+  size_t start_allocations_;
+  size_t start_deallocations_;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // TEST_ALLOCATION_COUNTER_H_
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "test/benchmark/benchmark.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#if defined(WEBRTC_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+// Keep timing until both limits are reached, so very fast benchmarks get
+// enough iterations and very slow ones still get a few.
+const int64_t kMinRunTimeNs = 500 * rtc::kNumNanosecsPerMillisec;
+const int64_t kMinIterations = 8;
+
+struct RegisteredBenchmark {
+  const char* name;
+  BenchmarkFunction function;
+};
+
+std::vector<RegisteredBenchmark>& Registry() {
+  static std::vector<RegisteredBenchmark>* const registry =
+      new std::vector<RegisteredBenchmark>();
+  return *registry;
+}
+
+}  // namespace
+
+// Cycle and instruction counters via perf_event. Counting may be denied
+// (perf_event_paranoid, seccomp, non-Linux); in that case the benchmark
+// still runs and only wall time is reported.
+class BenchmarkState::PerfEventCounters {
+ public:
+  PerfEventCounters() {
+#if defined(WEBRTC_LINUX)
+    cycles_fd_ = OpenCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (cycles_fd_ >= 0)
+      instructions_fd_ = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, cycles_fd_);
+#endif
+  }
+  ~PerfEventCounters() {
+#if defined(WEBRTC_LINUX)
+    if (instructions_fd_ >= 0)
+      close(instructions_fd_);
+    if (cycles_fd_ >= 0)
+      close(cycles_fd_);
+#endif
+  }
+
+  bool available() const { return cycles_fd_ >= 0 && instructions_fd_ >= 0; }
+
+  void Start() {
+#if defined(WEBRTC_LINUX)
+    if (!available())
+      return;
+    ioctl(cycles_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(cycles_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  bool Stop(int64_t* cycles, int64_t* instructions) {
+#if defined(WEBRTC_LINUX)
+    if (!available())
+      return false;
+    ioctl(cycles_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    return ReadCounter(cycles_fd_, cycles) &&
+           ReadCounter(instructions_fd_, instructions);
+#else
+    return false;
+#endif
+  }
+
+ private:
+#if defined(WEBRTC_LINUX)
+  static int OpenCounter(uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  static bool ReadCounter(int fd, int64_t* value) {
+    uint64_t count = 0;
+    if (read(fd, &count, sizeof(count)) != sizeof(count))
+      return false;
+    *value = static_cast<int64_t>(count);
+    return true;
+  }
+#endif
+
+  int cycles_fd_ = -1;
+  int instructions_fd_ = -1;
+};
+
+BenchmarkState::BenchmarkState() : counters_(new PerfEventCounters()) {}
+
+BenchmarkState::~BenchmarkState() {
+  delete counters_;
+}
+
+bool BenchmarkState::KeepRunning() {
+  if (iterations_ == 0) {
+    counters_->Start();
+    start_time_ns_ = rtc::TimeNanos();
+    ++iterations_;
+    return true;
+  }
+  int64_t elapsed_ns = rtc::TimeNanos() - start_time_ns_;
+  if (elapsed_ns < kMinRunTimeNs || iterations_ < kMinIterations) {
+    ++iterations_;
+    return true;
+  }
+  total_time_ns_ = elapsed_ns;
+  if (!counters_->Stop(&cycles_, &instructions_)) {
+    cycles_ = -1;
+    instructions_ = -1;
+  }
+  return false;
+}
+
+double BenchmarkState::ns_per_iteration() const {
+  RTC_DCHECK_GT(iterations_, 0);
+  return static_cast<double>(total_time_ns_) / iterations_;
+}
+
+double BenchmarkState::cycles_per_iteration() const {
+  return cycles_ < 0 ? -1.0 : static_cast<double>(cycles_) / iterations_;
+}
+
+double BenchmarkState::instructions_per_iteration() const {
+  return instructions_ < 0 ? -1.0
+                           : static_cast<double>(instructions_) / iterations_;
+}
+
+void RegisterBenchmark(const char* name, BenchmarkFunction function) {
+  Registry().push_back({name, function});
+}
+
+int RunRegisteredBenchmarks(absl::string_view filter) {
+  int benchmarks_run = 0;
+  for (const RegisteredBenchmark& benchmark : Registry()) {
+    if (!filter.empty() &&
+        absl::string_view(benchmark.name).find(filter) ==
+            absl::string_view::npos) {
+      continue;
+    }
+    BenchmarkState state;
+    benchmark.function(&state);
+    ++benchmarks_run;
+
+    PrintResult("benchmark", "_time", benchmark.name, state.ns_per_iteration(),
+                "ns", /*important=*/false);
+    if (state.cycles_per_iteration() >= 0) {
+      PrintResult("benchmark", "_cycles", benchmark.name,
+                  state.cycles_per_iteration(), "count", /*important=*/false);
+      PrintResult("benchmark", "_instructions", benchmark.name,
+                  state.instructions_per_iteration(), "count",
+                  /*important=*/false);
+      printf("%-40s %12.1f ns/iter %14.0f cycles %14.0f instructions"
+             " (%lld iterations)\n",
+             benchmark.name, state.ns_per_iteration(),
+             state.cycles_per_iteration(), state.instructions_per_iteration(),
+             static_cast<long long>(state.iterations()));
+    } else {
+      printf("%-40s %12.1f ns/iter (%lld iterations, no hardware counters)\n",
+             benchmark.name, state.ns_per_iteration(),
+             static_cast<long long>(state.iterations()));
+    }
+  }
+  return benchmarks_run;
+}
+
+}  // namespace test
+}  // namespace webrtc
@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef TEST_BENCHMARK_BENCHMARK_H_
+#define TEST_BENCHMARK_BENCHMARK_H_
+
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/strings/string_view.h"
+
+namespace webrtc {
+namespace test {
+
+// Minimal registered-microbenchmark framework in the style of
+// google-benchmark, built on the testsupport/perf_test reporting backend so
+// results come out in the same JSON format the perf bots already consume.
+//
+// A benchmark is a free function taking a BenchmarkState and timing its hot
+// path inside a KeepRunning() loop:
+//
+//   void BM_Foo(BenchmarkState* state) {
+//     Foo foo = MakeExpensiveSetup();
+//     while (state->KeepRunning())
+//       foo.HotPath();
+//   }
+//   WEBRTC_BENCHMARK(BM_Foo);
+//
+// Wall time is always measured; on Linux, CPU cycles and retired
+// instructions are also collected through perf_event when the kernel allows
+// it and reported per iteration.
+class BenchmarkState {
+ public:
+  BenchmarkState();
+  ~BenchmarkState();
+
+  // Returns true until the benchmark has run for long enough to produce a
+  // stable per-iteration estimate. Timing starts at the first call.
+  bool KeepRunning();
+
+  int64_t iterations() const { return iterations_; }
+
+  // Total measured wall time and per-iteration results, valid after
+  // KeepRunning() has returned false.
+  int64_t total_time_ns() const { return total_time_ns_; }
+  double ns_per_iteration() const;
+  // Negative when hardware counters are unavailable.
+  double cycles_per_iteration() const;
+  double instructions_per_iteration() const;
+
+ private:
+  class PerfEventCounters;
+
+  int64_t iterations_ = 0;
+  int64_t start_time_ns_ = 0;
+  int64_t total_time_ns_ = 0;
+  int64_t cycles_ = -1;
+  int64_t instructions_ = -1;
+  PerfEventCounters* const counters_;
+};
+
+typedef void (*BenchmarkFunction)(BenchmarkState* state);
+
+// Called by WEBRTC_BENCHMARK at static-initialization time.
+void RegisterBenchmark(const char* name, BenchmarkFunction function);
+
+// Runs all registered benchmarks whose name contains |filter| (all when
+// empty), prints one line per benchmark and feeds results to the perf_test
+// backend. Returns the number of benchmarks run.
+int RunRegisteredBenchmarks(absl::string_view filter);
+
+class BenchmarkRegistrar {
+ public:
+  BenchmarkRegistrar(const char* name, BenchmarkFunction function) {
+    RegisterBenchmark(name, function);
+  }
+};
+
+#define WEBRTC_BENCHMARK(function)                     \
+  static ::webrtc::test::BenchmarkRegistrar            \
+      benchmark_registrar_##function(#function, &function)
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // TEST_BENCHMARK_BENCHMARK_H_
@@ -0,0 +1,43 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdio.h>
+
+#include <string>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "test/benchmark/benchmark.h"
+#include "test/testsupport/perf_test.h"
+
+ABSL_FLAG(std::string,
+          benchmark_filter,
+          "",
+          "Only run benchmarks whose name contains this substring.");
+ABSL_FLAG(std::string,
+          benchmark_out,
+          "",
+          "Write results as perf-test JSON to this path.");
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+
+  int benchmarks_run = webrtc::test::RunRegisteredBenchmarks(
+      absl::GetFlag(FLAGS_benchmark_filter));
+  if (benchmarks_run == 0) {
+    fprintf(stderr, "No benchmarks matched the filter.\n");
+    return 1;
+  }
+
+  std::string output_path = absl::GetFlag(FLAGS_benchmark_out);
+  if (!output_path.empty())
+    webrtc::test::WritePerfResults(output_path);
+  return 0;
+}
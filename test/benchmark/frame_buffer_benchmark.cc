@@ -0,0 +1,72 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+
+#include "absl/memory/memory.h"
+#include "api/video/encoded_frame.h"
+#include "modules/video_coding/frame_buffer2.h"
+#include "modules/video_coding/timing.h"
+#include "system_wrappers/include/clock.h"
+#include "test/benchmark/benchmark.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+class BenchmarkFrame : public video_coding::EncodedFrame {
+ public:
+  int64_t ReceivedTime() const override { return 0; }
+  int64_t RenderTime() const override { return _renderTimeMs; }
+};
+
+std::unique_ptr<BenchmarkFrame> BuildFrame(uint16_t picture_id,
+                                           int64_t timestamp_ms,
+                                           bool keyframe) {
+  auto frame = absl::make_unique<BenchmarkFrame>();
+  frame->id.picture_id = picture_id;
+  frame->SetTimestamp(static_cast<uint32_t>(timestamp_ms * 90));
+  frame->is_last_spatial_layer = true;
+  if (keyframe) {
+    frame->num_references = 0;
+  } else {
+    frame->num_references = 1;
+    frame->references[0] = picture_id - 1;
+  }
+  frame->VerifyAndAllocate(1000);
+  frame->set_size(1000);
+  return frame;
+}
+
+// A 30 fps stream of delta frames with an occasional keyframe; frames are
+// drained with NextFrame() so the buffer stays at steady-state size.
+void BM_FrameBufferInsertFrame(BenchmarkState* state) {
+  SimulatedClock clock(0);
+  VCMTiming timing(&clock);
+  video_coding::FrameBuffer buffer(&clock, &timing, nullptr);
+
+  uint16_t picture_id = 0;
+  int64_t timestamp_ms = 0;
+  buffer.InsertFrame(BuildFrame(picture_id, timestamp_ms, /*keyframe=*/true));
+  while (state->KeepRunning()) {
+    ++picture_id;
+    timestamp_ms += 33;
+    clock.AdvanceTimeMilliseconds(33);
+    buffer.InsertFrame(BuildFrame(picture_id, timestamp_ms,
+                                  /*keyframe=*/picture_id % 300 == 0));
+    std::unique_ptr<video_coding::EncodedFrame> frame;
+    buffer.NextFrame(0, &frame, /*keyframe_required=*/false);
+  }
+}
+WEBRTC_BENCHMARK(BM_FrameBufferInsertFrame);
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
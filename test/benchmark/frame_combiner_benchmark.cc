@@ -0,0 +1,55 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "modules/audio_mixer/frame_combiner.h"
+#include "test/benchmark/benchmark.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr size_t kNumberOfChannels = 2;
+constexpr size_t kSamplesPerChannel = kSampleRateHz / 100;
+
+void FillFrame(AudioFrame* frame, int16_t seed) {
+  frame->UpdateFrame(0, nullptr, kSamplesPerChannel, kSampleRateHz,
+                     AudioFrame::kNormalSpeech, AudioFrame::kVadActive,
+                     kNumberOfChannels);
+  int16_t* data = frame->mutable_data();
+  for (size_t i = 0; i < kSamplesPerChannel * kNumberOfChannels; ++i)
+    data[i] = static_cast<int16_t>((seed * (i + 1)) % 4096 - 2048);
+}
+
+// Mixing two stereo 48 kHz streams with the limiter engaged, the common
+// conference configuration.
+void BM_FrameCombinerCombine(BenchmarkState* state) {
+  FrameCombiner combiner(/*use_limiter=*/true);
+  AudioFrame frame1;
+  AudioFrame frame2;
+  FillFrame(&frame1, 3);
+  FillFrame(&frame2, 5);
+  const std::vector<AudioFrame*> mix_list = {&frame1, &frame2};
+  AudioFrame audio_frame_for_mixing;
+
+  while (state->KeepRunning()) {
+    combiner.Combine(mix_list, kNumberOfChannels, kSampleRateHz,
+                     /*number_of_streams=*/mix_list.size(),
+                     &audio_frame_for_mixing);
+  }
+}
+WEBRTC_BENCHMARK(BM_FrameCombinerCombine);
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
@@ -0,0 +1,58 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stdint.h>
+
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "test/benchmark/benchmark.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+// A media-sized packet with the header extensions a typical video call
+// negotiates, so parsing exercises the extension scan.
+rtc::CopyOnWriteBuffer BuildPacket(const RtpHeaderExtensionMap& extensions) {
+  RtpPacket packet(&extensions);
+  packet.SetPayloadType(100);
+  packet.SetSequenceNumber(0x1234);
+  packet.SetTimestamp(0x65431278);
+  packet.SetSsrc(0x12345678);
+  packet.SetExtension<TransmissionOffset>(0x0102);
+  packet.SetExtension<AbsoluteSendTime>(0x00aabbcc);
+  packet.SetExtension<TransportSequenceNumber>(0x1357);
+  uint8_t* payload = packet.AllocatePayload(1200);
+  for (int i = 0; i < 1200; ++i)
+    payload[i] = static_cast<uint8_t>(i);
+  return packet.Buffer();
+}
+
+void BM_RtpPacketParse(BenchmarkState* state) {
+  RtpHeaderExtensionMap extensions;
+  extensions.Register<TransmissionOffset>(1);
+  extensions.Register<AbsoluteSendTime>(2);
+  extensions.Register<TransportSequenceNumber>(3);
+  rtc::CopyOnWriteBuffer buffer = BuildPacket(extensions);
+
+  RtpPacket packet(&extensions);
+  while (state->KeepRunning()) {
+    bool ok = packet.Parse(buffer.data(), buffer.size());
+    RTC_CHECK(ok);
+  }
+}
+WEBRTC_BENCHMARK(BM_RtpPacketParse);
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
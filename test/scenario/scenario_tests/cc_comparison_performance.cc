@@ -0,0 +1,190 @@
+/*
+ *  Copyright 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include <string>
+#include <vector>
+
+#include "api/transport/goog_cc_factory.h"
+#include "modules/congestion_controller/bbr/bbr_factory.h"
+#include "modules/congestion_controller/pcc/pcc_factory.h"
+#include "rtc_base/checks.h"
+#include "test/gtest.h"
+#include "test/scenario/scenario.h"
+#include "test/scenario/stats_collection.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace test {
+namespace {
+
+using ::testing::Combine;
+using ::testing::make_tuple;
+using ::testing::tuple;
+using ::testing::Values;
+
+// One segment of a piecewise constant link trace. The link keeps the given
+// characteristics for |duration|, then the next segment is applied.
+struct LinkStep {
+  TimeDelta duration;
+  DataRate bandwidth;
+  TimeDelta delay;
+  double loss_rate;
+};
+
+struct LinkProfile {
+  std::string name;
+  std::vector<LinkStep> steps;
+};
+
+std::vector<LinkProfile> LinkProfiles() {
+  return {
+      {"stable_300kbps",
+       {{TimeDelta::seconds(60), DataRate::kbps(300), TimeDelta::ms(100), 0}}},
+      {"bandwidth_drop",
+       {{TimeDelta::seconds(20), DataRate::kbps(1000), TimeDelta::ms(50), 0},
+        {TimeDelta::seconds(20), DataRate::kbps(200), TimeDelta::ms(50), 0},
+        {TimeDelta::seconds(20), DataRate::kbps(1000), TimeDelta::ms(50), 0}}},
+      {"lossy_500kbps",
+       {{TimeDelta::seconds(60), DataRate::kbps(500), TimeDelta::ms(100),
+         0.02}}},
+      {"delay_spike",
+       {{TimeDelta::seconds(20), DataRate::kbps(600), TimeDelta::ms(50), 0},
+        {TimeDelta::seconds(20), DataRate::kbps(600), TimeDelta::ms(400), 0},
+        {TimeDelta::seconds(20), DataRate::kbps(600), TimeDelta::ms(50), 0}}}};
+}
+
+LinkProfile GetLinkProfile(const std::string& name) {
+  for (const LinkProfile& profile : LinkProfiles()) {
+    if (profile.name == name)
+      return profile;
+  }
+  RTC_CHECK(false) << "Unknown link profile: " << name;
+  return LinkProfile();
+}
+
+// Emits the 5th, 50th and 95th percentile of a metric so regressions in both
+// typical and tail behavior show up numerically per commit.
+void PrintPercentileResults(const std::string& measurement,
+                            const std::string& trace,
+                            double p05,
+                            double p50,
+                            double p95,
+                            const std::string& units) {
+  PrintResult(measurement, "_p05", trace, p05, units, false);
+  PrintResult(measurement, "_p50", trace, p50, units, false);
+  PrintResult(measurement, "_p95", trace, p95, units, false);
+}
+}  // namespace
+
+// Runs the same trace-driven link profile against each of the in-tree
+// NetworkControllerFactoryInterface implementations, collecting throughput,
+// latency and loss so the controllers can be compared on equal terms.
+class CcComparisonTest
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<tuple<std::string, std::string>> {
+ public:
+  CcComparisonTest()
+      : controller_(::testing::get<0>(GetParam())),
+        profile_(GetLinkProfile(::testing::get<1>(GetParam()))) {}
+
+ protected:
+  NetworkControllerFactoryInterface* CcFactory() {
+    if (controller_ == "bbr")
+      return &bbr_factory_;
+    if (controller_ == "pcc")
+      return &pcc_factory_;
+    RTC_CHECK_EQ(controller_, "goog_cc");
+    return &goog_cc_factory_;
+  }
+
+  const std::string controller_;
+  const LinkProfile profile_;
+
+ private:
+  GoogCcNetworkControllerFactory goog_cc_factory_;
+  BbrNetworkControllerFactory bbr_factory_;
+  PccNetworkControllerFactory pcc_factory_;
+};
+
+TEST_P(CcComparisonTest, ReceivesVideo) {
+  CallClientConfig call_config;
+  call_config.transport.cc_factory = CcFactory();
+  call_config.transport.rates.min_rate = DataRate::kbps(30);
+  call_config.transport.rates.max_rate = DataRate::kbps(1800);
+
+  Scenario s("cc_comparison/" + controller_ + "__" + profile_.name);
+  NetworkSimulationConfig net_conf;
+  net_conf.bandwidth = profile_.steps.front().bandwidth;
+  net_conf.delay = profile_.steps.front().delay;
+  net_conf.loss_rate = profile_.steps.front().loss_rate;
+  auto* send_net = s.CreateMutableSimulationNode(net_conf);
+  auto* ret_net = s.CreateSimulationNode(NetworkSimulationConfig());
+
+  CallClient* alice = s.CreateClient("send", call_config);
+  CallClient* bob = s.CreateClient("return", CallClientConfig());
+  auto route = s.CreateRoutes(alice, {send_net->node()}, bob, {ret_net});
+  VideoStreamPair* video =
+      s.CreateVideoStream(route->forward(), [&](VideoStreamConfig* c) {
+        c->encoder.fake.max_rate = DataRate::kbps(1800);
+      });
+
+  CallStatsCollector call_stats;
+  VideoSendStatsCollector send_stats;
+  SampleStats<double> loss_fraction;
+  s.Every(TimeDelta::seconds(1), [&] {
+    call_stats.AddStats(alice->GetStats());
+    VideoSendStream::Stats stats = video->send()->GetStats();
+    send_stats.AddStats(stats, s.Now());
+    for (const auto& kv : stats.substreams)
+      loss_fraction.AddSample(kv.second.rtcp_stats.fraction_lost / 256.0);
+  });
+
+  // Play back the link trace, advancing the simulation one segment at a time.
+  for (const LinkStep& step : profile_.steps) {
+    send_net->UpdateConfig([&](NetworkSimulationConfig* c) {
+      c->bandwidth = step.bandwidth;
+      c->delay = step.delay;
+      c->loss_rate = step.loss_rate;
+    });
+    s.RunFor(step.duration);
+  }
+
+  const std::string trace = controller_ + "__" + profile_.name;
+  auto& media_bitrate = send_stats.stats().media_bitrate;
+  if (!media_bitrate.IsEmpty()) {
+    PrintPercentileResults("cc_comparison_throughput", trace,
+                           media_bitrate.Quantile(0.05).kbps<double>(),
+                           media_bitrate.Quantile(0.5).kbps<double>(),
+                           media_bitrate.Quantile(0.95).kbps<double>(),
+                           "kbps");
+  }
+  auto& round_trip_time = call_stats.stats().round_trip_time;
+  if (!round_trip_time.IsEmpty()) {
+    PrintPercentileResults("cc_comparison_rtt", trace,
+                           round_trip_time.Quantile(0.05).ms<double>(),
+                           round_trip_time.Quantile(0.5).ms<double>(),
+                           round_trip_time.Quantile(0.95).ms<double>(), "ms");
+  }
+  if (!loss_fraction.IsEmpty()) {
+    PrintPercentileResults("cc_comparison_loss", trace,
+                           loss_fraction.Quantile(0.05) * 100,
+                           loss_fraction.Quantile(0.5) * 100,
+                           loss_fraction.Quantile(0.95) * 100, "%");
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(ControllerMatrix,
+                         CcComparisonTest,
+                         Combine(Values("goog_cc", "bbr", "pcc"),
+                                 Values("stable_300kbps",
+                                        "bandwidth_drop",
+                                        "lossy_500kbps",
+                                        "delay_spike")));
+}  // namespace test
+}  // namespace webrtc
@@ -10,7 +10,9 @@
 #include "test/time_controller/simulated_time_controller.h"
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <limits>
 #include <list>
 #include <map>
 #include <string>
@@ -43,6 +45,13 @@ class SimulatedSequenceRunner : public ProcessThread, public TaskQueueBase {
 
   // Provides next run time.
   Timestamp GetNextRunTime() const;
+  // Same as GetNextRunTime() but in microseconds and without taking the lock,
+  // with infinities mapped to the int64_t extremes. The controller scans every
+  // runner on each time step, and for large scenarios those scans dominate
+  // wall time, so they must not pay for a lock per runner.
+  int64_t GetNextRunTimeUs() const {
+    return cached_next_run_time_us_.load(std::memory_order_acquire);
+  }
 
   // Iterates through delayed tasks and modules and moves them to the ready set
   // if they are supposed to execute by |at time|.
@@ -72,6 +81,19 @@ class SimulatedSequenceRunner : public ProcessThread, public TaskQueueBase {
   void RunReadyModules(Timestamp at_time) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void UpdateNextRunTime() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   Timestamp GetNextTime(Module* module, Timestamp at_time);
+  // Mirrors |next_run_time_| into |cached_next_run_time_us_|; must be called
+  // whenever |next_run_time_| changes.
+  void CacheNextRunTime() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    int64_t cached;
+    if (next_run_time_.IsPlusInfinity()) {
+      cached = std::numeric_limits<int64_t>::max();
+    } else if (next_run_time_.IsMinusInfinity()) {
+      cached = std::numeric_limits<int64_t>::min();
+    } else {
+      cached = next_run_time_.us();
+    }
+    cached_next_run_time_us_.store(cached, std::memory_order_release);
+  }
 
   SimulatedTimeControllerImpl* const handler_;
   const std::string name_;
@@ -89,6 +111,8 @@ class SimulatedSequenceRunner : public ProcessThread, public TaskQueueBase {
       RTC_GUARDED_BY(lock_);
 
   Timestamp next_run_time_ RTC_GUARDED_BY(lock_) = Timestamp::PlusInfinity();
+  std::atomic<int64_t> cached_next_run_time_us_{
+      std::numeric_limits<int64_t>::max()};
 };
 
 Timestamp SimulatedSequenceRunner::GetNextRunTime() const {
@@ -171,12 +195,14 @@ void SimulatedSequenceRunner::UpdateNextRunTime() {
       next_run_time_ =
           std::min(next_run_time_, delayed_modules_.begin()->first);
   }
+  CacheNextRunTime();
 }
 
 void SimulatedSequenceRunner::PostTask(std::unique_ptr<QueuedTask> task) {
   rtc::CritScope lock(&lock_);
   ready_tasks_.emplace_back(std::move(task));
   next_run_time_ = Timestamp::MinusInfinity();
+  CacheNextRunTime();
 }
 
 void SimulatedSequenceRunner::PostDelayedTask(std::unique_ptr<QueuedTask> task,
@@ -185,6 +211,7 @@ void SimulatedSequenceRunner::PostDelayedTask(std::unique_ptr<QueuedTask> task,
   Timestamp target_time = GetCurrentTime() + TimeDelta::ms(milliseconds);
   delayed_tasks_[target_time].push_back(std::move(task));
   next_run_time_ = std::min(next_run_time_, target_time);
+  CacheNextRunTime();
 }
 
 void SimulatedSequenceRunner::Start() {
@@ -243,6 +270,7 @@ void SimulatedSequenceRunner::WakeUp(Module* module) {
   Timestamp next_time = GetNextTime(module, GetCurrentTime());
   delayed_modules_[next_time].push_back(module);
   next_run_time_ = std::min(next_run_time_, next_time);
+  CacheNextRunTime();
 }
 
 void SimulatedSequenceRunner::RegisterModule(Module* module,
@@ -255,6 +283,7 @@ void SimulatedSequenceRunner::RegisterModule(Module* module,
     Timestamp next_time = GetNextTime(module, GetCurrentTime());
     delayed_modules_[next_time].push_back(module);
     next_run_time_ = std::min(next_run_time_, next_time);
+    CacheNextRunTime();
   }
 }
 
@@ -346,7 +375,7 @@ void SimulatedTimeControllerImpl::RunReadyRunners() {
   while (true) {
     for (auto* runner : runners_) {
       if (yielded_.find(runner) == yielded_.end() &&
-          runner->GetNextRunTime() <= current_time) {
+          runner->GetNextRunTimeUs() <= current_time.us()) {
         ready_runners_.push_back(runner);
       }
     }
@@ -371,15 +400,17 @@ Timestamp SimulatedTimeControllerImpl::CurrentTime() const {
 
 Timestamp SimulatedTimeControllerImpl::NextRunTime() const {
   Timestamp current_time = CurrentTime();
-  Timestamp next_time = Timestamp::PlusInfinity();
+  int64_t next_us = std::numeric_limits<int64_t>::max();
   rtc::CritScope lock(&lock_);
   for (auto* runner : runners_) {
-    Timestamp next_run_time = runner->GetNextRunTime();
-    if (next_run_time <= current_time)
+    int64_t next_run_time_us = runner->GetNextRunTimeUs();
+    if (next_run_time_us <= current_time.us())
       return current_time;
-    next_time = std::min(next_time, next_run_time);
+    next_us = std::min(next_us, next_run_time_us);
   }
-  return next_time;
+  if (next_us == std::numeric_limits<int64_t>::max())
+    return Timestamp::PlusInfinity();
+  return Timestamp::us(next_us);
 }
 
 void SimulatedTimeControllerImpl::AdvanceTime(Timestamp target_time) {
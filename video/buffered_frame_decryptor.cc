@@ -11,6 +11,7 @@
 #include "video/buffered_frame_decryptor.h"
 
 #include <utility>
+#include <vector>
 
 #include "rtc_base/logging.h"
 #include "rtc_base/system/fallthrough.h"
@@ -37,14 +38,18 @@ void BufferedFrameDecryptor::ManageEncryptedFrame(
     std::unique_ptr<video_coding::RtpFrameObject> encrypted_frame) {
   switch (DecryptFrame(encrypted_frame.get())) {
     case FrameDecision::kStash:
-      if (stashed_frames_.size() >= kMaxStashedFrames) {
+      stashed_bytes_ += encrypted_frame->size();
+      stashed_frames_.push_back(std::move(encrypted_frame));
+      while (stashed_frames_.size() > kMaxStashedFrames ||
+             (stashed_bytes_ > kMaxStashedBytes &&
+              stashed_frames_.size() > 1)) {
         RTC_LOG(LS_WARNING) << "Encrypted frame stash full poping oldest item.";
+        stashed_bytes_ -= stashed_frames_.front()->size();
         stashed_frames_.pop_front();
       }
-      stashed_frames_.push_back(std::move(encrypted_frame));
       break;
     case FrameDecision::kDecrypted:
-      RetryStashedFrames();
+      DecryptPendingFrames();
       decrypted_frame_callback_->OnDecryptedFrame(std::move(encrypted_frame));
       break;
     case FrameDecision::kDrop:
@@ -111,17 +116,77 @@ BufferedFrameDecryptor::FrameDecision BufferedFrameDecryptor::DecryptFrame(
   return FrameDecision::kDecrypted;
 }
 
-void BufferedFrameDecryptor::RetryStashedFrames() {
-  if (!stashed_frames_.empty()) {
-    RTC_LOG(LS_INFO) << "Retrying stashed encrypted frames. Count: "
-                     << stashed_frames_.size();
+void BufferedFrameDecryptor::DecryptPendingFrames() {
+  if (stashed_frames_.empty())
+    return;
+  if (frame_decryptor_ == nullptr) {
+    RTC_LOG(LS_INFO) << "Frame decryption required but not attached to this "
+                        "stream. Keeping stashed frames.";
+    return;
   }
-  for (auto& frame : stashed_frames_) {
-    if (DecryptFrame(frame.get()) == FrameDecision::kDecrypted) {
-      decrypted_frame_callback_->OnDecryptedFrame(std::move(frame));
+  RTC_LOG(LS_INFO) << "Decrypting stashed encrypted frames as a batch. Count: "
+                   << stashed_frames_.size();
+  std::deque<std::unique_ptr<video_coding::RtpFrameObject>> frames;
+  frames.swap(stashed_frames_);
+  stashed_bytes_ = 0;
+
+  // Hand the whole stash to the decryptor in a single call, so its crypto
+  // backend can pipeline the cipher operations.
+  std::vector<RtpGenericFrameDescriptor> descriptors;
+  descriptors.reserve(frames.size());
+  std::vector<FrameDecryptorInterface::EncryptedFrame> batch;
+  batch.reserve(frames.size());
+  std::deque<std::unique_ptr<video_coding::RtpFrameObject>> pending;
+  for (auto& frame : frames) {
+    absl::optional<RtpGenericFrameDescriptor> descriptor =
+        frame->GetGenericFrameDescriptor();
+    if (!descriptor) {
+      RTC_LOG(LS_ERROR) << "No generic frame descriptor found dropping frame.";
+      continue;
+    }
+    const size_t max_plaintext_byte_size =
+        frame_decryptor_->GetMaxPlaintextByteSize(cricket::MEDIA_TYPE_VIDEO,
+                                                  frame->size());
+    RTC_CHECK_LE(max_plaintext_byte_size, frame->size());
+    descriptors.push_back(*descriptor);
+    FrameDecryptorInterface::EncryptedFrame entry;
+    if (generic_descriptor_auth_experiment_) {
+      entry.additional_data = descriptors.back().GetByteRepresentation();
     }
+    entry.encrypted_frame =
+        rtc::ArrayView<const uint8_t>(frame->data(), frame->size());
+    entry.frame = rtc::ArrayView<uint8_t>(frame->data(),
+                                          max_plaintext_byte_size);
+    batch.push_back(entry);
+    pending.push_back(std::move(frame));
+  }
+
+  const std::vector<FrameDecryptorInterface::Result> results =
+      frame_decryptor_->DecryptBatch(cricket::MEDIA_TYPE_VIDEO, /*csrcs=*/{},
+                                     batch);
+  RTC_CHECK_EQ(results.size(), pending.size());
+  for (size_t i = 0; i < pending.size(); ++i) {
+    const FrameDecryptorInterface::Result& result = results[i];
+    if (result.status != last_status_) {
+      last_status_ = result.status;
+      decryption_status_change_callback_->OnDecryptionStatusChange(
+          result.status);
+    }
+    if (!result.IsOk()) {
+      // Before the first successful decryption the frames stay stashed, e.g.
+      // when the batch is attempted on a key change that has not caught up
+      // with the stream yet.
+      if (!first_frame_decrypted_) {
+        stashed_bytes_ += pending[i]->size();
+        stashed_frames_.push_back(std::move(pending[i]));
+      }
+      continue;
+    }
+    RTC_CHECK_LE(result.bytes_written, batch[i].frame.size());
+    pending[i]->set_size(result.bytes_written);
+    first_frame_decrypted_ = true;
+    decrypted_frame_callback_->OnDecryptedFrame(std::move(pending[i]));
   }
-  stashed_frames_.clear();
 }
 
 }  // namespace webrtc
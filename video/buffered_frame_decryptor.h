@@ -76,6 +76,13 @@ class BufferedFrameDecryptor final {
   void ManageEncryptedFrame(
       std::unique_ptr<video_coding::RtpFrameObject> encrypted_frame);
 
+  // Attempts to decrypt all stashed frames as a single DecryptBatch() call,
+  // so the decryptor can pipeline its cipher operations instead of being
+  // invoked once per frame. Called internally after the first successful
+  // decryption; may also be called externally, e.g. when a new key has been
+  // applied to the frame decryptor.
+  void DecryptPendingFrames();
+
  private:
   // Represents what should be done with a given frame.
   enum class FrameDecision { kStash, kDecrypted, kDrop };
@@ -84,14 +91,16 @@ class BufferedFrameDecryptor final {
   // decrypted it will return kStash. Otherwise fail to decrypts will return
   // kDrop. Successful decryptions will always return kDecrypted.
   FrameDecision DecryptFrame(video_coding::RtpFrameObject* frame);
-  // Retries all the stashed frames this is triggered each time a kDecrypted
-  // event occurs.
-  void RetryStashedFrames();
 
+  // The stash is bounded primarily by payload bytes, so that a burst of large
+  // key frames cannot balloon memory; the frame count cap remains as a
+  // backstop for streams of tiny frames.
   static const size_t kMaxStashedFrames = 24;
+  static const size_t kMaxStashedBytes = 512 * 1024;
 
   const bool generic_descriptor_auth_experiment_;
   bool first_frame_decrypted_ = false;
+  size_t stashed_bytes_ = 0;
   FrameDecryptorInterface::Status last_status_ =
       FrameDecryptorInterface::Status::kUnknown;
   rtc::scoped_refptr<FrameDecryptorInterface> frame_decryptor_;
@@ -122,22 +122,21 @@ void CallStats::Process() {
   int64_t now = clock_->TimeInMilliseconds();
   last_process_time_ = now;
 
-  // |avg_rtt_ms_| is allowed to be read on the process thread since that's the
-  // only thread that modifies the value.
-  int64_t avg_rtt_ms = avg_rtt_ms_;
+  int64_t avg_rtt_ms = avg_rtt_ms_.load(std::memory_order_relaxed);
   RemoveOldReports(now, &reports_);
-  max_rtt_ms_ = GetMaxRttMs(reports_);
+  const int64_t max_rtt_ms = GetMaxRttMs(reports_);
   avg_rtt_ms = GetNewAvgRttMs(reports_, avg_rtt_ms);
-  {
-    rtc::CritScope lock(&avg_rtt_ms_lock_);
-    avg_rtt_ms_ = avg_rtt_ms;
-  }
+
+  // Publish the snapshot before notifying the observers, so that readers on
+  // other threads pick up the new values without blocking on this thread.
+  max_rtt_ms_.store(max_rtt_ms, std::memory_order_relaxed);
+  avg_rtt_ms_.store(avg_rtt_ms, std::memory_order_relaxed);
 
   // If there is a valid rtt, update all observers with the max rtt.
-  if (max_rtt_ms_ >= 0) {
+  if (max_rtt_ms >= 0) {
     RTC_DCHECK_GE(avg_rtt_ms, 0);
     for (CallStatsObserver* observer : observers_)
-      observer->OnRttUpdate(avg_rtt_ms, max_rtt_ms_);
+      observer->OnRttUpdate(avg_rtt_ms, max_rtt_ms);
     // Sum for Histogram of average RTT reported over the entire call.
     sum_avg_rtt_ms_ += avg_rtt_ms;
     ++num_avg_rtt_;
@@ -173,13 +172,11 @@ void CallStats::DeregisterStatsObserver(CallStatsObserver* observer) {
 }
 
 int64_t CallStats::LastProcessedRtt() const {
-  // TODO(tommi): This currently gets called from the construction thread of
-  // Call as well as from the process thread. Look into restricting this to
-  // allow only reading this from the process thread (or TQ once we get there)
-  // so that the lock isn't necessary.
-
-  rtc::CritScope cs(&avg_rtt_ms_lock_);
-  return avg_rtt_ms_;
+  // Called from several threads (the construction thread of Call, the process
+  // thread of every RtpRtcp module, stats pollers); the atomic snapshot makes
+  // the read wait-free so the readers cannot convoy behind each other or
+  // behind Process().
+  return avg_rtt_ms_.load(std::memory_order_relaxed);
 }
 
 void CallStats::OnRttUpdate(int64_t rtt) {
@@ -11,13 +11,13 @@
 #ifndef VIDEO_CALL_STATS_H_
 #define VIDEO_CALL_STATS_H_
 
+#include <atomic>
 #include <list>
 #include <memory>
 
 #include "modules/include/module.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "rtc_base/constructor_magic.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/thread_checker.h"
 #include "system_wrappers/include/clock.h"
 
@@ -41,13 +41,16 @@ class CallStats : public Module, public RtcpRttStats {
 
   // Expose |LastProcessedRtt()| from RtcpRttStats to the public interface, as
   // it is the part of the API that is needed by direct users of CallStats.
-  // TODO(tommi): Threading or lifetime guarantees are not explicit in how
-  // CallStats is used as RtcpRttStats or how pointers are cached in a
-  // few different places (distributed via Call). It would be good to clarify
-  // from what thread/TQ calls to OnRttUpdate and LastProcessedRtt need to be
-  // allowed.
+  // Reads the published RTT snapshot; wait-free and callable from any thread.
   int64_t LastProcessedRtt() const override;
 
+  // The max RTT from the last statistics update, published together with the
+  // average read by LastProcessedRtt(). Wait-free and callable from any
+  // thread; -1 when there is no valid estimate.
+  int64_t max_rtt_ms() const {
+    return max_rtt_ms_.load(std::memory_order_relaxed);
+  }
+
   // Exposed for tests to test histogram support.
   void UpdateHistogramsForTest() { UpdateHistograms(); }
 
@@ -79,17 +82,11 @@ class CallStats : public Module, public RtcpRttStats {
 
   // The last time 'Process' resulted in statistic update.
   int64_t last_process_time_ RTC_GUARDED_BY(process_thread_checker_);
-  // The last RTT in the statistics update (zero if there is no valid estimate).
-  int64_t max_rtt_ms_ RTC_GUARDED_BY(process_thread_checker_);
-
-  // Accessed from random threads (seemingly). Consider atomic.
-  // |avg_rtt_ms_| is allowed to be read on the process thread without a lock.
-  // |avg_rtt_ms_lock_| must be held elsewhere for reading.
-  // |avg_rtt_ms_lock_| must be held on the process thread for writing.
-  int64_t avg_rtt_ms_;
 
-  // Protects |avg_rtt_ms_|.
-  rtc::CriticalSection avg_rtt_ms_lock_;
+  // Snapshot of the last statistics update (-1 if there is no valid
+  // estimate), written by Process() and read from any thread without a lock.
+  std::atomic<int64_t> max_rtt_ms_;
+  std::atomic<int64_t> avg_rtt_ms_;
 
   // |sum_avg_rtt_ms_|, |num_avg_rtt_| and |time_of_first_rtt_ms_| are only used
   // on the ProcessThread when running. When the Process Thread is not running,
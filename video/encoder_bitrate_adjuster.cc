@@ -11,6 +11,7 @@
 #include "video/encoder_bitrate_adjuster.h"
 
 #include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "absl/memory/memory.h"
@@ -43,12 +44,15 @@ struct LayerRateInfo {
 constexpr int64_t EncoderBitrateAdjuster::kWindowSizeMs;
 constexpr size_t EncoderBitrateAdjuster::kMinFramesSinceLayoutChange;
 constexpr double EncoderBitrateAdjuster::kDefaultUtilizationFactor;
+constexpr double EncoderBitrateAdjuster::kUtilizationDriftThreshold;
 
 EncoderBitrateAdjuster::EncoderBitrateAdjuster(const VideoCodec& codec_settings)
     : utilize_bandwidth_headroom_(RateControlSettings::ParseFromFieldTrials()
                                       .BitrateAdjusterCanUseNetworkHeadroom()),
       frames_since_layout_change_(0),
-      min_bitrates_bps_{} {
+      min_bitrates_bps_{},
+      cached_link_utilization_factors_{},
+      cached_media_utilization_factors_{} {
   if (codec_settings.codecType == VideoCodecType::kVideoCodecVP9) {
     for (size_t si = 0; si < codec_settings.VP9().numberOfSpatialLayers; ++si) {
       if (codec_settings.spatialLayers[si].active) {
@@ -183,6 +187,34 @@ VideoBitrateAllocation EncoderBitrateAdjuster::AdjustRateAllocation(
     }
   }
 
+  // Polling the overshoot detectors above is cheap, but building the adjusted
+  // allocation and re-targeting the detectors below is not. If the input
+  // rates match those of the last computed allocation and the utilization
+  // factors have not drifted past kUtilizationDriftThreshold since then,
+  // return the cached allocation; the detectors then also keep their current
+  // targets, which were derived from that same allocation.
+  if (cached_adjusted_allocation_ &&
+      rates.bitrate == cached_rate_control_parameters_.bitrate &&
+      rates.framerate_fps == cached_rate_control_parameters_.framerate_fps &&
+      rates.bandwidth_allocation ==
+          cached_rate_control_parameters_.bandwidth_allocation) {
+    bool utilization_drifted = false;
+    for (size_t si = 0; si < kMaxSpatialLayers; ++si) {
+      if (std::fabs(layer_infos[si].link_utilization_factor -
+                    cached_link_utilization_factors_[si]) >
+              kUtilizationDriftThreshold ||
+          std::fabs(layer_infos[si].media_utilization_factor -
+                    cached_media_utilization_factors_[si]) >
+              kUtilizationDriftThreshold) {
+        utilization_drifted = true;
+        break;
+      }
+    }
+    if (!utilization_drifted) {
+      return *cached_adjusted_allocation_;
+    }
+  }
+
   // Available link headroom that can be used to fill wanted overshoot.
   DataRate available_headroom = DataRate::Zero();
   if (utilize_bandwidth_headroom_) {
@@ -289,6 +321,17 @@ VideoBitrateAllocation EncoderBitrateAdjuster::AdjustRateAllocation(
     }
   }
 
+  // Remember the inputs this allocation was computed from, so that subsequent
+  // calls with unchanged rates and stable utilization can reuse it.
+  cached_adjusted_allocation_ = adjusted_allocation;
+  cached_rate_control_parameters_ = rates;
+  for (size_t si = 0; si < kMaxSpatialLayers; ++si) {
+    cached_link_utilization_factors_[si] =
+        layer_infos[si].link_utilization_factor;
+    cached_media_utilization_factors_[si] =
+        layer_infos[si].media_utilization_factor;
+  }
+
   return adjusted_allocation;
 }
 
@@ -299,6 +342,10 @@ void EncoderBitrateAdjuster::OnEncoderInfo(
     current_fps_allocation_[si] = encoder_info.fps_allocation[si];
   }
 
+  // The fps allocation affects both layer weighting and detector targets;
+  // any cached allocation may no longer be valid.
+  cached_adjusted_allocation_.reset();
+
   // Trigger re-allocation so that overshoot detectors have correct targets.
   AdjustRateAllocation(current_rate_control_parameters_);
 }
@@ -321,6 +368,7 @@ void EncoderBitrateAdjuster::Reset() {
       overshoot_detectors_[si][ti].reset();
     }
   }
+  cached_adjusted_allocation_.reset();
   // Call AdjustRateAllocation() with the last know bitrate allocation, so that
   // the appropriate overuse detectors are immediately re-created.
   AdjustRateAllocation(current_rate_control_parameters_);
@@ -13,6 +13,7 @@
 
 #include <memory>
 
+#include "absl/types/optional.h"
 #include "api/video/encoded_image.h"
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video_codecs/video_encoder.h"
@@ -33,6 +34,11 @@ class EncoderBitrateAdjuster {
   // overshoot. This is conservative so that badly misbehaving encoders don't
   // build too much queue at the very start.
   static constexpr double kDefaultUtilizationFactor = 1.2;
+  // How much the utilization factors may drift from the values used for the
+  // most recent allocation before the allocation is recomputed. While within
+  // this threshold and with unchanged input rates, the cached allocation is
+  // returned as is.
+  static constexpr double kUtilizationDriftThreshold = 0.05;
 
   explicit EncoderBitrateAdjuster(const VideoCodec& codec_settings);
   ~EncoderBitrateAdjuster();
@@ -68,6 +74,15 @@ class EncoderBitrateAdjuster {
 
   // Minimum bitrates allowed, per spatial layer.
   uint32_t min_bitrates_bps_[kMaxSpatialLayers];
+
+  // Cached result of the last fully computed AdjustRateAllocation() call,
+  // together with the inputs it was computed from. Invalidated when the rates
+  // change, when the encoder info changes or when utilization drifts past
+  // kUtilizationDriftThreshold.
+  absl::optional<VideoBitrateAllocation> cached_adjusted_allocation_;
+  VideoEncoder::RateControlParameters cached_rate_control_parameters_;
+  double cached_link_utilization_factors_[kMaxSpatialLayers];
+  double cached_media_utilization_factors_[kMaxSpatialLayers];
 };
 
 }  // namespace webrtc
@@ -20,9 +20,15 @@ namespace {
 static constexpr double kMaxMediaUnderrunFrames = 5.0;
 }  // namespace
 
+constexpr int EncoderOvershootDetector::kNumWindowBuckets;
+constexpr int EncoderOvershootDetector::kNumRingSlots;
+
 EncoderOvershootDetector::EncoderOvershootDetector(int64_t window_size_ms)
-    : window_size_ms_(window_size_ms),
+    : bucket_length_ms_(
+          std::max<int64_t>(1, window_size_ms / kNumWindowBuckets)),
       time_last_update_ms_(-1),
+      newest_bucket_epoch_(-1),
+      num_frames_in_window_(0),
       sum_network_utilization_factors_(0.0),
       sum_media_utilization_factors_(0.0),
       target_bitrate_(DataRate::Zero()),
@@ -41,9 +47,7 @@ void EncoderOvershootDetector::SetTargetRate(DataRate target_bitrate,
   } else if (target_bitrate != DataRate::Zero()) {
     // Stream was just enabled, reset state.
     time_last_update_ms_ = time_ms;
-    utilization_factors_.clear();
-    sum_network_utilization_factors_ = 0.0;
-    sum_media_utilization_factors_ = 0.0;
+    ClearWindow();
     network_buffer_level_bits_ = 0;
     media_buffer_level_bits_ = 0;
   }
@@ -64,6 +68,10 @@ void EncoderOvershootDetector::OnEncodedFrame(size_t bytes, int64_t time_ms) {
     return;
   }
 
+  // Advance the bucket ring so old data is dropped and the newest bucket
+  // covers |time_ms|, before the first-frame check below.
+  CullOldUpdates(time_ms);
+
   const double network_utilization_factor = HandleEncodedFrame(
       bytes * 8, ideal_frame_size_bits, time_ms, &network_buffer_level_bits_);
   const double media_utilization_factor = HandleEncodedFrame(
@@ -71,9 +79,13 @@ void EncoderOvershootDetector::OnEncodedFrame(size_t bytes, int64_t time_ms) {
 
   sum_network_utilization_factors_ += network_utilization_factor;
   sum_media_utilization_factors_ += media_utilization_factor;
+  ++num_frames_in_window_;
 
-  utilization_factors_.emplace_back(network_utilization_factor,
-                                    media_utilization_factor, time_ms);
+  UtilizationBucket& bucket =
+      buckets_[newest_bucket_epoch_ % kNumRingSlots];
+  bucket.sum_network_utilization_factors += network_utilization_factor;
+  bucket.sum_media_utilization_factors += media_utilization_factor;
+  ++bucket.num_frames;
 }
 
 double EncoderOvershootDetector::HandleEncodedFrame(
@@ -97,7 +109,7 @@ double EncoderOvershootDetector::HandleEncodedFrame(
   // Add entry for the (over) utilization for this frame. Factor is capped
   // at 1.0 so that we don't risk overshooting on sudden changes.
   double utilization_factor;
-  if (utilization_factors_.empty()) {
+  if (num_frames_in_window_ == 0) {
     // First frame, cannot estimate overshoot based on previous one so
     // for this particular frame, just like as size vs optimal size.
     utilization_factor = std::max(
@@ -120,13 +132,13 @@ EncoderOvershootDetector::GetNetworkRateUtilizationFactor(int64_t time_ms) {
   CullOldUpdates(time_ms);
 
   // No data points within window, return.
-  if (utilization_factors_.empty()) {
+  if (num_frames_in_window_ == 0) {
     return absl::nullopt;
   }
 
   // TODO(sprang): Consider changing from arithmetic mean to some other
   // function such as 90th percentile.
-  return sum_network_utilization_factors_ / utilization_factors_.size();
+  return sum_network_utilization_factors_ / num_frames_in_window_;
 }
 
 absl::optional<double> EncoderOvershootDetector::GetMediaRateUtilizationFactor(
@@ -134,19 +146,17 @@ absl::optional<double> EncoderOvershootDetector::GetMediaRateUtilizationFactor(
   CullOldUpdates(time_ms);
 
   // No data points within window, return.
-  if (utilization_factors_.empty()) {
+  if (num_frames_in_window_ == 0) {
     return absl::nullopt;
   }
 
-  return sum_media_utilization_factors_ / utilization_factors_.size();
+  return sum_media_utilization_factors_ / num_frames_in_window_;
 }
 
 void EncoderOvershootDetector::Reset() {
   time_last_update_ms_ = -1;
-  utilization_factors_.clear();
+  ClearWindow();
   target_bitrate_ = DataRate::Zero();
-  sum_network_utilization_factors_ = 0.0;
-  sum_media_utilization_factors_ = 0.0;
   target_framerate_fps_ = 0.0;
   network_buffer_level_bits_ = 0;
   media_buffer_level_bits_ = 0;
@@ -186,19 +196,46 @@ void EncoderOvershootDetector::LeakBits(int64_t time_ms) {
 }
 
 void EncoderOvershootDetector::CullOldUpdates(int64_t time_ms) {
-  // Cull old data points.
-  const int64_t cutoff_time_ms = time_ms - window_size_ms_;
-  while (!utilization_factors_.empty() &&
-         utilization_factors_.front().update_time_ms < cutoff_time_ms) {
-    // Make sure sum is never allowed to become negative due rounding errors.
-    sum_network_utilization_factors_ = std::max(
-        0.0, sum_network_utilization_factors_ -
-                 utilization_factors_.front().network_utilization_factor);
-    sum_media_utilization_factors_ = std::max(
-        0.0, sum_media_utilization_factors_ -
-                 utilization_factors_.front().media_utilization_factor);
-    utilization_factors_.pop_front();
+  const int64_t epoch = time_ms / bucket_length_ms_;
+  if (newest_bucket_epoch_ == -1) {
+    newest_bucket_epoch_ = epoch;
+    return;
+  }
+  if (epoch <= newest_bucket_epoch_) {
+    // Same bucket as the last update, or time moved backwards; keep adding to
+    // the newest bucket.
+    return;
   }
+  if (epoch - newest_bucket_epoch_ >= kNumRingSlots) {
+    // The entire window has expired.
+    ClearWindow();
+  } else {
+    // Cull buckets that have fallen out of the window, and zero the slots
+    // that will be reused for new epochs.
+    for (int64_t e = newest_bucket_epoch_ + 1; e <= epoch; ++e) {
+      UtilizationBucket& bucket = buckets_[e % kNumRingSlots];
+      // Make sure sum is never allowed to become negative due rounding errors.
+      sum_network_utilization_factors_ =
+          std::max(0.0, sum_network_utilization_factors_ -
+                            bucket.sum_network_utilization_factors);
+      sum_media_utilization_factors_ =
+          std::max(0.0, sum_media_utilization_factors_ -
+                            bucket.sum_media_utilization_factors);
+      num_frames_in_window_ -= bucket.num_frames;
+      bucket = UtilizationBucket();
+    }
+  }
+  newest_bucket_epoch_ = epoch;
+}
+
+void EncoderOvershootDetector::ClearWindow() {
+  for (UtilizationBucket& bucket : buckets_) {
+    bucket = UtilizationBucket();
+  }
+  newest_bucket_epoch_ = -1;
+  num_frames_in_window_ = 0;
+  sum_network_utilization_factors_ = 0.0;
+  sum_media_utilization_factors_ = 0.0;
 }
 
 }  // namespace webrtc
@@ -11,8 +11,6 @@
 #ifndef VIDEO_ENCODER_OVERSHOOT_DETECTOR_H_
 #define VIDEO_ENCODER_OVERSHOOT_DETECTOR_H_
 
-#include <deque>
-
 #include "absl/types/optional.h"
 #include "api/units/data_rate.h"
 
@@ -39,9 +37,20 @@ class EncoderOvershootDetector {
   void Reset();
 
  private:
+  // The window is approximated by a ring of fixed time buckets, so that both
+  // frame updates and utilization queries are amortized constant time and
+  // don't keep per-frame state around. One extra bucket is kept so that the
+  // ring always covers at least the full window; a frame is thus retained for
+  // at most one bucket length longer than with an exact per-frame cutoff.
+  static constexpr int kNumWindowBuckets = 100;
+  static constexpr int kNumRingSlots = kNumWindowBuckets + 1;
+
   int64_t IdealFrameSizeBits() const;
   void LeakBits(int64_t time_ms);
+  // Advances the bucket ring to |time_ms|, dropping buckets that have fallen
+  // out of the window from the running sums.
   void CullOldUpdates(int64_t time_ms);
+  void ClearWindow();
   // Updates provided buffer and checks if overuse ensues, returns
   // the calculated utilization factor for this frame.
   double HandleEncodedFrame(size_t frame_size_bits,
@@ -49,22 +58,21 @@ class EncoderOvershootDetector {
                             int64_t time_ms,
                             int64_t* buffer_level_bits) const;
 
-  const int64_t window_size_ms_;
-  int64_t time_last_update_ms_;
-  struct BitrateUpdate {
-    BitrateUpdate(double network_utilization_factor,
-                  double media_utilization_factor,
-                  int64_t update_time_ms)
-        : network_utilization_factor(network_utilization_factor),
-          media_utilization_factor(media_utilization_factor),
-          update_time_ms(update_time_ms) {}
-    // The utilization factor based on strict network rate.
-    double network_utilization_factor;
-    // The utilization based on average media rate.
-    double media_utilization_factor;
-    int64_t update_time_ms;
+  struct UtilizationBucket {
+    // Sums of the utilization factors based on strict network rate
+    // respectively average media rate, for frames in this bucket.
+    double sum_network_utilization_factors = 0.0;
+    double sum_media_utilization_factors = 0.0;
+    int num_frames = 0;
   };
-  std::deque<BitrateUpdate> utilization_factors_;
+
+  const int64_t bucket_length_ms_;
+  int64_t time_last_update_ms_;
+  UtilizationBucket buckets_[kNumRingSlots];
+  // Bucket epoch (time divided by bucket length) that the ring has been
+  // advanced to, or -1 if no update has been seen yet.
+  int64_t newest_bucket_epoch_;
+  int64_t num_frames_in_window_;
   double sum_network_utilization_factors_;
   double sum_media_utilization_factors_;
   DataRate target_bitrate_;
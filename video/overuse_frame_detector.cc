@@ -22,6 +22,7 @@
 #include "absl/memory/memory.h"
 #include "api/video/video_frame.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/exp_filter.h"
 #include "rtc_base/time_utils.h"
@@ -330,6 +331,86 @@ class SendProcessingUsage2 : public OveruseFrameDetector::ProcessingUsage {
   double load_estimate_;
 };
 
+// Estimates the encode load from the CPU clock of the thread the detector
+// runs on, i.e., the encoder task queue. Software encoding runs synchronously
+// on that thread, so the CPU time it consumes between two sent frames is the
+// actual encode cost. Unlike the wall-clock based estimators above, this is
+// not inflated when the thread is preempted by other processes, which
+// otherwise gets misattributed as encode time.
+class ThreadCpuProcessingUsage : public OveruseFrameDetector::ProcessingUsage {
+ public:
+  explicit ThreadCpuProcessingUsage(const CpuOveruseOptions& options)
+      : options_(options),
+        filter_time_s_(1e-3 * (options.filter_time_ms > 0
+                                   ? options.filter_time_ms
+                                   : kDefaultFilterTimeMs)) {
+    Reset();
+  }
+  ~ThreadCpuProcessingUsage() override = default;
+
+  void Reset() override {
+    prev_wall_time_us_ = -1;
+    prev_cpu_time_ns_ = -1;
+    // Start in between the underuse and overuse threshold.
+    load_estimate_ = (options_.low_encode_usage_threshold_percent +
+                      options_.high_encode_usage_threshold_percent) /
+                     200.0;
+  }
+
+  void SetMaxSampleDiffMs(float /* diff_ms */) override {}
+
+  void FrameCaptured(const VideoFrame& frame,
+                     int64_t time_when_first_seen_us,
+                     int64_t last_capture_time_us) override {}
+
+  absl::optional<int> FrameSent(
+      uint32_t /* timestamp */,
+      int64_t time_sent_in_us,
+      int64_t /* capture_time_us */,
+      absl::optional<int> /* encode_duration_us */) override {
+    int64_t cpu_time_ns = rtc::GetThreadCpuTimeNanos();
+    absl::optional<int> cpu_duration_us;
+    if (prev_wall_time_us_ != -1 && time_sent_in_us > prev_wall_time_us_) {
+      int64_t cpu_delta_ns = cpu_time_ns - prev_cpu_time_ns_;
+      AddSample(1e-9 * cpu_delta_ns,
+                1e-6 * (time_sent_in_us - prev_wall_time_us_));
+      cpu_duration_us.emplace(
+          rtc::dchecked_cast<int>(cpu_delta_ns / rtc::kNumNanosecsPerMicrosec));
+    }
+    prev_wall_time_us_ = time_sent_in_us;
+    prev_cpu_time_ns_ = cpu_time_ns;
+    return cpu_duration_us;
+  }
+
+  int Value() override { return static_cast<int>(100.0 * load_estimate_ + 0.5); }
+
+ private:
+  // Used when neither the options nor the field trial set a time constant.
+  static constexpr int kDefaultFilterTimeMs = 1000;
+
+  void AddSample(double cpu_time, double diff_time) {
+    RTC_CHECK_GE(diff_time, 0.0);
+
+    // Same exponential filter as used by SendProcessingUsage2, with the
+    // thread CPU time consumed during the interval as the cost measure.
+    double e = diff_time / filter_time_s_;
+    double c;
+    if (e < 0.0001) {
+      c = (1 - e / 2) / filter_time_s_;
+    } else {
+      c = -expm1(-e) / diff_time;
+    }
+    load_estimate_ = c * cpu_time + exp(-e) * load_estimate_;
+  }
+
+  const CpuOveruseOptions options_;
+  const double filter_time_s_;
+
+  int64_t prev_wall_time_us_ = -1;
+  int64_t prev_cpu_time_ns_ = -1;
+  double load_estimate_;
+};
+
 // Class used for manual testing of overuse, enabled via field trial flag.
 class OverdoseInjector : public OveruseFrameDetector::ProcessingUsage {
  public:
@@ -438,7 +519,9 @@ CpuOveruseOptions::CpuOveruseOptions()
       min_process_count(3),
       high_threshold_consecutive_count(2),
       // Disabled by default.
-      filter_time_ms(0) {
+      filter_time_ms(0),
+      // Disabled by default.
+      use_thread_cpu_time(false) {
 #if defined(WEBRTC_MAC) && !defined(WEBRTC_IOS)
   // This is proof-of-concept code for letting the physical core count affect
   // the interval into which we attempt to scale. For now, the code is Mac OS
@@ -486,7 +569,9 @@ CpuOveruseOptions::CpuOveruseOptions()
 std::unique_ptr<OveruseFrameDetector::ProcessingUsage>
 OveruseFrameDetector::CreateProcessingUsage(const CpuOveruseOptions& options) {
   std::unique_ptr<ProcessingUsage> instance;
-  if (options.filter_time_ms > 0) {
+  if (options.use_thread_cpu_time) {
+    instance = absl::make_unique<ThreadCpuProcessingUsage>(options);
+  } else if (options.filter_time_ms > 0) {
     instance = absl::make_unique<SendProcessingUsage2>(options);
   } else {
     instance = absl::make_unique<SendProcessingUsage1>(options);
@@ -533,7 +618,7 @@ OveruseFrameDetector::OveruseFrameDetector(
       in_quick_rampup_(false),
       current_rampup_delay_ms_(kStandardRampUpDelayMs) {
   task_checker_.Detach();
-  ParseFieldTrial({&filter_time_constant_},
+  ParseFieldTrial({&filter_time_constant_, &thread_cpu_time_},
                   field_trial::FindFullName("WebRTC-CpuLoadEstimator"));
 }
 
@@ -690,6 +775,9 @@ void OveruseFrameDetector::SetOptions(const CpuOveruseOptions& options) {
   if (filter_time_constant_) {
     options_.filter_time_ms = filter_time_constant_->ms();
   }
+  if (thread_cpu_time_) {
+    options_.use_thread_cpu_time = true;
+  }
   // Force reset with next frame.
   num_pixels_ = 0;
   usage_ = CreateProcessingUsage(options);
@@ -45,6 +45,9 @@ struct CpuOveruseOptions {
                                          // triggering an overuse.
   // New estimator enabled if this is set non-zero.
   int filter_time_ms;  // Time constant for averaging
+  // If set, the load is estimated from the CPU clock of the thread the
+  // detector runs on instead of from wall-clock encode durations.
+  bool use_thread_cpu_time;
 };
 
 // Use to detect system overuse based on the send-side processing time of
@@ -149,6 +152,8 @@ class OveruseFrameDetector {
 
   // If set by field trial, overrides CpuOveruseOptions::filter_time_ms.
   FieldTrialOptional<TimeDelta> filter_time_constant_{"tau"};
+  // If set by field trial, overrides CpuOveruseOptions::use_thread_cpu_time.
+  FieldTrialFlag thread_cpu_time_{"thread_cpu"};
 
   RTC_DISALLOW_COPY_AND_ASSIGN(OveruseFrameDetector);
 };
@@ -109,7 +109,6 @@ ReceiveStatisticsProxy::ReceiveStatisticsProxy(
           new VideoQualityObserver(VideoContentType::UNSPECIFIED)),
       interframe_delay_max_moving_(kMovingMaxWindowMs),
       freq_offset_counter_(clock, nullptr, kFreqOffsetProcessIntervalMs),
-      avg_rtt_ms_(0),
       last_content_type_(VideoContentType::UNSPECIFIED),
       last_codec_type_(kVideoCodecVP8),
       num_delayed_frames_rendered_(0),
@@ -132,6 +131,9 @@ void ReceiveStatisticsProxy::UpdateHistograms(
 
   rtc::CritScope lock(&crit_);
 
+  const uint32_t frames_decoded =
+      frames_decoded_.load(std::memory_order_relaxed);
+
   char log_stream_buf[8 * 1024];
   rtc::SimpleStringBuilder log_stream(log_stream_buf);
   int stream_duration_sec = (clock_->TimeInMilliseconds() - start_ms_) / 1000;
@@ -143,10 +145,10 @@ void ReceiveStatisticsProxy::UpdateHistograms(
                << stream_duration_sec << '\n';
   }
 
-  log_stream << "Frames decoded " << stats_.frames_decoded << '\n';
+  log_stream << "Frames decoded " << frames_decoded << '\n';
 
   if (num_unique_frames_) {
-    int num_dropped_frames = *num_unique_frames_ - stats_.frames_decoded;
+    int num_dropped_frames = *num_unique_frames_ - frames_decoded;
     RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.DroppedFrames.Receiver",
                               num_dropped_frames);
     log_stream << "WebRTC.Video.DroppedFrames.Receiver " << num_dropped_frames
@@ -165,8 +167,8 @@ void ReceiveStatisticsProxy::UpdateHistograms(
         (clock_->TimeInMilliseconds() - *first_decoded_frame_time_ms_);
     if (elapsed_ms >=
         metrics::kMinRunTimeInSeconds * rtc::kNumMillisecsPerSec) {
-      int decoded_fps = static_cast<int>(
-          (stats_.frames_decoded * 1000.0f / elapsed_ms) + 0.5f);
+      int decoded_fps =
+          static_cast<int>((frames_decoded * 1000.0f / elapsed_ms) + 0.5f);
       RTC_HISTOGRAM_COUNTS_100("WebRTC.Video.DecodedFramesPerSecond",
                                decoded_fps);
       log_stream << "WebRTC.Video.DecodedFramesPerSecond " << decoded_fps
@@ -553,44 +555,78 @@ void ReceiveStatisticsProxy::UpdateFramerate(int64_t now_ms) const {
   stats_.network_frame_rate = static_cast<int>(framerate);
 }
 
+void ReceiveStatisticsProxy::FoldHotCounters(
+    VideoReceiveStream::Stats* stats) const {
+  stats->frames_decoded = frames_decoded_.load(std::memory_order_relaxed);
+  stats->total_decode_time_ms =
+      total_decode_time_ms_.load(std::memory_order_relaxed);
+  stats->decode_ms = last_decode_time_ms_.load(std::memory_order_relaxed);
+  stats->frames_dropped = frames_dropped_.load(std::memory_order_relaxed);
+}
+
 VideoReceiveStream::Stats ReceiveStatisticsProxy::GetStats() const {
-  rtc::CritScope lock(&crit_);
-  // Get current frame rates here, as only updating them on new frames prevents
-  // us from ever correctly displaying frame rate of 0.
-  int64_t now_ms = clock_->TimeInMilliseconds();
-  UpdateFramerate(now_ms);
-  stats_.render_frame_rate = renders_fps_estimator_.Rate(now_ms).value_or(0);
-  stats_.decode_frame_rate = decode_fps_estimator_.Rate(now_ms).value_or(0);
-  stats_.interframe_delay_max_ms =
-      interframe_delay_max_moving_.Max(now_ms).value_or(-1);
-  stats_.freeze_count = video_quality_observer_->NumFreezes();
-  stats_.pause_count = video_quality_observer_->NumPauses();
-  stats_.total_freezes_duration_ms =
-      video_quality_observer_->TotalFreezesDurationMs();
-  stats_.total_pauses_duration_ms =
-      video_quality_observer_->TotalPausesDurationMs();
-  stats_.total_frames_duration_ms =
-      video_quality_observer_->TotalFramesDurationMs();
-  stats_.sum_squared_frame_durations =
-      video_quality_observer_->SumSquaredFrameDurationsSec();
-  stats_.content_type = last_content_type_;
-  stats_.timing_frame_info = timing_frame_info_counter_.Max(now_ms);
-  stats_.jitter_buffer_delay_seconds =
-      static_cast<double>(current_delay_counter_.Sum(1).value_or(0)) /
-      rtc::kNumMillisecsPerSec;
-  stats_.jitter_buffer_emitted_count = current_delay_counter_.NumSamples();
-  return stats_;
+  const int64_t now_ms = clock_->TimeInMilliseconds();
+  const uint32_t current_version = stats_version_.load();
+  {
+    // Serve the last published snapshot if nothing has changed since it was
+    // built, so that concurrent stats pollers don't all contend with the
+    // decode and render threads on |crit_|. The hot counters are folded in
+    // below regardless, so they are always current. The snapshot is keyed on
+    // time as well since the frame rates and moving maxima decay with time.
+    rtc::CritScope lock(&snapshot_crit_);
+    if (snapshot_time_ms_ == now_ms && snapshot_version_ == current_version) {
+      VideoReceiveStream::Stats stats = snapshot_stats_;
+      FoldHotCounters(&stats);
+      return stats;
+    }
+  }
+  VideoReceiveStream::Stats stats;
+  {
+    rtc::CritScope lock(&crit_);
+    // Get current frame rates here, as only updating them on new frames
+    // prevents us from ever correctly displaying frame rate of 0.
+    UpdateFramerate(now_ms);
+    stats_.render_frame_rate = renders_fps_estimator_.Rate(now_ms).value_or(0);
+    stats_.decode_frame_rate = decode_fps_estimator_.Rate(now_ms).value_or(0);
+    stats_.interframe_delay_max_ms =
+        interframe_delay_max_moving_.Max(now_ms).value_or(-1);
+    stats_.freeze_count = video_quality_observer_->NumFreezes();
+    stats_.pause_count = video_quality_observer_->NumPauses();
+    stats_.total_freezes_duration_ms =
+        video_quality_observer_->TotalFreezesDurationMs();
+    stats_.total_pauses_duration_ms =
+        video_quality_observer_->TotalPausesDurationMs();
+    stats_.total_frames_duration_ms =
+        video_quality_observer_->TotalFramesDurationMs();
+    stats_.sum_squared_frame_durations =
+        video_quality_observer_->SumSquaredFrameDurationsSec();
+    stats_.content_type = last_content_type_;
+    stats_.timing_frame_info = timing_frame_info_counter_.Max(now_ms);
+    stats_.jitter_buffer_delay_seconds =
+        static_cast<double>(current_delay_counter_.Sum(1).value_or(0)) /
+        rtc::kNumMillisecsPerSec;
+    stats_.jitter_buffer_emitted_count = current_delay_counter_.NumSamples();
+    stats = stats_;
+  }
+  FoldHotCounters(&stats);
+  rtc::CritScope lock(&snapshot_crit_);
+  snapshot_stats_ = stats;
+  snapshot_time_ms_ = now_ms;
+  snapshot_version_ = current_version;
+  return stats;
 }
 
 void ReceiveStatisticsProxy::OnIncomingPayloadType(int payload_type) {
   rtc::CritScope lock(&crit_);
   stats_.current_payload_type = payload_type;
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnDecoderImplementationName(
     const char* implementation_name) {
   rtc::CritScope lock(&crit_);
   stats_.decoder_implementation_name = implementation_name;
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
@@ -612,7 +648,9 @@ void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
   current_delay_counter_.Add(current_delay_ms);
   // Network delay (rtt/2) + target_delay_ms (jitter delay + decode time +
   // render delay).
-  delay_counter_.Add(target_delay_ms + avg_rtt_ms_ / 2);
+  delay_counter_.Add(target_delay_ms +
+                     avg_rtt_ms_.load(std::memory_order_relaxed) / 2);
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnUniqueFramesCounted(int num_unique_frames) {
@@ -638,6 +676,7 @@ void ReceiveStatisticsProxy::OnTimingFrameInfoUpdated(
     stats_.first_frame_received_to_decoded_ms =
         *first_decoded_frame_time_ms_ - *first_frame_received_time_ms_;
   }
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::RtcpPacketTypesCounterUpdated(
@@ -647,6 +686,7 @@ void ReceiveStatisticsProxy::RtcpPacketTypesCounterUpdated(
   if (stats_.ssrc != ssrc)
     return;
   stats_.rtcp_packet_type_counts = packet_counter;
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnCname(uint32_t ssrc, absl::string_view cname) {
@@ -656,12 +696,20 @@ void ReceiveStatisticsProxy::OnCname(uint32_t ssrc, absl::string_view cname) {
   if (stats_.ssrc != ssrc)
     return;
   stats_.c_name = std::string(cname);
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
                                             absl::optional<uint8_t> qp,
                                             int32_t decode_time_ms,
                                             VideoContentType content_type) {
+  // The plain counters are accumulated outside of |crit_|; this method is the
+  // only writer so the values read back below are consistent.
+  const uint32_t frames_decoded =
+      frames_decoded_.fetch_add(1, std::memory_order_relaxed) + 1;
+  total_decode_time_ms_.fetch_add(decode_time_ms, std::memory_order_relaxed);
+  last_decode_time_ms_.store(decode_time_ms, std::memory_order_relaxed);
+
   rtc::CritScope lock(&crit_);
 
   uint64_t now_ms = clock_->TimeInMilliseconds();
@@ -678,10 +726,9 @@ void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
 
   ContentSpecificStats* content_specific_stats =
       &content_specific_stats_[content_type];
-  ++stats_.frames_decoded;
   if (qp) {
     if (!stats_.qp_sum) {
-      if (stats_.frames_decoded != 1) {
+      if (frames_decoded != 1) {
         RTC_LOG(LS_WARNING)
             << "Frames decoded was not 1 when first qp value was received.";
       }
@@ -694,8 +741,6 @@ void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
         << "QP sum was already set and no QP was given for a frame.";
   }
   decode_time_counter_.Add(decode_time_ms);
-  stats_.decode_ms = decode_time_ms;
-  stats_.total_decode_time_ms += decode_time_ms;
   last_content_type_ = content_type;
   decode_fps_estimator_.Update(1, now_ms);
   if (last_decoded_frame_time_ms_) {
@@ -707,10 +752,11 @@ void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
         interframe_delay_ms);
     content_specific_stats->flow_duration_ms += interframe_delay_ms;
   }
-  if (stats_.frames_decoded == 1) {
+  if (frames_decoded == 1) {
     first_decoded_frame_time_ms_.emplace(now_ms);
   }
   last_decoded_frame_time_ms_.emplace(now_ms);
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnRenderedFrame(const VideoFrame& frame) {
@@ -748,6 +794,7 @@ void ReceiveStatisticsProxy::OnRenderedFrame(const VideoFrame& frame) {
     }
   }
   QualitySample();
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnSyncOffsetUpdated(int64_t sync_offset_ms,
@@ -763,6 +810,7 @@ void ReceiveStatisticsProxy::OnSyncOffsetUpdated(int64_t sync_offset_ms,
     offset_khz = static_cast<int>(std::fabs(estimated_freq_khz - 90.0) + 0.5);
 
   freq_offset_counter_.Add(offset_khz);
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnCompleteFrame(bool is_keyframe,
@@ -795,11 +843,12 @@ void ReceiveStatisticsProxy::OnCompleteFrame(bool is_keyframe,
   int64_t now_ms = clock_->TimeInMilliseconds();
   frame_window_.insert(std::make_pair(now_ms, size_bytes));
   UpdateFramerate(now_ms);
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnDroppedFrames(uint32_t frames_dropped) {
-  rtc::CritScope lock(&crit_);
-  stats_.frames_dropped += frames_dropped;
+  // Accumulated without |crit_|; GetStats() reads the counter atomically.
+  frames_dropped_.fetch_add(frames_dropped, std::memory_order_relaxed);
 }
 
 void ReceiveStatisticsProxy::OnPreDecode(VideoCodecType codec_type, int qp) {
@@ -819,12 +868,12 @@ void ReceiveStatisticsProxy::OnStreamInactive() {
   // Don't report inter-frame delay if stream was paused.
   last_decoded_frame_time_ms_.reset();
   video_quality_observer_->OnStreamInactive();
+  ++stats_version_;
 }
 
 void ReceiveStatisticsProxy::OnRttUpdate(int64_t avg_rtt_ms,
                                          int64_t max_rtt_ms) {
-  rtc::CritScope lock(&crit_);
-  avg_rtt_ms_ = avg_rtt_ms;
+  avg_rtt_ms_.store(avg_rtt_ms, std::memory_order_relaxed);
 }
 
 void ReceiveStatisticsProxy::DecoderThreadStarting() {
@@ -11,6 +11,7 @@
 #ifndef VIDEO_RECEIVE_STATISTICS_PROXY_H_
 #define VIDEO_RECEIVE_STATISTICS_PROXY_H_
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -127,6 +128,10 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
   void UpdateFramerate(int64_t now_ms) const
       RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
+  // Writes the counters that are accumulated atomically outside of |crit_|
+  // into |stats|.
+  void FoldHotCounters(VideoReceiveStream::Stats* stats) const;
+
   Clock* const clock_;
   // Ownership of this object lies with the owner of the ReceiveStatisticsProxy
   // instance.  Lifetime is guaranteed to outlive |this|.
@@ -166,7 +171,7 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
       RTC_GUARDED_BY(crit_);
   MaxCounter freq_offset_counter_ RTC_GUARDED_BY(crit_);
   QpCounters qp_counters_ RTC_GUARDED_BY(decode_thread_);
-  int64_t avg_rtt_ms_ RTC_GUARDED_BY(crit_);
+  std::atomic<int64_t> avg_rtt_ms_{0};
   mutable std::map<int64_t, size_t> frame_window_ RTC_GUARDED_BY(&crit_);
   VideoContentType last_content_type_ RTC_GUARDED_BY(&crit_);
   VideoCodecType last_codec_type_ RTC_GUARDED_BY(&crit_);
@@ -180,6 +185,22 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
   mutable rtc::MovingMaxCounter<TimingFrameInfo> timing_frame_info_counter_
       RTC_GUARDED_BY(&crit_);
   absl::optional<int> num_unique_frames_ RTC_GUARDED_BY(crit_);
+  // Hot counters that are accumulated without taking |crit_| and folded into
+  // the stats by GetStats(). Relaxed ordering suffices since each counter is
+  // read and reported independently.
+  std::atomic<uint32_t> frames_decoded_{0};
+  std::atomic<uint64_t> total_decode_time_ms_{0};
+  std::atomic<int> last_decode_time_ms_{0};
+  std::atomic<uint32_t> frames_dropped_{0};
+  // Incremented at the end of every state change that is visible in GetStats,
+  // so that GetStats can reuse the last published snapshot when nothing has
+  // changed since it was built.
+  std::atomic<uint32_t> stats_version_{0};
+  mutable rtc::CriticalSection snapshot_crit_;
+  mutable VideoReceiveStream::Stats snapshot_stats_
+      RTC_GUARDED_BY(snapshot_crit_);
+  mutable int64_t snapshot_time_ms_ RTC_GUARDED_BY(snapshot_crit_) = -1;
+  mutable uint32_t snapshot_version_ RTC_GUARDED_BY(snapshot_crit_) = 0;
   rtc::ThreadChecker decode_thread_;
   rtc::ThreadChecker network_thread_;
   rtc::ThreadChecker main_thread_;
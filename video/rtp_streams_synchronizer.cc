@@ -20,14 +20,14 @@
 namespace webrtc {
 namespace {
 bool UpdateMeasurements(StreamSynchronization::Measurements* stream,
-                        const Syncable::Info& info) {
+                        const Syncable::Info& info,
+                        bool* new_rtcp_sr) {
   RTC_DCHECK(stream);
   stream->latest_timestamp = info.latest_received_capture_timestamp;
   stream->latest_receive_time_ms = info.latest_receive_time_ms;
-  bool new_rtcp_sr = false;
   if (!stream->rtp_to_ntp.UpdateMeasurements(
           info.capture_time_ntp_secs, info.capture_time_ntp_frac,
-          info.capture_time_source_clock, &new_rtcp_sr)) {
+          info.capture_time_source_clock, new_rtcp_sr)) {
     return false;
   }
   return true;
@@ -38,6 +38,8 @@ RtpStreamsSynchronizer::RtpStreamsSynchronizer(Syncable* syncable_video)
     : syncable_video_(syncable_video),
       syncable_audio_(nullptr),
       sync_(),
+      last_audio_delay_ms_(-1),
+      last_video_delay_ms_(-1),
       last_sync_time_(rtc::TimeNanos()) {
   RTC_DCHECK(syncable_video);
   process_thread_checker_.Detach();
@@ -58,6 +60,11 @@ void RtpStreamsSynchronizer::ConfigureSync(Syncable* syncable_audio) {
     sync_.reset(new StreamSynchronization(syncable_video_->id(),
                                           syncable_audio_->id()));
   }
+  last_audio_delay_ms_ = -1;
+  last_video_delay_ms_ = -1;
+
+  rtc::CritScope snapshot_lock(&snapshot_crit_);
+  snapshot_.syncable_audio = syncable_audio_;
 }
 
 int64_t RtpStreamsSynchronizer::TimeUntilNextProcess() {
@@ -77,22 +84,49 @@ void RtpStreamsSynchronizer::Process() {
   }
   RTC_DCHECK(sync_.get());
 
+  bool new_audio_rtcp_sr = false;
   absl::optional<Syncable::Info> audio_info = syncable_audio_->GetInfo();
-  if (!audio_info || !UpdateMeasurements(&audio_measurement_, *audio_info)) {
+  if (!audio_info ||
+      !UpdateMeasurements(&audio_measurement_, *audio_info,
+                          &new_audio_rtcp_sr)) {
     return;
   }
 
   int64_t last_video_receive_ms = video_measurement_.latest_receive_time_ms;
+  bool new_video_rtcp_sr = false;
   absl::optional<Syncable::Info> video_info = syncable_video_->GetInfo();
-  if (!video_info || !UpdateMeasurements(&video_measurement_, *video_info)) {
+  if (!video_info ||
+      !UpdateMeasurements(&video_measurement_, *video_info,
+                          &new_video_rtcp_sr)) {
     return;
   }
 
+  if (new_audio_rtcp_sr || new_video_rtcp_sr) {
+    // A new sender report updated the RTP to NTP mapping; publish it for the
+    // render path.
+    rtc::CritScope snapshot_lock(&snapshot_crit_);
+    snapshot_.audio_rtp_to_ntp = audio_measurement_.rtp_to_ntp;
+    snapshot_.video_rtp_to_ntp = video_measurement_.rtp_to_ntp;
+  }
+
   if (last_video_receive_ms == video_measurement_.latest_receive_time_ms) {
     // No new video packet has been received since last update.
     return;
   }
 
+  // Only recompute the relative delays when the timing actually changed: a
+  // new RTCP sender report on either stream, or a change of the reported
+  // playout delays (e.g. a NetEq target delay update or the effect of our own
+  // previous adjustment). In steady state this leaves each tick as a cheap
+  // measurement refresh.
+  if (!new_audio_rtcp_sr && !new_video_rtcp_sr &&
+      audio_info->current_delay_ms == last_audio_delay_ms_ &&
+      video_info->current_delay_ms == last_video_delay_ms_) {
+    return;
+  }
+  last_audio_delay_ms_ = audio_info->current_delay_ms;
+  last_video_delay_ms_ = video_info->current_delay_ms;
+
   int relative_delay_ms;
   // Calculate how much later or earlier the audio stream is compared to video.
   if (!sync_->ComputeRelativeDelay(audio_measurement_, video_measurement_,
@@ -123,21 +157,23 @@ bool RtpStreamsSynchronizer::GetStreamSyncOffsetInMs(
     int64_t render_time_ms,
     int64_t* stream_offset_ms,
     double* estimated_freq_khz) const {
-  rtc::CritScope lock(&crit_);
-  if (!syncable_audio_) {
+  // Deliberately reads the snapshot rather than taking |crit_|, so rendered
+  // frames are not blocked behind a delay recomputation in Process().
+  rtc::CritScope lock(&snapshot_crit_);
+  if (!snapshot_.syncable_audio) {
     return false;
   }
 
-  uint32_t playout_timestamp = syncable_audio_->GetPlayoutTimestamp();
+  uint32_t playout_timestamp = snapshot_.syncable_audio->GetPlayoutTimestamp();
 
   int64_t latest_audio_ntp;
-  if (!audio_measurement_.rtp_to_ntp.Estimate(playout_timestamp,
-                                              &latest_audio_ntp)) {
+  if (!snapshot_.audio_rtp_to_ntp.Estimate(playout_timestamp,
+                                           &latest_audio_ntp)) {
     return false;
   }
 
   int64_t latest_video_ntp;
-  if (!video_measurement_.rtp_to_ntp.Estimate(timestamp, &latest_video_ntp)) {
+  if (!snapshot_.video_rtp_to_ntp.Estimate(timestamp, &latest_video_ntp)) {
     return false;
   }
 
@@ -146,7 +182,7 @@ bool RtpStreamsSynchronizer::GetStreamSyncOffsetInMs(
     latest_video_ntp += time_to_render_ms;
 
   *stream_offset_ms = latest_audio_ntp - latest_video_ntp;
-  *estimated_freq_khz = video_measurement_.rtp_to_ntp.params()->frequency_khz;
+  *estimated_freq_khz = snapshot_.video_rtp_to_ntp.params()->frequency_khz;
   return true;
 }
 
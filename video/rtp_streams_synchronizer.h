@@ -53,6 +53,22 @@ class RtpStreamsSynchronizer : public Module {
   std::unique_ptr<StreamSynchronization> sync_ RTC_GUARDED_BY(crit_);
   StreamSynchronization::Measurements audio_measurement_ RTC_GUARDED_BY(crit_);
   StreamSynchronization::Measurements video_measurement_ RTC_GUARDED_BY(crit_);
+  // Delays reported by the streams at the last delay recomputation, used to
+  // detect NetEq/jitter buffer target changes between RTCP sender reports.
+  int last_audio_delay_ms_ RTC_GUARDED_BY(crit_);
+  int last_video_delay_ms_ RTC_GUARDED_BY(crit_);
+
+  // Snapshot of the state needed by GetStreamSyncOffsetInMs(), published by
+  // the process thread whenever a new RTCP SR updates the RTP to NTP mapping.
+  // Guarded by its own lock so that the per-frame render path never contends
+  // with a delay recomputation in Process().
+  struct RenderSnapshot {
+    Syncable* syncable_audio = nullptr;
+    RtpToNtpEstimator audio_rtp_to_ntp;
+    RtpToNtpEstimator video_rtp_to_ntp;
+  };
+  rtc::CriticalSection snapshot_crit_;
+  RenderSnapshot snapshot_ RTC_GUARDED_BY(snapshot_crit_);
 
   rtc::ThreadChecker process_thread_checker_;
   int64_t last_sync_time_ RTC_GUARDED_BY(&process_thread_checker_);
@@ -15,6 +15,7 @@
 #include "absl/algorithm/container.h"
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
+#include "api/video/i420_buffer.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "modules/rtp_rtcp/source/rtp_format.h"
 #include "modules/rtp_rtcp/source/rtp_utility.h"
@@ -50,6 +51,8 @@ bool IsFlexfec(int payload_type) {
 }
 }  // namespace
 
+std::atomic<uint32_t> VideoAnalyzer::claimed_comparison_threads_{0};
+
 VideoAnalyzer::VideoAnalyzer(
     test::LayerFilteringTransport* transport,
     const std::string& test_label,
@@ -130,6 +133,14 @@ VideoAnalyzer::VideoAnalyzer(
     num_cores = std::min(num_cores, kMaxComparisonThreads);
   }
 
+  // The thread budget is shared between analyzers running at the same time,
+  // so that tests which monitor the quality of several streams at once don't
+  // oversubscribe the machine with comparison threads.
+  const uint32_t claimed = claimed_comparison_threads_.load();
+  num_cores = claimed < num_cores ? num_cores - claimed : 1;
+  allocated_comparison_threads_ = num_cores;
+  claimed_comparison_threads_.fetch_add(num_cores);
+
   for (uint32_t i = 0; i < num_cores; ++i) {
     rtc::PlatformThread* thread =
         new rtc::PlatformThread(&FrameComparisonThread, this, "Analyzer");
@@ -153,6 +164,7 @@ VideoAnalyzer::~VideoAnalyzer() {
     thread->Stop();
     delete thread;
   }
+  claimed_comparison_threads_.fetch_sub(allocated_comparison_threads_);
 }
 
 void VideoAnalyzer::SetReceiver(PacketReceiver* receiver) {
@@ -750,8 +762,22 @@ void VideoAnalyzer::PerformFrameComparison(
   double psnr = -1.0;
   double ssim = -1.0;
   if (comparison.reference && !comparison.dropped) {
-    psnr = I420PSNR(&*comparison.reference, &*comparison.render);
-    ssim = I420SSIM(&*comparison.reference, &*comparison.render);
+    // Convert and, if needed, rescale the frames once and run both metrics on
+    // the shared buffers; the VideoFrame overloads of I420PSNR and I420SSIM
+    // would convert each frame anew for every metric.
+    rtc::scoped_refptr<I420BufferInterface> reference =
+        comparison.reference->video_frame_buffer()->ToI420();
+    rtc::scoped_refptr<I420BufferInterface> render =
+        comparison.render->video_frame_buffer()->ToI420();
+    if (reference->width() != render->width() ||
+        reference->height() != render->height()) {
+      rtc::scoped_refptr<I420Buffer> scaled_render =
+          I420Buffer::Create(reference->width(), reference->height());
+      scaled_render->ScaleFrom(*render);
+      render = scaled_render;
+    }
+    psnr = I420PSNR(*reference, *render);
+    ssim = I420SSIM(*reference, *render);
   }
 
   rtc::CritScope crit(&comparison_lock_);
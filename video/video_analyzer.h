@@ -10,6 +10,7 @@
 #ifndef VIDEO_VIDEO_ANALYZER_H_
 #define VIDEO_VIDEO_ANALYZER_H_
 
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
@@ -281,6 +282,10 @@ class VideoAnalyzer : public PacketReceiver,
   const double avg_ssim_threshold_;
   bool is_quick_test_enabled_;
 
+  // Number of comparison threads claimed by analyzers that are currently
+  // alive; used to split the thread budget between concurrent instances.
+  static std::atomic<uint32_t> claimed_comparison_threads_;
+  uint32_t allocated_comparison_threads_;
   std::vector<rtc::PlatformThread*> comparison_thread_pool_;
   rtc::Event comparison_available_event_;
   std::deque<FrameComparison> comparisons_ RTC_GUARDED_BY(comparison_lock_);
@@ -0,0 +1,286 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Capacity benchmark answering "how many concurrent calls fit one core".
+// Instantiates N sender/receiver Call pairs connected over an in-process
+// transport, each running a real VP8 encode/decode pipeline, and ramps N
+// until the delivered framerate drops below a threshold. For every ramp step
+// the process CPU time is measured with rtc_base/cpu_time.h and reported as
+// cores used and estimated calls per core.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/memory/memory.h"
+#include "api/rtc_event_log/rtc_event_log.h"
+#include "api/rtp_parameters.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/test/simulated_network.h"
+#include "api/test/video/function_video_decoder_factory.h"
+#include "api/test/video/function_video_encoder_factory.h"
+#include "api/video/builtin_video_bitrate_allocator_factory.h"
+#include "api/video/video_sink_interface.h"
+#include "call/call.h"
+#include "call/fake_network_pipe.h"
+#include "call/simulated_network.h"
+#include "modules/video_coding/codecs/vp8/include/vp8.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/time_utils.h"
+#include "system_wrappers/include/clock.h"
+#include "system_wrappers/include/sleep.h"
+#include "test/direct_transport.h"
+#include "test/encoder_settings.h"
+#include "test/frame_generator.h"
+#include "test/frame_generator_capturer.h"
+#include "test/single_threaded_task_queue.h"
+
+ABSL_FLAG(int, width, 1280, "Video width per call.");
+ABSL_FLAG(int, height, 720, "Video height per call.");
+ABSL_FLAG(int, framerate, 30, "Frames per second per call.");
+ABSL_FLAG(int, bitrate_kbps, 1700, "Target send bitrate per call.");
+ABSL_FLAG(int, warmup_s, 3, "Seconds to let each ramp step settle.");
+ABSL_FLAG(int, duration_s, 10, "Measured seconds per ramp step.");
+ABSL_FLAG(int, max_calls, 32, "Upper bound on the number of calls.");
+ABSL_FLAG(double,
+          fps_threshold,
+          0.95,
+          "Lowest acceptable delivered/target framerate ratio; the ramp stops "
+          "when any call falls below it.");
+
+namespace webrtc {
+namespace test {
+namespace {
+
+constexpr uint32_t kSendSsrc = 0xC0FFED;
+constexpr uint32_t kReceiverLocalSsrc = 0x123456;
+constexpr int kPayloadTypeVP8 = 123;
+constexpr int kTransportSequenceNumberExtensionId = 8;
+
+class FrameCountingRenderer : public rtc::VideoSinkInterface<VideoFrame> {
+ public:
+  void OnFrame(const VideoFrame& frame) override {
+    rendered_frames_.fetch_add(1, std::memory_order_relaxed);
+  }
+  uint32_t rendered_frames() const {
+    return rendered_frames_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint32_t> rendered_frames_{0};
+};
+
+// One sender/receiver Call pair connected over an in-process transport with a
+// real VP8 encode/decode pipeline, mirroring the setup of CallTest but
+// self-contained so that many instances can run concurrently.
+class CapacityCall {
+ public:
+  CapacityCall(TaskQueueFactory* task_queue_factory,
+               int width,
+               int height,
+               int framerate,
+               int bitrate_bps)
+      : clock_(Clock::GetRealTimeClock()),
+        task_queue_factory_(task_queue_factory),
+        encoder_factory_([]() { return VP8Encoder::Create(); }),
+        decoder_factory_([]() { return VP8Decoder::Create(); }),
+        bitrate_allocator_factory_(CreateBuiltinVideoBitrateAllocatorFactory()),
+        transport_queue_("CapacityCallTransport") {
+    Call::Config call_config(&event_log_);
+    call_config.task_queue_factory = task_queue_factory_;
+    call_config.bitrate_config.start_bitrate_bps = bitrate_bps;
+    sender_call_.reset(Call::Create(call_config));
+    receiver_call_.reset(Call::Create(call_config));
+
+    const std::map<uint8_t, MediaType> payload_type_map = {
+        {kPayloadTypeVP8, MediaType::VIDEO}};
+    send_transport_ = absl::make_unique<DirectTransport>(
+        &transport_queue_, CreatePipe(), sender_call_.get(), payload_type_map);
+    receive_transport_ = absl::make_unique<DirectTransport>(
+        &transport_queue_, CreatePipe(), receiver_call_.get(),
+        payload_type_map);
+    send_transport_->SetReceiver(receiver_call_->Receiver());
+    receive_transport_->SetReceiver(sender_call_->Receiver());
+    receiver_call_->SignalChannelNetworkState(MediaType::VIDEO, kNetworkUp);
+
+    VideoSendStream::Config send_config(send_transport_.get());
+    send_config.encoder_settings.encoder_factory = &encoder_factory_;
+    send_config.encoder_settings.bitrate_allocator_factory =
+        bitrate_allocator_factory_.get();
+    send_config.rtp.payload_name = "VP8";
+    send_config.rtp.payload_type = kPayloadTypeVP8;
+    send_config.rtp.ssrcs.push_back(kSendSsrc);
+    send_config.rtp.extensions.push_back(
+        RtpExtension(RtpExtension::kTransportSequenceNumberUri,
+                     kTransportSequenceNumberExtensionId));
+
+    VideoEncoderConfig encoder_config;
+    FillEncoderConfiguration(kVideoCodecVP8, 1, &encoder_config);
+    encoder_config.max_bitrate_bps = bitrate_bps;
+    send_stream_ = sender_call_->CreateVideoSendStream(
+        send_config.Copy(), encoder_config.Copy());
+
+    VideoReceiveStream::Config receive_config(receive_transport_.get());
+    receive_config.rtp.remb = false;
+    receive_config.rtp.transport_cc = true;
+    receive_config.rtp.local_ssrc = kReceiverLocalSsrc;
+    receive_config.rtp.remote_ssrc = kSendSsrc;
+    receive_config.rtp.extensions = send_config.rtp.extensions;
+    receive_config.renderer = &renderer_;
+    VideoReceiveStream::Decoder decoder =
+        CreateMatchingDecoder(kPayloadTypeVP8, "VP8");
+    decoder.decoder_factory = &decoder_factory_;
+    receive_config.decoders.push_back(decoder);
+    receive_stream_ =
+        receiver_call_->CreateVideoReceiveStream(std::move(receive_config));
+
+    capturer_ = absl::make_unique<FrameGeneratorCapturer>(
+        clock_,
+        FrameGenerator::CreateSquareGenerator(width, height, absl::nullopt,
+                                              absl::nullopt),
+        framerate, *task_queue_factory_);
+    capturer_->Init();
+    send_stream_->SetSource(capturer_.get(),
+                            DegradationPreference::MAINTAIN_FRAMERATE);
+  }
+
+  ~CapacityCall() {
+    capturer_.reset();
+    receive_stream_->Stop();
+    send_stream_->Stop();
+    receiver_call_->DestroyVideoReceiveStream(receive_stream_);
+    sender_call_->DestroyVideoSendStream(send_stream_);
+    send_transport_.reset();
+    receive_transport_.reset();
+    receiver_call_.reset();
+    sender_call_.reset();
+  }
+
+  void Start() {
+    send_stream_->Start();
+    receive_stream_->Start();
+    capturer_->Start();
+  }
+
+  uint32_t rendered_frames() const { return renderer_.rendered_frames(); }
+
+ private:
+  static std::unique_ptr<SimulatedPacketReceiverInterface> CreatePipe() {
+    return absl::make_unique<FakeNetworkPipe>(
+        Clock::GetRealTimeClock(),
+        absl::make_unique<SimulatedNetwork>(BuiltInNetworkBehaviorConfig()));
+  }
+
+  Clock* const clock_;
+  TaskQueueFactory* const task_queue_factory_;
+  RtcEventLogNull event_log_;
+  FunctionVideoEncoderFactory encoder_factory_;
+  FunctionVideoDecoderFactory decoder_factory_;
+  const std::unique_ptr<VideoBitrateAllocatorFactory>
+      bitrate_allocator_factory_;
+  DEPRECATED_SingleThreadedTaskQueueForTesting transport_queue_;
+  FrameCountingRenderer renderer_;
+  std::unique_ptr<Call> sender_call_;
+  std::unique_ptr<Call> receiver_call_;
+  std::unique_ptr<DirectTransport> send_transport_;
+  std::unique_ptr<DirectTransport> receive_transport_;
+  VideoSendStream* send_stream_ = nullptr;
+  VideoReceiveStream* receive_stream_ = nullptr;
+  std::unique_ptr<FrameGeneratorCapturer> capturer_;
+};
+
+int RunCapacityBench() {
+  const int width = absl::GetFlag(FLAGS_width);
+  const int height = absl::GetFlag(FLAGS_height);
+  const int framerate = absl::GetFlag(FLAGS_framerate);
+  const int bitrate_bps = absl::GetFlag(FLAGS_bitrate_kbps) * 1000;
+  const int warmup_s = absl::GetFlag(FLAGS_warmup_s);
+  const int duration_s = absl::GetFlag(FLAGS_duration_s);
+  const int max_calls = absl::GetFlag(FLAGS_max_calls);
+  const double fps_threshold = absl::GetFlag(FLAGS_fps_threshold);
+
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+
+  printf("Ramping %dx%d@%dfps calls at %d kbps, %ds per step.\n", width,
+         height, framerate, bitrate_bps / 1000, duration_s);
+
+  int sustained_calls = 0;
+  double sustained_calls_per_core = 0.0;
+  for (int num_calls = 1; num_calls <= max_calls; num_calls *= 2) {
+    std::vector<std::unique_ptr<CapacityCall>> calls;
+    for (int i = 0; i < num_calls; ++i) {
+      calls.push_back(absl::make_unique<CapacityCall>(
+          task_queue_factory.get(), width, height, framerate, bitrate_bps));
+    }
+    for (auto& call : calls)
+      call->Start();
+    SleepMs(warmup_s * 1000);
+
+    std::vector<uint32_t> frames_before;
+    for (auto& call : calls)
+      frames_before.push_back(call->rendered_frames());
+    const int64_t cpu_before_ns = rtc::GetProcessCpuTimeNanos();
+    const int64_t wall_before_ns = rtc::TimeNanos();
+
+    SleepMs(duration_s * 1000);
+
+    const int64_t cpu_ns = rtc::GetProcessCpuTimeNanos() - cpu_before_ns;
+    const int64_t wall_ns = rtc::TimeNanos() - wall_before_ns;
+    double min_fps_ratio = 1.0;
+    for (size_t i = 0; i < calls.size(); ++i) {
+      const double delivered_fps =
+          static_cast<double>(calls[i]->rendered_frames() - frames_before[i]) *
+          rtc::kNumNanosecsPerSec / wall_ns;
+      min_fps_ratio = std::min(min_fps_ratio, delivered_fps / framerate);
+    }
+    calls.clear();
+
+    const double cores_used = static_cast<double>(cpu_ns) / wall_ns;
+    const double calls_per_core = num_calls / std::max(cores_used, 1e-6);
+    printf(
+        "calls: %2d  cores used: %5.2f  cpu/call: %5.1f%%  "
+        "calls/core: %5.2f  min delivered fps ratio: %.3f\n",
+        num_calls, cores_used, 100.0 * cores_used / num_calls, calls_per_core,
+        min_fps_ratio);
+
+    if (min_fps_ratio < fps_threshold) {
+      printf("Framerate threshold exceeded, stopping ramp.\n");
+      break;
+    }
+    sustained_calls = num_calls;
+    sustained_calls_per_core = calls_per_core;
+  }
+
+  if (sustained_calls == 0) {
+    printf("A single call did not sustain the target framerate.\n");
+    return 1;
+  }
+  printf("Sustained %d concurrent calls; estimated %.2f calls per core.\n",
+         sustained_calls, sustained_calls_per_core);
+  return 0;
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace webrtc
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+  return webrtc::test::RunCapacityBench();
+}
@@ -328,8 +328,12 @@ void VideoReceiveStream::Start() {
   transport_adapter_.Enable();
   rtc::VideoSinkInterface<VideoFrame>* renderer = nullptr;
   if (config_.enable_prerenderer_smoothing) {
+    // A configured render delay of zero means the stream favors latency over
+    // smooth delivery; frames are then handed to the sink synchronously on
+    // the decoder thread instead of through the render queue.
     incoming_video_stream_.reset(new IncomingVideoStream(
-        task_queue_factory_, config_.render_delay_ms, this));
+        task_queue_factory_, config_.render_delay_ms, this,
+        /*direct_render=*/config_.render_delay_ms == 0));
     renderer = incoming_video_stream_.get();
   } else {
     renderer = this;
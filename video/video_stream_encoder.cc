@@ -30,6 +30,7 @@
 #include "rtc_base/arraysize.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/experiments/alr_experiment.h"
+#include "rtc_base/experiments/field_trial_settings_cache.h"
 #include "rtc_base/experiments/quality_scaling_experiment.h"
 #include "rtc_base/experiments/rate_control_settings.h"
 #include "rtc_base/location.h"
@@ -505,7 +506,13 @@ VideoStreamEncoder::VideoStreamEncoder(
       encoder_failed_(false),
       clock_(clock),
       degradation_preference_(DegradationPreference::DISABLED),
-      posted_frames_waiting_for_encode_(0),
+      balanced_settings_(GetFieldTrialSettings<BalancedDegradationSettings>()),
+      mailbox_post_time_us_(0),
+      mailbox_log_stats_(false),
+      mailbox_wake_posted_(false),
+      mailbox_accumulated_update_rect_{0, 0, 0, 0},
+      mailbox_dropped_frames_(0),
+      total_mailbox_dropped_frames_(0),
       last_captured_timestamp_(0),
       delta_ntp_internal_ms_(clock_->CurrentNtpInMilliseconds() -
                              clock_->TimeInMilliseconds()),
@@ -1039,10 +1046,8 @@ void VideoStreamEncoder::OnFrame(const VideoFrame& video_frame) {
                         << incoming_frame.ntp_time_ms()
                         << " <= " << last_captured_timestamp_
                         << ") for incoming frame. Dropping.";
-    encoder_queue_.PostTask([this, incoming_frame]() {
-      RTC_DCHECK_RUN_ON(&encoder_queue_);
-      accumulated_update_rect_.Union(incoming_frame.update_rect());
-    });
+    rtc::CritScope cs(&incoming_frame_mailbox_crit_);
+    mailbox_accumulated_update_rect_.Union(incoming_frame.update_rect());
     return;
   }
 
@@ -1055,38 +1060,77 @@ void VideoStreamEncoder::OnFrame(const VideoFrame& video_frame) {
   last_captured_timestamp_ = incoming_frame.ntp_time_ms();
 
   int64_t post_time_us = rtc::TimeMicros();
-  ++posted_frames_waiting_for_encode_;
 
-  encoder_queue_.PostTask(
-      [this, incoming_frame, post_time_us, log_stats]() {
-        RTC_DCHECK_RUN_ON(&encoder_queue_);
-        encoder_stats_observer_->OnIncomingFrame(incoming_frame.width(),
-                                                 incoming_frame.height());
-        ++captured_frame_count_;
-        const int posted_frames_waiting_for_encode =
-            posted_frames_waiting_for_encode_.fetch_sub(1);
-        RTC_DCHECK_GT(posted_frames_waiting_for_encode, 0);
-        if (posted_frames_waiting_for_encode == 1) {
-          MaybeEncodeVideoFrame(incoming_frame, post_time_us);
-        } else {
-          // There is a newer frame in flight. Do not encode this frame.
-          RTC_LOG(LS_VERBOSE)
-              << "Incoming frame dropped due to that the encoder is blocked.";
-          ++dropped_frame_count_;
-          encoder_stats_observer_->OnFrameDropped(
-              VideoStreamEncoderObserver::DropReason::kEncoderQueue);
-          accumulated_update_rect_.Union(incoming_frame.update_rect());
-        }
-        if (log_stats) {
-          RTC_LOG(LS_INFO) << "Number of frames: captured "
-                           << captured_frame_count_
-                           << ", dropped (due to encoder blocked) "
-                           << dropped_frame_count_ << ", interval_ms "
-                           << kFrameLogIntervalMs;
-          captured_frame_count_ = 0;
-          dropped_frame_count_ = 0;
-        }
-      });
+  bool post_wake_task = false;
+  {
+    rtc::CritScope cs(&incoming_frame_mailbox_crit_);
+    if (mailbox_frame_) {
+      // The encoder queue has not yet picked up the previous frame; replace
+      // it with the newer one and account for the drop when the slot is
+      // consumed.
+      ++mailbox_dropped_frames_;
+      ++total_mailbox_dropped_frames_;
+      mailbox_accumulated_update_rect_.Union(mailbox_frame_->update_rect());
+    }
+    mailbox_frame_.emplace(std::move(incoming_frame));
+    mailbox_post_time_us_ = post_time_us;
+    mailbox_log_stats_ = log_stats;
+    if (!mailbox_wake_posted_) {
+      mailbox_wake_posted_ = true;
+      post_wake_task = true;
+    }
+  }
+  if (post_wake_task)
+    encoder_queue_.PostTask([this] { ConsumeMailboxFrame(); });
+}
+
+void VideoStreamEncoder::ConsumeMailboxFrame() {
+  RTC_DCHECK_RUN_ON(&encoder_queue_);
+  absl::optional<VideoFrame> frame;
+  int64_t post_time_us;
+  bool log_stats;
+  VideoFrame::UpdateRect dropped_update_rect;
+  int dropped_frames;
+  {
+    rtc::CritScope cs(&incoming_frame_mailbox_crit_);
+    frame = std::move(mailbox_frame_);
+    mailbox_frame_.reset();
+    post_time_us = mailbox_post_time_us_;
+    log_stats = mailbox_log_stats_;
+    dropped_update_rect = mailbox_accumulated_update_rect_;
+    mailbox_accumulated_update_rect_.MakeEmptyUpdate();
+    dropped_frames = mailbox_dropped_frames_;
+    mailbox_dropped_frames_ = 0;
+    mailbox_wake_posted_ = false;
+  }
+  accumulated_update_rect_.Union(dropped_update_rect);
+  if (!frame)
+    return;
+
+  encoder_stats_observer_->OnIncomingFrame(frame->width(), frame->height());
+  ++captured_frame_count_;
+  for (int i = 0; i < dropped_frames; ++i) {
+    // Overwritten frames came from the same source as the consumed frame, so
+    // report them with the consumed frame's dimensions.
+    encoder_stats_observer_->OnIncomingFrame(frame->width(), frame->height());
+    ++captured_frame_count_;
+    RTC_LOG(LS_VERBOSE)
+        << "Incoming frame dropped due to that the encoder is blocked.";
+    ++dropped_frame_count_;
+    encoder_stats_observer_->OnFrameDropped(
+        VideoStreamEncoderObserver::DropReason::kEncoderQueue);
+  }
+
+  MaybeEncodeVideoFrame(*frame, post_time_us);
+
+  if (log_stats) {
+    RTC_LOG(LS_INFO) << "Number of frames: captured " << captured_frame_count_
+                     << ", dropped (due to encoder blocked) "
+                     << dropped_frame_count_ << ", interval_ms "
+                     << kFrameLogIntervalMs;
+    captured_frame_count_ = 0;
+    dropped_frame_count_ = 0;
+  }
 }
 
 void VideoStreamEncoder::OnDiscardedFrame() {
@@ -1648,8 +1692,8 @@ EncodedImageCallback::Result VideoStreamEncoder::OnEncodedImage(
 
   // We are only interested in propagating the meta-data about the image, not
   // encoded data itself, to the post encode function. Since we cannot be sure
-  // the pointer will still be valid when run on the task queue, set it to null.
-  image_copy.set_buffer(nullptr, 0);
+  // the pointer will still be valid when run on the task queue, drop it.
+  image_copy.ClearEncodedData();
 
   int temporal_index = 0;
   if (codec_specific_info) {
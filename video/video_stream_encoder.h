@@ -101,6 +101,12 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
   // be called on |encoder_queue_|.
   rtc::TaskQueue* encoder_queue() { return &encoder_queue_; }
 
+  // Total number of frames so far that were overwritten by a newer frame in
+  // the handoff between the video source and |encoder_queue_|. Thread safe.
+  int FramesDroppedBeforeEncode() const {
+    return total_mailbox_dropped_frames_.load();
+  }
+
   // AdaptationObserverInterface implementation.
   // These methods are protected for easier testing.
   void AdaptUp(AdaptReason reason) override;
@@ -149,6 +155,11 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
   void OnFrame(const VideoFrame& video_frame) override;
   void OnDiscardedFrame() override;
 
+  // Consumes the latest frame from the incoming frame mailbox and reports
+  // any frames that were overwritten while the slot was occupied. Runs on
+  // |encoder_queue_|.
+  void ConsumeMailboxFrame();
+
   void MaybeEncodeVideoFrame(const VideoFrame& frame,
                              int64_t time_when_posted_in_ms);
 
@@ -301,7 +312,8 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
   // Set depending on degradation preferences.
   DegradationPreference degradation_preference_ RTC_GUARDED_BY(&encoder_queue_);
 
-  const BalancedDegradationSettings balanced_settings_;
+  // Shared parsed instance; see rtc_base/experiments/field_trial_settings_cache.h.
+  const BalancedDegradationSettings& balanced_settings_;
 
   struct AdaptationRequest {
     // The pixel count produced by the source at the time of the adaptation.
@@ -318,7 +330,24 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
 
   rtc::RaceChecker incoming_frame_race_checker_
       RTC_GUARDED_BY(incoming_frame_race_checker_);
-  std::atomic<int> posted_frames_waiting_for_encode_;
+
+  // Single-slot mailbox between the video source and |encoder_queue_|. The
+  // source always overwrites the slot with the latest frame, so at most one
+  // wake-up task is in flight regardless of the capture rate; a frame that
+  // is overwritten before it is consumed is dropped (latest-frame-wins).
+  rtc::CriticalSection incoming_frame_mailbox_crit_;
+  absl::optional<VideoFrame> mailbox_frame_
+      RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  int64_t mailbox_post_time_us_ RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  bool mailbox_log_stats_ RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  bool mailbox_wake_posted_ RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  // Update rects and count of frames overwritten in the mailbox, reported on
+  // |encoder_queue_| when the next frame is consumed.
+  VideoFrame::UpdateRect mailbox_accumulated_update_rect_
+      RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  int mailbox_dropped_frames_ RTC_GUARDED_BY(incoming_frame_mailbox_crit_);
+  std::atomic<int> total_mailbox_dropped_frames_;
+
   // Used to make sure incoming time stamp is increasing for every frame.
   int64_t last_captured_timestamp_ RTC_GUARDED_BY(incoming_frame_race_checker_);
   // Delta used for translating between NTP and internal timestamps.